@@ -0,0 +1,266 @@
+#[=============================================================================[
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2022 Refinitiv. All rights reserved.            --
+#]=============================================================================]
+
+
+include(rcdevExternalUtils)
+
+if(NOT zstd_url)
+	set(zstd_url "https://github.com/facebook/zstd/archive/v1.5.2.tar.gz")
+endif()
+# No default hash is set; define zstd_hash to pin the downloaded archive
+if(NOT zstd_version)
+	set(zstd_version "1.5.2")
+endif()
+
+# If the option for using the system installed package is not defined
+# since zstd does not have a published CMake find module. However,
+# if a set of previously built zstd binaries exist outside this build
+# tree, this provides the option to use them
+if((NOT zstd_USE_INSTALLED) AND 
+	(NOT TARGET ZSTD::ZSTD) )
+
+	# An external project for libzstd
+	set(_EPA_NAME "zstd")
+
+	# Initialize the directory variables for the external project
+	# default:
+	#        external/
+	#                dlcache/
+	#                  BUILD/_EP_NAME/
+	#                               source/
+	#                               build/
+	#        install/
+	rcdev_init_ep_add(${_EPA_NAME})
+
+	# get the file name off the url to ensure it is
+	# downloaded with the same name
+	get_filename_component(_dl_filename "${zstd_url}" NAME)
+	set( _DL_METHOD "URL           ${zstd_url}")
+
+	if(zstd_hash)
+		list(APPEND _DL_METHOD "URL_HASH      ${zstd_hash}")
+	endif()
+
+	list(APPEND _DL_METHOD "DOWNLOAD_DIR  ${zstd_download}")
+
+	if (DEFINED _dl_filename)
+		list(APPEND _DL_METHOD "DOWNLOAD_NAME ${_EPA_NAME}-${_dl_filename}" )
+	endif()
+
+	# the top CMake entry point is not in the top source_dir location
+	# so need to define 'SOURCE_SUBDIR'
+	set(_EPA_SOURCE_DIR "SOURCE_DIR ${zstd_source}"
+						"SOURCE_SUBDIR build/cmake")
+	# the BINARY_DIR is not seperate for this type of external project
+	set(_EPA_INSTALL_DIR "INSTALL_DIR ${zstd_install}")
+
+	# check for any defined flags
+	if(zstd_BUILD_SHARED_LIBS)
+		set(_shared_arg "-DZSTD_BUILD_SHARED:BOOL=ON"
+					   "-DZSTD_BUILD_STATIC:BOOL=OFF")
+	else()
+		set(_shared_arg "-DZSTD_BUILD_SHARED:BOOL=OFF"
+					   "-DZSTD_BUILD_STATIC:BOOL=ON")
+		set(_config_options "-DCMAKE_POSITION_INDEPENDENT_CODE:BOOL=ON")
+	endif()
+	# Only the library is needed
+	list(APPEND _config_options "-DZSTD_BUILD_PROGRAMS:BOOL=OFF"
+								"-DZSTD_BUILD_TESTS:BOOL=OFF"
+								"-DZSTD_MULTITHREAD_SUPPORT:BOOL=OFF")
+
+	unset(_cfg_type)
+	if (WIN32)
+		list(APPEND _config_options "-DCMAKE_DEBUG_POSTFIX:STRING=d"
+									"-DCMAKE_C_FLAGS:STRING=/DEBUG:NONE")
+	else()
+		# Since our internal build types are Debug and Optimized, only Debug will translate
+		if (CMAKE_BUILD_TYPE MATCHES "Debug")
+			set(_cfg_type "${CMAKE_BUILD_TYPE}")
+			list(APPEND _config_options "-DCMAKE_DEBUG_POSTFIX:STRING=d" 
+										"-DCMAKE_BUILD_TYPE:STRING=${CMAKE_BUILD_TYPE}")
+		else()
+			set(_cfg_type "Release")
+			list(APPEND _config_options "-DCMAKE_BUILD_TYPE:STRING=Release")
+		endif()
+            
+		list(APPEND _config_options "-DCMAKE_C_FLAGS:STRING=-m${RCDEV_HOST_SYSTEM_BITS}"
+                                    "-DCMAKE_CXX_FLAGS:STRING=-m${RCDEV_HOST_SYSTEM_BITS}"
+                                        )
+	endif()	
+
+	# Append the shared args to the CMake arguments to the template variable
+	set( _EPA_CMAKE_ARGS "CMAKE_ARGS"
+						"-DCMAKE_INSTALL_PREFIX:STRING=<INSTALL_DIR>"
+						"${_config_options}"
+						"${_shared_arg}"
+						)
+
+	# Since this external project has a CMakeLists.txt, the default CONFIG_COMMAND can be
+	# used and a seperate config step does not need to be defined here.
+	#  Adding CONFIGURE_COMMAND  "" would skip the default CMake configure step
+	#  list(APPEND _EPA_CONFIGURE_COMMAND  "CONFIGURE_COMMAND  \"\"" )
+
+	# Typically, the build and install steps can be combined.  However, having them as 
+	#  two seperate steps help in the event of having to debug a build
+	# Set the <.....>_COMMAND for the build and install template fields
+	# However, for this external project it is works out better to combine these next two steps
+	# within the INSTALL_COMMAND step.  So, this is skipping the BUILD_COMMAND by 
+	# passing "" as the argument for the BUILD_COMMAND
+	set( _EPA_BUILD_COMMAND 
+				"BUILD_COMMAND        \"\"")
+
+	# Passing the two supported build config types along to the INSTALL_COMMAND for Windows and for 
+	# single build type platforms, like Linux, the current config typed is built and installed
+	if (WIN32)
+		set( _EPA_INSTALL_COMMAND 
+					"INSTALL_COMMAND    \"${CMAKE_COMMAND}\"   --build .  --target install  --config Release "
+					"        COMMAND    \"${CMAKE_COMMAND}\"   --build .  --target install  --config Debug ")
+	else()
+		set( _EPA_INSTALL_COMMAND 
+				"INSTALL_COMMAND    ${CMAKE_COMMAND}   --build .  --target install  --config ${_cfg_type} ")
+	endif()	
+
+	# If there isn't a binary directory defined then make sure
+	# the option 'BUILD_IN_SOURCE' is enabled
+	if (NOT DEFINED _EPA_BINARY_DIR)
+		set( _EPA_ADDITIONAL_ARGS "BUILD_IN_SOURCE 1" )
+	endif()
+
+	# Add log defiitions if selected to be enabled and append them to the
+	# additional args variable
+	if(zstd_LOG_BUILD)
+		set(_log_args 
+						"LOG_CONFIGURE 1"
+						"LOG_BUILD 1"
+						"LOG_INSTALL 1"
+			)
+	endif()
+
+	list(APPEND _EPA_ADDITIONAL_ARGS 
+						"${_log_args}"
+			)
+
+	# Call cmake configure and build on the CMakeLists.txt file
+	# written using the previously set template arguments
+	rcdev_config_build_ep(${_EPA_NAME})
+
+	# this policy is needed to supress a CMake warning about the new
+	# standard for using <project>_ROOT variable for find_package()
+	if( POLICY CMP0074 )
+		#message("Setting CMake policy CMP0074  rtsdk/${_EPA_NAME}:[ ${CMAKE_CURRENT_LIST_FILE}:${CMAKE_CURRENT_LIST_LINE} ] ")
+		cmake_policy(SET CMP0074 NEW)
+	endif()
+
+	if(NOT ZSTD_ROOT)
+		set(ZSTD_ROOT "${zstd_install}")
+	endif()
+
+	set(ZSTD_INCLUDE_DIR "${zstd_install}/include")
+
+	unset(_shared_arg)
+	unset(_config_options)
+	unset(_log_args)
+	unset(_dl_filename)
+
+	# This call will reset all the _EPA_... variables. Because this is a
+	# macro and if this is not called, the next external project using
+	# this template will be at risk being currupted with old values.
+	rcdev_reset_ep_add()
+
+endif()
+
+# Find the package, for either the system installed version or the one
+# just added with the external project template.  Since zstd does not have
+# a find_package CMake module, we need to define the target ourselves
+if ((NOT ZSTD_FOUND) OR
+	(NOT TARGET ZSTD::ZSTD) )
+	if (NOT ZSTD_INCLUDE_DIR)
+		if (EXISTS "${ZSTD_ROOT}/include/zstd.h")
+			set(ZSTD_INCLUDE_DIR "${ZSTD_ROOT}/include" CACHE PATH "")
+		endif()
+	endif()
+
+	set(ZSTD_INCLUDE_DIRS "${ZSTD_INCLUDE_DIR}")
+
+	if (NOT ZSTD_LIBRARIES)
+		find_library(ZSTD_LIBRARY_RELEASE NAMES zstd_static zstd NAMES_PER_DIR
+								 PATHS ${ZSTD_ROOT} NO_DEFAULT_PATH 
+								 PATH_SUFFIXES "lib${RCDEV_HOST_SYSTEM_BITS}" lib )
+		if (NOT (ZSTD_LIBRARY_RELEASE MATCHES "NOTFOUND"))
+			list(APPEND ZSTD_LIBRARIES Release "${ZSTD_LIBRARY_RELEASE}")
+			set(ZSTD_LIBRARY "${ZSTD_LIBRARY_RELEASE}" CACHE FILEPATH "")
+		else()
+			unset(ZSTD_LIBRARY_RELEASE CACHE)
+		endif()
+
+		find_library(ZSTD_LIBRARY_DEBUG NAMES zstd_staticd zstdd zstd NAMES_PER_DIR
+								 PATHS ${ZSTD_ROOT} NO_DEFAULT_PATH 
+								 PATH_SUFFIXES "lib${RCDEV_HOST_SYSTEM_BITS}" lib )
+
+		if (NOT (ZSTD_LIBRARY_DEBUG MATCHES "NOTFOUND"))
+				list(APPEND ZSTD_LIBRARIES Debug "${ZSTD_LIBRARY_DEBUG}")
+			if (NOT ZSTD_LIBRARY)
+				set(ZSTD_LIBRARY "${ZSTD_LIBRARY_DEBUG}" CACHE FILEPATH "")
+			endif()
+		else()
+			unset(ZSTD_LIBRARY_DEBUG CACHE)
+		endif()
+	endif()
+
+	if (NOT ZSTD_LIBRARY)
+		find_library(ZSTD_LIBRARY NAMES zstd_static zstd zstd_staticd zstdd NAMES_PER_DIR
+								 PATHS ${ZSTD_ROOT} NO_DEFAULT_PATH 
+								 PATH_SUFFIXES "lib${RCDEV_HOST_SYSTEM_BITS}" lib )
+	endif()
+
+	if ((NOT TARGET ZSTD::ZSTD) AND (DEFINED ZSTD_LIBRARY))
+
+		add_library(ZSTD::ZSTD UNKNOWN IMPORTED)
+		set_target_properties(ZSTD::ZSTD PROPERTIES
+										INTERFACE_INCLUDE_DIRECTORIES "${ZSTD_INCLUDE_DIRS}")
+
+		set_property(TARGET ZSTD::ZSTD APPEND PROPERTY IMPORTED_LOCATION "${ZSTD_LIBRARY}")
+		if (WIN32)
+			if (ZSTD_LIBRARY_RELEASE)
+				#set(APPEND ZSTD_LIBRARIES "Release" "${ZSTD_LIBRARY_RELEASE}")
+				set_property(TARGET ZSTD::ZSTD APPEND PROPERTY 
+											 IMPORTED_CONFIGURATIONS RELEASE)
+				set_target_properties(ZSTD::ZSTD PROPERTIES 
+												IMPORTED_LOCATION_RELEASE "${ZSTD_LIBRARY_RELEASE}")
+			endif()
+
+			if (ZSTD_LIBRARY_DEBUG)
+				set_property(TARGET ZSTD::ZSTD APPEND PROPERTY 
+											 IMPORTED_CONFIGURATIONS DEBUG)
+				set_target_properties(ZSTD::ZSTD PROPERTIES 
+												IMPORTED_LOCATION_DEBUG "${ZSTD_LIBRARY_DEBUG}")
+			endif()
+
+			if ((NOT ZSTD_LIBRARY_RELEASE) AND (NOT ZSTD_LIBRARY_DEBUG))
+				set_property(TARGET ZSTD::ZSTD APPEND PROPERTY 
+											IMPORTED_LOCATION "${ZSTD_LIBRARY}")
+			endif()
+
+			# Will Map Release => Release_MD, Debug => Debug_Mdd
+			rcdev_map_imported_ep_types(ZSTD::ZSTD)
+
+		endif()
+
+		set(ZSTD_FOUND true)
+
+	endif()
+
+	rcdev_add_external_target(ZSTD::ZSTD)
+
+endif()
+
+DEBUG_PRINT(ZSTD_ROOT)
+DEBUG_PRINT(ZSTD::ZSTD)
+DEBUG_PRINT(ZSTD_FOUND)
+DEBUG_PRINT(ZSTD_LIBRARY)
+DEBUG_PRINT(ZSTD_INCLUDE_DIRS)
+
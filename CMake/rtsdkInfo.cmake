@@ -62,7 +62,7 @@ string(TIMESTAMP rtsdk_year %Y)
 # However, other version may still work are the user can try newer versions
 # at their own risk.  
 # The CMAKE option to define for using an installed package :
-# (NOTE: not available for lz4)
+# (NOTE: not available for lz4 or zstd)
 #        '<package>_USE_SYSTEM_PACKAGE' (the <package>_version field will be
 #                                         used as an argument for find_package)
 #
@@ -73,6 +73,7 @@ string(TIMESTAMP rtsdk_year %Y)
 #       gtest (one exception to this rule, googletest)
 #       zlib
 #       lz4
+#       zstd
 #       libxml2
 #       cjson 
 #       curl 
@@ -111,6 +112,13 @@ string(TIMESTAMP rtsdk_year %Y)
 # set(lz4_hash "MD5=d5ce78f7b1b76002bbfffa6f78a5fc4e")
 # set(lz4_version "1.8.3")
 
+#
+# zstd see - default value, for latest, look in addExternal_zstd.cmake
+#[====================================================================]
+# set(zstd_url "https://github.com/facebook/zstd/archive/v1.5.2.tar.gz")
+# set(zstd_hash "")
+# set(zstd_version "1.5.2")
+
 #
 # libxml2 - default value, for latest, look in addExternal_libxml2.cmake
 #[====================================================================]
@@ -0,0 +1,136 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2022 Refinitiv. All rights reserved.              --
+ *|-----------------------------------------------------------------------------
+ */
+
+#include "TestUtilities.h"
+
+#include <math.h>
+
+using namespace refinitiv::ema::access;
+using namespace std;
+
+TEST(FieldColumnsTests, testFieldColumnsAddUpdateMsg)
+{
+	try
+	{
+		RsslDataDictionary dictionary;
+
+		ASSERT_TRUE(loadDictionaryFromFile(&dictionary)) << "Failed to load dictionary";
+
+		FieldColumns columns(2);
+		columns.addColumn(22, FieldColumns::DoubleEnum)
+			.addColumn(1, FieldColumns::Int64Enum)
+			.addColumn(16, FieldColumns::TimestampEnum);
+
+		EXPECT_EQ(columns.getColumnCount(), 3) << "Check the number of columns";
+		EXPECT_EQ(columns.getRowCapacity(), 2) << "Check the row capacity";
+
+		FieldList fieldList;
+		fieldList.addUInt(1, 64)
+			.addReal(22, 3990, OmmReal::ExponentNeg2Enum)
+			.addDate(16, 2022, 3, 15)
+			.complete();
+
+		UpdateMsg updateMsg;
+		updateMsg.payload(fieldList);
+
+		StaticDecoder::setData(&updateMsg, &dictionary);
+
+		columns.add(updateMsg);
+
+		FieldList otherFieldList;
+		otherFieldList.addReal(25, 3994, OmmReal::ExponentNeg2Enum).complete();
+
+		UpdateMsg otherUpdateMsg;
+		otherUpdateMsg.payload(otherFieldList);
+
+		StaticDecoder::setData(&otherUpdateMsg, &dictionary);
+
+		columns.add(otherUpdateMsg);
+
+		EXPECT_EQ(columns.getRowCount(), 2) << "Check the number of rows";
+		EXPECT_EQ(columns.getDoubleValues(0)[0], 39.90) << "Check the double value of the first row";
+		EXPECT_TRUE(isnan(columns.getDoubleValues(0)[1])) << "Check that a row without the field holds NaN";
+		EXPECT_TRUE(columns.hasValue(0, 0)) << "Check hasValue() for a row with the field";
+		EXPECT_FALSE(columns.hasValue(0, 1)) << "Check hasValue() for a row without the field";
+		EXPECT_EQ(columns.getValueCount(0), 1) << "Check the number of rows with a value";
+		EXPECT_EQ(columns.getInt64Values(1)[0], 64) << "Check the Int64 value of the first row";
+		EXPECT_EQ(columns.getInt64Values(2)[0], 19066LL * 86400 * 1000000000) << "Check the timestamp of the first row";
+
+		try
+		{
+			columns.add(updateMsg);
+			EXPECT_FALSE(true) << "FieldColumns::add() while full - exception expected";
+		}
+		catch (const OmmInvalidUsageException&)
+		{
+			EXPECT_TRUE(true) << "FieldColumns::add() while full - exception expected";
+		}
+
+		try
+		{
+			columns.getInt64Values(0);
+			EXPECT_FALSE(true) << "FieldColumns::getInt64Values() of a DoubleEnum column - exception expected";
+		}
+		catch (const OmmInvalidUsageException&)
+		{
+			EXPECT_TRUE(true) << "FieldColumns::getInt64Values() of a DoubleEnum column - exception expected";
+		}
+
+		columns.clear();
+
+		EXPECT_EQ(columns.getRowCount(), 0) << "Check that clear() removes the rows";
+
+		columns.add(otherUpdateMsg);
+
+		EXPECT_EQ(columns.getRowCount(), 1) << "Check a row added after clear()";
+		EXPECT_EQ(columns.getValueCount(0), 0) << "Check that clear() resets the number of rows with a value";
+	}
+	catch (const OmmException& exp)
+	{
+		EXPECT_FALSE(true) << "Fails to add messages to FieldColumns - exception not expected with text" << exp.getText().c_str();
+	}
+}
+
+TEST(FieldColumnsTests, testFieldColumnsIncompatibleColumn)
+{
+	RsslDataDictionary dictionary;
+
+	ASSERT_TRUE(loadDictionaryFromFile(&dictionary)) << "Failed to load dictionary";
+
+	FieldColumns columns(10);
+	columns.addColumn(3, FieldColumns::DoubleEnum);
+
+	FieldList fieldList;
+	fieldList.addAscii(3, "ABCDEF").complete();
+
+	UpdateMsg updateMsg;
+	updateMsg.payload(fieldList);
+
+	StaticDecoder::setData(&updateMsg, &dictionary);
+
+	try
+	{
+		columns.add(updateMsg);
+		EXPECT_FALSE(true) << "FieldColumns::add() with a DoubleEnum column of an Ascii field - exception expected";
+	}
+	catch (const OmmInvalidUsageException&)
+	{
+		EXPECT_TRUE(true) << "FieldColumns::add() with a DoubleEnum column of an Ascii field - exception expected";
+	}
+
+	try
+	{
+		UpdateMsg notReceived;
+		columns.add(notReceived);
+		EXPECT_FALSE(true) << "FieldColumns::add() of a Msg that was not received - exception expected";
+	}
+	catch (const OmmInvalidUsageException&)
+	{
+		EXPECT_TRUE(true) << "FieldColumns::add() of a Msg that was not received - exception expected";
+	}
+}
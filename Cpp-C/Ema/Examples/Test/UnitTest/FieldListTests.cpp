@@ -4336,4 +4336,159 @@ TEST(FieldListTests, testFieldListClear_Encode_Decode)
 	{
 		EXPECT_FALSE(true) << "Fails to encode and decode FieldList - exception not expected with text" << exp.getText().c_str();
 	}
-}
\ No newline at end of file
+}
+
+TEST(FieldListTests, testFieldListGetEntryByFieldId)
+{
+	try
+	{
+		RsslDataDictionary dictionary;
+
+		ASSERT_TRUE(loadDictionaryFromFile(&dictionary)) << "Failed to load dictionary";
+
+		FieldList fieldList;
+		fieldList.addUInt(1, 64)
+			.addReal(6, 11, OmmReal::ExponentNeg2Enum)
+			.addReal(22, 3990, OmmReal::ExponentNeg2Enum)
+			.addReal(25, 3994, OmmReal::ExponentNeg2Enum)
+			.addUInt(1, 65)
+			.complete();
+
+		StaticDecoder::setData(&fieldList, &dictionary);
+
+		EXPECT_TRUE(fieldList.getEntry(25).getFieldId() == 25) << "Check the field ID of the entry looked up out of order";
+		EXPECT_TRUE(fieldList.getEntry(25).getReal().getMantissa() == 3994) << "Check the value of the entry looked up out of order";
+		EXPECT_TRUE(fieldList.getEntry(6).getReal().getMantissa() == 11) << "Check the value of an earlier entry";
+		EXPECT_TRUE(fieldList.getEntry(1).getUInt() == 64) << "Check that the first of a repeated field ID is returned";
+		EXPECT_TRUE(fieldList.hasEntry(22)) << "Check hasEntry() for a present field ID";
+		EXPECT_FALSE(fieldList.hasEntry(3)) << "Check hasEntry() for an absent field ID";
+
+		try
+		{
+			fieldList.getEntry(3);
+			EXPECT_FALSE(true) << "FieldList::getEntry( fieldId ) for an absent field ID - exception expected";
+		}
+		catch (const OmmInvalidUsageException&)
+		{
+			EXPECT_TRUE(true) << "FieldList::getEntry( fieldId ) for an absent field ID - exception expected";
+		}
+
+		// Lookups do not move iteration.
+		EXPECT_TRUE(fieldList.forth()) << "Get the first Field entry";
+		EXPECT_TRUE(fieldList.getEntry().getFieldId() == 1) << "Check the field ID of the first entry";
+		EXPECT_TRUE(fieldList.getEntry(22).getReal().getMantissa() == 3990) << "Check a lookup during iteration";
+		EXPECT_TRUE(fieldList.forth()) << "Get the second Field entry";
+		EXPECT_TRUE(fieldList.getEntry().getFieldId() == 6) << "Check the field ID of the second entry";
+
+		// The index is rebuilt for new data.
+		FieldList otherFieldList;
+		otherFieldList.addReal(22, 4000, OmmReal::ExponentNeg2Enum).complete();
+
+		StaticDecoder::setData(&otherFieldList, &dictionary);
+
+		EXPECT_TRUE(otherFieldList.getEntry(22).getReal().getMantissa() == 4000) << "Check a lookup in another FieldList";
+		EXPECT_FALSE(otherFieldList.hasEntry(25)) << "Check that entries of the earlier FieldList are not found";
+	}
+	catch (const OmmException& exp)
+	{
+		EXPECT_FALSE(true) << "Fails to look up FieldList entries by field ID - exception not expected with text" << exp.getText().c_str();
+	}
+}
+
+TEST(FieldListTests, testFieldListEncodePlan)
+{
+	try
+	{
+		RsslDataDictionary dictionary;
+
+		ASSERT_TRUE(loadDictionaryFromFile(&dictionary)) << "Failed to load dictionary";
+
+		FieldListEncodePlan plan;
+		plan.info(1, 65)
+			.addField(22, DataType::RealEnum)
+			.addField(25, DataType::RealEnum)
+			.addField(1, DataType::UIntEnum)
+			.addField(16, DataType::DateEnum)
+			.addField(3, DataType::RmtesEnum);
+
+		EXPECT_EQ(5, plan.getFieldCount()) << "Check the number of fields of the plan";
+
+		FieldList fieldList;
+
+		// The plan is reused for each encoding.
+		for (Int64 bid = 3990; bid < 3993; ++bid)
+		{
+			fieldList.clear().encodePlan(plan)
+				.addReal(22, bid, OmmReal::ExponentNeg2Enum)
+				.addCodeReal(25)
+				.addUInt(1, 62)
+				.addDate(16, 2022, 3, 14)
+				.addRmtes(3, EmaBuffer("TRI.N", 5))
+				.complete();
+
+			StaticDecoder::setData(&fieldList, &dictionary);
+
+			EXPECT_TRUE(fieldList.hasInfo()) << "Check has info attribute";
+			EXPECT_TRUE(fieldList.getInfoDictionaryId() == 1) << "Check the info dictionary ID attribute";
+			EXPECT_TRUE(fieldList.getInfoFieldListNum() == 65) << "Check the info field list num attribute";
+
+			EXPECT_TRUE(fieldList.forth()) << "Get the first Field entry";
+			EXPECT_TRUE(fieldList.getEntry().getFieldId() == 22) << "Check the field ID of the first entry";
+			EXPECT_TRUE(fieldList.getEntry().getReal().getMantissa() == bid) << "Check the value of the first entry";
+			EXPECT_TRUE(fieldList.forth()) << "Get the second Field entry";
+			EXPECT_TRUE(fieldList.getEntry().getCode() == Data::BlankEnum) << "Check the blank second entry";
+			EXPECT_TRUE(fieldList.forth()) << "Get the third Field entry";
+			EXPECT_TRUE(fieldList.getEntry().getUInt() == 62) << "Check the value of the third entry";
+			EXPECT_TRUE(fieldList.forth()) << "Get the fourth Field entry";
+			EXPECT_TRUE(fieldList.getEntry().getDate().getYear() == 2022) << "Check the value of the fourth entry";
+			EXPECT_TRUE(fieldList.forth()) << "Get the fifth Field entry";
+			EXPECT_TRUE(fieldList.getEntry().getRmtes().getAsUTF8() == EmaBuffer("TRI.N", 5)) << "Check the value of the fifth entry";
+			EXPECT_FALSE(fieldList.forth()) << "Check to make sure that there is no more enty in FieldList";
+		}
+
+		// Entries must follow the plan.
+		try
+		{
+			fieldList.clear().encodePlan(plan).addReal(25, 1, OmmReal::ExponentNeg2Enum);
+			EXPECT_FALSE(true) << "FieldList with encode plan adding a field out of order - exception expected";
+		}
+		catch (const OmmInvalidUsageException&)
+		{
+			EXPECT_TRUE(true) << "FieldList with encode plan adding a field out of order - exception expected";
+		}
+
+		try
+		{
+			fieldList.clear().encodePlan(plan).addReal(22, 1, OmmReal::ExponentNeg2Enum).complete();
+			EXPECT_FALSE(true) << "FieldList with encode plan completed with missing fields - exception expected";
+		}
+		catch (const OmmInvalidUsageException&)
+		{
+			EXPECT_TRUE(true) << "FieldList with encode plan completed with missing fields - exception expected";
+		}
+
+		try
+		{
+			fieldList.clear().encodePlan(plan).info(1, 1);
+			EXPECT_FALSE(true) << "FieldList with encode plan setting info - exception expected";
+		}
+		catch (const OmmInvalidUsageException&)
+		{
+			EXPECT_TRUE(true) << "FieldList with encode plan setting info - exception expected";
+		}
+
+		try
+		{
+			plan.addField(2, DataType::QosEnum);
+			EXPECT_FALSE(true) << "FieldListEncodePlan adding an unsupported field - exception expected";
+		}
+		catch (const OmmInvalidUsageException&)
+		{
+			EXPECT_TRUE(true) << "FieldListEncodePlan adding an unsupported field - exception expected";
+		}
+	}
+	catch (const OmmException& exp)
+	{
+		EXPECT_FALSE(true) << "Fails to encode FieldList with an encode plan - exception not expected with text" << exp.getText().c_str();
+	}
+}
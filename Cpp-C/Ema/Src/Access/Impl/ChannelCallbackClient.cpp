@@ -454,6 +454,9 @@ void ChannelCallbackClient::channelParametersToString(ActiveConfig& activeConfig
 	case RSSL_COMP_LZ4 :
 		compType.set( "LZ4" );
 		break;
+	case RSSL_COMP_ZSTD :
+		compType.set( "ZStd" );
+		break;
 	case RSSL_COMP_NONE :
 		compType.set( "None" );
 		break;
@@ -86,6 +86,7 @@ const EmaString& ChannelInformation::toString() const {
 	switch ( _compressionType ) {
 	  case ZLIBEnum: _toString.append("ZLIB"); break;
 	  case LZ4Enum: _toString.append("LZ4"); break;
+	  case ZSTDEnum: _toString.append("ZSTD"); break;
 	  case NoneEnum:
 	  default:
 		  _toString.append("none"); break;
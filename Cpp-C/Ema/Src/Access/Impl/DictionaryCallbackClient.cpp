@@ -120,6 +120,40 @@ bool LocalDictionary::load( const EmaString& fldName, const EmaString& enumName,
 	buffer.data = errTxt;
 	buffer.length = 255;
 
+	/* A dictionary snapshot holds both the field and enumerated type definitions. */
+	if ( rsslIsDataDictionarySnapshot( fldName.c_str() ) )
+	{
+		if ( ( retCode = rsslLoadDataDictionarySnapshot( fldName.c_str(), &_rsslDictionary, &buffer ) ) < 0 )
+		{
+			_isLoaded = false;
+
+			rsslDeleteDataDictionary( &_rsslDictionary );
+
+			if (OmmLoggerClient::ErrorEnum >= _baseConfig.loggerConfig.minLoggerSeverity)
+			{
+				EmaString errorText, dir;
+				getCurrentDir( dir );
+				errorText.set( "Unable to load dictionary snapshot from file named " ).append( fldName ).append( CR )
+				.append( "Current working directory " ).append( dir ).append( CR )
+				.append( "Error text " ).append( errTxt );
+				_ommCommonImpl.getOmmLoggerClient().log(_clientName, OmmLoggerClient::ErrorEnum, errorText);
+			}
+			return false;
+		}
+
+		if (OmmLoggerClient::VerboseEnum >= _baseConfig.loggerConfig.minLoggerSeverity)
+		{
+			EmaString temp( "Successfully loaded local dictionaries: " );
+			temp.append( CR )
+			.append( "Dictionary snapshot file named " ).append( fldName );
+			_ommCommonImpl.getOmmLoggerClient().log(_clientName, OmmLoggerClient::VerboseEnum, temp);
+		}
+
+		_isLoaded = true;
+
+		return true;
+	}
+
 	if ( ( retCode = rsslLoadFieldDictionary( fldName.c_str(), &_rsslDictionary, &buffer ) ) < 0 )
 	{
 		_isLoaded = false;
@@ -687,6 +687,7 @@ ConfigElement* EmaConfigBaseImpl::convertEnum(const char* name, XMLnode* parent,
 			{ "None", RSSL_COMP_NONE },
 			{ "ZLib", RSSL_COMP_ZLIB },
 			{ "LZ4", RSSL_COMP_LZ4 },
+			{ "ZStd", RSSL_COMP_ZSTD },
 		};
 
 		for (int i = 0; i < sizeof converter / sizeof converter[0]; i++)
@@ -0,0 +1,86 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2022 Refinitiv. All rights reserved.              --
+ *|-----------------------------------------------------------------------------
+ */
+
+#include "FieldColumns.h"
+#include "FieldColumnsImpl.h"
+#include "ExceptionTranslator.h"
+
+#include <new>
+
+using namespace refinitiv::ema::access;
+
+FieldColumns::FieldColumns( UInt32 rowCapacity ) :
+ _pImpl( 0 )
+{
+	try
+	{
+		_pImpl = new FieldColumnsImpl( rowCapacity );
+	}
+	catch ( std::bad_alloc& )
+	{
+		throwMeeException( "Failed to allocate memory in FieldColumns::FieldColumns()." );
+	}
+}
+
+FieldColumns::~FieldColumns()
+{
+	delete _pImpl;
+}
+
+UInt32 FieldColumns::getRowCount() const
+{
+	return _pImpl->getRowCount();
+}
+
+UInt32 FieldColumns::getRowCapacity() const
+{
+	return _pImpl->getRowCapacity();
+}
+
+UInt32 FieldColumns::getColumnCount() const
+{
+	return _pImpl->getColumnCount();
+}
+
+const double* FieldColumns::getDoubleValues( UInt32 column ) const
+{
+	return _pImpl->getDoubleValues( column );
+}
+
+const Int64* FieldColumns::getInt64Values( UInt32 column ) const
+{
+	return _pImpl->getInt64Values( column );
+}
+
+bool FieldColumns::hasValue( UInt32 column, UInt32 row ) const
+{
+	return _pImpl->hasValue( column, row );
+}
+
+UInt32 FieldColumns::getValueCount( UInt32 column ) const
+{
+	return _pImpl->getValueCount( column );
+}
+
+FieldColumns& FieldColumns::addColumn( Int16 fieldId, ColumnType columnType )
+{
+	_pImpl->addColumn( fieldId, columnType );
+	return *this;
+}
+
+FieldColumns& FieldColumns::add( const Msg& msg )
+{
+	_pImpl->add( msg );
+	return *this;
+}
+
+FieldColumns& FieldColumns::clear()
+{
+	_pImpl->clear();
+	return *this;
+}
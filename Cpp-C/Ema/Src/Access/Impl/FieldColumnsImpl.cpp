@@ -0,0 +1,212 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2022 Refinitiv. All rights reserved.              --
+ *|-----------------------------------------------------------------------------
+ */
+
+#include "FieldColumnsImpl.h"
+#include "Msg.h"
+#include "MsgDecoder.h"
+#include "ExceptionTranslator.h"
+#include "OmmInvalidUsageException.h"
+
+#include <new>
+#include <string.h>
+
+using namespace refinitiv::ema::access;
+
+FieldColumnsImpl::FieldColumnsImpl( UInt32 rowCapacity ) :
+ _rsslColumnSet(),
+ _pRsslDictionary( 0 ),
+ _rsslMajVer( RSSL_RWF_MAJOR_VERSION ),
+ _rsslMinVer( RSSL_RWF_MINOR_VERSION )
+{
+	rsslClearFieldColumnSet( &_rsslColumnSet );
+	memset( _rsslColumns, 0, sizeof( _rsslColumns ) );
+
+	_rsslColumnSet.columns = _rsslColumns;
+	_rsslColumnSet.rowCapacity = rowCapacity;
+}
+
+FieldColumnsImpl::~FieldColumnsImpl()
+{
+	for ( UInt32 idx = 0; idx < _rsslColumnSet.columnCount; ++idx )
+	{
+		delete [] (UInt64*)_rsslColumns[idx].values;
+		delete [] _rsslColumns[idx].presence;
+	}
+}
+
+UInt32 FieldColumnsImpl::getRowCount() const
+{
+	return _rsslColumnSet.rowCount;
+}
+
+UInt32 FieldColumnsImpl::getRowCapacity() const
+{
+	return _rsslColumnSet.rowCapacity;
+}
+
+UInt32 FieldColumnsImpl::getColumnCount() const
+{
+	return _rsslColumnSet.columnCount;
+}
+
+const RsslFieldColumn& FieldColumnsImpl::getColumn( UInt32 column ) const
+{
+	if ( column >= _rsslColumnSet.columnCount )
+	{
+		EmaString temp( "Attempt to access column " );
+		temp.append( column ).append( " while there are " ).append( _rsslColumnSet.columnCount ).append( " columns." );
+
+		throwIueException( temp, OmmInvalidUsageException::InvalidArgumentEnum );
+	}
+
+	return _rsslColumns[column];
+}
+
+const double* FieldColumnsImpl::getDoubleValues( UInt32 column ) const
+{
+	const RsslFieldColumn& rsslColumn = getColumn( column );
+
+	if ( rsslColumn.columnType != RSSL_FCT_DOUBLE )
+	{
+		EmaString temp( "Attempt to getDoubleValues() of a column that is not a DoubleEnum column." );
+
+		throwIueException( temp, OmmInvalidUsageException::InvalidOperationEnum );
+	}
+
+	return (const double*)rsslColumn.values;
+}
+
+const Int64* FieldColumnsImpl::getInt64Values( UInt32 column ) const
+{
+	const RsslFieldColumn& rsslColumn = getColumn( column );
+
+	if ( rsslColumn.columnType == RSSL_FCT_DOUBLE )
+	{
+		EmaString temp( "Attempt to getInt64Values() of a DoubleEnum column." );
+
+		throwIueException( temp, OmmInvalidUsageException::InvalidOperationEnum );
+	}
+
+	return (const Int64*)rsslColumn.values;
+}
+
+bool FieldColumnsImpl::hasValue( UInt32 column, UInt32 row ) const
+{
+	const RsslFieldColumn& rsslColumn = getColumn( column );
+
+	if ( row >= _rsslColumnSet.rowCount )
+	{
+		EmaString temp( "Attempt to access row " );
+		temp.append( row ).append( " while there are " ).append( _rsslColumnSet.rowCount ).append( " rows." );
+
+		throwIueException( temp, OmmInvalidUsageException::InvalidArgumentEnum );
+	}
+
+	return ( rsslColumn.presence[row >> 3] & ( 1 << ( row & 7 ) ) ) ? true : false;
+}
+
+UInt32 FieldColumnsImpl::getValueCount( UInt32 column ) const
+{
+	return getColumn( column ).valueCount;
+}
+
+void FieldColumnsImpl::addColumn( Int16 fieldId, FieldColumns::ColumnType columnType )
+{
+	if ( _rsslColumnSet.rowCount )
+	{
+		EmaString temp( "Attempt to addColumn() while there are rows." );
+
+		throwIueException( temp, OmmInvalidUsageException::InvalidOperationEnum );
+	}
+
+	if ( _rsslColumnSet.columnCount == sizeof( _rsslColumns ) / sizeof( RsslFieldColumn ) )
+	{
+		EmaString temp( "Attempt to addColumn() while there are already 64 columns." );
+
+		throwIueException( temp, OmmInvalidUsageException::InvalidOperationEnum );
+	}
+
+	RsslFieldColumn& rsslColumn = _rsslColumns[_rsslColumnSet.columnCount];
+
+	try
+	{
+		/* Values are 8 bytes, whether double or Int64. */
+		rsslColumn.values = new UInt64[_rsslColumnSet.rowCapacity ? _rsslColumnSet.rowCapacity : 1];
+		rsslColumn.presence = new RsslUInt8[( _rsslColumnSet.rowCapacity + 7 ) / 8 + 1];
+	}
+	catch ( std::bad_alloc& )
+	{
+		delete [] (UInt64*)rsslColumn.values;
+		rsslColumn.values = 0;
+		throwMeeException( "Failed to allocate memory in FieldColumns::addColumn()." );
+		return;
+	}
+
+	rsslColumn.fieldId = fieldId;
+	rsslColumn.columnType = (RsslUInt8)columnType;
+	rsslColumn.valueCount = 0;
+	++_rsslColumnSet.columnCount;
+
+	/* The columns are prepared again with the dictionary of the next message. */
+	_pRsslDictionary = 0;
+}
+
+void FieldColumnsImpl::add( const Msg& msg )
+{
+	if ( !msg._pDecoder )
+	{
+		EmaString temp( "Attempt to add() a Msg that was not received." );
+
+		throwIueException( temp, OmmInvalidUsageException::InvalidArgumentEnum );
+	}
+
+	if ( _rsslColumnSet.rowCount == _rsslColumnSet.rowCapacity )
+	{
+		EmaString temp( "Attempt to add() a Msg while the columns are full. Row capacity='" );
+		temp.append( _rsslColumnSet.rowCapacity ).append( "'." );
+
+		throwIueException( temp, OmmInvalidUsageException::InvalidOperationEnum );
+	}
+
+	const RsslDataDictionary* pRsslDictionary = msg._pDecoder->getRsslDictionary();
+
+	if ( !pRsslDictionary )
+	{
+		EmaString temp( "Attempt to add() a Msg that was received without a dictionary." );
+
+		throwIueException( temp, OmmInvalidUsageException::InvalidArgumentEnum );
+	}
+
+	if ( pRsslDictionary != _pRsslDictionary || msg._pDecoder->getMajorVersion() != _rsslMajVer ||
+		msg._pDecoder->getMinorVersion() != _rsslMinVer )
+	{
+		_rsslColumnSet.majorVersion = msg._pDecoder->getMajorVersion();
+		_rsslColumnSet.minorVersion = msg._pDecoder->getMinorVersion();
+
+		if ( rsslInitFieldColumnSet( &_rsslColumnSet, pRsslDictionary ) != RSSL_RET_SUCCESS )
+		{
+			EmaString temp( "Attempt to add() a Msg while a column's field id is not in the dictionary, or its type does not fit the column." );
+
+			throwIueException( temp, OmmInvalidUsageException::InvalidArgumentEnum );
+		}
+
+		_pRsslDictionary = pRsslDictionary;
+		_rsslMajVer = _rsslColumnSet.majorVersion;
+		_rsslMinVer = _rsslColumnSet.minorVersion;
+	}
+
+	rsslExtractFieldColumns( &_rsslColumnSet, &msg._pDecoder->getRsslBuffer(), 1 );
+}
+
+void FieldColumnsImpl::clear()
+{
+	_rsslColumnSet.rowCount = 0;
+
+	for ( UInt32 idx = 0; idx < _rsslColumnSet.columnCount; ++idx )
+		_rsslColumns[idx].valueCount = 0;
+}
@@ -0,0 +1,70 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2022 Refinitiv. All rights reserved.              --
+ *|-----------------------------------------------------------------------------
+ */
+
+#ifndef __refinitiv_ema_access_FieldColumnsImpl_h
+#define __refinitiv_ema_access_FieldColumnsImpl_h
+
+#include "FieldColumns.h"
+#include "rtr/rsslFieldColumns.h"
+
+namespace refinitiv {
+
+namespace ema {
+
+namespace access {
+
+class FieldColumnsImpl
+{
+public :
+
+	FieldColumnsImpl( UInt32 );
+
+	virtual ~FieldColumnsImpl();
+
+	UInt32 getRowCount() const;
+
+	UInt32 getRowCapacity() const;
+
+	UInt32 getColumnCount() const;
+
+	const double* getDoubleValues( UInt32 ) const;
+
+	const Int64* getInt64Values( UInt32 ) const;
+
+	bool hasValue( UInt32, UInt32 ) const;
+
+	UInt32 getValueCount( UInt32 ) const;
+
+	void addColumn( Int16, FieldColumns::ColumnType );
+
+	void add( const Msg& );
+
+	void clear();
+
+private :
+
+	const RsslFieldColumn& getColumn( UInt32 ) const;
+
+	RsslFieldColumnSet			_rsslColumnSet;
+
+	RsslFieldColumn				_rsslColumns[64];
+
+	const RsslDataDictionary*	_pRsslDictionary;
+
+	UInt8						_rsslMajVer;
+
+	UInt8						_rsslMinVer;
+};
+
+}
+
+}
+
+}
+
+#endif // __refinitiv_ema_access_FieldColumnsImpl_h
@@ -10,6 +10,7 @@
 #include "ExceptionTranslator.h"
 #include "FieldListDecoder.h"
 #include "FieldListEncoder.h"
+#include "FieldListEncodePlanImpl.h"
 #include "Utilities.h"
 #include "GlobalPool.h"
 #include "OmmInvalidUsageException.h"
@@ -186,6 +187,24 @@ const FieldEntry& FieldList::getEntry() const
 	return _entry;
 }
 
+const FieldEntry& FieldList::getEntry( Int16 fieldId ) const
+{
+	if ( !_pDecoder || !_pDecoder->getEntryById( fieldId ) )
+	{
+		EmaString temp( "Attempt to getEntry( fieldId ) for a field id that is not present. Field id='" );
+		temp.append( fieldId ).append( "'." );
+
+		throwIueException( temp, OmmInvalidUsageException::InvalidArgumentEnum );
+	}
+
+	return _entry;
+}
+
+bool FieldList::hasEntry( Int16 fieldId ) const
+{
+	return _pDecoder ? _pDecoder->hasEntryById( fieldId ) : false;
+}
+
 const Encoder& FieldList::getEncoder() const
 {
 	if ( !_pEncoder )
@@ -204,6 +223,16 @@ FieldList& FieldList::info( Int16 dictionaryId, Int16 fieldListNum )
 	return *this;
 }
 
+FieldList& FieldList::encodePlan( const FieldListEncodePlan& plan )
+{
+	if ( !_pEncoder )
+		_pEncoder = g_pool._fieldListEncoderPool.getItem();
+
+	_pEncoder->encodePlan( *plan._pImpl );
+
+	return *this;
+}
+
 FieldList& FieldList::addInt( Int16 fieldId, Int64 value )
 {
 	if ( !_pEncoder )
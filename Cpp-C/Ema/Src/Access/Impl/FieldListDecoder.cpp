@@ -23,6 +23,8 @@ FieldListDecoder::FieldListDecoder() :
  _rsslFieldListBuffer(),
  _rsslFieldEntry(),
  _decodeIter(),
+ _indexDecodeIter(),
+ _rsslFieldListIndex(),
  _pLoadPool( 0 ),
  _pLoad( 0 ),
  _pRsslDictionary( 0 ),
@@ -34,7 +36,8 @@ FieldListDecoder::FieldListDecoder() :
  _rsslMinVer( RSSL_RWF_MINOR_VERSION ),
  _errorCode( OmmError::NoErrorEnum ),
  _decodingStarted( false ),
- _atEnd( false )
+ _atEnd( false ),
+ _indexBuilt( false )
 {
 	createLoadPool( _pLoadPool );
 
@@ -52,6 +55,8 @@ FieldListDecoder::~FieldListDecoder()
 {
 	destroyLoadPool( _pLoadPool );
 
+	delete [] _rsslFieldListIndex.slots;
+
 	if (_pDataDictionary)
 	{
 		delete _pDataDictionary;
@@ -97,6 +102,8 @@ void FieldListDecoder::clone( const FieldListDecoder& other )
 {
 	_decodingStarted = false;
 
+	_indexBuilt = false;
+
 	_rsslMajVer = other._rsslMajVer;
 
 	_rsslMinVer = other._rsslMinVer;
@@ -173,6 +180,8 @@ void FieldListDecoder::reset()
 {
 	_decodingStarted = false;
 
+	_indexBuilt = false;
+
 	if ( !_pRsslDictionary )
 	{
 		_atEnd = false;
@@ -241,6 +250,8 @@ bool FieldListDecoder::setRsslData( UInt8 majVer, UInt8 minVer, RsslBuffer* rssl
 {
 	_decodingStarted = false;
 
+	_indexBuilt = false;
+
 	_rsslMajVer = majVer;
 
 	_rsslMinVer = minVer;
@@ -396,6 +407,78 @@ bool FieldListDecoder::getNextData( Int16 fieldId )
 	}
 }
 
+bool FieldListDecoder::buildIndex()
+{
+	if ( _indexBuilt ) return true;
+
+	if ( !_pRsslDictionary ) return false;
+
+	RsslRet retCode = RSSL_RET_SUCCESS;
+
+	do
+	{
+		if ( !_rsslFieldListIndex.slots || retCode == RSSL_RET_BUFFER_TOO_SMALL )
+		{
+			UInt32 slotCount = _rsslFieldListIndex.slots ? _rsslFieldListIndex.slotCount * 2 : 512;
+
+			delete [] _rsslFieldListIndex.slots;
+			rsslClearFieldListIndex( &_rsslFieldListIndex );
+
+			try
+			{
+				_rsslFieldListIndex.slots = new RsslFieldListIndexSlot[slotCount];
+			}
+			catch ( std::bad_alloc& )
+			{
+				throwMeeException( "Failed to allocate memory in FieldListDecoder::buildIndex()." );
+				return false;
+			}
+
+			_rsslFieldListIndex.slotCount = slotCount;
+		}
+
+		rsslClearDecodeIterator( &_indexDecodeIter );
+
+		if ( rsslSetDecodeIteratorBuffer( &_indexDecodeIter, &_rsslFieldListBuffer ) != RSSL_RET_SUCCESS ||
+			rsslSetDecodeIteratorRWFVersion( &_indexDecodeIter, _rsslMajVer, _rsslMinVer ) != RSSL_RET_SUCCESS )
+			return false;
+
+		RsslFieldList rsslFieldList;
+		retCode = rsslDecodeFieldListIndexed( &_indexDecodeIter, &rsslFieldList, _rsslLocalFLSetDefDb, &_rsslFieldListIndex );
+	}
+	while ( retCode == RSSL_RET_BUFFER_TOO_SMALL );
+
+	/* Entries outside of an undefined set can still be looked up. */
+	_indexBuilt = ( retCode == RSSL_RET_SUCCESS || retCode == RSSL_RET_NO_DATA || retCode == RSSL_RET_SET_SKIPPED );
+
+	return _indexBuilt;
+}
+
+bool FieldListDecoder::hasEntryById( Int16 fieldId )
+{
+	RsslFieldEntry rsslFieldEntry;
+
+	return buildIndex() && rsslDecodeFieldEntryById( &_indexDecodeIter, &_rsslFieldListIndex, fieldId, &rsslFieldEntry ) == RSSL_RET_SUCCESS;
+}
+
+bool FieldListDecoder::getEntryById( Int16 fieldId )
+{
+	if ( !buildIndex() ||
+		rsslDecodeFieldEntryById( &_indexDecodeIter, &_rsslFieldListIndex, fieldId, &_rsslFieldEntry ) != RSSL_RET_SUCCESS )
+		return false;
+
+	_decodingStarted = true;
+
+	_rsslDictionaryEntry = _pRsslDictionary->entriesArray[_rsslFieldEntry.fieldId];
+
+	if ( !_rsslDictionaryEntry )
+		_pLoad = Decoder::setRsslData( _pLoadPool[DataType::ErrorEnum], OmmError::FieldIdNotFoundEnum, &_indexDecodeIter, &_rsslFieldEntry.encData );
+	else
+		_pLoad = Decoder::setRsslData( _pLoadPool, _rsslDictionaryEntry->rwfType, &_indexDecodeIter, &_rsslFieldEntry.encData, _pRsslDictionary, 0 );
+
+	return true;
+}
+
 bool FieldListDecoder::getNextData( const EmaString& name )
 {
 	RsslRet retCode = RSSL_RET_SUCCESS;
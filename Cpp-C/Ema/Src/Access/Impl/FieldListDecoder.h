@@ -46,6 +46,10 @@ public :
 
 	bool getNextData( const Data& );
 
+	bool getEntryById( Int16 );
+
+	bool hasEntryById( Int16 );
+
 	void reset();
 
 	const EmaString& getName();
@@ -92,6 +96,8 @@ private :
 
 	void decodeViewList( RsslBuffer* , RsslDataType& , EmaVector< Int16 >& , EmaVector< EmaString >& );
 
+	bool buildIndex();
+
 	RsslFieldList				_rsslFieldList;
 
 	mutable RsslBuffer			_rsslFieldListBuffer;
@@ -100,6 +106,10 @@ private :
 
 	RsslDecodeIterator			_decodeIter;
 
+	RsslDecodeIterator			_indexDecodeIter;
+
+	RsslFieldListIndex			_rsslFieldListIndex;
+
 	Data**						_pLoadPool;
 
 	Data*						_pLoad;
@@ -128,6 +138,8 @@ private :
 
 	bool						_atEnd;
 
+	bool						_indexBuilt;
+
 	refinitiv::ema::rdm::DataDictionary*				_pDataDictionary;
 };
 
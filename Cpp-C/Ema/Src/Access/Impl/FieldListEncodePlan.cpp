@@ -0,0 +1,56 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2022 Refinitiv. All rights reserved.              --
+ *|-----------------------------------------------------------------------------
+ */
+
+#include "FieldListEncodePlan.h"
+#include "FieldListEncodePlanImpl.h"
+#include "ExceptionTranslator.h"
+
+#include <new>
+
+using namespace refinitiv::ema::access;
+
+FieldListEncodePlan::FieldListEncodePlan() :
+ _pImpl( 0 )
+{
+	try
+	{
+		_pImpl = new FieldListEncodePlanImpl();
+	}
+	catch ( std::bad_alloc& )
+	{
+		throwMeeException( "Failed to allocate memory in FieldListEncodePlan::FieldListEncodePlan()." );
+	}
+}
+
+FieldListEncodePlan::~FieldListEncodePlan()
+{
+	delete _pImpl;
+}
+
+UInt32 FieldListEncodePlan::getFieldCount() const
+{
+	return _pImpl->getFieldCount();
+}
+
+FieldListEncodePlan& FieldListEncodePlan::clear()
+{
+	_pImpl->clear();
+	return *this;
+}
+
+FieldListEncodePlan& FieldListEncodePlan::info( Int16 dictionaryId, Int16 fieldListNum )
+{
+	_pImpl->info( dictionaryId, fieldListNum );
+	return *this;
+}
+
+FieldListEncodePlan& FieldListEncodePlan::addField( Int16 fieldId, DataType::DataTypeEnum dataType )
+{
+	_pImpl->addField( fieldId, dataType );
+	return *this;
+}
@@ -0,0 +1,158 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2022 Refinitiv. All rights reserved.              --
+ *|-----------------------------------------------------------------------------
+ */
+
+#include "FieldListEncodePlanImpl.h"
+#include "ExceptionTranslator.h"
+#include "OmmInvalidUsageException.h"
+
+#include <new>
+#include <string.h>
+
+using namespace refinitiv::ema::access;
+
+extern const EmaString& getDTypeAsString( DataType::DataTypeEnum dType );
+
+FieldListEncodePlanImpl::FieldListEncodePlanImpl() :
+ _rsslEncodePlan(),
+ _rsslFieldList(),
+ _rsslFields( 0 ),
+ _fieldCount( 0 ),
+ _fieldCapacity( 0 ),
+ _built( false )
+{
+	rsslClearEncodePlan( &_rsslEncodePlan );
+	rsslClearFieldList( &_rsslFieldList );
+}
+
+FieldListEncodePlanImpl::~FieldListEncodePlanImpl()
+{
+	rsslDeleteEncodePlan( &_rsslEncodePlan );
+
+	delete [] _rsslFields;
+}
+
+UInt32 FieldListEncodePlanImpl::getFieldCount() const
+{
+	return _fieldCount;
+}
+
+const RsslEncodePlanField& FieldListEncodePlanImpl::getField( UInt32 index ) const
+{
+	return _rsslFields[index];
+}
+
+void FieldListEncodePlanImpl::clear()
+{
+	rsslDeleteEncodePlan( &_rsslEncodePlan );
+	rsslClearFieldList( &_rsslFieldList );
+
+	_fieldCount = 0;
+	_built = false;
+}
+
+void FieldListEncodePlanImpl::info( Int16 dictionaryId, Int16 fieldListNum )
+{
+	_rsslFieldList.dictionaryId = dictionaryId;
+	_rsslFieldList.fieldListNum = fieldListNum;
+	rsslFieldListApplyHasInfo( &_rsslFieldList );
+
+	_built = false;
+}
+
+void FieldListEncodePlanImpl::addField( Int16 fieldId, DataType::DataTypeEnum dataType )
+{
+	switch ( dataType )
+	{
+	case DataType::IntEnum :
+	case DataType::UIntEnum :
+	case DataType::RealEnum :
+	case DataType::FloatEnum :
+	case DataType::DoubleEnum :
+	case DataType::DateEnum :
+	case DataType::TimeEnum :
+	case DataType::DateTimeEnum :
+	case DataType::EnumEnum :
+	case DataType::BufferEnum :
+	case DataType::AsciiEnum :
+	case DataType::Utf8Enum :
+	case DataType::RmtesEnum :
+		break;
+	default :
+		{
+			EmaString temp( "Attempt to addField() with unsupported data type='" );
+			temp.append( getDTypeAsString( dataType ) ).append( "'. " );
+			throwIueException( temp, OmmInvalidUsageException::InvalidArgumentEnum );
+			return;
+		}
+	}
+
+	if ( _fieldCount == 0xFFFF )
+	{
+		EmaString temp( "Attempt to addField() while the plan already has " );
+		temp.append( _fieldCount ).append( " fields." );
+		throwIueException( temp, OmmInvalidUsageException::InvalidOperationEnum );
+		return;
+	}
+
+	if ( _fieldCount == _fieldCapacity )
+	{
+		UInt32 newCapacity = _fieldCapacity ? _fieldCapacity * 2 : 16;
+		RsslEncodePlanField* pNewFields;
+
+		try
+		{
+			pNewFields = new RsslEncodePlanField[newCapacity];
+		}
+		catch ( std::bad_alloc& )
+		{
+			throwMeeException( "Failed to allocate memory in FieldListEncodePlan::addField()." );
+			return;
+		}
+
+		if ( _fieldCount )
+			memcpy( pNewFields, _rsslFields, _fieldCount * sizeof( RsslEncodePlanField ) );
+
+		delete [] _rsslFields;
+		_rsslFields = pNewFields;
+		_fieldCapacity = newCapacity;
+	}
+
+	_rsslFields[_fieldCount].fieldId = fieldId;
+	_rsslFields[_fieldCount].dataType = (RsslUInt8)dataType;
+	_rsslFields[_fieldCount].flags = RSSL_EPFF_NONE;
+	++_fieldCount;
+
+	_built = false;
+}
+
+const RsslEncodePlan& FieldListEncodePlanImpl::getRsslEncodePlan()
+{
+	if ( !_built )
+	{
+		rsslDeleteEncodePlan( &_rsslEncodePlan );
+
+		RsslRet retCode = rsslBuildEncodePlan( &_rsslEncodePlan, 0, &_rsslFieldList, _rsslFields, (RsslUInt16)_fieldCount );
+
+		if ( retCode == RSSL_RET_FAILURE )
+		{
+			throwMeeException( "Failed to allocate memory in FieldListEncodePlan while building the plan." );
+			return _rsslEncodePlan;
+		}
+		else if ( retCode < RSSL_RET_SUCCESS )
+		{
+			EmaString temp( "Failed to build FieldListEncodePlan. Reason='" );
+			temp.append( rsslRetCodeToString( retCode ) ).append( "'. " );
+			throwIueException( temp, retCode );
+			return _rsslEncodePlan;
+		}
+
+		_built = true;
+	}
+
+	return _rsslEncodePlan;
+}
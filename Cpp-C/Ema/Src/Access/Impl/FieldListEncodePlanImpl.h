@@ -0,0 +1,62 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2022 Refinitiv. All rights reserved.              --
+ *|-----------------------------------------------------------------------------
+ */
+
+#ifndef __refinitiv_ema_access_FieldListEncodePlanImpl_h
+#define __refinitiv_ema_access_FieldListEncodePlanImpl_h
+
+#include "FieldListEncodePlan.h"
+#include "rtr/rsslEncodePlan.h"
+
+namespace refinitiv {
+
+namespace ema {
+
+namespace access {
+
+class FieldListEncodePlanImpl
+{
+public :
+
+	FieldListEncodePlanImpl();
+
+	virtual ~FieldListEncodePlanImpl();
+
+	UInt32 getFieldCount() const;
+
+	const RsslEncodePlanField& getField( UInt32 ) const;
+
+	void clear();
+
+	void info( Int16, Int16 );
+
+	void addField( Int16, DataType::DataTypeEnum );
+
+	const RsslEncodePlan& getRsslEncodePlan();
+
+private :
+
+	RsslEncodePlan			_rsslEncodePlan;
+
+	RsslFieldList			_rsslFieldList;
+
+	RsslEncodePlanField*	_rsslFields;
+
+	UInt32					_fieldCount;
+
+	UInt32					_fieldCapacity;
+
+	bool					_built;
+};
+
+}
+
+}
+
+}
+
+#endif // __refinitiv_ema_access_FieldListEncodePlanImpl_h
@@ -7,6 +7,7 @@
  */
 
 #include "FieldListEncoder.h"
+#include "FieldListEncodePlanImpl.h"
 #include "ExceptionTranslator.h"
 #include "StaticDecoder.h"
 #include "OmmStateDecoder.h"
@@ -31,19 +32,31 @@
 #include "UpdateMsg.h"
 #include "OmmInvalidUsageException.h"
 
+#include <new>
+
 using namespace refinitiv::ema::access;
 
 extern const EmaString& getMTypeAsString( OmmReal::MagnitudeType mType );
+extern const EmaString& getDTypeAsString( DataType::DataTypeEnum dType );
 
 FieldListEncoder::FieldListEncoder() :
  _rsslFieldList(),
  _rsslFieldEntry(),
- _containerInitialized( false )
+ _containerInitialized( false ),
+ _pEncodePlan( 0 ),
+ _pRsslEncodePlan( 0 ),
+ _planValues( 0 ),
+ _planValuePtrs( 0 ),
+ _planValueCapacity( 0 ),
+ _planEntryCount( 0 ),
+ _planBufferData()
 {
 }
 
 FieldListEncoder::~FieldListEncoder()
 {
+	delete [] _planValues;
+	delete [] _planValuePtrs;
 }
 
 void FieldListEncoder::clear()
@@ -54,11 +67,21 @@ void FieldListEncoder::clear()
 	rsslClearFieldEntry( &_rsslFieldEntry );
 
 	_containerInitialized = false;
+
+	_pEncodePlan = 0;
+	_pRsslEncodePlan = 0;
+	_planEntryCount = 0;
+	_planBufferData.clear();
 }
 
 void FieldListEncoder::info( Int16 dictionaryId, Int16 fieldListNum )
 {
-	if (!_containerInitialized)
+	if ( _pEncodePlan )
+	{
+		EmaString temp( "Invalid attempt to call info() when an encode plan is used. The Info is specified on the plan." );
+		throwIueException( temp, OmmInvalidUsageException::InvalidOperationEnum );
+	}
+	else if (!_containerInitialized)
 	{
 		_rsslFieldList.dictionaryId = dictionaryId;
 		_rsslFieldList.fieldListNum = fieldListNum;
@@ -71,8 +94,63 @@ void FieldListEncoder::info( Int16 dictionaryId, Int16 fieldListNum )
 	}
 }
 
+void FieldListEncoder::encodePlan( FieldListEncodePlanImpl& plan )
+{
+	if ( _containerInitialized || rsslFieldListCheckHasInfo( &_rsslFieldList ) || _pEncodePlan )
+	{
+		EmaString temp( "Invalid attempt to call encodePlan() when container is initialized." );
+		throwIueException( temp, OmmInvalidUsageException::InvalidOperationEnum );
+		return;
+	}
+
+	if ( _pEncodeIter && !ownsIterator() )
+	{
+		EmaString temp( "Invalid attempt to call encodePlan() on a FieldList that is being encoded into another container." );
+		throwIueException( temp, OmmInvalidUsageException::InvalidOperationEnum );
+		return;
+	}
+
+	_pRsslEncodePlan = &plan.getRsslEncodePlan();
+
+	if ( _planValueCapacity < plan.getFieldCount() )
+	{
+		delete [] _planValues;
+		delete [] _planValuePtrs;
+		_planValues = 0;
+		_planValuePtrs = 0;
+		_planValueCapacity = 0;
+
+		try
+		{
+			_planValues = new PlanValue[plan.getFieldCount()];
+			_planValuePtrs = new const void*[plan.getFieldCount()];
+		}
+		catch ( std::bad_alloc& )
+		{
+			delete [] _planValues;
+			_planValues = 0;
+			_pRsslEncodePlan = 0;
+			throwMeeException( "Failed to allocate memory in FieldListEncoder::encodePlan()." );
+			return;
+		}
+
+		_planValueCapacity = plan.getFieldCount();
+	}
+
+	_pEncodePlan = &plan;
+	_planEntryCount = 0;
+	_planBufferData.clear();
+}
+
 void FieldListEncoder::initEncode()
 {
+	if ( _pEncodePlan )
+	{
+		/* The plan writes the FieldList header with the entries when complete() is called. */
+		_containerInitialized = true;
+		return;
+	}
+
 	RsslRet retCode = rsslEncodeFieldListInit( &(_pEncodeIter->_rsslEncIter), &_rsslFieldList, 0, 0 );
 
 	while ( retCode == RSSL_RET_BUFFER_TOO_SMALL )
@@ -104,6 +182,12 @@ void FieldListEncoder::addPrimitiveEntry( Int16 fieldId, RsslDataType rsslDataTy
 		return;
 	}
 
+	if ( _pEncodePlan )
+	{
+		addPlanValue( fieldId, rsslDataType, methodName, value );
+		return;
+	}
+
 	_rsslFieldEntry.encData.data = 0;
 	_rsslFieldEntry.encData.length = 0;
 
@@ -137,6 +221,14 @@ void FieldListEncoder::addEncodedEntry( Int16 fieldId, RsslDataType rsslDataType
 		return;
 	}
 
+	if ( _pEncodePlan )
+	{
+		EmaString temp( "Attempt to " );
+		temp.append( methodName ).append( " while encoding FieldList with an encode plan." );
+		throwIueException( temp, OmmInvalidUsageException::InvalidOperationEnum );
+		return;
+	}
+
 	_rsslFieldEntry.encData = rsslBuffer;
 
 	_rsslFieldEntry.dataType = rsslDataType;
@@ -169,6 +261,14 @@ void FieldListEncoder::startEncodingEntry( Int16 fieldId, RsslDataType rsslDataT
 		return;
 	}
 
+	if ( _pEncodePlan )
+	{
+		EmaString temp( "Attempt to " );
+		temp.append( methodName ).append( " while encoding FieldList with an encode plan." );
+		throwIueException( temp, OmmInvalidUsageException::InvalidOperationEnum );
+		return;
+	}
+
 	_rsslFieldEntry.encData.data = 0;
 	_rsslFieldEntry.encData.length = 0;
 
@@ -193,6 +293,147 @@ void FieldListEncoder::startEncodingEntry( Int16 fieldId, RsslDataType rsslDataT
 	}
 }
 
+void FieldListEncoder::addPlanValue( Int16 fieldId, RsslDataType rsslDataType, const char* methodName, const void* value )
+{
+	if ( _planEntryCount == _pRsslEncodePlan->fieldCount )
+	{
+		EmaString temp( "Attempt to " );
+		temp.append( methodName ).append( " after all " ).append( (UInt32)_pRsslEncodePlan->fieldCount )
+			.append( " fields of the encode plan were added." );
+		throwIueException( temp, OmmInvalidUsageException::InvalidOperationEnum );
+		return;
+	}
+
+	const RsslEncodePlanField& planField = _pEncodePlan->getField( _planEntryCount );
+
+	if ( planField.fieldId != fieldId || planField.dataType != rsslDataType )
+	{
+		EmaString temp( "Attempt to " );
+		temp.append( methodName ).append( " with fieldId='" ).append( (Int32)fieldId )
+			.append( "' while the encode plan expects fieldId='" ).append( (Int32)planField.fieldId )
+			.append( "' of type '" ).append( getDTypeAsString( (DataType::DataTypeEnum)planField.dataType ) ).append( "'. " );
+		throwIueException( temp, OmmInvalidUsageException::InvalidArgumentEnum );
+		return;
+	}
+
+	PlanValue& planValue = _planValues[_planEntryCount];
+
+	if ( !value )
+	{
+		_planValuePtrs[_planEntryCount++] = 0;
+		return;
+	}
+
+	switch ( rsslDataType )
+	{
+	case RSSL_DT_INT :
+		planValue.intValue = *(const RsslInt64*)value;
+		break;
+	case RSSL_DT_UINT :
+		planValue.uintValue = *(const RsslUInt64*)value;
+		break;
+	case RSSL_DT_REAL :
+		planValue.realValue = *(const RsslReal*)value;
+		break;
+	case RSSL_DT_FLOAT :
+		planValue.floatValue = *(const RsslFloat*)value;
+		break;
+	case RSSL_DT_DOUBLE :
+		planValue.doubleValue = *(const RsslDouble*)value;
+		break;
+	case RSSL_DT_ENUM :
+		planValue.enumValue = *(const RsslEnum*)value;
+		break;
+	case RSSL_DT_DATE :
+		planValue.dateValue = *(const RsslDate*)value;
+		break;
+	case RSSL_DT_TIME :
+		planValue.timeValue = *(const RsslTime*)value;
+		break;
+	case RSSL_DT_DATETIME :
+		planValue.dateTimeValue = *(const RsslDateTime*)value;
+		break;
+	default :
+		/* The content is copied, since the application's buffer may not outlive the call. It is
+		   located when the FieldList is completed, as appending may move the copies. */
+		planValue.bufferValue.length = ((const RsslBuffer*)value)->length;
+		planValue.bufferValue.data = 0;
+		_planBufferData.append( ((const RsslBuffer*)value)->data, ((const RsslBuffer*)value)->length );
+		break;
+	}
+
+	_planValuePtrs[_planEntryCount++] = &planValue;
+}
+
+void FieldListEncoder::completeWithPlan()
+{
+	if ( _planEntryCount != _pRsslEncodePlan->fieldCount )
+	{
+		EmaString temp( "Attempt to complete() after adding " );
+		temp.append( _planEntryCount ).append( " of the " ).append( (UInt32)_pRsslEncodePlan->fieldCount )
+			.append( " fields of the encode plan." );
+		throwIueException( temp, OmmInvalidUsageException::InvalidOperationEnum );
+		return;
+	}
+
+	acquireEncIterator();
+
+	if ( !ownsIterator() )
+	{
+		EmaString temp( "Attempt to complete() a FieldList with an encode plan while it is being encoded into another container." );
+		throwIueException( temp, OmmInvalidUsageException::InvalidOperationEnum );
+		return;
+	}
+
+	const char* pBufferData = _planBufferData.c_buf();
+
+	for ( UInt32 idx = 0; idx < _planEntryCount; ++idx )
+	{
+		switch ( _pEncodePlan->getField( idx ).dataType )
+		{
+		case RSSL_DT_BUFFER :
+		case RSSL_DT_ASCII_STRING :
+		case RSSL_DT_UTF8_STRING :
+		case RSSL_DT_RMTES_STRING :
+			if ( _planValuePtrs[idx] )
+			{
+				_planValues[idx].bufferValue.data = (char*)pBufferData;
+				pBufferData += _planValues[idx].bufferValue.length;
+			}
+			break;
+		default :
+			break;
+		}
+	}
+
+	RsslBuffer rsslBuffer;
+	rsslBuffer.data = getRsslBuffer().data;
+	rsslBuffer.length = _pEncodeIter->_allocatedSize;
+
+	RsslRet retCode = rsslEncodeWithPlan( _pRsslEncodePlan, &rsslBuffer, 0, _planValuePtrs );
+	while ( retCode == RSSL_RET_BUFFER_TOO_SMALL )
+	{
+		_pEncodeIter->reallocate( _pEncodeIter->_allocatedSize << 1 );
+
+		rsslBuffer.data = getRsslBuffer().data;
+		rsslBuffer.length = _pEncodeIter->_allocatedSize;
+
+		retCode = rsslEncodeWithPlan( _pRsslEncodePlan, &rsslBuffer, 0, _planValuePtrs );
+	}
+
+	if ( retCode < RSSL_RET_SUCCESS )
+	{
+		EmaString temp( "Failed to complete FieldList encoding with the encode plan. Reason='" );
+		temp.append( rsslRetCodeToString( retCode ) ).append( "'. " );
+		throwIueException( temp, retCode );
+		return;
+	}
+
+	_pEncodeIter->setEncodedLength( rsslBuffer.length );
+
+	_containerComplete = true;
+}
+
 void FieldListEncoder::endEncodingEntry() const
 {
 	RsslRet retCode = rsslEncodeFieldEntryComplete( &_pEncodeIter->_rsslEncIter, RSSL_TRUE );
@@ -1274,6 +1515,12 @@ void FieldListEncoder::complete()
 {
 	if ( _containerComplete ) return;
 
+	if ( _pEncodePlan )
+	{
+		completeWithPlan();
+		return;
+	}
+
 	if ( rsslFieldListCheckHasStandardData( &_rsslFieldList ) == RSSL_FALSE )
 	{
 		acquireEncIterator();
@@ -13,7 +13,9 @@
 #include "OmmReal.h"
 #include "EmaPool.h"
 #include "OmmState.h"
+#include "EmaBuffer.h"
 #include "rtr/rsslFieldList.h"
+#include "rtr/rsslEncodePlan.h"
 
 namespace refinitiv {
 
@@ -38,6 +40,7 @@ class UpdateMsg;
 class OmmAnsiPage;
 class OmmOpaque;
 class OmmXml;
+class FieldListEncodePlanImpl;
 
 class FieldListEncoder : public Encoder
 {
@@ -51,6 +54,8 @@ public :
 
 	void info( Int16 dictionaryId, Int16 fieldListNum );
 
+	void encodePlan( FieldListEncodePlanImpl& plan );
+
 	void addReqMsg( Int16 fieldId, const ReqMsg& value );
 
 	void addRefreshMsg( Int16 fieldId, const RefreshMsg& value );
@@ -165,11 +170,43 @@ private :
 
 	void endEncodingEntry() const;
 
+	void addPlanValue( Int16 , RsslDataType , const char* , const void* );
+
+	void completeWithPlan();
+
+	union PlanValue
+	{
+		RsslInt64		intValue;
+		RsslUInt64		uintValue;
+		RsslReal		realValue;
+		RsslFloat		floatValue;
+		RsslDouble		doubleValue;
+		RsslEnum		enumValue;
+		RsslDate		dateValue;
+		RsslTime		timeValue;
+		RsslDateTime	dateTimeValue;
+		RsslBuffer		bufferValue;
+	};
+
 	RsslFieldList			_rsslFieldList;
 
 	RsslFieldEntry			_rsslFieldEntry;
 
 	bool					_containerInitialized;
+
+	FieldListEncodePlanImpl*	_pEncodePlan;
+
+	const RsslEncodePlan*	_pRsslEncodePlan;
+
+	PlanValue*				_planValues;
+
+	const void**			_planValuePtrs;
+
+	UInt32					_planValueCapacity;
+
+	UInt32					_planEntryCount;
+
+	EmaBuffer				_planBufferData;
 };
 
 
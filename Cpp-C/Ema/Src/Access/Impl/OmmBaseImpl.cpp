@@ -2027,7 +2027,7 @@ bool OmmBaseImpl::hasErrorClientHandler() const
 	return _pErrorClientHandler != 0 ? true : false;
 }
 
-EmaList< TimeOut* >& OmmBaseImpl::getTimeOutList()
+TimeOutWheel& OmmBaseImpl::getTimeOutWheel()
 {
 	return _theTimeOuts;
 }
@@ -2257,7 +2257,7 @@ Int64 OmmBaseImpl::rsslReactorDispatchLoop( Int64 timeOut, UInt32 count, bool& b
 		Int64 selectRetCode = 1;
 
 		// Do not wait infinitely in the select if there is a timeout event in the list.
-		if ( ( timeOut < 0 ) && getTimeOutList().size() != 0 )
+		if ( ( timeOut < 0 ) && getTimeOutWheel().size() != 0 )
 		{
 			return bMsgDispRcvd ? 0 : -1;
 		}
@@ -144,7 +144,7 @@ public :
 
 	bool hasErrorClientHandler() const;
 
-	EmaList< TimeOut* >& getTimeOutList();
+	TimeOutWheel& getTimeOutWheel();
 
 	Mutex& getTimeOutMutex();
 
@@ -289,7 +289,7 @@ protected:
 	bool						_hasProvAdminClient;
 	bool						_hasConsOAuthClient;
 	ErrorClientHandler*			_pErrorClientHandler;
-	EmaList< TimeOut* >			_theTimeOuts;
+	TimeOutWheel				_theTimeOuts;
 	bool						_bApiDispatchThreadStarted;
 	bool						_bUninitializeInvoked;
     bool _hasExternalLogger;
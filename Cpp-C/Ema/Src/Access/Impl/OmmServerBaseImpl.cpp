@@ -1006,7 +1006,7 @@ bool OmmServerBaseImpl::hasErrorClientHandler() const
 	return _pErrorClientHandler != 0 ? true : false;
 }
 
-EmaList< TimeOut* >& OmmServerBaseImpl::getTimeOutList()
+TimeOutWheel& OmmServerBaseImpl::getTimeOutWheel()
 {
 	return _theTimeOuts;
 }
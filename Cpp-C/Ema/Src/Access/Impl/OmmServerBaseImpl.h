@@ -117,7 +117,7 @@ public:
 
 	bool hasErrorClientHandler() const;
 
-	EmaList< TimeOut* >& getTimeOutList();
+	TimeOutWheel& getTimeOutWheel();
 
 	Mutex& getTimeOutMutex();
 
@@ -249,7 +249,7 @@ protected:
 	bool						_bMsgDispatched;
 	bool						_bEventReceived;
 	ErrorClientHandler*			_pErrorClientHandler;
-	EmaList< TimeOut* >			_theTimeOuts;
+	TimeOutWheel				_theTimeOuts;
 	OmmProviderClient*			_pOmmProviderClient;
 	OmmProviderEvent			ommProviderEvent;
 	void*						_pClosure;
@@ -1966,7 +1966,7 @@ void ProgrammaticConfigure::retrieveChannelInfo( const MapEntry& mapEntry, const
 			{
 				compressionType = channelEntry.getEnum();
 
-				if ( compressionType > RSSL_COMP_LZ4)
+				if ( compressionType > RSSL_COMP_ZSTD || compressionType == (RSSL_COMP_ZLIB | RSSL_COMP_LZ4) )
 				{
 					EmaString text( "Invalid CompressionType [" );
 					text.append( compressionType );
@@ -2780,7 +2780,7 @@ void ProgrammaticConfigure::retrieveServerInfo(const MapEntry& mapEntry, const E
 			{
 				compressionType = serverEntry.getEnum();
 
-				if (compressionType > RSSL_COMP_LZ4)
+				if (compressionType > RSSL_COMP_ZSTD || compressionType == (RSSL_COMP_ZLIB | RSSL_COMP_LZ4))
 				{
 					EmaString text("Invalid CompressionType [");
 					text.append(compressionType);
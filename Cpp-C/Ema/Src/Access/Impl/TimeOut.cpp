@@ -20,34 +20,24 @@ TimeOut::TimeOut( TimeOutClient& timeOutClient, Int64 lengthInMicroSeconds, void
 	_functor( functor ),
 	_lengthInMicroSeconds( lengthInMicroSeconds ),
 	_args( args ),
-	_timeoutTime(),
+	_timer(),
 	_canceled( false ),
 	_allocatedOnHeap( allocatedOnHeap ),
 	_timeOutClient(timeOutClient)
 {
+	TimeOutWheel& theTimeOuts( timeOutClient.getTimeOutWheel() );
+
+	rsslTimerWheelTimerInit( &_timer, this );
+
 	if ( lengthInMicroSeconds == 0 )
 	{
-		timeOutClient.getTimeOutList().insert(this);
+		// expires at once, so that the next execute() or getTimeOutInMicroSeconds() removes it
+		rsslTimerWheelAdd( &theTimeOuts, &_timer, theTimeOuts.currentTime );
 		_canceled = true;
 		return;
 	}
 
-	TimeOutTimeType setAt;
-
-#ifdef WIN32
-	if ( !frequency.QuadPart )
-		QueryPerformanceFrequency( &frequency );
-
-	QueryPerformanceCounter( &setAt );
-	_timeoutTime.QuadPart = setAt.QuadPart + ( frequency.QuadPart * lengthInMicroSeconds ) / 1000000;
-#else
-	struct timespec ts;
-	clock_gettime( CLOCK_REALTIME, &ts );
-	setAt = ts.tv_sec * static_cast<int>( 1E9 ) + ts.tv_nsec;
-	_timeoutTime = setAt + lengthInMicroSeconds * 1000;
-#endif				
-
-	_timeOutClient.getTimeOutList().insert(this);
+	rsslTimerWheelAdd( &theTimeOuts, &_timer, getCurrentTimeInMicroSeconds() + lengthInMicroSeconds );
 
 	_timeOutClient.installTimeOut();
 }
@@ -56,12 +46,19 @@ TimeOut::~TimeOut()
 {
 }
 
-bool TimeOut::operator<( const TimeOut& rhs ) const
+Int64 TimeOut::getCurrentTimeInMicroSeconds()
 {
 #ifdef WIN32
-	return _timeoutTime.QuadPart < rhs._timeoutTime.QuadPart;
+	if ( !frequency.QuadPart )
+		QueryPerformanceFrequency( &frequency );
+
+	LARGE_INTEGER current;
+	QueryPerformanceCounter( &current );
+	return ( current.QuadPart / frequency.QuadPart ) * 1000000 + ( current.QuadPart % frequency.QuadPart ) * 1000000 / frequency.QuadPart;
 #else
-	return _timeoutTime < rhs._timeoutTime;
+	struct timespec ts;
+	clock_gettime( CLOCK_REALTIME, &ts );
+	return static_cast<Int64>( ts.tv_sec ) * 1000000 + ts.tv_nsec / 1000;
 #endif
 }
 
@@ -69,48 +66,25 @@ bool TimeOut::getTimeOutInMicroSeconds(TimeOutClient& timeOutClient, Int64& valu
 {
 	MutexLocker ml(timeOutClient.getTimeOutMutex());
 
-	EmaList< TimeOut* >& _theTimeOuts(timeOutClient.getTimeOutList());
-
-	if ( _theTimeOuts.empty() )
-		return false;
+	TimeOutWheel& theTimeOuts(timeOutClient.getTimeOutWheel());
+	RsslTimerWheelTimer* pTimer;
 
-	TimeOut* p( _theTimeOuts.front() );
-	while ( true )
+	// only zero-length timeouts are already expired here; they are canceled and can be removed
+	while ( ( pTimer = rsslTimerWheelPopExpired( &theTimeOuts ) ) )
 	{
-		if ( !p )
-			return false;
-
-		if ( p->_canceled )
-		{
-			TimeOut * toBeDeleted( p );
-			p = p->next();
-			_theTimeOuts.remove( toBeDeleted );
-			if ( toBeDeleted->_allocatedOnHeap )
-				delete toBeDeleted;
-		}
-		else if ( !p->_lengthInMicroSeconds )
-			p = p->next();
-		else
-			break;
+		TimeOut* toBeDeleted( static_cast<TimeOut*>( pTimer->pUserSpec ) );
+		if ( toBeDeleted->_allocatedOnHeap )
+			delete toBeDeleted;
 	}
 
-	TimeOutTimeType current;
+	Int64 nextExpireTime( rsslTimerWheelNextExpireTime( &theTimeOuts ) );
 
-#ifdef WIN32
-	QueryPerformanceCounter( &current );
-	if ( p->_timeoutTime.QuadPart < current.QuadPart )
-		value = 0;
-	else
-		value = static_cast<Int64> ( ( p->_timeoutTime.QuadPart - current.QuadPart ) * 1000000 / frequency.QuadPart );
-#else
-	struct timespec ts;
-	clock_gettime( CLOCK_REALTIME, &ts );
-	current = ts.tv_sec * static_cast<int>( 1E9 ) + ts.tv_nsec;
-	if ( p->_timeoutTime < current )
-		value = 0;
-	else
-		value = static_cast<Int64> ( ( p->_timeoutTime - current ) / 1000 );
-#endif
+	if ( nextExpireTime == RSSL_TIMER_WHEEL_UNSET )
+		return false;
+
+	// may be earlier than the first timeout, in which case execute() only moves the wheel on
+	Int64 current( getCurrentTimeInMicroSeconds() );
+	value = nextExpireTime < current ? 0 : nextExpireTime - current;
 	return true;
 }
 
@@ -120,9 +94,7 @@ void TimeOut::cancel()
 
 	_canceled = true;
 
-	EmaList< TimeOut* > & _theTimeOuts(_timeOutClient.getTimeOutList());
-
-	_theTimeOuts.remove( this );
+	rsslTimerWheelCancel( &_timeOutClient.getTimeOutWheel(), &_timer );
 
 	if ( _allocatedOnHeap ) delete this;
 }
@@ -136,37 +108,26 @@ void TimeOut::execute( TimeOutClient& timeOutClient )
 {
 	MutexLocker ml(timeOutClient.getTimeOutMutex());
 
-	TimeOutTimeType current;
-#ifdef WIN32
-	QueryPerformanceCounter( &current );
-#else
-	struct timespec ts;
-	clock_gettime( CLOCK_REALTIME, &ts );
-	current = ts.tv_sec * static_cast<int>( 1E9 ) + ts.tv_nsec;
-#endif
+	TimeOutWheel& theTimeOuts(timeOutClient.getTimeOutWheel());
+	RsslTimerWheelTimer* pTimer;
 
-	TimeOut * p(timeOutClient.getTimeOutList().front());
-	while ( p )
+	rsslTimerWheelAdvance( &theTimeOuts, getCurrentTimeInMicroSeconds() );
+
+	while ( ( pTimer = rsslTimerWheelPopExpired( &theTimeOuts ) ) )
 	{
-#ifdef WIN32
-		if ( current.QuadPart >= p->_timeoutTime.QuadPart )
-#else
-		if ( current >= p->_timeoutTime )
-#endif
-		{
-			if ( !p->_canceled )
-				( *p )( );
-			if ( p->_allocatedOnHeap )
-				delete timeOutClient.getTimeOutList().pop_front();
-			else
-				timeOutClient.getTimeOutList().pop_front();
-			p = timeOutClient.getTimeOutList().front();
-		}
-		else
-			return;
+		TimeOut* p( static_cast<TimeOut*>( pTimer->pUserSpec ) );
+		if ( !p->_canceled )
+			( *p )( );
+		if ( p->_allocatedOnHeap )
+			delete p;
 	}
 }
 
+TimeOutWheel::TimeOutWheel()
+{
+	rsslTimerWheelInit( this, TimeOut::getCurrentTimeInMicroSeconds() );
+}
+
 TimeOutClient::TimeOutClient()
 {
 
@@ -15,8 +15,8 @@
 #include <time.h>
 #endif
 
-#include "EmaList.h"
 #include "Mutex.h"
+#include "rtr/rsslTimerWheel.h"
 
 namespace refinitiv {
 
@@ -32,7 +32,7 @@ namespace access {
 
 class TimeOutClient;
 
-class TimeOut : public ListLinks< TimeOut >
+class TimeOut
 {
 public:
 
@@ -40,12 +40,12 @@ public:
 
 	static void execute(TimeOutClient&);
 
+	static Int64 getCurrentTimeInMicroSeconds();
+
 	TimeOut(TimeOutClient&, Int64, void(*functor)(void *), void* args, bool allocatedOnHeap);
 
 	virtual ~TimeOut();
 
-	bool operator<( const TimeOut& rhs ) const;
-
 	void operator()() { _functor( _args ); }
 
 	void cancel();
@@ -59,19 +59,28 @@ private:
 	void( *_functor )( void * );
 	Int64				_lengthInMicroSeconds;
 	void*				_args;
-	TimeOutTimeType		_timeoutTime;
+	RsslTimerWheelTimer	_timer;
 	bool				_canceled;
 	bool				_allocatedOnHeap;
 	TimeOutClient&		_timeOutClient;
 };
 
+// Timer wheel holding the timeouts of a TimeOutClient, in microseconds.
+class TimeOutWheel : public RsslTimerWheel
+{
+public:
+	TimeOutWheel();
+
+	UInt32 size() const { return timerCount; }
+};
+
 class TimeOutClient
 {
 public:
 	TimeOutClient();
 	virtual ~TimeOutClient();
 
-	virtual EmaList< TimeOut* >& getTimeOutList() = 0;
+	virtual TimeOutWheel& getTimeOutWheel() = 0;
 	virtual void installTimeOut() = 0;
 	virtual Mutex& getTimeOutMutex() = 0;
 
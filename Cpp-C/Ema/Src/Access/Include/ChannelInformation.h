@@ -90,7 +90,8 @@ public:
   {
 	  NoneEnum = 0x00,		 /*!< (0) No compression will be negotiated. */
 	  ZLIBEnum = 0x01,		 /*!< (1) Will attempt to use Zlib compression. */
-	  LZ4Enum = 0x02		 /*!< (2) Will attempt to use LZ4 compression */
+	  LZ4Enum = 0x02,		 /*!< (2) Will attempt to use LZ4 compression */
+	  ZSTDEnum = 0x04		 /*!< (4) Will attempt to use Zstandard compression */
   };
 
   ///@name Constructor
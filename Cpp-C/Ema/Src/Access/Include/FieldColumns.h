@@ -0,0 +1,179 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2022 Refinitiv. All rights reserved.              --
+ *|-----------------------------------------------------------------------------
+ */
+
+#ifndef __refinitiv_ema_access_FieldColumns_h
+#define __refinitiv_ema_access_FieldColumns_h
+
+/**
+	@class refinitiv::ema::access::FieldColumns FieldColumns.h "Access/Include/FieldColumns.h"
+	@brief FieldColumns collects numeric fields of many messages into arrays, with one row per message.
+
+	Each column holds the values of one field, as doubles, Int64s or nanosecond timestamps. Adding a message
+	decodes only the fields of the columns from its FieldList payload, without creating a FieldEntry for each
+	field.
+
+	The following code snippet shows collecting bid and ask prices from update messages.
+
+	\code
+
+	FieldColumns columns( 10000 );
+	columns.addColumn( 22, FieldColumns::DoubleEnum ).addColumn( 25, FieldColumns::DoubleEnum );
+
+	void AppClient::onUpdateMsg( const UpdateMsg& updateMsg, const OmmConsumerEvent& event )
+	{
+		columns.add( updateMsg );
+
+		if ( columns.getRowCount() == columns.getRowCapacity() )
+		{
+			const double* bids = columns.getDoubleValues( 0 );
+			...
+			columns.clear();
+		}
+	}
+
+	\endcode
+
+	\remark A row has no value for a field if the message did not carry it, or its value was blank.
+	\remark All methods in this class are \ref SingleThreaded.
+
+	@see Msg,
+		FieldList,
+		OmmInvalidUsageException
+*/
+
+#include "Access/Include/Common.h"
+
+namespace refinitiv {
+
+namespace ema {
+
+namespace access {
+
+class Msg;
+class FieldColumnsImpl;
+
+class EMA_ACCESS_API FieldColumns
+{
+public :
+
+	/** @enum ColumnType
+		An enumeration representing the type of a column's values.
+	*/
+	enum ColumnType
+	{
+		DoubleEnum = 1,		/*!< Values are double; the field is a Real, Float, Double, Int or UInt. */
+		Int64Enum = 2,		/*!< Values are Int64; the field is an Int, UInt or Enum. */
+		TimestampEnum = 3	/*!< Values are Int64 nanoseconds; since 1970-01-01T00:00:00 UTC for a DateTime or Date field, since midnight for a Time field. */
+	};
+
+	///@name Constructor
+	//@{
+	/** Constructs FieldColumns.
+		@throw OmmMemoryExhaustionException if application runs out of memory
+		@param[in] rowCapacity number of messages whose fields the columns can hold
+	*/
+	FieldColumns( UInt32 rowCapacity );
+	//@}
+
+	///@name Destructor
+	//@{
+	/** Destructor.
+	*/
+	virtual ~FieldColumns();
+	//@}
+
+	///@name Accessors
+	//@{
+	/** Returns the number of rows, which is the number of messages added since the last clear().
+		@return number of rows
+	*/
+	UInt32 getRowCount() const;
+
+	/** Returns the number of rows the columns can hold.
+		@return row capacity
+	*/
+	UInt32 getRowCapacity() const;
+
+	/** Returns the number of columns.
+		@return number of columns
+	*/
+	UInt32 getColumnCount() const;
+
+	/** Returns the values of a DoubleEnum column. A row with no value holds NaN.
+		@throw OmmInvalidUsageException if the column does not exist or is not a DoubleEnum column
+		@param[in] column index of the column, in the order the columns were added
+		@return array of getRowCount() values
+	*/
+	const double* getDoubleValues( UInt32 column ) const;
+
+	/** Returns the values of an Int64Enum or TimestampEnum column. A row with no value holds 0.
+		@throw OmmInvalidUsageException if the column does not exist or is a DoubleEnum column
+		@param[in] column index of the column, in the order the columns were added
+		@return array of getRowCount() values
+	*/
+	const Int64* getInt64Values( UInt32 column ) const;
+
+	/** Indicates whether a row of a column has a value.
+		@throw OmmInvalidUsageException if the column or row does not exist
+		@param[in] column index of the column
+		@param[in] row index of the row
+		@return true if the message of the row carried the column's field, with a value that was not blank
+	*/
+	bool hasValue( UInt32 column, UInt32 row ) const;
+
+	/** Returns the number of rows of a column that have a value.
+		@throw OmmInvalidUsageException if the column does not exist
+		@param[in] column index of the column
+		@return number of rows with a value
+	*/
+	UInt32 getValueCount( UInt32 column ) const;
+	//@}
+
+	///@name Operations
+	//@{
+	/** Adds a column for a field.
+		\remark Columns may only be added while there are no rows.
+		@throw OmmInvalidUsageException if there are rows, or there are already 64 columns
+		@throw OmmMemoryExhaustionException if application runs out of memory
+		@param[in] fieldId field id of the column's values
+		@param[in] columnType type of the column's values
+		@return reference to this object
+	*/
+	FieldColumns& addColumn( Int16 fieldId, ColumnType columnType );
+
+	/** Adds a row with the fields of a received message.
+		\remark The message's FieldList payload is decoded with the dictionary the message was received with.
+		A message with another payload adds a row with no values.
+		@throw OmmInvalidUsageException if the columns are full, the message was not received, or a column's field is
+		not in the dictionary or does not have a type that fits the column
+		@param[in] msg received message
+		@return reference to this object
+	*/
+	FieldColumns& add( const Msg& msg );
+
+	/** Removes all rows. The columns are kept.
+		@return reference to this object
+	*/
+	FieldColumns& clear();
+	//@}
+
+private :
+
+	FieldColumnsImpl*	_pImpl;
+
+	FieldColumns( const FieldColumns& );
+	FieldColumns& operator=( const FieldColumns& );
+};
+
+}
+
+}
+
+}
+
+#endif // __refinitiv_ema_access_FieldColumns_h
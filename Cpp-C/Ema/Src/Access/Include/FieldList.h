@@ -171,6 +171,7 @@ class OmmArray;
 class OmmOpaque;
 class OmmXml;
 class OmmAnsiPage;
+class FieldListEncodePlan;
 
 class FieldListDecoder;
 class FieldListEncoder;
@@ -265,6 +266,24 @@ public :
 	*/
 	const FieldEntry& getEntry() const;
 
+	/** Returns the entry with the given FieldId, without iterating to it.
+		\remark The first call indexes the FieldList, so that this and later calls take constant time whatever the
+		position of the entry. It does not change the position of iteration with forth().
+		\remark If the FieldId appears more than once, the first entry with it is returned.
+		\remark The returned entry is the same object as returned by getEntry(), and is overwritten by the next forth().
+		@throw OmmInvalidUsageException if the FieldList contains no entry with this FieldId
+		@param[in] fieldId FieldId of the entry to return
+		@return FieldEntry
+	*/
+	const FieldEntry& getEntry( Int16 fieldId ) const;
+
+	/** Indicates presence of an entry with the given FieldId.
+		\remark Like getEntry( Int16 ), this uses the FieldList index and does not change the position of iteration.
+		@param[in] fieldId looked up FieldId
+		@return true if the FieldList contains an entry with this FieldId; false otherwise
+	*/
+	bool hasEntry( Int16 fieldId ) const;
+
 	/** Resets iteration to start of container.
 	*/
 	void reset() const;
@@ -287,6 +306,18 @@ public :
 	*/
 	FieldList& info( Int16 dictionaryId, Int16 fieldListNum );
 
+	/** Specifies an encode plan, which gives the fields of the FieldList.
+		\remark If used, it must be set prior to adding anything to FieldList, and instead of info().
+		\remark Entries must then be added in the order of the plan's fields, with their data types, or
+		with the matching addCode method for a blank value. complete() encodes them all at once.
+		\remark clear() removes the plan from the FieldList; the plan itself is kept for reuse.
+		@throw OmmInvalidUsageException if this method is called after adding an entry or Info to FieldList,
+		or the FieldList is being added to another container
+		@param[in] plan encode plan to use
+		@return reference to this object
+	*/
+	FieldList& encodePlan( const FieldListEncodePlan& plan );
+
 	/** Adds a complex type of OMM data to the FieldList.
 		@throw OmmInvalidUsageException if an error is detected (exception will specify the cause of the error)
 		@param[in] fieldId field id value
@@ -0,0 +1,128 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2022 Refinitiv. All rights reserved.              --
+ *|-----------------------------------------------------------------------------
+ */
+
+#ifndef __refinitiv_ema_access_FieldListEncodePlan_h
+#define __refinitiv_ema_access_FieldListEncodePlan_h
+
+/**
+	@class refinitiv::ema::access::FieldListEncodePlan FieldListEncodePlan.h "Access/Include/FieldListEncodePlan.h"
+	@brief FieldListEncodePlan describes the fields of a FieldList that is encoded with the same fields each time.
+
+	The plan is prepared once, and may then be used by any number of FieldLists. A FieldList that uses the plan
+	does not encode its header and entries one by one; the values added to it are kept, and complete() writes
+	the FieldList in one pass, with an encoder chosen for each field when the plan was prepared.
+
+	The following code snippet shows encoding the payload of each update message with the same plan.
+
+	\code
+
+	FieldListEncodePlan plan;
+	plan.addField( 22, DataType::RealEnum ).addField( 25, DataType::RealEnum ).addField( 3, DataType::RmtesEnum );
+
+	FieldList fList;
+
+	for ( ... )
+	{
+		fList.clear().encodePlan( plan )
+			.addReal( 22, bid, OmmReal::ExponentNeg2Enum )
+			.addReal( 25, ask, OmmReal::ExponentNeg2Enum )
+			.addCodeRmtes( 3 )
+			.complete();
+
+		provider.submit( UpdateMsg().payload( fList ), handle );
+	}
+
+	\endcode
+
+	\remark Fields may be Int, UInt, Real, Float, Double, Date, Time, DateTime, Enum, Buffer, Ascii, Utf8 or Rmtes.
+	\remark The plan must not be changed or destroyed while a FieldList that uses it is being encoded.
+	\remark All methods in this class are \ref SingleThreaded.
+
+	@see FieldList,
+		OmmInvalidUsageException
+*/
+
+#include "Access/Include/Common.h"
+#include "Access/Include/DataType.h"
+
+namespace refinitiv {
+
+namespace ema {
+
+namespace access {
+
+class FieldListEncodePlanImpl;
+
+class EMA_ACCESS_API FieldListEncodePlan
+{
+public :
+
+	///@name Constructor
+	//@{
+	/** Constructs FieldListEncodePlan.
+		@throw OmmMemoryExhaustionException if application runs out of memory
+	*/
+	FieldListEncodePlan();
+	//@}
+
+	///@name Destructor
+	//@{
+	/** Destructor.
+	*/
+	virtual ~FieldListEncodePlan();
+	//@}
+
+	///@name Accessors
+	//@{
+	/** Returns the number of fields.
+		@return number of fields
+	*/
+	UInt32 getFieldCount() const;
+	//@}
+
+	///@name Operations
+	//@{
+	/** Removes all fields and the Info.
+		@return reference to this object
+	*/
+	FieldListEncodePlan& clear();
+
+	/** Specifies Info of the FieldLists encoded with the plan.
+		@param[in] dictionaryId dictionary id of the RdmFieldDictionary associated with the FieldLists
+		@param[in] fieldListNum FieldList template number
+		@return reference to this object
+	*/
+	FieldListEncodePlan& info( Int16 dictionaryId, Int16 fieldListNum );
+
+	/** Adds a field. Entries are added to a FieldList that uses the plan in the order their fields were added.
+		@throw OmmInvalidUsageException if the data type is not supported, or there are already 65535 fields
+		@throw OmmMemoryExhaustionException if application runs out of memory
+		@param[in] fieldId field id of the field
+		@param[in] dataType data type of the field's values
+		@return reference to this object
+	*/
+	FieldListEncodePlan& addField( Int16 fieldId, DataType::DataTypeEnum dataType );
+	//@}
+
+private :
+
+	friend class FieldList;
+
+	FieldListEncodePlanImpl*	_pImpl;
+
+	FieldListEncodePlan( const FieldListEncodePlan& );
+	FieldListEncodePlan& operator=( const FieldListEncodePlan& );
+};
+
+}
+
+}
+
+}
+
+#endif // __refinitiv_ema_access_FieldListEncodePlan_h
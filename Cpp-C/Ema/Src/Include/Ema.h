@@ -83,6 +83,9 @@
 #include "Access/Include/StatusMsg.h"
 #include "Access/Include/UpdateMsg.h"
 
+#include "Access/Include/FieldColumns.h"
+#include "Access/Include/FieldListEncodePlan.h"
+
 #include "Access/Include/OmmException.h"
 #include "Access/Include/OmmUnsupportedDomainTypeException.h"
 #include "Access/Include/OmmInvalidConfigurationException.h"
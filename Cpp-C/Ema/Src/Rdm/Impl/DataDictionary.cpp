@@ -193,6 +193,11 @@ void DataDictionary::loadEnumTypeDictionary(const EmaString& filename)
 	_pImpl->loadEnumTypeDictionary(filename);
 }
 
+void DataDictionary::loadSnapshot(const EmaString& filename)
+{
+	_pImpl->loadSnapshot(filename);
+}
+
 void DataDictionary::encodeFieldDictionary(Series& series, UInt32 verbosity)
 {
 	_pImpl->encodeFieldDictionary(series, verbosity);
@@ -622,6 +622,34 @@ void DataDictionaryImpl::loadEnumTypeDictionary(const refinitiv::ema::access::Em
 	}
 }
 
+void DataDictionaryImpl::loadSnapshot(const refinitiv::ema::access::EmaString& filename)
+{
+	MutexLocker lock(_dataAccessMutex);
+
+	if ( _ownRsslDataDictionary )
+	{
+		if (rsslLoadDataDictionarySnapshot(filename.c_str(), _pRsslDataDictionary, &_errorText) < RSSL_RET_SUCCESS)
+		{
+			refinitiv::ema::access::EmaString errorText, workingDir;
+			getCurrentDir(workingDir);
+			errorText.set("Unable to load dictionary snapshot from file named ").append(filename).append(CR)
+				.append("Current working directory ").append(workingDir).append(CR)
+				.append("Reason='").append(_errorText.data).append("'");
+
+			throwIueException( errorText, OmmInvalidUsageException::FailureEnum );
+		}
+		else
+		{
+			_loadedFieldDictionary = true;
+			_loadedEnumTypeDef = true;
+		}
+	}
+	else
+	{
+		throwIueForQueryOnly();
+	}
+}
+
 void DataDictionaryImpl::encodeFieldDictionary(refinitiv::ema::access::Series& series,
 	refinitiv::ema::access::UInt32 verbosity)
 {
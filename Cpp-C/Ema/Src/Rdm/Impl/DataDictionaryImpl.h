@@ -87,6 +87,8 @@ public:
 
 	void loadEnumTypeDictionary(const refinitiv::ema::access::EmaString& filename);
 
+	void loadSnapshot(const refinitiv::ema::access::EmaString& filename);
+
 	void encodeFieldDictionary(refinitiv::ema::access::Series& series, refinitiv::ema::access::UInt32 verbosity);
 
 	bool encodeFieldDictionary(refinitiv::ema::access::Series& series, 
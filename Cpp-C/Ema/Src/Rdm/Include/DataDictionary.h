@@ -302,6 +302,21 @@ public:
 	*/
 	void loadEnumTypeDictionary(const refinitiv::ema::access::EmaString& filename);
 
+	/**
+	* Loads field and enumerated type definitions from a dictionary snapshot
+	* file, as written by the DictionarySnapshot tool. The snapshot is mapped
+	* into memory read-only and shared with other processes that load it, so
+	* this is much faster than loading the text dictionaries. The data
+	* dictionary must be empty, and no further definitions may be added to it.
+	*
+	* @param[in] filename specifies a dictionary snapshot file
+	*
+	* @throw OmmInvalidUsageException if fails to load from the specified
+	* file name from \p filename.
+	*
+	*/
+	void loadSnapshot(const refinitiv::ema::access::EmaString& filename);
+
 	/**
 	* Encode the field dictionary information into a data payload
 	* according the domain model, using the field information from the entries
@@ -0,0 +1,166 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2022 Refinitiv. All rights reserved.              --
+ *|-----------------------------------------------------------------------------
+ */
+
+/*
+ * This application writes a dictionary snapshot: a binary image of a field
+ * dictionary and enumerated type dictionary that can be mapped straight into
+ * memory with rsslLoadDataDictionarySnapshot(). It loads the text dictionaries,
+ * writes the snapshot, then loads the snapshot back and checks that it holds
+ * the same definitions, reporting how long each load took.
+ */
+
+#include "rtr/rsslDataDictionary.h"
+#include "rtr/rsslGetTime.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+static char fieldDictionaryFileName[255] = "RDMFieldDictionary";
+static char enumTypeDictionaryFileName[255] = "enumtype.def";
+static char snapshotFileName[255] = "RDMDictionary.snapshot";
+static RsslUInt64 baseAddress = 0;
+
+static void printUsageAndExit(char *appName)
+{
+	printf("Usage: %s [-f <field dictionary>] [-e <enumerated type dictionary>] [-o <snapshot file>] [-baseAddress <hex address>]\n"
+			" -f specifies the field dictionary to load (default %s).\n"
+			" -e specifies the enumerated type dictionary to load (default %s).\n"
+			" -o specifies the snapshot file to write (default %s).\n"
+			" -baseAddress specifies the address at which the snapshot is mapped without relocation, as a multiple of 0x10000.\n"
+			"  By default an address is chosen from the dictionary content.\n",
+			appName, fieldDictionaryFileName, enumTypeDictionaryFileName, snapshotFileName);
+	exit(-1);
+}
+
+/* Checks that the snapshot holds the same fields and enumerated types as the text dictionaries. */
+static RsslBool verifySnapshot(RsslDataDictionary *pTextDictionary, RsslDataDictionary *pSnapshotDictionary)
+{
+	RsslInt32 fid;
+
+	if (pTextDictionary->numberOfEntries != pSnapshotDictionary->numberOfEntries
+			|| pTextDictionary->enumTableCount != pSnapshotDictionary->enumTableCount
+			|| pTextDictionary->minFid != pSnapshotDictionary->minFid
+			|| pTextDictionary->maxFid != pSnapshotDictionary->maxFid)
+	{
+		printf("Snapshot has %d fields(%d to %d) and %d enumerated type tables; expected %d fields(%d to %d) and %d tables.\n",
+				pSnapshotDictionary->numberOfEntries, pSnapshotDictionary->minFid, pSnapshotDictionary->maxFid, pSnapshotDictionary->enumTableCount,
+				pTextDictionary->numberOfEntries, pTextDictionary->minFid, pTextDictionary->maxFid, pTextDictionary->enumTableCount);
+		return RSSL_FALSE;
+	}
+
+	for (fid = pTextDictionary->minFid; fid <= pTextDictionary->maxFid; ++fid)
+	{
+		RsslDictionaryEntry *pTextEntry = pTextDictionary->entriesArray[fid];
+		RsslDictionaryEntry *pSnapshotEntry = pSnapshotDictionary->entriesArray[fid];
+
+		if (pTextEntry == NULL && pSnapshotEntry == NULL)
+			continue;
+
+		if (pTextEntry == NULL || pSnapshotEntry == NULL
+				|| !rsslBufferIsEqual(&pTextEntry->acronym, &pSnapshotEntry->acronym)
+				|| pTextEntry->rwfType != pSnapshotEntry->rwfType
+				|| (pTextEntry->pEnumTypeTable == NULL) != (pSnapshotEntry->pEnumTypeTable == NULL)
+				|| (pTextEntry->pEnumTypeTable && pTextEntry->pEnumTypeTable->maxValue != pSnapshotEntry->pEnumTypeTable->maxValue))
+		{
+			printf("Snapshot definition of field %d does not match.\n", fid);
+			return RSSL_FALSE;
+		}
+	}
+
+	return RSSL_TRUE;
+}
+
+int main(int argc, char **argv)
+{
+	RsslDataDictionary textDictionary, snapshotDictionary;
+	char errorTextData[256];
+	RsslBuffer errorText;
+	RsslTimeValue startTime, textLoadTime, snapshotLoadTime;
+	int i;
+
+	for (i = 1; i < argc; ++i)
+	{
+		if (strcmp("-f", argv[i]) == 0 && i + 1 < argc)
+			snprintf(fieldDictionaryFileName, sizeof(fieldDictionaryFileName), "%s", argv[++i]);
+		else if (strcmp("-e", argv[i]) == 0 && i + 1 < argc)
+			snprintf(enumTypeDictionaryFileName, sizeof(enumTypeDictionaryFileName), "%s", argv[++i]);
+		else if (strcmp("-o", argv[i]) == 0 && i + 1 < argc)
+			snprintf(snapshotFileName, sizeof(snapshotFileName), "%s", argv[++i]);
+		else if (strcmp("-baseAddress", argv[i]) == 0 && i + 1 < argc)
+			baseAddress = strtoull(argv[++i], NULL, 16);
+		else
+			printUsageAndExit(argv[0]);
+	}
+
+	rsslClearDataDictionary(&textDictionary);
+	rsslClearDataDictionary(&snapshotDictionary);
+
+	startTime = rsslGetTimeMicro();
+
+	errorText.data = errorTextData;
+	errorText.length = sizeof(errorTextData);
+	if (rsslLoadFieldDictionary(fieldDictionaryFileName, &textDictionary, &errorText) != RSSL_RET_SUCCESS)
+	{
+		printf("Unable to load field dictionary '%s': %.*s\n", fieldDictionaryFileName, errorText.length, errorText.data);
+		return -1;
+	}
+
+	errorText.length = sizeof(errorTextData);
+	if (rsslLoadEnumTypeDictionary(enumTypeDictionaryFileName, &textDictionary, &errorText) != RSSL_RET_SUCCESS)
+	{
+		printf("Unable to load enumerated type dictionary '%s': %.*s\n", enumTypeDictionaryFileName, errorText.length, errorText.data);
+		rsslDeleteDataDictionary(&textDictionary);
+		return -1;
+	}
+
+	textLoadTime = rsslGetTimeMicro() - startTime;
+
+	errorText.length = sizeof(errorTextData);
+	if (rsslSaveDataDictionarySnapshot(snapshotFileName, &textDictionary, baseAddress, &errorText) != RSSL_RET_SUCCESS)
+	{
+		printf("Unable to write snapshot '%s': %.*s\n", snapshotFileName, errorText.length, errorText.data);
+		rsslDeleteDataDictionary(&textDictionary);
+		return -1;
+	}
+
+	startTime = rsslGetTimeMicro();
+
+	errorText.length = sizeof(errorTextData);
+	if (rsslLoadDataDictionarySnapshot(snapshotFileName, &snapshotDictionary, &errorText) != RSSL_RET_SUCCESS)
+	{
+		printf("Unable to load snapshot '%s': %.*s\n", snapshotFileName, errorText.length, errorText.data);
+		rsslDeleteDataDictionary(&textDictionary);
+		return -1;
+	}
+
+	snapshotLoadTime = rsslGetTimeMicro() - startTime;
+
+	if (!verifySnapshot(&textDictionary, &snapshotDictionary))
+	{
+		rsslDeleteDataDictionary(&snapshotDictionary);
+		rsslDeleteDataDictionary(&textDictionary);
+		return -1;
+	}
+
+	printf("Wrote snapshot '%s': %d fields, %d enumerated type tables.\n", snapshotFileName, textDictionary.numberOfEntries, textDictionary.enumTableCount);
+	printf("  Text dictionary load time (usec): " RTR_LLU "\n", textLoadTime);
+	printf("  Snapshot load time (usec): " RTR_LLU "\n", snapshotLoadTime);
+
+	rsslDeleteDataDictionary(&snapshotDictionary);
+	rsslDeleteDataDictionary(&textDictionary);
+	return 0;
+}
+
+#ifdef __cplusplus
+};
+#endif
@@ -0,0 +1,558 @@
+/*
+ * This source code is provided under the Apache 2.0 license and is provided
+ * AS IS with no warranty or guarantee of fit for purpose.  See the project's
+ * LICENSE.md for details.
+ * Copyright (C) 2022 Refinitiv. All rights reserved.
+*/
+
+/* CaptureReplay.c
+ * Replays the messages of a binary trace capture (see RSSL_TRACE_BINARY) over a
+ * connection, at their original pace or faster, so that a consumer such as
+ * ConsPerf, or a provider such as ProvPerf, can be driven with recorded traffic.
+ * Also converts captures to the XML format of the text message trace. */
+
+#include "rtr/rsslTransport.h"
+#include "rtr/rsslGetTime.h"
+#include "rtr/rsslDataDictionary.h"
+#include "rtr/rsslMsgDecoders.h"
+#include "decodeRoutines.h"
+#include "xmlDump.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#ifdef WIN32
+#include <windows.h>
+#include <winsock2.h>
+#else
+#include <sys/select.h>
+#include <sys/time.h>
+#endif
+
+typedef struct
+{
+	char		*captureFileName;	/* Capture to read */
+	char		*hostName;			/* Host to connect to, or NULL to accept a connection */
+	char		*portNo;			/* Port to connect to or listen on */
+	char		*xmlFileName;		/* If set, the capture is converted to this XML file instead of being replayed */
+	char		*fieldDictionaryFileName;
+	char		*enumTypeFileName;
+	RsslBool	replayReads;		/* Replays incoming messages, instead of outgoing ones */
+	double		speed;				/* Replay speed, relative to the original pace; 0 replays without pauses */
+	RsslUInt64	channelId;			/* Replays only messages of this channel, if set */
+	RsslBool	filterChannel;
+} CaptureReplayConfig;
+
+static CaptureReplayConfig config;
+
+/* Counts, for the replay summary and the per-second output. */
+static RsslUInt64 msgsReplayed = 0, bytesReplayed = 0, msgsSkipped = 0, msgsDropped = 0;
+static RsslUInt64 msgsRead = 0, bytesRead = 0;
+
+static void printUsageAndExit(char *appName)
+{
+	printf("Usage: %s -capture <file> [-h <host>] -p <port> [-direction in|out] [-speed <factor>] [-channel <id>] or\n"
+			"%s -capture <file> -xml <file> [-dictionary <file>] [-enumtype <file>]\n"
+			" -capture <file>         Capture file written with the RSSL_TRACE_BINARY trace option.\n"
+			" -h <host>               Connects to the host, to replay messages to a provider. Without it, a connection is accepted on the port, to replay messages to a consumer.\n"
+			" -p <port>               Port to connect to, or to listen on.\n"
+			" -direction in|out       Replays the incoming messages of the capture (in), or the outgoing messages (out). Default is out.\n"
+			" -speed <factor>         Replay speed, as a multiple of the original pace. 0 replays the messages as fast as possible. Default is 1.\n"
+			" -channel <id>           Replays only the messages of the channel with this IPC descriptor.\n"
+			" -xml <file>             Converts the capture to the XML format of the message trace, instead of replaying it.\n"
+			" -dictionary <file>      Field dictionary used to decode field lists when converting to XML.\n"
+			" -enumtype <file>        Enumerated types dictionary used with -dictionary.\n",
+			appName, appName);
+	exit(-1);
+}
+
+/* Writes the time of a record in the format of xmlDumpTimestamp(). */
+static void dumpRecordTime(FILE *file, RsslUInt64 timestamp)
+{
+	time_t seconds = (time_t)(timestamp / 1000000000ULL);
+	struct tm recordTime;
+
+#ifdef WIN32
+	localtime_s(&recordTime, &seconds);
+#else
+	localtime_r(&seconds, &recordTime);
+#endif
+
+	fprintf(file, "<!-- Time: %d:%02d:%02d:%03d -->\n", recordTime.tm_hour, recordTime.tm_min, recordTime.tm_sec,
+			(int)(timestamp / 1000000ULL % 1000));
+}
+
+/* Converts the capture to XML, with the same comments and decoding as the message trace. */
+static int convertToXml()
+{
+	RsslDataDictionary dictionary;
+	RsslDataDictionary *pDictionary = NULL;
+	RsslCaptureFile *pCaptureFile;
+	RsslCaptureRecord *pRecord;
+	RsslBuffer errorText;
+	char errorTextData[256];
+	RsslError error;
+	RsslRet readRet;
+	RsslUInt64 recordCount = 0;
+	FILE *xmlFile;
+
+	if (config.fieldDictionaryFileName)
+	{
+		errorText.data = errorTextData;
+		errorText.length = sizeof(errorTextData);
+		rsslClearDataDictionary(&dictionary);
+
+		if (rsslLoadFieldDictionary(config.fieldDictionaryFileName, &dictionary, &errorText) < RSSL_RET_SUCCESS
+				|| (config.enumTypeFileName && rsslLoadEnumTypeDictionary(config.enumTypeFileName, &dictionary, &errorText) < RSSL_RET_SUCCESS))
+		{
+			printf("Unable to load dictionary: %.*s\n", errorText.length, errorText.data);
+			return -1;
+		}
+		pDictionary = &dictionary;
+	}
+
+	if ((pCaptureFile = rsslOpenCaptureFile(config.captureFileName, &error)) == NULL)
+	{
+		printf("%s\n", error.text);
+		return -1;
+	}
+
+	if ((xmlFile = fopen(config.xmlFileName, "w")) == NULL)
+	{
+		printf("Unable to open %s.\n", config.xmlFileName);
+		rsslCloseCaptureFile(pCaptureFile);
+		return -1;
+	}
+
+	while ((pRecord = rsslReadCaptureRecord(pCaptureFile, &readRet, &error)) != NULL)
+	{
+		char message[128];
+		RsslDecodeIterator dIter;
+		RsslMsg msg;
+		RsslRet ret = RSSL_RET_SUCCESS;
+
+		++recordCount;
+
+		switch(pRecord->direction)
+		{
+			case RSSL_CAPTURE_READ: snprintf(message, sizeof(message), "Incoming Message (Channel IPC descriptor = %llu)", pRecord->channelId); break;
+			case RSSL_CAPTURE_WRITE: snprintf(message, sizeof(message), "Outgoing Message (Channel IPC descriptor = %llu)", pRecord->channelId); break;
+			case RSSL_CAPTURE_PACK: snprintf(message, sizeof(message), "Pack Message (Channel IPC descriptor = %llu)", pRecord->channelId); break;
+			case RSSL_CAPTURE_DUMP: snprintf(message, sizeof(message), "Dump Message (Channel IPC descriptor = %llu)", pRecord->channelId); break;
+			case RSSL_CAPTURE_DROPPED:
+			{
+				const unsigned char *pCount = (const unsigned char*)pRecord->data.data;
+
+				snprintf(message, sizeof(message), "%lu messages were dropped from the capture (Channel IPC descriptor = %llu)",
+						((unsigned long)pCount[0] << 24) | ((unsigned long)pCount[1] << 16) | ((unsigned long)pCount[2] << 8) | pCount[3],
+						pRecord->channelId);
+				xmlDumpComment(xmlFile, message);
+				dumpRecordTime(xmlFile, pRecord->timestamp);
+				continue;
+			}
+			default: snprintf(message, sizeof(message), "Unknown Record Type %u (Channel IPC descriptor = %llu)", pRecord->direction, pRecord->channelId); break;
+		}
+
+		xmlDumpComment(xmlFile, message);
+		dumpRecordTime(xmlFile, pRecord->timestamp);
+
+		if (pRecord->protocolType == RSSL_RWF_PROTOCOL_TYPE)
+		{
+			rsslClearDecodeIterator(&dIter);
+			rsslSetDecodeIteratorRWFVersion(&dIter, pRecord->majorVersion, pRecord->minorVersion);
+			rsslSetDecodeIteratorBuffer(&dIter, &pRecord->data);
+			rsslClearMsg(&msg);
+
+			if ((ret = rsslDecodeMsg(&dIter, &msg)) == RSSL_RET_SUCCESS)
+				decodeMsgToXML(xmlFile, &msg, pDictionary, &dIter);
+		}
+		else if (pRecord->protocolType == RSSL_JSON_PROTOCOL_TYPE)
+		{
+			fprintf(xmlFile, "<!-- JSON protocol\n");
+			dumpJSON(xmlFile, &pRecord->data);
+			fprintf(xmlFile, "\n-->");
+			fputc('\n', xmlFile);
+		}
+
+		if (ret != RSSL_RET_SUCCESS || (pRecord->protocolType != RSSL_RWF_PROTOCOL_TYPE && pRecord->protocolType != RSSL_JSON_PROTOCOL_TYPE))
+		{
+			xmlDumpHexBuffer(xmlFile, &pRecord->data);
+			fputc('\n', xmlFile);
+		}
+
+		snprintf(message, sizeof(message), "End Message (Channel IPC descriptor = %llu)", pRecord->channelId);
+		xmlDumpComment(xmlFile, message);
+	}
+
+	fclose(xmlFile);
+	rsslCloseCaptureFile(pCaptureFile);
+	if (pDictionary)
+		rsslDeleteDataDictionary(pDictionary);
+
+	if (readRet != RSSL_RET_SUCCESS)
+	{
+		printf("Error reading capture after %llu records: %s\n", recordCount, error.text);
+		return -1;
+	}
+
+	printf("Converted %llu records to %s.\n", recordCount, config.xmlFileName);
+	return 0;
+}
+
+/* Waits until the channel can be read, can be written if wantWrite is set, or until timeoutUsec passes. */
+static void waitForChannel(RsslChannel *pChannel, RsslBool wantWrite, long timeoutUsec)
+{
+	fd_set readFds, writeFds, exceptFds;
+	struct timeval time;
+
+	FD_ZERO(&readFds);
+	FD_ZERO(&writeFds);
+	FD_ZERO(&exceptFds);
+	FD_SET(pChannel->socketId, &readFds);
+	FD_SET(pChannel->socketId, &exceptFds);
+	if (wantWrite)
+		FD_SET(pChannel->socketId, &writeFds);
+
+	time.tv_sec = timeoutUsec / 1000000;
+	time.tv_usec = timeoutUsec % 1000000;
+	select(FD_SETSIZE, &readFds, &writeFds, &exceptFds, &time);
+}
+
+/* Reads and discards whatever the other side has sent, so that it is not blocked writing to us. */
+static RsslRet readChannel(RsslChannel *pChannel, RsslError *pError)
+{
+	RsslReadInArgs readInArgs;
+	RsslReadOutArgs readOutArgs;
+	RsslRet readRet;
+
+	do
+	{
+		rsslClearReadInArgs(&readInArgs);
+		rsslClearReadOutArgs(&readOutArgs);
+
+		if (rsslReadEx(pChannel, &readInArgs, &readOutArgs, &readRet, pError) != NULL)
+			++msgsRead;
+		bytesRead += readOutArgs.bytesRead;
+
+		if (readRet < RSSL_RET_SUCCESS && readRet != RSSL_RET_READ_WOULD_BLOCK && readRet != RSSL_RET_READ_PING
+				&& readRet != RSSL_RET_READ_FD_CHANGE)
+			return readRet;
+	} while (readRet > RSSL_RET_SUCCESS);
+
+	return RSSL_RET_SUCCESS;
+}
+
+/* Connects to the provider, or accepts a connection from the consumer, and initializes the channel. */
+static RsslChannel *openChannel(RsslServer **ppServer, RsslError *pError)
+{
+	RsslChannel *pChannel;
+	RsslInProgInfo inProg;
+	RsslRet ret;
+
+	if (config.hostName)
+	{
+		RsslConnectOptions connectOpts = RSSL_INIT_CONNECT_OPTS;
+
+		connectOpts.connectionInfo.unified.address = config.hostName;
+		connectOpts.connectionInfo.unified.serviceName = config.portNo;
+		connectOpts.protocolType = RSSL_RWF_PROTOCOL_TYPE;
+		connectOpts.majorVersion = RSSL_RWF_MAJOR_VERSION;
+		connectOpts.minorVersion = RSSL_RWF_MINOR_VERSION;
+
+		if ((pChannel = rsslConnect(&connectOpts, pError)) == NULL)
+			return NULL;
+	}
+	else
+	{
+		RsslBindOptions bindOpts = RSSL_INIT_BIND_OPTS;
+		RsslAcceptOptions acceptOpts = RSSL_INIT_ACCEPT_OPTS;
+
+		bindOpts.serviceName = config.portNo;
+		bindOpts.protocolType = RSSL_RWF_PROTOCOL_TYPE;
+		bindOpts.majorVersion = RSSL_RWF_MAJOR_VERSION;
+		bindOpts.minorVersion = RSSL_RWF_MINOR_VERSION;
+
+		if ((*ppServer = rsslBind(&bindOpts, pError)) == NULL)
+			return NULL;
+
+		printf("Waiting for a connection on port %s.\n", config.portNo);
+
+		for (;;)
+		{
+			fd_set readFds;
+
+			FD_ZERO(&readFds);
+			FD_SET((*ppServer)->socketId, &readFds);
+			if (select(FD_SETSIZE, &readFds, NULL, NULL, NULL) > 0)
+				break;
+		}
+
+		if ((pChannel = rsslAccept(*ppServer, &acceptOpts, pError)) == NULL)
+			return NULL;
+	}
+
+	while (pChannel->state == RSSL_CH_STATE_INITIALIZING)
+	{
+		waitForChannel(pChannel, RSSL_TRUE, 100000);
+
+		if ((ret = rsslInitChannel(pChannel, &inProg, pError)) < RSSL_RET_SUCCESS)
+		{
+			rsslCloseChannel(pChannel, pError);
+			return NULL;
+		}
+	}
+
+	if (pChannel->state != RSSL_CH_STATE_ACTIVE)
+	{
+		rsslCloseChannel(pChannel, pError);
+		return NULL;
+	}
+
+	printf("Channel active, protocol version %u.%u.\n", pChannel->majorVersion, pChannel->minorVersion);
+	return pChannel;
+}
+
+/* Writes one message, waiting for buffers or for the flush of earlier messages as needed. */
+static RsslRet replayMsg(RsslChannel *pChannel, const RsslBuffer *pData, RsslError *pError)
+{
+	RsslBuffer *pBuffer;
+	RsslUInt32 bytesWritten, uncompBytesWritten;
+	RsslRet ret;
+
+	while ((pBuffer = rsslGetBuffer(pChannel, pData->length, RSSL_FALSE, pError)) == NULL)
+	{
+		if (pError->rsslErrorId != RSSL_RET_BUFFER_NO_BUFFERS)
+			return pError->rsslErrorId;
+
+		if ((ret = rsslFlush(pChannel, pError)) < RSSL_RET_SUCCESS)
+			return ret;
+		if ((ret = readChannel(pChannel, pError)) < RSSL_RET_SUCCESS)
+			return ret;
+		waitForChannel(pChannel, RSSL_TRUE, 1000);
+	}
+
+	memcpy(pBuffer->data, pData->data, pData->length);
+	pBuffer->length = pData->length;
+
+	while ((ret = rsslWrite(pChannel, pBuffer, RSSL_HIGH_PRIORITY, 0, &bytesWritten, &uncompBytesWritten, pError)) == RSSL_RET_WRITE_CALL_AGAIN)
+	{
+		if ((ret = rsslFlush(pChannel, pError)) < RSSL_RET_SUCCESS)
+			break;
+	}
+
+	if (ret < RSSL_RET_SUCCESS)
+	{
+		rsslReleaseBuffer(pBuffer, pError);
+		return ret;
+	}
+
+	/* Bytes remain to be flushed. */
+	if (ret > RSSL_RET_SUCCESS && (ret = rsslFlush(pChannel, pError)) < RSSL_RET_SUCCESS)
+		return ret;
+
+	++msgsReplayed;
+	bytesReplayed += pData->length;
+	return RSSL_RET_SUCCESS;
+}
+
+/* Replays the messages of the capture over the channel. */
+static int replayCapture()
+{
+	RsslServer *pServer = NULL;
+	RsslChannel *pChannel;
+	RsslCaptureFile *pCaptureFile;
+	RsslCaptureRecord *pRecord;
+	RsslError error;
+	RsslRet ret, readRet;
+	RsslUInt64 firstTimestamp = 0;
+	RsslTimeValue startTime, nextPrintTime, nextPingTime, currentTime;
+	RsslUInt64 lastMsgsReplayed = 0, lastBytesReplayed = 0;
+	RsslBool first = RSSL_TRUE;
+	int exitCode = 0;
+
+	if ((pCaptureFile = rsslOpenCaptureFile(config.captureFileName, &error)) == NULL)
+	{
+		printf("%s\n", error.text);
+		return -1;
+	}
+
+	if ((pChannel = openChannel(&pServer, &error)) == NULL)
+	{
+		printf("Unable to open channel: %s\n", error.text);
+		rsslCloseCaptureFile(pCaptureFile);
+		if (pServer)
+			rsslCloseServer(pServer, &error);
+		return -1;
+	}
+
+	startTime = rsslGetTimeNano();
+	nextPrintTime = startTime + 1000000000LL;
+	nextPingTime = startTime + (RsslTimeValue)pChannel->pingTimeout * 1000000000LL / 3;
+
+	while ((pRecord = rsslReadCaptureRecord(pCaptureFile, &readRet, &error)) != NULL)
+	{
+		if (pRecord->direction == RSSL_CAPTURE_DROPPED)
+		{
+			const unsigned char *pCount = (const unsigned char*)pRecord->data.data;
+
+			msgsDropped += ((RsslUInt64)pCount[0] << 24) | ((RsslUInt64)pCount[1] << 16) | ((RsslUInt64)pCount[2] << 8) | pCount[3];
+			continue;
+		}
+
+		if ((config.replayReads ? pRecord->direction != RSSL_CAPTURE_READ : (pRecord->direction != RSSL_CAPTURE_WRITE && pRecord->direction != RSSL_CAPTURE_PACK))
+				|| (config.filterChannel && pRecord->channelId != config.channelId))
+			continue;
+
+		/* Only RWF messages can be replayed over the RWF connection. */
+		if (pRecord->protocolType != RSSL_RWF_PROTOCOL_TYPE)
+		{
+			++msgsSkipped;
+			continue;
+		}
+
+		if (first)
+		{
+			firstTimestamp = pRecord->timestamp;
+			startTime = rsslGetTimeNano();
+			first = RSSL_FALSE;
+		}
+
+		/* Waits until the message's time, scaled by the replay speed, reading from the channel meanwhile. */
+		for (;;)
+		{
+			currentTime = rsslGetTimeNano();
+
+			if (currentTime >= nextPrintTime)
+			{
+				printf("Replayed %llu msgs/sec, %llu bytes/sec (%llu msgs total); read %llu msgs\n", msgsReplayed - lastMsgsReplayed,
+						bytesReplayed - lastBytesReplayed, msgsReplayed, msgsRead);
+				lastMsgsReplayed = msgsReplayed;
+				lastBytesReplayed = bytesReplayed;
+				nextPrintTime += 1000000000LL;
+			}
+
+			if (currentTime >= nextPingTime)
+			{
+				if ((ret = rsslPing(pChannel, &error)) < RSSL_RET_SUCCESS)
+					break;
+				nextPingTime = currentTime + (RsslTimeValue)pChannel->pingTimeout * 1000000000LL / 3;
+			}
+
+			if ((ret = readChannel(pChannel, &error)) < RSSL_RET_SUCCESS)
+				break;
+
+			if (config.speed == 0.0)
+				break;
+			else
+			{
+				RsslTimeValue msgTime = startTime + (RsslTimeValue)((double)(pRecord->timestamp - firstTimestamp) / config.speed);
+				long waitUsec;
+
+				if (currentTime >= msgTime)
+					break;
+
+				/* Waits for at most a millisecond, since select() cannot be relied on to be more precise. */
+				waitUsec = (long)((msgTime - currentTime) / 1000);
+				waitForChannel(pChannel, RSSL_FALSE, waitUsec < 1000 ? waitUsec : 1000);
+			}
+		}
+
+		if (ret < RSSL_RET_SUCCESS || (ret = replayMsg(pChannel, &pRecord->data, &error)) < RSSL_RET_SUCCESS)
+		{
+			printf("Channel failed: %s (%s)\n", rsslRetCodeToString(ret), error.text);
+			exitCode = -1;
+			break;
+		}
+	}
+
+	if (exitCode == 0 && readRet != RSSL_RET_SUCCESS)
+	{
+		printf("Error reading capture: %s\n", error.text);
+		exitCode = -1;
+	}
+
+	/* Finishes writing the last messages. */
+	while (exitCode == 0 && (ret = rsslFlush(pChannel, &error)) > RSSL_RET_SUCCESS)
+		waitForChannel(pChannel, RSSL_TRUE, 1000);
+
+	currentTime = rsslGetTimeNano();
+	printf("\nReplayed %llu messages (%llu bytes) in %.3f seconds.\n", msgsReplayed, bytesReplayed, (double)(currentTime - startTime) / 1000000000.0);
+	if (msgsSkipped)
+		printf("Skipped %llu messages that were not RWF.\n", msgsSkipped);
+	if (msgsDropped)
+		printf("The capture is missing %llu messages that were dropped when it was written.\n", msgsDropped);
+	printf("Read %llu messages (%llu bytes).\n", msgsRead, bytesRead);
+
+	rsslCloseChannel(pChannel, &error);
+	if (pServer)
+		rsslCloseServer(pServer, &error);
+	rsslCloseCaptureFile(pCaptureFile);
+	return exitCode;
+}
+
+int main(int argc, char **argv)
+{
+	RsslError error;
+	int i, exitCode;
+
+	memset(&config, 0, sizeof(config));
+	config.speed = 1.0;
+
+	for (i = 1; i < argc; ++i)
+	{
+		if (strcmp("-capture", argv[i]) == 0 && i + 1 < argc)
+			config.captureFileName = argv[++i];
+		else if (strcmp("-h", argv[i]) == 0 && i + 1 < argc)
+			config.hostName = argv[++i];
+		else if (strcmp("-p", argv[i]) == 0 && i + 1 < argc)
+			config.portNo = argv[++i];
+		else if (strcmp("-direction", argv[i]) == 0 && i + 1 < argc)
+		{
+			++i;
+			if (strcmp(argv[i], "in") == 0)
+				config.replayReads = RSSL_TRUE;
+			else if (strcmp(argv[i], "out") == 0)
+				config.replayReads = RSSL_FALSE;
+			else
+				printUsageAndExit(argv[0]);
+		}
+		else if (strcmp("-speed", argv[i]) == 0 && i + 1 < argc)
+		{
+			config.speed = atof(argv[++i]);
+			if (config.speed < 0.0)
+				printUsageAndExit(argv[0]);
+		}
+		else if (strcmp("-channel", argv[i]) == 0 && i + 1 < argc)
+		{
+			config.channelId = (RsslUInt64)strtoull(argv[++i], NULL, 10);
+			config.filterChannel = RSSL_TRUE;
+		}
+		else if (strcmp("-xml", argv[i]) == 0 && i + 1 < argc)
+			config.xmlFileName = argv[++i];
+		else if (strcmp("-dictionary", argv[i]) == 0 && i + 1 < argc)
+			config.fieldDictionaryFileName = argv[++i];
+		else if (strcmp("-enumtype", argv[i]) == 0 && i + 1 < argc)
+			config.enumTypeFileName = argv[++i];
+		else
+			printUsageAndExit(argv[0]);
+	}
+
+	if (config.captureFileName == NULL || (config.xmlFileName == NULL && config.portNo == NULL))
+		printUsageAndExit(argv[0]);
+
+	if (config.xmlFileName)
+		return convertToXml();
+
+	if (rsslInitialize(RSSL_LOCK_NONE, &error) != RSSL_RET_SUCCESS)
+	{
+		printf("rsslInitialize() failed: %s\n", error.text);
+		return -1;
+	}
+
+	exitCode = replayCapture();
+
+	rsslUninitialize();
+	return exitCode;
+}
@@ -11,6 +11,21 @@
 #include "xmlMsgDataParser.h"
 
 #include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Maximum number of fields in an update encoded with an encode plan. */
+#define MAX_PLAN_FIELDS 256
+
+/* Encode plans of the update messages, and the values they encode. */
+typedef struct {
+	RsslEncodePlan	plan;			/* Plan for the update without the latency field. */
+	RsslEncodePlan	latencyPlan;	/* Plan for the update with the latency field. */
+	const void		**values;		/* Values of the fields, with room for the latency field. */
+} MarketPriceUpdatePlan;
+
+static MarketPriceUpdatePlan *updatePlans = NULL;
 
 RsslUInt32 getNextMarketPriceUpdateEstimatedContentLength(MarketPriceItem *mpItem)
 {
@@ -139,3 +154,117 @@ void freeMarketPriceItem(MarketPriceItem* mpItem)
 	free(mpItem);
 }
 
+
+static RsslRet buildMarketPriceUpdatePlan(RsslEncodePlan *pPlan, MarketPriceMsg *mpMsg,
+		RsslEncodePlanField *planFields, RsslBool withLatency)
+{
+	RsslUpdateMsg updateMsg;
+	RsslFieldList fList;
+	RsslUInt16 fieldCount = (RsslUInt16)mpMsg->fieldEntriesCount;
+
+	rsslClearUpdateMsg(&updateMsg);
+	updateMsg.msgBase.domainType = RSSL_DMT_MARKET_PRICE;
+	updateMsg.msgBase.containerType = RSSL_DT_FIELD_LIST;
+
+	rsslClearFieldList(&fList);
+	fList.flags = RSSL_FLF_HAS_STANDARD_DATA;
+
+	if (withLatency)
+	{
+		planFields[fieldCount].fieldId = TIM_TRK_1_FID;
+		planFields[fieldCount].dataType = RSSL_DT_UINT;
+		planFields[fieldCount].flags = RSSL_EPFF_NONE;
+		++fieldCount;
+	}
+
+	rsslClearEncodePlan(pPlan);
+	return rsslBuildEncodePlan(pPlan, (RsslMsg*)&updateMsg, &fList, planFields, fieldCount);
+}
+
+RsslRet marketPriceUpdatePlansInit()
+{
+	RsslEncodePlanField planFields[MAX_PLAN_FIELDS];
+	RsslInt32 i, j;
+	RsslRet ret;
+
+	updatePlans = (MarketPriceUpdatePlan*)calloc(xmlMarketPriceMsgs.updateMsgCount, sizeof(MarketPriceUpdatePlan));
+	if (!updatePlans)
+		return RSSL_RET_FAILURE;
+
+	for(i = 0; i < xmlMarketPriceMsgs.updateMsgCount; ++i)
+	{
+		MarketPriceMsg *mpMsg = &xmlMarketPriceMsgs.updateMsgs[i];
+		MarketPriceUpdatePlan *pUpdatePlan = &updatePlans[i];
+
+		if (mpMsg->fieldEntriesCount >= MAX_PLAN_FIELDS)
+		{
+			printf("Update message %d has too many fields for an encode plan (%d, max %d).\n", i,
+					mpMsg->fieldEntriesCount, MAX_PLAN_FIELDS - 1);
+			return RSSL_RET_FAILURE;
+		}
+
+		pUpdatePlan->values = (const void**)malloc((mpMsg->fieldEntriesCount + 1) * sizeof(void*));
+		if (!pUpdatePlan->values)
+			return RSSL_RET_FAILURE;
+
+		for(j = 0; j < mpMsg->fieldEntriesCount; ++j)
+		{
+			planFields[j].fieldId = mpMsg->fieldEntries[j].fieldEntry.fieldId;
+			planFields[j].dataType = mpMsg->fieldEntries[j].fieldEntry.dataType;
+			planFields[j].flags = RSSL_EPFF_NONE;
+			pUpdatePlan->values[j] = (!mpMsg->fieldEntries[j].isBlank) ? &mpMsg->fieldEntries[j].primitive : NULL;
+		}
+
+		if ((ret = buildMarketPriceUpdatePlan(&pUpdatePlan->plan, mpMsg, planFields, RSSL_FALSE)) < RSSL_RET_SUCCESS
+				|| (ret = buildMarketPriceUpdatePlan(&pUpdatePlan->latencyPlan, mpMsg, planFields, RSSL_TRUE)) < RSSL_RET_SUCCESS)
+		{
+			printf("Building encode plan for update message %d failed: %s\n", i, rsslRetCodeToString(ret));
+			return ret;
+		}
+	}
+
+	return RSSL_RET_SUCCESS;
+}
+
+void marketPriceUpdatePlansCleanup()
+{
+	RsslInt32 i;
+
+	if (!updatePlans)
+		return;
+
+	for(i = 0; i < xmlMarketPriceMsgs.updateMsgCount; ++i)
+	{
+		rsslDeleteEncodePlan(&updatePlans[i].plan);
+		rsslDeleteEncodePlan(&updatePlans[i].latencyPlan);
+		free((void*)updatePlans[i].values);
+	}
+
+	free(updatePlans);
+	updatePlans = NULL;
+}
+
+RsslBool canEncodeMarketPriceUpdateWithPlan(RsslChannel *chnl)
+{
+	return (updatePlans && updatePlans[0].plan.majorVersion == chnl->majorVersion
+			&& updatePlans[0].plan.minorVersion == chnl->minorVersion) ? RSSL_TRUE : RSSL_FALSE;
+}
+
+RsslRet encodeMarketPriceUpdateWithPlan(MarketPriceItem *mpItem, RsslBuffer *msgBuf, 
+		RsslInt32 streamId, RsslUInt encodeStartTime)
+{
+	MarketPriceUpdatePlan *pUpdatePlan = &updatePlans[mpItem->iMsg];
+	const void *latencyValues[MAX_PLAN_FIELDS];
+	RsslInt32 fieldCount;
+
+	if (++mpItem->iMsg == xmlMarketPriceMsgs.updateMsgCount) mpItem->iMsg = 0;
+
+	if (!encodeStartTime)
+		return rsslEncodeWithPlan(&pUpdatePlan->plan, msgBuf, streamId, pUpdatePlan->values);
+
+	/* The values are shared by all threads, so add the latency timestamp to a copy. */
+	fieldCount = pUpdatePlan->plan.fieldCount;
+	memcpy((void*)latencyValues, (void*)pUpdatePlan->values, fieldCount * sizeof(void*));
+	latencyValues[fieldCount] = &encodeStartTime;
+	return rsslEncodeWithPlan(&pUpdatePlan->latencyPlan, msgBuf, streamId, latencyValues);
+}
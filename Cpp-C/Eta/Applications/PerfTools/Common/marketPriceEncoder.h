@@ -70,6 +70,20 @@ MarketPriceMsg *getNextMarketPriceGenMsg(MarketPriceItem *mpItem);
 /* Get the total number of sample generic msg payloads available from the message file. */
 RsslInt32 getMarketPriceGenMsgCount();
 
+/* Builds an encode plan for each sample update payload, one without and one with the latency field.
+ * Call after the message file is loaded. */
+RsslRet marketPriceUpdatePlansInit();
+
+/* Frees the update encode plans. */
+void marketPriceUpdatePlansCleanup();
+
+/* Whether the update encode plans can encode messages for the channel's RWF version. */
+RsslBool canEncodeMarketPriceUpdateWithPlan(RsslChannel *chnl);
+
+/* Encodes the next MarketPrice update(moves over the list) with its encode plan. */
+RsslRet encodeMarketPriceUpdateWithPlan(MarketPriceItem *mpItem, RsslBuffer *msgBuf, 
+		RsslInt32 streamId, RsslUInt encodeStartTime);
+
 #ifdef __cplusplus
 };
 #endif
@@ -52,6 +52,7 @@ void clearProviderThreadConfig()
 	providerThreadConfig.logLatencyToFile = RSSL_FALSE;
 
 	providerThreadConfig.preEncItems = RSSL_FALSE;
+	providerThreadConfig.useEncodePlans = RSSL_FALSE;
 	providerThreadConfig.takeMCastStats = RSSL_FALSE;
 	providerThreadConfig.nanoTime = RSSL_FALSE;
 	providerThreadConfig.measureEncode = RSSL_FALSE;
@@ -170,6 +171,13 @@ void providerThreadConfigInit()
 	if (xmlMsgDataInit(providerThreadConfig.msgFilename) != RSSL_RET_SUCCESS)
 		exit(-1);
 
+	if (providerThreadConfig.useEncodePlans && xmlMsgDataHasMarketPrice
+			&& marketPriceUpdatePlansInit() != RSSL_RET_SUCCESS)
+	{
+		printf("Failed to build MarketPrice update encode plans.\n");
+		exit(-1);
+	}
+
 	directoryServiceInit();
 }
 
@@ -309,6 +317,7 @@ void providerThreadConfigCleanup()
 {
 	cleanupLatencyRandomArray(&providerThreadConfig._latencyUpdateRandomArray);
 	cleanupLatencyRandomArray(&providerThreadConfig._latencyGenMsgRandomArray);
+	marketPriceUpdatePlansCleanup();
 	xmlMsgDataCleanup();
 }
 
@@ -856,7 +865,17 @@ RsslRet sendUpdateBurst(ProviderThread *pProvThread, ProviderSession *pSession)
 		if (providerThreadConfig.measureEncode)
 			measureEncodeStartTime = rsslGetTimeNano();
 
-		if (!providerThreadConfig.preEncItems || latencyStartTime /* Latency item should always be fully encoded so we can send proper time information */)
+		if (providerThreadConfig.useEncodePlans && (!providerThreadConfig.preEncItems || latencyStartTime)
+				&& nextItem->attributes.domainType == RSSL_DMT_MARKET_PRICE
+				&& canEncodeMarketPriceUpdateWithPlan(pSession->pChannelInfo->pChannel))
+		{
+			/* Encode the update with the plan built for its payload at startup. */
+			if (pSession->pWritingBuffer && 
+				(ret = encodeMarketPriceUpdateWithPlan((MarketPriceItem*)nextItem->itemData, pSession->pWritingBuffer,
+					nextItem->StreamId, latencyStartTime)) < RSSL_RET_SUCCESS)
+				return ret;
+		}
+		else if (!providerThreadConfig.preEncItems || latencyStartTime /* Latency item should always be fully encoded so we can send proper time information */)
 		{
 			if (pSession->pWritingBuffer && 
 				(ret = encodeItemUpdate(pSession->pChannelInfo->pChannel, nextItem, pSession->pWritingBuffer, NULL, latencyStartTime) < RSSL_RET_SUCCESS))
@@ -71,6 +71,7 @@ typedef struct
 		_latencyGenMsgRandomArray;				/* Determines when to send latency gen msgs. */
 
 	RsslBool	preEncItems;				/* Whether to use pre-encoded data rather than fully encoding. */
+	RsslBool	useEncodePlans;				/* Whether to encode MarketPrice updates with precompiled encode plans (-encodePlan). */
 	RsslBool	takeMCastStats;				/* Running a multicast connection and we want stats. */
 	RsslBool	nanoTime;   				/* Configures timestamp format. */
 	RsslBool	measureEncode;				/* Measure time to encode messages(-measureEncode) */
@@ -0,0 +1,179 @@
+/*
+ * This source code is provided under the Apache 2.0 license and is provided
+ * AS IS with no warranty or guarantee of fit for purpose.  See the project's
+ * LICENSE.md for details.
+ * Copyright (C) 2022 Refinitiv. All rights reserved.
+*/
+
+/* MicroPerf.c
+ * Runs micro-benchmarks of individual library hot paths. Unlike the other
+ * performance tools, no connections to other applications are made. */
+
+#include "microPerf.h"
+#include "rtr/rsslTransport.h"
+#include <math.h>
+
+static MicroPerfSuite suites[] =
+{
+	{ "notifier", "RsslNotifier wait cost with one ready channel out of 10/100/1k/5k, for each notification mechanism.", notifierPerfRun },
+	{ "wsmask", "WebSocket payload masking of 64B/1KB/64KB payloads with each kernel, in place and fused with the reassembly copy.", wsMaskPerfRun },
+	{ "hash", "Hash functions of the watchlist tables on 8B-128B keys, and item opens into tables of 100k/1M items.", hashPerfRun },
+	{ "fieldlist", "Decoding 3/10/50 fields of a 200-entry field list by walking it in order, and by indexing it and looking them up.", fieldListPerfRun },
+	{ "json", "Conversion of MarketPrice and MarketByOrder updates, and a mix of both, from RWF to simplified JSON, and of JSON arrays of 1, 100 and 10,000 updates back to RWF.", jsonPerfRun },
+	{ "codec", "Message, field list and element list encoding and decoding, reals, ISO 8601 date/time strings, RMTES to UTF-8, dictionary loading, and decoding of a synthetic or captured corpus of messages.", codecPerfRun },
+	{ "eventqueue", "Reactor event queues: event round trip between two threads, put and get on one thread, and 4 threads putting into one group.", eventQueuePerfRun },
+	{ "fanout", "Watchlist fan-out of an update to 1, 10 and 100 requests on the same stream, sharing the message and with distinct buffers.", fanoutPerfRun },
+	{ "reactor", "rsslReactorDispatch on 10/100/2000 mostly idle channels, with no channel ready and with one channel ready.", reactorPerfRun }
+};
+
+static const int suiteCount = sizeof(suites)/sizeof(MicroPerfSuite);
+
+/* File that results are also written to as CSV, or NULL. */
+static FILE *csvFile = NULL;
+
+/* Allocation count at the start of the current case. */
+static RsslUInt64 caseStartAllocCount = 0;
+
+static void printUsageAndExit(char *appName)
+{
+	int i;
+
+	printf("Usage: %s or\n%s [-suite <name>] [-iterations <count>] [-warmup <count>] [-csv <file>] [-corpus <file>]\n"
+			" -suite <name>           Runs only the named suite. May be specified more than once. By default, all suites are run.\n"
+			" -iterations <count>     Number of timed iterations per case. By default, each suite uses its own count.\n"
+			" -warmup <count>         Number of untimed iterations run before each case.\n"
+			" -csv <file>             Also writes the results to the file as comma-separated values, one line per case.\n"
+			" -corpus <file>          File of captured messages decoded by the codec suite. Each message is preceded by its length, as a 4-byte big-endian integer.\n"
+			"\n"
+			"Suites:\n", appName, appName);
+
+	for (i = 0; i < suiteCount; ++i)
+		printf(" %-22s  %s\n", suites[i].name, suites[i].description);
+
+	exit(-1);
+}
+
+void microPerfStartCase()
+{
+	caseStartAllocCount = microPerfAllocCount();
+}
+
+void microPerfPrintResult(const char *suiteName, const char *caseName, RsslUInt64 operations, RsslTimeValue elapsedNsec)
+{
+	double nsecPerOp = operations ? (double)elapsedNsec / (double)operations : 0.0;
+	double opsPerSec = elapsedNsec ? (double)operations * 1000000000.0 / (double)elapsedNsec : 0.0;
+	double allocsPerOp = operations ? (double)(microPerfAllocCount() - caseStartAllocCount) / (double)operations : 0.0;
+
+	if (microPerfAllocCountAvailable())
+		printf("%-12s %-40s %12llu ops %12.1f ns/op %14.0f ops/sec %8.2f allocs/op\n", suiteName, caseName, operations,
+				nsecPerOp, opsPerSec, allocsPerOp);
+	else
+		printf("%-12s %-40s %12llu ops %12.1f ns/op %14.0f ops/sec\n", suiteName, caseName, operations,
+				nsecPerOp, opsPerSec);
+
+	if (csvFile)
+	{
+		fprintf(csvFile, "%s,%s,%llu,%.1f,%.0f,", suiteName, caseName, operations, nsecPerOp, opsPerSec);
+		if (microPerfAllocCountAvailable())
+			fprintf(csvFile, "%.2f", allocsPerOp);
+		fprintf(csvFile, ",,,,\n");
+		fflush(csvFile);
+	}
+}
+
+void microPerfPrintStats(const char *suiteName, const char *caseName, ValueStatistics *pStats)
+{
+	printf("%-12s %-40s Avg:%10.3f StdDev:%10.3f Max:%10.3f Min:%10.3f usec, Samples: %llu\n", suiteName, caseName,
+			pStats->average, sqrt(pStats->variance), pStats->maxValue, pStats->minValue, pStats->count);
+
+	if (csvFile)
+	{
+		fprintf(csvFile, "%s,%s,%llu,,,,%.3f,%.3f,%.3f,%.3f\n", suiteName, caseName, pStats->count,
+				pStats->average, sqrt(pStats->variance), pStats->maxValue, pStats->minValue);
+		fflush(csvFile);
+	}
+}
+
+int main(int argc, char **argv)
+{
+	MicroPerfConfig config;
+	char *selectedSuites[32];
+	int selectedSuiteCount = 0;
+	char *csvFileName = NULL;
+	RsslError error;
+	int i, j;
+
+	config.iterations = 0;
+	config.warmupIterations = 1000;
+	config.corpusFile = NULL;
+
+	for (i = 1; i < argc; ++i)
+	{
+		if (strcmp("-suite", argv[i]) == 0 && i + 1 < argc)
+		{
+			if (selectedSuiteCount == sizeof(selectedSuites)/sizeof(char*))
+				printUsageAndExit(argv[0]);
+			selectedSuites[selectedSuiteCount++] = argv[++i];
+		}
+		else if (strcmp("-iterations", argv[i]) == 0 && i + 1 < argc)
+			config.iterations = (RsslUInt32)atoi(argv[++i]);
+		else if (strcmp("-warmup", argv[i]) == 0 && i + 1 < argc)
+			config.warmupIterations = (RsslUInt32)atoi(argv[++i]);
+		else if (strcmp("-csv", argv[i]) == 0 && i + 1 < argc)
+			csvFileName = argv[++i];
+		else if (strcmp("-corpus", argv[i]) == 0 && i + 1 < argc)
+			config.corpusFile = argv[++i];
+		else
+			printUsageAndExit(argv[0]);
+	}
+
+	for (i = 0; i < selectedSuiteCount; ++i)
+	{
+		for (j = 0; j < suiteCount; ++j)
+			if (strcmp(selectedSuites[i], suites[j].name) == 0)
+				break;
+
+		if (j == suiteCount)
+		{
+			printf("Unknown suite: %s\n\n", selectedSuites[i]);
+			printUsageAndExit(argv[0]);
+		}
+	}
+
+	if (csvFileName)
+	{
+		if ((csvFile = fopen(csvFileName, "w")) == NULL)
+		{
+			printf("Could not open CSV file %s.\n", csvFileName);
+			exit(-1);
+		}
+
+		fprintf(csvFile, "suite,case,operations,ns_per_op,ops_per_sec,allocs_per_op,avg_usec,stddev_usec,max_usec,min_usec\n");
+	}
+
+	/* The reactor suite needs global locking, as the reactor uses the transport from its worker thread. */
+	if (rsslInitialize(RSSL_LOCK_GLOBAL_AND_CHANNEL, &error) != RSSL_RET_SUCCESS)
+	{
+		printf("rsslInitialize() failed: %s\n", error.text);
+		exit(-1);
+	}
+
+	for (j = 0; j < suiteCount; ++j)
+	{
+		RsslBool runSuite = (selectedSuiteCount == 0) ? RSSL_TRUE : RSSL_FALSE;
+
+		for (i = 0; i < selectedSuiteCount; ++i)
+			if (strcmp(selectedSuites[i], suites[j].name) == 0)
+				runSuite = RSSL_TRUE;
+
+		if (runSuite)
+			suites[j].runSuite(&config);
+	}
+
+	rsslUninitialize();
+
+	if (csvFile)
+		fclose(csvFile);
+
+	return 0;
+}
@@ -0,0 +1,1007 @@
+/*
+ * This source code is provided under the Apache 2.0 license and is provided
+ * AS IS with no warranty or guarantee of fit for purpose.  See the project's
+ * LICENSE.md for details.
+ * Copyright (C) 2022 Refinitiv. All rights reserved.
+*/
+
+/* codecPerf.c
+ * Measures the codec hot paths one at a time: message, field list and element list
+ * encoding and decoding, reals, date/time string conversion, RMTES to UTF-8 and
+ * dictionary loading. Message decoding is also measured over a corpus of messages:
+ * a synthetic one generated from a fixed seed, and optionally one read from a file
+ * of captured messages (see -corpus). */
+
+#include "microPerf.h"
+#include "rtr/rsslDataPackage.h"
+#include "rtr/rsslMessagePackage.h"
+#include "rtr/rsslRmtes.h"
+
+#define CODEC_PERF_FIELD_DICTIONARY_FILE "RDMFieldDictionary"
+#define CODEC_PERF_ENUM_DICTIONARY_FILE "enumtype.def"
+#define CODEC_PERF_SNAPSHOT_FILE "MicroPerf.dictionary.snap"
+
+/* Number of entries in the field and element lists of the single-message cases. */
+#define CODEC_PERF_ENTRIES 10
+
+#define CODEC_PERF_MSG_SIZE 4096
+
+/* Messages in the synthetic corpus, and the seed they are generated from. */
+#define CODEC_PERF_CORPUS_MSGS 1000
+#define CODEC_PERF_CORPUS_SEED 20221017
+
+/* Largest captured corpus that is loaded. */
+#define CODEC_PERF_MAX_CORPUS_SIZE (256 * 1024 * 1024)
+
+/* Field types cycle with the field ID, so lists can be decoded without a dictionary. */
+#define CODEC_PERF_FIELD_TYPE(fid) (codecPerfFieldTypes[(fid) % 4])
+
+static const RsslDataType codecPerfFieldTypes[] = { RSSL_DT_REAL, RSSL_DT_UINT, RSSL_DT_TIME, RSSL_DT_ASCII_STRING };
+
+static RsslBuffer codecPerfElementNames[CODEC_PERF_ENTRIES] =
+{
+	{ 3, (char*)"Bid" }, { 3, (char*)"Ask" }, { 7, (char*)"BidSize" }, { 7, (char*)"AskSize" },
+	{ 5, (char*)"Trade" }, { 6, (char*)"Volume" }, { 4, (char*)"High" }, { 3, (char*)"Low" },
+	{ 4, (char*)"Open" }, { 5, (char*)"Close" }
+};
+
+static RsslBuffer codecPerfText = { 11, (char*)"TRI.N Index" };
+
+/* Keeps the compiler from optimizing away the encoded and decoded values. */
+static volatile RsslUInt64 codecSink;
+
+/* A set of encoded messages. */
+typedef struct {
+	const char	*name;
+	RsslBuffer	*msgs;
+	RsslUInt32	msgCount;
+	char		*data;
+} CodecPerfCorpus;
+
+/* Generates the same sequence on every run, so the synthetic corpus is reproducible. */
+static RsslUInt32 codecPerfRandom(RsslUInt32 *pSeed)
+{
+	*pSeed = *pSeed * 1103515245 + 12345;
+	return (*pSeed >> 16) & 0x7fff;
+}
+
+static RsslRet codecPerfEncodeFieldList(RsslEncodeIterator *pIter, RsslUInt32 fieldCount, RsslUInt32 seed)
+{
+	RsslFieldList fieldList;
+	RsslFieldEntry fieldEntry;
+	RsslReal real;
+	RsslUInt uintValue;
+	RsslTime time;
+	RsslUInt32 i;
+	RsslRet ret;
+
+	rsslClearFieldList(&fieldList);
+	fieldList.flags = RSSL_FLF_HAS_STANDARD_DATA;
+	if ((ret = rsslEncodeFieldListInit(pIter, &fieldList, NULL, 0)) < RSSL_RET_SUCCESS)
+		return ret;
+
+	for (i = 0; i < fieldCount; ++i)
+	{
+		rsslClearFieldEntry(&fieldEntry);
+		fieldEntry.fieldId = (RsslFieldId)(1 + i * 5);
+		fieldEntry.dataType = CODEC_PERF_FIELD_TYPE(fieldEntry.fieldId);
+
+		switch (fieldEntry.dataType)
+		{
+			case RSSL_DT_REAL:
+				rsslClearReal(&real);
+				real.hint = RSSL_RH_EXPONENT_2;
+				real.value = 3995 + seed + i;
+				ret = rsslEncodeFieldEntry(pIter, &fieldEntry, &real);
+				break;
+			case RSSL_DT_UINT:
+				uintValue = 1000 * (seed + i);
+				ret = rsslEncodeFieldEntry(pIter, &fieldEntry, &uintValue);
+				break;
+			case RSSL_DT_TIME:
+				rsslClearTime(&time);
+				time.hour = 14;
+				time.minute = 30;
+				time.second = (RsslUInt8)((seed + i) % 60);
+				time.millisecond = 125;
+				ret = rsslEncodeFieldEntry(pIter, &fieldEntry, &time);
+				break;
+			default:
+				ret = rsslEncodeFieldEntry(pIter, &fieldEntry, &codecPerfText);
+				break;
+		}
+
+		if (ret < RSSL_RET_SUCCESS)
+			return ret;
+	}
+
+	return rsslEncodeFieldListComplete(pIter, RSSL_TRUE);
+}
+
+static RsslRet codecPerfEncodeElementList(RsslEncodeIterator *pIter, RsslUInt32 seed)
+{
+	RsslElementList elementList;
+	RsslElementEntry elementEntry;
+	RsslReal real;
+	RsslUInt32 i;
+	RsslRet ret;
+
+	rsslClearElementList(&elementList);
+	elementList.flags = RSSL_ELF_HAS_STANDARD_DATA;
+	if ((ret = rsslEncodeElementListInit(pIter, &elementList, NULL, 0)) < RSSL_RET_SUCCESS)
+		return ret;
+
+	for (i = 0; i < CODEC_PERF_ENTRIES; ++i)
+	{
+		rsslClearElementEntry(&elementEntry);
+		elementEntry.name = codecPerfElementNames[i];
+		elementEntry.dataType = RSSL_DT_REAL;
+		rsslClearReal(&real);
+		real.hint = RSSL_RH_EXPONENT_2;
+		real.value = 3995 + seed + i;
+		if ((ret = rsslEncodeElementEntry(pIter, &elementEntry, &real)) < RSSL_RET_SUCCESS)
+			return ret;
+	}
+
+	return rsslEncodeElementListComplete(pIter, RSSL_TRUE);
+}
+
+/* Encodes a MarketPrice update or refresh with a field list payload. */
+static RsslRet codecPerfEncodeMsg(RsslBuffer *pBuffer, RsslUInt8 msgClass, RsslUInt32 fieldCount, RsslUInt32 seed)
+{
+	RsslEncodeIterator encIter;
+	RsslMsg msg;
+	RsslRet ret;
+
+	rsslClearEncodeIterator(&encIter);
+	rsslSetEncodeIteratorBuffer(&encIter, pBuffer);
+	rsslSetEncodeIteratorRWFVersion(&encIter, RSSL_RWF_MAJOR_VERSION, RSSL_RWF_MINOR_VERSION);
+
+	if (msgClass == RSSL_MC_REFRESH)
+	{
+		rsslClearRefreshMsg(&msg.refreshMsg);
+		msg.refreshMsg.flags = RSSL_RFMF_HAS_MSG_KEY | RSSL_RFMF_REFRESH_COMPLETE | RSSL_RFMF_SOLICITED | RSSL_RFMF_CLEAR_CACHE;
+		msg.refreshMsg.state.streamState = RSSL_STREAM_OPEN;
+		msg.refreshMsg.state.dataState = RSSL_DATA_OK;
+		msg.msgBase.msgKey.flags = RSSL_MKF_HAS_NAME | RSSL_MKF_HAS_SERVICE_ID;
+		msg.msgBase.msgKey.name = codecPerfText;
+		msg.msgBase.msgKey.serviceId = 1;
+	}
+	else
+	{
+		rsslClearUpdateMsg(&msg.updateMsg);
+		msg.updateMsg.updateType = RDM_UPD_EVENT_TYPE_QUOTE;
+	}
+
+	msg.msgBase.streamId = 5 + seed;
+	msg.msgBase.domainType = RSSL_DMT_MARKET_PRICE;
+	msg.msgBase.containerType = RSSL_DT_FIELD_LIST;
+
+	if ((ret = rsslEncodeMsgInit(&encIter, &msg, 0)) < RSSL_RET_SUCCESS)
+		return ret;
+
+	if ((ret = codecPerfEncodeFieldList(&encIter, fieldCount, seed)) < RSSL_RET_SUCCESS)
+		return ret;
+
+	if ((ret = rsslEncodeMsgComplete(&encIter, RSSL_TRUE)) < RSSL_RET_SUCCESS)
+		return ret;
+
+	pBuffer->length = rsslGetEncodedBufferLength(&encIter);
+	return RSSL_RET_SUCCESS;
+}
+
+/* Encodes an update with the payload already encoded, as a provider fanning out the same data does. */
+static RsslRet codecPerfEncodePreencodedMsg(RsslBuffer *pBuffer, RsslBuffer *pPayload)
+{
+	RsslEncodeIterator encIter;
+	RsslUpdateMsg updateMsg;
+	RsslRet ret;
+
+	rsslClearEncodeIterator(&encIter);
+	rsslSetEncodeIteratorBuffer(&encIter, pBuffer);
+	rsslSetEncodeIteratorRWFVersion(&encIter, RSSL_RWF_MAJOR_VERSION, RSSL_RWF_MINOR_VERSION);
+
+	rsslClearUpdateMsg(&updateMsg);
+	updateMsg.msgBase.streamId = 5;
+	updateMsg.msgBase.domainType = RSSL_DMT_MARKET_PRICE;
+	updateMsg.msgBase.containerType = RSSL_DT_FIELD_LIST;
+	updateMsg.msgBase.encDataBody = *pPayload;
+	updateMsg.updateType = RDM_UPD_EVENT_TYPE_QUOTE;
+
+	if ((ret = rsslEncodeMsg(&encIter, (RsslMsg*)&updateMsg)) < RSSL_RET_SUCCESS)
+		return ret;
+
+	pBuffer->length = rsslGetEncodedBufferLength(&encIter);
+	return RSSL_RET_SUCCESS;
+}
+
+/* Decodes each field and its value. */
+static RsslUInt64 codecPerfDecodeFieldList(RsslDecodeIterator *pIter)
+{
+	RsslFieldList fieldList;
+	RsslFieldEntry fieldEntry;
+	RsslReal real;
+	RsslUInt uintValue;
+	RsslTime time;
+	RsslBuffer text;
+	RsslUInt64 sum = 0;
+
+	if (rsslDecodeFieldList(pIter, &fieldList, NULL) != RSSL_RET_SUCCESS)
+		return 0;
+
+	while (rsslDecodeFieldEntry(pIter, &fieldEntry) == RSSL_RET_SUCCESS)
+	{
+		switch (CODEC_PERF_FIELD_TYPE(fieldEntry.fieldId))
+		{
+			case RSSL_DT_REAL:
+				if (rsslDecodeReal(pIter, &real) == RSSL_RET_SUCCESS)
+					sum += (RsslUInt64)real.value;
+				break;
+			case RSSL_DT_UINT:
+				if (rsslDecodeUInt(pIter, &uintValue) == RSSL_RET_SUCCESS)
+					sum += uintValue;
+				break;
+			case RSSL_DT_TIME:
+				if (rsslDecodeTime(pIter, &time) == RSSL_RET_SUCCESS)
+					sum += time.second;
+				break;
+			default:
+				if (rsslDecodeBuffer(pIter, &text) == RSSL_RET_SUCCESS)
+					sum += text.length;
+				break;
+		}
+	}
+
+	return sum;
+}
+
+static RsslUInt64 codecPerfDecodeElementList(RsslDecodeIterator *pIter)
+{
+	RsslElementList elementList;
+	RsslElementEntry elementEntry;
+	RsslReal real;
+	RsslUInt64 sum = 0;
+
+	if (rsslDecodeElementList(pIter, &elementList, NULL) != RSSL_RET_SUCCESS)
+		return 0;
+
+	while (rsslDecodeElementEntry(pIter, &elementEntry) == RSSL_RET_SUCCESS)
+	{
+		if (elementEntry.dataType == RSSL_DT_REAL && rsslDecodeReal(pIter, &real) == RSSL_RET_SUCCESS)
+			sum += (RsslUInt64)real.value + elementEntry.name.length;
+	}
+
+	return sum;
+}
+
+/* Decodes the entries of a container, without their primitive values, since captured
+ * messages may have been encoded with any dictionary. Maps, series and vectors are
+ * decoded down to the entries of their field and element lists. */
+static RsslUInt64 codecPerfDecodeEntries(RsslDecodeIterator *pIter, RsslContainerType containerType)
+{
+	RsslUInt64 sum = 0;
+
+	switch (containerType)
+	{
+		case RSSL_DT_FIELD_LIST:
+		{
+			RsslFieldList fieldList;
+			RsslFieldEntry fieldEntry;
+
+			if (rsslDecodeFieldList(pIter, &fieldList, NULL) != RSSL_RET_SUCCESS)
+				return 0;
+			while (rsslDecodeFieldEntry(pIter, &fieldEntry) == RSSL_RET_SUCCESS)
+				sum += fieldEntry.encData.length;
+			break;
+		}
+		case RSSL_DT_ELEMENT_LIST:
+		{
+			RsslElementList elementList;
+			RsslElementEntry elementEntry;
+
+			if (rsslDecodeElementList(pIter, &elementList, NULL) != RSSL_RET_SUCCESS)
+				return 0;
+			while (rsslDecodeElementEntry(pIter, &elementEntry) == RSSL_RET_SUCCESS)
+				sum += elementEntry.encData.length;
+			break;
+		}
+		case RSSL_DT_MAP:
+		{
+			RsslMap map;
+			RsslMapEntry mapEntry;
+
+			if (rsslDecodeMap(pIter, &map) != RSSL_RET_SUCCESS)
+				return 0;
+			while (rsslDecodeMapEntry(pIter, &mapEntry, NULL) == RSSL_RET_SUCCESS)
+			{
+				sum += mapEntry.encKey.length;
+				if (mapEntry.action != RSSL_MPEA_DELETE_ENTRY)
+					sum += codecPerfDecodeEntries(pIter, map.containerType);
+			}
+			break;
+		}
+		case RSSL_DT_SERIES:
+		{
+			RsslSeries series;
+			RsslSeriesEntry seriesEntry;
+
+			if (rsslDecodeSeries(pIter, &series) != RSSL_RET_SUCCESS)
+				return 0;
+			while (rsslDecodeSeriesEntry(pIter, &seriesEntry) == RSSL_RET_SUCCESS)
+				sum += codecPerfDecodeEntries(pIter, series.containerType);
+			break;
+		}
+		case RSSL_DT_VECTOR:
+		{
+			RsslVector vector;
+			RsslVectorEntry vectorEntry;
+
+			if (rsslDecodeVector(pIter, &vector) != RSSL_RET_SUCCESS)
+				return 0;
+			while (rsslDecodeVectorEntry(pIter, &vectorEntry) == RSSL_RET_SUCCESS)
+			{
+				if (vectorEntry.action != RSSL_VTEA_DELETE_ENTRY && vectorEntry.action != RSSL_VTEA_CLEAR_ENTRY)
+					sum += codecPerfDecodeEntries(pIter, vector.containerType);
+			}
+			break;
+		}
+		default:
+			break;
+	}
+
+	return sum;
+}
+
+static RsslUInt64 codecPerfDecodeMsg(RsslBuffer *pBuffer, RsslBool decodeEntries)
+{
+	RsslDecodeIterator decIter;
+	RsslMsg msg;
+
+	rsslClearDecodeIterator(&decIter);
+	rsslSetDecodeIteratorBuffer(&decIter, pBuffer);
+	rsslSetDecodeIteratorRWFVersion(&decIter, RSSL_RWF_MAJOR_VERSION, RSSL_RWF_MINOR_VERSION);
+
+	if (rsslDecodeMsg(&decIter, &msg) != RSSL_RET_SUCCESS)
+		return 0;
+
+	if (!decodeEntries)
+		return msg.msgBase.streamId + msg.msgBase.encDataBody.length;
+
+	return msg.msgBase.streamId + codecPerfDecodeEntries(&decIter, msg.msgBase.containerType);
+}
+
+static void codecPerfRunMsgCases(MicroPerfConfig *pConfig)
+{
+	RsslUInt32 iterations = microPerfIterations(pConfig, 1000000);
+	RsslTimeValue startTime, endTime;
+	char msgData[CODEC_PERF_MSG_SIZE], payloadData[CODEC_PERF_MSG_SIZE];
+	RsslBuffer msgBuffer, payload;
+	RsslEncodeIterator encIter;
+	RsslDecodeIterator decIter;
+	RsslUInt64 sum = 0;
+	RsslUInt32 i;
+
+	/* Encode the whole message: header, field list and fields. */
+	for (i = 0; i < pConfig->warmupIterations; ++i)
+	{
+		msgBuffer.data = msgData;
+		msgBuffer.length = sizeof(msgData);
+		codecPerfEncodeMsg(&msgBuffer, RSSL_MC_UPDATE, CODEC_PERF_ENTRIES, i % 8);
+	}
+
+	microPerfStartCase();
+	startTime = rsslGetTimeNano();
+	for (i = 0; i < iterations; ++i)
+	{
+		msgBuffer.data = msgData;
+		msgBuffer.length = sizeof(msgData);
+		if (codecPerfEncodeMsg(&msgBuffer, RSSL_MC_UPDATE, CODEC_PERF_ENTRIES, i % 8) != RSSL_RET_SUCCESS)
+		{
+			printf("%-12s Failed to encode message.\n", "codec");
+			return;
+		}
+		sum += msgBuffer.length;
+	}
+	endTime = rsslGetTimeNano();
+	microPerfPrintResult("codec", "msg/encode/update-10-fields", iterations, endTime - startTime);
+
+	/* Encode only the header, around a payload that is already encoded. */
+	payload.data = payloadData;
+	payload.length = sizeof(payloadData);
+	rsslClearEncodeIterator(&encIter);
+	rsslSetEncodeIteratorBuffer(&encIter, &payload);
+	rsslSetEncodeIteratorRWFVersion(&encIter, RSSL_RWF_MAJOR_VERSION, RSSL_RWF_MINOR_VERSION);
+	if (codecPerfEncodeFieldList(&encIter, CODEC_PERF_ENTRIES, 0) != RSSL_RET_SUCCESS)
+	{
+		printf("%-12s Failed to encode field list.\n", "codec");
+		return;
+	}
+	payload.length = rsslGetEncodedBufferLength(&encIter);
+
+	microPerfStartCase();
+	startTime = rsslGetTimeNano();
+	for (i = 0; i < iterations; ++i)
+	{
+		msgBuffer.data = msgData;
+		msgBuffer.length = sizeof(msgData);
+		codecPerfEncodePreencodedMsg(&msgBuffer, &payload);
+		sum += msgBuffer.length;
+	}
+	endTime = rsslGetTimeNano();
+	microPerfPrintResult("codec", "msg/encode-preencoded/update-10-fields", iterations, endTime - startTime);
+
+	/* Decode the message header. */
+	msgBuffer.data = msgData;
+	msgBuffer.length = sizeof(msgData);
+	codecPerfEncodeMsg(&msgBuffer, RSSL_MC_UPDATE, CODEC_PERF_ENTRIES, 0);
+
+	microPerfStartCase();
+	startTime = rsslGetTimeNano();
+	for (i = 0; i < iterations; ++i)
+		sum += codecPerfDecodeMsg(&msgBuffer, RSSL_FALSE);
+	endTime = rsslGetTimeNano();
+	microPerfPrintResult("codec", "msg/decode/update-10-fields", iterations, endTime - startTime);
+
+	/* Encode and decode the field list alone. */
+	microPerfStartCase();
+	startTime = rsslGetTimeNano();
+	for (i = 0; i < iterations; ++i)
+	{
+		payload.data = payloadData;
+		payload.length = sizeof(payloadData);
+		rsslClearEncodeIterator(&encIter);
+		rsslSetEncodeIteratorBuffer(&encIter, &payload);
+		rsslSetEncodeIteratorRWFVersion(&encIter, RSSL_RWF_MAJOR_VERSION, RSSL_RWF_MINOR_VERSION);
+		codecPerfEncodeFieldList(&encIter, CODEC_PERF_ENTRIES, i % 8);
+		sum += rsslGetEncodedBufferLength(&encIter);
+	}
+	endTime = rsslGetTimeNano();
+	microPerfPrintResult("codec", "fieldlist/encode/10-fields", iterations, endTime - startTime);
+	payload.length = rsslGetEncodedBufferLength(&encIter);
+
+	microPerfStartCase();
+	startTime = rsslGetTimeNano();
+	for (i = 0; i < iterations; ++i)
+	{
+		rsslClearDecodeIterator(&decIter);
+		rsslSetDecodeIteratorBuffer(&decIter, &payload);
+		rsslSetDecodeIteratorRWFVersion(&decIter, RSSL_RWF_MAJOR_VERSION, RSSL_RWF_MINOR_VERSION);
+		sum += codecPerfDecodeFieldList(&decIter);
+	}
+	endTime = rsslGetTimeNano();
+	microPerfPrintResult("codec", "fieldlist/decode/10-fields", iterations, endTime - startTime);
+
+	/* Encode and decode an element list. */
+	microPerfStartCase();
+	startTime = rsslGetTimeNano();
+	for (i = 0; i < iterations; ++i)
+	{
+		payload.data = payloadData;
+		payload.length = sizeof(payloadData);
+		rsslClearEncodeIterator(&encIter);
+		rsslSetEncodeIteratorBuffer(&encIter, &payload);
+		rsslSetEncodeIteratorRWFVersion(&encIter, RSSL_RWF_MAJOR_VERSION, RSSL_RWF_MINOR_VERSION);
+		codecPerfEncodeElementList(&encIter, i % 8);
+		sum += rsslGetEncodedBufferLength(&encIter);
+	}
+	endTime = rsslGetTimeNano();
+	microPerfPrintResult("codec", "elementlist/encode/10-elements", iterations, endTime - startTime);
+	payload.length = rsslGetEncodedBufferLength(&encIter);
+
+	microPerfStartCase();
+	startTime = rsslGetTimeNano();
+	for (i = 0; i < iterations; ++i)
+	{
+		rsslClearDecodeIterator(&decIter);
+		rsslSetDecodeIteratorBuffer(&decIter, &payload);
+		rsslSetDecodeIteratorRWFVersion(&decIter, RSSL_RWF_MAJOR_VERSION, RSSL_RWF_MINOR_VERSION);
+		sum += codecPerfDecodeElementList(&decIter);
+	}
+	endTime = rsslGetTimeNano();
+	microPerfPrintResult("codec", "elementlist/decode/10-elements", iterations, endTime - startTime);
+
+	codecSink = sum;
+}
+
+static void codecPerfRunPrimitiveCases(MicroPerfConfig *pConfig)
+{
+	RsslUInt32 iterations = microPerfIterations(pConfig, 1000000);
+	RsslTimeValue startTime, endTime;
+	char data[64];
+	RsslBuffer buffer;
+	RsslEncodeIterator encIter;
+	RsslDecodeIterator decIter;
+	RsslReal real;
+	RsslDouble doubleValue;
+	RsslUInt64 sum = 0;
+	RsslUInt32 i;
+
+	/* Reals are encoded and decoded as primitives on their own, as in a pre-encoded field entry. */
+	rsslClearReal(&real);
+	real.hint = RSSL_RH_EXPONENT_4;
+
+	microPerfStartCase();
+	startTime = rsslGetTimeNano();
+	for (i = 0; i < iterations; ++i)
+	{
+		buffer.data = data;
+		buffer.length = sizeof(data);
+		rsslClearEncodeIterator(&encIter);
+		rsslSetEncodeIteratorBuffer(&encIter, &buffer);
+		real.value = 399625 + (i & 0xff);
+		rsslEncodeReal(&encIter, &real);
+		sum += rsslGetEncodedBufferLength(&encIter);
+	}
+	endTime = rsslGetTimeNano();
+	microPerfPrintResult("codec", "real/encode", iterations, endTime - startTime);
+	buffer.length = rsslGetEncodedBufferLength(&encIter);
+
+	microPerfStartCase();
+	startTime = rsslGetTimeNano();
+	for (i = 0; i < iterations; ++i)
+	{
+		rsslClearDecodeIterator(&decIter);
+		rsslSetDecodeIteratorBuffer(&decIter, &buffer);
+		rsslDecodeReal(&decIter, &real);
+		sum += (RsslUInt64)real.value;
+	}
+	endTime = rsslGetTimeNano();
+	microPerfPrintResult("codec", "real/decode", iterations, endTime - startTime);
+
+	microPerfStartCase();
+	startTime = rsslGetTimeNano();
+	for (i = 0; i < iterations; ++i)
+	{
+		real.value = 399625 + (i & 0xff);
+		rsslRealToDouble(&doubleValue, &real);
+		sum += (RsslUInt64)doubleValue;
+	}
+	endTime = rsslGetTimeNano();
+	microPerfPrintResult("codec", "real/to-double", iterations, endTime - startTime);
+
+	codecSink = sum;
+}
+
+/* Tick time stamps, as ISO 8601 strings of each precision. */
+static const struct
+{
+	const char	*caseName;
+	RsslDataType	dataType;
+	const char	*isoString;
+} codecPerfTimeStamps[] =
+{
+	{ "datetime/%s-iso8601/ms", RSSL_DT_DATETIME, "2022-10-17T14:30:05.123" },
+	{ "datetime/%s-iso8601/us", RSSL_DT_DATETIME, "2022-10-17T14:30:05.123456" },
+	{ "datetime/%s-iso8601/ns", RSSL_DT_DATETIME, "2022-10-17T14:30:05.123456789" },
+	{ "time/%s-iso8601/ms", RSSL_DT_TIME, "14:30:05.123" }
+};
+
+/* Date and time conversion to and from ISO 8601 strings, as done by the JSON converter for
+ * each date and time field. */
+static void codecPerfRunDateTimeCases(MicroPerfConfig *pConfig)
+{
+	RsslUInt32 iterations = microPerfIterations(pConfig, 1000000);
+	RsslTimeValue startTime, endTime;
+	RsslDateTime dateTime;
+	char stringData[64];
+	RsslBuffer string;
+	RsslBuffer isoString;
+	char caseName[64];
+	RsslUInt64 sum = 0;
+	RsslUInt32 i, j;
+	RsslRet ret;
+
+	for (j = 0; j < sizeof(codecPerfTimeStamps) / sizeof(codecPerfTimeStamps[0]); ++j)
+	{
+		isoString.data = (char*)codecPerfTimeStamps[j].isoString;
+		isoString.length = (RsslUInt32)strlen(isoString.data);
+
+		rsslClearDateTime(&dateTime);
+		if (codecPerfTimeStamps[j].dataType == RSSL_DT_TIME)
+			ret = rsslTimeStringToTime(&dateTime.time, &isoString);
+		else
+			ret = rsslDateTimeStringToDateTime(&dateTime, &isoString);
+
+		if (ret != RSSL_RET_SUCCESS)
+		{
+			printf("%-12s Failed to convert date and time from string.\n", "codec");
+			return;
+		}
+
+		microPerfStartCase();
+		startTime = rsslGetTimeNano();
+		for (i = 0; i < iterations; ++i)
+		{
+			string.data = stringData;
+			string.length = sizeof(stringData);
+			dateTime.time.second = (RsslUInt8)(i % 60);
+			rsslDateTimeToStringFormat(&string, codecPerfTimeStamps[j].dataType, &dateTime, RSSL_STR_DATETIME_ISO8601);
+			sum += string.length;
+		}
+		endTime = rsslGetTimeNano();
+		snprintf(caseName, sizeof(caseName), codecPerfTimeStamps[j].caseName, "to-string");
+		microPerfPrintResult("codec", caseName, iterations, endTime - startTime);
+
+		microPerfStartCase();
+		startTime = rsslGetTimeNano();
+		if (codecPerfTimeStamps[j].dataType == RSSL_DT_TIME)
+		{
+			for (i = 0; i < iterations; ++i)
+			{
+				rsslTimeStringToTime(&dateTime.time, &isoString);
+				sum += dateTime.time.millisecond;
+			}
+		}
+		else
+		{
+			for (i = 0; i < iterations; ++i)
+			{
+				rsslDateTimeStringToDateTime(&dateTime, &isoString);
+				sum += dateTime.time.millisecond;
+			}
+		}
+		endTime = rsslGetTimeNano();
+		snprintf(caseName, sizeof(caseName), codecPerfTimeStamps[j].caseName, "from-string");
+		microPerfPrintResult("codec", caseName, iterations, endTime - startTime);
+	}
+
+	codecSink = sum;
+}
+
+/* News headlines, as in the headline fields of news items. Most are plain ASCII; some have
+ * characters of the Reuters Basic 2 set in GR (e.g. 0xA3 for the pound sign), or an RMTES
+ * partial update that repositions the cursor. */
+static const char *codecPerfHeadlines[] =
+{
+	"UPDATE 2-Oil prices rise as supply concerns outweigh demand worries",
+	"Fed's Powell says further rate hikes may be needed to curb inflation",
+	"BRIEF-Acme Corp Q3 revenue $1.24 bln vs IBES estimate $1.19 bln",
+	"European shares open higher, banks lead gains",
+	"Sterling slips below \xA3" "1.12 as gilt yields climb",
+	"TABLE-Japan October exports +4.3% y/y (Reuters poll +5.1%)",
+	"Dollar steadies near 20-year high ahead of U.S. jobs data",
+	"\x1B[20`Gold extends losses for fourth session",
+	"BUZZ-Chipmakers rally after upbeat forecast from sector bellwether",
+	"Euro zone inflation hits record 10.7% in October - flash",
+	"EXCLUSIVE-Regulators weigh new capital rules for mid-sized lenders",
+	"FTSE 100 ends flat; miners offset losses in consumer stocks",
+	"Treasury yields edge lower as investors await CPI report",
+	"China's factory activity contracts for a third straight month",
+	"Brent crude settles at \xA3" "80.20/bbl equivalent after OPEC+ cut",
+	"S&P 500 futures point to a firmer open on Wall Street"
+};
+
+/* Applies RMTES strings to a cache and converts them to UTF-8, as a consumer displaying the strings does. */
+static void codecPerfRunRmtesStrings(MicroPerfConfig *pConfig, const char *caseName, RsslBuffer *pStrings, RsslUInt32 stringCount, RsslUInt32 maxLength)
+{
+	RsslUInt32 iterations = microPerfIterations(pConfig, 1000000);
+	RsslTimeValue startTime, endTime;
+	RsslRmtesCacheBuffer cache;
+	RsslBuffer output;
+	char *cacheData, *outputData;
+	RsslUInt64 sum = 0;
+	RsslUInt32 i;
+
+	cacheData = (char*)malloc(maxLength);
+	outputData = (char*)malloc(maxLength * 3);
+	if (!cacheData || !outputData)
+	{
+		printf("%-12s Failed to allocate RMTES buffers.\n", "codec");
+		free(cacheData);
+		free(outputData);
+		return;
+	}
+
+	/* A partial update leaves the cache before the cursor as it was. */
+	memset(cacheData, ' ', maxLength);
+
+	microPerfStartCase();
+	startTime = rsslGetTimeNano();
+	for (i = 0; i < iterations; ++i)
+	{
+		cache.data = cacheData;
+		cache.length = 0;
+		cache.allocatedLength = maxLength;
+		output.data = outputData;
+		output.length = maxLength * 3;
+		if (rsslRMTESApplyToCache(&pStrings[i % stringCount], &cache) != RSSL_RET_SUCCESS
+				|| rsslRMTESToUTF8(&cache, &output) != RSSL_RET_SUCCESS)
+		{
+			printf("%-12s Failed to convert RMTES string.\n", "codec");
+			break;
+		}
+		sum += output.length;
+	}
+	endTime = rsslGetTimeNano();
+
+	if (i == iterations)
+		microPerfPrintResult("codec", caseName, iterations, endTime - startTime);
+
+	codecSink = sum;
+	free(cacheData);
+	free(outputData);
+}
+
+static void codecPerfRunRmtesCases(MicroPerfConfig *pConfig)
+{
+	RsslBuffer strings[sizeof(codecPerfHeadlines)/sizeof(char*)];
+	RsslUInt32 stringCount = sizeof(codecPerfHeadlines)/sizeof(char*);
+	RsslUInt32 lengths[] = { 64, 1024 };
+	char *asciiData;
+	char caseName[64];
+	RsslUInt32 i, j;
+
+	/* Printable ASCII, as in most display names and news text. */
+	for (j = 0; j < sizeof(lengths)/sizeof(RsslUInt32); ++j)
+	{
+		if ((asciiData = (char*)malloc(lengths[j])) == NULL)
+			return;
+
+		for (i = 0; i < lengths[j]; ++i)
+			asciiData[i] = (char)(' ' + (i % 95));
+		strings[0].data = asciiData;
+		strings[0].length = lengths[j];
+
+		snprintf(caseName, sizeof(caseName), "rmtes/to-utf8/ascii-%uB", lengths[j]);
+		codecPerfRunRmtesStrings(pConfig, caseName, strings, 1, lengths[j]);
+		free(asciiData);
+	}
+
+	for (i = 0; i < stringCount; ++i)
+	{
+		strings[i].data = (char*)codecPerfHeadlines[i];
+		strings[i].length = (RsslUInt32)strlen(codecPerfHeadlines[i]);
+	}
+	codecPerfRunRmtesStrings(pConfig, "rmtes/to-utf8/headlines", strings, stringCount, 256);
+}
+
+static void codecPerfRunDictionaryCases(MicroPerfConfig *pConfig)
+{
+	RsslUInt32 iterations = microPerfIterations(pConfig, 1000000) / 50000;
+	RsslTimeValue startTime, endTime;
+	RsslDataDictionary dictionary;
+	char errorTextData[256];
+	RsslBuffer errorText;
+	RsslBool haveEnums;
+	RsslUInt32 i;
+
+	if (iterations == 0)
+		iterations = 1;
+
+	errorText.data = errorTextData;
+	errorText.length = sizeof(errorTextData);
+
+	rsslClearDataDictionary(&dictionary);
+	if (rsslLoadFieldDictionary(CODEC_PERF_FIELD_DICTIONARY_FILE, &dictionary, &errorText) != RSSL_RET_SUCCESS)
+	{
+		printf("%-12s Skipped dictionary cases: could not load %s: %.*s\n", "codec", CODEC_PERF_FIELD_DICTIONARY_FILE, errorText.length, errorText.data);
+		return;
+	}
+	rsslDeleteDataDictionary(&dictionary);
+
+	microPerfStartCase();
+	startTime = rsslGetTimeNano();
+	for (i = 0; i < iterations; ++i)
+	{
+		rsslClearDataDictionary(&dictionary);
+		errorText.length = sizeof(errorTextData);
+		rsslLoadFieldDictionary(CODEC_PERF_FIELD_DICTIONARY_FILE, &dictionary, &errorText);
+		rsslDeleteDataDictionary(&dictionary);
+	}
+	endTime = rsslGetTimeNano();
+	microPerfPrintResult("codec", "dictionary/load-field", iterations, endTime - startTime);
+
+	rsslClearDataDictionary(&dictionary);
+	errorText.length = sizeof(errorTextData);
+	rsslLoadFieldDictionary(CODEC_PERF_FIELD_DICTIONARY_FILE, &dictionary, &errorText);
+	errorText.length = sizeof(errorTextData);
+	haveEnums = (rsslLoadEnumTypeDictionary(CODEC_PERF_ENUM_DICTIONARY_FILE, &dictionary, &errorText) == RSSL_RET_SUCCESS) ? RSSL_TRUE : RSSL_FALSE;
+	rsslDeleteDataDictionary(&dictionary);
+
+	if (haveEnums)
+	{
+		microPerfStartCase();
+		startTime = rsslGetTimeNano();
+		for (i = 0; i < iterations; ++i)
+		{
+			rsslClearDataDictionary(&dictionary);
+			errorText.length = sizeof(errorTextData);
+			rsslLoadFieldDictionary(CODEC_PERF_FIELD_DICTIONARY_FILE, &dictionary, &errorText);
+			errorText.length = sizeof(errorTextData);
+			rsslLoadEnumTypeDictionary(CODEC_PERF_ENUM_DICTIONARY_FILE, &dictionary, &errorText);
+			rsslDeleteDataDictionary(&dictionary);
+		}
+		endTime = rsslGetTimeNano();
+		microPerfPrintResult("codec", "dictionary/load-field-and-enum", iterations, endTime - startTime);
+	}
+
+	/* Load the same definitions from a snapshot. */
+	rsslClearDataDictionary(&dictionary);
+	errorText.length = sizeof(errorTextData);
+	rsslLoadFieldDictionary(CODEC_PERF_FIELD_DICTIONARY_FILE, &dictionary, &errorText);
+	if (haveEnums)
+	{
+		errorText.length = sizeof(errorTextData);
+		rsslLoadEnumTypeDictionary(CODEC_PERF_ENUM_DICTIONARY_FILE, &dictionary, &errorText);
+	}
+	errorText.length = sizeof(errorTextData);
+	if (rsslSaveDataDictionarySnapshot(CODEC_PERF_SNAPSHOT_FILE, &dictionary, 0, &errorText) != RSSL_RET_SUCCESS)
+	{
+		printf("%-12s Skipped snapshot case: %.*s\n", "codec", errorText.length, errorText.data);
+		rsslDeleteDataDictionary(&dictionary);
+		return;
+	}
+	rsslDeleteDataDictionary(&dictionary);
+
+	microPerfStartCase();
+	startTime = rsslGetTimeNano();
+	for (i = 0; i < iterations * 100; ++i)
+	{
+		rsslClearDataDictionary(&dictionary);
+		errorText.length = sizeof(errorTextData);
+		rsslLoadDataDictionarySnapshot(CODEC_PERF_SNAPSHOT_FILE, &dictionary, &errorText);
+		rsslDeleteDataDictionary(&dictionary);
+	}
+	endTime = rsslGetTimeNano();
+	microPerfPrintResult("codec", "dictionary/load-snapshot", iterations * 100, endTime - startTime);
+
+	remove(CODEC_PERF_SNAPSHOT_FILE);
+}
+
+/* Generates a mix of MarketPrice updates of 4-20 fields and refreshes of 20-60 fields. */
+static RsslRet codecPerfBuildSyntheticCorpus(CodecPerfCorpus *pCorpus)
+{
+	RsslUInt32 seed = CODEC_PERF_CORPUS_SEED;
+	RsslUInt32 i, offset = 0;
+
+	pCorpus->name = "synthetic";
+	pCorpus->msgCount = CODEC_PERF_CORPUS_MSGS;
+	pCorpus->msgs = (RsslBuffer*)malloc(CODEC_PERF_CORPUS_MSGS * sizeof(RsslBuffer));
+	pCorpus->data = (char*)malloc(CODEC_PERF_CORPUS_MSGS * CODEC_PERF_MSG_SIZE);
+	if (!pCorpus->msgs || !pCorpus->data)
+		return RSSL_RET_FAILURE;
+
+	for (i = 0; i < CODEC_PERF_CORPUS_MSGS; ++i)
+	{
+		RsslUInt8 msgClass = (codecPerfRandom(&seed) % 5 == 0) ? RSSL_MC_REFRESH : RSSL_MC_UPDATE;
+		RsslUInt32 fieldCount = (msgClass == RSSL_MC_REFRESH) ? 20 + codecPerfRandom(&seed) % 41 : 4 + codecPerfRandom(&seed) % 17;
+
+		pCorpus->msgs[i].data = pCorpus->data + offset;
+		pCorpus->msgs[i].length = CODEC_PERF_MSG_SIZE;
+		if (codecPerfEncodeMsg(&pCorpus->msgs[i], msgClass, fieldCount, codecPerfRandom(&seed) % 100) != RSSL_RET_SUCCESS)
+			return RSSL_RET_FAILURE;
+		offset += pCorpus->msgs[i].length;
+	}
+
+	return RSSL_RET_SUCCESS;
+}
+
+/* Reads a corpus file: each message is preceded by its length, as a 4-byte big-endian integer. */
+static RsslRet codecPerfLoadCorpus(CodecPerfCorpus *pCorpus, const char *fileName)
+{
+	FILE *pFile;
+	long fileSize;
+	RsslUInt32 offset, msgLength, msgCount = 0;
+	unsigned char *pData;
+
+	pCorpus->name = fileName;
+	pCorpus->msgs = NULL;
+	pCorpus->msgCount = 0;
+	pCorpus->data = NULL;
+
+	if ((pFile = fopen(fileName, "rb")) == NULL)
+	{
+		printf("%-12s Could not open corpus file %s.\n", "codec", fileName);
+		return RSSL_RET_FAILURE;
+	}
+
+	if (fseek(pFile, 0, SEEK_END) != 0 || (fileSize = ftell(pFile)) <= 0 || fileSize > CODEC_PERF_MAX_CORPUS_SIZE
+			|| fseek(pFile, 0, SEEK_SET) != 0)
+	{
+		printf("%-12s Corpus file %s is empty or larger than %u bytes.\n", "codec", fileName, CODEC_PERF_MAX_CORPUS_SIZE);
+		fclose(pFile);
+		return RSSL_RET_FAILURE;
+	}
+
+	if ((pCorpus->data = (char*)malloc(fileSize)) == NULL || fread(pCorpus->data, 1, fileSize, pFile) != (size_t)fileSize)
+	{
+		printf("%-12s Could not read corpus file %s.\n", "codec", fileName);
+		fclose(pFile);
+		return RSSL_RET_FAILURE;
+	}
+	fclose(pFile);
+
+	/* Count the messages, then point a buffer at each. */
+	pData = (unsigned char*)pCorpus->data;
+	for (offset = 0; offset + 4 <= (RsslUInt32)fileSize; offset += 4 + msgLength, ++msgCount)
+	{
+		msgLength = ((RsslUInt32)pData[offset] << 24) | ((RsslUInt32)pData[offset + 1] << 16) | ((RsslUInt32)pData[offset + 2] << 8) | pData[offset + 3];
+		if (msgLength > (RsslUInt32)fileSize - offset - 4)
+			break;
+	}
+
+	if (offset != (RsslUInt32)fileSize || msgCount == 0)
+	{
+		printf("%-12s Corpus file %s is not a sequence of length-prefixed messages.\n", "codec", fileName);
+		return RSSL_RET_FAILURE;
+	}
+
+	if ((pCorpus->msgs = (RsslBuffer*)malloc(msgCount * sizeof(RsslBuffer))) == NULL)
+		return RSSL_RET_FAILURE;
+
+	for (offset = 0; pCorpus->msgCount < msgCount; offset += 4 + msgLength)
+	{
+		msgLength = ((RsslUInt32)pData[offset] << 24) | ((RsslUInt32)pData[offset + 1] << 16) | ((RsslUInt32)pData[offset + 2] << 8) | pData[offset + 3];
+		pCorpus->msgs[pCorpus->msgCount].data = pCorpus->data + offset + 4;
+		pCorpus->msgs[pCorpus->msgCount].length = msgLength;
+		++pCorpus->msgCount;
+	}
+
+	return RSSL_RET_SUCCESS;
+}
+
+static void codecPerfRunCorpusCases(MicroPerfConfig *pConfig, CodecPerfCorpus *pCorpus)
+{
+	RsslUInt32 iterations = microPerfIterations(pConfig, 1000000);
+	RsslTimeValue startTime, endTime;
+	RsslUInt64 sum = 0, bytes = 0;
+	RsslUInt32 i;
+	char caseName[128];
+
+	for (i = 0; i < pCorpus->msgCount; ++i)
+		bytes += pCorpus->msgs[i].length;
+
+	for (i = 0; i < pConfig->warmupIterations; ++i)
+		sum += codecPerfDecodeMsg(&pCorpus->msgs[i % pCorpus->msgCount], RSSL_TRUE);
+
+	microPerfStartCase();
+	startTime = rsslGetTimeNano();
+	for (i = 0; i < iterations; ++i)
+		sum += codecPerfDecodeMsg(&pCorpus->msgs[i % pCorpus->msgCount], RSSL_FALSE);
+	endTime = rsslGetTimeNano();
+	snprintf(caseName, sizeof(caseName), "corpus/%s/decode-msg", pCorpus->name);
+	microPerfPrintResult("codec", caseName, iterations, endTime - startTime);
+
+	microPerfStartCase();
+	startTime = rsslGetTimeNano();
+	for (i = 0; i < iterations; ++i)
+		sum += codecPerfDecodeMsg(&pCorpus->msgs[i % pCorpus->msgCount], RSSL_TRUE);
+	endTime = rsslGetTimeNano();
+	snprintf(caseName, sizeof(caseName), "corpus/%s/decode-entries", pCorpus->name);
+	microPerfPrintResult("codec", caseName, iterations, endTime - startTime);
+
+	snprintf(caseName, sizeof(caseName), "corpus/%s", pCorpus->name);
+	printf("%-12s %-40s %12u msgs %11.1f bytes/msg\n", "codec", caseName, pCorpus->msgCount, (double)bytes / pCorpus->msgCount);
+
+	codecSink = sum;
+}
+
+static void codecPerfFreeCorpus(CodecPerfCorpus *pCorpus)
+{
+	free(pCorpus->msgs);
+	free(pCorpus->data);
+}
+
+void codecPerfRun(MicroPerfConfig *pConfig)
+{
+	CodecPerfCorpus corpus;
+
+	codecPerfRunMsgCases(pConfig);
+	codecPerfRunPrimitiveCases(pConfig);
+	codecPerfRunDateTimeCases(pConfig);
+	codecPerfRunRmtesCases(pConfig);
+	codecPerfRunDictionaryCases(pConfig);
+
+	if (codecPerfBuildSyntheticCorpus(&corpus) == RSSL_RET_SUCCESS)
+		codecPerfRunCorpusCases(pConfig, &corpus);
+	else
+		printf("%-12s Failed to build the synthetic corpus.\n", "codec");
+	codecPerfFreeCorpus(&corpus);
+
+	if (pConfig->corpusFile)
+	{
+		if (codecPerfLoadCorpus(&corpus, pConfig->corpusFile) == RSSL_RET_SUCCESS)
+			codecPerfRunCorpusCases(pConfig, &corpus);
+		codecPerfFreeCorpus(&corpus);
+	}
+}
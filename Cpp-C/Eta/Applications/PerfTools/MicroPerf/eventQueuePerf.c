@@ -0,0 +1,256 @@
+/*
+ * This source code is provided under the Apache 2.0 license and is provided
+ * AS IS with no warranty or guarantee of fit for purpose.  See the project's
+ * LICENSE.md for details.
+ * Copyright (C) 2022 Refinitiv. All rights reserved.
+*/
+
+/* eventQueuePerf.c
+ * Measures the reactor's event queues, which carry every event between the reactor
+ * and its worker thread: the round trip of an event through two threads, putting
+ * and getting events on one thread, and several threads putting into one group. */
+
+#include "microPerf.h"
+#include "rtr/rsslReactor.h"
+#include "rtr/rsslHashTable.h"
+#include "rtr/rsslReactorEventQueue.h"
+#include "rtr/rsslNotifier.h"
+#include "rtr/rsslThread.h"
+
+#define EVENT_QUEUE_PERF_POOL_SIZE	10
+#define EVENT_QUEUE_PERF_PRODUCERS	4
+
+/* A group with one queue, and the notifier its consumer waits on. */
+typedef struct {
+	RsslReactorEventQueueGroup	group;
+	RsslReactorEventQueue		queue;
+	RsslNotifier				*pNotifier;
+	RsslNotifierEvent			*pNotifierEvent;
+} EventQueuePerfEnd;
+
+static RsslBool eventQueuePerfInitEnd(EventQueuePerfEnd *pEnd)
+{
+	if (rsslInitReactorEventQueueGroup(&pEnd->group) != RSSL_RET_SUCCESS)
+		return RSSL_FALSE;
+
+	rsslInitReactorEventQueue(&pEnd->queue, EVENT_QUEUE_PERF_POOL_SIZE, &pEnd->group);
+
+	pEnd->pNotifier = rsslCreateNotifier(1);
+	pEnd->pNotifierEvent = rsslCreateNotifierEvent();
+	rsslNotifierAddEvent(pEnd->pNotifier, pEnd->pNotifierEvent, rsslGetEventQueueGroupSignalFD(&pEnd->group), pEnd);
+	rsslNotifierRegisterRead(pEnd->pNotifier, pEnd->pNotifierEvent);
+	return RSSL_TRUE;
+}
+
+static void eventQueuePerfCleanupEnd(EventQueuePerfEnd *pEnd)
+{
+	rsslNotifierRemoveEvent(pEnd->pNotifier, pEnd->pNotifierEvent);
+	rsslDestroyNotifierEvent(pEnd->pNotifierEvent);
+	rsslDestroyNotifier(pEnd->pNotifier);
+	rsslCleanupReactorEventQueue(&pEnd->queue);
+	rsslCleanupReactorEventQueueGroup(&pEnd->group);
+}
+
+static void eventQueuePerfPut(RsslReactorEventQueue *pQueue, RsslReactorEventImplType eventType)
+{
+	RsslReactorEventImpl *pEvent = rsslReactorEventQueueGetFromPool(pQueue);
+
+	pEvent->base.eventType = eventType;
+	rsslReactorEventQueuePut(pQueue, pEvent);
+}
+
+/* Waits for an event, as the worker thread does. */
+static RsslReactorEventImpl *eventQueuePerfWaitForEvent(EventQueuePerfEnd *pEnd)
+{
+	RsslReactorEventImpl *pEvent;
+	RsslRet ret;
+
+	while (!(pEvent = rsslReactorEventQueueGet(&pEnd->queue, EVENT_QUEUE_PERF_POOL_SIZE, &ret)))
+	{
+		if (ret < RSSL_RET_SUCCESS)
+			return NULL;
+		rsslNotifierWait(pEnd->pNotifier, 1000000);
+	}
+
+	return pEvent;
+}
+
+typedef struct {
+	EventQueuePerfEnd	request;		/* Events to the echo thread */
+	EventQueuePerfEnd	response;		/* Events back from it */
+} EventQueuePerfRoundTrip;
+
+/* Sends each event back until it gets a reactor event. */
+static RSSL_THREAD_DECLARE(eventQueuePerfEchoThread, pArg)
+{
+	EventQueuePerfRoundTrip *pRoundTrip = (EventQueuePerfRoundTrip*)pArg;
+	RsslReactorEventImpl *pEvent;
+
+	while ((pEvent = eventQueuePerfWaitForEvent(&pRoundTrip->request)) && pEvent->base.eventType != RSSL_RCIMPL_ET_REACTOR)
+		eventQueuePerfPut(&pRoundTrip->response.queue, pEvent->base.eventType);
+
+	return RSSL_THREAD_RETURN();
+}
+
+static void eventQueuePerfRunRoundTrip(MicroPerfConfig *pConfig)
+{
+	EventQueuePerfRoundTrip roundTrip;
+	RsslThreadId echoThread;
+	ValueStatistics roundTripStats;
+	RsslUInt32 iterations = microPerfIterations(pConfig, 100000);
+	RsslUInt32 i;
+
+	if (!eventQueuePerfInitEnd(&roundTrip.request) || !eventQueuePerfInitEnd(&roundTrip.response))
+	{
+		printf("Failed to create event queue groups.\n");
+		return;
+	}
+
+	RSSL_THREAD_START(&echoThread, eventQueuePerfEchoThread, &roundTrip);
+
+	clearValueStatistics(&roundTripStats);
+
+	for (i = 0; i < pConfig->warmupIterations + iterations; ++i)
+	{
+		RsslTimeValue startTime, endTime;
+
+		startTime = rsslGetTimeNano();
+		eventQueuePerfPut(&roundTrip.request.queue, RSSL_RCIMPL_ET_TIMER);
+		if (!eventQueuePerfWaitForEvent(&roundTrip.response))
+			break;
+		endTime = rsslGetTimeNano();
+
+		if (i >= pConfig->warmupIterations)
+			updateValueStatistics(&roundTripStats, (double)(endTime - startTime) / 1000.0);
+	}
+
+	microPerfPrintStats("eventqueue", "round-trip", &roundTripStats);
+
+	eventQueuePerfPut(&roundTrip.request.queue, RSSL_RCIMPL_ET_REACTOR);
+	RSSL_THREAD_JOIN(echoThread);
+
+	eventQueuePerfCleanupEnd(&roundTrip.request);
+	eventQueuePerfCleanupEnd(&roundTrip.response);
+}
+
+/* Puts a batch of events and gets them back on the same thread, so the group's descriptor
+ * is written and read once per batch. */
+static void eventQueuePerfRunPutGet(MicroPerfConfig *pConfig, RsslUInt32 batchSize)
+{
+	EventQueuePerfEnd end;
+	RsslUInt32 iterations = microPerfIterations(pConfig, 1000000) / batchSize;
+	RsslUInt32 i, j;
+	RsslTimeValue startTime = 0;
+	RsslRet ret;
+	char caseName[32];
+
+	if (!eventQueuePerfInitEnd(&end))
+	{
+		printf("Failed to create event queue group.\n");
+		return;
+	}
+
+	for (i = 0; i < pConfig->warmupIterations + iterations; ++i)
+	{
+		if (i == pConfig->warmupIterations)
+		{
+			microPerfStartCase();
+			startTime = rsslGetTimeNano();
+		}
+
+		for (j = 0; j < batchSize; ++j)
+			eventQueuePerfPut(&end.queue, RSSL_RCIMPL_ET_TIMER);
+
+		for (j = 0; j < batchSize; ++j)
+			rsslReactorEventQueueGet(&end.queue, EVENT_QUEUE_PERF_POOL_SIZE, &ret);
+	}
+
+	snprintf(caseName, sizeof(caseName), "put-get/batch-%u", batchSize);
+	microPerfPrintResult("eventqueue", caseName, (RsslUInt64)iterations * batchSize, rsslGetTimeNano() - startTime);
+
+	eventQueuePerfCleanupEnd(&end);
+}
+
+typedef struct {
+	RsslReactorEventQueue	*pQueue;
+	RsslUInt32				eventCount;
+} EventQueuePerfProducer;
+
+static RSSL_THREAD_DECLARE(eventQueuePerfProducerThread, pArg)
+{
+	EventQueuePerfProducer *pProducer = (EventQueuePerfProducer*)pArg;
+	RsslUInt32 i;
+
+	for (i = 0; i < pProducer->eventCount; ++i)
+		eventQueuePerfPut(pProducer->pQueue, RSSL_RCIMPL_ET_TIMER);
+
+	return RSSL_THREAD_RETURN();
+}
+
+/* Several threads put events into their own queues of one group, which one thread
+ * dispatches in turn as the reactor does. */
+static void eventQueuePerfRunProducers(MicroPerfConfig *pConfig)
+{
+	EventQueuePerfEnd end;
+	RsslReactorEventQueue queues[EVENT_QUEUE_PERF_PRODUCERS];
+	EventQueuePerfProducer producers[EVENT_QUEUE_PERF_PRODUCERS];
+	RsslThreadId producerThreads[EVENT_QUEUE_PERF_PRODUCERS];
+	RsslUInt32 eventsPerProducer = microPerfIterations(pConfig, 1000000) / EVENT_QUEUE_PERF_PRODUCERS;
+	RsslUInt64 eventsLeft = (RsslUInt64)eventsPerProducer * EVENT_QUEUE_PERF_PRODUCERS;
+	RsslTimeValue startTime;
+	RsslRet ret;
+	int i;
+	char caseName[32];
+
+	if (!eventQueuePerfInitEnd(&end))
+	{
+		printf("Failed to create event queue group.\n");
+		return;
+	}
+
+	microPerfStartCase();
+	startTime = rsslGetTimeNano();
+
+	for (i = 0; i < EVENT_QUEUE_PERF_PRODUCERS; ++i)
+	{
+		rsslInitReactorEventQueue(&queues[i], EVENT_QUEUE_PERF_POOL_SIZE, &end.group);
+		producers[i].pQueue = &queues[i];
+		producers[i].eventCount = eventsPerProducer;
+		RSSL_THREAD_START(&producerThreads[i], eventQueuePerfProducerThread, &producers[i]);
+	}
+
+	while (eventsLeft > 0)
+	{
+		RsslReactorEventQueue *pQueue;
+
+		if (!(pQueue = rsslReactorEventQueueGroupShift(&end.group)))
+		{
+			rsslNotifierWait(end.pNotifier, 1000000);
+			continue;
+		}
+
+		if (rsslReactorEventQueueGet(pQueue, EVENT_QUEUE_PERF_POOL_SIZE, &ret))
+			--eventsLeft;
+		else if (ret < RSSL_RET_SUCCESS)
+			break;
+	}
+
+	snprintf(caseName, sizeof(caseName), "producers/%d", EVENT_QUEUE_PERF_PRODUCERS);
+	microPerfPrintResult("eventqueue", caseName, (RsslUInt64)eventsPerProducer * EVENT_QUEUE_PERF_PRODUCERS, rsslGetTimeNano() - startTime);
+
+	for (i = 0; i < EVENT_QUEUE_PERF_PRODUCERS; ++i)
+	{
+		RSSL_THREAD_JOIN(producerThreads[i]);
+		rsslCleanupReactorEventQueue(&queues[i]);
+	}
+
+	eventQueuePerfCleanupEnd(&end);
+}
+
+void eventQueuePerfRun(MicroPerfConfig *pConfig)
+{
+	eventQueuePerfRunRoundTrip(pConfig);
+	eventQueuePerfRunPutGet(pConfig, 1);
+	eventQueuePerfRunPutGet(pConfig, 100);
+	eventQueuePerfRunProducers(pConfig);
+}
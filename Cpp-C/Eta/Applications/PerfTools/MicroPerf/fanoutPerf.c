@@ -0,0 +1,199 @@
+/*
+ * This source code is provided under the Apache 2.0 license and is provided
+ * AS IS with no warranty or guarantee of fit for purpose.  See the project's
+ * LICENSE.md for details.
+ * Copyright (C) 2022 Refinitiv. All rights reserved.
+*/
+
+/* fanoutPerf.c
+ * Measures the watchlist's fan-out of an item message to 1, 10 and 100 requests on the
+ * same stream: the message header is decoded once, and the message is then delivered to
+ * each request with wlItemRequestSendMsgEvent. The requests are set up directly, without
+ * a channel, so only the fan-out itself is measured. */
+
+#include "microPerf.h"
+#include "rtr/rsslDataPackage.h"
+#include "rtr/rsslMessagePackage.h"
+#include "rtr/rsslHeapBuffer.h"
+#include "rtr/wlItem.h"
+
+#define FANOUT_PERF_MAX_REQUESTS 100
+
+#define FANOUT_PERF_FIELDS 20
+
+#define FANOUT_PERF_MSG_SIZE 4096
+
+static const RsslUInt32 requestCounts[] = { 1, 10, 100 };
+
+/* Keeps the compiler from optimizing away the delivered messages. */
+static volatile RsslUInt64 fanoutSink;
+
+/* Stands in for the reactor's callback. Reads what an application would read. */
+static RsslRet fanoutPerfMsgCallback(RsslWatchlist *pWatchlist, RsslWatchlistMsgEvent *pEvent, RsslErrorInfo *pErrorInfo)
+{
+	fanoutSink += (RsslUInt64)pEvent->pStreamInfo->streamId + pEvent->pRsslMsg->msgBase.streamId
+		+ (RsslUInt64)pEvent->pRsslMsg->msgBase.encMsgBuffer.length + (RsslUInt8)pEvent->pRsslMsg->msgBase.encDataBody.data[0];
+	return RSSL_RET_SUCCESS;
+}
+
+static RsslRet fanoutPerfEncodeUpdate(RsslBuffer *pBuffer)
+{
+	RsslEncodeIterator encIter;
+	RsslUpdateMsg updateMsg;
+	RsslFieldList fieldList;
+	RsslFieldEntry fieldEntry;
+	RsslReal real;
+	RsslUInt32 i;
+	RsslRet ret;
+
+	rsslClearEncodeIterator(&encIter);
+	rsslSetEncodeIteratorBuffer(&encIter, pBuffer);
+	rsslSetEncodeIteratorRWFVersion(&encIter, RSSL_RWF_MAJOR_VERSION, RSSL_RWF_MINOR_VERSION);
+
+	rsslClearUpdateMsg(&updateMsg);
+	updateMsg.msgBase.streamId = 5;
+	updateMsg.msgBase.domainType = RSSL_DMT_MARKET_PRICE;
+	updateMsg.msgBase.containerType = RSSL_DT_FIELD_LIST;
+	updateMsg.updateType = RDM_UPD_EVENT_TYPE_QUOTE;
+
+	if ((ret = rsslEncodeMsgInit(&encIter, (RsslMsg*)&updateMsg, 0)) != RSSL_RET_ENCODE_CONTAINER)
+		return RSSL_RET_FAILURE;
+
+	rsslClearFieldList(&fieldList);
+	fieldList.flags = RSSL_FLF_HAS_STANDARD_DATA;
+	if ((ret = rsslEncodeFieldListInit(&encIter, &fieldList, NULL, 0)) < RSSL_RET_SUCCESS)
+		return ret;
+
+	for (i = 0; i < FANOUT_PERF_FIELDS; ++i)
+	{
+		rsslClearFieldEntry(&fieldEntry);
+		fieldEntry.fieldId = (RsslFieldId)(22 + i);
+		fieldEntry.dataType = RSSL_DT_REAL;
+		rsslClearReal(&real);
+		real.hint = RSSL_RH_EXPONENT_2;
+		real.value = 3995 + i;
+		if ((ret = rsslEncodeFieldEntry(&encIter, &fieldEntry, &real)) < RSSL_RET_SUCCESS)
+			return ret;
+	}
+
+	if ((ret = rsslEncodeFieldListComplete(&encIter, RSSL_TRUE)) < RSSL_RET_SUCCESS
+			|| (ret = rsslEncodeMsgComplete(&encIter, RSSL_TRUE)) < RSSL_RET_SUCCESS)
+		return ret;
+
+	pBuffer->length = rsslGetEncodedBufferLength(&encIter);
+	return RSSL_RET_SUCCESS;
+}
+
+/* Decodes the message header once, and delivers the message to each request. */
+static RsslRet fanoutPerfFanout(WlBase *pBase, RsslBuffer *pMsgBuffer, WlItemRequest *requests, RsslUInt32 requestCount)
+{
+	RsslDecodeIterator decIter;
+	RsslWatchlistMsgEvent msgEvent;
+	RsslErrorInfo errorInfo;
+	RsslMsg msg;
+	RsslUInt32 i;
+	RsslRet ret;
+
+	rsslClearDecodeIterator(&decIter);
+	rsslSetDecodeIteratorBuffer(&decIter, pMsgBuffer);
+	rsslSetDecodeIteratorRWFVersion(&decIter, RSSL_RWF_MAJOR_VERSION, RSSL_RWF_MINOR_VERSION);
+	if ((ret = rsslDecodeMsg(&decIter, &msg)) != RSSL_RET_SUCCESS)
+		return ret;
+
+	wlMsgEventClear(&msgEvent);
+	msgEvent.pRsslMsg = &msg;
+
+	for (i = 0; i < requestCount; ++i)
+		if ((ret = wlItemRequestSendMsgEvent(pBase, &msgEvent, &requests[i], &errorInfo)) != RSSL_RET_SUCCESS)
+			return ret;
+
+	return RSSL_RET_SUCCESS;
+}
+
+static void fanoutPerfRunCase(MicroPerfConfig *pConfig, WlBase *pBase, RsslBuffer *pMsgBuffer,
+		WlItemRequest *requests, RsslUInt32 requestCount)
+{
+	RsslUInt32 iterations = microPerfIterations(pConfig, 1000000 / requestCount);
+	RsslTimeValue startTime, endTime;
+	RsslUInt32 i;
+	char caseName[64];
+
+	for (i = 0; i < pConfig->warmupIterations; ++i)
+		fanoutPerfFanout(pBase, pMsgBuffer, requests, requestCount);
+
+	microPerfStartCase();
+	startTime = rsslGetTimeNano();
+	for (i = 0; i < iterations; ++i)
+	{
+		if (fanoutPerfFanout(pBase, pMsgBuffer, requests, requestCount) != RSSL_RET_SUCCESS)
+		{
+			printf("%-12s Failed to fan out message.\n", "fanout");
+			return;
+		}
+	}
+	endTime = rsslGetTimeNano();
+
+	snprintf(caseName, sizeof(caseName), "update/%u-request%s%s", requestCount, requestCount > 1 ? "s" : "",
+			pBase->config.enableDistinctFanoutBuffers ? "/distinct-buffers" : "");
+	microPerfPrintResult("fanout", caseName, iterations, endTime - startTime);
+}
+
+void fanoutPerfRun(MicroPerfConfig *pConfig)
+{
+	WlBase base;
+	RsslChannel channel;
+	WlRequestedService requestedService;
+	WlItemRequest *requests;
+	char msgData[FANOUT_PERF_MSG_SIZE];
+	RsslBuffer msgBuffer;
+	RsslUInt32 i, j;
+
+	msgBuffer.data = msgData;
+	msgBuffer.length = sizeof(msgData);
+	if (fanoutPerfEncodeUpdate(&msgBuffer) != RSSL_RET_SUCCESS)
+	{
+		printf("%-12s Failed to encode message.\n", "fanout");
+		return;
+	}
+
+	if ((requests = (WlItemRequest*)calloc(FANOUT_PERF_MAX_REQUESTS, sizeof(WlItemRequest))) == NULL)
+	{
+		printf("%-12s Memory allocation failed.\n", "fanout");
+		return;
+	}
+
+	memset(&channel, 0, sizeof(RsslChannel));
+	channel.majorVersion = RSSL_RWF_MAJOR_VERSION;
+	channel.minorVersion = RSSL_RWF_MINOR_VERSION;
+
+	memset(&requestedService, 0, sizeof(WlRequestedService));
+
+	memset(&base, 0, sizeof(WlBase));
+	base.config.msgCallback = fanoutPerfMsgCallback;
+	base.pRsslChannel = &channel;
+	if (rsslHeapBufferInit(&base.tempFanoutBuffer, 16384) != RSSL_RET_SUCCESS)
+	{
+		printf("%-12s Memory allocation failed.\n", "fanout");
+		free(requests);
+		return;
+	}
+
+	for (i = 0; i < FANOUT_PERF_MAX_REQUESTS; ++i)
+	{
+		requests[i].base.streamId = (RsslInt32)(10 + i);
+		requests[i].base.domainType = RSSL_DMT_MARKET_PRICE;
+		requests[i].pRequestedService = &requestedService;
+	}
+
+	/* All requests share the message, then each gets its own copy. */
+	for (j = 0; j < 2; ++j)
+	{
+		base.config.enableDistinctFanoutBuffers = (j == 1) ? RSSL_TRUE : RSSL_FALSE;
+
+		for (i = 0; i < sizeof(requestCounts)/sizeof(RsslUInt32); ++i)
+			fanoutPerfRunCase(pConfig, &base, &msgBuffer, requests, requestCounts[i]);
+	}
+
+	rsslHeapBufferCleanup(&base.tempFanoutBuffer);
+	free(requests);
+}
@@ -0,0 +1,254 @@
+/*
+ * This source code is provided under the Apache 2.0 license and is provided
+ * AS IS with no warranty or guarantee of fit for purpose.  See the project's
+ * LICENSE.md for details.
+ * Copyright (C) 2022 Refinitiv. All rights reserved.
+*/
+
+/* fieldListPerf.c
+ * Measures sparse access to a large encoded field list: finding a few fields by
+ * walking the entries in order, against indexing the list and looking them up. */
+
+#include "microPerf.h"
+#include "rtr/rsslDataPackage.h"
+
+/* Number of entries in the encoded field list, similar to a full equity refresh. */
+#define FIELD_LIST_PERF_ENTRIES 200
+
+/* Field identifiers of the entries are spread out, as in the RDM field dictionary. */
+#define FIELD_LIST_PERF_FID(entry) ((RsslFieldId)(1 + (entry) * 7))
+
+static const RsslUInt32 accessCounts[] = { 3, 10, 50 };
+
+/* Keeps the compiler from optimizing away the decoded values. */
+static volatile RsslUInt64 fieldListSink;
+
+static RsslRet fieldListPerfEncode(RsslBuffer *pBuffer)
+{
+	RsslEncodeIterator encIter;
+	RsslFieldList fieldList;
+	RsslFieldEntry fieldEntry;
+	RsslReal real;
+	RsslUInt64 uintValue;
+	RsslUInt32 i;
+	RsslRet ret;
+
+	rsslClearEncodeIterator(&encIter);
+	rsslSetEncodeIteratorBuffer(&encIter, pBuffer);
+	rsslSetEncodeIteratorRWFVersion(&encIter, RSSL_RWF_MAJOR_VERSION, RSSL_RWF_MINOR_VERSION);
+
+	rsslClearFieldList(&fieldList);
+	fieldList.flags = RSSL_FLF_HAS_STANDARD_DATA;
+	if ((ret = rsslEncodeFieldListInit(&encIter, &fieldList, NULL, 0)) < RSSL_RET_SUCCESS)
+		return ret;
+
+	for (i = 0; i < FIELD_LIST_PERF_ENTRIES; ++i)
+	{
+		rsslClearFieldEntry(&fieldEntry);
+		fieldEntry.fieldId = FIELD_LIST_PERF_FID(i);
+
+		if (i % 2)
+		{
+			fieldEntry.dataType = RSSL_DT_REAL;
+			rsslClearReal(&real);
+			real.hint = RSSL_RH_EXPONENT_2;
+			real.value = 10000 + i;
+			ret = rsslEncodeFieldEntry(&encIter, &fieldEntry, &real);
+		}
+		else
+		{
+			fieldEntry.dataType = RSSL_DT_UINT;
+			uintValue = 1000000 + i;
+			ret = rsslEncodeFieldEntry(&encIter, &fieldEntry, &uintValue);
+		}
+
+		if (ret < RSSL_RET_SUCCESS)
+			return ret;
+	}
+
+	if ((ret = rsslEncodeFieldListComplete(&encIter, RSSL_TRUE)) < RSSL_RET_SUCCESS)
+		return ret;
+
+	pBuffer->length = rsslGetEncodedBufferLength(&encIter);
+	return RSSL_RET_SUCCESS;
+}
+
+/* Picks the wanted fields evenly across the list, so the in-order walk goes most of the way through it. */
+static void fieldListPerfWantedFids(RsslFieldId *pFids, RsslUInt32 count)
+{
+	RsslUInt32 i;
+
+	for (i = 0; i < count; ++i)
+		pFids[i] = FIELD_LIST_PERF_FID((i * FIELD_LIST_PERF_ENTRIES) / count + (FIELD_LIST_PERF_ENTRIES / count) / 2);
+}
+
+/* Decodes the wanted fields by decoding entries in order until all have been seen. */
+static RsslUInt64 fieldListPerfWalk(RsslBuffer *pBuffer, RsslFieldId *pFids, RsslUInt32 count)
+{
+	RsslDecodeIterator decIter;
+	RsslFieldList fieldList;
+	RsslFieldEntry fieldEntry;
+	RsslUInt64 uintValue, sum = 0;
+	RsslUInt32 found = 0, i;
+
+	rsslClearDecodeIterator(&decIter);
+	rsslSetDecodeIteratorBuffer(&decIter, pBuffer);
+	rsslSetDecodeIteratorRWFVersion(&decIter, RSSL_RWF_MAJOR_VERSION, RSSL_RWF_MINOR_VERSION);
+
+	if (rsslDecodeFieldList(&decIter, &fieldList, NULL) != RSSL_RET_SUCCESS)
+		return 0;
+
+	while (found < count && rsslDecodeFieldEntry(&decIter, &fieldEntry) == RSSL_RET_SUCCESS)
+	{
+		for (i = 0; i < count; ++i)
+		{
+			if (pFids[i] == fieldEntry.fieldId)
+			{
+				if (rsslDecodeUInt(&decIter, &uintValue) == RSSL_RET_SUCCESS)
+					sum += uintValue;
+				else
+					sum += fieldEntry.encData.length;
+				++found;
+				break;
+			}
+		}
+	}
+
+	return sum;
+}
+
+/* Decodes the wanted fields by indexing the list, then looking each one up. */
+static RsslUInt64 fieldListPerfLookup(RsslBuffer *pBuffer, RsslFieldListIndex *pIndex, RsslFieldId *pFids, RsslUInt32 count)
+{
+	RsslDecodeIterator decIter;
+	RsslFieldList fieldList;
+	RsslFieldEntry fieldEntry;
+	RsslUInt64 uintValue, sum = 0;
+	RsslUInt32 i;
+
+	rsslClearDecodeIterator(&decIter);
+	rsslSetDecodeIteratorBuffer(&decIter, pBuffer);
+	rsslSetDecodeIteratorRWFVersion(&decIter, RSSL_RWF_MAJOR_VERSION, RSSL_RWF_MINOR_VERSION);
+
+	if (rsslDecodeFieldListIndexed(&decIter, &fieldList, NULL, pIndex) != RSSL_RET_SUCCESS)
+		return 0;
+
+	for (i = 0; i < count; ++i)
+	{
+		if (rsslDecodeFieldEntryById(&decIter, pIndex, pFids[i], &fieldEntry) != RSSL_RET_SUCCESS)
+			continue;
+
+		if (rsslDecodeUInt(&decIter, &uintValue) == RSSL_RET_SUCCESS)
+			sum += uintValue;
+		else
+			sum += fieldEntry.encData.length;
+	}
+
+	return sum;
+}
+
+static void fieldListPerfRunCount(MicroPerfConfig *pConfig, RsslBuffer *pBuffer, RsslFieldListIndex *pIndex, RsslUInt32 count)
+{
+	RsslUInt32 iterations = microPerfIterations(pConfig, 1000000);
+	RsslTimeValue startTime, endTime;
+	RsslFieldId fids[64];
+	RsslUInt64 walkSum = 0, lookupSum = 0;
+	RsslUInt32 i;
+	char caseName[64];
+
+	fieldListPerfWantedFids(fids, count);
+
+	for (i = 0; i < pConfig->warmupIterations; ++i)
+	{
+		walkSum += fieldListPerfWalk(pBuffer, fids, count);
+		lookupSum += fieldListPerfLookup(pBuffer, pIndex, fids, count);
+	}
+
+	microPerfStartCase();
+	startTime = rsslGetTimeNano();
+	for (i = 0; i < iterations; ++i)
+		walkSum += fieldListPerfWalk(pBuffer, fids, count);
+	endTime = rsslGetTimeNano();
+
+	snprintf(caseName, sizeof(caseName), "walk/%u-of-%u", count, FIELD_LIST_PERF_ENTRIES);
+	microPerfPrintResult("fieldlist", caseName, iterations, endTime - startTime);
+
+	microPerfStartCase();
+	startTime = rsslGetTimeNano();
+	for (i = 0; i < iterations; ++i)
+		lookupSum += fieldListPerfLookup(pBuffer, pIndex, fids, count);
+	endTime = rsslGetTimeNano();
+
+	snprintf(caseName, sizeof(caseName), "index+lookup/%u-of-%u", count, FIELD_LIST_PERF_ENTRIES);
+	microPerfPrintResult("fieldlist", caseName, iterations, endTime - startTime);
+
+	if (walkSum != lookupSum)
+		printf("%-12s %s: walk and lookup decoded different values\n", "fieldlist", caseName);
+
+	fieldListSink = walkSum + lookupSum;
+}
+
+/* Measures the lookups alone, in an index that is already built. */
+static void fieldListPerfRunLookupOnly(MicroPerfConfig *pConfig, RsslBuffer *pBuffer, RsslFieldListIndex *pIndex)
+{
+	RsslUInt32 iterations = microPerfIterations(pConfig, 1000000) * 10;
+	RsslTimeValue startTime, endTime;
+	RsslDecodeIterator decIter;
+	RsslFieldList fieldList;
+	RsslFieldEntry fieldEntry;
+	RsslFieldId fids[FIELD_LIST_PERF_ENTRIES];
+	RsslUInt64 sum = 0;
+	RsslUInt32 i;
+
+	for (i = 0; i < FIELD_LIST_PERF_ENTRIES; ++i)
+		fids[i] = FIELD_LIST_PERF_FID((i * 37) % FIELD_LIST_PERF_ENTRIES);
+
+	rsslClearDecodeIterator(&decIter);
+	rsslSetDecodeIteratorBuffer(&decIter, pBuffer);
+	rsslSetDecodeIteratorRWFVersion(&decIter, RSSL_RWF_MAJOR_VERSION, RSSL_RWF_MINOR_VERSION);
+
+	if (rsslDecodeFieldListIndexed(&decIter, &fieldList, NULL, pIndex) != RSSL_RET_SUCCESS)
+	{
+		printf("%-12s Failed to index field list.\n", "fieldlist");
+		return;
+	}
+
+	microPerfStartCase();
+	startTime = rsslGetTimeNano();
+	for (i = 0; i < iterations; ++i)
+	{
+		if (rsslDecodeFieldEntryById(&decIter, pIndex, fids[i % FIELD_LIST_PERF_ENTRIES], &fieldEntry) == RSSL_RET_SUCCESS)
+			sum += fieldEntry.encData.length;
+	}
+	endTime = rsslGetTimeNano();
+
+	fieldListSink = sum;
+
+	microPerfPrintResult("fieldlist", "lookup-only", iterations, endTime - startTime);
+}
+
+void fieldListPerfRun(MicroPerfConfig *pConfig)
+{
+	RsslFieldListIndexSlot slots[512];
+	RsslFieldListIndex index = RSSL_INIT_FIELD_LIST_INDEX;
+	char data[4096];
+	RsslBuffer buffer;
+	RsslUInt32 i;
+
+	buffer.data = data;
+	buffer.length = sizeof(data);
+
+	if (fieldListPerfEncode(&buffer) != RSSL_RET_SUCCESS)
+	{
+		printf("%-12s Failed to encode field list.\n", "fieldlist");
+		return;
+	}
+
+	index.slots = slots;
+	index.slotCount = sizeof(slots)/sizeof(RsslFieldListIndexSlot);
+
+	for (i = 0; i < sizeof(accessCounts)/sizeof(RsslUInt32); ++i)
+		fieldListPerfRunCount(pConfig, &buffer, &index, accessCounts[i]);
+
+	fieldListPerfRunLookupOnly(pConfig, &buffer, &index);
+}
@@ -0,0 +1,188 @@
+/*
+ * This source code is provided under the Apache 2.0 license and is provided
+ * AS IS with no warranty or guarantee of fit for purpose.  See the project's
+ * LICENSE.md for details.
+ * Copyright (C) 2022 Refinitiv. All rights reserved.
+*/
+
+/* hashPerf.c
+ * Measures the hash functions used by the watchlist tables, on single keys and on
+ * item opens into a large table (a lookup that misses, followed by an insert). */
+
+#include "microPerf.h"
+#include "rtr/rsslHashFuncs.h"
+#include "rtr/rsslHashTable.h"
+
+typedef struct {
+	const char			*name;
+	RsslHashSumFunction	*sumFunction;
+} HashPerfFunction;
+
+static RsslUInt32 polyHashBufferSum(void *pKey)
+{ return rsslPolyHash(((RsslBuffer*)pKey)->data, ((RsslBuffer*)pKey)->length); }
+
+static RsslUInt32 portableHashBufferSum(void *pKey)
+{ return rsslFastHashWithKernel(RSSL_HASH_KERNEL_PORTABLE, ((RsslBuffer*)pKey)->data, ((RsslBuffer*)pKey)->length, 0); }
+
+static RsslUInt32 crc32cHashBufferSum(void *pKey)
+{ return rsslFastHashWithKernel(RSSL_HASH_KERNEL_CRC32C, ((RsslBuffer*)pKey)->data, ((RsslBuffer*)pKey)->length, 0); }
+
+/* poly-crc is the hash used for item streams before the fast hash, and is still used
+ * on multicast channels. */
+static const HashPerfFunction hashFunctions[] =
+{
+	{ "poly-crc", polyHashBufferSum },
+	{ "buffer-sum", rsslHashBufferSum },
+	{ "portable", portableHashBufferSum },
+	{ "crc32c", crc32cHashBufferSum }
+};
+
+static const RsslUInt32 keyLengths[] = { 8, 16, 32, 128 };
+
+static const RsslUInt32 itemCounts[] = { 100000, 1000000 };
+
+/* Keeps the compiler from optimizing away the hash values. */
+static volatile RsslUInt32 hashSink;
+
+static void hashPerfRunKey(MicroPerfConfig *pConfig, const HashPerfFunction *pFunction, RsslUInt32 length)
+{
+	RsslUInt32 iterations = microPerfIterations(pConfig, 10000000);
+	RsslTimeValue startTime, endTime;
+	RsslUInt32 i, sum = 0;
+	char data[128];
+	RsslBuffer key;
+	char caseName[64];
+
+	for (i = 0; i < length; ++i)
+		data[i] = (char)('A' + i % 26);
+
+	key.data = data;
+	key.length = length;
+
+	for (i = 0; i < pConfig->warmupIterations; ++i)
+		sum += pFunction->sumFunction(&key);
+
+	/* Changes the key each time, so the hash cannot be hoisted out of the loop. */
+	microPerfStartCase();
+	startTime = rsslGetTimeNano();
+	for (i = 0; i < iterations; ++i)
+	{
+		data[0] = (char)i;
+		sum += pFunction->sumFunction(&key);
+	}
+	endTime = rsslGetTimeNano();
+
+	hashSink = sum;
+
+	snprintf(caseName, sizeof(caseName), "key/%s/%u", pFunction->name, length);
+	microPerfPrintResult("hash", caseName, iterations, endTime - startTime);
+}
+
+static void hashPerfRunItemOpen(const HashPerfFunction *pFunction, RsslBuffer *pKeys, RsslHashLink *pLinks, RsslUInt32 itemCount)
+{
+	RsslHashTable table;
+	RsslErrorInfo errorInfo;
+	RsslTimeValue startTime, endTime;
+	RsslUInt32 i, maxChain = 0;
+	char caseName[64];
+
+	/* Same initial size as the watchlist's table of open streams. */
+	if (rsslHashTableInit(&table, 100003, pFunction->sumFunction, rsslHashBufferCompare, RSSL_TRUE, &errorInfo) != RSSL_RET_SUCCESS)
+	{
+		printf("%-12s Failed to create hash table: %s\n", "hash", errorInfo.rsslError.text);
+		return;
+	}
+
+	microPerfStartCase();
+	startTime = rsslGetTimeNano();
+	for (i = 0; i < itemCount; ++i)
+	{
+		RsslUInt32 hashSum = table.keyHashFunction(&pKeys[i]);
+
+		if (rsslHashTableFind(&table, &pKeys[i], &hashSum) == NULL)
+		{
+			rsslHashLinkInit(&pLinks[i]);
+			rsslHashTableInsertLink(&table, &pLinks[i], &pKeys[i], &hashSum);
+		}
+	}
+	endTime = rsslGetTimeNano();
+
+	snprintf(caseName, sizeof(caseName), "item-open/%s/%u", pFunction->name, itemCount);
+	microPerfPrintResult("hash", caseName, itemCount, endTime - startTime);
+
+	microPerfStartCase();
+	startTime = rsslGetTimeNano();
+	for (i = 0; i < itemCount; ++i)
+		hashSink = (rsslHashTableFind(&table, &pKeys[i], NULL) != NULL);
+	endTime = rsslGetTimeNano();
+
+	snprintf(caseName, sizeof(caseName), "item-find/%s/%u", pFunction->name, itemCount);
+	microPerfPrintResult("hash", caseName, itemCount, endTime - startTime);
+
+	for (i = 0; i < table.queueCount; ++i)
+	{
+		if (table.queueList[i].count > maxChain)
+			maxChain = table.queueList[i].count;
+	}
+
+	snprintf(caseName, sizeof(caseName), "item-chain/%s/%u", pFunction->name, itemCount);
+	printf("%-12s %-40s Buckets: %u, Longest chain: %u\n", "hash", caseName, table.queueCount, maxChain);
+
+	rsslHashTableCleanup(&table);
+}
+
+void hashPerfRun(MicroPerfConfig *pConfig)
+{
+	RsslUInt32 maxItems = itemCounts[sizeof(itemCounts)/sizeof(RsslUInt32) - 1];
+	RsslBuffer *pKeys = (RsslBuffer*)malloc(maxItems * sizeof(RsslBuffer));
+	RsslHashLink *pLinks = (RsslHashLink*)malloc(maxItems * sizeof(RsslHashLink));
+	char *names = (char*)malloc(maxItems * 16);
+	RsslHashKernel kernel = rsslFastHashSelectedKernel();
+	RsslUInt32 i;
+	int j;
+
+	if (pKeys == NULL || pLinks == NULL || names == NULL)
+	{
+		printf("%-12s Failed to allocate items.\n", "hash");
+		free(pKeys);
+		free(pLinks);
+		free(names);
+		return;
+	}
+
+	printf("%-12s Selected kernel: %s\n", "hash", kernel == RSSL_HASH_KERNEL_CRC32C ? "crc32c" : "portable");
+
+	for (j = 0; j < (int)(sizeof(hashFunctions)/sizeof(HashPerfFunction)); ++j)
+	{
+		if (hashFunctions[j].sumFunction == crc32cHashBufferSum && !rsslFastHashKernelSupported(RSSL_HASH_KERNEL_CRC32C))
+		{
+			printf("%-12s Skipping %s: not supported on this machine.\n", "hash", hashFunctions[j].name);
+			continue;
+		}
+
+		for (i = 0; i < sizeof(keyLengths)/sizeof(RsslUInt32); ++i)
+			hashPerfRunKey(pConfig, &hashFunctions[j], keyLengths[i]);
+	}
+
+	/* Item names in the style of exchange symbols, which differ only in a few characters. */
+	for (i = 0; i < maxItems; ++i)
+	{
+		pKeys[i].data = names + i * 16;
+		pKeys[i].length = (RsslUInt32)snprintf(pKeys[i].data, 16, "RIC%07u.O", i);
+	}
+
+	for (i = 0; i < sizeof(itemCounts)/sizeof(RsslUInt32); ++i)
+	{
+		for (j = 0; j < (int)(sizeof(hashFunctions)/sizeof(HashPerfFunction)); ++j)
+		{
+			if (hashFunctions[j].sumFunction == crc32cHashBufferSum && !rsslFastHashKernelSupported(RSSL_HASH_KERNEL_CRC32C))
+				continue;
+
+			hashPerfRunItemOpen(&hashFunctions[j], pKeys, pLinks, itemCounts[i]);
+		}
+	}
+
+	free(pKeys);
+	free(pLinks);
+	free(names);
+}
@@ -0,0 +1,469 @@
+/*
+ * This source code is provided under the Apache 2.0 license and is provided
+ * AS IS with no warranty or guarantee of fit for purpose.  See the project's
+ * LICENSE.md for details.
+ * Copyright (C) 2022 Refinitiv. All rights reserved.
+*/
+
+/* jsonPerf.c
+ * Measures conversion of RWF update messages to simplified JSON: MarketPrice updates,
+ * MarketByOrder updates, and a mix of both. Each message is decoded from its
+ * encoded RWF and converted, as a WebSocket provider does for each update.
+ * Also measures conversion of JSON arrays of MarketPrice updates back to RWF, as
+ * a WebSocket provider does for batches of posts from its clients. */
+
+#include "microPerf.h"
+#include "rtr/rsslDataPackage.h"
+#include "rtr/rsslMessagePackage.h"
+#include "rtr/rsslJsonConverter.h"
+
+#define JSON_PERF_DICTIONARY_FILE "RDMFieldDictionary"
+
+/* Number of orders in each MarketByOrder update. */
+#define JSON_PERF_ORDERS 10
+
+/* The mix has this many MarketPrice updates for each MarketByOrder update. */
+#define JSON_PERF_MIX_MARKET_PRICE 4
+
+#define JSON_PERF_MSG_SIZE 4096
+
+/* Largest number of messages in the JSON arrays converted to RWF. */
+#define JSON_PERF_MAX_ARRAY_MSGS 10000
+
+/* Keeps the compiler from optimizing away the converted messages. */
+static volatile RsslUInt64 jsonSink;
+
+/* Encodes the fields of a MarketPrice update: prices and sizes with exponent hints, a
+ * net change with a fraction hint, and a date, times, an enumeration and a string. */
+static RsslRet jsonPerfEncodeMarketPrice(RsslEncodeIterator *pIter, RsslUInt32 seed)
+{
+	RsslFieldList fieldList;
+	RsslFieldEntry fieldEntry;
+	RsslReal real;
+	RsslDate date;
+	RsslTime time;
+	RsslEnum enumValue = 1;
+	RsslBuffer name = { 11, (char*)"TRI.N Index" };
+	RsslRet ret;
+
+	static const struct { RsslFieldId fieldId; RsslRealHints hint; RsslInt64 value; } reals[] =
+	{
+		{ 22, RSSL_RH_EXPONENT_2, 3995 },		/* BID */
+		{ 25, RSSL_RH_EXPONENT_2, 3997 },		/* ASK */
+		{ 30, RSSL_RH_EXPONENT0, 1200 },		/* BIDSIZE */
+		{ 31, RSSL_RH_EXPONENT0, 800 },			/* ASKSIZE */
+		{ 6, RSSL_RH_EXPONENT_4, 399625 },		/* TRDPRC_1 */
+		{ 32, RSSL_RH_EXPONENT0, 1543210 },		/* ACVOL_1 */
+		{ 11, RSSL_RH_FRACTION_8, -3 },			/* NETCHNG_1 */
+		{ 12, RSSL_RH_EXPONENT_2, 4012 },		/* HIGH_1 */
+		{ 13, RSSL_RH_EXPONENT_2, 3981 }		/* LOW_1 */
+	};
+	RsslUInt32 i;
+
+	rsslClearFieldList(&fieldList);
+	fieldList.flags = RSSL_FLF_HAS_STANDARD_DATA;
+	if ((ret = rsslEncodeFieldListInit(pIter, &fieldList, NULL, 0)) < RSSL_RET_SUCCESS)
+		return ret;
+
+	for (i = 0; i < sizeof(reals)/sizeof(reals[0]); ++i)
+	{
+		rsslClearFieldEntry(&fieldEntry);
+		fieldEntry.fieldId = reals[i].fieldId;
+		fieldEntry.dataType = RSSL_DT_REAL;
+		rsslClearReal(&real);
+		real.hint = reals[i].hint;
+		real.value = reals[i].value + (RsslInt64)(seed % 7);
+		if ((ret = rsslEncodeFieldEntry(pIter, &fieldEntry, &real)) < RSSL_RET_SUCCESS)
+			return ret;
+	}
+
+	rsslClearFieldEntry(&fieldEntry);
+	fieldEntry.fieldId = 16; /* TRADE_DATE */
+	fieldEntry.dataType = RSSL_DT_DATE;
+	date.day = 17;
+	date.month = 10;
+	date.year = 2022;
+	if ((ret = rsslEncodeFieldEntry(pIter, &fieldEntry, &date)) < RSSL_RET_SUCCESS)
+		return ret;
+
+	rsslClearFieldEntry(&fieldEntry);
+	fieldEntry.fieldId = 1025; /* QUOTIM */
+	fieldEntry.dataType = RSSL_DT_TIME;
+	rsslClearTime(&time);
+	time.hour = 14;
+	time.minute = 30;
+	time.second = (RsslUInt8)(seed % 60);
+	if ((ret = rsslEncodeFieldEntry(pIter, &fieldEntry, &time)) < RSSL_RET_SUCCESS)
+		return ret;
+
+	rsslClearFieldEntry(&fieldEntry);
+	fieldEntry.fieldId = 4; /* RDN_EXCHID */
+	fieldEntry.dataType = RSSL_DT_ENUM;
+	if ((ret = rsslEncodeFieldEntry(pIter, &fieldEntry, &enumValue)) < RSSL_RET_SUCCESS)
+		return ret;
+
+	rsslClearFieldEntry(&fieldEntry);
+	fieldEntry.fieldId = 3; /* DSPLY_NAME */
+	fieldEntry.dataType = RSSL_DT_RMTES_STRING;
+	if ((ret = rsslEncodeFieldEntry(pIter, &fieldEntry, &name)) < RSSL_RET_SUCCESS)
+		return ret;
+
+	return rsslEncodeFieldListComplete(pIter, RSSL_TRUE);
+}
+
+/* Encodes a map of orders, each with a price, side, size and priority time. */
+static RsslRet jsonPerfEncodeMarketByOrder(RsslEncodeIterator *pIter, RsslUInt32 seed)
+{
+	RsslMap map;
+	RsslMapEntry mapEntry;
+	RsslFieldList fieldList;
+	RsslFieldEntry fieldEntry;
+	RsslReal real;
+	RsslEnum side;
+	RsslUInt timeMs;
+	char orderIdData[16];
+	RsslBuffer orderId;
+	RsslUInt32 i;
+	RsslRet ret;
+
+	rsslClearMap(&map);
+	map.keyPrimitiveType = RSSL_DT_BUFFER;
+	map.containerType = RSSL_DT_FIELD_LIST;
+	if ((ret = rsslEncodeMapInit(pIter, &map, 0, 0)) < RSSL_RET_SUCCESS)
+		return ret;
+
+	for (i = 0; i < JSON_PERF_ORDERS; ++i)
+	{
+		orderId.data = orderIdData;
+		orderId.length = (RsslUInt32)snprintf(orderIdData, sizeof(orderIdData), "%u", 100000 + seed * JSON_PERF_ORDERS + i);
+
+		rsslClearMapEntry(&mapEntry);
+		mapEntry.action = (i % 3) ? RSSL_MPEA_UPDATE_ENTRY : RSSL_MPEA_ADD_ENTRY;
+		if ((ret = rsslEncodeMapEntryInit(pIter, &mapEntry, &orderId, 0)) < RSSL_RET_SUCCESS)
+			return ret;
+
+		rsslClearFieldList(&fieldList);
+		fieldList.flags = RSSL_FLF_HAS_STANDARD_DATA;
+		if ((ret = rsslEncodeFieldListInit(pIter, &fieldList, NULL, 0)) < RSSL_RET_SUCCESS)
+			return ret;
+
+		rsslClearFieldEntry(&fieldEntry);
+		fieldEntry.fieldId = 3427; /* ORDER_PRC */
+		fieldEntry.dataType = RSSL_DT_REAL;
+		rsslClearReal(&real);
+		real.hint = RSSL_RH_EXPONENT_2;
+		real.value = 3990 + i;
+		if ((ret = rsslEncodeFieldEntry(pIter, &fieldEntry, &real)) < RSSL_RET_SUCCESS)
+			return ret;
+
+		rsslClearFieldEntry(&fieldEntry);
+		fieldEntry.fieldId = 3428; /* ORDER_SIDE */
+		fieldEntry.dataType = RSSL_DT_ENUM;
+		side = (RsslEnum)(1 + i % 2);
+		if ((ret = rsslEncodeFieldEntry(pIter, &fieldEntry, &side)) < RSSL_RET_SUCCESS)
+			return ret;
+
+		rsslClearFieldEntry(&fieldEntry);
+		fieldEntry.fieldId = 3429; /* ORDER_SIZE */
+		fieldEntry.dataType = RSSL_DT_REAL;
+		rsslClearReal(&real);
+		real.hint = RSSL_RH_EXPONENT0;
+		real.value = 100 * (i + 1);
+		if ((ret = rsslEncodeFieldEntry(pIter, &fieldEntry, &real)) < RSSL_RET_SUCCESS)
+			return ret;
+
+		rsslClearFieldEntry(&fieldEntry);
+		fieldEntry.fieldId = 6520; /* PR_TIM_MS */
+		fieldEntry.dataType = RSSL_DT_UINT;
+		timeMs = 52200000 + seed * 10 + i;
+		if ((ret = rsslEncodeFieldEntry(pIter, &fieldEntry, &timeMs)) < RSSL_RET_SUCCESS)
+			return ret;
+
+		if ((ret = rsslEncodeFieldListComplete(pIter, RSSL_TRUE)) < RSSL_RET_SUCCESS)
+			return ret;
+
+		if ((ret = rsslEncodeMapEntryComplete(pIter, RSSL_TRUE)) < RSSL_RET_SUCCESS)
+			return ret;
+	}
+
+	return rsslEncodeMapComplete(pIter, RSSL_TRUE);
+}
+
+static RsslRet jsonPerfEncodeUpdate(RsslBuffer *pBuffer, RsslUInt8 domainType, RsslUInt32 seed)
+{
+	RsslEncodeIterator encIter;
+	RsslUpdateMsg updateMsg;
+	RsslRet ret;
+
+	rsslClearEncodeIterator(&encIter);
+	rsslSetEncodeIteratorBuffer(&encIter, pBuffer);
+	rsslSetEncodeIteratorRWFVersion(&encIter, RSSL_RWF_MAJOR_VERSION, RSSL_RWF_MINOR_VERSION);
+
+	rsslClearUpdateMsg(&updateMsg);
+	updateMsg.msgBase.streamId = 5 + seed;
+	updateMsg.msgBase.domainType = domainType;
+	updateMsg.msgBase.containerType = (domainType == RSSL_DMT_MARKET_PRICE) ? RSSL_DT_FIELD_LIST : RSSL_DT_MAP;
+	updateMsg.updateType = RDM_UPD_EVENT_TYPE_QUOTE;
+
+	if ((ret = rsslEncodeMsgInit(&encIter, (RsslMsg*)&updateMsg, 0)) < RSSL_RET_SUCCESS)
+		return ret;
+
+	if (domainType == RSSL_DMT_MARKET_PRICE)
+		ret = jsonPerfEncodeMarketPrice(&encIter, seed);
+	else
+		ret = jsonPerfEncodeMarketByOrder(&encIter, seed);
+
+	if (ret < RSSL_RET_SUCCESS)
+		return ret;
+
+	if ((ret = rsslEncodeMsgComplete(&encIter, RSSL_TRUE)) < RSSL_RET_SUCCESS)
+		return ret;
+
+	pBuffer->length = rsslGetEncodedBufferLength(&encIter);
+	return RSSL_RET_SUCCESS;
+}
+
+/* Decodes and converts one message. Returns the length of the JSON message, or 0 on failure. */
+static RsslUInt32 jsonPerfConvert(RsslJsonConverter converter, RsslBuffer *pBuffer)
+{
+	RsslDecodeIterator decIter;
+	RsslMsg msg;
+	RsslConvertRsslMsgToJsonOptions convertOptions;
+	RsslGetJsonMsgOptions getOptions;
+	RsslJsonConverterError error;
+	RsslBuffer jsonBuffer;
+
+	rsslClearDecodeIterator(&decIter);
+	rsslSetDecodeIteratorBuffer(&decIter, pBuffer);
+	rsslSetDecodeIteratorRWFVersion(&decIter, RSSL_RWF_MAJOR_VERSION, RSSL_RWF_MINOR_VERSION);
+	if (rsslDecodeMsg(&decIter, &msg) != RSSL_RET_SUCCESS)
+		return 0;
+
+	rsslClearConvertRsslMsgToJsonOptions(&convertOptions);
+	convertOptions.jsonProtocolType = RSSL_JSON_JPT_JSON2;
+	if (rsslConvertRsslMsgToJson(converter, &convertOptions, &msg, &error) != RSSL_RET_SUCCESS)
+		return 0;
+
+	rsslClearGetJsonMsgOptions(&getOptions);
+	getOptions.streamId = msg.msgBase.streamId;
+	getOptions.jsonProtocolType = RSSL_JSON_JPT_JSON2;
+	if (rsslGetConverterJsonMsg(converter, &getOptions, &jsonBuffer, &error) != RSSL_RET_SUCCESS)
+		return 0;
+
+	return jsonBuffer.length;
+}
+
+static void jsonPerfRunCase(MicroPerfConfig *pConfig, RsslJsonConverter converter, const char *caseName, RsslBuffer *pBuffers, RsslUInt32 bufferCount)
+{
+	RsslUInt32 iterations = microPerfIterations(pConfig, 500000);
+	RsslTimeValue startTime, endTime;
+	RsslUInt64 jsonBytes = 0;
+	RsslUInt32 i, length;
+
+	for (i = 0; i < pConfig->warmupIterations; ++i)
+		jsonBytes += jsonPerfConvert(converter, &pBuffers[i % bufferCount]);
+
+	jsonBytes = 0;
+	microPerfStartCase();
+	startTime = rsslGetTimeNano();
+	for (i = 0; i < iterations; ++i)
+	{
+		if ((length = jsonPerfConvert(converter, &pBuffers[i % bufferCount])) == 0)
+		{
+			printf("%-12s %s: Failed to convert message.\n", "json", caseName);
+			return;
+		}
+		jsonBytes += length;
+	}
+	endTime = rsslGetTimeNano();
+
+	jsonSink = jsonBytes;
+
+	microPerfPrintResult("json", caseName, iterations, endTime - startTime);
+	printf("%-12s %-40s %12.1f JSON bytes/msg %11.1f MB/sec\n", "json", caseName,
+			(double)jsonBytes / iterations,
+			endTime > startTime ? (double)jsonBytes * 1000.0 / (double)(endTime - startTime) : 0.0);
+}
+
+/* Parses a JSON array and converts each of its messages to RWF. Returns the number of messages, or 0 on failure. */
+static RsslUInt32 jsonPerfConvertArray(RsslJsonConverter converter, RsslBuffer *pJsonArray)
+{
+	RsslParseJsonBufferOptions parseOptions;
+	RsslDecodeJsonMsgOptions decodeOptions;
+	RsslJsonMsg jsonMsg;
+	RsslBuffer rwfBuffer;
+	RsslJsonConverterError error;
+	RsslUInt32 msgCount = 0;
+	RsslRet ret;
+
+	rsslClearParseJsonBufferOptions(&parseOptions);
+	parseOptions.jsonProtocolType = RSSL_JSON_JPT_JSON2;
+	if (rsslParseJsonBuffer(converter, &parseOptions, pJsonArray, &error) < RSSL_RET_SUCCESS)
+		return 0;
+
+	rsslClearDecodeJsonMsgOptions(&decodeOptions);
+	decodeOptions.jsonProtocolType = RSSL_JSON_JPT_JSON2;
+	while ((ret = rsslDecodeJsonMsg(converter, &decodeOptions, &jsonMsg, &rwfBuffer, &error)) == RSSL_RET_SUCCESS)
+	{
+		if (jsonMsg.msgBase.msgClass != RSSL_JSON_MC_RSSL_MSG)
+			return 0;
+		++msgCount;
+	}
+
+	return (ret == RSSL_RET_END_OF_CONTAINER) ? msgCount : 0;
+}
+
+static void jsonPerfRunArrayCase(MicroPerfConfig *pConfig, RsslJsonConverter converter, const char *caseName, RsslBuffer *pJsonArray, RsslUInt32 arrayMsgs)
+{
+	/* Iterations are counted in messages, so each array size converts about the same number of messages. */
+	RsslUInt32 iterations = microPerfIterations(pConfig, 200000);
+	RsslUInt32 arrayCount = iterations > arrayMsgs ? iterations / arrayMsgs : 1;
+	RsslUInt32 warmupCount = pConfig->warmupIterations > arrayMsgs ? pConfig->warmupIterations / arrayMsgs : 1;
+	RsslTimeValue startTime, endTime;
+	RsslUInt32 i;
+
+	for (i = 0; i < warmupCount; ++i)
+		jsonSink += jsonPerfConvertArray(converter, pJsonArray);
+
+	microPerfStartCase();
+	startTime = rsslGetTimeNano();
+	for (i = 0; i < arrayCount; ++i)
+	{
+		if (jsonPerfConvertArray(converter, pJsonArray) != arrayMsgs)
+		{
+			printf("%-12s %s: Failed to convert JSON array.\n", "json", caseName);
+			return;
+		}
+	}
+	endTime = rsslGetTimeNano();
+
+	microPerfPrintResult("json", caseName, (RsslUInt64)arrayCount * arrayMsgs, endTime - startTime);
+}
+
+void jsonPerfRun(MicroPerfConfig *pConfig)
+{
+	RsslDataDictionary dictionary;
+	RsslDataDictionary *dictionaryList[1];
+	RsslBuffer errorText;
+	char errorTextData[256];
+	RsslCreateJsonConverterOptions createOptions;
+	RsslJsonDictionaryListProperty dictionaryListProperty;
+	RsslJsonConverterError error;
+	RsslJsonConverter converter;
+	RsslGetJsonMsgOptions getOptions;
+	RsslConvertRsslMsgToJsonOptions convertOptions;
+	RsslDecodeIterator decIter;
+	RsslMsg msg;
+	char data[JSON_PERF_MIX_MARKET_PRICE + 1][JSON_PERF_MSG_SIZE];
+	RsslBuffer buffers[JSON_PERF_MIX_MARKET_PRICE + 1];
+	static const RsslUInt32 arraySizes[] = { 1, 100, JSON_PERF_MAX_ARRAY_MSGS };
+	RsslBuffer jsonMsg;
+	RsslBuffer jsonArray;
+	RsslBool parseArrayElements;
+	char caseName[64];
+	RsslUInt32 i, j;
+
+	errorText.data = errorTextData;
+	errorText.length = sizeof(errorTextData);
+
+	rsslClearDataDictionary(&dictionary);
+	if (rsslLoadFieldDictionary(JSON_PERF_DICTIONARY_FILE, &dictionary, &errorText) != RSSL_RET_SUCCESS)
+	{
+		printf("%-12s Skipped: could not load %s: %.*s\n", "json", JSON_PERF_DICTIONARY_FILE, errorText.length, errorText.data);
+		return;
+	}
+
+	rsslJsonInitialize();
+
+	rsslClearCreateRsslJsonConverterOptions(&createOptions);
+	if ((converter = rsslCreateRsslJsonConverter(&createOptions, &error)) == NULL)
+	{
+		printf("%-12s Failed to create converter: %s\n", "json", error.text);
+		rsslJsonUninitialize();
+		rsslDeleteDataDictionary(&dictionary);
+		return;
+	}
+
+	dictionaryList[0] = &dictionary;
+	rsslClearConverterDictionaryListProperty(&dictionaryListProperty);
+	dictionaryListProperty.dictionaryListLength = 1;
+	dictionaryListProperty.pDictionaryList = dictionaryList;
+	if (rsslJsonConverterSetProperty(converter, RSSL_JSON_CPC_DICTIONARY_LIST, &dictionaryListProperty, &error) != RSSL_RET_SUCCESS)
+	{
+		printf("%-12s Failed to set dictionary: %s\n", "json", error.text);
+		goto cleanup;
+	}
+
+	/* The first buffers are MarketPrice updates, and the last is a MarketByOrder update. */
+	for (i = 0; i <= JSON_PERF_MIX_MARKET_PRICE; ++i)
+	{
+		buffers[i].data = data[i];
+		buffers[i].length = JSON_PERF_MSG_SIZE;
+
+		if (jsonPerfEncodeUpdate(&buffers[i], (i < JSON_PERF_MIX_MARKET_PRICE) ? RSSL_DMT_MARKET_PRICE : RSSL_DMT_MARKET_BY_ORDER, i) != RSSL_RET_SUCCESS)
+		{
+			printf("%-12s Failed to encode messages.\n", "json");
+			goto cleanup;
+		}
+	}
+
+	jsonPerfRunCase(pConfig, converter, "marketprice", buffers, JSON_PERF_MIX_MARKET_PRICE);
+	jsonPerfRunCase(pConfig, converter, "marketbyorder", &buffers[JSON_PERF_MIX_MARKET_PRICE], 1);
+	jsonPerfRunCase(pConfig, converter, "mix/4-marketprice-1-marketbyorder", buffers, JSON_PERF_MIX_MARKET_PRICE + 1);
+
+	/* Convert a MarketPrice update to JSON, and repeat it to build the arrays converted back to RWF. */
+	rsslClearDecodeIterator(&decIter);
+	rsslSetDecodeIteratorBuffer(&decIter, &buffers[0]);
+	rsslSetDecodeIteratorRWFVersion(&decIter, RSSL_RWF_MAJOR_VERSION, RSSL_RWF_MINOR_VERSION);
+	rsslClearConvertRsslMsgToJsonOptions(&convertOptions);
+	convertOptions.jsonProtocolType = RSSL_JSON_JPT_JSON2;
+	rsslClearGetJsonMsgOptions(&getOptions);
+	getOptions.jsonProtocolType = RSSL_JSON_JPT_JSON2;
+	if (rsslDecodeMsg(&decIter, &msg) != RSSL_RET_SUCCESS
+			|| rsslConvertRsslMsgToJson(converter, &convertOptions, &msg, &error) != RSSL_RET_SUCCESS
+			|| rsslGetConverterJsonMsg(converter, &getOptions, &jsonMsg, &error) != RSSL_RET_SUCCESS)
+	{
+		printf("%-12s Failed to convert message to JSON.\n", "json");
+		goto cleanup;
+	}
+
+	if ((jsonArray.data = (char*)malloc((size_t)JSON_PERF_MAX_ARRAY_MSGS * (jsonMsg.length + 1) + 2)) == NULL)
+	{
+		printf("%-12s Failed to allocate JSON array.\n", "json");
+		goto cleanup;
+	}
+
+	/* Each array size is measured parsing the whole array at once, and then parsing it one message at a time. */
+	for (parseArrayElements = RSSL_FALSE; parseArrayElements <= RSSL_TRUE; ++parseArrayElements)
+	{
+		if (rsslJsonConverterSetProperty(converter, RSSL_JSON_CPC_PARSE_ARRAY_ELEMENTS, &parseArrayElements, &error) != RSSL_RET_SUCCESS)
+		{
+			printf("%-12s Failed to set array parsing: %s\n", "json", error.text);
+			break;
+		}
+
+		for (i = 0; i < sizeof(arraySizes)/sizeof(arraySizes[0]); ++i)
+		{
+			jsonArray.length = 0;
+			jsonArray.data[jsonArray.length++] = '[';
+			for (j = 0; j < arraySizes[i]; ++j)
+			{
+				if (j > 0)
+					jsonArray.data[jsonArray.length++] = ',';
+				memcpy(jsonArray.data + jsonArray.length, jsonMsg.data, jsonMsg.length);
+				jsonArray.length += jsonMsg.length;
+			}
+			jsonArray.data[jsonArray.length++] = ']';
+
+			snprintf(caseName, sizeof(caseName), "to-rwf/array-%u%s", arraySizes[i], parseArrayElements ? "/elements" : "");
+			jsonPerfRunArrayCase(pConfig, converter, caseName, &jsonArray, arraySizes[i]);
+		}
+	}
+
+	free(jsonArray.data);
+
+cleanup:
+	rsslDestroyRsslJsonConverter(converter, &error);
+	rsslJsonUninitialize();
+	rsslDeleteDataDictionary(&dictionary);
+}
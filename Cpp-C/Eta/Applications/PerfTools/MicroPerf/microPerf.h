@@ -0,0 +1,77 @@
+/*
+ * This source code is provided under the Apache 2.0 license and is provided
+ * AS IS with no warranty or guarantee of fit for purpose.  See the project's
+ * LICENSE.md for details.
+ * Copyright (C) 2022 Refinitiv. All rights reserved.
+*/
+
+/* microPerf.h
+ * Common definitions for the MicroPerf application. Each suite measures a single
+ * library hot path in isolation and prints one line of results per case. */
+
+#ifndef _ETAC_MICRO_PERF_H
+#define _ETAC_MICRO_PERF_H
+
+#include "statistics.h"
+#include "rtr/rsslTypes.h"
+#include "rtr/rsslGetTime.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Configuration shared by all suites. */
+typedef struct {
+	RsslUInt32	iterations;		/* Number of timed iterations per case. 0 uses the suite's default. */
+	RsslUInt32	warmupIterations;	/* Number of untimed iterations run before each case. */
+	const char	*corpusFile;		/* File of captured messages for the codec suite, or NULL. */
+} MicroPerfConfig;
+
+/* Describes a suite. */
+typedef struct {
+	const char	*name;			/* Name used to select the suite with -suite. */
+	const char	*description;	/* Description displayed by -?. */
+	void		(*runSuite)(MicroPerfConfig *pConfig);
+} MicroPerfSuite;
+
+/* Returns the iteration count to use for a case. */
+RTR_C_INLINE RsslUInt32 microPerfIterations(MicroPerfConfig *pConfig, RsslUInt32 defaultIterations)
+{
+	return pConfig->iterations ? pConfig->iterations : defaultIterations;
+}
+
+/* Marks the start of a case's timed operations. Allocations made from here until the
+ * case's result is printed are reported per operation. */
+void microPerfStartCase();
+
+/* Prints the per-operation cost of a case that was timed as a whole. */
+void microPerfPrintResult(const char *suiteName, const char *caseName, RsslUInt64 operations, RsslTimeValue elapsedNsec);
+
+/* Prints statistics of a case that was timed per operation. Values are in microseconds. */
+void microPerfPrintStats(const char *suiteName, const char *caseName, ValueStatistics *pStats);
+
+/* Returns RSSL_TRUE if heap allocations are counted on this platform. */
+RsslBool microPerfAllocCountAvailable();
+
+/* Returns the number of heap allocations made so far by the process. */
+RsslUInt64 microPerfAllocCount();
+
+/* Suites */
+void notifierPerfRun(MicroPerfConfig *pConfig);
+void wsMaskPerfRun(MicroPerfConfig *pConfig);
+void hashPerfRun(MicroPerfConfig *pConfig);
+void fieldListPerfRun(MicroPerfConfig *pConfig);
+void jsonPerfRun(MicroPerfConfig *pConfig);
+void codecPerfRun(MicroPerfConfig *pConfig);
+void eventQueuePerfRun(MicroPerfConfig *pConfig);
+void fanoutPerfRun(MicroPerfConfig *pConfig);
+void reactorPerfRun(MicroPerfConfig *pConfig);
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif
@@ -0,0 +1,69 @@
+/*
+ * This source code is provided under the Apache 2.0 license and is provided
+ * AS IS with no warranty or guarantee of fit for purpose.  See the project's
+ * LICENSE.md for details.
+ * Copyright (C) 2022 Refinitiv. All rights reserved.
+*/
+
+/* microPerfAlloc.c
+ * Counts heap allocations, so that each case can report its allocations per operation.
+ * With glibc, malloc and its relatives are replaced by wrappers that count each call
+ * and then call the glibc implementation. Elsewhere, allocations are not counted. */
+
+#include "microPerf.h"
+
+#if defined(__GLIBC__)
+
+extern void *__libc_malloc(size_t size);
+extern void *__libc_calloc(size_t count, size_t size);
+extern void *__libc_realloc(void *ptr, size_t size);
+extern void __libc_free(void *ptr);
+
+static volatile RsslUInt64 allocCount = 0;
+
+void *malloc(size_t size)
+{
+	__sync_fetch_and_add(&allocCount, 1);
+	return __libc_malloc(size);
+}
+
+void *calloc(size_t count, size_t size)
+{
+	__sync_fetch_and_add(&allocCount, 1);
+	return __libc_calloc(count, size);
+}
+
+void *realloc(void *ptr, size_t size)
+{
+	__sync_fetch_and_add(&allocCount, 1);
+	return __libc_realloc(ptr, size);
+}
+
+void free(void *ptr)
+{
+	__libc_free(ptr);
+}
+
+RsslBool microPerfAllocCountAvailable()
+{
+	return RSSL_TRUE;
+}
+
+RsslUInt64 microPerfAllocCount()
+{
+	return __sync_fetch_and_add(&allocCount, 0);
+}
+
+#else
+
+RsslBool microPerfAllocCountAvailable()
+{
+	return RSSL_FALSE;
+}
+
+RsslUInt64 microPerfAllocCount()
+{
+	return 0;
+}
+
+#endif
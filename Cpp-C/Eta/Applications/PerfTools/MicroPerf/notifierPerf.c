@@ -0,0 +1,172 @@
+/*
+ * This source code is provided under the Apache 2.0 license and is provided
+ * AS IS with no warranty or guarantee of fit for purpose.  See the project's
+ * LICENSE.md for details.
+ * Copyright (C) 2022 Refinitiv. All rights reserved.
+*/
+
+/* notifierPerf.c
+ * Measures the cost of rsslNotifierWait when one channel out of many has data,
+ * which is the common case for a reactor holding mostly idle channels. */
+
+#include "microPerf.h"
+#include "rtr/rsslNotifier.h"
+
+#ifndef WIN32
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/resource.h>
+#endif
+
+typedef struct {
+	const char			*name;
+	RsslNotifierMode	mode;
+} NotifierPerfMode;
+
+static const NotifierPerfMode notifierModes[] =
+{
+	{ "poll", RSSL_NOTIFIER_MODE_POLL },
+#ifdef RSSL_NOTIFIER_EPOLL
+	{ "epoll-level", RSSL_NOTIFIER_MODE_EPOLL_LEVEL },
+	{ "epoll-edge", RSSL_NOTIFIER_MODE_EPOLL_EDGE },
+#endif
+};
+
+static const int channelCounts[] = { 10, 100, 1000, 5000 };
+
+#ifndef WIN32
+
+/* Makes sure enough descriptors are available for the given number of channels. */
+static RsslBool notifierPerfReserveDescriptors(int channelCount)
+{
+	struct rlimit fdLimit;
+	rlim_t required = (rlim_t)channelCount * 2 + 64;
+
+	if (getrlimit(RLIMIT_NOFILE, &fdLimit) < 0)
+		return RSSL_FALSE;
+
+	if (fdLimit.rlim_cur >= required)
+		return RSSL_TRUE;
+
+	if (fdLimit.rlim_max != RLIM_INFINITY && fdLimit.rlim_max < required)
+		return RSSL_FALSE;
+
+	fdLimit.rlim_cur = required;
+	return setrlimit(RLIMIT_NOFILE, &fdLimit) == 0 ? RSSL_TRUE : RSSL_FALSE;
+}
+
+static void notifierPerfRunCase(MicroPerfConfig *pConfig, const NotifierPerfMode *pMode, int (*channelFds)[2], int channelCount)
+{
+	RsslNotifier *pNotifier;
+	RsslNotifierEvent **pEvents;
+	ValueStatistics waitStats;
+	RsslUInt32 iterations = microPerfIterations(pConfig, 20000);
+	RsslUInt32 i;
+	int j;
+	char caseName[64];
+	char byte = 0;
+
+	if ((pNotifier = rsslCreateNotifierWithMode(channelCount, pMode->mode)) == NULL)
+	{
+		printf("Failed to create notifier.\n");
+		return;
+	}
+
+	pEvents = (RsslNotifierEvent**)malloc(channelCount * sizeof(RsslNotifierEvent*));
+
+	for (j = 0; j < channelCount; ++j)
+	{
+		pEvents[j] = rsslCreateNotifierEvent();
+		rsslNotifierAddEvent(pNotifier, pEvents[j], channelFds[j][0], pEvents[j]);
+		rsslNotifierRegisterRead(pNotifier, pEvents[j]);
+	}
+
+	clearValueStatistics(&waitStats);
+
+	for (i = 0; i < pConfig->warmupIterations + iterations; ++i)
+	{
+		int channel = rand() % channelCount;
+		RsslTimeValue startTime, endTime;
+
+		if (write(channelFds[channel][1], &byte, 1) != 1)
+			break;
+
+		startTime = rsslGetTimeNano();
+		rsslNotifierWait(pNotifier, 0);
+		endTime = rsslGetTimeNano();
+
+		if (i >= pConfig->warmupIterations)
+			updateValueStatistics(&waitStats, (double)(endTime - startTime) / 1000.0);
+
+		if (pNotifier->notifiedEventCount != 1 || pNotifier->notifiedEvents[0] != pEvents[channel])
+			printf("Unexpected notification on iteration %u.\n", i);
+
+		if (read(channelFds[channel][0], &byte, 1) != 1)
+			break;
+
+		rsslNotifierEventClearNotifiedFlags(pEvents[channel]);
+	}
+
+	snprintf(caseName, sizeof(caseName), "wait/%s/%d-channels", pMode->name, channelCount);
+	microPerfPrintStats("notifier", caseName, &waitStats);
+
+	for (j = 0; j < channelCount; ++j)
+	{
+		rsslNotifierRemoveEvent(pNotifier, pEvents[j]);
+		rsslDestroyNotifierEvent(pEvents[j]);
+	}
+
+	free(pEvents);
+	rsslDestroyNotifier(pNotifier);
+}
+
+void notifierPerfRun(MicroPerfConfig *pConfig)
+{
+	int i, j, k;
+
+	for (i = 0; i < (int)(sizeof(channelCounts)/sizeof(int)); ++i)
+	{
+		int channelCount = channelCounts[i];
+		int (*channelFds)[2];
+
+		if (!notifierPerfReserveDescriptors(channelCount))
+		{
+			printf("%-12s Skipping %d channels: not enough file descriptors available.\n", "notifier", channelCount);
+			continue;
+		}
+
+		channelFds = (int (*)[2])malloc(channelCount * sizeof(int[2]));
+
+		for (j = 0; j < channelCount; ++j)
+		{
+			if (socketpair(AF_UNIX, SOCK_STREAM, 0, channelFds[j]) < 0)
+				break;
+		}
+
+		if (j == channelCount)
+		{
+			for (k = 0; k < (int)(sizeof(notifierModes)/sizeof(NotifierPerfMode)); ++k)
+				notifierPerfRunCase(pConfig, &notifierModes[k], channelFds, channelCount);
+		}
+		else
+			printf("%-12s Skipping %d channels: socketpair() failed.\n", "notifier", channelCount);
+
+		while (j > 0)
+		{
+			--j;
+			close(channelFds[j][0]);
+			close(channelFds[j][1]);
+		}
+
+		free(channelFds);
+	}
+}
+
+#else
+
+void notifierPerfRun(MicroPerfConfig *pConfig)
+{
+	printf("%-12s Not supported on this platform.\n", "notifier");
+}
+
+#endif
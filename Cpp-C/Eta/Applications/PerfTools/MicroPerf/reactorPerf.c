@@ -0,0 +1,378 @@
+/*
+ * This source code is provided under the Apache 2.0 license and is provided
+ * AS IS with no warranty or guarantee of fit for purpose.  See the project's
+ * LICENSE.md for details.
+ * Copyright (C) 2022 Refinitiv. All rights reserved.
+*/
+
+/* reactorPerf.c
+ * Measures the cost of rsslReactorDispatch on a consumer reactor holding 10, 100 and 2000
+ * mostly idle channels, both when no channel has data and when one channel has a message.
+ * The channels are connected over loopback to a provider reactor in the same process. */
+
+#include "microPerf.h"
+#include "rtr/rsslReactor.h"
+#include "rtr/rsslNotifier.h"
+
+#ifndef WIN32
+#include <sys/resource.h>
+#endif
+
+#define REACTOR_PERF_PORT "14099"
+
+#define REACTOR_PERF_STREAM_ID 5
+
+static const int channelCounts[] = { 10, 100, 2000 };
+
+typedef struct {
+	RsslReactor			*pReactor;
+	RsslReactorChannel	**pChannels;		/* Channels, indexed in the order they were connected. */
+	int					channelCount;		/* Number of channels that are up. */
+	RsslUInt64			msgCount;			/* Number of messages received. */
+} ReactorPerfSide;
+
+static ReactorPerfSide consumerSide;
+static ReactorPerfSide providerSide;
+
+/* Set while the reactors are destroyed, when the channels are expected to go down. */
+static RsslBool reactorPerfShuttingDown;
+
+#ifndef WIN32
+
+/* Makes sure enough descriptors are available for the given number of channels. */
+static RsslBool reactorPerfReserveDescriptors(int channelCount)
+{
+	struct rlimit fdLimit;
+	rlim_t required = (rlim_t)channelCount * 2 + 64;
+
+	if (getrlimit(RLIMIT_NOFILE, &fdLimit) < 0)
+		return RSSL_FALSE;
+
+	if (fdLimit.rlim_cur >= required)
+		return RSSL_TRUE;
+
+	if (fdLimit.rlim_max != RLIM_INFINITY && fdLimit.rlim_max < required)
+		return RSSL_FALSE;
+
+	fdLimit.rlim_cur = required;
+	return setrlimit(RLIMIT_NOFILE, &fdLimit) == 0 ? RSSL_TRUE : RSSL_FALSE;
+}
+
+#else
+
+static RsslBool reactorPerfReserveDescriptors(int channelCount)
+{
+	return RSSL_TRUE;
+}
+
+#endif
+
+static ReactorPerfSide *reactorPerfGetSide(RsslReactor *pReactor)
+{
+	return (pReactor == consumerSide.pReactor) ? &consumerSide : &providerSide;
+}
+
+static RsslReactorCallbackRet reactorPerfChannelEventCallback(RsslReactor *pReactor, RsslReactorChannel *pReactorChannel, RsslReactorChannelEvent *pEvent)
+{
+	ReactorPerfSide *pSide = reactorPerfGetSide(pReactor);
+
+	switch(pEvent->channelEventType)
+	{
+		case RSSL_RC_CET_CHANNEL_UP:
+			pSide->pChannels[(intptr_t)pReactorChannel->userSpecPtr] = pReactorChannel;
+			++pSide->channelCount;
+			break;
+		case RSSL_RC_CET_CHANNEL_DOWN:
+		case RSSL_RC_CET_CHANNEL_DOWN_RECONNECTING:
+			if (!reactorPerfShuttingDown)
+				printf("%-12s Channel unexpectedly went down.\n", "reactor");
+			break;
+		default:
+			break;
+	}
+
+	return RSSL_RC_CRET_SUCCESS;
+}
+
+static RsslReactorCallbackRet reactorPerfDefaultMsgCallback(RsslReactor *pReactor, RsslReactorChannel *pReactorChannel, RsslMsgEvent *pEvent)
+{
+	++reactorPerfGetSide(pReactor)->msgCount;
+	return RSSL_RC_CRET_SUCCESS;
+}
+
+/* Dispatches both reactors until the consumer and the provider each have the given number of channels up. */
+static RsslBool reactorPerfWaitForChannels(int channelCount)
+{
+	RsslReactorDispatchOptions dispatchOpts;
+	RsslErrorInfo errorInfo;
+	RsslTimeValue endTime = rsslGetTimeNano() + (RsslTimeValue)30 * 1000000000;
+
+	rsslClearReactorDispatchOptions(&dispatchOpts);
+	dispatchOpts.maxMessages = 100;
+
+	while (consumerSide.channelCount < channelCount || providerSide.channelCount < channelCount)
+	{
+		if (rsslGetTimeNano() > endTime
+				|| rsslReactorDispatch(consumerSide.pReactor, &dispatchOpts, &errorInfo) < RSSL_RET_SUCCESS
+				|| rsslReactorDispatch(providerSide.pReactor, &dispatchOpts, &errorInfo) < RSSL_RET_SUCCESS)
+			return RSSL_FALSE;
+	}
+
+	return RSSL_TRUE;
+}
+
+/* Connects channels from the consumer reactor to the provider reactor until there are the given number of them. */
+static RsslBool reactorPerfConnectChannels(RsslServer *pServer, RsslNotifier *pServerNotifier, int channelCount)
+{
+	RsslReactorConnectOptions connectOpts;
+	RsslReactorAcceptOptions acceptOpts;
+	RsslReactorOMMConsumerRole consumerRole;
+	RsslReactorOMMProviderRole providerRole;
+	RsslErrorInfo errorInfo;
+	int i;
+
+	rsslClearReactorConnectOptions(&connectOpts);
+	connectOpts.rsslConnectOptions.connectionInfo.unified.address = (char*)"localhost";
+	connectOpts.rsslConnectOptions.connectionInfo.unified.serviceName = (char*)REACTOR_PERF_PORT;
+	connectOpts.reconnectAttemptLimit = 0;
+
+	rsslClearReactorAcceptOptions(&acceptOpts);
+
+	rsslClearOMMConsumerRole(&consumerRole);
+	consumerRole.base.channelEventCallback = reactorPerfChannelEventCallback;
+	consumerRole.base.defaultMsgCallback = reactorPerfDefaultMsgCallback;
+
+	rsslClearOMMProviderRole(&providerRole);
+	providerRole.base.channelEventCallback = reactorPerfChannelEventCallback;
+	providerRole.base.defaultMsgCallback = reactorPerfDefaultMsgCallback;
+
+	for (i = consumerSide.channelCount; i < channelCount; ++i)
+	{
+		/* Each connection is accepted before the next is made, so both ends of a channel get the same index. */
+		connectOpts.rsslConnectOptions.userSpecPtr = (void*)(intptr_t)i;
+		acceptOpts.rsslAcceptOptions.userSpecPtr = (void*)(intptr_t)i;
+
+		if (rsslReactorConnect(consumerSide.pReactor, &connectOpts, (RsslReactorChannelRole*)&consumerRole, &errorInfo) != RSSL_RET_SUCCESS)
+			return RSSL_FALSE;
+
+		if (rsslNotifierWait(pServerNotifier, 1000000) <= 0)
+			return RSSL_FALSE;
+
+		if (rsslReactorAccept(providerSide.pReactor, pServer, &acceptOpts, (RsslReactorChannelRole*)&providerRole, &errorInfo) != RSSL_RET_SUCCESS)
+			return RSSL_FALSE;
+
+		/* Keep the number of channels being initialized small. */
+		if ((i + 1) % 100 == 0 && !reactorPerfWaitForChannels(i + 1))
+			return RSSL_FALSE;
+	}
+
+	return reactorPerfWaitForChannels(channelCount);
+}
+
+static RsslRet reactorPerfSubmitUpdate(RsslReactorChannel *pReactorChannel)
+{
+	RsslReactorSubmitMsgOptions submitOpts;
+	RsslUpdateMsg updateMsg;
+	RsslErrorInfo errorInfo;
+
+	rsslClearUpdateMsg(&updateMsg);
+	updateMsg.msgBase.streamId = REACTOR_PERF_STREAM_ID;
+	updateMsg.msgBase.domainType = RSSL_DMT_MARKET_PRICE;
+	updateMsg.msgBase.containerType = RSSL_DT_NO_DATA;
+
+	rsslClearReactorSubmitMsgOptions(&submitOpts);
+	submitOpts.pRsslMsg = (RsslMsg*)&updateMsg;
+
+	return rsslReactorSubmitMsg(providerSide.pReactor, pReactorChannel, &submitOpts, &errorInfo);
+}
+
+/* Waits until a consumer channel has data to read. The provider reactor is dispatched meanwhile,
+ * so that it processes the events of its worker flushing the message. */
+static RsslBool reactorPerfWaitForMessage(RsslNotifier *pChannelNotifier, RsslNotifierEvent *pChannelEvent, RsslReactorChannel *pConsumerChannel)
+{
+	RsslReactorDispatchOptions dispatchOpts;
+	RsslErrorInfo errorInfo;
+	int i;
+
+	rsslClearReactorDispatchOptions(&dispatchOpts);
+
+	rsslNotifierUpdateEventFd(pChannelNotifier, pChannelEvent, pConsumerChannel->socketId);
+	rsslNotifierRegisterRead(pChannelNotifier, pChannelEvent);
+
+	for (i = 0; i < 1000; ++i)
+	{
+		if (rsslNotifierWait(pChannelNotifier, 1000) > 0)
+			return RSSL_TRUE;
+
+		if (rsslReactorDispatch(providerSide.pReactor, &dispatchOpts, &errorInfo) < RSSL_RET_SUCCESS)
+			return RSSL_FALSE;
+	}
+
+	return RSSL_FALSE;
+}
+
+/* Times dispatching the consumer reactor when none of its channels has data. */
+static void reactorPerfRunIdleCase(MicroPerfConfig *pConfig, int channelCount)
+{
+	RsslReactorDispatchOptions dispatchOpts;
+	RsslErrorInfo errorInfo;
+	RsslUInt32 iterations = microPerfIterations(pConfig, 100000);
+	RsslTimeValue startTime, endTime;
+	RsslUInt32 i;
+	char caseName[64];
+
+	rsslClearReactorDispatchOptions(&dispatchOpts);
+
+	for (i = 0; i < pConfig->warmupIterations; ++i)
+		rsslReactorDispatch(consumerSide.pReactor, &dispatchOpts, &errorInfo);
+
+	microPerfStartCase();
+	startTime = rsslGetTimeNano();
+	for (i = 0; i < iterations; ++i)
+	{
+		if (rsslReactorDispatch(consumerSide.pReactor, &dispatchOpts, &errorInfo) < RSSL_RET_SUCCESS)
+		{
+			printf("%-12s Dispatch failed: %s\n", "reactor", errorInfo.rsslError.text);
+			return;
+		}
+	}
+	endTime = rsslGetTimeNano();
+
+	snprintf(caseName, sizeof(caseName), "dispatch/idle/%d-channels", channelCount);
+	microPerfPrintResult("reactor", caseName, iterations, endTime - startTime);
+}
+
+/* Times dispatching the consumer reactor when one of its channels, chosen at random, has a message. */
+static void reactorPerfRunOneReadyCase(MicroPerfConfig *pConfig, RsslNotifier *pChannelNotifier, RsslNotifierEvent *pChannelEvent, int channelCount)
+{
+	RsslReactorDispatchOptions dispatchOpts;
+	RsslErrorInfo errorInfo;
+	ValueStatistics dispatchStats;
+	RsslUInt32 iterations = microPerfIterations(pConfig, 10000);
+	RsslUInt32 i;
+	char caseName[64];
+
+	rsslClearReactorDispatchOptions(&dispatchOpts);
+	clearValueStatistics(&dispatchStats);
+
+	for (i = 0; i < pConfig->warmupIterations + iterations; ++i)
+	{
+		int channel = rand() % channelCount;
+		RsslUInt64 msgCount = consumerSide.msgCount;
+		RsslTimeValue startTime, endTime;
+
+		if (reactorPerfSubmitUpdate(providerSide.pChannels[channel]) < RSSL_RET_SUCCESS)
+		{
+			printf("%-12s Failed to submit message.\n", "reactor");
+			return;
+		}
+
+		/* Wait for the message to arrive, so that only its dispatch is timed. */
+		if (!reactorPerfWaitForMessage(pChannelNotifier, pChannelEvent, consumerSide.pChannels[channel]))
+		{
+			printf("%-12s Message did not arrive.\n", "reactor");
+			return;
+		}
+
+		startTime = rsslGetTimeNano();
+		do
+		{
+			if (rsslReactorDispatch(consumerSide.pReactor, &dispatchOpts, &errorInfo) < RSSL_RET_SUCCESS)
+			{
+				printf("%-12s Dispatch failed: %s\n", "reactor", errorInfo.rsslError.text);
+				return;
+			}
+		} while (consumerSide.msgCount == msgCount);
+		endTime = rsslGetTimeNano();
+
+		if (i >= pConfig->warmupIterations)
+			updateValueStatistics(&dispatchStats, (double)(endTime - startTime) / 1000.0);
+	}
+
+	snprintf(caseName, sizeof(caseName), "dispatch/one-ready/%d-channels", channelCount);
+	microPerfPrintStats("reactor", caseName, &dispatchStats);
+}
+
+void reactorPerfRun(MicroPerfConfig *pConfig)
+{
+	RsslCreateReactorOptions reactorOpts;
+	RsslBindOptions bindOpts;
+	RsslServer *pServer = NULL;
+	RsslNotifier *pServerNotifier = NULL, *pChannelNotifier = NULL;
+	RsslNotifierEvent *pServerEvent = NULL, *pChannelEvent = NULL;
+	RsslErrorInfo errorInfo;
+	RsslError error;
+	int maxChannelCount = channelCounts[sizeof(channelCounts)/sizeof(int) - 1];
+	int i;
+
+	if (!reactorPerfReserveDescriptors(maxChannelCount))
+	{
+		printf("%-12s Skipping: not enough file descriptors available.\n", "reactor");
+		return;
+	}
+
+	reactorPerfShuttingDown = RSSL_FALSE;
+	memset(&consumerSide, 0, sizeof(ReactorPerfSide));
+	memset(&providerSide, 0, sizeof(ReactorPerfSide));
+	consumerSide.pChannels = (RsslReactorChannel**)calloc(maxChannelCount, sizeof(RsslReactorChannel*));
+	providerSide.pChannels = (RsslReactorChannel**)calloc(maxChannelCount, sizeof(RsslReactorChannel*));
+
+	rsslClearBindOpts(&bindOpts);
+	bindOpts.serviceName = (char*)REACTOR_PERF_PORT;
+	if ((pServer = rsslBind(&bindOpts, &error)) == NULL)
+	{
+		printf("%-12s Skipping: could not bind port %s: %s\n", "reactor", REACTOR_PERF_PORT, error.text);
+		goto cleanup;
+	}
+
+	rsslClearCreateReactorOptions(&reactorOpts);
+	if ((consumerSide.pReactor = rsslCreateReactor(&reactorOpts, &errorInfo)) == NULL
+			|| (providerSide.pReactor = rsslCreateReactor(&reactorOpts, &errorInfo)) == NULL)
+	{
+		printf("%-12s Failed to create reactor: %s\n", "reactor", errorInfo.rsslError.text);
+		goto cleanup;
+	}
+
+	pServerNotifier = rsslCreateNotifier(1);
+	pServerEvent = rsslCreateNotifierEvent();
+	rsslNotifierAddEvent(pServerNotifier, pServerEvent, pServer->socketId, pServer);
+	rsslNotifierRegisterRead(pServerNotifier, pServerEvent);
+
+	for (i = 0; i < (int)(sizeof(channelCounts)/sizeof(int)); ++i)
+	{
+		if (!reactorPerfConnectChannels(pServer, pServerNotifier, channelCounts[i]))
+		{
+			printf("%-12s Failed to connect %d channels.\n", "reactor", channelCounts[i]);
+			goto cleanup;
+		}
+
+		pChannelNotifier = rsslCreateNotifier(1);
+		pChannelEvent = rsslCreateNotifierEvent();
+		rsslNotifierAddEvent(pChannelNotifier, pChannelEvent, consumerSide.pChannels[0]->socketId, NULL);
+		rsslNotifierRegisterRead(pChannelNotifier, pChannelEvent);
+
+		reactorPerfRunIdleCase(pConfig, channelCounts[i]);
+		reactorPerfRunOneReadyCase(pConfig, pChannelNotifier, pChannelEvent, channelCounts[i]);
+
+		rsslNotifierRemoveEvent(pChannelNotifier, pChannelEvent);
+		rsslDestroyNotifierEvent(pChannelEvent);
+		rsslDestroyNotifier(pChannelNotifier);
+	}
+
+cleanup:
+	reactorPerfShuttingDown = RSSL_TRUE;
+	if (consumerSide.pReactor)
+		rsslDestroyReactor(consumerSide.pReactor, &errorInfo);
+	if (providerSide.pReactor)
+		rsslDestroyReactor(providerSide.pReactor, &errorInfo);
+	if (pServerNotifier)
+	{
+		rsslNotifierRemoveEvent(pServerNotifier, pServerEvent);
+		rsslDestroyNotifierEvent(pServerEvent);
+		rsslDestroyNotifier(pServerNotifier);
+	}
+	if (pServer)
+		rsslCloseServer(pServer, &error);
+	free(consumerSide.pChannels);
+	free(providerSide.pChannels);
+}
@@ -0,0 +1,130 @@
+/*
+ * This source code is provided under the Apache 2.0 license and is provided
+ * AS IS with no warranty or guarantee of fit for purpose.  See the project's
+ * LICENSE.md for details.
+ * Copyright (C) 2022 Refinitiv. All rights reserved.
+*/
+
+/* wsMaskPerf.c
+ * Measures WebSocket payload masking with each kernel, in place and fused with the
+ * copy into the reassembly buffer, against the previous unmask-then-copy sequence. */
+
+#include "microPerf.h"
+#include "rtr/rwsmask.h"
+
+typedef struct {
+	const char		*name;
+	rwsMaskKernel_t	kernel;
+} WsMaskPerfKernel;
+
+static const WsMaskPerfKernel maskKernels[] =
+{
+	{ "byte", RWS_MASK_KERNEL_BYTE },
+	{ "word", RWS_MASK_KERNEL_WORD },
+	{ "sse2", RWS_MASK_KERNEL_SSE2 },
+	{ "avx2", RWS_MASK_KERNEL_AVX2 }
+};
+
+static const RsslUInt32 payloadSizes[] = { 64, 1024, 65536 };
+
+static const char maskKey[4] = { 0x37, (char)0xfa, 0x21, 0x3d };
+
+/* Keeps the compiler from optimizing away the masked data. */
+static volatile char wsMaskSink;
+
+static void wsMaskPerfRunInPlace(MicroPerfConfig *pConfig, const WsMaskPerfKernel *pKernel, char *buffer, RsslUInt32 size)
+{
+	RsslUInt32 iterations = microPerfIterations(pConfig, (RsslUInt32)(2000000000ULL / (size + 64) / 10));
+	RsslTimeValue startTime, endTime;
+	RsslUInt32 i;
+	char caseName[64];
+
+	for (i = 0; i < pConfig->warmupIterations; ++i)
+		rwsMaskCopyWithKernel(pKernel->kernel, maskKey, buffer, buffer, size);
+
+	microPerfStartCase();
+	startTime = rsslGetTimeNano();
+	for (i = 0; i < iterations; ++i)
+		rwsMaskCopyWithKernel(pKernel->kernel, maskKey, buffer, buffer, size);
+	endTime = rsslGetTimeNano();
+
+	wsMaskSink = buffer[size - 1];
+
+	snprintf(caseName, sizeof(caseName), "in-place/%s/%u", pKernel->name, size);
+	microPerfPrintResult("wsmask", caseName, iterations, endTime - startTime);
+}
+
+static void wsMaskPerfCopy(const WsMaskPerfKernel *pKernel, char *src, char *dst, RsslUInt32 size, RsslBool fused)
+{
+	if (fused)
+		rwsMaskCopyWithKernel(pKernel->kernel, maskKey, dst, src, size);
+	else
+	{
+		/* Unmask in the input buffer, then copy into the reassembly buffer. */
+		rwsMaskCopyWithKernel(pKernel->kernel, maskKey, src, src, size);
+		memcpy(dst, src, size);
+	}
+}
+
+static void wsMaskPerfRunCopy(MicroPerfConfig *pConfig, const WsMaskPerfKernel *pKernel, char *src, char *dst, RsslUInt32 size, RsslBool fused)
+{
+	RsslUInt32 iterations = microPerfIterations(pConfig, (RsslUInt32)(2000000000ULL / (size + 64) / 10));
+	RsslTimeValue startTime, endTime;
+	RsslUInt32 i;
+	char caseName[64];
+
+	for (i = 0; i < pConfig->warmupIterations; ++i)
+		wsMaskPerfCopy(pKernel, src, dst, size, fused);
+
+	microPerfStartCase();
+	startTime = rsslGetTimeNano();
+	for (i = 0; i < iterations; ++i)
+		wsMaskPerfCopy(pKernel, src, dst, size, fused);
+	endTime = rsslGetTimeNano();
+
+	wsMaskSink = dst[size - 1];
+
+	snprintf(caseName, sizeof(caseName), "%s/%s/%u", fused ? "fused-copy" : "unmask+memcpy", pKernel->name, size);
+	microPerfPrintResult("wsmask", caseName, iterations, endTime - startTime);
+}
+
+void wsMaskPerfRun(MicroPerfConfig *pConfig)
+{
+	RsslUInt32 maxSize = payloadSizes[sizeof(payloadSizes)/sizeof(RsslUInt32) - 1];
+	char *src = (char*)malloc(maxSize);
+	char *dst = (char*)malloc(maxSize);
+	int i, j;
+
+	if (src == NULL || dst == NULL)
+	{
+		printf("%-12s Failed to allocate buffers.\n", "wsmask");
+		free(src);
+		free(dst);
+		return;
+	}
+
+	for (i = 0; i < (int)maxSize; ++i)
+		src[i] = (char)rand();
+
+	printf("%-12s Selected kernel: %s\n", "wsmask", maskKernels[rwsMaskSelectedKernel() - 1].name);
+
+	for (i = 0; i < (int)(sizeof(payloadSizes)/sizeof(RsslUInt32)); ++i)
+	{
+		for (j = 0; j < (int)(sizeof(maskKernels)/sizeof(WsMaskPerfKernel)); ++j)
+		{
+			if (!rwsMaskKernelSupported(maskKernels[j].kernel))
+			{
+				if (i == 0)
+					printf("%-12s Skipping %s: not supported on this machine.\n", "wsmask", maskKernels[j].name);
+				continue;
+			}
+
+			wsMaskPerfRunInPlace(pConfig, &maskKernels[j], src, payloadSizes[i]);
+			wsMaskPerfRunCopy(pConfig, &maskKernels[j], src, dst, payloadSizes[i], RSSL_FALSE);
+			wsMaskPerfRunCopy(pConfig, &maskKernels[j], src, dst, payloadSizes[i], RSSL_TRUE);
+		}
+	}
+
+	free(src);
+	free(dst);
+}
@@ -352,6 +352,10 @@ void initNIProvPerfConfig(int argc, char **argv)
 		{
 			providerThreadConfig.preEncItems = RSSL_TRUE;
 		}
+		else if (0 == strcmp("-encodePlan", argv[iargs]))
+		{
+			providerThreadConfig.useEncodePlans = RSSL_TRUE;
+		}
 		else if (0 == strcmp("-mcastStats", argv[iargs]))
 		{
 			providerThreadConfig.takeMCastStats = RSSL_TRUE;
@@ -563,10 +567,12 @@ void printNIProvPerfConfig(FILE *file)
 
 	fprintf(file,
 			"  Pre-Encoded Updates: %s\n" 
+			"  Encode Plan Updates: %s\n" 
 			"      Nanosecond Time: %s\n" 
 			"       Measure Encode: %s\n"
             "      Multicast Stats: %s\n\n",
 			providerThreadConfig.preEncItems ? "Yes" : "No",
+			providerThreadConfig.useEncodePlans ? "Yes" : "No",
 			providerThreadConfig.nanoTime ? "Yes" : "No",
 			providerThreadConfig.measureEncode ? "Yes" : "No",
             providerThreadConfig.takeMCastStats ? "Yes" : "No");
@@ -628,6 +634,7 @@ void exitWithUsage()
 			"\n"
 			"  -nanoTime                        Use nanosecond precision for latency information instead of microsecond.\n"
 			"  -preEnc                          Use Pre-Encoded updates\n"
+			"  -encodePlan                      Encode MarketPrice updates with precompiled encode plans.\n"
 			"  -takeMCastStats                  Take Multicast Statistics(Warning: This enables the per-channel lock).\n"
 			"  -measureEncode                   Measure encoding time of messages.\n"
 			"\n"
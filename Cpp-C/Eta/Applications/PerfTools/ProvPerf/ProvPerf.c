@@ -42,6 +42,10 @@ RsslTimeValue _currentTime;
 
 static RsslServer *rsslSrvr = NULL;
 
+/* Reactor whose dispatch shards are shared by the provider threads. See -reactorShards.
+ * Created before the provider threads are started. */
+static RsslReactor *pShardedReactor = NULL;
+
 static RsslInt64 nsecPerTick;
 
 /* Logs summary information, such as application inputs and final statistics. */
@@ -137,6 +141,38 @@ RSSL_THREAD_DECLARE(runChannelConnectionHandler, pArg)
 	return RSSL_THREAD_RETURN();
 }
 
+/* Creates the reactor whose dispatch shards are shared by the provider threads, one shard per thread.
+ * Its worker thread and JSON converter use the settings of the first provider thread. */
+static void createShardedReactor(ProviderThread *pProvThread)
+{
+	RsslErrorInfo rsslErrorInfo;
+	RsslCreateReactorOptions reactorOpts;
+	RsslReactorJsonConverterOptions jsonConverterOptions;
+
+	rsslClearCreateReactorOptions(&reactorOpts);
+	reactorOpts.cpuBindWorkerThread = pProvThread->cpuReactorWorkerId;
+	reactorOpts.dispatchShardCount = (RsslUInt32)providerThreadConfig.threadCount;
+	reactorOpts.shardPolicy = RSSL_REACTOR_SHARD_EXPLICIT;
+
+	if (!(pShardedReactor = rsslCreateReactor(&reactorOpts, &rsslErrorInfo)))
+	{
+		printf("Reactor creation failed: %s\n", rsslErrorInfo.rsslError.text);
+		exit(-1);
+	}
+
+	/* Initializing the converter of the reactor also initializes the converters of its shards. */
+	rsslClearReactorJsonConverterOptions(&jsonConverterOptions);
+	jsonConverterOptions.pDictionary = pProvThread->pDictionary;
+	jsonConverterOptions.defaultServiceId = (RsslUInt16)directoryConfig.serviceId;
+	jsonConverterOptions.userSpecPtr = (void*)pProvThread;
+	jsonConverterOptions.pServiceNameToIdCallback = serviceNameToIdReactorCallback;
+	if (rsslReactorInitJsonConverter(pShardedReactor, &jsonConverterOptions, &rsslErrorInfo) != RSSL_RET_SUCCESS)
+	{
+		printf("Error initializing RWF/JSON converter: %s\n", rsslErrorInfo.rsslError.text);
+		exit(-1);
+	}
+}
+
 RSSL_THREAD_DECLARE(runReactorConnectionHandler, pArg)
 {
 	ProviderThread *pProvThread = (ProviderThread*)pArg;
@@ -167,26 +203,41 @@ RSSL_THREAD_DECLARE(runReactorConnectionHandler, pArg)
 		}
 	}
 
-	// create reactor
-	rsslClearCreateReactorOptions(&reactorOpts);
-
-	/* The Cpu core id for the internal Reactor worker thread. */
-	reactorOpts.cpuBindWorkerThread = pProvThread->cpuReactorWorkerId;
-
-	if (!(pProvThread->pReactor = rsslCreateReactor(&reactorOpts, &rsslErrorInfo)))
+	if (provPerfConfig.useReactorShards)
 	{
-		printf("Reactor creation failed: %s\n", rsslErrorInfo.rsslError.text);
-		cleanUpAndExit();
-	}
+		RsslReactor *pShard;
 
-	jsonConverterOptions.pDictionary = pProvThread->pDictionary;
-	jsonConverterOptions.defaultServiceId = (RsslUInt16)directoryConfig.serviceId;
-	jsonConverterOptions.userSpecPtr = (void*)pProvThread;
-	jsonConverterOptions.pServiceNameToIdCallback = serviceNameToIdReactorCallback;
-	if (rsslReactorInitJsonConverter(pProvThread->pReactor, &jsonConverterOptions, &rsslErrorInfo) != RSSL_RET_SUCCESS)
+		/* This thread dispatches its own shard of the reactor created by main(). */
+		if (!(pShard = rsslReactorGetShard(pShardedReactor, (RsslUInt32)pProvThread->providerIndex, &rsslErrorInfo)))
+		{
+			printf("Failed to get reactor shard: %s\n", rsslErrorInfo.rsslError.text);
+			cleanUpAndExit();
+		}
+		pProvThread->pReactor = pShard;
+	}
+	else
 	{
-		printf("Error initializing RWF/JSON converter: %s\n", rsslErrorInfo.rsslError.text);
-		cleanUpAndExit();
+		// create reactor
+		rsslClearCreateReactorOptions(&reactorOpts);
+
+		/* The Cpu core id for the internal Reactor worker thread. */
+		reactorOpts.cpuBindWorkerThread = pProvThread->cpuReactorWorkerId;
+
+		if (!(pProvThread->pReactor = rsslCreateReactor(&reactorOpts, &rsslErrorInfo)))
+		{
+			printf("Reactor creation failed: %s\n", rsslErrorInfo.rsslError.text);
+			cleanUpAndExit();
+		}
+
+		jsonConverterOptions.pDictionary = pProvThread->pDictionary;
+		jsonConverterOptions.defaultServiceId = (RsslUInt16)directoryConfig.serviceId;
+		jsonConverterOptions.userSpecPtr = (void*)pProvThread;
+		jsonConverterOptions.pServiceNameToIdCallback = serviceNameToIdReactorCallback;
+		if (rsslReactorInitJsonConverter(pProvThread->pReactor, &jsonConverterOptions, &rsslErrorInfo) != RSSL_RET_SUCCESS)
+		{
+			printf("Error initializing RWF/JSON converter: %s\n", rsslErrorInfo.rsslError.text);
+			cleanUpAndExit();
+		}
 	}
 
 	FD_ZERO(&pProvThread->readfds);
@@ -567,6 +618,7 @@ static RsslRet acceptReactorConnection(RsslServer *pRsslSrvr, RsslErrorInfo *pRs
 
 	rsslClearReactorAcceptOptions(&aopts);
 	aopts.rsslAcceptOptions.userSpecPtr = pProvSession;
+	aopts.shardIndex = (RsslUInt32)connHandlerIndex;
 
 	if ((ret = rsslReactorAccept(pProvThread->pReactor, pRsslSrvr, &aopts, (RsslReactorChannelRole*)&providerRole, &rsslErrorInfo))
 			!= RSSL_RET_SUCCESS)
@@ -654,6 +706,9 @@ int main(int argc, char **argv)
 	}
 	else // use ETA VA Reactor
 	{
+		if (provPerfConfig.useReactorShards)
+			createShardedReactor(&provider.providerThreadList[0]);
+
 		startProviderThreads(&provider, runReactorConnectionHandler);
 	}
 
@@ -662,6 +717,9 @@ int main(int argc, char **argv)
 
 	sopts.guaranteedOutputBuffers = provPerfConfig.guaranteedOutputBuffers;
 	sopts.maxOutputBuffers = provPerfConfig.maxOutputBuffers;
+	sopts.sharedPoolSize = provPerfConfig.sharedPoolSize;
+	sopts.sharedPoolLock = provPerfConfig.sharedPoolLock;
+	sopts.sharedPoolThreadCacheSize = provPerfConfig.sharedPoolThreadCacheSize;
 	sopts.serviceName = provPerfConfig.portNo;
 	if(strlen(provPerfConfig.interfaceName)) sopts.interfaceName = provPerfConfig.interfaceName;
 	sopts.majorVersion = RSSL_RWF_MAJOR_VERSION;
@@ -1037,6 +1095,34 @@ RsslRet processMsg(ChannelHandler *pChannelHandler, ChannelInfo* pChannelInfo, R
 	return ret;
 }
 
+/* Prints the usage of the server's shared buffer pool. */
+static void printServerInfo(FILE *file)
+{
+	RsslServerInfo serverInfo;
+	RsslError error;
+	RsslUInt64 totalAllocs;
+
+	if (rsslGetServerInfo(rsslSrvr, &serverInfo, &error) != RSSL_RET_SUCCESS)
+	{
+		fprintf(file, "rsslGetServerInfo() failed: %d(%s)\n", error.rsslErrorId, error.text);
+		return;
+	}
+
+	fprintf(file, "Shared Pool Usage:\n"
+			"  Peak buffers used: %u\n",
+			serverInfo.peakBufferUsage);
+
+	if (provPerfConfig.sharedPoolThreadCacheSize > 0)
+	{
+		totalAllocs = serverInfo.threadCacheHits + serverInfo.threadCacheMisses;
+		fprintf(file, "  Thread cache hits: %llu, misses: %llu (%.2f%% hit ratio)\n",
+				serverInfo.threadCacheHits, serverInfo.threadCacheMisses,
+				totalAllocs ? (double)serverInfo.threadCacheHits * 100.0 / (double)totalAllocs : 0.0);
+	}
+
+	fprintf(file, "\n");
+}
+
 void cleanUpAndExit()
 {
 	printf("\nShutting down.\n\n");
@@ -1048,6 +1134,11 @@ void cleanUpAndExit()
 
 	providerPrintSummaryStats(&provider, stdout);
 	providerPrintSummaryStats(&provider, summaryFile);
+	if (rsslSrvr)
+	{
+		printServerInfo(stdout);
+		printServerInfo(summaryFile);
+	}
 	fclose(summaryFile);
 
 	providerCleanup(&provider);
@@ -29,6 +29,9 @@ static void clearProvPerfConfig()
 	/* In the case that client doesn't supply -maxOutputBufs as the input argument, application should remain old functionality
 	   see rsslClearBindOpts(...) */
 	provPerfConfig.maxOutputBuffers = 5000;
+	provPerfConfig.sharedPoolSize = 0;
+	provPerfConfig.sharedPoolLock = RSSL_FALSE;
+	provPerfConfig.sharedPoolThreadCacheSize = 0;
 	provPerfConfig.maxFragmentSize = 6144;
 	provPerfConfig.sendBufSize = 0;
 	provPerfConfig.recvBufSize = 0;
@@ -196,6 +199,20 @@ void initProvPerfConfig(int argc, char **argv)
 			++iargs; if (iargs == argc) exitMissingArgument(argv, iargs - 1);
 			sscanf(argv[iargs], "%u", &provPerfConfig.maxOutputBuffers);
 		}
+		else if (0 == strcmp("-sharedPoolSize", argv[iargs]))
+		{
+			++iargs; if (iargs == argc) exitMissingArgument(argv, iargs - 1);
+			sscanf(argv[iargs], "%u", &provPerfConfig.sharedPoolSize);
+		}
+		else if (0 == strcmp("-sharedPoolLock", argv[iargs]))
+		{
+			provPerfConfig.sharedPoolLock = RSSL_TRUE;
+		}
+		else if (0 == strcmp("-threadCacheSize", argv[iargs]))
+		{
+			++iargs; if (iargs == argc) exitMissingArgument(argv, iargs - 1);
+			sscanf(argv[iargs], "%u", &provPerfConfig.sharedPoolThreadCacheSize);
+		}
 		else if (0 == strcmp("-maxFragmentSize", argv[iargs]))
 		{
 			++iargs; if (iargs == argc) exitMissingArgument(argv, iargs - 1);
@@ -307,6 +324,10 @@ void initProvPerfConfig(int argc, char **argv)
 		{
 			providerThreadConfig.preEncItems = RSSL_TRUE;
 		}
+		else if (0 == strcmp("-encodePlan", argv[iargs]))
+		{
+			providerThreadConfig.useEncodePlans = RSSL_TRUE;
+		}
 		else if (0 == strcmp("-measureEncode", argv[iargs]))
 		{
 			providerThreadConfig.measureEncode = RSSL_TRUE;
@@ -319,6 +340,11 @@ void initProvPerfConfig(int argc, char **argv)
 		{
 			provPerfConfig.useReactor = RSSL_TRUE;
 		}
+		else if (0 == strcmp("-reactorShards", argv[iargs]))
+		{
+			provPerfConfig.useReactor = RSSL_TRUE;
+			provPerfConfig.useReactorShards = RSSL_TRUE;
+		}
 		else if (strcmp("-connType", argv[iargs]) == 0)
 		{
 			++iargs; if (iargs == argc) exitMissingArgument(argv, iargs - 1);
@@ -392,6 +418,10 @@ void initProvPerfConfig(int argc, char **argv)
 		exitConfigError(argv);
 	}
 
+	/* Provider threads share the server's pool, and the thread caches need its lock. */
+	if (providerThreadConfig.threadCount > 1 || provPerfConfig.sharedPoolThreadCacheSize > 0)
+		provPerfConfig.sharedPoolLock = RSSL_TRUE;
+
 	loginConfig.applicationName = applicationName;
 	loginConfig.applicationId = applicationId;
 	setLoginConfigPosition();
@@ -438,6 +468,9 @@ void printProvPerfConfig(FILE *file)
 			"             Thread List: %s\n"
 			"          Output Buffers: %u\n"
 			"      Max Output Buffers: %u\n"
+			"        Shared Pool Size: %u%s\n"
+			"        Shared Pool Lock: %s\n"
+			"       Thread Cache Size: %u\n"
 			"       Max Fragment Size: %u\n"
 			"        Send Buffer Size: %u%s\n"
 			"        Recv Buffer Size: %u%s\n"
@@ -466,6 +499,9 @@ void printProvPerfConfig(FILE *file)
 			threadString,
 			provPerfConfig.guaranteedOutputBuffers,
 			provPerfConfig.maxOutputBuffers,
+			provPerfConfig.sharedPoolSize, (provPerfConfig.sharedPoolSize ? "" : "(use default)"),
+			(provPerfConfig.sharedPoolLock ? "Yes" : "No"),
+			provPerfConfig.sharedPoolThreadCacheSize,
 			provPerfConfig.maxFragmentSize,
 			provPerfConfig.sendBufSize, (provPerfConfig.sendBufSize ? " bytes" : "(use default)"),
 			provPerfConfig.recvBufSize, (provPerfConfig.recvBufSize ? " bytes" : "(use default)"),
@@ -526,15 +562,19 @@ void printProvPerfConfig(FILE *file)
 
 	fprintf(file,
 			"     Pre-Encoded Updates: %s\n"
+			"     Encode Plan Updates: %s\n"
 			"         Nanosecond Time: %s\n"
 			"          Measure Encode: %s\n",
 			providerThreadConfig.preEncItems ? "Yes" : "No",
+			providerThreadConfig.useEncodePlans ? "Yes" : "No",
 			providerThreadConfig.nanoTime ? "Yes" : "No",
 			providerThreadConfig.measureEncode ? "Yes" : "No");
 
 	fprintf(file,
-			"             Use Reactor: %s\n\n",
-			(provPerfConfig.useReactor ? "Yes" : "No")
+			"             Use Reactor: %s\n"
+			"          Reactor Shards: %s\n\n",
+			(provPerfConfig.useReactor ? "Yes" : "No"),
+			(provPerfConfig.useReactorShards ? "Yes" : "No")
 		  );
 }
 
@@ -548,6 +588,9 @@ void exitWithUsage()
 			"\n"
 			"  -outputBufs <count>                  Number of output buffers(configures guaranteedOutputBuffers in RsslBindOptions)\n"
 			"  -maxOutputBufs <count>               Max number of output buffers(configures maxOutputBuffers in RsslBindOptions)\n"
+			"  -sharedPoolSize <count>              Max number of buffers in the server's shared pool(configures sharedPoolSize in RsslBindOptions)\n"
+			"  -sharedPoolLock                      Locks the shared pool(configures sharedPoolLock in RsslBindOptions). Set automatically with more than one provider thread\n"
+			"  -threadCacheSize <count>             Number of shared pool buffers each thread may cache(configures sharedPoolThreadCacheSize in RsslBindOptions)\n"
 			"  -maxFragmentSize <size>              Max size of buffers(configures maxFragmentSize in RsslBindOptions)\n"
 			"  -sendBufSize <size>                  System Send Buffer Size(configures sysSendBufSize in RsslBindOptions)\n"
 			"  -recvBufSize <size>                  System Receive Buffer Size(configures sysRecvBufSize in RsslBindOptions)\n"
@@ -582,10 +625,12 @@ void exitWithUsage()
 			"  -workerThreads <thread list>         List of CPU bound for Reactor worker threads. -1 means do not bind.\n"
 			"\n"
 			"  -preEnc                              Use Pre-Encoded updates\n"
+			"  -encodePlan                          Encode MarketPrice updates with precompiled encode plans.\n"
 			"  -nanoTime                            Use nanosecond precision for latency information instead of microsecond.\n"
 			"  -measureEncode                       Measure encoding time of messages.\n"
 			"\n"
 			"  -reactor                             Use the VA Reactor instead of the ETA Channel for sending and receiving.\n"
+			"  -reactorShards                       Use one VA Reactor with a dispatch shard for each provider thread, instead of a reactor per thread.\n"
 			"\n"
 			"  -pl \"<list>\"                         List of supported WS sub-protocols in order of preference(',' | white space delineated)\n"
 			"\n"
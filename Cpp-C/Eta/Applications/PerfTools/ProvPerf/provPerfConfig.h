@@ -26,6 +26,9 @@ typedef struct
 	RsslBool			tcpNoDelay;					/* Enable/Disable Nagle's algorithm. See -tcpDelay */
 	RsslUInt32			guaranteedOutputBuffers;	/* Guaranteed Output Buffers. See -outputBufs */
 	RsslUInt32			maxOutputBuffers;		/* Max Output Buffers. See -maxOutputBufs */
+	RsslUInt32			sharedPoolSize;				/* Shared Pool Size. See -sharedPoolSize */
+	RsslBool			sharedPoolLock;				/* Lock the shared pool. See -sharedPoolLock */
+	RsslUInt32			sharedPoolThreadCacheSize;	/* Per-thread shared pool cache size. See -threadCacheSize */
 	RsslUInt32			maxFragmentSize;			/* Maximum Fragment Size. See -maxFragmentSize */
 	RsslUInt32			highWaterMark;				/* sets the point which will cause ETA to automatically flush */
 	RsslUInt32			sendBufSize;				/* System Send Buffer Size. See -sendBufSize */
@@ -34,6 +37,7 @@ typedef struct
 	RsslUInt32			writeStatsInterval;			/* Controls how often statistics are written. */
 	RsslBool			displayStats;				/* Controls whether stats appear on the screen. */
 	RsslBool			useReactor;					/* Use the VA Reactor instead of the ETA Channel for sending and receiving. */
+	RsslBool			useReactorShards;			/* Use one VA Reactor with a dispatch shard per provider thread. See -reactorShards */
 	RsslConnectionTypes connType;					/* Connection type for this provider */
 	char				serverCert[255];			/* Server certificate file location */
 	char				serverKey[255];				/* Server private key file location */
@@ -10,6 +10,7 @@
 #include "TransportPerf.h"
 #include "rtr/rsslGetTime.h" 
 #include "testUtils.h"
+#include "zdict.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -48,11 +49,13 @@ static ResourceUsageStats resourceStats;
 static ValueStatistics cpuUsageStats;
 static ValueStatistics memUsageStats;
 static ValueStatistics totalLatencyStats;
+static double totalCpuSec = 0;
 
 static RsslUInt32 currentRuntimeSec = 0, intervalSeconds = 0;
 
 RsslUInt64 totalMsgSentCount = 0;
 RsslUInt64 totalBytesSent = 0;
+RsslUInt64 totalUncompBytesSent = 0;
 RsslUInt64 totalMsgReceivedCount = 0;
 RsslUInt64 totalBytesReceived = 0;
 
@@ -72,6 +75,56 @@ static void signal_handler(int sig)
 
 static void printSummaryStats(FILE *file);
 
+/* Size of dictionaries created by -trainCompressionDictionary. */
+#define TRAINED_DICTIONARY_SIZE 16384
+
+/* Trains a zstd dictionary from the payload file, cut into messages of the configured size
+ * (less the sequence number and timestamp), and writes it to the given file. */
+static void trainCompressionDictionary(const char *filename)
+{
+	RsslUInt32 sampleSize = transportThreadConfig.msgSize - 2 * SEQNUM_SZ;
+	RsslUInt32 sampleCount = transportThreadConfig.payloadLength / sampleSize;
+	size_t *sampleSizes;
+	char *dictionary;
+	size_t dictionaryLength;
+	FILE *file;
+	RsslUInt32 i;
+
+	if (sampleSize == 0 || sampleCount < 10)
+	{
+		printf("Error: Payload file must hold at least 10 messages to train a dictionary.\n");
+		exit(-1);
+	}
+
+	sampleSizes = (size_t*)malloc(sampleCount * sizeof(size_t));
+	dictionary = (char*)malloc(TRAINED_DICTIONARY_SIZE);
+	assert(sampleSizes && dictionary);
+
+	for (i = 0; i < sampleCount; ++i)
+		sampleSizes[i] = sampleSize;
+
+	dictionaryLength = ZDICT_trainFromBuffer(dictionary, TRAINED_DICTIONARY_SIZE,
+			transportThreadConfig.payload, sampleSizes, sampleCount);
+	if (ZDICT_isError(dictionaryLength))
+	{
+		printf("Error: Failed to train dictionary: %s\n", ZDICT_getErrorName(dictionaryLength));
+		exit(-1);
+	}
+
+	if (!(file = fopen(filename, "wb")) || fwrite(dictionary, 1, dictionaryLength, file) != dictionaryLength)
+	{
+		printf("Error: Failed to write dictionary to '%s'.\n", filename);
+		exit(-1);
+	}
+	fclose(file);
+
+	printf("Wrote %u-byte dictionary (ID %u) trained from %u samples to '%s'.\n",
+			(RsslUInt32)dictionaryLength, ZDICT_getDictID(dictionary, dictionaryLength), sampleCount, filename);
+
+	free(dictionary);
+	free(sampleSizes);
+}
+
 #define _BUFFER_DUMP(__buf, __len)\
 	   { int i=0; fprintf(stderr, "%15s (%u) : '", "Buffer Hex Dump", __len);\
 			for (i=0; i < __len; i++){\
@@ -211,6 +264,7 @@ RsslRet processMsgReflect(ChannelHandler *pChanHandler, ChannelInfo *pChannelInf
 	if (ret >= RSSL_RET_SUCCESS)
 	{
 		countStatAdd(&pHandler->transportThread.bytesSent, outBytes);
+		countStatAdd(&pHandler->transportThread.uncompBytesSent, uncompOutBytes);
 		countStatIncr(&pHandler->transportThread.msgsSent);
 		if(ret > 0)
 			channelHandlerRequestFlush(pChanHandler, pSession->pChannelInfo);
@@ -223,6 +277,7 @@ RsslRet processMsgReflect(ChannelHandler *pChanHandler, ChannelInfo *pChannelInf
 			if (chnl->state == RSSL_CH_STATE_ACTIVE)
 			{
 				countStatAdd(&pHandler->transportThread.bytesSent, outBytes);
+				countStatAdd(&pHandler->transportThread.uncompBytesSent, uncompOutBytes);
 				countStatIncr(&pHandler->transportThread.msgsSent);
 				channelHandlerRequestFlush(pChanHandler, pSession->pChannelInfo);
 				return 1;
@@ -313,6 +368,14 @@ RsslRet processActiveChannel(ChannelHandler *pChanHandler, ChannelInfo *pChannel
 
 	pSession->timeActivated = rsslGetTimeNano();
 
+	if (transportPerfConfig.splitReadWrite)
+	{
+		/* Hand the channel to the writer thread. */
+		RSSL_MUTEX_LOCK(&pHandler->handlerLock);
+		rsslQueueAddLinkToBack(&pHandler->writeSessionList, &pSession->writeLink);
+		RSSL_MUTEX_UNLOCK(&pHandler->handlerLock);
+	}
+
 	return RSSL_RET_SUCCESS;
 }
 
@@ -334,6 +397,15 @@ void processInactiveChannel(ChannelHandler *pChanHandler, ChannelInfo *pChannelI
 	else
 		printf("Channel Closed.\n");
 
+	if (pSession && transportPerfConfig.splitReadWrite)
+	{
+		/* Take the channel back from the writer thread before it is closed. */
+		RSSL_MUTEX_LOCK(&pHandler->handlerLock);
+		if (rsslQueueLinkInAList(&pSession->writeLink))
+			rsslQueueRemoveLink(&pHandler->writeSessionList, &pSession->writeLink);
+		RSSL_MUTEX_UNLOCK(&pHandler->handlerLock);
+	}
+
 	if (pSession)
 		transportSessionDestroy(&pHandler->transportThread, pSession);
 
@@ -522,6 +594,67 @@ RSSL_THREAD_DECLARE(runConnectionHandler, pArg)
 
 	return RSSL_THREAD_RETURN();
 }
+
+/* Sends message bursts on the channels of a connection thread, when reads and writes are split(-splitReadWrite).
+ * The connection thread still reads, initializes, pings and closes the channels. */
+RSSL_THREAD_DECLARE(runWriterThread, pArg)
+{
+	SessionHandler *pHandler = (SessionHandler*)pArg;
+	TransportThread *pTransportThread = &pHandler->transportThread;
+	RsslTimeValue currentTime, nextTickTime;
+	RsslInt32 tickSetMsgCount = 0;
+	RsslQueueLink *pLink;
+
+	nextTickTime = rsslGetTimeNano() + nsecPerTick;
+
+	while(!signal_shutdown)
+	{
+		currentTime = rsslGetTimeNano();
+		if (currentTime < nextTickTime)
+		{
+			/* Wait for the next tick. */
+#ifdef WIN32
+			Sleep((DWORD)((nextTickTime - currentTime)/1000000));
+#else
+			struct timeval time_interval;
+
+			time_interval.tv_sec = 0;
+			time_interval.tv_usec = (long)((nextTickTime - currentTime)/1000);
+			select(0, NULL, NULL, NULL, &time_interval);
+#endif
+			continue;
+		}
+
+		/* We've reached the next tick. Send a burst of messages out */
+		nextTickTime += nsecPerTick;
+
+		RSSL_MUTEX_LOCK(&pHandler->handlerLock);
+		RSSL_QUEUE_FOR_EACH_LINK(&pHandler->writeSessionList, pLink)
+		{
+			TransportSession *pSession = RSSL_QUEUE_LINK_TO_OBJECT(TransportSession, writeLink, pLink);
+			RsslError error;
+			RsslRet ret;
+
+			if (rtrUnlikely(nextTickTime < pSession->timeActivated)) continue;
+
+			ret = transportSessionSendMsgBurst(pTransportThread, pSession, &tickSetMsgCount);
+
+			/* Flush here instead of requesting it from the channel handler, which belongs to the connection thread. */
+			if (rtrUnlikely(ret > RSSL_RET_SUCCESS || ret == RSSL_RET_BUFFER_NO_BUFFERS))
+				ret = rsslFlush(pSession->pChannelInfo->pChannel, &error);
+
+			if (rtrUnlikely(ret < RSSL_RET_SUCCESS))
+			{
+				/* Stop writing; the connection thread closes the channel when its reads fail. */
+				printf("Failure while writing message bursts: %s\n", rsslRetCodeToString(ret));
+				rsslQueueRemoveLink(&pHandler->writeSessionList, &pSession->writeLink);
+			}
+		}
+		RSSL_MUTEX_UNLOCK(&pHandler->handlerLock);
+	}
+
+	return RSSL_THREAD_RETURN();
+}
 #ifdef __cplusplus
 };
 #endif
@@ -531,6 +664,7 @@ int main(int argc, char **argv)
 	int i;
 	struct timeval time_interval;
 	RsslError error;
+	RsslInitializeExOpts initOpts = RSSL_INIT_INITIALIZE_EX_OPTS;
 	fd_set useRead;
 	fd_set useExcept;
 	int selRet;
@@ -542,6 +676,14 @@ int main(int argc, char **argv)
 
 	/* Read in configuration and echo it. */
 	initTransportPerfConfig(argc, argv);
+
+	if (transportPerfConfig.trainDictionaryFilename[0])
+	{
+		trainCompressionDictionary(transportPerfConfig.trainDictionaryFilename);
+		cleanupTransportThreadConfig();
+		exit(0);
+	}
+
 	printTransportPerfConfig(stdout);
 
 	if (!(summaryFile = fopen(transportPerfConfig.summaryFilename, "w")))
@@ -568,14 +710,27 @@ int main(int argc, char **argv)
 
 	/* Initialize RSSL */
 	/* Multicast statistics are retrieved via rsslGetChannelInfo(), so set the per-channel-lock 
-	 * when taking them. */
-	if (rsslInitialize(transportPerfConfig.takeMCastStats ? RSSL_LOCK_GLOBAL_AND_CHANNEL :
-					(transportPerfConfig.threadCount > 1 ? RSSL_LOCK_GLOBAL : RSSL_LOCK_NONE),
-					 &error) != RSSL_RET_SUCCESS)
+	 * when taking them. Splitting reads and writes across threads also needs it. */
+	initOpts.rsslLocking = (transportPerfConfig.takeMCastStats || transportPerfConfig.splitReadWrite) ? RSSL_LOCK_GLOBAL_AND_CHANNEL :
+					(transportPerfConfig.threadCount > 1 ? RSSL_LOCK_GLOBAL : RSSL_LOCK_NONE);
+
+	if (transportPerfConfig.compressionDictionaryFilename[0])
+	{
+		if (!(initOpts.compressionDictionary.data = readWholeFile(transportPerfConfig.compressionDictionaryFilename,
+						&initOpts.compressionDictionary.length)))
+		{
+			printf("Error: Failed to read compression dictionary '%s'.\n", transportPerfConfig.compressionDictionaryFilename);
+			exit(-1);
+		}
+	}
+
+	/* The dictionary is copied, so it can be freed once RSSL is initialized. */
+	if (rsslInitializeEx(&initOpts, &error) != RSSL_RET_SUCCESS)
 	{
 		printf("RsslInitialize failed: %s\n", error.text);
 		exit(-1);
 	}
+	free(initOpts.compressionDictionary.data);
 	/* Initialize run-time */
 	initRuntime();
 
@@ -594,7 +749,7 @@ int main(int argc, char **argv)
 		}
 		else
 		{
-			sessionHandlerList[i].role = (transportTestRole)(ROLE_WRITER | ROLE_READER);
+			sessionHandlerList[i].role = transportPerfConfig.splitReadWrite ? ROLE_READER : (transportTestRole)(ROLE_WRITER | ROLE_READER);
 			sessionHandlerList[i].active = RSSL_TRUE;
 			transportThreadInit(&sessionHandlerList[i].transportThread,
 					processActiveChannel,
@@ -608,6 +763,10 @@ int main(int argc, char **argv)
 		
 		if (!CHECK(RSSL_THREAD_START(&sessionHandlerList[i].threadId, runConnectionHandler, &sessionHandlerList[i]) >= 0))
 			exit(-1);
+
+		if (transportPerfConfig.splitReadWrite
+				&& !CHECK(RSSL_THREAD_START(&sessionHandlerList[i].writerThreadId, runWriterThread, &sessionHandlerList[i]) >= 0))
+			exit(-1);
 	}
 
 	FD_ZERO(&readfds);
@@ -722,7 +881,7 @@ int main(int argc, char **argv)
 
 void collectStats(RsslBool writeStats, RsslBool displayStats, RsslUInt32 currentRuntimeSec, RsslUInt32 timePassedSec)
 {
-	RsslInt64 intervalMsgSentCount = 0, intervalBytesSent = 0,
+	RsslInt64 intervalMsgSentCount = 0, intervalBytesSent = 0, intervalUncompBytesSent = 0,
 			  intervalMsgReceivedCount = 0, intervalBytesReceived = 0,
 			  intervalOutOfBuffersCount = 0;
 	ValueStatistics intervalLatencyStats;
@@ -737,6 +896,7 @@ void collectStats(RsslBool writeStats, RsslBool displayStats, RsslUInt32 current
 			exit(-1);
 		}
 		updateValueStatistics(&cpuUsageStats, resourceStats.cpuUsageFraction);
+		totalCpuSec += resourceStats.cpuUsageFraction * (double)timePassedSec;
 		updateValueStatistics(&memUsageStats, (double)resourceStats.memUsageBytes);
 	}
 
@@ -783,12 +943,14 @@ void collectStats(RsslBool writeStats, RsslBool displayStats, RsslUInt32 current
 
 		intervalMsgSentCount = countStatGetChange(&sessionHandlerList[i].transportThread.msgsSent);
 		intervalBytesSent = countStatGetChange(&sessionHandlerList[i].transportThread.bytesSent);
+		intervalUncompBytesSent = countStatGetChange(&sessionHandlerList[i].transportThread.uncompBytesSent);
 		intervalMsgReceivedCount = countStatGetChange(&sessionHandlerList[i].transportThread.msgsReceived);
 		intervalBytesReceived = countStatGetChange(&sessionHandlerList[i].transportThread.bytesReceived);
 		intervalOutOfBuffersCount = countStatGetChange(&sessionHandlerList[i].transportThread.outOfBuffersCount);
 
 		totalMsgSentCount += intervalMsgSentCount;
 		totalBytesSent += intervalBytesSent;
+		totalUncompBytesSent += intervalUncompBytesSent;
 		totalMsgReceivedCount += intervalMsgReceivedCount;
 		totalBytesReceived += intervalBytesReceived;
 
@@ -825,6 +987,9 @@ void collectStats(RsslBool writeStats, RsslBool displayStats, RsslUInt32 current
 					(double)intervalMsgSentCount / (double)timePassedSec,
 					(double)intervalBytesSent / (double)(1024*1024) / (double)timePassedSec);
 
+			if (transportPerfConfig.compressionType != RSSL_COMP_NONE && intervalBytesSent > 0)
+				printf("  Compression ratio: %.3f\n", (double)intervalUncompBytesSent / (double)intervalBytesSent);
+
 			printf("  Recv: MsgRate: %8.0f, DataRate:%8.3fMBps\n",
 					(double)intervalMsgReceivedCount / (double)timePassedSec,
 					(double)intervalBytesReceived / (double)(1024*1024) / (double)timePassedSec);
@@ -840,6 +1005,7 @@ void collectStats(RsslBool writeStats, RsslBool displayStats, RsslUInt32 current
 			if(transportPerfConfig.takeMCastStats)
 			{
 				RsslUInt64 intervalMcastPacketsSent = 0, intervalMcastPacketsReceived = 0, intervalMcastRetransSent = 0, intervalMcastRetransReceived = 0;
+				RsslUInt64 intervalMcastSendCalls = 0, intervalMcastRcvdCalls = 0;
 				RsslChannelInfo chnlInfo;
 				RsslQueueLink *pLink;
 				SessionHandler *pHandler = &sessionHandlerList[i];
@@ -870,12 +1036,24 @@ void collectStats(RsslBool writeStats, RsslBool displayStats, RsslUInt32 current
 					intervalMcastRetransReceived = chnlInfo.multicastStats.retransPktsRcvd 
 						- pHandler->prevMCastStats.retransPktsRcvd;
 
+					intervalMcastSendCalls = chnlInfo.multicastStats.mcastSendCalls
+						- pHandler->prevMCastStats.mcastSendCalls;
+
+					intervalMcastRcvdCalls = chnlInfo.multicastStats.mcastRcvdCalls
+						- pHandler->prevMCastStats.mcastRcvdCalls;
+
 					pHandler->prevMCastStats = chnlInfo.multicastStats;
 
 				}
 
 				printf("  Multicast: Pkts Sent: %llu, Pkts Received: %llu, : Retrans sent: %llu, Retrans received: %llu\n",
 						intervalMcastPacketsSent, intervalMcastPacketsReceived,  intervalMcastRetransSent, intervalMcastRetransReceived);
+
+				/* Only the sequenced multicast transport counts its system calls */
+				if (intervalMcastSendCalls || intervalMcastRcvdCalls)
+					printf("  Multicast: Pkts per send call: %.2f, Pkts per receive call: %.2f\n",
+							intervalMcastSendCalls ? (double)intervalMcastPacketsSent / (double)intervalMcastSendCalls : 0.0,
+							intervalMcastRcvdCalls ? (double)intervalMcastPacketsReceived / (double)intervalMcastRcvdCalls : 0.0);
 			}
 
 			printf("  CPU: %6.2f%% Mem: %8.2fMB\n",
@@ -900,6 +1078,8 @@ static RsslServer* bindRsslServer(RsslError* error)
 	sopts.minorVersion = 0;
 	sopts.protocolType = TEST_PROTOCOL_TYPE;
 	sopts.tcp_nodelay = transportPerfConfig.tcpNoDelay;
+	sopts.tcpOpts.ioEngine = transportPerfConfig.ioEngine;
+	sopts.shmemOpts.readerSpinCount = transportPerfConfig.shmemSpinCount;
 	sopts.connectionType = transportPerfConfig.connectionType;
 	sopts.maxFragmentSize = transportPerfConfig.maxFragmentSize;
 	sopts.compressionType = transportPerfConfig.compressionType;
@@ -997,6 +1177,8 @@ static RsslChannel* startConnection()
 	copts.protocolType = TEST_PROTOCOL_TYPE;
 	copts.connectionType = transportPerfConfig.connectionType;
 	copts.tcp_nodelay = transportPerfConfig.tcpNoDelay;
+	copts.tcpOpts.ioEngine = transportPerfConfig.ioEngine;
+	copts.shmemOpts.readerSpinCount = transportPerfConfig.shmemSpinCount;
 	copts.compressionType = transportPerfConfig.compressionType;
 	if (transportPerfConfig.connectionType == RSSL_CONN_TYPE_ENCRYPTED)
 	{
@@ -1209,6 +1391,19 @@ static void printSummaryStats(FILE *file)
 			connectedTime ? (double)totalBytesSent / 1048576.0 / connectedTime : 0,
 			connectedTime ? (double)totalBytesReceived / 1048576.0 / connectedTime : 0);
 
+	/* Compression ratio and CPU cost are measured against the data before compression, so that runs
+	 * with different compression types can be compared. */
+	if (transportPerfConfig.compressionType != RSSL_COMP_NONE)
+		fprintf( file,
+				"  Data Sent Before Compression (MB): %.2f\n"
+				"  Compression ratio: %.3f\n",
+				(double)totalUncompBytesSent / 1048576.0,
+				totalBytesSent ? (double)totalUncompBytesSent / (double)totalBytesSent : 0);
+
+	if (cpuUsageStats.count && totalUncompBytesSent)
+		fprintf( file, "  CPU time per MB sent (msec): %.3f\n",
+				totalCpuSec * 1000.0 / ((double)totalUncompBytesSent / 1048576.0));
+
 	if (cpuUsageStats.count)
 	{
 		assert(memUsageStats.count);
@@ -61,6 +61,8 @@ typedef struct
 	TransportThread			transportThread;	/* Thread associated with this handler. */
 	transportTestRole		role;				/* Role of this handler. */
 	RsslMCastStats			prevMCastStats;		/* Stores any multicast statistics. */
+	RsslThreadId			writerThreadId;		/* ThreadID of the writer thread, if reads and writes are split. */
+	RsslQueue				writeSessionList;	/* Active sessions written by the writer thread. Protected by handlerLock. */
 } SessionHandler;
 
 /* ChannelHandler callback for initialized channels. */
@@ -80,6 +82,7 @@ RTR_C_INLINE void sessionHandlerInit(SessionHandler *pHandler)
 {
 	RSSL_MUTEX_INIT(&pHandler->handlerLock);
 	rsslInitQueue(&pHandler->newChannelsList);
+	rsslInitQueue(&pHandler->writeSessionList);
 	pHandler->openChannelsCount = 0;
 	pHandler->active = RSSL_FALSE;
 	timeRecordQueueInit(&pHandler->latencyRecords);
@@ -47,6 +47,8 @@ static void clearTransportPerfConfig()
 	snprintf(transportPerfConfig.hostName, sizeof(transportPerfConfig.hostName), "%s", "localhost");
 	snprintf(transportPerfConfig.portNo, sizeof(transportPerfConfig.portNo), "%s", "14002");
 	transportPerfConfig.tcpNoDelay = RSSL_TRUE;
+	transportPerfConfig.ioEngine = RSSL_IO_ENGINE_DEFAULT;
+	transportPerfConfig.shmemSpinCount = 0;
 	snprintf(transportPerfConfig.sendAddr, sizeof(transportPerfConfig.sendAddr), "");
 	snprintf(transportPerfConfig.recvAddr, sizeof(transportPerfConfig.recvAddr), "");
 	snprintf(transportPerfConfig.sendPort, sizeof(transportPerfConfig.sendPort), "");
@@ -64,6 +66,7 @@ static void clearTransportPerfConfig()
 
 	transportPerfConfig.appType = APPTYPE_SERVER;
 	transportPerfConfig.busyRead = RSSL_FALSE;
+	transportPerfConfig.splitReadWrite = RSSL_FALSE;
 }
 
 void exitConfigError(char **argv)
@@ -169,6 +172,8 @@ void initTransportPerfConfig(int argc, char **argv)
 				transportPerfConfig.connectionType = RSSL_CONN_TYPE_RELIABLE_MCAST;
 			else if (0 == strcmp(argv[iargs], "shmem"))
 				transportPerfConfig.connectionType = RSSL_CONN_TYPE_UNIDIR_SHMEM;
+			else if (0 == strcmp(argv[iargs], "bidirShmem"))
+				transportPerfConfig.connectionType = RSSL_CONN_TYPE_BIDIR_SHMEM;
 			else if(0 == strcmp(argv[iargs], "seqMCast"))
 				transportPerfConfig.connectionType = RSSL_CONN_TYPE_SEQ_MCAST;
 			else
@@ -219,6 +224,10 @@ void initTransportPerfConfig(int argc, char **argv)
 		{
 			transportPerfConfig.busyRead = RSSL_TRUE;
 		}
+		else if (0 == strcmp("-splitReadWrite", argv[iargs]))
+		{
+			transportPerfConfig.splitReadWrite = RSSL_TRUE;
+		}
 		else if (0 == strcmp("-outputBufs", argv[iargs]))
 		{
 			++iargs; if (iargs == argc) exitMissingArgument(argv, iargs - 1);
@@ -260,6 +269,8 @@ void initTransportPerfConfig(int argc, char **argv)
 				transportPerfConfig.compressionType = RSSL_COMP_ZLIB;
 			else if (0 == strcmp(argv[iargs], "lz4"))
 				transportPerfConfig.compressionType = RSSL_COMP_LZ4;
+			else if (0 == strcmp(argv[iargs], "zstd"))
+				transportPerfConfig.compressionType = RSSL_COMP_ZSTD;
 			else
 			{
 				/* Read it as a number. */
@@ -276,6 +287,21 @@ void initTransportPerfConfig(int argc, char **argv)
 			++iargs; if (iargs == argc) exitMissingArgument(argv, iargs - 1);
 			sscanf(argv[iargs], "%u", &transportPerfConfig.compressionLevel);
 		}
+		else if (0 == strcmp("-compressionDictionary", argv[iargs]))
+		{
+			++iargs; if (iargs == argc) exitMissingArgument(argv, iargs - 1);
+			snprintf(transportPerfConfig.compressionDictionaryFilename, sizeof(transportPerfConfig.compressionDictionaryFilename), "%s", argv[iargs]);
+		}
+		else if (0 == strcmp("-trainCompressionDictionary", argv[iargs]))
+		{
+			++iargs; if (iargs == argc) exitMissingArgument(argv, iargs - 1);
+			snprintf(transportPerfConfig.trainDictionaryFilename, sizeof(transportPerfConfig.trainDictionaryFilename), "%s", argv[iargs]);
+		}
+		else if (0 == strcmp("-payloadFile", argv[iargs]))
+		{
+			++iargs; if (iargs == argc) exitMissingArgument(argv, iargs - 1);
+			snprintf(transportThreadConfig.payloadFilename, sizeof(transportThreadConfig.payloadFilename), "%s", argv[iargs]);
+		}
 		else if (0 == strcmp("-if", argv[iargs]))
 		{
 			++iargs; if (iargs == argc) exitMissingArgument(argv, iargs - 1);
@@ -322,6 +348,26 @@ void initTransportPerfConfig(int argc, char **argv)
 		{
 			transportPerfConfig.tcpNoDelay = RSSL_FALSE;
 		}
+		else if (0 == strcmp("-shmemSpinCount", argv[iargs]))
+		{
+			++iargs; if (iargs == argc) exitMissingArgument(argv, iargs - 1);
+			sscanf(argv[iargs], "%u", &transportPerfConfig.shmemSpinCount);
+		}
+		else if (0 == strcmp("-ioEngine", argv[iargs]))
+		{
+			++iargs; if (iargs == argc) exitMissingArgument(argv, iargs - 1);
+			if (0 == strcmp("default", argv[iargs]))
+				transportPerfConfig.ioEngine = RSSL_IO_ENGINE_DEFAULT;
+			else if (0 == strcmp("uring", argv[iargs]))
+				transportPerfConfig.ioEngine = RSSL_IO_ENGINE_URING;
+			else if (0 == strcmp("uring-sqpoll", argv[iargs]))
+				transportPerfConfig.ioEngine = RSSL_IO_ENGINE_URING_SQPOLL;
+			else
+			{
+				printf("Config Error: Unknown I/O engine \"%s\"\n", argv[iargs]);
+				exitConfigError(argv);
+			}
+		}
 		else if (0 == strcmp("-msgRate", argv[iargs]))
 		{
 			++iargs; if (iargs == argc) exitMissingArgument(argv, iargs - 1);
@@ -426,10 +472,22 @@ void initTransportPerfConfig(int argc, char **argv)
 
 	if (transportPerfConfig.connectionType == RSSL_CONN_TYPE_INIT)
 	{
-		printf("Config Error: Unknown connectionType. Valid types are \"socket\", \"http\", \"encrypted\", \"reliableMCast\", \"shmem\", \"seqMCast\" \n");
+		printf("Config Error: Unknown connectionType. Valid types are \"socket\", \"http\", \"encrypted\", \"reliableMCast\", \"shmem\", \"bidirShmem\", \"seqMCast\" \n");
 		exitConfigError(argv);
 	} 
 
+	if (transportPerfConfig.splitReadWrite && transportPerfConfig.reflectMsgs)
+	{
+		printf("Config Error: -splitReadWrite cannot be used with -reflectMsgs.\n");
+		exitConfigError(argv);
+	}
+
+	if (transportPerfConfig.trainDictionaryFilename[0] && !transportThreadConfig.payloadFilename[0])
+	{
+		printf("Config Error: -trainCompressionDictionary requires -payloadFile.\n");
+		exitConfigError(argv);
+	}
+
 	if (transportPerfConfig.appType == APPTYPE_SERVER &&
 		transportPerfConfig.connectionType == RSSL_CONN_TYPE_UNIDIR_SHMEM)
 	{
@@ -456,6 +514,8 @@ static const char *connectionTypeToString(RsslConnectionTypes connType)
 			return "reliableMCast";
 		case RSSL_CONN_TYPE_UNIDIR_SHMEM:
 			return "shmem";
+		case RSSL_CONN_TYPE_BIDIR_SHMEM:
+			return "bidirShmem";
 		case RSSL_CONN_TYPE_SEQ_MCAST:
 			return "seqMCast";
 		default:
@@ -474,6 +534,23 @@ const char *compressionTypeToString(RsslCompTypes compType)
 			return "zlib";
 		case RSSL_COMP_LZ4:
 			return "lz4";
+		case RSSL_COMP_ZSTD:
+			return "zstd";
+		default:
+			return "unknown";
+	}
+}
+
+const char *ioEngineToString(RsslUInt8 ioEngine)
+{
+	switch(ioEngine)
+	{
+		case RSSL_IO_ENGINE_DEFAULT:
+			return "default";
+		case RSSL_IO_ENGINE_URING:
+			return "uring";
+		case RSSL_IO_ENGINE_URING_SQPOLL:
+			return "uring-sqpoll";
 		default:
 			return "unknown";
 	}
@@ -546,6 +623,7 @@ void printTransportPerfConfig(FILE *file)
 			"              App Type: %s\n"
 			"           Thread List: %s\n"
 			"             Busy Read: %s\n"
+			"      Split Read/Write: %s\n"
 			"              Msg Size: %u\n"
 			"              Msg Rate: %u%s\n"
 			"      Latency Msg Rate: %u%s\n"
@@ -556,8 +634,11 @@ void printTransportPerfConfig(FILE *file)
 			"       High Water Mark: %u%s\n"
 			"      Compression Type: %s(%u)\n"
 			"     Compression Level: %u\n"
+			"Compression Dictionary: %s\n"
+			"          Payload File: %s\n"
 			"        Interface Name: %s\n"
 			"           Tcp_NoDelay: %s\n"
+			"            I/O Engine: %s\n"
 			"             Tick Rate: %u\n"
 			"     Use Direct Writes: %s\n"
 			"      Latency Log File: %s\n"
@@ -568,6 +649,7 @@ void printTransportPerfConfig(FILE *file)
 			transportPerfConfig.appType == APPTYPE_SERVER ? "server" : "client", 
 			threadString,
 			transportPerfConfig.busyRead ? "Yes" : "No",
+			transportPerfConfig.splitReadWrite ? "Yes" : "No",
 			transportThreadConfig.msgSize,
 			transportPerfConfig.reflectMsgs ? 0 : transportThreadConfig.msgsPerSec,
 			transportPerfConfig.reflectMsgs ? "(reflecting)" : "",
@@ -581,8 +663,11 @@ void printTransportPerfConfig(FILE *file)
 			compressionTypeToString(transportPerfConfig.compressionType),
 			transportPerfConfig.compressionType,
 			transportPerfConfig.compressionLevel,
+			transportPerfConfig.compressionDictionaryFilename[0] ? transportPerfConfig.compressionDictionaryFilename : "(none)",
+			transportThreadConfig.payloadFilename[0] ? transportThreadConfig.payloadFilename : "(none)",
 			strlen(transportPerfConfig.interfaceName) ? transportPerfConfig.interfaceName : "(use default)",
 			(transportPerfConfig.tcpNoDelay ? "Yes" : "No"),
+			ioEngineToString(transportPerfConfig.ioEngine),
 			transportThreadConfig.ticksPerSec,
 			(transportThreadConfig.writeFlags & RSSL_WRITE_DIRECT_SOCKET_WRITE) ? "Yes" : "No",
 			transportThreadConfig.logLatencyToFile ? transportThreadConfig.latencyLogFilename : "(none)",
@@ -622,7 +707,7 @@ void exitWithUsage()
 			"  -appType <type>            Type of application(server, client)\n"
 			"\n"
 			"  -connType <type>           Type of connection:\n"
-			"                                   (\"socket\",\"websocket\", \"http\", \"encrypted\", \"reliableMCast\", \"shmem\", \"seqMCast\")\n"
+			"                                   (\"socket\",\"websocket\", \"http\", \"encrypted\", \"reliableMCast\", \"shmem\", \"bidirShmem\", \"seqMCast\")\n"
 			"  -encryptedConnType <type>  Encrypted connection protocol for a client connection only. Only used if the \"encrypted\" connection\n"
 			"                             type is selected. \"http\" type is only supported on Windows. (\"socket\",\"websocket\", \"http\")\n"
 			"\n"
@@ -636,10 +721,14 @@ void exitWithUsage()
 			"  -sendBufSize <size>        System Send Buffer Size(configures sysSendBufSize in the RSSL bind/connection options)\n"
 			"  -recvBufSize <size>        System Receive Buffer Size(configures sysRecvBufSize in the RSSL bind/connection options)\n"
 			"  -highWaterMark <bytes>     Number of queued bytes at which rsslWrite() internally flushes.\n"
-			"  -compressionType <type>    Type of compression to use(\"none\", \"zlib\", \"lz4\")\n"
+			"  -compressionType <type>    Type of compression to use(\"none\", \"zlib\", \"lz4\", \"zstd\")\n"
 			"  -compressionLevel <num>    Level of compression.\n"
+			"  -compressionDictionary <filename>  Pre-shared dictionary for zstd compression. Both sides must load the same one.\n"
+			"  -trainCompressionDictionary <filename>  Train a zstd dictionary from the -payloadFile, write it to the file and exit.\n"
 			"  -if <interface name>       Name of network interface to use\n"
 			"  -tcpDelay                  Turns off tcp_nodelay in RsslBindOpts, enabling Nagle's\n"
+			"  -ioEngine <engine>         Socket I/O engine(\"default\", \"uring\", \"uring-sqpoll\"). io_uring is Linux only.\n"
+			"  -shmemSpinCount <count>    Empty reads before a \"bidirShmem\" reader waits for notification(0 waits right away).\n"
 			"\n"
 			"  -tickRate <ticks/sec>      Ticks per second\n"
 			"  -msgRate <msgs/second>     Message rate per second\n"
@@ -650,7 +739,9 @@ void exitWithUsage()
 			"  -mcastStats                Take Multicast Statistics(Warning: This enables the per-channel lock).\n"
 			"\n"
 			"  -busyRead                  Continually read instead of using notification.\n"
+			"  -splitReadWrite            Read and write each channel from separate threads(Warning: This enables the per-channel lock).\n"
 			"  -msgSize                   Size of messages to send.\n"
+			"  -payloadFile <filename>    File of sample data(e.g. captured RWF) used to fill messages after the sequence number and timestamp.\n"
 			"  -runTime <sec>             Runtime of the application, in seconds\n"
 			"  -summaryFile <filename>    Name of file for logging summary info.\n"
 			"  -statsFile <filename>      Base name of file for logging periodic statistics.\n"
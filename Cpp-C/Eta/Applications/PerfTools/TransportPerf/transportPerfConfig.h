@@ -37,11 +37,16 @@ typedef struct
 													 * rather than using notification.
 													 * Messages cannot be sent in this mode. */
 
+	RsslBool splitReadWrite;						/* If set, each connection thread only reads, and a separate thread
+													 * writes to its channels.  See -splitReadWrite */
+
 	RsslConnectionTypes	connectionType;				/* Type of connection. See -connType */
 	RsslConnectionTypes encryptedConnectionType;		/* Encrypted connection type if the connectionType is ENCRYPTED*/
 	char 				portNo[32];					/* Port number. See -p */
 	char				interfaceName[128];			/* Name of interface.  See -if */
 	RsslBool			tcpNoDelay;					/* Enable/Disable Nagle's algorithm. See -tcpDelay */
+	RsslUInt8			ioEngine;					/* Socket I/O engine(RsslIOEngineTypes). See -ioEngine */
+	RsslUInt32			shmemSpinCount;				/* Empty reads before a bidirectional shared memory reader waits for a signal. See -shmemSpinCount */
 	RsslUInt32			guaranteedOutputBuffers;	/* Guaranteed Output Buffers. See -outputBufs */
 	RsslUInt32			maxFragmentSize;			/* Maximum Fragment Size. See -maxFragmentSize */
 	RsslUInt32			sendBufSize;				/* System Send Buffer Size(-sendBufSize) */
@@ -54,6 +59,9 @@ typedef struct
 
 	RsslCompTypes		compressionType;			/* Type of compression to use, if any. */
 	int					compressionLevel;			/* Compression level, optional depending on compression algorithm used */
+	char				compressionDictionaryFilename[255];	/* Pre-shared zstd dictionary to load.  See -compressionDictionary */
+	char				trainDictionaryFilename[255];	/* Train a zstd dictionary from the payload file, write it here and exit.
+														 * See -trainCompressionDictionary */
 	char				hostName[128];				/* hostName, if using rsslConnect(). See -hostname */
 	char				sendAddr[128];				/* Outbound address, if using a multicast connection. See -sa */
 	char				recvAddr[128];				/* Inbound address, if using a multicast connection. See -ra */
@@ -83,6 +91,9 @@ void printTransportPerfConfig(FILE *file);
 /* Prints out the compressionType value. */
 const char *compressionTypeToString(RsslCompTypes compType);
 
+/* Prints out the ioEngine value. */
+const char *ioEngineToString(RsslUInt8 ioEngine);
+
 /* Exits the application and prints out usage information. */
 void exitWithUsage();
 
@@ -88,11 +88,62 @@ void initTransportThreadConfig()
 		randArrayOpts.arrayCount = LATENCY_RANDOM_ARRAY_SET_COUNT;
 		createLatencyRandomArray(&latencyRandomArray, &randArrayOpts);
 	}
+
+	if (transportThreadConfig.payloadFilename[0] != '\0')
+	{
+		if (!(transportThreadConfig.payload = readWholeFile(transportThreadConfig.payloadFilename, &transportThreadConfig.payloadLength)))
+		{
+			printf("Config Error: Failed to read payload file %s.\n\n", transportThreadConfig.payloadFilename);
+			exit(-1);
+		}
+
+		if (transportThreadConfig.payloadLength == 0)
+		{
+			printf("Config Error: Payload file %s is empty.\n\n", transportThreadConfig.payloadFilename);
+			exit(-1);
+		}
+	}
 }
 
 void cleanupTransportThreadConfig()
 {
 	cleanupLatencyRandomArray(&latencyRandomArray);
+	free(transportThreadConfig.payload);
+	transportThreadConfig.payload = NULL;
+}
+
+char *readWholeFile(const char *filename, RsslUInt32 *pLength)
+{
+	FILE *file;
+	long length;
+	char *data;
+
+	if (!(file = fopen(filename, "rb")))
+		return NULL;
+
+	if (fseek(file, 0, SEEK_END) != 0 || (length = ftell(file)) < 0 || fseek(file, 0, SEEK_SET) != 0)
+	{
+		fclose(file);
+		return NULL;
+	}
+
+	/* Allocate at least one byte so that an empty file is still distinguishable from an error. */
+	if (!(data = (char*)malloc(length ? length : 1)))
+	{
+		fclose(file);
+		return NULL;
+	}
+
+	if (fread(data, 1, length, file) != (size_t)length)
+	{
+		free(data);
+		fclose(file);
+		return NULL;
+	}
+
+	fclose(file);
+	*pLength = (RsslUInt32)length;
+	return data;
 }
 
 void transportThreadInit(TransportThread *pThread,
@@ -105,6 +156,7 @@ void transportThreadInit(TransportThread *pThread,
 
 	initCountStat(&pThread->msgsSent);
 	initCountStat(&pThread->bytesSent);
+	initCountStat(&pThread->uncompBytesSent);
 	initCountStat(&pThread->msgsReceived);
 	initCountStat(&pThread->bytesReceived);
 	initCountStat(&pThread->outOfBuffersCount);
@@ -230,6 +282,25 @@ static RsslRet transportSessionSendMsg(TransportThread *pHandler, TransportSessi
 	offset += SEQNUM_SZ;
 
 	memcpy(pSession->pWritingBuffer->data + offset, &currentTime, SEQNUM_SZ);
+	offset += SEQNUM_SZ;
+
+	/* Fill the rest of the message with sample data, so that compression behaves as it would on real traffic. */
+	if (transportThreadConfig.payloadLength)
+	{
+		while ((RsslUInt32)offset < transportThreadConfig.msgSize)
+		{
+			RsslUInt32 copyLength = transportThreadConfig.payloadLength - pSession->payloadPosition;
+
+			if (copyLength > transportThreadConfig.msgSize - offset)
+				copyLength = transportThreadConfig.msgSize - offset;
+
+			memcpy(pSession->pWritingBuffer->data + offset, transportThreadConfig.payload + pSession->payloadPosition, copyLength);
+			offset += copyLength;
+
+			if ((pSession->payloadPosition += copyLength) == transportThreadConfig.payloadLength)
+				pSession->payloadPosition = 0;
+		}
+	}
 
 	pSession->pWritingBuffer->length = transportThreadConfig.msgSize;
 
@@ -333,6 +404,7 @@ RsslRet writeMsgBuffer(TransportThread *pHandler, TransportSession *pSession, Rs
 		{
 			pSession->pWritingBuffer = 0;
 			countStatAdd(&pHandler->bytesSent, outBytes);
+			countStatAdd(&pHandler->uncompBytesSent, uncompOutBytes);
 			countStatIncr(&pHandler->msgsSent);
 			return ret;
 		}
@@ -344,6 +416,7 @@ RsslRet writeMsgBuffer(TransportThread *pHandler, TransportSession *pSession, Rs
 				{
 					pSession->pWritingBuffer = 0;
 					countStatAdd(&pHandler->bytesSent, outBytes);
+					countStatAdd(&pHandler->uncompBytesSent, uncompOutBytes);
 					countStatIncr(&pHandler->msgsSent);
 					return 1;
 				}
@@ -48,6 +48,9 @@ typedef struct
 	char		statsFilename[128];			/* Name of the statistics log file*/
 	RsslBool	logLatencyToFile;			/* Whether to log latency information to a file. See -latencyFile. */
 	char		latencyLogFilename[128];	/* Name of the latency log file. See -latencyFile. */
+	char		payloadFilename[255];		/* Sample data used to fill messages. See -payloadFile. */
+	char		*payload;					/* Contents of payloadFilename, if any. */
+	RsslUInt32	payloadLength;				/* Length of payload. */
 
 } TransportThreadConfig;
 
@@ -63,6 +66,9 @@ void initTransportThreadConfig();
 /* Cleans up memory associated with the transportThreadConfig. */
 void cleanupTransportThreadConfig();
 
+/* Reads an entire file into memory. The returned data should be freed by the caller. */
+char *readWholeFile(const char *filename, RsslUInt32 *pLength);
+
 /* Stores information about an open session on a channel. */
 typedef struct {
 	ChannelInfo		*pChannelInfo;			/* Channel associated with this session */
@@ -74,6 +80,8 @@ typedef struct {
 	RsslBool 
 		receivedFirstSequenceNumber;		/* Indicates whether a sequence number has been received yet. */
 	RsslTimeValue		timeActivated;			/* Time at which this channel was fully setup. */
+	RsslQueueLink		writeLink;				/* Link for the writer thread's session list(-splitReadWrite). */
+	RsslUInt32		payloadPosition;		/* Next position in transportThreadConfig.payload to copy from. */
 } TransportSession;
 
 /* Handles one transport thread. */
@@ -87,6 +95,7 @@ typedef struct
 	RsslTimeValue				disconnectTime; 	/* Time of last disconnection. */
 	CountStat				msgsSent;			/* Total messages sent. */
 	CountStat				bytesSent;			/* Total bytes sent(counting any compression) */
+	CountStat				uncompBytesSent;	/* Total bytes sent, before compression. */
 	CountStat				msgsReceived;		/* Total messages received. */
 	CountStat				bytesReceived;		/* Total bytes received. */
 	CountStat				outOfBuffersCount;	/* Messages not sent for lack of output buffers. */
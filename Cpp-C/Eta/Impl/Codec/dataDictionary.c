@@ -18,6 +18,17 @@ extern "C" {
 #include <sys/types.h>
 #include <stdarg.h>
 #include <stddef.h>
+#include <stdint.h>
+#include <errno.h>
+
+#ifdef WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
 
 #include "rtr/rsslDataDictionary.h"
 #include "rtr/rsslDataUtils.h"
@@ -42,6 +53,10 @@ typedef struct {
 	/* Indicate whether the entries in this dictionary are linked by another one, so we don't delete them on cleanup. */
 	RsslBool isLinked;
 
+	/* If the dictionary was loaded from a snapshot, the mapping that holds its entries, tables and tags. */
+	char		*pSnapshot;
+	RsslUInt64	snapshotLength;
+
 	/* Hash table links to use in fieldsByName table. 
 	 * The links are stored on the dictionary itself, not the entry objects. This allows rsslLinkDataDictionary to add fields to the new
 	 * dictionary without editing the links in the old dictionary (so that the table in the old dictionary can still be safely used 
@@ -182,6 +197,14 @@ void _setError(RsslBuffer *errorText, char *format, ...)
 	}
 }
 
+static void _unmapSnapshot(char *pSnapshot, RsslUInt64 length);
+
+/* Dictionaries loaded from a snapshot are read-only. */
+static RsslBool _isSnapshotDictionary(RsslDataDictionary *dictionary)
+{
+	return dictionary->isInitialized && ((RsslDictionaryInternal*)dictionary->_internal)->pSnapshot != NULL;
+}
+
 void _freeLists( RsslReferenceFidStore *pFids, RsslEnumTypeStore *pEnumTypes, RsslBool success)
 {
 	if (pFids)
@@ -993,6 +1016,12 @@ RSSL_API RsslRet rsslLoadFieldDictionary(	const char				*filename,
 		return RSSL_RET_FAILURE;
 	}
 
+	if (_isSnapshotDictionary(dictionary))
+	{
+		_setError(errorText, "Definitions cannot be added to a dictionary loaded from a snapshot.");
+		return RSSL_RET_FAILURE;
+	}
+
 	if ((fp = fopen(filename, "r")) == NULL)
 	{
 		_setError(errorText, "Can't open file: '%s'.", filename);
@@ -1737,6 +1766,16 @@ RSSL_API RsslRet rsslDeleteDataDictionary( RsslDataDictionary *dictionary )
 	pDictionaryInternal = (RsslDictionaryInternal*)dictionary->_internal;
 	RSSL_ASSERT(pDictionaryInternal != NULL, Dictionary internal pointers is null); /* Dictionary was initialized, so this should exist. */
 
+	/* Everything but the fields-by-name table is in the snapshot. */
+	if (pDictionaryInternal->pSnapshot)
+	{
+		_unmapSnapshot(pDictionaryInternal->pSnapshot, pDictionaryInternal->snapshotLength);
+		rsslHashTableCleanup(&pDictionaryInternal->fieldsByName);
+		free(pDictionaryInternal);
+		dictionary->isInitialized = RSSL_FALSE;
+		return RSSL_RET_SUCCESS;
+	}
+
 	/* Delete tag info */
 	if (dictionary->infoField_Version.data)
 		free(dictionary->infoField_Version.data);
@@ -1821,6 +1860,12 @@ RSSL_API RsslRet rsslDecodeFieldDictionary(
 		return RSSL_RET_FAILURE;
 	}
 
+	if (_isSnapshotDictionary(dictionary))
+	{
+		_setError(errorText, "Definitions cannot be added to a dictionary loaded from a snapshot.");
+		return RSSL_RET_FAILURE;
+	}
+
 	if (!dictionary->isInitialized && _initDictionary(dictionary, errorText) != RSSL_RET_SUCCESS)
 		return RSSL_RET_FAILURE;
 
@@ -2129,6 +2174,12 @@ RSSL_API RsslRet rsslLoadEnumTypeDictionary(	const char				*filename,
 		return RSSL_RET_FAILURE;
 	}
 
+	if (_isSnapshotDictionary(dictionary))
+	{
+		_setError(errorText, "Definitions cannot be added to a dictionary loaded from a snapshot.");
+		return RSSL_RET_FAILURE;
+	}
+
 	if ((fp = fopen(filename, "r")) == NULL)
 	{
 		_setError(errorText, "Can't open file: '%s'.", filename);
@@ -2320,6 +2371,12 @@ RSSL_API RsslRet rsslDecodeEnumTypeDictionary(
 		return RSSL_RET_FAILURE;
 	}
 
+	if (_isSnapshotDictionary(dictionary))
+	{
+		_setError(errorText, "Definitions cannot be added to a dictionary loaded from a snapshot.");
+		return RSSL_RET_FAILURE;
+	}
+
 	if (!dictionary->isInitialized && _initDictionary(dictionary, errorText) != RSSL_RET_SUCCESS)
 		return RSSL_RET_FAILURE;
 
@@ -3244,6 +3301,10 @@ RSSL_API RsslRet rsslLinkDataDictionary(RsslDataDictionary *pNewDictionary, Rssl
 	RsslDictionaryInternal *pNewDictionaryInternal = (RsslDictionaryInternal*)pNewDictionary->_internal;
 	int i;
 
+	/* Linking replaces entries in the new dictionary, and the old one's entries must outlive it. */
+	if (pNewDictionaryInternal->pSnapshot || pOldDictionaryInternal->pSnapshot)
+		return (_setError(errorText, "Dictionaries loaded from a snapshot cannot be linked."), RSSL_RET_FAILURE);
+
 	/* Check that the new dictionary is a superset of the old dictionary before linking them. */
 
 	/* Check that major versions match. */
@@ -3429,6 +3490,920 @@ RSSL_API RsslRet rsslLinkDataDictionary(RsslDataDictionary *pNewDictionary, Rssl
 	return RSSL_RET_SUCCESS;
 }
 
+/*** Dictionary snapshots ***/
+
+/* A snapshot is an image of a dictionary: a header, the RsslDataDictionary, its entries array, and every entry,
+ * enumerated type table and string it refers to.  Every pointer in the image is valid when the image is mapped at
+ * baseAddress.  The relocation list at the end gives the position of each pointer, so that an image mapped
+ * anywhere else can be used after moving each pointer by the difference. */
+
+#define SNAPSHOT_MAGIC "RSSLDICT"
+#define SNAPSHOT_VERSION 1
+#define SNAPSHOT_BYTE_ORDER 0x01020304
+
+/* Default base addresses are spread over 4096 one-gigabyte slots, so that different dictionaries
+ * are unlikely to want the same address. */
+#define SNAPSHOT_DEFAULT_BASE_ADDRESS 0x500000000000LL
+#define SNAPSHOT_DEFAULT_BASE_SLOTS 4096
+#define SNAPSHOT_DEFAULT_BASE_SLOT_SIZE 0x40000000LL
+
+/* Base addresses must suit the mapping granularity of every platform. */
+#define SNAPSHOT_BASE_ALIGNMENT 65536
+
+#define SNAPSHOT_ALIGN(__length) (((__length) + 7) & ~(size_t)7)
+
+typedef struct {
+	char		magic[8];			/* SNAPSHOT_MAGIC */
+	RsslUInt32	version;			/* SNAPSHOT_VERSION */
+	RsslUInt32	byteOrder;			/* SNAPSHOT_BYTE_ORDER, as written by the platform that created the image. */
+	RsslUInt32	pointerSize;		/* Sizes of the structures in the image. */
+	RsslUInt32	dictionarySize;
+	RsslUInt32	entrySize;
+	RsslUInt32	enumTableSize;
+	RsslUInt32	enumTypeSize;
+	RsslUInt32	reserved;
+	RsslUInt64	baseAddress;		/* Address at which the pointers in the image are valid. */
+	RsslUInt64	imageLength;		/* Length of the image(the whole file). */
+	RsslUInt64	dictionaryOffset;	/* Position of the RsslDataDictionary. */
+	RsslUInt64	relocationOffset;	/* Position of the relocation list(an RsslUInt64 position for each pointer). */
+	RsslUInt64	relocationCount;	/* Number of pointers in the relocation list. */
+} RsslDictionarySnapshotHeader;
+
+/* Builds a snapshot image in memory.  While building, pointers in the image hold the position of their target;
+ * the base address is added once the image is complete. */
+typedef struct {
+	char		*data;
+	size_t		length;
+	size_t		capacity;
+	RsslUInt64	*relocations;
+	size_t		relocationCount;
+	size_t		relocationCapacity;
+} SnapshotBuilder;
+
+/* Reserves zeroed, aligned space in the image. */
+static RsslRet _snapshotAlloc(SnapshotBuilder *pBuilder, size_t length, size_t *pOffset)
+{
+	size_t newLength = SNAPSHOT_ALIGN(pBuilder->length + length);
+
+	if (newLength > pBuilder->capacity)
+	{
+		size_t newCapacity = pBuilder->capacity ? pBuilder->capacity : 1048576;
+		char *newData;
+
+		while (newCapacity < newLength)
+			newCapacity *= 2;
+
+		if ((newData = (char*)realloc(pBuilder->data, newCapacity)) == NULL)
+			return RSSL_RET_FAILURE;
+
+		memset(newData + pBuilder->capacity, 0, newCapacity - pBuilder->capacity);
+		pBuilder->data = newData;
+		pBuilder->capacity = newCapacity;
+	}
+
+	*pOffset = pBuilder->length;
+	pBuilder->length = newLength;
+	return RSSL_RET_SUCCESS;
+}
+
+/* Points the pointer at slotOffset in the image to targetOffset, and adds it to the relocation list. */
+static RsslRet _snapshotSetPointer(SnapshotBuilder *pBuilder, size_t slotOffset, size_t targetOffset)
+{
+	void *pointer = (void*)targetOffset;
+
+	if (pBuilder->relocationCount == pBuilder->relocationCapacity)
+	{
+		size_t newCapacity = pBuilder->relocationCapacity ? pBuilder->relocationCapacity * 2 : 65536;
+		RsslUInt64 *newRelocations;
+
+		if ((newRelocations = (RsslUInt64*)realloc(pBuilder->relocations, newCapacity * sizeof(RsslUInt64))) == NULL)
+			return RSSL_RET_FAILURE;
+
+		pBuilder->relocations = newRelocations;
+		pBuilder->relocationCapacity = newCapacity;
+	}
+
+	memcpy(pBuilder->data + slotOffset, &pointer, sizeof(pointer));
+	pBuilder->relocations[pBuilder->relocationCount++] = slotOffset;
+	return RSSL_RET_SUCCESS;
+}
+
+/* Copies a string into the image, for the RsslBuffer at bufferOffset(whose length is already set). */
+static RsslRet _snapshotCopyBuffer(SnapshotBuilder *pBuilder, size_t bufferOffset, const RsslBuffer *pBuffer)
+{
+	size_t offset;
+
+	if (pBuffer->data == NULL)
+		return RSSL_RET_SUCCESS;
+
+	/* Strings keep their null terminator, as they are also used as C strings. */
+	if (_snapshotAlloc(pBuilder, (size_t)pBuffer->length + 1, &offset) != RSSL_RET_SUCCESS)
+		return RSSL_RET_FAILURE;
+
+	memcpy(pBuilder->data + offset, pBuffer->data, pBuffer->length);
+	return _snapshotSetPointer(pBuilder, bufferOffset + offsetof(RsslBuffer, data), offset);
+}
+
+/* Adds an enumerated type table to the image. */
+static RsslRet _snapshotAddEnumTable(SnapshotBuilder *pBuilder, RsslEnumTypeTable *pTable, size_t *pTableOffset)
+{
+	RsslEnumTypeTable table = *pTable;
+	size_t tableOffset, enumTypesOffset, referencesOffset;
+	RsslUInt32 i;
+
+	table.enumTypes = NULL;
+	table.fidReferences = NULL;
+
+	if (_snapshotAlloc(pBuilder, sizeof(RsslEnumTypeTable), &tableOffset) != RSSL_RET_SUCCESS
+			|| _snapshotAlloc(pBuilder, ((size_t)pTable->maxValue + 1) * sizeof(RsslEnumType*), &enumTypesOffset) != RSSL_RET_SUCCESS)
+		return RSSL_RET_FAILURE;
+
+	memcpy(pBuilder->data + tableOffset, &table, sizeof(table));
+
+	if (_snapshotSetPointer(pBuilder, tableOffset + offsetof(RsslEnumTypeTable, enumTypes), enumTypesOffset) != RSSL_RET_SUCCESS)
+		return RSSL_RET_FAILURE;
+
+	for (i = 0; i <= pTable->maxValue; ++i)
+	{
+		RsslEnumTypeImpl enumType;
+		size_t enumTypeOffset;
+
+		if (pTable->enumTypes[i] == NULL)
+			continue;
+
+		/* Keep the flags that follow the RsslEnumType. */
+		enumType = *(RsslEnumTypeImpl*)pTable->enumTypes[i];
+		enumType.base.display.data = NULL;
+		enumType.base.meaning.data = NULL;
+
+		if (_snapshotAlloc(pBuilder, sizeof(RsslEnumTypeImpl), &enumTypeOffset) != RSSL_RET_SUCCESS)
+			return RSSL_RET_FAILURE;
+
+		memcpy(pBuilder->data + enumTypeOffset, &enumType, sizeof(enumType));
+
+		if (_snapshotSetPointer(pBuilder, enumTypesOffset + i * sizeof(RsslEnumType*), enumTypeOffset) != RSSL_RET_SUCCESS
+				|| _snapshotCopyBuffer(pBuilder, enumTypeOffset + offsetof(RsslEnumType, display), &pTable->enumTypes[i]->display) != RSSL_RET_SUCCESS
+				|| _snapshotCopyBuffer(pBuilder, enumTypeOffset + offsetof(RsslEnumType, meaning), &pTable->enumTypes[i]->meaning) != RSSL_RET_SUCCESS)
+			return RSSL_RET_FAILURE;
+	}
+
+	if (pTable->fidReferenceCount)
+	{
+		if (_snapshotAlloc(pBuilder, pTable->fidReferenceCount * sizeof(RsslFieldId), &referencesOffset) != RSSL_RET_SUCCESS)
+			return RSSL_RET_FAILURE;
+
+		memcpy(pBuilder->data + referencesOffset, pTable->fidReferences, pTable->fidReferenceCount * sizeof(RsslFieldId));
+
+		if (_snapshotSetPointer(pBuilder, tableOffset + offsetof(RsslEnumTypeTable, fidReferences), referencesOffset) != RSSL_RET_SUCCESS)
+			return RSSL_RET_FAILURE;
+	}
+
+	*pTableOffset = tableOffset;
+	return RSSL_RET_SUCCESS;
+}
+
+/* Adds an entry to the image.  Its enumerated type table must already be in the image. */
+static RsslRet _snapshotAddEntry(SnapshotBuilder *pBuilder, RsslDataDictionary *dictionary, RsslDictionaryEntry *pEntry, size_t *tableOffsets, size_t *pEntryOffset)
+{
+	RsslDictionaryEntry entry = *pEntry;
+	size_t entryOffset;
+
+	entry.acronym.data = NULL;
+	entry.ddeAcronym.data = NULL;
+	entry.pEnumTypeTable = NULL;
+
+	if (_snapshotAlloc(pBuilder, sizeof(RsslDictionaryEntry), &entryOffset) != RSSL_RET_SUCCESS)
+		return RSSL_RET_FAILURE;
+
+	memcpy(pBuilder->data + entryOffset, &entry, sizeof(entry));
+
+	if (_snapshotCopyBuffer(pBuilder, entryOffset + offsetof(RsslDictionaryEntry, acronym), &pEntry->acronym) != RSSL_RET_SUCCESS
+			|| _snapshotCopyBuffer(pBuilder, entryOffset + offsetof(RsslDictionaryEntry, ddeAcronym), &pEntry->ddeAcronym) != RSSL_RET_SUCCESS)
+		return RSSL_RET_FAILURE;
+
+	if (pEntry->pEnumTypeTable)
+	{
+		RsslUInt32 i;
+
+		for (i = 0; i < dictionary->enumTableCount; ++i)
+		{
+			if (dictionary->enumTables[i] == pEntry->pEnumTypeTable)
+				break;
+		}
+
+		if (i == dictionary->enumTableCount)
+			return RSSL_RET_FAILURE;
+
+		if (_snapshotSetPointer(pBuilder, entryOffset + offsetof(RsslDictionaryEntry, pEnumTypeTable), tableOffsets[i]) != RSSL_RET_SUCCESS)
+			return RSSL_RET_FAILURE;
+	}
+
+	*pEntryOffset = entryOffset;
+	return RSSL_RET_SUCCESS;
+}
+
+/* Chooses a default base address from the contents of the image(FNV-1a hash). */
+static RsslUInt64 _snapshotDefaultBaseAddress(SnapshotBuilder *pBuilder)
+{
+	RsslUInt64 hash = 0xcbf29ce484222325LL;
+	size_t i;
+
+	if (sizeof(void*) < 8)
+		return 0;
+
+	for (i = sizeof(RsslDictionarySnapshotHeader); i < pBuilder->length; ++i)
+	{
+		hash ^= (unsigned char)pBuilder->data[i];
+		hash *= 0x100000001b3LL;
+	}
+
+	return SNAPSHOT_DEFAULT_BASE_ADDRESS + (hash % SNAPSHOT_DEFAULT_BASE_SLOTS) * SNAPSHOT_DEFAULT_BASE_SLOT_SIZE;
+}
+
+/* Snapshots are written to a temporary file next to the snapshot, which is flushed to disk and then renamed over it.
+ * A process that maps the snapshot meanwhile sees either the old image or the new one, never a partial one. */
+#ifdef WIN32
+
+static RsslRet _writeSnapshotFile(const char *filename, const char *data, size_t length, RsslBuffer *errorText)
+{
+	char *tempName;
+	HANDLE file;
+	size_t written = 0;
+	BOOL ok;
+
+	if ((tempName = (char*)malloc(strlen(filename) + 32)) == NULL)
+		return (_setError(errorText, "<%s:%d> Error allocating space for snapshot", __FILE__, __LINE__), RSSL_RET_FAILURE);
+
+	sprintf(tempName, "%s.%lu.tmp", filename, (unsigned long)GetCurrentProcessId());
+
+	if ((file = CreateFileA(tempName, GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL)) == INVALID_HANDLE_VALUE)
+	{
+		free(tempName);
+		return (_setError(errorText, "Can't open file: '%s'.", filename), RSSL_RET_FAILURE);
+	}
+
+	ok = TRUE;
+	while (ok && written < length)
+	{
+		DWORD bytes;
+		DWORD chunk = (length - written > 0x40000000) ? 0x40000000 : (DWORD)(length - written);
+
+		if ((ok = WriteFile(file, data + written, chunk, &bytes, NULL)) != FALSE)
+			written += bytes;
+	}
+
+	ok = (ok && FlushFileBuffers(file));
+	ok = (CloseHandle(file) && ok);
+	ok = (ok && MoveFileExA(tempName, filename, MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH));
+
+	if (!ok)
+	{
+		DeleteFileA(tempName);
+		free(tempName);
+		return (_setError(errorText, "Failed to write file: '%s'.", filename), RSSL_RET_FAILURE);
+	}
+
+	free(tempName);
+	return RSSL_RET_SUCCESS;
+}
+
+#else
+
+static RsslRet _writeSnapshotFile(const char *filename, const char *data, size_t length, RsslBuffer *errorText)
+{
+	char *tempName;
+	size_t written = 0;
+	int fd;
+
+	if ((tempName = (char*)malloc(strlen(filename) + 32)) == NULL)
+		return (_setError(errorText, "<%s:%d> Error allocating space for snapshot", __FILE__, __LINE__), RSSL_RET_FAILURE);
+
+	sprintf(tempName, "%s.%ld.tmp", filename, (long)getpid());
+
+	if ((fd = open(tempName, O_WRONLY | O_CREAT | O_TRUNC, 0666)) < 0)
+	{
+		free(tempName);
+		return (_setError(errorText, "Can't open file: '%s'.", filename), RSSL_RET_FAILURE);
+	}
+
+	while (written < length)
+	{
+		ssize_t bytes = write(fd, data + written, length - written);
+
+		if (bytes < 0 && errno == EINTR)
+			continue;
+		if (bytes <= 0)
+			break;
+		written += (size_t)bytes;
+	}
+
+	if (written != length || fsync(fd) != 0)
+	{
+		close(fd);
+		unlink(tempName);
+		free(tempName);
+		return (_setError(errorText, "Failed to write file: '%s'.", filename), RSSL_RET_FAILURE);
+	}
+
+	if (close(fd) != 0 || rename(tempName, filename) != 0)
+	{
+		unlink(tempName);
+		free(tempName);
+		return (_setError(errorText, "Failed to write file: '%s'.", filename), RSSL_RET_FAILURE);
+	}
+
+	free(tempName);
+	return RSSL_RET_SUCCESS;
+}
+
+#endif
+
+RSSL_API RsslRet rsslSaveDataDictionarySnapshot(	const char				*filename,
+							RsslDataDictionary	*dictionary,
+							RsslUInt64			baseAddress,
+							RsslBuffer			*errorText )
+{
+	SnapshotBuilder builder;
+	RsslDictionarySnapshotHeader header;
+	RsslDataDictionary imageDictionary;
+	size_t headerOffset, dictionaryOffset, entriesOffset, enumTablesOffset = 0, relocationOffset;
+	size_t *tableOffsets = NULL;
+	RsslInt32 fid;
+	RsslUInt32 i;
+	size_t j;
+	RsslRet ret;
+
+	if (filename == 0)
+	{
+		_setError(errorText, "NULL Filename pointer.");
+		return RSSL_RET_FAILURE;
+	}
+
+	if (dictionary == 0 || !dictionary->isInitialized)
+	{
+		_setError(errorText, "Dictionary has no definitions.");
+		return RSSL_RET_FAILURE;
+	}
+
+	if (baseAddress % SNAPSHOT_BASE_ALIGNMENT != 0)
+	{
+		_setError(errorText, "Base address must be a multiple of %d.", SNAPSHOT_BASE_ALIGNMENT);
+		return RSSL_RET_FAILURE;
+	}
+
+	memset(&builder, 0, sizeof(builder));
+
+	if (_snapshotAlloc(&builder, sizeof(RsslDictionarySnapshotHeader), &headerOffset) != RSSL_RET_SUCCESS
+			|| _snapshotAlloc(&builder, sizeof(RsslDataDictionary), &dictionaryOffset) != RSSL_RET_SUCCESS
+			|| _snapshotAlloc(&builder, (RSSL_MAX_FID - RSSL_MIN_FID + 1) * sizeof(RsslDictionaryEntry*), &entriesOffset) != RSSL_RET_SUCCESS
+			|| (dictionary->enumTableCount
+				&& _snapshotAlloc(&builder, dictionary->enumTableCount * sizeof(RsslEnumTypeTable*), &enumTablesOffset) != RSSL_RET_SUCCESS))
+		goto outOfMemory;
+
+	/* The dictionary itself, without the pointers(which are set below) or any internal state. */
+	imageDictionary = *dictionary;
+	imageDictionary.entriesArray = NULL;
+	imageDictionary.enumTables = NULL;
+	imageDictionary._internal = NULL;
+	imageDictionary.infoField_Version.data = NULL;
+	imageDictionary.infoEnum_RT_Version.data = NULL;
+	imageDictionary.infoEnum_DT_Version.data = NULL;
+	imageDictionary.infoField_Filename.data = NULL;
+	imageDictionary.infoField_Desc.data = NULL;
+	imageDictionary.infoField_Build.data = NULL;
+	imageDictionary.infoField_Date.data = NULL;
+	imageDictionary.infoEnum_Filename.data = NULL;
+	imageDictionary.infoEnum_Desc.data = NULL;
+	imageDictionary.infoEnum_Date.data = NULL;
+	memcpy(builder.data + dictionaryOffset, &imageDictionary, sizeof(imageDictionary));
+
+	/* entriesArray points to the entry for fid 0, as in a loaded dictionary. */
+	if (_snapshotSetPointer(&builder, dictionaryOffset + offsetof(RsslDataDictionary, entriesArray),
+				entriesOffset + (size_t)(0 - RSSL_MIN_FID) * sizeof(RsslDictionaryEntry*)) != RSSL_RET_SUCCESS
+			|| (dictionary->enumTableCount
+				&& _snapshotSetPointer(&builder, dictionaryOffset + offsetof(RsslDataDictionary, enumTables), enumTablesOffset) != RSSL_RET_SUCCESS)
+			|| _snapshotCopyBuffer(&builder, dictionaryOffset + offsetof(RsslDataDictionary, infoField_Version), &dictionary->infoField_Version) != RSSL_RET_SUCCESS
+			|| _snapshotCopyBuffer(&builder, dictionaryOffset + offsetof(RsslDataDictionary, infoEnum_RT_Version), &dictionary->infoEnum_RT_Version) != RSSL_RET_SUCCESS
+			|| _snapshotCopyBuffer(&builder, dictionaryOffset + offsetof(RsslDataDictionary, infoEnum_DT_Version), &dictionary->infoEnum_DT_Version) != RSSL_RET_SUCCESS
+			|| _snapshotCopyBuffer(&builder, dictionaryOffset + offsetof(RsslDataDictionary, infoField_Filename), &dictionary->infoField_Filename) != RSSL_RET_SUCCESS
+			|| _snapshotCopyBuffer(&builder, dictionaryOffset + offsetof(RsslDataDictionary, infoField_Desc), &dictionary->infoField_Desc) != RSSL_RET_SUCCESS
+			|| _snapshotCopyBuffer(&builder, dictionaryOffset + offsetof(RsslDataDictionary, infoField_Build), &dictionary->infoField_Build) != RSSL_RET_SUCCESS
+			|| _snapshotCopyBuffer(&builder, dictionaryOffset + offsetof(RsslDataDictionary, infoField_Date), &dictionary->infoField_Date) != RSSL_RET_SUCCESS
+			|| _snapshotCopyBuffer(&builder, dictionaryOffset + offsetof(RsslDataDictionary, infoEnum_Filename), &dictionary->infoEnum_Filename) != RSSL_RET_SUCCESS
+			|| _snapshotCopyBuffer(&builder, dictionaryOffset + offsetof(RsslDataDictionary, infoEnum_Desc), &dictionary->infoEnum_Desc) != RSSL_RET_SUCCESS
+			|| _snapshotCopyBuffer(&builder, dictionaryOffset + offsetof(RsslDataDictionary, infoEnum_Date), &dictionary->infoEnum_Date) != RSSL_RET_SUCCESS)
+		goto outOfMemory;
+
+	if (dictionary->enumTableCount)
+	{
+		if ((tableOffsets = (size_t*)malloc(dictionary->enumTableCount * sizeof(size_t))) == NULL)
+			goto outOfMemory;
+
+		for (i = 0; i < dictionary->enumTableCount; ++i)
+		{
+			if (_snapshotAddEnumTable(&builder, dictionary->enumTables[i], &tableOffsets[i]) != RSSL_RET_SUCCESS
+					|| _snapshotSetPointer(&builder, enumTablesOffset + i * sizeof(RsslEnumTypeTable*), tableOffsets[i]) != RSSL_RET_SUCCESS)
+				goto outOfMemory;
+		}
+	}
+
+	/* Entries include those that only reference an enumerated type table so far. */
+	for (fid = RSSL_MIN_FID; fid <= RSSL_MAX_FID; ++fid)
+	{
+		RsslDictionaryEntry *pEntry = dictionary->entriesArray[fid];
+		size_t entryOffset;
+
+		if (pEntry == NULL)
+			continue;
+
+		if (_snapshotAddEntry(&builder, dictionary, pEntry, tableOffsets, &entryOffset) != RSSL_RET_SUCCESS
+				|| _snapshotSetPointer(&builder, entriesOffset + (size_t)(fid - RSSL_MIN_FID) * sizeof(RsslDictionaryEntry*), entryOffset) != RSSL_RET_SUCCESS)
+		{
+			free(tableOffsets);
+			free(builder.data);
+			free(builder.relocations);
+			_setError(errorText, "Failed to add field %d to the snapshot.", fid);
+			return RSSL_RET_FAILURE;
+		}
+	}
+
+	free(tableOffsets);
+	tableOffsets = NULL;
+
+	if (_snapshotAlloc(&builder, builder.relocationCount * sizeof(RsslUInt64), &relocationOffset) != RSSL_RET_SUCCESS)
+		goto outOfMemory;
+
+	memcpy(builder.data + relocationOffset, builder.relocations, builder.relocationCount * sizeof(RsslUInt64));
+
+	if (baseAddress == 0)
+		baseAddress = _snapshotDefaultBaseAddress(&builder);
+	else if (sizeof(void*) < 8 && baseAddress + builder.length > 0xFFFFFFFFLL)
+	{
+		free(builder.data);
+		free(builder.relocations);
+		_setError(errorText, "Base address is out of range.");
+		return RSSL_RET_FAILURE;
+	}
+
+	/* Pointers hold the position of their target until now. */
+	for (j = 0; j < builder.relocationCount; ++j)
+	{
+		char *pointer;
+
+		memcpy(&pointer, builder.data + builder.relocations[j], sizeof(pointer));
+		pointer = (char*)(uintptr_t)((RsslUInt64)(uintptr_t)pointer + baseAddress);
+		memcpy(builder.data + builder.relocations[j], &pointer, sizeof(pointer));
+	}
+
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, SNAPSHOT_MAGIC, sizeof(header.magic));
+	header.version = SNAPSHOT_VERSION;
+	header.byteOrder = SNAPSHOT_BYTE_ORDER;
+	header.pointerSize = sizeof(void*);
+	header.dictionarySize = sizeof(RsslDataDictionary);
+	header.entrySize = sizeof(RsslDictionaryEntry);
+	header.enumTableSize = sizeof(RsslEnumTypeTable);
+	header.enumTypeSize = sizeof(RsslEnumTypeImpl);
+	header.baseAddress = baseAddress;
+	header.imageLength = builder.length;
+	header.dictionaryOffset = dictionaryOffset;
+	header.relocationOffset = relocationOffset;
+	header.relocationCount = builder.relocationCount;
+	memcpy(builder.data + headerOffset, &header, sizeof(header));
+
+	ret = _writeSnapshotFile(filename, builder.data, builder.length, errorText);
+	free(builder.data);
+	free(builder.relocations);
+	return ret;
+
+outOfMemory:
+	free(tableOffsets);
+	free(builder.data);
+	free(builder.relocations);
+	_setError(errorText, "<%s:%d> Error allocating space for snapshot", __FILE__, __LINE__);
+	return RSSL_RET_FAILURE;
+}
+
+/* Checks that a snapshot was written for this build and that its layout fits in the file. */
+static RsslRet _checkSnapshotHeader(RsslDictionarySnapshotHeader *pHeader, RsslUInt64 fileLength, const char *filename, RsslBuffer *errorText)
+{
+	if (memcmp(pHeader->magic, SNAPSHOT_MAGIC, sizeof(pHeader->magic)) != 0)
+		return (_setError(errorText, "'%s' is not a dictionary snapshot.", filename), RSSL_RET_FAILURE);
+
+	if (pHeader->version != SNAPSHOT_VERSION)
+		return (_setError(errorText, "Dictionary snapshot '%s' has version %u; version %u is required.", filename, pHeader->version, SNAPSHOT_VERSION), RSSL_RET_FAILURE);
+
+	if (pHeader->byteOrder != SNAPSHOT_BYTE_ORDER || pHeader->pointerSize != sizeof(void*)
+			|| pHeader->dictionarySize != sizeof(RsslDataDictionary) || pHeader->entrySize != sizeof(RsslDictionaryEntry)
+			|| pHeader->enumTableSize != sizeof(RsslEnumTypeTable) || pHeader->enumTypeSize != sizeof(RsslEnumTypeImpl))
+		return (_setError(errorText, "Dictionary snapshot '%s' was written for a different platform.", filename), RSSL_RET_FAILURE);
+
+	if (pHeader->imageLength != fileLength
+			|| pHeader->dictionaryOffset % 8 != 0 || pHeader->relocationOffset % 8 != 0
+			|| pHeader->dictionaryOffset < sizeof(RsslDictionarySnapshotHeader)
+			|| pHeader->dictionaryOffset + sizeof(RsslDataDictionary) > pHeader->relocationOffset
+			|| pHeader->relocationOffset > pHeader->imageLength
+			|| pHeader->relocationCount > (pHeader->imageLength - pHeader->relocationOffset) / sizeof(RsslUInt64)
+			|| pHeader->baseAddress % SNAPSHOT_BASE_ALIGNMENT != 0
+			|| (RsslUInt64)(size_t)pHeader->imageLength != pHeader->imageLength)
+		return (_setError(errorText, "Dictionary snapshot '%s' is damaged.", filename), RSSL_RET_FAILURE);
+
+	return RSSL_RET_SUCCESS;
+}
+
+/* Returns RSSL_TRUE if the length bytes at pointer are within the objects of the image(before the relocation list). */
+static RsslBool _snapshotContains(const char *pImage, RsslDictionarySnapshotHeader *pHeader, const void *pointer, RsslUInt64 length)
+{
+	/* A pointer below the image wraps around to a large offset. */
+	RsslUInt64 offset = (RsslUInt64)((uintptr_t)pointer - (uintptr_t)pImage);
+
+	return (offset <= pHeader->relocationOffset && length <= pHeader->relocationOffset - offset) ? RSSL_TRUE : RSSL_FALSE;
+}
+
+/* Returns RSSL_TRUE if an array or structure in the image is aligned as the image builder aligns it, and fits in the image. */
+static RsslBool _snapshotContainsObject(const char *pImage, RsslDictionarySnapshotHeader *pHeader, const void *pointer, RsslUInt64 length)
+{
+	return ((uintptr_t)pointer % sizeof(void*) == 0 && _snapshotContains(pImage, pHeader, pointer, length)) ? RSSL_TRUE : RSSL_FALSE;
+}
+
+/* Returns RSSL_TRUE if a string in the image fits in it, including its null terminator. */
+static RsslBool _snapshotBufferValid(const char *pImage, RsslDictionarySnapshotHeader *pHeader, const RsslBuffer *pBuffer)
+{
+	if (pBuffer->data == NULL)
+		return (pBuffer->length == 0) ? RSSL_TRUE : RSSL_FALSE;
+
+	return (_snapshotContains(pImage, pHeader, pBuffer->data, (RsslUInt64)pBuffer->length + 1) && pBuffer->data[pBuffer->length] == '\0') ? RSSL_TRUE : RSSL_FALSE;
+}
+
+/* Checks that everything the dictionary in a relocated image refers to, and everything a user of the dictionary
+ * can reach through it, lies within the image.  The relocation list only shows that each pointer starts in the image. */
+static RsslBool _snapshotExtentsValid(char *pImage, RsslDictionarySnapshotHeader *pHeader)
+{
+	RsslDataDictionary *pDictionary = (RsslDataDictionary*)(pImage + pHeader->dictionaryOffset);
+	RsslDictionaryEntry **entries;
+	RsslUInt32 i;
+	RsslInt32 fid;
+
+	if (pDictionary->minFid <= pDictionary->maxFid && (pDictionary->minFid < RSSL_MIN_FID || pDictionary->maxFid > RSSL_MAX_FID))
+		return RSSL_FALSE;
+
+	if (!_snapshotBufferValid(pImage, pHeader, &pDictionary->infoField_Version)
+			|| !_snapshotBufferValid(pImage, pHeader, &pDictionary->infoEnum_RT_Version)
+			|| !_snapshotBufferValid(pImage, pHeader, &pDictionary->infoEnum_DT_Version)
+			|| !_snapshotBufferValid(pImage, pHeader, &pDictionary->infoField_Filename)
+			|| !_snapshotBufferValid(pImage, pHeader, &pDictionary->infoField_Desc)
+			|| !_snapshotBufferValid(pImage, pHeader, &pDictionary->infoField_Build)
+			|| !_snapshotBufferValid(pImage, pHeader, &pDictionary->infoField_Date)
+			|| !_snapshotBufferValid(pImage, pHeader, &pDictionary->infoEnum_Filename)
+			|| !_snapshotBufferValid(pImage, pHeader, &pDictionary->infoEnum_Desc)
+			|| !_snapshotBufferValid(pImage, pHeader, &pDictionary->infoEnum_Date))
+		return RSSL_FALSE;
+
+	/* The image builder adds the tables in order, so each is after the one before it; entries are checked against them below. */
+	if (pDictionary->enumTableCount
+			&& !_snapshotContainsObject(pImage, pHeader, pDictionary->enumTables, (RsslUInt64)pDictionary->enumTableCount * sizeof(RsslEnumTypeTable*)))
+		return RSSL_FALSE;
+
+	for (i = 0; i < pDictionary->enumTableCount; ++i)
+	{
+		RsslEnumTypeTable *pTable = pDictionary->enumTables[i];
+		RsslUInt32 value;
+
+		if ((i > 0 && pTable <= pDictionary->enumTables[i - 1])
+				|| !_snapshotContainsObject(pImage, pHeader, pTable, sizeof(RsslEnumTypeTable))
+				|| !_snapshotContainsObject(pImage, pHeader, pTable->enumTypes, ((RsslUInt64)pTable->maxValue + 1) * sizeof(RsslEnumType*))
+				|| (pTable->fidReferenceCount
+					&& !_snapshotContainsObject(pImage, pHeader, pTable->fidReferences, (RsslUInt64)pTable->fidReferenceCount * sizeof(RsslFieldId))))
+			return RSSL_FALSE;
+
+		for (value = 0; value <= pTable->maxValue; ++value)
+		{
+			RsslEnumType *pEnumType = pTable->enumTypes[value];
+
+			if (pEnumType != NULL
+					&& (!_snapshotContainsObject(pImage, pHeader, pEnumType, sizeof(RsslEnumTypeImpl))
+						|| !_snapshotBufferValid(pImage, pHeader, &pEnumType->display)
+						|| !_snapshotBufferValid(pImage, pHeader, &pEnumType->meaning)))
+				return RSSL_FALSE;
+		}
+	}
+
+	/* entriesArray points to the entry for fid 0; the array covers every fid. */
+	entries = (RsslDictionaryEntry**)((uintptr_t)pDictionary->entriesArray + (uintptr_t)(RSSL_MIN_FID * (intptr_t)sizeof(RsslDictionaryEntry*)));
+	if (!_snapshotContainsObject(pImage, pHeader, entries, (RsslUInt64)(RSSL_MAX_FID - RSSL_MIN_FID + 1) * sizeof(RsslDictionaryEntry*)))
+		return RSSL_FALSE;
+
+	for (fid = RSSL_MIN_FID; fid <= RSSL_MAX_FID; ++fid)
+	{
+		RsslDictionaryEntry *pEntry = entries[fid - RSSL_MIN_FID];
+
+		if (pEntry == NULL)
+			continue;
+
+		if (!_snapshotContainsObject(pImage, pHeader, pEntry, sizeof(RsslDictionaryEntry))
+				|| !_snapshotBufferValid(pImage, pHeader, &pEntry->acronym)
+				|| !_snapshotBufferValid(pImage, pHeader, &pEntry->ddeAcronym))
+			return RSSL_FALSE;
+
+		if (pEntry->pEnumTypeTable != NULL)
+		{
+			RsslUInt32 low = 0, high = pDictionary->enumTableCount;
+
+			while (low < high)
+			{
+				RsslUInt32 middle = low + (high - low) / 2;
+
+				if (pDictionary->enumTables[middle] < pEntry->pEnumTypeTable)
+					low = middle + 1;
+				else
+					high = middle;
+			}
+
+			if (low == pDictionary->enumTableCount || pDictionary->enumTables[low] != pEntry->pEnumTypeTable)
+				return RSSL_FALSE;
+		}
+	}
+
+	return RSSL_TRUE;
+}
+
+/* Checks that every pointer in the image refers to the image and, if it is mapped somewhere other than its base
+ * address, moves the pointers there.  Then checks that every object the dictionary refers to fits in the image. */
+static RsslRet _relocateSnapshot(char *pImage, RsslDictionarySnapshotHeader *pHeader, const char *filename, RsslBuffer *errorText)
+{
+	RsslUInt64 *relocations = (RsslUInt64*)(pImage + pHeader->relocationOffset);
+	RsslUInt64 imageAddress = (RsslUInt64)(uintptr_t)pImage;
+	RsslUInt64 i;
+
+	for (i = 0; i < pHeader->relocationCount; ++i)
+	{
+		RsslUInt64 slotOffset = relocations[i];
+		RsslUInt64 target;
+		char *pointer;
+
+		if (slotOffset % sizeof(void*) != 0 || slotOffset + sizeof(void*) > pHeader->relocationOffset)
+			return (_setError(errorText, "Dictionary snapshot '%s' is damaged.", filename), RSSL_RET_FAILURE);
+
+		memcpy(&pointer, pImage + slotOffset, sizeof(pointer));
+		target = (RsslUInt64)(uintptr_t)pointer;
+
+		if (target < pHeader->baseAddress || target - pHeader->baseAddress >= pHeader->relocationOffset)
+			return (_setError(errorText, "Dictionary snapshot '%s' is damaged.", filename), RSSL_RET_FAILURE);
+
+		if (imageAddress != pHeader->baseAddress)
+		{
+			pointer = pImage + (size_t)(target - pHeader->baseAddress);
+			memcpy(pImage + slotOffset, &pointer, sizeof(pointer));
+		}
+	}
+
+	if (!_snapshotExtentsValid(pImage, pHeader))
+		return (_setError(errorText, "Dictionary snapshot '%s' is damaged.", filename), RSSL_RET_FAILURE);
+
+	return RSSL_RET_SUCCESS;
+}
+
+#ifdef WIN32
+
+static char *_mapSnapshot(const char *filename, RsslDictionarySnapshotHeader *pHeader, RsslBuffer *errorText)
+{
+	HANDLE file, mapping;
+	LARGE_INTEGER fileLength;
+	DWORD bytesRead, oldProtect;
+	char *pImage;
+
+	if ((file = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL)) == INVALID_HANDLE_VALUE)
+	{
+		_setError(errorText, "Can't open file: '%s'.", filename);
+		return NULL;
+	}
+
+	if (!GetFileSizeEx(file, &fileLength) || !ReadFile(file, pHeader, sizeof(*pHeader), &bytesRead, NULL) || bytesRead != sizeof(*pHeader))
+	{
+		CloseHandle(file);
+		_setError(errorText, "'%s' is not a dictionary snapshot.", filename);
+		return NULL;
+	}
+
+	if (_checkSnapshotHeader(pHeader, (RsslUInt64)fileLength.QuadPart, filename, errorText) != RSSL_RET_SUCCESS)
+	{
+		CloseHandle(file);
+		return NULL;
+	}
+
+	mapping = CreateFileMappingA(file, NULL, PAGE_WRITECOPY, 0, 0, NULL);
+	CloseHandle(file);
+	if (mapping == NULL)
+	{
+		_setError(errorText, "Failed to map file: '%s'.", filename);
+		return NULL;
+	}
+
+	/* Use the image in place if it can go at its base address. */
+	pImage = NULL;
+	if (pHeader->baseAddress != 0)
+	{
+		pImage = (char*)MapViewOfFileEx(mapping, FILE_MAP_READ, 0, 0, (SIZE_T)pHeader->imageLength, (LPVOID)(uintptr_t)pHeader->baseAddress);
+
+		if (pImage != NULL && _relocateSnapshot(pImage, pHeader, filename, errorText) != RSSL_RET_SUCCESS)
+		{
+			UnmapViewOfFile(pImage);
+			CloseHandle(mapping);
+			return NULL;
+		}
+	}
+
+	/* Otherwise, map a private copy and move its pointers. */
+	if (pImage == NULL)
+	{
+		if ((pImage = (char*)MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, (SIZE_T)pHeader->imageLength)) == NULL)
+		{
+			CloseHandle(mapping);
+			_setError(errorText, "Failed to map file: '%s'.", filename);
+			return NULL;
+		}
+
+		if (_relocateSnapshot(pImage, pHeader, filename, errorText) != RSSL_RET_SUCCESS)
+		{
+			UnmapViewOfFile(pImage);
+			CloseHandle(mapping);
+			return NULL;
+		}
+
+		VirtualProtect(pImage, (SIZE_T)pHeader->imageLength, PAGE_READONLY, &oldProtect);
+	}
+
+	/* The view keeps the mapping open. */
+	CloseHandle(mapping);
+	return pImage;
+}
+
+static void _unmapSnapshot(char *pSnapshot, RsslUInt64 length)
+{
+	UnmapViewOfFile(pSnapshot);
+}
+
+#else
+
+static char *_mapSnapshot(const char *filename, RsslDictionarySnapshotHeader *pHeader, RsslBuffer *errorText)
+{
+	int fd;
+	struct stat fileStat;
+	char *pImage = (char*)MAP_FAILED;
+
+	if ((fd = open(filename, O_RDONLY)) < 0)
+	{
+		_setError(errorText, "Can't open file: '%s'.", filename);
+		return NULL;
+	}
+
+	if (fstat(fd, &fileStat) != 0 || pread(fd, pHeader, sizeof(*pHeader), 0) != (ssize_t)sizeof(*pHeader))
+	{
+		close(fd);
+		_setError(errorText, "'%s' is not a dictionary snapshot.", filename);
+		return NULL;
+	}
+
+	if (_checkSnapshotHeader(pHeader, (RsslUInt64)fileStat.st_size, filename, errorText) != RSSL_RET_SUCCESS)
+	{
+		close(fd);
+		return NULL;
+	}
+
+	/* Use the image in place if it can go at its base address. The address is only a hint, so check where it went. */
+	if (pHeader->baseAddress != 0)
+	{
+		pImage = (char*)mmap((void*)(uintptr_t)pHeader->baseAddress, (size_t)pHeader->imageLength, PROT_READ, MAP_SHARED, fd, 0);
+
+		if (pImage != (char*)MAP_FAILED && (RsslUInt64)(uintptr_t)pImage != pHeader->baseAddress)
+		{
+			munmap(pImage, (size_t)pHeader->imageLength);
+			pImage = (char*)MAP_FAILED;
+		}
+
+		if (pImage != (char*)MAP_FAILED && _relocateSnapshot(pImage, pHeader, filename, errorText) != RSSL_RET_SUCCESS)
+		{
+			munmap(pImage, (size_t)pHeader->imageLength);
+			close(fd);
+			return NULL;
+		}
+	}
+
+	/* Otherwise, map a private copy and move its pointers. */
+	if (pImage == (char*)MAP_FAILED)
+	{
+		if ((pImage = (char*)mmap(NULL, (size_t)pHeader->imageLength, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0)) == (char*)MAP_FAILED)
+		{
+			close(fd);
+			_setError(errorText, "Failed to map file: '%s'.", filename);
+			return NULL;
+		}
+
+		if (_relocateSnapshot(pImage, pHeader, filename, errorText) != RSSL_RET_SUCCESS)
+		{
+			munmap(pImage, (size_t)pHeader->imageLength);
+			close(fd);
+			return NULL;
+		}
+
+		mprotect(pImage, (size_t)pHeader->imageLength, PROT_READ);
+	}
+
+	close(fd);
+	return pImage;
+}
+
+static void _unmapSnapshot(char *pSnapshot, RsslUInt64 length)
+{
+	munmap(pSnapshot, (size_t)length);
+}
+
+#endif
+
+RSSL_API RsslRet rsslLoadDataDictionarySnapshot(	const char				*filename,
+							RsslDataDictionary	*dictionary,
+							RsslBuffer			*errorText )
+{
+	RsslDictionarySnapshotHeader header;
+	RsslDictionaryInternal *pDictionaryInternal;
+	RsslErrorInfo rsslErrorInfo;
+	char *pImage;
+	RsslInt32 fid;
+
+	if (filename == 0)
+	{
+		_setError(errorText, "NULL Filename pointer.");
+		return RSSL_RET_FAILURE;
+	}
+
+	if (dictionary == 0)
+	{
+		_setError(errorText, "NULL Dictionary pointer.");
+		return RSSL_RET_FAILURE;
+	}
+
+	if (dictionary->isInitialized)
+	{
+		_setError(errorText, "A snapshot cannot be loaded into a dictionary that already has definitions.");
+		return RSSL_RET_FAILURE;
+	}
+
+	if ((pImage = _mapSnapshot(filename, &header, errorText)) == NULL)
+		return RSSL_RET_FAILURE;
+
+	if ((pDictionaryInternal = (RsslDictionaryInternal*)calloc(sizeof(RsslDictionaryInternal), 1)) == NULL)
+	{
+		_unmapSnapshot(pImage, header.imageLength);
+		_setError(errorText, "malloc() of internal dictionary failed.");
+		return RSSL_RET_FAILURE;
+	}
+
+	if (rsslHashTableInit(&pDictionaryInternal->fieldsByName, DICTIONARY_MAX_ENTRIES, rsslHashBufferSum, rsslHashBufferCompare,
+				RSSL_TRUE, &rsslErrorInfo) != RSSL_RET_SUCCESS)
+	{
+		free(pDictionaryInternal);
+		_unmapSnapshot(pImage, header.imageLength);
+		_setError(errorText, "Failed to initailize fields-by-name table.");
+		return RSSL_RET_FAILURE;
+	}
+
+	pDictionaryInternal->pSnapshot = pImage;
+	pDictionaryInternal->snapshotLength = header.imageLength;
+
+	memcpy(dictionary, pImage + header.dictionaryOffset, sizeof(RsslDataDictionary));
+	dictionary->_internal = pDictionaryInternal;
+	dictionary->isInitialized = RSSL_TRUE;
+
+	/* The fields-by-name table is the only part that is built on load. */
+	for (fid = dictionary->minFid; fid <= dictionary->maxFid; ++fid)
+	{
+		RsslDictionaryEntry *pEntry = dictionary->entriesArray[fid];
+
+		if (pEntry == NULL || pEntry->rwfType == RSSL_DT_UNKNOWN)
+			continue;
+
+		pDictionaryInternal->fieldsByNameLinks[fid - (RSSL_MIN_FID)].pDictionaryEntry = pEntry;
+		rsslHashTableInsertLink(&pDictionaryInternal->fieldsByName, &pDictionaryInternal->fieldsByNameLinks[fid - (RSSL_MIN_FID)].nameTableLink,
+				&pEntry->acronym, NULL);
+	}
+
+	return RSSL_RET_SUCCESS;
+}
+
+RSSL_API RsslBool rsslIsDataDictionarySnapshot(const char *filename)
+{
+	char magic[sizeof(SNAPSHOT_MAGIC) - 1];
+	FILE *fp;
+	RsslBool isSnapshot;
+
+	if (filename == 0 || (fp = fopen(filename, "rb")) == NULL)
+		return RSSL_FALSE;
+
+	isSnapshot = (fread(magic, 1, sizeof(magic), fp) == sizeof(magic) && memcmp(magic, SNAPSHOT_MAGIC, sizeof(magic)) == 0) ? RSSL_TRUE : RSSL_FALSE;
+	fclose(fp);
+	return isSnapshot;
+}
+
 #ifdef __cplusplus
 }
 #endif
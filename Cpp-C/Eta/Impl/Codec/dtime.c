@@ -19,6 +19,111 @@ static const char * months[12] = {"JAN", "FEB", "MAR", "APR", "MAY", "JUN", "JUL
 
 #define MAX_DECIMAL_DIGITS 9
 
+/* Fixed-format ISO 8601 conversion.
+ * Most dates and times converted to and from strings (e.g. by the JSON converter) are in the
+ * common ISO 8601 shapes, 'YYYY-MM-DD' and 'HH:MM:SS' with an optional fraction of up to nine
+ * digits. These are written and read with the routines below, at fixed positions and without
+ * snprintf or scanning; anything else is left to the general routines. */
+
+/* Two-digit strings of 0 to 99. */
+static const char dtimeDigitPairs[201] =
+	"0001020304050607080910111213141516171819"
+	"2021222324252627282930313233343536373839"
+	"4041424344454647484950515253545556575859"
+	"6061626364656667686970717273747576777879"
+	"8081828384858687888990919293949596979899";
+
+/* Value of a digit character, or a value greater than 9 if it is not a digit. */
+#define DTIME_DIGIT(c) ((unsigned int)((unsigned char)(c) - '0'))
+
+/* Writes a value of 0 to 99 as two digits. */
+static char *dtimePut2Digits(char *pOut, unsigned int value)
+{
+	pOut[0] = dtimeDigitPairs[value * 2];
+	pOut[1] = dtimeDigitPairs[value * 2 + 1];
+	return pOut + 2;
+}
+
+/* Writes a value of 0 to 999 as three digits. */
+static char *dtimePut3Digits(char *pOut, unsigned int value)
+{
+	pOut[0] = (char)('0' + value / 100);
+	return dtimePut2Digits(pOut + 1, value % 100);
+}
+
+/* Parses 'YYYY-MM-DD'. Returns RSSL_FALSE if the string is not exactly in this shape. */
+static RsslBool dateStringToDateFixed(RsslDate *oDate, const char *pString, RsslUInt32 length)
+{
+	unsigned int y0, y1, y2, y3, m0, m1, d0, d1;
+
+	if (length != 10 || pString[4] != '-' || pString[7] != '-')
+		return RSSL_FALSE;
+
+	y0 = DTIME_DIGIT(pString[0]); y1 = DTIME_DIGIT(pString[1]);
+	y2 = DTIME_DIGIT(pString[2]); y3 = DTIME_DIGIT(pString[3]);
+	m0 = DTIME_DIGIT(pString[5]); m1 = DTIME_DIGIT(pString[6]);
+	d0 = DTIME_DIGIT(pString[8]); d1 = DTIME_DIGIT(pString[9]);
+
+	if ((y0 > 9) | (y1 > 9) | (y2 > 9) | (y3 > 9) | (m0 > 9) | (m1 > 9) | (d0 > 9) | (d1 > 9))
+		return RSSL_FALSE;
+
+	oDate->year = (RsslUInt16)(y0 * 1000 + y1 * 100 + y2 * 10 + y3);
+	oDate->month = (RsslUInt8)(m0 * 10 + m1);
+	oDate->day = (RsslUInt8)(d0 * 10 + d1);
+	return RSSL_TRUE;
+}
+
+/* Parses 'HH:MM:SS', optionally followed by a fraction of one to nine digits after '.' or ',',
+ * and optionally by 'Z'. Returns RSSL_FALSE if the string is not exactly in this shape. */
+static RsslBool timeStringToTimeFixed(RsslTime *oTime, const char *pString, RsslUInt32 length)
+{
+	unsigned int h0, h1, m0, m1, s0, s1;
+	unsigned int fraction[MAX_DECIMAL_DIGITS];
+	RsslUInt32 pos, digits, i;
+
+	if (length < 8 || pString[2] != ':' || pString[5] != ':')
+		return RSSL_FALSE;
+
+	h0 = DTIME_DIGIT(pString[0]); h1 = DTIME_DIGIT(pString[1]);
+	m0 = DTIME_DIGIT(pString[3]); m1 = DTIME_DIGIT(pString[4]);
+	s0 = DTIME_DIGIT(pString[6]); s1 = DTIME_DIGIT(pString[7]);
+
+	if ((h0 > 9) | (h1 > 9) | (m0 > 9) | (m1 > 9) | (s0 > 9) | (s1 > 9))
+		return RSSL_FALSE;
+
+	pos = 8;
+	digits = 0;
+	if (pos < length && (pString[pos] == '.' || pString[pos] == ','))
+	{
+		++pos;
+		while (pos < length && digits < MAX_DECIMAL_DIGITS && (fraction[digits] = DTIME_DIGIT(pString[pos])) <= 9)
+		{
+			++digits;
+			++pos;
+		}
+
+		if (digits == 0)
+			return RSSL_FALSE;
+	}
+
+	if (pos < length && pString[pos] == 'Z')
+		++pos;
+
+	if (pos != length)
+		return RSSL_FALSE;
+
+	for (i = digits; i < MAX_DECIMAL_DIGITS; ++i)
+		fraction[i] = 0;
+
+	oTime->hour = (RsslUInt8)(h0 * 10 + h1);
+	oTime->minute = (RsslUInt8)(m0 * 10 + m1);
+	oTime->second = (RsslUInt8)(s0 * 10 + s1);
+	oTime->millisecond = (RsslUInt16)(fraction[0] * 100 + fraction[1] * 10 + fraction[2]);
+	oTime->microsecond = (RsslUInt16)(fraction[3] * 100 + fraction[4] * 10 + fraction[5]);
+	oTime->nanosecond = (RsslUInt16)(fraction[6] * 100 + fraction[7] * 10 + fraction[8]);
+	return RSSL_TRUE;
+}
+
 /* Converts RsslDateTime to blank string only if the all portions of RsslDateTime are blank. 
  * Returns RSSL_FALSE if any one portion is not blank.
  */
@@ -83,50 +188,96 @@ RsslRet dateToStringIso8601(RsslBuffer * oBuffer, int *bufOffset, int *remaining
 	/* Iso8601 date */
 	RsslRet ret = 0;
 	int i;
-	if (iDate->year)
-	{
-		ret = snprintf(oBuffer->data, *remainingLength, "%04d-", iDate->year);
-		if (ret < 0 || ret >= *remainingLength)
-			return RSSL_RET_FAILURE;	
-	}
-	else
-	{
-		ret = snprintf(oBuffer->data, *remainingLength, "--");
-		if (ret < 0 || ret >= *remainingLength)
-			return RSSL_RET_FAILURE;
-	}
-	*bufOffset += ret;
-	*remainingLength -= ret;
+	char *pOut;
 
-	if (iDate->month)
-	{
-		ret = snprintf((oBuffer->data + *bufOffset), *remainingLength, "%02d-", iDate->month);
-		if (ret < 0 || ret >= *remainingLength)
-			return RSSL_RET_FAILURE;	
-	}
-	else
+	if (iDate->year <= 9999 && iDate->month <= 99 && iDate->day <= 99)
 	{
-		ret = snprintf((oBuffer->data + *bufOffset), *remainingLength, "  -");
-		if (ret < 0 || ret >= *remainingLength)
+		/* Fixed format, written the same as by snprintf below. */
+		ret = iDate->year ? 10 : 7;
+		if (ret >= *remainingLength)
 			return RSSL_RET_FAILURE;
-	}
 
-	*bufOffset += ret;
-	*remainingLength -= ret;
-	if (iDate->day)
-	{
-		ret = snprintf((oBuffer->data + *bufOffset), *remainingLength, "%02d", iDate->day);
-		if (ret < 0 || ret >= *remainingLength)
-			return RSSL_RET_FAILURE;	
+		pOut = oBuffer->data + *bufOffset;
+		if (iDate->year)
+		{
+			pOut = dtimePut2Digits(pOut, iDate->year / 100);
+			pOut = dtimePut2Digits(pOut, iDate->year % 100);
+		}
+		else
+			*pOut++ = '-';
+		*pOut++ = '-';
+
+		if (iDate->month)
+			pOut = dtimePut2Digits(pOut, iDate->month);
+		else
+		{
+			pOut[0] = ' ';
+			pOut[1] = ' ';
+			pOut += 2;
+		}
+		*pOut++ = '-';
+
+		if (iDate->day)
+			pOut = dtimePut2Digits(pOut, iDate->day);
+		else
+		{
+			pOut[0] = ' ';
+			pOut[1] = ' ';
+			pOut += 2;
+		}
+		*pOut = '\0';
+
+		*bufOffset += ret;
+		*remainingLength -= ret;
 	}
 	else
 	{
-		ret = snprintf((oBuffer->data + *bufOffset), *remainingLength, "  ");
-		if (ret < 0 || ret >= *remainingLength)
-			return RSSL_RET_FAILURE;
+		if (iDate->year)
+		{
+			ret = snprintf(oBuffer->data, *remainingLength, "%04d-", iDate->year);
+			if (ret < 0 || ret >= *remainingLength)
+				return RSSL_RET_FAILURE;	
+		}
+		else
+		{
+			ret = snprintf(oBuffer->data, *remainingLength, "--");
+			if (ret < 0 || ret >= *remainingLength)
+				return RSSL_RET_FAILURE;
+		}
+		*bufOffset += ret;
+		*remainingLength -= ret;
+
+		if (iDate->month)
+		{
+			ret = snprintf((oBuffer->data + *bufOffset), *remainingLength, "%02d-", iDate->month);
+			if (ret < 0 || ret >= *remainingLength)
+				return RSSL_RET_FAILURE;	
+		}
+		else
+		{
+			ret = snprintf((oBuffer->data + *bufOffset), *remainingLength, "  -");
+			if (ret < 0 || ret >= *remainingLength)
+				return RSSL_RET_FAILURE;
+		}
+
+		*bufOffset += ret;
+		*remainingLength -= ret;
+		if (iDate->day)
+		{
+			ret = snprintf((oBuffer->data + *bufOffset), *remainingLength, "%02d", iDate->day);
+			if (ret < 0 || ret >= *remainingLength)
+				return RSSL_RET_FAILURE;	
+		}
+		else
+		{
+			ret = snprintf((oBuffer->data + *bufOffset), *remainingLength, "  ");
+			if (ret < 0 || ret >= *remainingLength)
+				return RSSL_RET_FAILURE;
+		}
+		*bufOffset += ret;
+		*remainingLength -= ret;
 	}
-	*bufOffset += ret;
-	*remainingLength -= ret;
+
 	i = *bufOffset -1;
 	for(; i >= 0; --i, (*bufOffset)--, (*remainingLength)++)
 	{ /* Trim trailing non digits */
@@ -201,6 +352,62 @@ RsslRet timeToStringIso8601Time(RsslBuffer * oBuffer, int *bufOffset, int *remai
 	/* hour is always present */
 	RsslRet ret = 0;
 	int i = 0;
+	char timeString[18]; /* HH:MM:SS.mmmuuunnn */
+	char *pOut = timeString;
+	char *pEnd;
+
+	/* Fixed format, written the same as by snprintf below, when each present field fits its width. */
+	if (iTime->hour <= 99
+			&& (iTime->minute == 255 || (iTime->minute <= 99
+				&& (iTime->second == 255 || (iTime->second <= 99
+					&& (iTime->millisecond == 65535 || (iTime->millisecond <= 999
+						&& (iTime->microsecond == 2047 || (iTime->microsecond <= 999
+							&& (iTime->nanosecond == 2047 || iTime->nanosecond <= 999))))))))))
+	{
+		pOut = dtimePut2Digits(pOut, iTime->hour);
+		if (iTime->minute != 255)
+		{
+			*pOut++ = ':';
+			pOut = dtimePut2Digits(pOut, iTime->minute);
+			if (iTime->second != 255)
+			{
+				*pOut++ = ':';
+				pOut = dtimePut2Digits(pOut, iTime->second);
+			}
+		}
+		pEnd = pOut;
+
+		if (iTime->minute != 255 && iTime->second != 255 && iTime->millisecond != 65535)
+		{
+			*pOut++ = '.';
+			pOut = dtimePut3Digits(pOut, iTime->millisecond);
+			if (iTime->microsecond != 2047)
+			{
+				pOut = dtimePut3Digits(pOut, iTime->microsecond);
+				if (iTime->nanosecond != 2047)
+					pOut = dtimePut3Digits(pOut, iTime->nanosecond);
+			}
+
+			/* Trim trailing zeros, and the point if nothing is left of the fraction. */
+			pEnd = pOut;
+			while (pEnd[-1] == '0')
+				--pEnd;
+			if (pEnd[-1] == '.')
+				--pEnd;
+		}
+
+		/* The untrimmed string must fit, as with snprintf. */
+		ret = (int)(pOut - timeString);
+		if (ret >= *remainingLength)
+			return RSSL_RET_FAILURE;
+
+		ret = (int)(pEnd - timeString);
+		memcpy(oBuffer->data + *bufOffset, timeString, ret);
+		oBuffer->data[*bufOffset + ret] = '\0';
+		*bufOffset += ret;
+		*remainingLength -= ret;
+		return RSSL_RET_SUCCESS;
+	}
 
 	if (iTime->minute != 255)
 	{
@@ -519,6 +726,10 @@ RSSL_API RsslRet rsslDateStringToDate(RsslDate * oDate, const RsslBuffer * iDate
 		return RSSL_RET_BLANK_DATA;
 	}
 
+	/* Check for the common yyyy-mm-dd case first */
+	if (dateStringToDateFixed(oDate, iDateString->data, iDateString->length))
+		return RSSL_RET_SUCCESS;
+
 	tmp = iDateString->data;
 	end = iDateString->data + iDateString->length;
 
@@ -875,6 +1086,10 @@ RSSL_API RsslRet rsslTimeStringToTime(RsslTime * oTime, const RsslBuffer * iTime
 		return RSSL_RET_BLANK_DATA;
 	}
 
+	/* Check for the common hh:mm:ss[.nnnnnnnnn] case first */
+	if (timeStringToTimeFixed(oTime, iTimeString->data, iTimeString->length))
+		return RSSL_RET_SUCCESS;
+
 	tmp = iTimeString->data;
 	end = iTimeString->data + iTimeString->length;
 
@@ -1319,6 +1534,12 @@ RSSL_API RsslRet rsslDateTimeStringToDateTime(RsslDateTime *oDateTime, const Rss
 		return RSSL_RET_BLANK_DATA;
 	}
 
+	/* Check for the common yyyy-mm-ddThh:mm:ss[.nnnnnnnnn] case first */
+	if (iDateTimeString->length > 11 && iDateTimeString->data[10] == 'T'
+			&& dateStringToDateFixed(&oDateTime->date, iDateTimeString->data, 10)
+			&& timeStringToTimeFixed(&oDateTime->time, iDateTimeString->data + 11, iDateTimeString->length - 11))
+		return RSSL_RET_SUCCESS;
+
 	rsslClearDateTime(oDateTime);
 
 	tmp = iDateTimeString->data;
@@ -1771,9 +1992,10 @@ RSSL_API RsslRet rsslDateTimeToStringFormat(RsslBuffer * oBuffer, RsslUInt8 data
 					return RSSL_RET_SUCCESS;
 
 				/* Put in Time delimiter 'T' for ISO8601 first */
-				ret = snprintf((oBuffer->data + bufOffset), remainingLength, "T");
-				if (ret < 0 || ret >= remainingLength)
+				if (remainingLength <= 1)
 					return RSSL_RET_FAILURE;
+				oBuffer->data[bufOffset] = 'T';
+				ret = 1;
 
 				bufOffset += ret;
 				remainingLength -= ret;
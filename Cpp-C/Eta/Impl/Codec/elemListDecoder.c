@@ -128,7 +128,9 @@ RSSL_API RsslRet rsslDecodeElementList(
 		else
 		{
 			_levelInfo->_setCount = 0;
-			_levelInfo->_nextEntryPtr = /* oIter->_curBufPtr = */ position + oElementList->encSetData.length;
+			/* Skip the set data. When there are standard entries, position is already past it. */
+			_levelInfo->_nextEntryPtr = /* oIter->_curBufPtr = */
+				rsslElementListCheckHasStandardData(oElementList) ? position : position + oElementList->encSetData.length;
 			return RSSL_RET_SET_SKIPPED;
 		}
 	}
@@ -0,0 +1,634 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2022 Refinitiv. All rights reserved.              --
+ *|-----------------------------------------------------------------------------
+ */
+
+#include "rtr/rsslEncodePlan.h"
+#include "rtr/rsslMessagePackage.h"
+#include "rtr/rsslDataPackage.h"
+#include "rtr/encoderTools.h"
+#include "rtr/intDataTypes.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define _RSSL_MSG_STREAMID_POS		4
+
+/* Writes a value, with its length, at pos.  Returns the position after the value, or NULL if the value cannot be encoded. */
+typedef char* (*RsslEncodePlanPutValue)(char *pos, const void *pValue);
+
+struct _RsslEncodePlanSlot
+{
+	RsslFieldId				fieldId;
+	RsslUInt8				dataType;
+	RsslUInt8				flags;
+	RsslUInt8				maxLength;	/* Maximum length of the value, including its length.  Fixed-width values always have this length. */
+	RsslUInt32				offset;		/* Offset of the field entry in every message, if it is fixed.  Otherwise 0. */
+	RsslEncodePlanPutValue	putValue;
+};
+
+/* Value encoders, matching the length-specified encoders of primitiveEncoders.c. */
+
+static char *_rsslPlanPutInt(char *pos, const void *pValue)
+{
+	RsslInt64 value = *(const RsslInt64*)pValue;
+	return pos + rwfPutLenSpecI64(pos, value);
+}
+
+static char *_rsslPlanPutUInt(char *pos, const void *pValue)
+{
+	RsslUInt64 value = *(const RsslUInt64*)pValue;
+	return pos + rwfPutLenSpecU64(pos, value);
+}
+
+static char *_rsslPlanPutReal(char *pos, const void *pValue)
+{
+	const RsslReal *pReal = (const RsslReal*)pValue;
+	RsslInt64 value;
+	RsslUInt8 hint;
+
+	if (pReal->isBlank)
+		return pos + rwfPutLenSpecBlank(pos);
+
+	/* 31 is currently reserved */
+	if ((pReal->hint > RSSL_RH_NOT_A_NUMBER) || (pReal->hint == 31) || (pReal->hint == 32))
+		return NULL;
+
+	switch (pReal->hint)
+	{
+		case RSSL_RH_INFINITY:
+		case RSSL_RH_NEG_INFINITY:
+		case RSSL_RH_NOT_A_NUMBER:
+			pos += rwfPut8(pos, 1);
+			pos += rwfPut8(pos, pReal->hint);
+			return pos;
+		default:
+			value = pReal->value;
+			hint = pReal->hint;
+			return pos + rwfPutLenSpecReal64(pos, value, hint);
+	}
+}
+
+static char *_rsslPlanPutFloat(char *pos, const void *pValue)
+{
+	pos += rwfPut8(pos, __RSZFLT);
+	pos += rwfPutFloat(pos, (*(const RsslFloat*)pValue));
+	return pos;
+}
+
+static char *_rsslPlanPutDouble(char *pos, const void *pValue)
+{
+	pos += rwfPut8(pos, __RSZDBL);
+	pos += rwfPutDouble(pos, (*(const RsslDouble*)pValue));
+	return pos;
+}
+
+static char *_rsslPlanPutEnum(char *pos, const void *pValue)
+{
+	RsslEnum value = *(const RsslEnum*)pValue;
+	return pos + rwfPutLenSpecU16(pos, value);
+}
+
+static char *_rsslPlanPutDate(char *pos, const void *pValue)
+{
+	const RsslDate *pDate = (const RsslDate*)pValue;
+
+	pos += rwfPut8(pos, __RSZDT);
+	pos += rwfPut8(pos, pDate->day);
+	pos += rwfPut8(pos, pDate->month);
+	pos += rwfPut16(pos, pDate->year);
+	return pos;
+}
+
+/* Writes the time without a length.  A timeLen of 8 is the full-width form. */
+RTR_C_ALWAYS_INLINE char *_rsslPlanPutTimeContent(char *pos, const RsslTime *pTime, RsslUInt8 timeLen)
+{
+	pos += rwfPut8(pos, pTime->hour);
+	pos += rwfPut8(pos, pTime->minute);
+
+	if (timeLen >= 3)
+		pos += rwfPut8(pos, pTime->second);
+	if (timeLen >= 5)
+		pos += rwfPut16(pos, pTime->millisecond);
+	if (timeLen == 7)
+		pos += rwfPut16(pos, pTime->microsecond);
+	else if (timeLen == 8)
+	{
+		RsslUInt16 tempMicro = (((pTime->nanosecond & 0xFF00) << 3) | pTime->microsecond);
+
+		pos += rwfPut16(pos, tempMicro);
+		pos += rwfPut8(pos, (RsslUInt8)pTime->nanosecond);
+	}
+
+	return pos;
+}
+
+RTR_C_ALWAYS_INLINE RsslUInt8 _rsslPlanTimeLength(const RsslTime *pTime)
+{
+	if (pTime->nanosecond != 0)
+		return 8;
+	else if (pTime->microsecond != 0)
+		return 7;
+	else if (pTime->millisecond != 0)
+		return 5;
+	else if (pTime->second != 0)
+		return 3;
+	else
+		return 2;
+}
+
+static char *_rsslPlanPutTime(char *pos, const void *pValue)
+{
+	const RsslTime *pTime = (const RsslTime*)pValue;
+	RsslUInt8 timeLen = _rsslPlanTimeLength(pTime);
+
+	pos += rwfPut8(pos, timeLen);
+	return _rsslPlanPutTimeContent(pos, pTime, timeLen);
+}
+
+static char *_rsslPlanPutDateTime(char *pos, const void *pValue)
+{
+	const RsslDateTime *pDateTime = (const RsslDateTime*)pValue;
+	RsslUInt8 timeLen = _rsslPlanTimeLength(&pDateTime->time);
+
+	pos += rwfPut8(pos, __RSZDT + timeLen);
+	pos += rwfPut8(pos, pDateTime->date.day);
+	pos += rwfPut8(pos, pDateTime->date.month);
+	pos += rwfPut16(pos, pDateTime->date.year);
+	return _rsslPlanPutTimeContent(pos, &pDateTime->time, timeLen);
+}
+
+static char *_rsslPlanPutBuffer(char *pos, const void *pValue)
+{
+	const RsslBuffer *pBuffer = (const RsslBuffer*)pValue;
+
+	if (pBuffer->length > RWF_MAX_16)
+		return NULL;
+
+	return _rsslEncodeBuffer16(pos, pBuffer);
+}
+
+/* Full-width value encoders, for RSSL_EPFF_FIXED_WIDTH fields. */
+
+static char *_rsslPlanPutFixedInt(char *pos, const void *pValue)
+{
+	pos += rwfPut8(pos, 8);
+	pos += rwfPut64(pos, (*(const RsslInt64*)pValue));
+	return pos;
+}
+
+static char *_rsslPlanPutFixedUInt(char *pos, const void *pValue)
+{
+	pos += rwfPut8(pos, 8);
+	pos += rwfPut64(pos, (*(const RsslUInt64*)pValue));
+	return pos;
+}
+
+static char *_rsslPlanPutFixedReal(char *pos, const void *pValue)
+{
+	const RsslReal *pReal = (const RsslReal*)pValue;
+	RsslInt64 value = pReal->value;
+	RsslUInt8 format = pReal->hint;
+
+	if (pReal->isBlank)
+	{
+		format = 0x20;
+		value = 0;
+	}
+	else if ((pReal->hint > RSSL_RH_NOT_A_NUMBER) || (pReal->hint == 31) || (pReal->hint == 32))
+		return NULL;
+	else if (pReal->hint >= RSSL_RH_INFINITY)
+		value = 0;
+
+	pos += rwfPut8(pos, __RSZRL64);
+	pos += rwfPut8(pos, format);
+	pos += rwfPut64(pos, value);
+	return pos;
+}
+
+static char *_rsslPlanPutFixedEnum(char *pos, const void *pValue)
+{
+	pos += rwfPut8(pos, 2);
+	pos += rwfPut16(pos, (*(const RsslEnum*)pValue));
+	return pos;
+}
+
+static char *_rsslPlanPutFixedTime(char *pos, const void *pValue)
+{
+	pos += rwfPut8(pos, 8);
+	return _rsslPlanPutTimeContent(pos, (const RsslTime*)pValue, 8);
+}
+
+static char *_rsslPlanPutFixedDateTime(char *pos, const void *pValue)
+{
+	const RsslDateTime *pDateTime = (const RsslDateTime*)pValue;
+
+	pos += rwfPut8(pos, __RSZDT + 8);
+	pos += rwfPut8(pos, pDateTime->date.day);
+	pos += rwfPut8(pos, pDateTime->date.month);
+	pos += rwfPut16(pos, pDateTime->date.year);
+	return _rsslPlanPutTimeContent(pos, &pDateTime->time, 8);
+}
+
+/* Chooses the encoder of a field, and its maximum encoded length including the length byte.  Returns RSSL_FALSE if the field is not supported. */
+static RsslBool _rsslPlanSetEncoder(RsslEncodePlanSlot *pSlot, RsslUInt8 *pMaxLength)
+{
+	RsslBool fixed = (pSlot->flags & RSSL_EPFF_FIXED_WIDTH) ? RSSL_TRUE : RSSL_FALSE;
+
+	switch (pSlot->dataType)
+	{
+		case RSSL_DT_INT:
+			pSlot->putValue = fixed ? _rsslPlanPutFixedInt : _rsslPlanPutInt;
+			*pMaxLength = 9;
+			return RSSL_TRUE;
+		case RSSL_DT_UINT:
+			pSlot->putValue = fixed ? _rsslPlanPutFixedUInt : _rsslPlanPutUInt;
+			*pMaxLength = 9;
+			return RSSL_TRUE;
+		case RSSL_DT_REAL:
+			pSlot->putValue = fixed ? _rsslPlanPutFixedReal : _rsslPlanPutReal;
+			*pMaxLength = __RSZRL64 + 1;
+			return RSSL_TRUE;
+		case RSSL_DT_FLOAT:
+			pSlot->putValue = _rsslPlanPutFloat;
+			*pMaxLength = __RSZFLT + 1;
+			return RSSL_TRUE;
+		case RSSL_DT_DOUBLE:
+			pSlot->putValue = _rsslPlanPutDouble;
+			*pMaxLength = __RSZDBL + 1;
+			return RSSL_TRUE;
+		case RSSL_DT_ENUM:
+			pSlot->putValue = fixed ? _rsslPlanPutFixedEnum : _rsslPlanPutEnum;
+			*pMaxLength = 3;
+			return RSSL_TRUE;
+		case RSSL_DT_DATE:
+			pSlot->putValue = _rsslPlanPutDate;
+			*pMaxLength = __RSZDT + 1;
+			return RSSL_TRUE;
+		case RSSL_DT_TIME:
+			pSlot->putValue = fixed ? _rsslPlanPutFixedTime : _rsslPlanPutTime;
+			*pMaxLength = __RSZTM + 1;
+			return RSSL_TRUE;
+		case RSSL_DT_DATETIME:
+			pSlot->putValue = fixed ? _rsslPlanPutFixedDateTime : _rsslPlanPutDateTime;
+			*pMaxLength = __RSZDTM + 1;
+			return RSSL_TRUE;
+		case RSSL_DT_BUFFER:
+		case RSSL_DT_ASCII_STRING:
+		case RSSL_DT_UTF8_STRING:
+		case RSSL_DT_RMTES_STRING:
+			if (fixed)
+				return RSSL_FALSE;
+			pSlot->putValue = _rsslPlanPutBuffer;
+			*pMaxLength = 3;
+			return RSSL_TRUE;
+		default:
+			return RSSL_FALSE;
+	}
+}
+
+RTR_C_ALWAYS_INLINE char *_rsslPlanPutEntryValue(const RsslEncodePlanSlot *pSlot, char *pos, const void *pValue)
+{
+	static const RsslReal blankReal = RSSL_BLANK_REAL;
+
+	if (pValue)
+		return (*pSlot->putValue)(pos, pValue);
+	else if (!(pSlot->flags & RSSL_EPFF_FIXED_WIDTH))
+		return pos + rwfPutLenSpecBlank(pos);
+	else if (pSlot->dataType == RSSL_DT_REAL)
+		return _rsslPlanPutFixedReal(pos, &blankReal);
+	else
+		return NULL;
+}
+
+/* Copies the encoded message header into the plan, and adds the encoded field list header. */
+static RsslRet _rsslPlanSetHeader(RsslEncodePlan *pPlan, const char *pMsgHeader, RsslUInt32 msgHeaderLength,
+		const RsslFieldList *pFieldList)
+{
+	RsslEncodeIterator iter;
+	RsslFieldList fieldList;
+	RsslBuffer buffer;
+	RsslUInt16 fieldCount = pPlan->fieldCount;
+
+	if (pFieldList)
+	{
+		if (pFieldList->flags & ~(RSSL_FLF_HAS_FIELD_LIST_INFO | RSSL_FLF_HAS_STANDARD_DATA))
+			return RSSL_RET_INVALID_ARGUMENT;
+		fieldList = *pFieldList;
+	}
+	else
+		rsslClearFieldList(&fieldList);
+	fieldList.flags |= RSSL_FLF_HAS_STANDARD_DATA;
+
+	/* Flags, info length, dictionary id, field list number, and count. */
+	if ((pPlan->_header = (char*)malloc(msgHeaderLength + 8)) == NULL)
+		return RSSL_RET_FAILURE;
+
+	if (msgHeaderLength)
+		memcpy(pPlan->_header, pMsgHeader, msgHeaderLength);
+	pPlan->_msgHeaderLength = msgHeaderLength;
+
+	buffer.data = pPlan->_header + msgHeaderLength;
+	buffer.length = 8;
+	rsslClearEncodeIterator(&iter);
+	rsslSetEncodeIteratorRWFVersion(&iter, pPlan->majorVersion, pPlan->minorVersion);
+	rsslSetEncodeIteratorBuffer(&iter, &buffer);
+
+	if (rsslEncodeFieldListInit(&iter, &fieldList, 0, 0) != RSSL_RET_SUCCESS)
+	{
+		free(pPlan->_header);
+		pPlan->_header = NULL;
+		return RSSL_RET_INVALID_ARGUMENT;
+	}
+
+	/* The count is the last part of the field list header. */
+	pPlan->_headerLength = msgHeaderLength + rsslGetEncodedBufferLength(&iter);
+	rwfPut16((pPlan->_header + pPlan->_headerLength - 2), fieldCount);
+
+	return RSSL_RET_SUCCESS;
+}
+
+/* Copies the fields into the plan and chooses their encoders. */
+static RsslRet _rsslPlanSetSlots(RsslEncodePlan *pPlan, const RsslEncodePlanField *pFields)
+{
+	RsslUInt32 offset = pPlan->_headerLength;
+	RsslBool fixedPosition = RSSL_TRUE;
+	RsslUInt16 i;
+
+	if (pPlan->fieldCount && (pPlan->_slots = (RsslEncodePlanSlot*)malloc(pPlan->fieldCount * sizeof(RsslEncodePlanSlot))) == NULL)
+		return RSSL_RET_FAILURE;
+
+	pPlan->_maxLength = pPlan->_headerLength;
+	pPlan->_bufferFieldCount = 0;
+
+	for (i = 0; i < pPlan->fieldCount; ++i)
+	{
+		RsslEncodePlanSlot *pSlot = &pPlan->_slots[i];
+
+		pSlot->fieldId = pFields[i].fieldId;
+		pSlot->dataType = pFields[i].dataType;
+		pSlot->flags = pFields[i].flags;
+
+		if (!_rsslPlanSetEncoder(pSlot, &pSlot->maxLength))
+			return RSSL_RET_INVALID_ARGUMENT;
+
+		if (pSlot->putValue == _rsslPlanPutBuffer)
+			++pPlan->_bufferFieldCount;
+
+		/* A fixed-width value is at the same position in every message if every value before it is too. */
+		if (fixedPosition && (pSlot->flags & RSSL_EPFF_FIXED_WIDTH))
+		{
+			pSlot->offset = offset;
+			offset += 2 + pSlot->maxLength;
+		}
+		else
+		{
+			pSlot->offset = 0;
+			fixedPosition = RSSL_FALSE;
+		}
+
+		pPlan->_maxLength += 2 + pSlot->maxLength;
+	}
+
+	pPlan->encodedLength = fixedPosition ? offset : 0;
+
+	return RSSL_RET_SUCCESS;
+}
+
+RSSL_API RsslRet rsslBuildEncodePlan(RsslEncodePlan *pPlan, RsslMsg *pMsg, const RsslFieldList *pFieldList,
+		const RsslEncodePlanField *pFields, RsslUInt16 fieldCount)
+{
+	RsslEncodeIterator iter;
+	RsslBuffer buffer;
+	RsslUInt32 length = 256;
+	RsslRet ret;
+
+	RSSL_ASSERT(pPlan, Invalid parameters or parameters passed in as NULL);
+	RSSL_ASSERT(pFields || !fieldCount, Invalid parameters or parameters passed in as NULL);
+
+	if (!pMsg)
+	{
+		/* Only the field list. */
+		pPlan->fieldCount = fieldCount;
+		if ((ret = _rsslPlanSetHeader(pPlan, NULL, 0, pFieldList)) == RSSL_RET_SUCCESS)
+			ret = _rsslPlanSetSlots(pPlan, pFields);
+
+		if (ret != RSSL_RET_SUCCESS)
+			rsslDeleteEncodePlan(pPlan);
+
+		return ret;
+	}
+
+	if (pMsg->msgBase.containerType != RSSL_DT_FIELD_LIST)
+		return RSSL_RET_INVALID_ARGUMENT;
+
+	/* Encode the message header, with a larger buffer if needed for the key attributes and extended header. */
+	do
+	{
+		if ((buffer.data = (char*)malloc(length)) == NULL)
+			return RSSL_RET_FAILURE;
+		buffer.length = length;
+
+		rsslClearEncodeIterator(&iter);
+		rsslSetEncodeIteratorRWFVersion(&iter, pPlan->majorVersion, pPlan->minorVersion);
+		rsslSetEncodeIteratorBuffer(&iter, &buffer);
+
+		if ((ret = rsslEncodeMsgInit(&iter, pMsg, 0)) == RSSL_RET_BUFFER_TOO_SMALL)
+		{
+			free(buffer.data);
+			length *= 2;
+		}
+	} while (ret == RSSL_RET_BUFFER_TOO_SMALL && length <= 4 * RWF_MAX_16);
+
+	/* The header is complete when the iterator is ready for the field list. */
+	if (ret != RSSL_RET_ENCODE_CONTAINER)
+	{
+		if (ret != RSSL_RET_BUFFER_TOO_SMALL)
+			free(buffer.data);
+		return RSSL_RET_INVALID_ARGUMENT;
+	}
+
+	pPlan->fieldCount = fieldCount;
+	ret = _rsslPlanSetHeader(pPlan, buffer.data, rsslGetEncodedBufferLength(&iter), pFieldList);
+	free(buffer.data);
+
+	if (ret == RSSL_RET_SUCCESS)
+		ret = _rsslPlanSetSlots(pPlan, pFields);
+
+	if (ret != RSSL_RET_SUCCESS)
+		rsslDeleteEncodePlan(pPlan);
+
+	return ret;
+}
+
+RSSL_API RsslRet rsslBuildEncodePlanFromSample(RsslEncodePlan *pPlan, const RsslBuffer *pSample,
+		const RsslDataDictionary *pDictionary, RsslUInt8 fieldFlags)
+{
+	RsslDecodeIterator iter;
+	RsslMsg msg;
+	RsslFieldList fieldList;
+	RsslFieldEntry fieldEntry;
+	RsslEncodePlanField *pFields = NULL;
+	RsslUInt32 msgHeaderLength;
+	RsslUInt16 fieldCount = 0;
+	RsslUInt16 pass;
+	RsslRet ret;
+
+	RSSL_ASSERT(pPlan && pSample && pDictionary, Invalid parameters or parameters passed in as NULL);
+
+	rsslClearDecodeIterator(&iter);
+	rsslSetDecodeIteratorRWFVersion(&iter, pPlan->majorVersion, pPlan->minorVersion);
+	rsslSetDecodeIteratorBuffer(&iter, (RsslBuffer*)pSample);
+
+	if (rsslDecodeMsg(&iter, &msg) != RSSL_RET_SUCCESS || msg.msgBase.containerType != RSSL_DT_FIELD_LIST
+			|| msg.msgBase.encDataBody.length == 0)
+		return RSSL_RET_INVALID_ARGUMENT;
+
+	msgHeaderLength = (RsslUInt32)(msg.msgBase.encDataBody.data - pSample->data);
+
+	/* Count the fields, then collect them. */
+	for (pass = 0; pass < 2; ++pass)
+	{
+		RsslUInt16 i = 0;
+
+		rsslClearDecodeIterator(&iter);
+		rsslSetDecodeIteratorRWFVersion(&iter, pPlan->majorVersion, pPlan->minorVersion);
+		rsslSetDecodeIteratorBuffer(&iter, (RsslBuffer*)&msg.msgBase.encDataBody);
+
+		if (rsslDecodeFieldList(&iter, &fieldList, 0) != RSSL_RET_SUCCESS || rsslFieldListCheckHasSetData(&fieldList))
+		{
+			free(pFields);
+			return RSSL_RET_INVALID_ARGUMENT;
+		}
+
+		while ((ret = rsslDecodeFieldEntry(&iter, &fieldEntry)) != RSSL_RET_END_OF_CONTAINER)
+		{
+			RsslDictionaryEntry *pEntry;
+
+			if (ret < RSSL_RET_SUCCESS)
+			{
+				free(pFields);
+				return RSSL_RET_INVALID_ARGUMENT;
+			}
+
+			if (pass == 0)
+			{
+				++fieldCount;
+				continue;
+			}
+
+			if (fieldEntry.fieldId < pDictionary->minFid || fieldEntry.fieldId > pDictionary->maxFid
+					|| (pEntry = pDictionary->entriesArray[fieldEntry.fieldId]) == NULL)
+			{
+				free(pFields);
+				return RSSL_RET_INVALID_ARGUMENT;
+			}
+
+			pFields[i].fieldId = fieldEntry.fieldId;
+			pFields[i].dataType = _rsslPrimitiveType(pEntry->rwfType);
+			switch (pFields[i].dataType)
+			{
+				case RSSL_DT_BUFFER:
+				case RSSL_DT_ASCII_STRING:
+				case RSSL_DT_UTF8_STRING:
+				case RSSL_DT_RMTES_STRING:
+					pFields[i].flags = fieldFlags & ~RSSL_EPFF_FIXED_WIDTH;
+					break;
+				default:
+					pFields[i].flags = fieldFlags;
+					break;
+			}
+			++i;
+		}
+
+		if (pass == 0 && fieldCount && (pFields = (RsslEncodePlanField*)malloc(fieldCount * sizeof(RsslEncodePlanField))) == NULL)
+			return RSSL_RET_FAILURE;
+	}
+
+	pPlan->fieldCount = fieldCount;
+	ret = _rsslPlanSetHeader(pPlan, pSample->data, msgHeaderLength, &fieldList);
+
+	if (ret == RSSL_RET_SUCCESS)
+		ret = _rsslPlanSetSlots(pPlan, pFields);
+
+	free(pFields);
+
+	if (ret != RSSL_RET_SUCCESS)
+		rsslDeleteEncodePlan(pPlan);
+
+	return ret;
+}
+
+RSSL_API RsslRet rsslEncodeWithPlan(const RsslEncodePlan *pPlan, RsslBuffer *pBuffer, RsslInt32 streamId, const void **pValues)
+{
+	const RsslEncodePlanSlot *pSlot = pPlan->_slots;
+	const RsslEncodePlanSlot *pEndSlot = pSlot + pPlan->fieldCount;
+	RsslUInt32 length = pPlan->_maxLength;
+	char *pos;
+
+	RSSL_ASSERT(pPlan && pPlan->_header && pBuffer && pBuffer->data, Invalid parameters or parameters passed in as NULL);
+	RSSL_ASSERT(pValues || !pPlan->fieldCount, Invalid parameters or parameters passed in as NULL);
+
+	/* Only buffer values can be longer than the plan allows for. */
+	if (pPlan->_bufferFieldCount)
+	{
+		RsslUInt16 i;
+
+		for (i = 0; i < pPlan->fieldCount; ++i)
+			if (pPlan->_slots[i].putValue == _rsslPlanPutBuffer && pValues[i])
+				length += ((const RsslBuffer*)pValues[i])->length;
+	}
+
+	if (length > pBuffer->length)
+		return RSSL_RET_BUFFER_TOO_SMALL;
+
+	pos = pBuffer->data;
+	memcpy(pos, pPlan->_header, pPlan->_headerLength);
+	if (pPlan->_msgHeaderLength)
+		rwfPut32((pos + _RSSL_MSG_STREAMID_POS), streamId);
+	pos += pPlan->_headerLength;
+
+	for (; pSlot < pEndSlot; ++pSlot, ++pValues)
+	{
+		pos += rwfPut16(pos, pSlot->fieldId);
+
+		if ((pos = _rsslPlanPutEntryValue(pSlot, pos, *pValues)) == NULL)
+			return RSSL_RET_INVALID_DATA;
+	}
+
+	pBuffer->length = (RsslUInt32)(pos - pBuffer->data);
+	return RSSL_RET_SUCCESS;
+}
+
+RSSL_API RsslRet rsslPatchEncodePlanValue(const RsslEncodePlan *pPlan, RsslBuffer *pEncodedMsg, RsslUInt16 fieldIndex, const void *pValue)
+{
+	const RsslEncodePlanSlot *pSlot;
+
+	RSSL_ASSERT(pPlan && pPlan->_header && pEncodedMsg && pEncodedMsg->data, Invalid parameters or parameters passed in as NULL);
+
+	if (fieldIndex >= pPlan->fieldCount || (pSlot = &pPlan->_slots[fieldIndex])->offset == 0)
+		return RSSL_RET_INVALID_ARGUMENT;
+
+	if (pEncodedMsg->length < pSlot->offset + 2 + pSlot->maxLength)
+		return RSSL_RET_INVALID_ARGUMENT;
+
+	if (_rsslPlanPutEntryValue(pSlot, pEncodedMsg->data + pSlot->offset + 2, pValue) == NULL)
+		return RSSL_RET_INVALID_DATA;
+
+	return RSSL_RET_SUCCESS;
+}
+
+RSSL_API void rsslDeleteEncodePlan(RsslEncodePlan *pPlan)
+{
+	RsslUInt8 majorVersion = pPlan->majorVersion;
+	RsslUInt8 minorVersion = pPlan->minorVersion;
+
+	free(pPlan->_header);
+	free(pPlan->_slots);
+	rsslClearEncodePlan(pPlan);
+	pPlan->majorVersion = majorVersion;
+	pPlan->minorVersion = minorVersion;
+}
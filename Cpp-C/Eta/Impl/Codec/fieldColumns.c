@@ -0,0 +1,322 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2022 Refinitiv. All rights reserved.              --
+ *|-----------------------------------------------------------------------------
+ */
+
+#include "rtr/rsslFieldColumns.h"
+#include "rtr/rsslMessagePackage.h"
+#include "rtr/rsslDataPackage.h"
+#include "rtr/decoderTools.h"
+#include <math.h>
+
+#ifdef WIN32
+	#ifndef INFINITY
+		#define INFINITY HUGE_VAL
+	#endif
+	#ifndef NAN
+		static const unsigned long __nan[2] = {0xffffffff, 0x7fffffff};
+		#define NAN (*(const double *) __nan)
+	#endif
+#endif
+
+/* Multipliers of the exponent and fraction hints, as used by rsslRealToDouble(). */
+static const RsslDouble fieldColumnPowHints[] = { 1e-14, 1e-13, 1e-12, 1e-11, 1e-10, 1e-9, 1e-8, 1e-7, 1e-6, 1e-5, 1e-4, 1e-3, 1e-2, 1e-1, 1., 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1., 0.5, 0.25, 0.125, 0.0625, 0.03125, 0.015625, 0.0078125, 0.00390625 };
+
+/* Nanoseconds in a day. */
+#define FIELD_COLUMN_DAY_NSEC ((RsslInt64)86400 * 1000000000)
+
+/* Returns the number of days from 1970-01-01 to a date of the proleptic Gregorian calendar. */
+RTR_C_ALWAYS_INLINE RsslInt64 _rsslFieldColumnDays(RsslInt64 year, RsslUInt32 month, RsslUInt32 day)
+{
+	RsslInt64 era, yearOfEra, dayOfYear, dayOfEra;
+
+	/* Count years from March, so that the leap day is the last day of the year. */
+	if (month <= 2)
+		--year;
+
+	era = (year >= 0 ? year : year - 399) / 400;
+	yearOfEra = year - era * 400;
+	dayOfYear = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+	dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+	return era * 146097 + dayOfEra - 719468;
+}
+
+RTR_C_ALWAYS_INLINE RsslInt64 _rsslFieldColumnTimeNsec(const RsslTime *pTime)
+{
+	return ((((RsslInt64)pTime->hour * 60 + pTime->minute) * 60 + pTime->second) * 1000000000)
+		+ (RsslInt64)pTime->millisecond * 1000000 + (RsslInt64)pTime->microsecond * 1000 + pTime->nanosecond;
+}
+
+/* Decodes the content of a field entry into a column's row.  Returns RSSL_FALSE if the content is blank or cannot be decoded. */
+RTR_C_ALWAYS_INLINE RsslBool _rsslFieldColumnDecode(RsslDecodeIterator *pIter, RsslFieldColumn *pColumn, RsslFieldEntry *pEntry, RsslUInt32 row)
+{
+	char *data = pEntry->encData.data;
+	RsslUInt32 length = pEntry->encData.length;
+	RsslInt64 intValue;
+	RsslUInt64 uintValue;
+	RsslDouble doubleValue;
+	RsslUInt8 format;
+
+	if (length == 0)
+		return RSSL_FALSE;
+
+	switch (pColumn->_fieldType)
+	{
+		case RSSL_DT_REAL:
+			if (length == 1)
+			{
+				/* Only a hint, which is either blank or one of the special values. */
+				rwfGet8(format, data);
+				intValue = 0;
+			}
+			else if (rwfGetReal64(&intValue, &format, (rtrUInt16)length, data) <= 0)
+				return RSSL_FALSE;
+
+			switch (format & 0x3F)
+			{
+				case RSSL_RH_INFINITY: doubleValue = (RsslDouble)INFINITY; break;
+				case RSSL_RH_NEG_INFINITY: doubleValue = -(RsslDouble)INFINITY; break;
+				case RSSL_RH_NOT_A_NUMBER: doubleValue = NAN; break;
+				default:
+					if (length == 1 || (format & 0x20) || (format & 0x1F) > RSSL_RH_MAX_DIVISOR)
+						return RSSL_FALSE;
+					doubleValue = (RsslDouble)intValue * fieldColumnPowHints[format & 0x1F];
+					break;
+			}
+			((RsslDouble*)pColumn->values)[row] = doubleValue;
+			return RSSL_TRUE;
+
+		case RSSL_DT_UINT:
+			if (length > 8 || rwfGetLenSpecU64Size(&uintValue, data, (rtrUInt8)length) < 0)
+				return RSSL_FALSE;
+			if (pColumn->columnType == RSSL_FCT_DOUBLE)
+				((RsslDouble*)pColumn->values)[row] = (RsslDouble)uintValue;
+			else
+				((RsslInt64*)pColumn->values)[row] = (RsslInt64)uintValue;
+			return RSSL_TRUE;
+
+		case RSSL_DT_INT:
+			if (length > 8 || rwfGetLenSpecI64Size(&intValue, data, (rtrUInt8)length) < 0)
+				return RSSL_FALSE;
+			if (pColumn->columnType == RSSL_FCT_DOUBLE)
+				((RsslDouble*)pColumn->values)[row] = (RsslDouble)intValue;
+			else
+				((RsslInt64*)pColumn->values)[row] = intValue;
+			return RSSL_TRUE;
+
+		case RSSL_DT_ENUM:
+		{
+			RsslEnum enumValue;
+
+			if (length > 2 || rwfGetLenSpecU16_Size(&enumValue, data, (rtrUInt16)length) < 0)
+				return RSSL_FALSE;
+			((RsslInt64*)pColumn->values)[row] = enumValue;
+			return RSSL_TRUE;
+		}
+
+		case RSSL_DT_FLOAT:
+		{
+			RsslFloat floatValue;
+
+			if (length != 4)
+				return RSSL_FALSE;
+			rwfGetFloat(floatValue, data);
+			((RsslDouble*)pColumn->values)[row] = floatValue;
+			return RSSL_TRUE;
+		}
+
+		case RSSL_DT_DOUBLE:
+			if (length != 8)
+				return RSSL_FALSE;
+			rwfGetDouble(doubleValue, data);
+			((RsslDouble*)pColumn->values)[row] = doubleValue;
+			return RSSL_TRUE;
+
+		/* Dates and times have several encoded lengths, so use their decoders. */
+		case RSSL_DT_DATETIME:
+		{
+			RsslDateTime dateTime;
+
+			if (rsslDecodeDateTime(pIter, &dateTime) != RSSL_RET_SUCCESS || !dateTime.date.year)
+				return RSSL_FALSE;
+			((RsslInt64*)pColumn->values)[row] = _rsslFieldColumnDays(dateTime.date.year, dateTime.date.month, dateTime.date.day) * FIELD_COLUMN_DAY_NSEC
+				+ _rsslFieldColumnTimeNsec(&dateTime.time);
+			return RSSL_TRUE;
+		}
+
+		case RSSL_DT_DATE:
+		{
+			RsslDate date;
+
+			if (rsslDecodeDate(pIter, &date) != RSSL_RET_SUCCESS || !date.year)
+				return RSSL_FALSE;
+			((RsslInt64*)pColumn->values)[row] = _rsslFieldColumnDays(date.year, date.month, date.day) * FIELD_COLUMN_DAY_NSEC;
+			return RSSL_TRUE;
+		}
+
+		case RSSL_DT_TIME:
+		{
+			RsslTime time;
+
+			if (rsslDecodeTime(pIter, &time) != RSSL_RET_SUCCESS)
+				return RSSL_FALSE;
+			((RsslInt64*)pColumn->values)[row] = _rsslFieldColumnTimeNsec(&time);
+			return RSSL_TRUE;
+		}
+
+		default:
+			return RSSL_FALSE;
+	}
+}
+
+RSSL_API RsslRet rsslInitFieldColumnSet(RsslFieldColumnSet *pColumnSet, const RsslDataDictionary *pDictionary)
+{
+	RsslFieldColumn *pColumn;
+	RsslDictionaryEntry *pEntry;
+	RsslUInt32 i;
+
+	RSSL_ASSERT(pColumnSet && pDictionary, Invalid parameters or parameters passed in as NULL);
+
+	pColumnSet->_fieldIdMask = 0;
+	pColumnSet->_initialized = RSSL_FALSE;
+
+	/* Each row tracks its columns in a 64-bit mask. */
+	if (pColumnSet->columnCount > 64 || (pColumnSet->columnCount && !pColumnSet->columns))
+		return RSSL_RET_INVALID_ARGUMENT;
+
+	for (i = 0; i < pColumnSet->columnCount; ++i)
+	{
+		pColumn = &pColumnSet->columns[i];
+
+		if (!pColumn->values || pColumn->fieldId < pDictionary->minFid || pColumn->fieldId > pDictionary->maxFid
+				|| (pEntry = pDictionary->entriesArray[pColumn->fieldId]) == NULL)
+			return RSSL_RET_INVALID_ARGUMENT;
+
+		switch (pColumn->columnType)
+		{
+			case RSSL_FCT_DOUBLE:
+				if (pEntry->rwfType != RSSL_DT_REAL && pEntry->rwfType != RSSL_DT_FLOAT && pEntry->rwfType != RSSL_DT_DOUBLE
+						&& pEntry->rwfType != RSSL_DT_INT && pEntry->rwfType != RSSL_DT_UINT)
+					return RSSL_RET_INVALID_ARGUMENT;
+				break;
+			case RSSL_FCT_INT64:
+				if (pEntry->rwfType != RSSL_DT_INT && pEntry->rwfType != RSSL_DT_UINT && pEntry->rwfType != RSSL_DT_ENUM)
+					return RSSL_RET_INVALID_ARGUMENT;
+				break;
+			case RSSL_FCT_TIMESTAMP:
+				if (pEntry->rwfType != RSSL_DT_DATETIME && pEntry->rwfType != RSSL_DT_DATE && pEntry->rwfType != RSSL_DT_TIME)
+					return RSSL_RET_INVALID_ARGUMENT;
+				break;
+			default:
+				return RSSL_RET_INVALID_ARGUMENT;
+		}
+
+		pColumn->_fieldType = pEntry->rwfType;
+		pColumnSet->_fieldIdMask |= (RsslUInt64)1 << ((RsslUInt16)pColumn->fieldId & 63);
+	}
+
+	pColumnSet->_initialized = RSSL_TRUE;
+	return RSSL_RET_SUCCESS;
+}
+
+RSSL_API RsslRet rsslExtractFieldColumns(RsslFieldColumnSet *pColumnSet, const RsslBuffer *pMessages, RsslUInt32 messageCount)
+{
+	RsslDecodeIterator	iter;
+	RsslMsg				msg;
+	RsslFieldList		fieldList;
+	RsslFieldEntry		entry;
+	RsslFieldColumn		*pColumn;
+	RsslUInt64			allColumns, seenColumns, filledColumns, fieldIdMask;
+	RsslUInt32			columnCount;
+	RsslUInt32			i, row;
+	RsslInt32			streamId;
+	RsslRet				ret;
+
+	RSSL_ASSERT(pColumnSet && (pMessages || !messageCount), Invalid parameters or parameters passed in as NULL);
+
+	fieldIdMask = pColumnSet->_fieldIdMask;
+	columnCount = pColumnSet->columnCount;
+
+	if (!pColumnSet->_initialized)
+		return RSSL_RET_INVALID_ARGUMENT;
+
+	if (pColumnSet->rowCount > pColumnSet->rowCapacity || messageCount > pColumnSet->rowCapacity - pColumnSet->rowCount)
+		return RSSL_RET_BUFFER_TOO_SMALL;
+
+	if (pColumnSet->rowCount == 0)
+	{
+		for (i = 0; i < columnCount; ++i)
+			pColumnSet->columns[i].valueCount = 0;
+	}
+
+	allColumns = (columnCount == 64) ? ~(RsslUInt64)0 : (((RsslUInt64)1 << columnCount) - 1);
+
+	for (row = pColumnSet->rowCount; row < pColumnSet->rowCount + messageCount; ++row)
+	{
+		seenColumns = filledColumns = 0;
+		streamId = 0;
+
+		rsslClearDecodeIterator(&iter);
+		rsslSetDecodeIteratorBuffer(&iter, (RsslBuffer*)&pMessages[row - pColumnSet->rowCount]);
+		rsslSetDecodeIteratorRWFVersion(&iter, pColumnSet->majorVersion, pColumnSet->minorVersion);
+
+		if (rsslDecodeMsg(&iter, &msg) == RSSL_RET_SUCCESS)
+		{
+			streamId = msg.msgBase.streamId;
+
+			if (msg.msgBase.containerType == RSSL_DT_FIELD_LIST
+					&& ((ret = rsslDecodeFieldList(&iter, &fieldList, NULL)) == RSSL_RET_SUCCESS || ret == RSSL_RET_SET_SKIPPED))
+			{
+				/* Stop once every column has seen its field. */
+				while (seenColumns != allColumns && rsslDecodeFieldEntry(&iter, &entry) == RSSL_RET_SUCCESS)
+				{
+					if (!(fieldIdMask & ((RsslUInt64)1 << ((RsslUInt16)entry.fieldId & 63))))
+						continue;
+
+					for (i = 0; i < columnCount; ++i)
+					{
+						pColumn = &pColumnSet->columns[i];
+
+						if (pColumn->fieldId != entry.fieldId || (seenColumns & ((RsslUInt64)1 << i)))
+							continue;
+
+						seenColumns |= (RsslUInt64)1 << i;
+						if (_rsslFieldColumnDecode(&iter, pColumn, &entry, row))
+							filledColumns |= (RsslUInt64)1 << i;
+					}
+				}
+			}
+		}
+
+		if (pColumnSet->streamIds)
+			pColumnSet->streamIds[row] = streamId;
+
+		for (i = 0; i < columnCount; ++i)
+		{
+			pColumn = &pColumnSet->columns[i];
+
+			if (filledColumns & ((RsslUInt64)1 << i))
+			{
+				++pColumn->valueCount;
+				if (pColumn->presence)
+					pColumn->presence[row >> 3] |= (RsslUInt8)(1 << (row & 7));
+			}
+			else
+			{
+				if (pColumn->columnType == RSSL_FCT_DOUBLE)
+					((RsslDouble*)pColumn->values)[row] = NAN;
+				else
+					((RsslInt64*)pColumn->values)[row] = 0;
+
+				if (pColumn->presence)
+					pColumn->presence[row >> 3] &= (RsslUInt8)~(1 << (row & 7));
+			}
+		}
+	}
+
+	pColumnSet->rowCount += messageCount;
+	return RSSL_RET_SUCCESS;
+}
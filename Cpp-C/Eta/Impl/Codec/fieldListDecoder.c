@@ -134,7 +134,9 @@ RSSL_API RsslRet rsslDecodeFieldList(
 		else
 		{
 			_levelInfo->_setCount = 0;
-			_levelInfo->_nextEntryPtr = /* oIter->_curBufPtr = */ position + oFieldList->encSetData.length;
+			/* Skip the set data. When there are standard entries, position is already past it. */
+			_levelInfo->_nextEntryPtr = /* oIter->_curBufPtr = */
+				rsslFieldListCheckHasStandardData(oFieldList) ? position : position + oFieldList->encSetData.length;
 			return RSSL_RET_SET_SKIPPED;
 		}
 	}
@@ -241,6 +243,170 @@ RSSL_API RsslRet rsslDecodeFieldEntry(
 	return RSSL_RET_SUCCESS;
 }
 
+/* Position recorded in an index slot for an entry with no content(whose encData.data is null). */
+#define FIELD_LIST_INDEX_NULL_POSITION 0xFFFFFFFF
+
+/* Finds the first slot for a field identifier(multiplicative hash of the identifier). */
+RTR_C_ALWAYS_INLINE RsslUInt32 _rsslFieldListIndexHash(RsslFieldId fieldId, RsslUInt32 slotCount)
+{
+	RsslUInt32 hash = (RsslUInt32)(RsslUInt16)fieldId * 0x9E3779B1U;
+	return (hash ^ (hash >> 16)) & (slotCount - 1);
+}
+
+/* Records an entry in the index, unless its field identifier is already there. */
+RTR_C_ALWAYS_INLINE RsslRet _rsslFieldListIndexAdd(RsslFieldListIndex *pIndex, RsslFieldId fieldId, RsslUInt8 dataType, RsslBuffer *pEncData)
+{
+	RsslUInt32 slot = _rsslFieldListIndexHash(fieldId, pIndex->slotCount);
+	RsslFieldListIndexSlot *pSlot;
+
+	for(;;)
+	{
+		pSlot = &pIndex->slots[slot];
+
+		if (pSlot->_generation != pIndex->_generation)
+			break;
+
+		if (pSlot->fieldId == fieldId)
+			return RSSL_RET_SUCCESS;
+
+		slot = (slot + 1) & (pIndex->slotCount - 1);
+	}
+
+	/* Keep at least one slot empty, so that lookups always stop. */
+	if (pIndex->entryCount + 1 >= pIndex->slotCount)
+		return RSSL_RET_BUFFER_TOO_SMALL;
+
+	pSlot->fieldId = fieldId;
+	pSlot->_generation = pIndex->_generation;
+	pSlot->position = pEncData->data ? (RsslUInt32)(pEncData->data - pIndex->_pData) : FIELD_LIST_INDEX_NULL_POSITION;
+	pSlot->length = (RsslUInt16)pEncData->length;
+	pSlot->dataType = dataType;
+	++pIndex->entryCount;
+	return RSSL_RET_SUCCESS;
+}
+
+RSSL_API RsslRet rsslDecodeFieldListIndexed(
+				RsslDecodeIterator		*oIter,
+				RsslFieldList			*oFieldList,
+				RsslLocalFieldSetDefDb	*iLocalSetDb,
+				RsslFieldListIndex		*pIndex )
+{
+	RsslDecodingLevel	*_levelInfo;
+	RsslDecodingLevel	savedLevelInfo;
+	char				*savedCurBufPtr, *savedEntryEndPtr;
+	char				*position, *_endBufPtr;
+	RsslFieldEntry		field;
+	RsslUInt32			i;
+	RsslRet				ret, listRet;
+
+	RSSL_ASSERT(oIter && pIndex, Invalid parameters or parameters passed in as NULL);
+	RSSL_ASSERT(pIndex->slots && pIndex->slotCount && !(pIndex->slotCount & (pIndex->slotCount - 1)), Invalid index slots);
+
+	/* Slots filled for an earlier field list carry an older generation, so they need not be cleared.  Clear them
+	 * when the index is first used, and whenever the generation wraps. */
+	if (pIndex->_generation == 0 || ++pIndex->_generation == 0)
+	{
+		memset(pIndex->slots, 0, pIndex->slotCount * sizeof(RsslFieldListIndexSlot));
+		pIndex->_generation = 1;
+	}
+
+	pIndex->entryCount = 0;
+	pIndex->_pData = oIter->_curBufPtr;
+
+	if ((listRet = rsslDecodeFieldList(oIter, oFieldList, iLocalSetDb)) != RSSL_RET_SUCCESS && listRet != RSSL_RET_SET_SKIPPED)
+		return listRet;
+
+	/* Walk the entries, then put the iterator back at the first one. */
+	_levelInfo = &oIter->_levelInfo[oIter->_decodingLevel];
+	savedLevelInfo = *_levelInfo;
+	savedCurBufPtr = oIter->_curBufPtr;
+	savedEntryEndPtr = oIter->_levelInfo[oIter->_decodingLevel + 1]._endBufPtr;
+	ret = RSSL_RET_SUCCESS;
+
+	/* Set-defined entries need their definitions to find their lengths. */
+	while (_levelInfo->_nextSetPosition < _levelInfo->_setCount)
+	{
+		if ((ret = rsslDecodeFieldEntry(oIter, &field)) != RSSL_RET_SUCCESS
+				|| (ret = _rsslFieldListIndexAdd(pIndex, field.fieldId, field.dataType, &field.encData)) != RSSL_RET_SUCCESS)
+			break;
+	}
+
+	/* Standard entries only need their field identifiers and lengths read. */
+	if (ret == RSSL_RET_SUCCESS)
+	{
+		position = _levelInfo->_nextEntryPtr;
+		_endBufPtr = _levelInfo->_endBufPtr;
+
+		for (i = _levelInfo->_nextItemPosition; i < _levelInfo->_itemCount; ++i)
+		{
+			if (_endBufPtr - position < 3)
+			{
+				ret = RSSL_RET_INCOMPLETE_DATA;
+				break;
+			}
+
+			position += rwfGet16(field.fieldId, position);
+			position += rwfGetBuffer16(&field.encData, position);
+			if (position > _endBufPtr)
+			{
+				ret = RSSL_RET_INCOMPLETE_DATA;
+				break;
+			}
+
+			if ((ret = _rsslFieldListIndexAdd(pIndex, field.fieldId, RSSL_DT_UNKNOWN, &field.encData)) != RSSL_RET_SUCCESS)
+				break;
+		}
+	}
+
+	*_levelInfo = savedLevelInfo;
+	oIter->_curBufPtr = savedCurBufPtr;
+	oIter->_levelInfo[oIter->_decodingLevel + 1]._endBufPtr = savedEntryEndPtr;
+
+	return (ret == RSSL_RET_SUCCESS) ? listRet : ret;
+}
+
+RSSL_API RsslRet rsslDecodeFieldEntryById(
+				RsslDecodeIterator			*iIter,
+				const RsslFieldListIndex	*pIndex,
+				RsslFieldId					fieldId,
+				RsslFieldEntry				*oField )
+{
+	RsslUInt32 slot;
+	const RsslFieldListIndexSlot *pSlot;
+
+	RSSL_ASSERT(iIter && pIndex && oField, Invalid parameters or parameters passed in as NULL);
+	RSSL_ASSERT(iIter->_decodingLevel > -1 && iIter->_decodingLevel < 17, Invalid or incorrect iterator used);
+
+	if (pIndex->entryCount == 0)
+		return RSSL_RET_END_OF_CONTAINER;
+
+	slot = _rsslFieldListIndexHash(fieldId, pIndex->slotCount);
+
+	for(;;)
+	{
+		pSlot = &pIndex->slots[slot];
+
+		if (pSlot->_generation != pIndex->_generation)
+			return RSSL_RET_END_OF_CONTAINER;
+
+		if (pSlot->fieldId == fieldId)
+			break;
+
+		slot = (slot + 1) & (pIndex->slotCount - 1);
+	}
+
+	oField->fieldId = fieldId;
+	oField->dataType = pSlot->dataType;
+	oField->encData.data = (pSlot->position != FIELD_LIST_INDEX_NULL_POSITION) ? pIndex->_pData + pSlot->position : 0;
+	oField->encData.length = pSlot->length;
+
+	/* Position the iterator on the content, as rsslDecodeFieldEntry() does, but leave the next entry unchanged. */
+	iIter->_curBufPtr = oField->encData.data;
+	iIter->_levelInfo[iIter->_decodingLevel + 1]._endBufPtr = oField->encData.data + oField->encData.length;
+
+	return RSSL_RET_SUCCESS;
+}
+
 RSSL_API RsslRet rsslDecodeLocalFieldSetDefDb(
 				RsslDecodeIterator				*pIter,
 				RsslLocalFieldSetDefDb			*oLocalSetDb )
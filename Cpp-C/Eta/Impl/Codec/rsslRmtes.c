@@ -11,6 +11,7 @@ extern "C" {
 #endif
 
 #include "limits.h"
+#include <string.h>
 
 #include "rtr/rsslTypes.h"
 
@@ -62,6 +63,67 @@ typedef enum {
 	TYPE_UTF8 = 2,
 } EncodeType;
 
+/* SSE2 is part of every x86-64 CPU, so it needs no runtime check. */
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define RMTES_SCAN_SSE2
+#include <emmintrin.h>
+#endif
+
+/* Returns the number of bytes at the start of the input that are printable ASCII (0x20 to 0x7E).
+ * In the default character set, these are converted to the same bytes in UTF-8, so runs of them
+ * can be copied without going through the conversion state machine. */
+static RsslUInt32 rmtesPrintableAsciiLength(const unsigned char *inIter, const unsigned char *endInput)
+{
+	const unsigned char *start = inIter;
+
+#ifdef RMTES_SCAN_SSE2
+	const __m128i lowest = _mm_set1_epi8(0x20);
+	const __m128i del = _mm_set1_epi8(0x7F);
+
+	/* Bytes of 0x80 and above are negative as signed bytes, so they fail the same compare as control characters. */
+	while (endInput - inIter >= 16)
+	{
+		__m128i chars = _mm_loadu_si128((const __m128i*)inIter);
+		int mask = _mm_movemask_epi8(_mm_or_si128(_mm_cmplt_epi8(chars, lowest), _mm_cmpeq_epi8(chars, del)));
+
+		if (mask != 0)
+		{
+			while (!(mask & 1))
+			{
+				mask >>= 1;
+				++inIter;
+			}
+			return (RsslUInt32)(inIter - start);
+		}
+		inIter += 16;
+	}
+#else
+	/* Checks 8 bytes at a time: adding 0x60 to each 7-bit byte sets its high bit if it is 0x20 or more,
+	 * and adding 0x01 sets it if it is 0x7F. Neither addition carries into the next byte. */
+	while (endInput - inIter >= 8)
+	{
+		RsslUInt64 word;
+
+		memcpy(&word, inIter, 8);
+		if ((word & 0x8080808080808080ULL)
+				|| ((word + 0x6060606060606060ULL) & ~(word + 0x0101010101010101ULL) & 0x8080808080808080ULL) != 0x8080808080808080ULL)
+			break;
+		inIter += 8;
+	}
+#endif
+
+	while (inIter < endInput && *inIter >= 0x20 && *inIter < 0x7F)
+		++inIter;
+
+	return (RsslUInt32)(inIter - start);
+}
+
+/* Checks whether a character set converts printable ASCII to itself, as the default set (Reuters Basic 1) does. */
+RTR_C_ALWAYS_INLINE int isAsciiCharSet(RsslRmtesCharSet *set)
+{
+	return (set->_table1 == NULL && set->_table2 == NULL && set->_stride != 2 && set->_shape == SHAPE_94);
+}
+
 int GLLowest(RsslRmtesCharSet* set)
 {
 	return (set->_shape == SHAPE_96) ? 0x20 : 0x21;
@@ -593,6 +655,7 @@ RSSL_API RsslRet rsslRMTESToUTF8(RsslRmtesCacheBuffer *pRmtesBuffer, RsslBuffer
 
 	unsigned char* tempChar;
 	unsigned short tempShort;
+	RsslUInt32 runLength;
 	
 	RsslRmtesWorkingSet curWorkingSet;
 	RsslRmtesCharSet * shiftGL = NULL;
@@ -620,7 +683,17 @@ RSSL_API RsslRet rsslRMTESToUTF8(RsslRmtesCacheBuffer *pRmtesBuffer, RsslBuffer
 	{
 		if(encType == TYPE_RMTES)
 		{
-			if(*inIter < 0x20)  /* CL character */
+			/* Copies printable ASCII as is, when the character set in GL leaves it unchanged. */
+			if(shiftGL == NULL && isAsciiCharSet(*curWorkingSet.GL) && (runLength = rmtesPrintableAsciiLength(inIter, endInput)) > 0)
+			{
+				if(runLength > (RsslUInt32)(endOutput - outIter))
+					return RSSL_RET_BUFFER_TOO_SMALL;
+
+				memcpy(outIter, inIter, runLength);
+				outIter += runLength;
+				inIter += runLength;
+			}
+			else if(*inIter < 0x20)  /* CL character */
 			{
 				if(shiftGL != NULL)
 					return RSSL_RET_FAILURE;
@@ -866,11 +939,17 @@ RSSL_API RsslRet rsslRMTESToUTF8(RsslRmtesCacheBuffer *pRmtesBuffer, RsslBuffer
 					}
 				}
 			}
-			else /* Just copy the data, since it's already encoded in UTF8 */
+			else /* Just copy the data up to the next escape, since it's already encoded in UTF8 */
 			{
-				*outIter = *inIter;
-				outIter++;
-				inIter++;
+				tempChar = (unsigned char*)memchr(inIter, 0x1B, endInput - inIter);
+				runLength = (RsslUInt32)((tempChar ? tempChar : endInput) - inIter);
+
+				if(runLength > (RsslUInt32)(endOutput - outIter))
+					return RSSL_RET_BUFFER_TOO_SMALL;
+
+				memcpy(outIter, inIter, runLength);
+				outIter += runLength;
+				inIter += runLength;
 			}
 		}
 	}
@@ -895,6 +974,7 @@ RSSL_API RsslRet rsslRMTESToUCS2(RsslRmtesCacheBuffer *pRmtesBuffer, RsslU16Buff
 
 	unsigned char* tempChar;
 	unsigned short tempShort;
+	RsslUInt32 runLength;
 	
 	RsslRmtesWorkingSet curWorkingSet;
 	RsslRmtesCharSet * shiftGL = NULL;
@@ -922,7 +1002,18 @@ RSSL_API RsslRet rsslRMTESToUCS2(RsslRmtesCacheBuffer *pRmtesBuffer, RsslU16Buff
 	{
 		if(encType == TYPE_RMTES)
 		{
-			if(*inIter < 0x20)  /* CL character */
+			/* Widens printable ASCII as is, when the character set in GL leaves it unchanged. */
+			if(shiftGL == NULL && isAsciiCharSet(*curWorkingSet.GL) && (runLength = rmtesPrintableAsciiLength(inIter, endInput)) > 0)
+			{
+				if(runLength > (RsslUInt32)(endOutput - outIter))
+					runLength = (RsslUInt32)(endOutput - outIter);
+
+				for(i = 0; i < (int)runLength; ++i)
+					outIter[i] = (unsigned short)inIter[i];
+				outIter += runLength;
+				inIter += runLength;
+			}
+			else if(*inIter < 0x20)  /* CL character */
 			{
 				if(shiftGL != NULL)
 					return RSSL_RET_FAILURE;
@@ -1180,12 +1271,20 @@ RSSL_API RsslBool rsslHasPartialRMTESUpdate(RsslBuffer *pBuffer)
 		switch(state)
 		{
 			case NORMAL:
-				if(pBuffer->data[i] == ESC_CHAR)
-					state = ESC;
+			{
+				/* Skips to the next escape. */
+				const char *pEsc = (const char*)memchr(pBuffer->data + i, ESC_CHAR, pBuffer->length - i);
+
+				if (pEsc == NULL)
+					return RSSL_FALSE;
+
+				i = (rtrUInt32)(pEsc - pBuffer->data);
+				state = ESC;
 				/* This appears to break in Korean encodings... not sure if it's still valid for current feeds */
 				//else if(pBuffer->data[i] == CSI_CHAR)
 				//	state = LBRKT;
 				break;
+			}
 			case ESC:
 				if(pBuffer->data[i] == LBRKT_CHAR)
 					state = LBRKT;
@@ -1219,7 +1318,7 @@ RSSL_API RsslRet rsslRMTESApplyToCache(RsslBuffer *inBuffer, RsslRmtesCacheBuffe
 	RsslUInt32 inBufPos = 0;
 	RsslUInt32 cacheBufPos = 0;
 	RsslUInt32 numCount = 0;
-	char prevChar;
+	char prevChar = 0;
 	RsslUInt32 escStart;
 	RsslBool escFirst = RSSL_FALSE;
 	RMTESParseState state = NORMAL;
@@ -1259,14 +1358,19 @@ RSSL_API RsslRet rsslRMTESApplyToCache(RsslBuffer *inBuffer, RsslRmtesCacheBuffe
 				}*/
 				else
 				{
-					if(cacheBufPos >= cacheBuf->allocatedLength)
+					/* Copies everything up to the next escape at once. */
+					const char *pEsc = (const char*)memchr(inBuffer->data + inBufPos, ESC_CHAR, inBuffer->length - inBufPos);
+					RsslUInt32 runLength = (pEsc ? (RsslUInt32)(pEsc - inBuffer->data) : inBuffer->length) - inBufPos;
+
+					if(cacheBufPos > cacheBuf->allocatedLength || runLength > cacheBuf->allocatedLength - cacheBufPos)
 					{
 						/*Out of space */
 						return RSSL_RET_BUFFER_TOO_SMALL;
 					}
+					memcpy(cacheBuf->data + cacheBufPos, inBuffer->data + inBufPos, runLength);
+					cacheBufPos += runLength;
+					inBufPos += runLength - 1;
 					prevChar = inBuffer->data[inBufPos];
-					cacheBuf->data[cacheBufPos] = inBuffer->data[inBufPos];
-					cacheBufPos++;
 				}
 				break;
 			case ESC:
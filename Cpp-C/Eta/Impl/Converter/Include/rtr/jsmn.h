@@ -25,20 +25,33 @@ typedef enum {
 	/* The string is not a full JSON packet, more bytes expected */
 	JSMN_ERROR_PART = -3,
 	/* Everything was fine */
-	JSMN_SUCCESS = 0
+	JSMN_SUCCESS = 0,
+	/* One element of the top-level array was parsed (JSMN_FLAG_ARRAY_ELEMENTS only) */
+	JSMN_ELEMENT = 1
 } jsmnerr_t;
 
+/**
+ * Parser flags.
+ * 	o JSMN_FLAG_ARRAY_ELEMENTS: When the JSON text is an array, jsmn_parse returns
+ * 	  JSMN_ELEMENT after each element of the array, so the element can be used before
+ * 	  the rest of the text is parsed. See jsmn_release_element.
+ */
+#define JSMN_FLAG_ARRAY_ELEMENTS 0x1
+
 /**
  * JSON token description.
  * @param		type	type (object, array, string etc.)
  * @param		start	start position in JSON data string
  * @param		end		end position in JSON data string
+ * @param		size	number of child tokens
+ * @param		parent	index of the parent object or array, or -1
  */
 typedef struct {
 	jsmntype_t type;
 	int start;
 	int end;
 	int size;
+	int parent;
 } jsmntok_t;
 
 /**
@@ -50,6 +63,7 @@ typedef struct {
 	unsigned int len; /* len of JSON string */
 	int toknext; /* next token to allocate */
 	int toksuper; /* suporior token node, e.g parent object or array */
+	unsigned int flags; /* JSMN_FLAG_* */
 } jsmn_parser;
 
 /**
@@ -60,8 +74,26 @@ void jsmn_init(jsmn_parser *parser);
 /**
  * Run JSON parser. It parses a JSON data string into and array of tokens, each describing
  * a single JSON object.
+ * If the tokens run out, JSMN_ERROR_NOMEM is returned and the parser can be called again
+ * with a larger copy of the same token array, continuing where it stopped.
  */
 jsmnerr_t jsmn_parse(jsmn_parser *parser, const char *js, unsigned int len,
 		jsmntok_t *tokens, unsigned int num_tokens);
 
+/**
+ * Same as jsmn_parse, but reallocates the token array when it runs out of tokens and
+ * continues parsing. The array grows by its current size, and at least by inc_size tokens.
+ * *tokens must be allocated with malloc. JSMN_ERROR_NOMEM is only returned if the
+ * reallocation fails, in which case *tokens is left unchanged.
+ */
+jsmnerr_t jsmn_parse_grow(jsmn_parser *parser, const char *js, unsigned int len,
+		jsmntok_t **tokens, unsigned int *num_tokens, unsigned int inc_size);
+
+/**
+ * After jsmn_parse returns JSMN_ELEMENT, releases the tokens of the element so that
+ * the next call reuses them for the next element. Only the token of the top-level
+ * array is kept.
+ */
+void jsmn_release_element(jsmn_parser *parser);
+
 #endif /* __JSMN_H_ */
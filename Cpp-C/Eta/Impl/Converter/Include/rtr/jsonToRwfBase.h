@@ -45,6 +45,9 @@ class jsonToRwfBase
 	virtual ~jsonToRwfBase();
 	int decodeJsonMsg(RsslJsonMsg &jsonMsg);
 	int parseJsonBuffer(const RsslBuffer *bufPtr, int offset);
+	// When set, a JSON array of messages is parsed one message at a time, as each is decoded.
+	void setParseArrayElements(RsslBool parseElements)
+	{ _parseArrayElements = parseElements ? true : false; }
 	virtual RsslBuffer* errorText();
 	virtual void reset();
 	void setRsslServiceNameToIdCallback(void *closure, RsslJsonServiceNameToIdCallback *callback)
@@ -65,6 +68,7 @@ class jsonToRwfBase
 	jsmntok_t *_curMsgTok;
 	int _numTokens;
 	int _incSize;
+	jsmn_parser _jsmnParser;
 
 	int _bufSize;
 	RsslEncodeIterator _iter;
@@ -113,6 +117,11 @@ class jsonToRwfBase
 	void *_closure;
 
 	unsigned int _flags;
+	bool _parseArrayElements;
+	bool _arrayPending;	// More elements of the array are still to be parsed
+
+	int parseTokens(unsigned int length);
+
 	// Message Processers
 	bool encodeRsslMsg(RsslMsg *rsslMsgPtr, jsmntok_t ** const msgTok, jsmntok_t *dataTokPtr, jsmntok_t *attribTokPtr, jsmntok_t *reqKeyattrib);
 	virtual bool encodeMsgPayload(RsslMsg *rsslMsgPtr, jsmntok_t *dataTokPtr);
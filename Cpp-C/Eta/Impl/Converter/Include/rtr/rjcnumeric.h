@@ -0,0 +1,47 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2022 Refinitiv. All rights reserved.              --
+ *|-----------------------------------------------------------------------------
+ */
+
+
+#ifndef __RJC_NUMERIC
+#define __RJC_NUMERIC
+
+#include "rtr/rsslTypes.h"
+
+// Synopsis:
+// #include"rtr/rjcnumeric.h"
+//
+// Description:
+//	Number formatting for the RWF to JSON conversion, without the locale handling
+//	and format parsing of the printf family.
+//
+//	Each function writes to str, which must have room for RJC_MAX_NUMERIC_STRING_LEN
+//	characters, and returns the number of characters written. The string is not
+//	null-terminated.
+//
+
+/* Largest number of characters written by the functions below. */
+#define RJC_MAX_NUMERIC_STRING_LEN 32
+
+/* Writes the shortest decimal string that reads back as the same double.
+ * Values with a decimal exponent below -4 or above 14 are written in exponent form
+ * (e.g. 1.5E+20), as the "%G" format does. The value must not be Inf or NaN. */
+int rjcDoubleToString(char *str, RsslDouble value);
+
+/* Writes the shortest decimal string that reads back as the same float.
+ * Values with a decimal exponent below -4 or above 5 are written in exponent form.
+ * The value must not be Inf or NaN. */
+int rjcFloatToString(char *str, RsslFloat value);
+
+/* Writes the exact decimal value of an RsslReal, from its value and hint.
+ * Exponent hints are written the same as rsslRealToString() writes them (e.g. 12.30
+ * for 1230 with RSSL_RH_EXPONENT_2). Fraction hints are written as a decimal number,
+ * e.g. 1.375 for 11 with RSSL_RH_FRACTION_8. The hint must not be larger than
+ * RSSL_RH_MAX_DIVISOR. */
+int rjcRealToString(char *str, RsslInt64 value, RsslUInt8 hint);
+
+#endif
@@ -18,6 +18,7 @@ RSSL_VA_API RsslBuffer *rsslTunnelStreamGetBuffer(RsslTunnelStream *pTunnel,
 	TunnelStreamImpl	*pTunnelImpl;
 	TunnelBufferImpl	*pBufferImpl;
 	RsslReactorImpl		*pReactorImpl;
+	RsslReactorShardImpl	*pShard;
 
 	if (pTunnel == NULL)
 	{
@@ -36,18 +37,19 @@ RSSL_VA_API RsslBuffer *rsslTunnelStreamGetBuffer(RsslTunnelStream *pTunnel,
 
 	pTunnelImpl = (TunnelStreamImpl*)pTunnel;
 	pReactorImpl = (RsslReactorImpl*)pTunnelImpl->_manager->_pParentReactor;
+	pShard = ((RsslReactorChannelImpl*)pTunnelImpl->_manager->base._pReactorChannel)->pShard;
 
-	if (reactorLockInterface(pReactorImpl, RSSL_TRUE, pErrorInfo) != RSSL_RET_SUCCESS)
+	if (reactorLockShard(pShard, RSSL_TRUE, pErrorInfo) != RSSL_RET_SUCCESS)
 		return NULL;
 
 	if (pReactorImpl->state != RSSL_REACTOR_ST_ACTIVE)
 	{
 		rsslSetErrorInfo(pErrorInfo, RSSL_EIC_SHUTDOWN, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "Reactor is shutting down.");
-		return (reactorUnlockInterface(pReactorImpl), NULL);
+		return (reactorUnlockShard(pShard), NULL);
 	}
 
 	pBufferImpl = tunnelStreamGetBuffer(pTunnelImpl, pRsslTunnelStreamGetBufferOptions->size, RSSL_TRUE, RSSL_FALSE, pErrorInfo);
-	return (reactorUnlockInterface(pReactorImpl), (RsslBuffer*)pBufferImpl);
+	return (reactorUnlockShard(pShard), (RsslBuffer*)pBufferImpl);
 }
 
 RSSL_VA_API RsslRet rsslTunnelStreamReleaseBuffer(RsslBuffer *pBuffer, RsslErrorInfo *pErrorInfo)
@@ -55,6 +57,7 @@ RSSL_VA_API RsslRet rsslTunnelStreamReleaseBuffer(RsslBuffer *pBuffer, RsslError
 	TunnelBufferImpl	*pBufferImpl;
 	TunnelStreamImpl	*pTunnelImpl;
 	RsslReactorImpl		*pReactorImpl;
+	RsslReactorShardImpl	*pShard;
 	RsslRet ret;
 
 	if (pBuffer == NULL)
@@ -69,25 +72,27 @@ RSSL_VA_API RsslRet rsslTunnelStreamReleaseBuffer(RsslBuffer *pBuffer, RsslError
 	pBufferImpl = (TunnelBufferImpl*)pBuffer;
 	pTunnelImpl = (TunnelStreamImpl*)pBufferImpl->_tunnel;
 	pReactorImpl = (RsslReactorImpl*)pTunnelImpl->_manager->_pParentReactor;
+	pShard = ((RsslReactorChannelImpl*)pTunnelImpl->_manager->base._pReactorChannel)->pShard;
 
-	if ((ret = reactorLockInterface(pReactorImpl, RSSL_TRUE, pErrorInfo)) != RSSL_RET_SUCCESS)
+	if ((ret = reactorLockShard(pShard, RSSL_TRUE, pErrorInfo)) != RSSL_RET_SUCCESS)
 		return ret;
 
 	if (pReactorImpl->state != RSSL_REACTOR_ST_ACTIVE)
 	{
 		rsslSetErrorInfo(pErrorInfo, RSSL_EIC_SHUTDOWN, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "Reactor is shutting down.");
-		return (reactorUnlockInterface(pReactorImpl), RSSL_RET_FAILURE);
+		return (reactorUnlockShard(pShard), RSSL_RET_FAILURE);
 	}
 
 	tunnelStreamReleaseBuffer(pTunnelImpl, pBufferImpl);
 
-	return (reactorUnlockInterface(pReactorImpl), RSSL_RET_SUCCESS);
+	return (reactorUnlockShard(pShard), RSSL_RET_SUCCESS);
 }
 
 RSSL_VA_API RsslRet rsslTunnelStreamGetInfo(RsslTunnelStream *pTunnel, RsslTunnelStreamInfo *pInfo, RsslErrorInfo *pErrorInfo)
 {
 	TunnelStreamImpl	*pTunnelImpl;
 	RsslReactorImpl		*pReactorImpl;
+	RsslReactorShardImpl	*pShard;
 	RsslRet ret;
 
 	if (pErrorInfo == NULL)
@@ -107,18 +112,19 @@ RSSL_VA_API RsslRet rsslTunnelStreamGetInfo(RsslTunnelStream *pTunnel, RsslTunne
 
 	pTunnelImpl = (TunnelStreamImpl*)pTunnel;
 	pReactorImpl = (RsslReactorImpl*)pTunnelImpl->_manager->_pParentReactor;
+	pShard = ((RsslReactorChannelImpl*)pTunnelImpl->_manager->base._pReactorChannel)->pShard;
 
-	if ((ret = reactorLockInterface(pReactorImpl, RSSL_TRUE, pErrorInfo)) != RSSL_RET_SUCCESS)
+	if ((ret = reactorLockShard(pShard, RSSL_TRUE, pErrorInfo)) != RSSL_RET_SUCCESS)
 		return ret;
 
 	if (pReactorImpl->state != RSSL_REACTOR_ST_ACTIVE)
 	{
 		rsslSetErrorInfo(pErrorInfo, RSSL_EIC_SHUTDOWN, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "Reactor is shutting down.");
-		return (reactorUnlockInterface(pReactorImpl), RSSL_RET_FAILURE);
+		return (reactorUnlockShard(pShard), RSSL_RET_FAILURE);
 	}
 
 	rsslClearTunnelStreamInfo(pInfo);
 	ret = tunnelStreamGetInfo(pTunnelImpl, pInfo, pErrorInfo);
 
-	return (reactorUnlockInterface(pReactorImpl), ret);
+	return (reactorUnlockShard(pShard), ret);
 }
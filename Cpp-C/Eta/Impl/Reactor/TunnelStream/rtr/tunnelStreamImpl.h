@@ -320,7 +320,7 @@ RTR_C_INLINE RsslBuffer *tunnelStreamGetMemoryHeapBuffer(TunnelStreamImpl *pTunn
 
 RTR_C_INLINE RsslInt64 tunnelStreamGetCurrentTimeMs(TunnelStreamImpl *pTunnel)
 {
-	return ((RsslReactorImpl*)pTunnel->_manager->_pParentReactor)->lastRecordedTimeMs;
+	return ((RsslReactorChannelImpl*)pTunnel->_manager->base._pReactorChannel)->pShard->lastRecordedTimeMs;
 }
 
 RTR_C_INLINE void tunnelStreamUnsetHasExpireTime(TunnelStreamImpl *pTunnelImpl)
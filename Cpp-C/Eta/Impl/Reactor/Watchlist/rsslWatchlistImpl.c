@@ -46,6 +46,8 @@ RsslWatchlist *rsslWatchlistCreate(RsslWatchlistCreateOptions *pCreateOptions,
 	baseInitOpts.maxOutstandingPosts = pCreateOptions->maxOutstandingPosts;
 	baseInitOpts.postAckTimeout = pCreateOptions->postAckTimeout;
 	baseInitOpts.enableWarmStandBy = pCreateOptions->enableWarmStandby;
+	baseInitOpts.enableViewFiltering = pCreateOptions->enableViewFiltering;
+	baseInitOpts.enableDistinctFanoutBuffers = pCreateOptions->enableDistinctFanoutBuffers;
 
 	if (baseInitOpts.enableWarmStandBy)
 	{
@@ -116,6 +118,12 @@ RsslRet rsslWatchlistSetChannel(RsslWatchlist *pWatchlist, RsslChannel *pChannel
 		return wlRecoverAllItems(pWatchlistImpl, pErrorInfo);
 	}
 
+	/* Multicast item streams are matched by the hash IDs that providers send, which are
+	 * calculated with rsslMsgKeyHash(). Other channels can use the faster hash. */
+	rsslHashTableSetHashFunction(&pWatchlistImpl->base.openStreamsByAttrib,
+			pChannel->connectionType == RSSL_CONN_TYPE_RELIABLE_MCAST ? 
+			wlStreamAttributesHashSum : wlStreamAttributesFastHashSum);
+
 	return RSSL_RET_SUCCESS;
 }
 
@@ -413,6 +421,7 @@ RsslRet rsslWatchlistDispatch(RsslWatchlist *pWatchlist, RsslInt64 currentTime,
 					wlStreamInfoClear(&streamInfo);
 					msgEvent.pStreamInfo = &streamInfo;
 					streamInfo.pUserSpec = pItemRequest->base.pUserSpec;
+					streamInfo.streamId = pItemRequest->base.streamId;
 
 					if (pItemRequest->pRequestedService->flags & WL_RSVC_HAS_NAME)
 						streamInfo.pServiceName = &pItemRequest->pRequestedService->serviceName;
@@ -910,6 +919,7 @@ RsslRet rsslWatchlistProcessTimer(RsslWatchlist *pWatchlist, RsslInt64 currentTi
 			RsslWatchlistStreamInfo streamInfo;
 			wlStreamInfoClear(&streamInfo);
 			streamInfo.pUserSpec = pRequest->base.pUserSpec;
+			streamInfo.streamId = pRequest->base.streamId;
 			msgEvent.pStreamInfo = &streamInfo;
 
 			if ((ret = (*pWatchlistImpl->base.config.msgCallback)
@@ -1217,7 +1227,6 @@ static RsslRet wlServiceStateChangeCallback(WlServiceCache *pServiceCache,
 	RsslReactorWarmStandbyGroupImpl *pReactorWarmStandByGroupImpl = &pReactorWarmStandByHandlerImpl->warmStandbyGroupList[pReactorWarmStandByHandlerImpl->currentWSyGroupIndex];
 	RsslHashLink *pHashLink = NULL;
 	RsslWatchlistImpl			*pWatchlistImpl = (RsslWatchlistImpl*)pWatchlist;
-	RsslReactorImpl *pReactorImpl = pReactorChannelImpl->pParentReactor;
 	RsslErrorInfo errorInfo;
 
 	if (_reactorHandlesWarmStandby(pReactorChannelImpl))
@@ -1234,7 +1243,7 @@ static RsslRet wlServiceStateChangeCallback(WlServiceCache *pServiceCache,
 				if (pCachedService->rdm.state.serviceState == 0 && pReactorWarmStandbyServiceImpl->pReactorChannel == (RsslReactorChannel*)pReactorChannelImpl)
 				{
 					/* Submit an event to change the current active service to standby and promote the service from others channel. */
-					RsslReactorWarmStanbyEvent* pEvent = (RsslReactorWarmStanbyEvent*)rsslReactorEventQueueGetFromPool(&pReactorImpl->reactorEventQueue);
+					RsslReactorWarmStanbyEvent* pEvent = (RsslReactorWarmStanbyEvent*)rsslReactorEventQueueGetFromPool(rsslReactorChannelEventQueue(pReactorChannelImpl));
 					rsslClearReactorWarmStanbyEvent(pEvent);
 
 					pEvent->reactorWarmStandByEventType = RSSL_RCIMPL_WSBET_CHANGE_ACTIVE_TO_STANDBY_PER_SERVICE;
@@ -1243,7 +1252,7 @@ static RsslRet wlServiceStateChangeCallback(WlServiceCache *pServiceCache,
 					pEvent->streamID = pWatchlistImpl->directory.pStream->base.streamId;
 					pEvent->pHashLink = pHashLink;
 
-					if (!RSSL_ERROR_INFO_CHECK(rsslReactorEventQueuePut(&pReactorImpl->reactorEventQueue, (RsslReactorEventImpl*)pEvent) == RSSL_RET_SUCCESS, RSSL_RET_FAILURE, &errorInfo))
+					if (!RSSL_ERROR_INFO_CHECK(rsslReactorEventQueuePut(rsslReactorChannelEventQueue(pReactorChannelImpl), (RsslReactorEventImpl*)pEvent) == RSSL_RET_SUCCESS, RSSL_RET_FAILURE, &errorInfo))
 						return RSSL_RET_FAILURE;
 				}
 				else
@@ -1253,7 +1262,7 @@ static RsslRet wlServiceStateChangeCallback(WlServiceCache *pServiceCache,
 					/* Checks whether there is a channel provides the service as active. */
 					if (pCachedService->rdm.state.serviceState == 1 && pReactorWarmStandbyServiceImpl->pReactorChannel == NULL)
 					{
-						RsslReactorWarmStanbyEvent* pEvent = (RsslReactorWarmStanbyEvent*)rsslReactorEventQueueGetFromPool(&pReactorImpl->reactorEventQueue);
+						RsslReactorWarmStanbyEvent* pEvent = (RsslReactorWarmStanbyEvent*)rsslReactorEventQueueGetFromPool(rsslReactorChannelEventQueue(pReactorChannelImpl));
 						rsslClearReactorWarmStanbyEvent(pEvent);
 
 						pEvent->reactorWarmStandByEventType = RSSL_RCIMPL_WSBET_CHANGE_STANDBY_TO_ACTIVE_PER_SERVICE;
@@ -1262,7 +1271,7 @@ static RsslRet wlServiceStateChangeCallback(WlServiceCache *pServiceCache,
 						pEvent->streamID = pWatchlistImpl->directory.pStream->base.streamId;
 						pEvent->pHashLink = pHashLink;
 
-						if (!RSSL_ERROR_INFO_CHECK(rsslReactorEventQueuePut(&pReactorImpl->reactorEventQueue, (RsslReactorEventImpl*)pEvent) == RSSL_RET_SUCCESS, RSSL_RET_FAILURE, &errorInfo))
+						if (!RSSL_ERROR_INFO_CHECK(rsslReactorEventQueuePut(rsslReactorChannelEventQueue(pReactorChannelImpl), (RsslReactorEventImpl*)pEvent) == RSSL_RET_SUCCESS, RSSL_RET_FAILURE, &errorInfo))
 							return RSSL_RET_FAILURE;
 					}
 				}
@@ -1280,7 +1289,7 @@ static RsslRet wlServiceStateChangeCallback(WlServiceCache *pServiceCache,
 				if (pCachedService->rdm.state.serviceState == 1)
 				{
 					/* Submit an event to change the current active service to standby and promote the service from others channel. */
-					RsslReactorWarmStanbyEvent* pEvent = (RsslReactorWarmStanbyEvent*)rsslReactorEventQueueGetFromPool(&pReactorImpl->reactorEventQueue);
+					RsslReactorWarmStanbyEvent* pEvent = (RsslReactorWarmStanbyEvent*)rsslReactorEventQueueGetFromPool(rsslReactorChannelEventQueue(pReactorChannelImpl));
 					rsslClearReactorWarmStanbyEvent(pEvent);
 
 					pEvent->reactorWarmStandByEventType = RSSL_RCIMPL_WSBET_ACTIVE_SERVER_SERVICE_STATE_FROM_DOWN_TO_UP;
@@ -1288,7 +1297,7 @@ static RsslRet wlServiceStateChangeCallback(WlServiceCache *pServiceCache,
 					pEvent->serviceID = pCachedService->rdm.serviceId;
 					pEvent->pHashLink = pHashLink;
 
-					if (!RSSL_ERROR_INFO_CHECK(rsslReactorEventQueuePut(&pReactorImpl->reactorEventQueue, (RsslReactorEventImpl*)pEvent) == RSSL_RET_SUCCESS, RSSL_RET_FAILURE, &errorInfo))
+					if (!RSSL_ERROR_INFO_CHECK(rsslReactorEventQueuePut(rsslReactorChannelEventQueue(pReactorChannelImpl), (RsslReactorEventImpl*)pEvent) == RSSL_RET_SUCCESS, RSSL_RET_FAILURE, &errorInfo))
 						return RSSL_RET_FAILURE;
 				}
 			}
@@ -1318,7 +1327,7 @@ static RsslUInt aggregateServiceStateForWSB(RsslReactorChannelImpl* pUpdatedReac
 
 			if (pProcessReactorChannel != pUpdatedReactorChannel)
 			{
-				if (pProcessReactorChannel->reactorParentQueue == &pProcessReactorChannel->pParentReactor->closingChannels)
+				if (pProcessReactorChannel->reactorParentQueue == &pProcessReactorChannel->pShard->closingChannels)
 				{
 					continue; /* Countinue if this channel is being closed. */
 				}
@@ -1502,7 +1511,7 @@ static RsslRet wlWarmStandbyServiceUpdate(RsslReactorWarmStandbyGroupImpl *pReac
 
 						if (pProcessReactorChannel != pReactorChannelImpl)
 						{
-							if (pProcessReactorChannel->reactorParentQueue == &pProcessReactorChannel->pParentReactor->closingChannels)
+							if (pProcessReactorChannel->reactorParentQueue == &pProcessReactorChannel->pShard->closingChannels)
 							{
 								continue; /* Countinue if this channel is being closed. */
 							}
@@ -1810,7 +1819,7 @@ static RsslRet wlServiceCacheInitCallback(WlServiceCache *pServiceCache, WlServi
 		if ((pReactorChannelImpl->pWarmStandByHandlerImpl->warmStandByHandlerState & RSSL_RWSB_STATE_RECEIVED_PRIMARY_DIRECTORY_RESP) == 0)
 		{
 			/* Submit an event to the Reactor event queue in order to establish standby connections to the secondary servers. */
-			RsslReactorWarmStanbyEvent* pEvent = (RsslReactorWarmStanbyEvent*)rsslReactorEventQueueGetFromPool(&pReactorImpl->reactorEventQueue);
+			RsslReactorWarmStanbyEvent* pEvent = (RsslReactorWarmStanbyEvent*)rsslReactorEventQueueGetFromPool(rsslReactorChannelEventQueue(pReactorChannelImpl));
 			rsslClearReactorWarmStanbyEvent(pEvent);
 
 			/* Update the service cache of the warm standby group. */
@@ -1822,12 +1831,12 @@ static RsslRet wlServiceCacheInitCallback(WlServiceCache *pServiceCache, WlServi
 			pEvent->pReactorChannel = (RsslReactorChannel*)pReactorChannelImpl;
 			pEvent->streamID = pWatchlistImpl->directory.pStream->base.streamId;
 
-			if (!RSSL_ERROR_INFO_CHECK(rsslReactorEventQueuePut(&pReactorImpl->reactorEventQueue, (RsslReactorEventImpl*)pEvent) == RSSL_RET_SUCCESS, RSSL_RET_FAILURE, pError))
+			if (!RSSL_ERROR_INFO_CHECK(rsslReactorEventQueuePut(rsslReactorChannelEventQueue(pReactorChannelImpl), (RsslReactorEventImpl*)pEvent) == RSSL_RET_SUCCESS, RSSL_RET_FAILURE, pError))
 				return RSSL_RET_FAILURE;
 		}
 		else
 		{
-			RsslReactorWarmStanbyEvent* pEvent = (RsslReactorWarmStanbyEvent*)rsslReactorEventQueueGetFromPool(&pReactorImpl->reactorEventQueue);
+			RsslReactorWarmStanbyEvent* pEvent = (RsslReactorWarmStanbyEvent*)rsslReactorEventQueueGetFromPool(rsslReactorChannelEventQueue(pReactorChannelImpl));
 			rsslClearReactorWarmStanbyEvent(pEvent);
 
 			pReactorChannelImpl->pWarmStandByHandlerImpl->warmStandByHandlerState |= RSSL_RWSB_STATE_RECEIVED_SECONDARY_DIRECTORY_RESP;
@@ -1845,7 +1854,7 @@ static RsslRet wlServiceCacheInitCallback(WlServiceCache *pServiceCache, WlServi
 					rsslSetErrorInfo(&pEvent->pReactorErrorInfoImpl->rsslErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "The source directory response from standby server does not match with the primary server.");
 				}
 
-				if (!RSSL_ERROR_INFO_CHECK(rsslReactorEventQueuePut(&pReactorImpl->reactorEventQueue, (RsslReactorEventImpl*)pEvent) == RSSL_RET_SUCCESS, RSSL_RET_FAILURE, pError))
+				if (!RSSL_ERROR_INFO_CHECK(rsslReactorEventQueuePut(rsslReactorChannelEventQueue(pReactorChannelImpl), (RsslReactorEventImpl*)pEvent) == RSSL_RET_SUCCESS, RSSL_RET_FAILURE, pError))
 					return RSSL_RET_FAILURE;
 			}
 			else
@@ -1857,7 +1866,7 @@ static RsslRet wlServiceCacheInitCallback(WlServiceCache *pServiceCache, WlServi
 				pEvent->pReactorChannel = (RsslReactorChannel*)pReactorChannelImpl;
 				pEvent->streamID = pWatchlistImpl->directory.pStream->base.streamId;
 
-				if (!RSSL_ERROR_INFO_CHECK(rsslReactorEventQueuePut(&pReactorImpl->reactorEventQueue, (RsslReactorEventImpl*)pEvent) == RSSL_RET_SUCCESS, RSSL_RET_FAILURE, pError))
+				if (!RSSL_ERROR_INFO_CHECK(rsslReactorEventQueuePut(rsslReactorChannelEventQueue(pReactorChannelImpl), (RsslReactorEventImpl*)pEvent) == RSSL_RET_SUCCESS, RSSL_RET_FAILURE, pError))
 					return RSSL_RET_FAILURE;
 			}
 		}
@@ -1882,7 +1891,7 @@ static RsslRet wlServiceCacheUpdateCallback(WlServiceCache *pServiceCache, WlSer
 		/* Compares the source directory with the starting server. */
 		if (wlWarmStandbyCompareRDMServiceInfo(pReactorWarmStandByGroupImpl, pServiceCache) == RSSL_FALSE)
 		{
-			RsslReactorWarmStanbyEvent* pEvent = (RsslReactorWarmStanbyEvent*)rsslReactorEventQueueGetFromPool(&pReactorImpl->reactorEventQueue);
+			RsslReactorWarmStanbyEvent* pEvent = (RsslReactorWarmStanbyEvent*)rsslReactorEventQueueGetFromPool(rsslReactorChannelEventQueue(pReactorChannelImpl));
 			rsslClearReactorWarmStanbyEvent(pEvent);
 
 			pEvent->reactorWarmStandByEventType = RSSL_RCIMPL_WSBET_REMOVE_SERVER_FROM_WSB_GROUP;
@@ -1895,7 +1904,7 @@ static RsslRet wlServiceCacheUpdateCallback(WlServiceCache *pServiceCache, WlSer
 				rsslSetErrorInfo(&pEvent->pReactorErrorInfoImpl->rsslErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "The source directory response from standby server does not match with the primary server.");
 			}
 
-			if (!RSSL_ERROR_INFO_CHECK(rsslReactorEventQueuePut(&pReactorImpl->reactorEventQueue, (RsslReactorEventImpl*)pEvent) == RSSL_RET_SUCCESS, RSSL_RET_FAILURE, pError))
+			if (!RSSL_ERROR_INFO_CHECK(rsslReactorEventQueuePut(rsslReactorChannelEventQueue(pReactorChannelImpl), (RsslReactorEventImpl*)pEvent) == RSSL_RET_SUCCESS, RSSL_RET_FAILURE, pError))
 				return RSSL_RET_FAILURE;
 		}
 		else
@@ -1905,7 +1914,7 @@ static RsslRet wlServiceCacheUpdateCallback(WlServiceCache *pServiceCache, WlSer
 
 			if (addNewService == RSSL_TRUE)
 			{
-				RsslReactorWarmStanbyEvent* pEvent = (RsslReactorWarmStanbyEvent*)rsslReactorEventQueueGetFromPool(&pReactorImpl->reactorEventQueue);
+				RsslReactorWarmStanbyEvent* pEvent = (RsslReactorWarmStanbyEvent*)rsslReactorEventQueueGetFromPool(rsslReactorChannelEventQueue(pReactorChannelImpl));
 				rsslClearReactorWarmStanbyEvent(pEvent);
 
 				pReactorChannelImpl->pWarmStandByHandlerImpl->warmStandByHandlerState |= RSSL_RWSB_STATE_RECEIVED_SECONDARY_DIRECTORY_RESP;
@@ -1913,7 +1922,7 @@ static RsslRet wlServiceCacheUpdateCallback(WlServiceCache *pServiceCache, WlSer
 				pEvent->pReactorChannel = (RsslReactorChannel*)pReactorChannelImpl;
 				pEvent->streamID = pWatchlistImpl->directory.pStream->base.streamId;
 
-				if (!RSSL_ERROR_INFO_CHECK(rsslReactorEventQueuePut(&pReactorImpl->reactorEventQueue, (RsslReactorEventImpl*)pEvent) == RSSL_RET_SUCCESS, RSSL_RET_FAILURE, pError))
+				if (!RSSL_ERROR_INFO_CHECK(rsslReactorEventQueuePut(rsslReactorChannelEventQueue(pReactorChannelImpl), (RsslReactorEventImpl*)pEvent) == RSSL_RET_SUCCESS, RSSL_RET_FAILURE, pError))
 					return RSSL_RET_FAILURE;
 			}
 		}
@@ -2152,6 +2161,7 @@ RsslRet rsslWatchlistReadMsg(RsslWatchlist *pWatchlist,
 
 				wlStreamInfoClear(&streamInfo);
 				streamInfo.pUserSpec = pLoginRequest->base.pUserSpec;
+				streamInfo.streamId = pLoginRequest->base.streamId;
 				msgEvent.pStreamInfo = &streamInfo;
 
 				/* May be an off-stream post acknowledgement, pass it through. */
@@ -2197,6 +2207,7 @@ RsslRet rsslWatchlistReadMsg(RsslWatchlist *pWatchlist,
 			wlStreamInfoClear(&streamInfo);
 			streamInfo.pServiceName = NULL;
 			streamInfo.pUserSpec = pLoginRequest->base.pUserSpec;
+			streamInfo.streamId = pLoginRequest->base.streamId;
 
 			msgEvent.pRdmMsg = (RsslRDMMsg*)&loginMsg;
 			msgEvent.pStreamInfo = &streamInfo;
@@ -4529,7 +4540,6 @@ static RsslRet wlWriteBuffer(RsslWatchlistImpl *pWatchlistImpl, RsslBuffer *pWri
 	RsslRet ret;
 	RsslUInt32 bytes, uncompBytes;
 	RsslReactorChannelImpl *pReactorChannelImpl = (RsslReactorChannelImpl*)pWatchlistImpl->base.watchlist.pUserSpec;
-	RsslReactorImpl *pReactorImpl = pReactorChannelImpl->pParentReactor;
 	RsslBuffer *pOutputBuffer = pWriteBuffer;
 	RsslBuffer *pMsgBuffer = NULL; /* The buffer to send JSON message to network only. */
 	RsslBool releaseUserBuffer = RSSL_FALSE; /* Release when it writes user's buffer successfully. */
@@ -4541,7 +4551,7 @@ static RsslRet wlWriteBuffer(RsslWatchlistImpl *pWatchlistImpl, RsslBuffer *pWri
 		RsslMsg rsslMsg;
 
 		/* Added checking to ensure that the JSON converter is initialized properly.*/
-		if (pReactorImpl->pJsonConverter == 0)
+		if (pReactorChannelImpl->pShard->pJsonConverter == 0)
 		{
 			rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "The JSON converter library has not been initialized.");
 			return RSSL_RET_FAILURE;
@@ -4565,7 +4575,7 @@ static RsslRet wlWriteBuffer(RsslWatchlistImpl *pWatchlistImpl, RsslBuffer *pWri
 
 			rsslClearConvertRsslMsgToJsonOptions(&rjcOptions);
 			rjcOptions.jsonProtocolType = RSSL_JSON_JPT_JSON2; /* Supported only for Simplified JSON */
-			if ((rsslConvertRsslMsgToJson(pReactorImpl->pJsonConverter, &rjcOptions, &rsslMsg, &rjcError)) != RSSL_RET_SUCCESS)
+			if ((rsslConvertRsslMsgToJson(pReactorChannelImpl->pShard->pJsonConverter, &rjcOptions, &rsslMsg, &rjcError)) != RSSL_RET_SUCCESS)
 			{
 				rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__,
 					"Failed to convert RWF to JSON protocol. Error text: %s", rjcError.text);
@@ -4577,7 +4587,7 @@ static RsslRet wlWriteBuffer(RsslWatchlistImpl *pWatchlistImpl, RsslBuffer *pWri
 			getJsonMsgOptions.streamId = rsslMsg.msgBase.streamId;
 			getJsonMsgOptions.isCloseMsg = (rsslMsg.msgBase.msgClass == RSSL_MC_CLOSE) ? RSSL_TRUE : RSSL_FALSE;
 
-			if ((ret = rsslGetConverterJsonMsg(pReactorImpl->pJsonConverter, &getJsonMsgOptions,
+			if ((ret = rsslGetConverterJsonMsg(pReactorChannelImpl->pShard->pJsonConverter, &getJsonMsgOptions,
 				&jsonBuffer, &rjcError)) != RSSL_RET_SUCCESS)
 			{
 				rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__,
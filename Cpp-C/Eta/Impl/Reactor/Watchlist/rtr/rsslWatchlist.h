@@ -29,6 +29,7 @@ struct RsslWatchlistStreamInfo
 {
 	const RsslBuffer	*pServiceName;	/* Service name used to request the item, if any. */
 	void				*pUserSpec;		/* Pointer user provided when requesting this item. */
+	RsslInt32			streamId;		/* Stream ID of the request. */
 };
 
 RTR_C_INLINE void wlStreamInfoClear(RsslWatchlistStreamInfo *pStreamInfo)
@@ -105,6 +106,8 @@ typedef struct
 	RsslInt64					ticksPerMsec;
 	RsslInt32					loginRequestCount;
 	RsslBool					enableWarmStandby;
+	RsslBool					enableViewFiltering;
+	RsslBool					enableDistinctFanoutBuffers;
 } RsslWatchlistCreateOptions;
 
 /* Reactor-facing watchlist structure. */
@@ -112,6 +115,8 @@ struct RsslWatchlist
 {
 	void				*pUserSpec;
 	RsslUInt32			state;
+	RsslUInt			viewFilteredMsgs;		/* Messages filtered to a request's view. */
+	RsslUInt			viewFilteredBytesSaved;	/* Payload bytes removed by view filtering. */
 };
 
 RTR_C_INLINE void rsslWatchlistClearCreateOptions(RsslWatchlistCreateOptions *pOptions)
@@ -48,9 +48,13 @@ typedef struct
 	RsslQos		qos;
 } WlStreamAttributes;
 
-/* Hash sum function for stream attributes. */
+/* Hash sum function for stream attributes. Uses rsslMsgKeyHash(), so that sums match the
+ * hash IDs that multicast providers send. */
 RsslUInt32 wlStreamAttributesHashSum(void *pKey);
 
+/* Faster hash sum function for stream attributes, for channels that do not use hash IDs. */
+RsslUInt32 wlStreamAttributesFastHashSum(void *pKey);
+
 /* Hash comparison function  for stream attributes. */
 RsslBool wlStreamAttributesHashCompare(void *pKey1, void *pKey2);
 
@@ -119,6 +123,8 @@ typedef struct
 	RsslWatchlistMsgCallback	*msgCallback;					/* Callback the watchlist should use to forward messages. */
 	RsslBool					obeyOpenWindow;					/* Whether the watchlist obeys a service's OpenWindow. */
 	RsslUInt32					requestTimeout;					/* Request timeout, in milliseconds. */
+	RsslBool					enableViewFiltering;			/* Whether messages are filtered to each request's view. */
+	RsslBool					enableDistinctFanoutBuffers;	/* Whether each request receives its own copy of an item message. */
 } WlConfig;
 
 /* Represents the state of the current channel session. */
@@ -146,7 +152,7 @@ typedef struct WlBase
 	RsslHashTable		requestedSvcById;		/* Table of requested service ID's. */
 	RsslBuffer			tempDecodeBuffer;		/* Reusable decoding buffer. */
 	RsslBuffer			tempEncodeBuffer;		/* Reusable encoding buffer. */
-	RsslBuffer			tempFanoutBuffer;		/* Reusable fanout buffer. */
+	RsslBuffer			tempFanoutBuffer;		/* Reusable fanout buffer. Used for view filtering and distinct fanout buffers. */
 	RsslHashTable		streamsById;			/* Table of open streams, by Stream ID. */
 	RsslHashTable		requestsByStreamId;		/* Table of requests, by stream ID. */
 	RsslUInt32			channelMaxFragmentSize;	/* Channel's maxFragmentSize. */
@@ -189,6 +195,8 @@ typedef struct
 	RsslUInt32						maxOutstandingPosts;	/* Acknowledgement pool limit. */
 	RsslUInt32						postAckTimeout;			/* Timeout for acks of onstream posts. */
 	RsslBool						enableWarmStandBy;		/* Enables the warm standby feature. */
+	RsslBool						enableViewFiltering;	/* Filters messages to each request's view. */
+	RsslBool						enableDistinctFanoutBuffers;	/* Gives each request its own copy of an item message. */
 } WlBaseInitOptions;
 
 /* Initializes a WlBase structure. */
@@ -10,6 +10,7 @@
 
 #include "rtr/rsslTypes.h"
 #include "rtr/rsslIterators.h"
+#include "rtr/rsslMsg.h"
 #include "rtr/rsslQueue.h"
 #include "rtr/rsslErrorInfo.h"
 
@@ -62,6 +63,10 @@ typedef struct
 	RsslUInt32		elemCount;
 	void			*elemList;
 	char			*nameBuf;			/* Memory that stores names for element list views. */
+	RsslUInt8		*fieldIdBitmap;		/* Field ID list views: one bit per field ID from minFieldId to
+										 * maxFieldId, set if the field is in the view. */
+	RsslFieldId		minFieldId;
+	RsslFieldId		maxFieldId;
 } WlView;
 
 /* Initializes a view structure. Sorts the fields and removes any duplicates or instances
@@ -71,6 +76,26 @@ WlView *wlViewCreate(void *elemList, RsslUInt32 elemCount, RsslUInt viewType,
 
 void wlViewDestroy(WlView *pView);
 
+/* Checks whether a field ID is in a field ID list view. */
+RTR_C_INLINE RsslBool wlViewContainsFieldId(WlView *pView, RsslFieldId fieldId)
+{
+	RsslUInt32 bit;
+
+	if (fieldId < pView->minFieldId || fieldId > pView->maxFieldId)
+		return RSSL_FALSE;
+
+	bit = (RsslUInt32)(fieldId - pView->minFieldId);
+	return (pView->fieldIdBitmap[bit >> 3] & (1 << (bit & 7))) ? RSSL_TRUE : RSSL_FALSE;
+}
+
+/* Encodes a copy of a message whose field list or element list payload has only the entries
+ * in the view, and decodes the copy into pFilteredMsg. The copy is encoded into pBuffer,
+ * which must be kept until pFilteredMsg is no longer used.
+ * pFiltered is set to RSSL_FALSE and pFilteredMsg is not set if the view does not apply to the payload
+ * or no entries were removed. Returns RSSL_RET_BUFFER_TOO_SMALL if pBuffer is too small. */
+RsslRet wlViewFilterMsg(WlView *pView, RsslMsg *pMsg, RsslUInt8 majorVersion, RsslUInt8 minorVersion,
+		RsslBuffer *pBuffer, RsslMsg *pFilteredMsg, RsslBool *pFiltered);
+
 /* If the viewType is RDM_VIEW_TYPE_FIELD_ID_LIST, the aggregate viewElemList will consist of 
  * these.*/
 typedef struct
@@ -6,12 +6,24 @@
 */
 
 #include "rtr/wlBase.h"
+#include "rtr/rsslHashFuncs.h"
 
 RsslUInt32 wlStreamAttributesHashSum(void *pKey)
 {
 	return rsslMsgKeyHash(&((WlStreamAttributes*)pKey)->msgKey);
 }
 
+RsslUInt32 wlStreamAttributesFastHashSum(void *pKey)
+{
+	RsslMsgKey *pMsgKey = &((WlStreamAttributes*)pKey)->msgKey;
+
+	/* Uses the same key members as rsslMsgKeyHash(). */
+	if (pMsgKey->flags & RSSL_MKF_HAS_NAME)
+		return rsslFastHash(pMsgKey->name.data, pMsgKey->name.length, 0);
+
+	return 0;
+}
+
 RsslBool wlStreamAttributesHashCompare(void *pKey1, void *pKey2)
 {
 	WlStreamAttributes *pStreamAttributes1 = (WlStreamAttributes*)pKey1;
@@ -106,11 +118,22 @@ RsslRet wlBaseInit(WlBase *pBase, WlBaseInitOptions *pOpts, RsslErrorInfo *pErro
 		return RSSL_RET_FAILURE;
 	}
 
+	if ((pOpts->enableViewFiltering || pOpts->enableDistinctFanoutBuffers)
+			&& rsslHeapBufferInit(&pBase->tempFanoutBuffer, 16384) != RSSL_RET_SUCCESS)
+	{
+		rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, 
+				"Memory allocation failure.");
+		wlBaseCleanup(pBase);
+		return RSSL_RET_FAILURE;
+	}
+
 	pBase->channelMaxFragmentSize = 0;
 	pBase->pServiceCache = pServiceCache;
 	pBase->config.msgCallback = pOpts->msgCallback;
 	pBase->config.obeyOpenWindow = pOpts->obeyOpenWindow;
 	pBase->config.requestTimeout = pOpts->requestTimeout;
+	pBase->config.enableViewFiltering = pOpts->enableViewFiltering;
+	pBase->config.enableDistinctFanoutBuffers = pOpts->enableDistinctFanoutBuffers;
 	pBase->watchlist.state = 0;
 	pBase->channelState = WL_CHS_START;
 	pBase->pRsslChannel = NULL;
@@ -129,7 +152,9 @@ RsslRet wlBaseInit(WlBase *pBase, WlBaseInitOptions *pOpts, RsslErrorInfo *pErro
 		return ret;
 	}
 
-	if ((ret = rsslHashTableInit(&pBase->openStreamsByAttrib, 100003, wlStreamAttributesHashSum, 
+	/* The hash function is changed to wlStreamAttributesHashSum when the channel is multicast
+	 * (see rsslWatchlistSetChannel). */
+	if ((ret = rsslHashTableInit(&pBase->openStreamsByAttrib, 100003, wlStreamAttributesFastHashSum, 
 			wlStreamAttributesHashCompare, RSSL_TRUE, pErrorInfo)) != RSSL_RET_SUCCESS)
 	{
 		wlBaseCleanup(pBase);
@@ -197,6 +222,7 @@ void wlBaseCleanup(WlBase *pBase)
 	wlServiceCacheDestroy(pBase->pServiceCache);
 	rsslHeapBufferCleanup(&pBase->tempDecodeBuffer);
 	rsslHeapBufferCleanup(&pBase->tempEncodeBuffer);
+	rsslHeapBufferCleanup(&pBase->tempFanoutBuffer);
 	rsslHashTableCleanup(&pBase->requestsByStreamId);
 	rsslHashTableCleanup(&pBase->openStreamsByAttrib);
 	rsslHashTableCleanup(&pBase->streamsById);
@@ -106,6 +106,7 @@ RsslRet wlSendDirectoryMsgToRequest(WlBase *pBase, WlDirectoryRequest *pDirector
 	msgEvent.pStreamInfo = &streamInfo;
 
 	streamInfo.pUserSpec = pDirectoryRequest->base.pUserSpec;
+	streamInfo.streamId = pDirectoryRequest->base.streamId;
 
 	if (pDirectoryMsg)
 		pDirectoryMsg->rdmMsgBase.streamId = pDirectoryRequest->base.streamId;
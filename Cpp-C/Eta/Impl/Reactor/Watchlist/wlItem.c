@@ -7,6 +7,7 @@
 
 #include "rtr/wlItem.h"
 #include "rtr/wlSymbolList.h"
+#include "rtr/rsslHashFuncs.h"
 #include <limits.h>
 
 /* Saves extra item request info, such as encDataBody and extendedHeader. 
@@ -20,7 +21,6 @@ static RsslRet _wlItemRequestSaveExtraInfo(WlItemRequest *pItemRequest, RsslRequ
 
 RsslUInt32 wlProviderRequestHashSum(void *pKey)
 {
-	RsslUInt32 i;
 	RsslUInt32 hashSum = 0;
 	WlItemRequest *pItemRequest = (WlItemRequest*)pKey;
 	RsslMsgKey *pMsgKey = &pItemRequest->msgKey;
@@ -29,22 +29,10 @@ RsslUInt32 wlProviderRequestHashSum(void *pKey)
 		hashSum += pMsgKey->serviceId;
 
 	if (pMsgKey->flags & RSSL_MKF_HAS_NAME)
-	{
-		for(i = 0; i < pMsgKey->name.length; ++i)
-		{
-			hashSum = (hashSum << 4) + (RsslUInt32)pMsgKey->name.data[i];
-			hashSum ^= (hashSum >> 12);
-		}
-	}
+		hashSum = rsslFastHash(pMsgKey->name.data, pMsgKey->name.length, hashSum);
 
 	if (pMsgKey->flags & RSSL_MKF_HAS_ATTRIB)
-	{
-		for(i = 0; i < pMsgKey->encAttrib.length; ++i)
-		{
-			hashSum = (hashSum << 4) + (RsslUInt32)pMsgKey->encAttrib.data[i];
-			hashSum ^= (hashSum >> 12);
-		}
-	}
+		hashSum = rsslFastHash(pMsgKey->encAttrib.data, pMsgKey->encAttrib.length, hashSum);
 
 	return hashSum;
 }
@@ -1411,7 +1399,7 @@ RsslRet wlItemRequestFindStream(WlBase *pBase, WlItems *pItems, WlItemRequest *p
 
 		if (!(pItemRequest->flags & WL_IRQF_PRIVATE))
 		{
-			hashSum = wlStreamAttributesHashSum(&streamAttributes);
+			hashSum = pBase->openStreamsByAttrib.keyHashFunction(&streamAttributes);
 			pHashLink = rsslHashTableFind(&pBase->openStreamsByAttrib,
 					(void*)&streamAttributes, &hashSum);
 		}
@@ -1529,11 +1517,99 @@ static void wlItemRequestAddServiceIdToKey(WlItemRequest *pItemRequest, RsslMsgK
 	}
 }
 
+/* Filters a refresh or update to the request's view, if the stream's view is wider.
+ * Returns the message to deliver: either pRsslMsg or pViewMsg. */
+static RsslMsg *wlItemRequestApplyView(WlBase *pBase, WlItemRequest *pItemRequest,
+		RsslMsg *pRsslMsg, RsslMsg *pViewMsg)
+{
+	WlItemStream *pItemStream = (WlItemStream*)pItemRequest->base.pStream;
+	RsslBuffer buffer;
+	RsslBool filtered;
+	RsslRet ret;
+
+	if (pRsslMsg->msgBase.msgClass != RSSL_MC_REFRESH && pRsslMsg->msgBase.msgClass != RSSL_MC_UPDATE)
+		return pRsslMsg;
+
+	if (!pBase->pRsslChannel || !pBase->tempFanoutBuffer.data)
+		return pRsslMsg;
+
+	/* Nothing to remove if the stream's view is this request's view. */
+	if (pItemStream && (pItemStream->flags & WL_IOSF_VIEWED)
+			&& pItemStream->pAggregateView
+			&& pItemStream->pAggregateView->elemCount == pItemRequest->pView->elemCount)
+		return pRsslMsg;
+
+	while (1)
+	{
+		buffer = pBase->tempFanoutBuffer;
+		ret = wlViewFilterMsg(pItemRequest->pView, pRsslMsg, pBase->pRsslChannel->majorVersion,
+				pBase->pRsslChannel->minorVersion, &buffer, pViewMsg, &filtered);
+
+		if (ret != RSSL_RET_BUFFER_TOO_SMALL)
+			break;
+
+		if (rsslHeapBufferResize(&pBase->tempFanoutBuffer, pBase->tempFanoutBuffer.length * 2, RSSL_FALSE)
+				!= RSSL_RET_SUCCESS)
+			return pRsslMsg;
+	}
+
+	if (!filtered)
+		return pRsslMsg;
+
+	++pBase->watchlist.viewFilteredMsgs;
+	pBase->watchlist.viewFilteredBytesSaved += 
+		pRsslMsg->msgBase.encDataBody.length - pViewMsg->msgBase.encDataBody.length;
+
+	return pViewMsg;
+}
+
+/* Copies the encoded message and writes the request's stream ID into the copy, for applications
+ * that need a distinct encoded buffer per request. Returns the message to deliver: either
+ * pRsslMsg or pCopyMsg. */
+static RsslMsg *wlItemRequestCopyMsg(WlBase *pBase, WlItemRequest *pItemRequest,
+		RsslMsg *pRsslMsg, RsslMsg *pCopyMsg)
+{
+	RsslEncodeIterator eIter;
+	RsslDecodeIterator dIter;
+	RsslBuffer buffer;
+
+	/* Messages generated by the watchlist have no encoded form. */
+	if (!pBase->pRsslChannel || !pBase->tempFanoutBuffer.data 
+			|| pRsslMsg->msgBase.encMsgBuffer.length == 0)
+		return pRsslMsg;
+
+	if (pBase->tempFanoutBuffer.length < pRsslMsg->msgBase.encMsgBuffer.length
+			&& rsslHeapBufferResize(&pBase->tempFanoutBuffer, pRsslMsg->msgBase.encMsgBuffer.length * 2, 
+				RSSL_FALSE) != RSSL_RET_SUCCESS)
+		return pRsslMsg;
+
+	buffer.data = pBase->tempFanoutBuffer.data;
+	buffer.length = pRsslMsg->msgBase.encMsgBuffer.length;
+	memcpy(buffer.data, pRsslMsg->msgBase.encMsgBuffer.data, buffer.length);
+
+	rsslClearEncodeIterator(&eIter);
+	rsslSetEncodeIteratorRWFVersion(&eIter, pBase->pRsslChannel->majorVersion, 
+			pBase->pRsslChannel->minorVersion);
+	rsslSetEncodeIteratorBuffer(&eIter, &buffer);
+	if (rsslReplaceStreamId(&eIter, pItemRequest->base.streamId) != RSSL_RET_SUCCESS)
+		return pRsslMsg;
+
+	rsslClearDecodeIterator(&dIter);
+	rsslSetDecodeIteratorRWFVersion(&dIter, pBase->pRsslChannel->majorVersion, 
+			pBase->pRsslChannel->minorVersion);
+	rsslSetDecodeIteratorBuffer(&dIter, &buffer);
+	rsslClearMsg(pCopyMsg);
+	if (rsslDecodeMsg(&dIter, pCopyMsg) != RSSL_RET_SUCCESS)
+		return pRsslMsg;
+
+	return pCopyMsg;
+}
+
 RsslRet wlItemRequestSendMsgEvent(WlBase *pBase,
 		RsslWatchlistMsgEvent *pEvent, WlItemRequest *pItemRequest, RsslErrorInfo *pErrorInfo)
 {
 	RsslRet ret;
-	RsslMsg rsslMsg, *pRsslMsg;
+	RsslMsg rsslMsg, fanoutMsg, *pOrigRsslMsg;
 	RsslWatchlistStreamInfo streamInfo;
 
 	assert(pEvent->pRsslMsg);
@@ -1541,6 +1617,15 @@ RsslRet wlItemRequestSendMsgEvent(WlBase *pBase,
 
 	pEvent->pRsslMsg->msgBase.streamId = pItemRequest->base.streamId;
 
+	/* All requests on the stream share the decoded message. The filtered message and the copy
+	 * (if enabled) are encoded with the request's stream ID. */
+	pOrigRsslMsg = pEvent->pRsslMsg;
+	if (pBase->config.enableViewFiltering && pItemRequest->pView)
+		pEvent->pRsslMsg = wlItemRequestApplyView(pBase, pItemRequest, pEvent->pRsslMsg, &fanoutMsg);
+
+	if (pBase->config.enableDistinctFanoutBuffers && pEvent->pRsslMsg == pOrigRsslMsg)
+		pEvent->pRsslMsg = wlItemRequestCopyMsg(pBase, pItemRequest, pEvent->pRsslMsg, &fanoutMsg);
+
 	wlStreamInfoClear(&streamInfo);
 	pEvent->pStreamInfo = &streamInfo;
 	if ((pItemRequest->flags & WL_IRQF_PRIVATE) != 0)
@@ -1556,6 +1641,7 @@ RsslRet wlItemRequestSendMsgEvent(WlBase *pBase,
 	}
 
 	streamInfo.pUserSpec = pItemRequest->base.pUserSpec;
+	streamInfo.streamId = pItemRequest->base.streamId;
 
 	if (pItemRequest->pRequestedService->flags & WL_RSVC_HAS_NAME)
 		streamInfo.pServiceName = &pItemRequest->pRequestedService->serviceName;
@@ -1566,11 +1652,13 @@ RsslRet wlItemRequestSendMsgEvent(WlBase *pBase,
 	{
 		if ((ret = (*pBase->config.msgCallback) (&pBase->watchlist, pEvent, pErrorInfo)) 
 				!= RSSL_RET_SUCCESS)
+		{
+			pEvent->pRsslMsg = pOrigRsslMsg;
 			return ret;
+		}
 	}
 	else
 	{
-		pRsslMsg = pEvent->pRsslMsg;
 		pItemRequest->flags |= WL_IRQF_HAS_PROV_KEY;
 
 		/* Add message key if application requested it. */
@@ -1647,10 +1735,13 @@ RsslRet wlItemRequestSendMsgEvent(WlBase *pBase,
 		
 		if ((ret = (*pBase->config.msgCallback) (&pBase->watchlist, pEvent, pErrorInfo)) 
 				!= RSSL_RET_SUCCESS)
+		{
+			pEvent->pRsslMsg = pOrigRsslMsg;
 			return ret;
-		pEvent->pRsslMsg = pRsslMsg;
+		}
 	}
 
+	pEvent->pRsslMsg = pOrigRsslMsg;
 	pEvent->pStreamInfo = NULL;
 
 	return RSSL_RET_SUCCESS;
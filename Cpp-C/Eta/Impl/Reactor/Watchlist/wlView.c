@@ -7,6 +7,10 @@
 
 #include "rtr/wlView.h"
 #include "rtr/rsslArray.h"
+#include "rtr/rsslFieldList.h"
+#include "rtr/rsslElementList.h"
+#include "rtr/rsslMsgDecoders.h"
+#include "rtr/rsslMsgEncoders.h"
 #include "rtr/rsslDataUtils.h"
 #include "rtr/rsslRDM.h"
 #include "rtr/rsslReactorUtils.h"
@@ -479,18 +483,43 @@ WlView *wlViewCreate(void *elemList, RsslUInt32 elemCount, RsslUInt viewType,
 			int i;
 			int startingCount;
 			int nextValidPos = 1;
+			RsslFieldId minFieldId = 0, maxFieldId = -1;
+			RsslUInt32 bitmapLength = 0;
 
-			WlView *pView = (WlView*)malloc(sizeof(WlView) + sizeof(RsslFieldId) * elemCount);
-			RsslFieldId *viewFieldIdList = (RsslFieldId*)((char*)pView + sizeof(WlView));
+			WlView *pView;
+			RsslFieldId *viewFieldIdList;
+
+			/* Size the field ID bitmap to the range of the view's fields. */
+			for (ui = 0; ui < elemCount; ++ui)
+			{
+				if (ui == 0 || fieldIdList[ui] < minFieldId) minFieldId = fieldIdList[ui];
+				if (ui == 0 || fieldIdList[ui] > maxFieldId) maxFieldId = fieldIdList[ui];
+			}
+
+			if (elemCount)
+				bitmapLength = ((RsslUInt32)(maxFieldId - minFieldId) >> 3) + 1;
+
+			pView = (WlView*)malloc(sizeof(WlView) + sizeof(RsslFieldId) * elemCount + bitmapLength);
 			verify_malloc(pView, pErrorInfo, NULL);
+			viewFieldIdList = (RsslFieldId*)((char*)pView + sizeof(WlView));
 
 			pView->viewType = RDM_VIEW_TYPE_FIELD_ID_LIST;
 			pView->elemCount = elemCount;
 			pView->elemList = (void*)viewFieldIdList;
 			pView->nameBuf = NULL;
 			pView->pParentQueue = NULL;
+			pView->fieldIdBitmap = (RsslUInt8*)(viewFieldIdList + elemCount);
+			pView->minFieldId = minFieldId;
+			pView->maxFieldId = maxFieldId;
 
 			memcpy(viewFieldIdList, fieldIdList, elemCount * sizeof(RsslFieldId));
+			memset(pView->fieldIdBitmap, 0, bitmapLength);
+
+			for (ui = 0; ui < elemCount; ++ui)
+			{
+				RsslUInt32 bit = (RsslUInt32)(fieldIdList[ui] - minFieldId);
+				pView->fieldIdBitmap[bit >> 3] |= (RsslUInt8)(1 << (bit & 7));
+			}
 
 			qsort(viewFieldIdList, pView->elemCount, sizeof(RsslFieldId), wlaCompareFieldId);
 
@@ -514,6 +543,9 @@ WlView *wlViewCreate(void *elemList, RsslUInt32 elemCount, RsslUInt viewType,
 			pView->elemList = NULL;
 			pView->elemCount = 0;
 			pView->nameBuf = NULL;
+			pView->fieldIdBitmap = NULL;
+			pView->minFieldId = 0;
+			pView->maxFieldId = -1;
 			return pView;
 		}
 	}
@@ -541,6 +573,9 @@ WlView *wlViewCreate(void *elemList, RsslUInt32 elemCount, RsslUInt viewType,
 			pView->elemCount = elemCount;
 			pView->elemList = (void*)viewNameList;
 			pView->pParentQueue = NULL;
+			pView->fieldIdBitmap = NULL;
+			pView->minFieldId = 0;
+			pView->maxFieldId = -1;
 
 			memcpy(viewNameList, nameList, elemCount * sizeof(RsslBuffer));
 
@@ -589,6 +624,9 @@ WlView *wlViewCreate(void *elemList, RsslUInt32 elemCount, RsslUInt viewType,
 			pView->elemList = NULL;
 			pView->elemCount = 0;
 			pView->nameBuf = NULL;
+			pView->fieldIdBitmap = NULL;
+			pView->minFieldId = 0;
+			pView->maxFieldId = -1;
 			return pView;
 		}
 	}
@@ -967,3 +1005,146 @@ void wlAggregateViewCommitViews(WlAggregateView *pAggView)
 	}
 
 }
+
+RsslRet wlViewFilterMsg(WlView *pView, RsslMsg *pMsg, RsslUInt8 majorVersion, RsslUInt8 minorVersion,
+		RsslBuffer *pBuffer, RsslMsg *pFilteredMsg, RsslBool *pFiltered)
+{
+	RsslDecodeIterator dIter;
+	RsslEncodeIterator eIter;
+	RsslBuffer encodedBuffer;
+	RsslMsg msg;
+	RsslUInt32 removedCount = 0;
+	RsslRet ret;
+
+	*pFiltered = RSSL_FALSE;
+
+	if (pView->elemCount == 0)
+		return RSSL_RET_SUCCESS;
+
+	switch(pView->viewType)
+	{
+		case RDM_VIEW_TYPE_FIELD_ID_LIST:
+			if (pMsg->msgBase.containerType != RSSL_DT_FIELD_LIST)
+				return RSSL_RET_SUCCESS;
+			break;
+
+		case RDM_VIEW_TYPE_ELEMENT_NAME_LIST:
+			if (pMsg->msgBase.containerType != RSSL_DT_ELEMENT_LIST)
+				return RSSL_RET_SUCCESS;
+			break;
+
+		default:
+			return RSSL_RET_SUCCESS;
+	}
+
+	if (pMsg->msgBase.encDataBody.length == 0)
+		return RSSL_RET_SUCCESS;
+
+	/* Encode the same header, then copy the payload entries that are in the view. */
+	msg = *pMsg;
+	rsslClearEncodeIterator(&eIter);
+	rsslSetEncodeIteratorRWFVersion(&eIter, majorVersion, minorVersion);
+	rsslSetEncodeIteratorBuffer(&eIter, pBuffer);
+
+	if ((ret = rsslEncodeMsgInit(&eIter, &msg, 0)) != RSSL_RET_ENCODE_CONTAINER)
+		return ret == RSSL_RET_BUFFER_TOO_SMALL ? ret : RSSL_RET_SUCCESS;
+
+	rsslClearDecodeIterator(&dIter);
+	rsslSetDecodeIteratorRWFVersion(&dIter, majorVersion, minorVersion);
+	rsslSetDecodeIteratorBuffer(&dIter, &pMsg->msgBase.encDataBody);
+
+	if (pView->viewType == RDM_VIEW_TYPE_FIELD_ID_LIST)
+	{
+		RsslFieldList fieldList, filteredFieldList;
+		RsslFieldEntry fieldEntry;
+
+		/* Set-defined data is left as it is. */
+		if (rsslDecodeFieldList(&dIter, &fieldList, NULL) != RSSL_RET_SUCCESS
+				|| (fieldList.flags & RSSL_FLF_HAS_SET_DATA))
+			return RSSL_RET_SUCCESS;
+
+		rsslClearFieldList(&filteredFieldList);
+		filteredFieldList.flags = (fieldList.flags & RSSL_FLF_HAS_FIELD_LIST_INFO) | RSSL_FLF_HAS_STANDARD_DATA;
+		filteredFieldList.dictionaryId = fieldList.dictionaryId;
+		filteredFieldList.fieldListNum = fieldList.fieldListNum;
+
+		if ((ret = rsslEncodeFieldListInit(&eIter, &filteredFieldList, NULL, 0)) < RSSL_RET_SUCCESS)
+			return ret == RSSL_RET_BUFFER_TOO_SMALL ? ret : RSSL_RET_SUCCESS;
+
+		while ((ret = rsslDecodeFieldEntry(&dIter, &fieldEntry)) != RSSL_RET_END_OF_CONTAINER)
+		{
+			if (ret < RSSL_RET_SUCCESS)
+				return RSSL_RET_SUCCESS;
+
+			if (!wlViewContainsFieldId(pView, fieldEntry.fieldId))
+			{
+				++removedCount;
+				continue;
+			}
+
+			if ((ret = rsslEncodeFieldEntry(&eIter, &fieldEntry, NULL)) < RSSL_RET_SUCCESS)
+				return ret == RSSL_RET_BUFFER_TOO_SMALL ? ret : RSSL_RET_SUCCESS;
+		}
+
+		if (removedCount == 0)
+			return RSSL_RET_SUCCESS;
+
+		if ((ret = rsslEncodeFieldListComplete(&eIter, RSSL_TRUE)) < RSSL_RET_SUCCESS)
+			return ret == RSSL_RET_BUFFER_TOO_SMALL ? ret : RSSL_RET_SUCCESS;
+	}
+	else
+	{
+		RsslElementList elementList, filteredElementList;
+		RsslElementEntry elementEntry;
+
+		if (rsslDecodeElementList(&dIter, &elementList, NULL) != RSSL_RET_SUCCESS
+				|| (elementList.flags & RSSL_ELF_HAS_SET_DATA))
+			return RSSL_RET_SUCCESS;
+
+		rsslClearElementList(&filteredElementList);
+		filteredElementList.flags = (elementList.flags & RSSL_ELF_HAS_ELEMENT_LIST_INFO) | RSSL_ELF_HAS_STANDARD_DATA;
+		filteredElementList.elementListNum = elementList.elementListNum;
+
+		if ((ret = rsslEncodeElementListInit(&eIter, &filteredElementList, NULL, 0)) < RSSL_RET_SUCCESS)
+			return ret == RSSL_RET_BUFFER_TOO_SMALL ? ret : RSSL_RET_SUCCESS;
+
+		while ((ret = rsslDecodeElementEntry(&dIter, &elementEntry)) != RSSL_RET_END_OF_CONTAINER)
+		{
+			if (ret < RSSL_RET_SUCCESS)
+				return RSSL_RET_SUCCESS;
+
+			if (!bsearch(&elementEntry.name, pView->elemList, pView->elemCount, sizeof(RsslBuffer), wlaCompareName))
+			{
+				++removedCount;
+				continue;
+			}
+
+			if ((ret = rsslEncodeElementEntry(&eIter, &elementEntry, NULL)) < RSSL_RET_SUCCESS)
+				return ret == RSSL_RET_BUFFER_TOO_SMALL ? ret : RSSL_RET_SUCCESS;
+		}
+
+		if (removedCount == 0)
+			return RSSL_RET_SUCCESS;
+
+		if ((ret = rsslEncodeElementListComplete(&eIter, RSSL_TRUE)) < RSSL_RET_SUCCESS)
+			return ret == RSSL_RET_BUFFER_TOO_SMALL ? ret : RSSL_RET_SUCCESS;
+	}
+
+	if ((ret = rsslEncodeMsgComplete(&eIter, RSSL_TRUE)) < RSSL_RET_SUCCESS)
+		return ret == RSSL_RET_BUFFER_TOO_SMALL ? ret : RSSL_RET_SUCCESS;
+
+	/* Decode the copy, so that its encoded message buffer and payload match. */
+	encodedBuffer.data = pBuffer->data;
+	encodedBuffer.length = rsslGetEncodedBufferLength(&eIter);
+
+	rsslClearDecodeIterator(&dIter);
+	rsslSetDecodeIteratorRWFVersion(&dIter, majorVersion, minorVersion);
+	rsslSetDecodeIteratorBuffer(&dIter, &encodedBuffer);
+
+	rsslClearMsg(pFilteredMsg);
+	if (rsslDecodeMsg(&dIter, pFilteredMsg) != RSSL_RET_SUCCESS)
+		return RSSL_RET_SUCCESS;
+
+	*pFiltered = RSSL_TRUE;
+	return RSSL_RET_SUCCESS;
+}
@@ -11,6 +11,7 @@
 #include "rtr/rsslWatchlistImpl.h"
 #include "rtr/tunnelStreamImpl.h"
 #include "rtr/msgQueueEncDec.h"
+#include "rtr/platform.h"
 
 #include <assert.h>
 #include <stdint.h>
@@ -28,11 +29,34 @@
 
 RsslBuffer PONG_MESSAGE = { 15, (char*)"{\"Type\":\"Pong\"}" };
 
+/* Dispatch shards need to know which shard the calling thread holds, which takes thread local storage. */
+#if !defined(_RDEV_NO_TLS_) && (defined(Linux) || defined(_WIN32))
+#define RSSL_REACTOR_DISPATCH_SHARDS
+static DEV_THREAD_LOCAL char reactorThreadId;
+#define RSSL_REACTOR_THREAD ((void*)&reactorThreadId)
+#endif
+
+/* Returns the shard that the calling thread has locked, or NULL if it holds none. A thread holding shard 0 and
+ * another shard is working for the other one. */
+static RsslReactorShardImpl *_reactorHeldShard(RsslReactorImpl *pReactorImpl)
+{
+#ifdef RSSL_REACTOR_DISPATCH_SHARDS
+	RsslUInt32 i;
+
+	for (i = pReactorImpl->shardCount; i > 0; --i)
+	{
+		if (pReactorImpl->pShards[i - 1].pLockThread == RSSL_REACTOR_THREAD)
+			return &pReactorImpl->pShards[i - 1];
+	}
+#endif
+	return NULL;
+}
+
 /* Moves a RsslReactorChannelImpl from whatever list it's on to the given list and changes its state. */
 static void _reactorMoveChannel(RsslQueue *pNewList, RsslReactorChannelImpl *pReactorChannel);
 
 /* Removes a RsslReactorChannelImpl from whatever list its on and returns it */
-static RsslReactorChannelImpl* _reactorTakeChannel(RsslReactorImpl *pReactorImpl, RsslQueue *pList);
+static RsslReactorChannelImpl* _reactorTakeChannel(RsslReactorShardImpl *pShard);
 
 /*** Reader helper functions ***/
 
@@ -59,6 +83,8 @@ static RsslRet _reactorCleanupReactor(RsslReactorImpl *pReactorImpl);
 
 /* Requests that the worker begin flushing for the given channel. */
 static RsslRet _reactorSendFlushRequest(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel, RsslErrorInfo *pError);
+static RsslRet _reactorFlush(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel, RsslErrorInfo *pError);
+static RsslRet _reactorFlushWatchlist(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel, RsslErrorInfo *pError);
 
 /* Adds channel info to reactor list and signals worker to initialize it. Used by both rsslReactorConnect & rsslReactorAccept */
 static RsslRet _reactorAddChannel(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel, RsslErrorInfo *pError);
@@ -178,7 +204,7 @@ static RsslRet _reactorSendJSONMessage(RsslReactorImpl *pReactorImpl, RsslReacto
 
 	rsslClearReactorSubmitOptions(&submitOpts);
 
-	if (pReactorChannel->reactorParentQueue != &pReactorImpl->activeChannels)
+	if (pReactorChannel->reactorParentQueue != &pReactorChannel->pShard->activeChannels)
 	{
 		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Channel is not active.");
 		return RSSL_RET_FAILURE;
@@ -222,7 +248,10 @@ static RsslRet _reactorSendJSONMessage(RsslReactorImpl *pReactorImpl, RsslReacto
 
 	if (pReactorChannel->writeRet > 0)
 	{
-		ret =  _reactorSendFlushRequest(pReactorImpl, pReactorChannel, pError);
+		if (ret == RSSL_RET_WRITE_CALL_AGAIN)
+			ret =  _reactorSendFlushRequest(pReactorImpl, pReactorChannel, pError);
+		else
+			ret =  _reactorFlush(pReactorImpl, pReactorChannel, pError);
 	}
 
 	if (ret != RSSL_RET_SUCCESS)
@@ -265,7 +294,7 @@ static RsslRet _reactorSubmit(RsslReactorImpl *pReactorImpl, RsslReactorChannelI
 
 static void _reactorMoveChannel(RsslQueue *pNewList, RsslReactorChannelImpl *pReactorChannel)
 { 
-	if (pNewList == &pReactorChannel->pParentReactor->channelPool)
+	if (pNewList == &pReactorChannel->pShard->channelPool)
 	{
 		_rsslCleanUpPackedBufferHashTable(pReactorChannel);
 	}
@@ -274,6 +303,14 @@ static void _reactorMoveChannel(RsslQueue *pNewList, RsslReactorChannelImpl *pRe
 	{
 		rsslQueueRemoveLink(pReactorChannel->reactorParentQueue, &pReactorChannel->reactorQueueLink);
 		rsslInitQueueLink(&pReactorChannel->reactorQueueLink);
+
+		/* A channel that is no longer active is not read from, so it cannot be ready or time out. */
+		if (pReactorChannel->reactorParentQueue == &pReactorChannel->pShard->activeChannels)
+		{
+			if (rsslQueueLinkInAList(&pReactorChannel->readyLink))
+				rsslQueueRemoveLink(&pReactorChannel->pShard->readyChannels, &pReactorChannel->readyLink);
+			rsslTimerWheelCancel(&pReactorChannel->pShard->pingTimeoutWheel, &pReactorChannel->pingTimeoutTimer);
+		}
 	}
 
 	pReactorChannel->reactorParentQueue = pNewList; 
@@ -282,9 +319,30 @@ static void _reactorMoveChannel(RsslQueue *pNewList, RsslReactorChannelImpl *pRe
 		rsslQueueAddLinkToBack(pNewList, &pReactorChannel->reactorQueueLink);
 }
 
-static RsslReactorChannelImpl* _reactorTakeChannel(RsslReactorImpl *pReactorImpl, RsslQueue *pList)
+/* Adds an active channel to the list of channels to read from, if it is not already there. */
+RTR_C_INLINE void _reactorAddReadyChannel(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel)
+{
+	if (!rsslQueueLinkInAList(&pReactorChannel->readyLink))
+		rsslQueueAddLinkToBack(&pReactorChannel->pShard->readyChannels, &pReactorChannel->readyLink);
+}
+
+/* Sets the timer for checking whether an active channel has passed its ping timeout. */
+RTR_C_INLINE void _reactorSetPingTimeoutTimer(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel)
+{
+	RsslInt64 expireTime = pReactorChannel->lastPingReadMs + (RsslInt64)pReactorChannel->reactorChannel.pRsslChannel->pingTimeout * 1000 + 1;
+
+	/* The timeout is not reached while the channel still has data to read, so check it again later. */
+	if (expireTime <= pReactorChannel->pShard->lastRecordedTimeMs)
+		expireTime = pReactorChannel->pShard->lastRecordedTimeMs + 1;
+
+	rsslTimerWheelAdd(&pReactorChannel->pShard->pingTimeoutWheel, &pReactorChannel->pingTimeoutTimer, expireTime);
+}
+
+/* Takes a channel from the shard's pool, so that its event queue belongs to the shard's queue group. */
+static RsslReactorChannelImpl* _reactorTakeChannel(RsslReactorShardImpl *pShard)
 {
-	RsslQueueLink *pLink = rsslQueueRemoveFirstLink(pList);
+	RsslReactorImpl *pReactorImpl = pShard->pReactorImpl;
+	RsslQueueLink *pLink = rsslQueueRemoveFirstLink(&pShard->channelPool);
 	RsslReactorChannelImpl *pReactorChannel;
 
 	if (!pLink)
@@ -296,7 +354,7 @@ static RsslReactorChannelImpl* _reactorTakeChannel(RsslReactorImpl *pReactorImpl
 
 		rsslClearReactorChannelImpl(pReactorImpl, pReactorChannel);
 		rsslInitQueueLink(&pReactorChannel->reactorQueueLink);
-		rsslInitReactorEventQueue(&pReactorChannel->eventQueue, 5, &pReactorImpl->activeEventQueueGroup);
+		rsslInitReactorEventQueue(&pReactorChannel->eventQueue, 5, &pShard->activeEventQueueGroup);
 
 		if ((pReactorChannel->pWorkerNotifierEvent = rsslCreateNotifierEvent()) == NULL)
 			return NULL;
@@ -308,23 +366,73 @@ static RsslReactorChannelImpl* _reactorTakeChannel(RsslReactorImpl *pReactorImpl
 	else
 		pReactorChannel = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorChannelImpl, reactorQueueLink, pLink);
 
-	pReactorChannel->lastPingReadMs = pReactorImpl->lastRecordedTimeMs = getCurrentTimeMs(pReactorImpl->ticksPerMsec);
+	pReactorChannel->pShard = pShard;
+	pReactorChannel->lastPingReadMs = pShard->lastRecordedTimeMs = getCurrentTimeMs(pReactorImpl->ticksPerMsec);
 
 	pReactorChannel->reactorParentQueue = NULL;
 
 	return pReactorChannel;
 }
 
+/* Flushes the channel directly if it is configured for it, otherwise signals the worker to flush it.
+ * Only used after a write that was fully accepted by RSSL; when a write must be retried, the reactor needs the
+ * FLUSH_DONE event from the worker, so _reactorSendFlushRequest() is used instead. */
+static RsslRet _reactorFlush(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel, RsslErrorInfo *pError)
+{
+	/* The channel lock makes flushing safe against the worker thread, and the worker is not flushing this channel
+	 * while no flush is requested. If the socket can't take everything, or the flush fails, leave it to the worker,
+	 * which waits for the socket to become writable and handles any failure. */
+	if (pReactorChannel->directFlush && !pReactorChannel->requestedFlush && pReactorChannel->reactorChannel.pRsslChannel != NULL)
+	{
+		RsslError flushError;
+
+		if (rsslFlush(pReactorChannel->reactorChannel.pRsslChannel, &flushError) == RSSL_RET_SUCCESS)
+		{
+			pReactorChannel->writeRet = 0;
+
+			if (pReactorChannel->pWatchlist)
+				pReactorChannel->pWatchlist->state &= ~RSSLWL_STF_NEED_FLUSH;
+
+			if ((pReactorChannel->statisticFlags & RSSL_RC_ST_WRITE) && pReactorChannel->pChannelStatistic)
+				_cumulativeValue(&pReactorChannel->pChannelStatistic->inlineFlushes, (RsslUInt32)1);
+
+			return RSSL_RET_SUCCESS;
+		}
+	}
+
+	return _reactorSendFlushRequest(pReactorImpl, pReactorChannel, pError);
+}
+
+/* Flushes after the watchlist has written to the channel. While the watchlist still holds a message it could not
+ * write, or streams waiting to send requests, the flush is left to the worker as before; otherwise the channel may
+ * be flushed directly. */
+static RsslRet _reactorFlushWatchlist(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel, RsslErrorInfo *pError)
+{
+	RsslWatchlistImpl *pWatchlistImpl = (RsslWatchlistImpl*)pReactorChannel->pWatchlist;
+
+	pReactorChannel->writeRet = 1;
+
+	if (pWatchlistImpl->base.pWriteCallAgainBuffer || rsslQueueGetElementCount(&pWatchlistImpl->base.streamsPendingRequest) > 0)
+		return _reactorSendFlushRequest(pReactorImpl, pReactorChannel, pError);
+
+	return _reactorFlush(pReactorImpl, pReactorChannel, pError);
+}
+
 static RsslRet _reactorSendFlushRequest(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel, RsslErrorInfo *pError)
 {
 	if (!pReactorChannel->requestedFlush)
 	{
-		/* Signal worker to flush for this channel */
-		RsslReactorEventImpl *pEvent = rsslReactorEventQueueGetFromPool(&pReactorImpl->reactorWorker.workerQueue);
+		RsslReactorEventImpl *pEvent;
 
 		if (pReactorChannel->pWatchlist)
 			pReactorChannel->pWatchlist->state &= ~RSSLWL_STF_NEED_FLUSH;
 
+		if ((pReactorChannel->statisticFlags & RSSL_RC_ST_WRITE) && pReactorChannel->pChannelStatistic)
+			_cumulativeValue(&pReactorChannel->pChannelStatistic->deferredFlushes, (RsslUInt32)1);
+
+		/* Signal worker to flush for this channel */
+		pEvent = rsslReactorEventQueueGetFromPool(&pReactorImpl->reactorWorker.workerQueue);
+
 		pReactorChannel->requestedFlush = RSSL_TRUE;
 		pReactorChannel->writeRet = 0; /* Set writeRet to 0. If it gets set again later we know we've called rsslWrite since the last flush request. */
 
@@ -413,67 +521,33 @@ static RsslRet _RsslJsonServiceNameToIdCallback(RsslBuffer *pServiceName, void *
 	return (*pReactorImpl->pServiceNameToIdCallback)((RsslReactor*)pReactorImpl, pServiceName, pServiceId, &serviceNameToIdEvent);
 }
 
-RSSL_VA_API RsslRet rsslReactorInitJsonConverter(RsslReactor *pReactor, RsslReactorJsonConverterOptions *pReactorJsonConverterOptions, RsslErrorInfo *pError)
+/* Creates the JSON converter of a shard. The shards share the dictionary list and the callbacks. */
+static RsslJsonConverter *_reactorCreateJsonConverter(RsslReactorImpl *pReactorImpl, RsslReactorJsonConverterOptions *pReactorJsonConverterOptions, RsslErrorInfo *pError)
 {
-	RsslReactorImpl *pReactorImpl = (RsslReactorImpl*)pReactor;
 	RsslCreateJsonConverterOptions rjcOptions;
 	RsslJsonConverterError rjcError;
 	RsslJsonDictionaryListProperty dlProperty;
 	RsslJsonServiceNameToIdCallbackProperty svcNameToIdCbProperty;
+	RsslJsonConverter *pJsonConverter;
 	RsslBool flag = RSSL_TRUE;
-	RsslRet ret;
-
-	if ((ret = reactorLockInterface(pReactorImpl, RSSL_TRUE, pError)) != RSSL_RET_SUCCESS)
-		return ret;
-
-	if (pReactorImpl->state != RSSL_REACTOR_ST_ACTIVE)
-	{
-		rsslSetErrorInfo(pError, RSSL_EIC_SHUTDOWN, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "Reactor is shutting down.");
-		return (reactorUnlockInterface(pReactorImpl), RSSL_RET_FAILURE);
-	}
-
-	if (pReactorImpl->jsonConverterInitialized == RSSL_TRUE)
-	{
-		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__,
-			"The RsslJsonConverter has been initialized");
-
-		return (reactorUnlockInterface(pReactorImpl), RSSL_RET_FAILURE);
-	}
 
 	rsslClearCreateRsslJsonConverterOptions(&rjcOptions);
-	
-	/* Initialize string table */
-	rsslJsonInitialize();
 
 	/* Set the maximum output buffer size for the converter. */
 	rjcOptions.bufferSize = pReactorJsonConverterOptions->outputBufferSize;
 
-	pReactorImpl->pJsonConverter = rsslCreateRsslJsonConverter(&rjcOptions, &rjcError);
-	if (pReactorImpl->pJsonConverter == NULL)
+	pJsonConverter = rsslCreateRsslJsonConverter(&rjcOptions, &rjcError);
+	if (pJsonConverter == NULL)
 	{
-		rsslJsonUninitialize();
 		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to create RsslJsonConverter: %s", rjcError.text);
-		return (reactorUnlockInterface(pReactorImpl), RSSL_RET_FAILURE);
-	}
-
-	pReactorImpl->pDictionaryList = malloc(sizeof(RsslDataDictionary*) * 1); /* RsslJsonConverter supports only one RsslDataDictionary */
-	if (pReactorImpl->pDictionaryList == NULL)
-	{
-		rsslJsonUninitialize();
-		rsslDestroyRsslJsonConverter(pReactorImpl->pJsonConverter, &rjcError);
-		
-		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to allocate memory to keep a list of RsslDataDictionary");
-		return (reactorUnlockInterface(pReactorImpl), RSSL_RET_FAILURE);
+		return NULL;
 	}
 
-	/* Set RsslDataDictionary specified users */
-	pReactorImpl->pDictionaryList[0] = pReactorJsonConverterOptions->pDictionary;
-
 	/* Set dictionary list. */
 	rsslClearConverterDictionaryListProperty(&dlProperty);
 	dlProperty.dictionaryListLength = 1;
 	dlProperty.pDictionaryList = pReactorImpl->pDictionaryList;
-	if (rsslJsonConverterSetProperty(pReactorImpl->pJsonConverter,
+	if (rsslJsonConverterSetProperty(pJsonConverter,
 								RSSL_JSON_CPC_DICTIONARY_LIST, 
 								&dlProperty, &rjcError) != RSSL_RET_SUCCESS)
 	{
@@ -481,7 +555,7 @@ RSSL_VA_API RsslRet rsslReactorInitJsonConverter(RsslReactor *pReactor, RsslReac
 		"Failed setting RsslJsonConverter property: dictionary list [%s]",
 		rjcError.text);
 
-		goto FailedToInitJsonConverter;
+		goto FailedToCreateJsonConverter;
 	}
 
 	/* Checks whether the callback method is set by users */
@@ -490,10 +564,8 @@ RSSL_VA_API RsslRet rsslReactorInitJsonConverter(RsslReactor *pReactor, RsslReac
 		rsslJsonClearServiceNameToIdCallbackProperty(&svcNameToIdCbProperty);
 		svcNameToIdCbProperty.callback = _RsslJsonServiceNameToIdCallback;
 		svcNameToIdCbProperty.closure = pReactorImpl;
-		pReactorImpl->userSpecPtr = pReactorJsonConverterOptions->userSpecPtr;
-		pReactorImpl->pServiceNameToIdCallback = pReactorJsonConverterOptions->pServiceNameToIdCallback;
 		/* Set service-name/ID callbacks. */
-		if (rsslJsonConverterSetProperty(pReactorImpl->pJsonConverter,
+		if (rsslJsonConverterSetProperty(pJsonConverter,
 			RSSL_JSON_CPC_SERVICE_NAME_TO_ID_CALLBACK,
 			&svcNameToIdCbProperty, &rjcError) != RSSL_RET_SUCCESS)
 		{
@@ -501,7 +573,7 @@ RSSL_VA_API RsslRet rsslReactorInitJsonConverter(RsslReactor *pReactor, RsslReac
 				"Failed setting RsslJsonConverter property: service name to ID callback [%s]",
 				rjcError.text);
 
-			goto FailedToInitJsonConverter;
+			goto FailedToCreateJsonConverter;
 		}
 	}
 
@@ -510,64 +582,64 @@ RSSL_VA_API RsslRet rsslReactorInitJsonConverter(RsslReactor *pReactor, RsslReac
 		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__,
 			"Failed setting RsslJsonConverter property: default service ID [%d]. The service ID must be in a range between 0 to 65535", pReactorJsonConverterOptions->defaultServiceId);
 
-		goto FailedToInitJsonConverter;
+		goto FailedToCreateJsonConverter;
 	}
 
 	if (pReactorJsonConverterOptions->defaultServiceId >= 0)
 	{
 		RsslUInt16 defaultServiceID = (RsslUInt16)pReactorJsonConverterOptions->defaultServiceId;
 		/* Set default service ID. */
-		if (rsslJsonConverterSetProperty(pReactorImpl->pJsonConverter,
+		if (rsslJsonConverterSetProperty(pJsonConverter,
 			RSSL_JSON_CPC_DEFAULT_SERVICE_ID,
 			&defaultServiceID, &rjcError) != RSSL_RET_SUCCESS)
 		{
 			rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__,
 				"Failed setting RsslJsonConverter property: default service ID [%s]", rjcError.text);
 
-			goto FailedToInitJsonConverter;
+			goto FailedToCreateJsonConverter;
 		}
 	}
 
 	/* When converting from RWF to JSON, add a QoS range on requests that do not specify a QoS */
 	flag = RSSL_FALSE;
-	if (rsslJsonConverterSetProperty(pReactorImpl->pJsonConverter,
+	if (rsslJsonConverterSetProperty(pJsonConverter,
 								RSSL_JSON_CPC_USE_DEFAULT_DYNAMIC_QOS, 
 								&flag, &rjcError) != RSSL_RET_SUCCESS)
 	{
 		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, 
 		"Failed setting RsslJsonConverter property: add default QoS range [%s]", rjcError.text);
 
-		goto FailedToInitJsonConverter;
+		goto FailedToCreateJsonConverter;
 	}
 
 	/* Expand enumerated values in field entries to their display values. 
 	 * Dictionary must have enumerations loaded */
 	flag = pReactorJsonConverterOptions->jsonExpandedEnumFields;
-	if (rsslJsonConverterSetProperty(pReactorImpl->pJsonConverter,
+	if (rsslJsonConverterSetProperty(pJsonConverter,
 								RSSL_JSON_CPC_EXPAND_ENUM_FIELDS, 
 								&flag, &rjcError) != RSSL_RET_SUCCESS)
 	{
 		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, 
 		"Failed setting RsslJsonConverter property: expand enum fields [%s]", rjcError.text);
 
-		goto FailedToInitJsonConverter;
+		goto FailedToCreateJsonConverter;
 	}
 
 	/* When converting from JSON to RWF, catch unknown JSON keys. */
 	flag = pReactorJsonConverterOptions->catchUnknownJsonKeys;
-	if (rsslJsonConverterSetProperty(pReactorImpl->pJsonConverter,
+	if (rsslJsonConverterSetProperty(pJsonConverter,
 								RSSL_JSON_CPC_CATCH_UNKNOWN_JSON_KEYS, 
 								&flag, &rjcError) != RSSL_RET_SUCCESS)
 	{
 		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, 
 		"Failed setting RsslJsonConverter property: catch unknown JSON keys [%s]", rjcError.text);
 
-		goto FailedToInitJsonConverter;
+		goto FailedToCreateJsonConverter;
 	}
 
 	/* When converting from JSON to RWF, catch unknown JSON FIDS. */
 	flag = pReactorJsonConverterOptions->catchUnknownJsonFids;
-	if (rsslJsonConverterSetProperty(pReactorImpl->pJsonConverter,
+	if (rsslJsonConverterSetProperty(pJsonConverter,
 								RSSL_JSON_CPC_CATCH_UNKNOWN_JSON_FIDS, 
 								&flag, &rjcError) != RSSL_RET_SUCCESS)
 	{
@@ -575,7 +647,7 @@ RSSL_VA_API RsslRet rsslReactorInitJsonConverter(RsslReactor *pReactor, RsslReac
 		"Failed setting RsslJsonConverter property: catch unknown JSON fields [%s]",
 		rjcError.text);
 
-		goto FailedToInitJsonConverter;
+		goto FailedToCreateJsonConverter;
 	}
 
 	/* Enumerated values in RWF are translated to display strings in simplified JSON. 
@@ -583,7 +655,7 @@ RSSL_VA_API RsslRet rsslReactorInitJsonConverter(RsslReactor *pReactor, RsslReac
 	 * Setting the property below will cause display strings to be converted to blank, 
 	 * instead of resulting in errors. */
 	flag = RSSL_TRUE;
-	if (rsslJsonConverterSetProperty(pReactorImpl->pJsonConverter,
+	if (rsslJsonConverterSetProperty(pJsonConverter,
 								RSSL_JSON_CPC_ALLOW_ENUM_DISPLAY_STRINGS, 
 								&flag, &rjcError) != RSSL_RET_SUCCESS)
 	{
@@ -591,22 +663,88 @@ RSSL_VA_API RsslRet rsslReactorInitJsonConverter(RsslReactor *pReactor, RsslReac
 		"Failed setting RsslJsonConverter property: blank on enum display error [%s]",
 		rjcError.text);
 
-		goto FailedToInitJsonConverter;
+		goto FailedToCreateJsonConverter;
 	}
 
-	/* Checks whether the callback method is set by users to receive JSON error message */
-	if (pReactorJsonConverterOptions->pJsonConversionEventCallback)
+	return pJsonConverter;
+
+FailedToCreateJsonConverter:
+
+	rsslDestroyRsslJsonConverter(pJsonConverter, &rjcError);
+
+	return NULL;
+}
+
+RSSL_VA_API RsslRet rsslReactorInitJsonConverter(RsslReactor *pReactor, RsslReactorJsonConverterOptions *pReactorJsonConverterOptions, RsslErrorInfo *pError)
+{
+	RsslReactorImpl *pReactorImpl = rsslReactorGetImpl(pReactor);
+	RsslJsonConverterError rjcError;
+	RsslUInt32 i;
+	RsslRet ret;
+
+	if ((ret = reactorLockInterface(pReactorImpl, RSSL_TRUE, pError)) != RSSL_RET_SUCCESS)
+		return ret;
+
+	if (pReactorImpl->state != RSSL_REACTOR_ST_ACTIVE)
 	{
-		/* Allocates memory for holding JSON error messages when the conversion failed. */
-		pReactorImpl->pJsonErrorInfo = (RsslErrorInfo*)malloc(sizeof(RsslErrorInfo));
+		rsslSetErrorInfo(pError, RSSL_EIC_SHUTDOWN, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "Reactor is shutting down.");
+		return (reactorUnlockInterface(pReactorImpl), RSSL_RET_FAILURE);
+	}
 
-		if (pReactorImpl->pJsonErrorInfo == NULL)
-		{
+	if (pReactorImpl->jsonConverterInitialized == RSSL_TRUE)
+	{
+		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__,
+			"The RsslJsonConverter has been initialized");
+
+		return (reactorUnlockInterface(pReactorImpl), RSSL_RET_FAILURE);
+	}
+
+	/* Initialize string table */
+	rsslJsonInitialize();
+
+	pReactorImpl->pDictionaryList = malloc(sizeof(RsslDataDictionary*) * 1); /* RsslJsonConverter supports only one RsslDataDictionary */
+	if (pReactorImpl->pDictionaryList == NULL)
+	{
+		rsslJsonUninitialize();
+
+		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to allocate memory to keep a list of RsslDataDictionary");
+		return (reactorUnlockInterface(pReactorImpl), RSSL_RET_FAILURE);
+	}
+
+	/* Set RsslDataDictionary specified users */
+	pReactorImpl->pDictionaryList[0] = pReactorJsonConverterOptions->pDictionary;
+
+	/* Checks whether the callback method is set by users */
+	if (pReactorJsonConverterOptions->pServiceNameToIdCallback)
+	{
+		pReactorImpl->userSpecPtr = pReactorJsonConverterOptions->userSpecPtr;
+		pReactorImpl->pServiceNameToIdCallback = pReactorJsonConverterOptions->pServiceNameToIdCallback;
+	}
+
+	/* Each shard converts the messages of its own channels. */
+	for (i = 0; i < pReactorImpl->shardCount; ++i)
+	{
+		RsslReactorShardImpl *pShard = &pReactorImpl->pShards[i];
+
+		if ((pShard->pJsonConverter = _reactorCreateJsonConverter(pReactorImpl, pReactorJsonConverterOptions, pError)) == NULL)
 			goto FailedToInitJsonConverter;
+
+		/* Checks whether the callback method is set by users to receive JSON error message */
+		if (pReactorJsonConverterOptions->pJsonConversionEventCallback)
+		{
+			/* Allocates memory for holding JSON error messages when the conversion failed. */
+			pShard->pJsonErrorInfo = (RsslErrorInfo*)malloc(sizeof(RsslErrorInfo));
+
+			if (pShard->pJsonErrorInfo == NULL)
+			{
+				rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to allocate memory for JSON error messages");
+				goto FailedToInitJsonConverter;
+			}
 		}
+	}
 
+	if (pReactorJsonConverterOptions->pJsonConversionEventCallback)
 		pReactorImpl->pJsonConversionEventCallback = pReactorJsonConverterOptions->pJsonConversionEventCallback;
-	}
 
 	pReactorImpl->closeChannelFromFailure = pReactorJsonConverterOptions->closeChannelFromFailure;
 	
@@ -616,18 +754,237 @@ RSSL_VA_API RsslRet rsslReactorInitJsonConverter(RsslReactor *pReactor, RsslReac
 
 FailedToInitJsonConverter:
 
+	for (i = 0; i < pReactorImpl->shardCount; ++i)
+	{
+		RsslReactorShardImpl *pShard = &pReactorImpl->pShards[i];
+
+		if (pShard->pJsonConverter)
+		{
+			rsslDestroyRsslJsonConverter(pShard->pJsonConverter, &rjcError);
+			pShard->pJsonConverter = NULL;
+		}
+
+		free(pShard->pJsonErrorInfo);
+		pShard->pJsonErrorInfo = NULL;
+	}
+
 	rsslJsonUninitialize();
-	rsslDestroyRsslJsonConverter(pReactorImpl->pJsonConverter, &rjcError);
 	free(pReactorImpl->pDictionaryList);
+	pReactorImpl->pDictionaryList = NULL;
+
+	return (reactorUnlockInterface(pReactorImpl), RSSL_RET_FAILURE);
+}
+
+/* Chooses the shard of a new channel. A channel added from a callback stays on the shard that is dispatching,
+ * so that the thread dispatching the shard keeps its channels, unless the application chooses the shard. */
+static RsslReactorShardImpl *_reactorSelectShard(RsslReactorImpl *pReactorImpl, RsslUInt32 shardIndex, RsslErrorInfo *pError)
+{
+	RsslReactorShardImpl *pHeldShard;
+	RsslUInt32 i, selected = 0;
+
+	if (pReactorImpl->shardPolicy != RSSL_REACTOR_SHARD_EXPLICIT && (pHeldShard = _reactorHeldShard(pReactorImpl)) != NULL)
+		return pHeldShard;
+
+	switch (pReactorImpl->shardPolicy)
+	{
+		case RSSL_REACTOR_SHARD_EXPLICIT:
+			if (shardIndex >= pReactorImpl->shardCount)
+			{
+				rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, 
+					"Shard index %u is out of range; the reactor has %u shards.", shardIndex, pReactorImpl->shardCount);
+				return NULL;
+			}
+			selected = shardIndex;
+			break;
+
+		case RSSL_REACTOR_SHARD_LEAST_LOADED:
+			/* The channel counts are read without the shards' locks, so one that is changing may be off by one. */
+			for (i = 1; i < pReactorImpl->shardCount; ++i)
+			{
+				if (pReactorImpl->pShards[i].channelCount < pReactorImpl->pShards[selected].channelCount)
+					selected = i;
+			}
+			break;
+
+		case RSSL_REACTOR_SHARD_ROUND_ROBIN:
+		default:
+			selected = (RsslUInt32)rtrMpscFetchAdd(&pReactorImpl->nextShard, 1) % pReactorImpl->shardCount;
+			break;
+	}
+
+	return &pReactorImpl->pShards[selected];
+}
+
+/* Returns the shard that an RsslReactor handle dispatches. The reactor's own handle dispatches shard 0. */
+static RsslReactorShardImpl *_reactorHandleShard(RsslReactor *pReactor)
+{
+	RsslReactorImpl *pReactorImpl = rsslReactorGetImpl(pReactor);
+
+	return (pReactor == (RsslReactor*)pReactorImpl) ? &pReactorImpl->pShards[0] : (RsslReactorShardImpl*)pReactor;
+}
+
+/* Returns the shard of a channel given to a function with its reactor. A channel that is not the reactor's returns
+ * shard 0, where the function rejects it. */
+static RsslReactorShardImpl *_reactorChannelShard(RsslReactorImpl *pReactorImpl, RsslReactorChannel *pChannel)
+{
+	RsslReactorChannelImpl *pReactorChannel = (RsslReactorChannelImpl*)pChannel;
+
+	return (pReactorChannel && pReactorChannel->pParentReactor == pReactorImpl && pReactorChannel->pShard) ? pReactorChannel->pShard : &pReactorImpl->pShards[0];
+}
+
+RSSL_VA_API RsslReactor *rsslReactorGetShard(RsslReactor *pReactor, RsslUInt32 shardIndex, RsslErrorInfo *pError)
+{
+	RsslReactorImpl *pReactorImpl;
+
+	if (!pReactor)
+	{
+		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "RsslReactor not provided.");
+		return NULL;
+	}
+
+	pReactorImpl = rsslReactorGetImpl(pReactor);
+
+	if (shardIndex >= pReactorImpl->shardCount)
+	{
+		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, 
+			"Shard index %u is out of range; the reactor has %u shards.", shardIndex, pReactorImpl->shardCount);
+		return NULL;
+	}
+
+	return (shardIndex == 0) ? &pReactorImpl->reactor : &pReactorImpl->pShards[shardIndex].reactor;
+}
+
+/* Sets up a dispatch shard. Shard 0 dispatches the reactor's own event queue and is signaled through the reactor's handle. */
+static RsslRet _reactorInitShard(RsslReactorImpl *pReactorImpl, RsslUInt32 shardIndex, RsslErrorInfo *pError)
+{
+	RsslReactorShardImpl *pShard = &pReactorImpl->pShards[shardIndex];
+	RsslReactor *pShardReactor = (shardIndex == 0) ? &pReactorImpl->reactor : &pShard->reactor;
+	RsslInt32 i;
+	char *memBuf;
+
+	pShard->pReactorImpl = pReactorImpl;
+	pShard->shardIndex = shardIndex;
+	pShard->reactor.userSpecPtr = pReactorImpl->reactor.userSpecPtr;
+	pShard->pEventQueue = (shardIndex == 0) ? &pReactorImpl->reactorEventQueue : &pShard->eventQueue;
+
+	/* Setup shard's channel lists */
+	rsslInitQueue(&pShard->channelPool);
+	rsslInitQueue(&pShard->initializingChannels);
+	rsslInitQueue(&pShard->activeChannels);
+	rsslInitQueue(&pShard->readyChannels);
+	rsslInitQueue(&pShard->inactiveChannels);
+	rsslInitQueue(&pShard->closingChannels);
+	rsslInitQueue(&pShard->reconnectingChannels);
+	rsslInitQueue(&pShard->warmstandbyChannelPool);
+	rsslInitQueue(&pShard->closingWarmstandbyChannel);
+
+	RSSL_MUTEX_INIT(&pShard->interfaceLock);
+
+	if (rsslInitReactorEventQueue(pShard->pEventQueue, 10, &pShard->activeEventQueueGroup) != RSSL_RET_SUCCESS)
+	{
+		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to initialize event queue.");
+		return RSSL_RET_FAILURE;
+	}
+
+	if (rsslInitReactorEventQueueGroup(&pShard->activeEventQueueGroup) != RSSL_RET_SUCCESS)
+	{
+		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to initialize event queue group.");
+		return RSSL_RET_FAILURE;
+	}
+
+	pShard->lastRecordedTimeMs = getCurrentTimeMs(pReactorImpl->ticksPerMsec);
+	rsslTimerWheelInit(&pShard->pingTimeoutWheel, pShard->lastRecordedTimeMs);
+
+	/* Initialize channel pool */
+	for (i = 0; i < 10; ++i)
+	{
+		RsslReactorChannelImpl *pNewChannel = (RsslReactorChannelImpl*)malloc(sizeof(RsslReactorChannelImpl));
+
+		if (!pNewChannel)
+		{
+			rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to create reactor channel pool.");
+			return RSSL_RET_FAILURE;
+		}
+		rsslClearReactorChannelImpl(pReactorImpl, pNewChannel);
+		pNewChannel->pShard = pShard;
+		rsslInitQueueLink(&pNewChannel->reactorQueueLink);
+		rsslInitReactorEventQueue(&pNewChannel->eventQueue, 5, &pShard->activeEventQueueGroup);
+		_reactorMoveChannel(&pShard->channelPool, pNewChannel);
+
+		if ((pNewChannel->pNotifierEvent = rsslCreateNotifierEvent()) == NULL)
+		{
+			rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to create reactor channel pool.");
+			return RSSL_RET_FAILURE;
+		}
+
+		if ((pNewChannel->pWorkerNotifierEvent = rsslCreateNotifierEvent()) == NULL)
+		{
+			rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to create reactor channel pool.");
+			return RSSL_RET_FAILURE;
+		}
+	}
+
+	/* Initialize warmstandby channel pool */
+	for (i = 0; i < 10; ++i)
+	{
+		RsslReactorWarmStandByHandlerImpl* pNewWSChannel = (RsslReactorWarmStandByHandlerImpl*)malloc(sizeof(RsslReactorWarmStandByHandlerImpl));
+
+		if (!pNewWSChannel)
+		{
+			rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to create reactor warmstandby channel pool.");
+			return RSSL_RET_FAILURE;
+		}
+		rsslClearReactorWarmStandByHandlerImpl(pNewWSChannel);
+		pNewWSChannel->pReactorImpl = pReactorImpl;
+
+		rsslQueueAddLinkToBack(&pShard->warmstandbyChannelPool, &pNewWSChannel->reactorQueueLink);
+	}
+
+	if ((pShard->pNotifier = rsslCreateNotifier(1024)) == NULL)
+	{
+		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to create reactor notifier.");
+		return RSSL_RET_FAILURE;
+	}
+
+	if ((pShard->pQueueNotifierEvent = rsslCreateNotifierEvent()) == NULL)
+	{
+		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to create reactor event queue notifier event.");
+		return RSSL_RET_FAILURE;
+	}
+
+	pShardReactor->eventFd = rsslGetEventQueueGroupSignalFD(&pShard->activeEventQueueGroup);
+
+	if (rsslNotifierAddEvent(pShard->pNotifier, pShard->pQueueNotifierEvent, (int)(pShardReactor->eventFd), pShard->pEventQueue) < 0)
+	{
+		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to add event for reactor event queue notification.");
+		return RSSL_RET_FAILURE;
+	}
+
+	if (rsslNotifierRegisterRead(pShard->pNotifier, pShard->pQueueNotifierEvent) < 0)
+	{
+		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, 
+				"Failed to register read notification for reactor event queue.");
+		return RSSL_RET_FAILURE;
+	}
+
+	/* Initialize memory block for decoding RDM structures */
+	memBuf = (char*)malloc(pReactorImpl->dispatchDecodeMemoryBufferSize);
+	if (!memBuf)
+	{
+		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to create reactor memory buffer.");
+		return RSSL_RET_FAILURE;
+	}
+	pShard->memoryBuffer.data = memBuf;
+	pShard->memoryBuffer.length = pReactorImpl->dispatchDecodeMemoryBufferSize;
 
-	return (reactorUnlockInterface(pReactorImpl), RSSL_RET_FAILURE);
+	return RSSL_RET_SUCCESS;
 }
 
 RSSL_VA_API RsslReactor *rsslCreateReactor(RsslCreateReactorOptions *pReactorOpts, RsslErrorInfo *pError)
 {
 	RsslReactorImpl *pReactorImpl;
+	RsslUInt32 shardCount;
 	RsslInt32 i;
-	char *memBuf;
 
 #ifdef WIN32
 	LARGE_INTEGER	perfFrequency;
@@ -662,6 +1019,14 @@ RSSL_VA_API RsslReactor *rsslCreateReactor(RsslCreateReactorOptions *pReactorOpt
 		pReactorOpts->maxEventsInPool = -1;
 	}
 
+#ifndef RSSL_REACTOR_DISPATCH_SHARDS
+	if (pReactorOpts->dispatchShardCount > 1)
+	{
+		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "Dispatch shards are not supported on this platform.");
+		return NULL;
+	}
+#endif
+
 	if (pReactorOpts->cpuBindWorkerThread.length > 0 && pReactorOpts->cpuBindWorkerThread.data != NULL)
 	{
 		if (pReactorOpts->cpuBindWorkerThread.length < 512)
@@ -702,6 +1067,7 @@ RSSL_VA_API RsslReactor *rsslCreateReactor(RsslCreateReactorOptions *pReactorOpt
 	pReactorImpl->reissueTokenAttemptInterval = pReactorOpts->reissueTokenAttemptInterval;
 	pReactorImpl->restRequestTimeout = pReactorOpts->restRequestTimeOut;
 	pReactorImpl->restEnableLog = pReactorOpts->restEnableLog;
+	pReactorImpl->directFlush = pReactorOpts->enableDirectFlush;
 	if (pReactorOpts->restLogOutputStream)
 	{
 		if (pReactorOpts->restLogOutputStream == stdout)
@@ -874,21 +1240,6 @@ RSSL_VA_API RsslReactor *rsslCreateReactor(RsslCreateReactorOptions *pReactorOpt
 	pReactorImpl->state = RSSL_REACTOR_ST_ACTIVE;
 
 
-	/* Setup reactor */
-	if (rsslInitReactorEventQueue(&pReactorImpl->reactorEventQueue, 10, &pReactorImpl->activeEventQueueGroup) != RSSL_RET_SUCCESS)
-	{
-		_reactorWorkerCleanupReactor(pReactorImpl);
-		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to initialize event queue.");
-		return NULL;
-	}
-
-	if (rsslInitReactorEventQueueGroup(&pReactorImpl->activeEventQueueGroup) != RSSL_RET_SUCCESS)
-	{
-		_reactorWorkerCleanupReactor(pReactorImpl);
-		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to initialize event queue group.");
-		return NULL;
-	}
-
 #ifdef WIN32
 	/* On Windows, time checks use the performance counter, so we need to obtain its frequency. */
 	QueryPerformanceFrequency(&perfFrequency);
@@ -897,110 +1248,53 @@ RSSL_VA_API RsslReactor *rsslCreateReactor(RsslCreateReactorOptions *pReactorOpt
 	pReactorImpl->ticksPerMsec = 1000000; /* Not used. */
 #endif
 
-	/* Setup reactor's channel lists */
-	rsslInitQueue(&pReactorImpl->channelPool);
-	rsslInitQueue(&pReactorImpl->initializingChannels);
-	rsslInitQueue(&pReactorImpl->activeChannels);
-	rsslInitQueue(&pReactorImpl->inactiveChannels);
-	rsslInitQueue(&pReactorImpl->closingChannels);
-	rsslInitQueue(&pReactorImpl->reconnectingChannels);
-	rsslInitQueue(&pReactorImpl->warmstandbyChannelPool);
-	rsslInitQueue(&pReactorImpl->closingWarmstandbyChannel);
-
-	RSSL_MUTEX_INIT(&pReactorImpl->interfaceLock);
-
-	pReactorImpl->lastRecordedTimeMs = getCurrentTimeMs(pReactorImpl->ticksPerMsec);
-
-	/* Initialize channel pool */
-	for (i = 0; i < 10; ++i)
+	/* Setup reactor's dispatch shards */
+	shardCount = pReactorOpts->dispatchShardCount > 1 ? pReactorOpts->dispatchShardCount : 1;
+	if (!(pReactorImpl->pShards = (RsslReactorShardImpl*)calloc(shardCount, sizeof(RsslReactorShardImpl))))
 	{
-		RsslReactorChannelImpl *pNewChannel = (RsslReactorChannelImpl*)malloc(sizeof(RsslReactorChannelImpl));
-
-		if (!pNewChannel)
-		{
-			rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to create reactor channel pool.");
-			return NULL;
-		}
-		rsslClearReactorChannelImpl(pReactorImpl, pNewChannel);
-		rsslInitQueueLink(&pNewChannel->reactorQueueLink);
-		rsslInitReactorEventQueue(&pNewChannel->eventQueue, 5, &pReactorImpl->activeEventQueueGroup);
-
-		if ((pNewChannel->pNotifierEvent = rsslCreateNotifierEvent()) == NULL)
-			return NULL;
-
-		if ((pNewChannel->pWorkerNotifierEvent = rsslCreateNotifierEvent()) == NULL)
-			return NULL;
-
-		_reactorMoveChannel(&pReactorImpl->channelPool, pNewChannel);
+		_reactorWorkerCleanupReactor(pReactorImpl);
+		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to allocate reactor shards.");
+		return NULL;
 	}
+	pReactorImpl->shardCount = shardCount;
+	pReactorImpl->shardPolicy = pReactorOpts->shardPolicy;
 
-	/* Initialize warmstandby channel pool */
-	for (i = 0; i < 10; ++i)
+	for (i = 0; i < (RsslInt32)shardCount; ++i)
 	{
-		RsslReactorWarmStandByHandlerImpl* pNewWSChannel = (RsslReactorWarmStandByHandlerImpl*)malloc(sizeof(RsslReactorWarmStandByHandlerImpl));
-
-		if (!pNewWSChannel)
+		if (_reactorInitShard(pReactorImpl, (RsslUInt32)i, pError) != RSSL_RET_SUCCESS)
 		{
-			rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to create reactor warmstandby channel pool.");
+			_reactorWorkerCleanupReactor(pReactorImpl);
 			return NULL;
 		}
-		rsslClearReactorWarmStandByHandlerImpl(pNewWSChannel);
-		pNewWSChannel->pReactorImpl = pReactorImpl;
-
-		rsslQueueAddLinkToBack(&pReactorImpl->warmstandbyChannelPool, &pNewWSChannel->reactorQueueLink);
-	}
-
-	if ((pReactorImpl->pNotifier = rsslCreateNotifier(1024)) == NULL)
-	{
-		_reactorWorkerCleanupReactor(pReactorImpl);
-		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to create reactor notifier.");
-		return NULL;
 	}
 
-	if ((pReactorImpl->pQueueNotifierEvent = rsslCreateNotifierEvent()) == NULL)
+	if (_reactorWorkerStart(pReactorImpl, pReactorOpts, RTR_ATOMIC_INCREMENT_RET(currentIndReactor), pError) != RSSL_RET_SUCCESS)
 	{
 		_reactorWorkerCleanupReactor(pReactorImpl);
-		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to create reactor event queue notifier event.");
 		return NULL;
 	}
 
+	pReactorImpl->rsslWorkerStarted = RSSL_TRUE; /* Indicates the worker thread is started */
 
-	pReactorImpl->reactor.eventFd = rsslGetEventQueueGroupSignalFD(&pReactorImpl->activeEventQueueGroup);
-
-	if (rsslNotifierAddEvent(pReactorImpl->pNotifier, pReactorImpl->pQueueNotifierEvent, (int)(pReactorImpl->reactor.eventFd), &pReactorImpl->reactorEventQueue) < 0)
-	{
-		_reactorWorkerCleanupReactor(pReactorImpl);
-		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to add event for reactor event queue notification.");
-		return NULL;
-	}
-
-	if (rsslNotifierRegisterRead(pReactorImpl->pNotifier, pReactorImpl->pQueueNotifierEvent) < 0)
-	{
-		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, 
-				"Failed to register read notification for reactor event queue.");
-		return NULL;
-	}
+	return (RsslReactor*)pReactorImpl;
+}
 
-	/* Initialize memory block for decoding RDM structures */
-	memBuf = (char*)malloc(pReactorImpl->dispatchDecodeMemoryBufferSize);
-	if (!memBuf)
-	{
-		_reactorWorkerCleanupReactor(pReactorImpl);
-		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to create reactor memory buffer.");
-		return NULL;
-	}
-	pReactorImpl->memoryBuffer.data = memBuf;
-	pReactorImpl->memoryBuffer.length = pReactorImpl->dispatchDecodeMemoryBufferSize;
+/* Calls the channel down callback for each active channel of a shard. */
+static RsslRet _reactorShutdownShard(RsslReactorShardImpl *pShard, RsslErrorInfo *pError)
+{
+	RsslReactorChannelImpl *pReactorChannel;
+	RsslQueueLink *pLink;
 
-	if (_reactorWorkerStart(pReactorImpl, pReactorOpts, RTR_ATOMIC_INCREMENT_RET(currentIndReactor), pError) != RSSL_RET_SUCCESS)
+	RSSL_QUEUE_FOR_EACH_LINK(&pShard->activeChannels, pLink)
 	{
-		_reactorWorkerCleanupReactor(pReactorImpl);
-		return NULL;
+		pReactorChannel = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorChannelImpl, reactorQueueLink, pLink);
+		if (_reactorHandleChannelDown(pShard->pReactorImpl, pReactorChannel, pError) != RSSL_RET_SUCCESS)
+			return RSSL_RET_FAILURE;
 	}
 
-	pReactorImpl->rsslWorkerStarted = RSSL_TRUE; /* Indicates the worker thread is started */
+	/* Any channels still active should be cleaned up by the worker */
 
-	return (RsslReactor*)pReactorImpl;
+	return RSSL_RET_SUCCESS;
 }
 
 static void _reactorShutdown(RsslReactorImpl *pReactorImpl, RsslErrorInfo *pError)
@@ -1010,20 +1304,24 @@ static void _reactorShutdown(RsslReactorImpl *pReactorImpl, RsslErrorInfo *pErro
 		case RSSL_REACTOR_ST_ACTIVE:
 		case RSSL_REACTOR_ST_ERROR:
 		{
-			RsslReactorChannelImpl *pReactorChannel;
-			RsslQueueLink *pLink;
+			RsslReactorShardImpl *pHeldShard = _reactorHeldShard(pReactorImpl);
+			RsslUInt32 i;
 	
 			pReactorImpl->state = RSSL_REACTOR_ST_SHUT_DOWN;
 
-			/* Call channel down callback for each channel */
-			RSSL_QUEUE_FOR_EACH_LINK(&pReactorImpl->activeChannels, pLink)
+			/* A thread dispatching a shard only calls back for the channels of that shard. The others see the
+			 * state when they are next dispatched. */
+			if (pHeldShard)
 			{
-				pReactorChannel = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorChannelImpl, reactorQueueLink, pLink);
-				if (_reactorHandleChannelDown(pReactorImpl, pReactorChannel, pError) != RSSL_RET_SUCCESS)
-					return;
+				_reactorShutdownShard(pHeldShard, pError);
+				return;
 			}
 
-			/* Any channels still active should be cleaned up by the worker */
+			for (i = 0; i < pReactorImpl->shardCount; ++i)
+			{
+				if (_reactorShutdownShard(&pReactorImpl->pShards[i], pError) != RSSL_RET_SUCCESS)
+					return;
+			}
 
 			return;
 		}
@@ -1048,10 +1346,8 @@ static RsslRet _reactorCleanupReactor(RsslReactorImpl *pReactorImpl)
 	return RSSL_RET_SUCCESS;
 }
 
-RSSL_VA_API RsslRet rsslDestroyReactor(RsslReactor *pReactor, RsslErrorInfo *pError)
+static RsslRet _reactorDestroy(RsslReactorImpl *pReactorImpl, RsslErrorInfo *pError)
 {
-	RsslReactorImpl *pReactorImpl = (RsslReactorImpl*)pReactor;
-
 	switch(pReactorImpl->state)
 	{
 		case RSSL_REACTOR_ST_ACTIVE:
@@ -1071,11 +1367,24 @@ RSSL_VA_API RsslRet rsslDestroyReactor(RsslReactor *pReactor, RsslErrorInfo *pEr
 	}
 }
 
+RSSL_VA_API RsslRet rsslDestroyReactor(RsslReactor *pReactor, RsslErrorInfo *pError)
+{
+	RsslReactorImpl *pReactorImpl = rsslReactorGetImpl(pReactor);
+
+	if (pReactor != (RsslReactor*)pReactorImpl)
+	{
+		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "A reactor shard is destroyed with the reactor that owns it.");
+		return RSSL_RET_INVALID_ARGUMENT;
+	}
+
+	return _reactorDestroy(pReactorImpl, pError);
+}
+
 static RsslRet _reactorAddChannel(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel, RsslErrorInfo *pError)
 {
 	RsslReactorChannelEventImpl *pEvent = (RsslReactorChannelEventImpl*)rsslReactorEventQueueGetFromPool(&pReactorImpl->reactorWorker.workerQueue);
 
-	_reactorMoveChannel(&pReactorImpl->initializingChannels, pReactorChannel);
+	_reactorMoveChannel(&pReactorChannel->pShard->initializingChannels, pReactorChannel);
 
 	pReactorChannel->channelSetupState = RSSL_RC_CHST_INIT;
 
@@ -1286,14 +1595,14 @@ RSSL_VA_API RsslRet rsslReactorQueryServiceDiscovery(RsslReactor *pReactor, Rssl
 	rsslClearTokenInformation(&tokenInformation);
 	reactorServiceEndpointEvent.userSpecPtr = pOpts->userSpecPtr;
 
-	pRsslReactorImpl = (RsslReactorImpl *)pReactor;
-
 	if (!pReactor)
 	{
 		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "RsslReactor not provided.");
 		return RSSL_RET_INVALID_ARGUMENT;
 	}
 
+	pRsslReactorImpl = rsslReactorGetImpl(pReactor);
+
 	if ((rsslRet = reactorLockInterface(pRsslReactorImpl, RSSL_TRUE, pError)) != RSSL_RET_SUCCESS)
 		return rsslRet;
 
@@ -1779,6 +2088,7 @@ static RsslRet applyConnectionOptions(RsslReactorChannelImpl* pReactorChannel, R
 
 	pReactorChannel->readRet = 0;
 	pReactorChannel->connectionDebugFlags = pOpts->connectionDebugFlags;
+	pReactorChannel->directFlush = (pOpts->enableDirectFlush || pReactorChannel->pParentReactor->directFlush) ? RSSL_TRUE : RSSL_FALSE;
 
 	/* Set reconnection info here, this should be zeroed out provider bound connections */
 	pReactorChannel->reconnectAttemptLimit = pOpts->reconnectAttemptLimit;
@@ -1808,9 +2118,17 @@ static RsslRet applyConnectionOptions(RsslReactorChannelImpl* pReactorChannel, R
 }
 
 
+/* Unlocks shard 0 and then the shard of a channel being connected or accepted. */
+static RsslRet _reactorUnlockChannelShard(RsslReactorImpl *pReactorImpl, RsslReactorShardImpl *pShard)
+{
+	reactorUnlockInterface(pReactorImpl);
+	return reactorUnlockShard(pShard);
+}
+
 RSSL_VA_API RsslRet rsslReactorConnect(RsslReactor *pReactor, RsslReactorConnectOptions *pOpts, RsslReactorChannelRole *pRole, RsslErrorInfo *pError )
 {
-	RsslReactorImpl *pReactorImpl = (RsslReactorImpl*)pReactor;
+	RsslReactorImpl *pReactorImpl = rsslReactorGetImpl(pReactor);
+	RsslReactorShardImpl *pShard;
 
 	RsslWatchlist *pWatchlist = NULL;
 	RsslChannel *pChannel;
@@ -1825,9 +2143,16 @@ RSSL_VA_API RsslRet rsslReactorConnect(RsslReactor *pReactor, RsslReactorConnect
 	RsslBool supportSessionManagementForWSGroup = RSSL_FALSE;
 	RsslReactorConnectInfoImpl *pReactorConnectInfoImpl = NULL;
 
-	if ((ret = reactorLockInterface(pReactorImpl, RSSL_TRUE, pError)) != RSSL_RET_SUCCESS)
+	if (!(pShard = _reactorSelectShard(pReactorImpl, pOpts->shardIndex, pError)))
+		return RSSL_RET_INVALID_ARGUMENT;
+
+	/* The channel's shard is locked first, then shard 0 for the state shared by all shards. */
+	if ((ret = reactorLockShard(pShard, RSSL_TRUE, pError)) != RSSL_RET_SUCCESS)
 		return ret;
 
+	if ((ret = reactorLockInterface(pReactorImpl, RSSL_TRUE, pError)) != RSSL_RET_SUCCESS)
+		return (reactorUnlockShard(pShard), ret);
+
 	if (pReactorImpl->state != RSSL_REACTOR_ST_ACTIVE)
 	{
 		rsslSetErrorInfo(pError, RSSL_EIC_SHUTDOWN, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "Reactor is shutting down.");
@@ -1837,7 +2162,7 @@ RSSL_VA_API RsslRet rsslReactorConnect(RsslReactor *pReactor, RsslReactorConnect
 	if ((ret = _validateRole(pRole, pError)) != RSSL_RET_SUCCESS)
 		goto reactorConnectFail;
 
-	pReactorChannel = _reactorTakeChannel(pReactorImpl, &pReactorImpl->channelPool);
+	pReactorChannel = _reactorTakeChannel(pShard);
 
 	if (!pReactorChannel)
 	{
@@ -1849,16 +2174,16 @@ RSSL_VA_API RsslRet rsslReactorConnect(RsslReactor *pReactor, RsslReactorConnect
 
 	if(_rsslChannelCopyConnectionList(pReactorChannel, pOpts, &pReactorChannel->supportSessionMgnt) != RSSL_RET_SUCCESS)
 	{
-		_reactorMoveChannel(&pReactorImpl->channelPool, pReactorChannel);
+		_reactorMoveChannel(&pShard->channelPool, pReactorChannel);
 
 		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Unable to copy connection list.");
-		return (reactorUnlockInterface(pReactorImpl), RSSL_RET_FAILURE);
+		return (_reactorUnlockChannelShard(pReactorImpl, pShard), RSSL_RET_FAILURE);
 	}
 
 	/* Handles the warmstandby group list for the warmstandby feature. */
-	if ( (ret = _rsslChannelCopyWarmStandByGroupList(pReactorImpl, &pReactorImpl->warmstandbyChannelPool, pOpts, &pWarmStandByHandlerImpl, &supportSessionManagementForWSGroup)) != RSSL_RET_SUCCESS)
+	if ( (ret = _rsslChannelCopyWarmStandByGroupList(pReactorImpl, &pShard->warmstandbyChannelPool, pOpts, &pWarmStandByHandlerImpl, &supportSessionManagementForWSGroup)) != RSSL_RET_SUCCESS)
 	{
-		_reactorMoveChannel(&pReactorImpl->channelPool, pReactorChannel);
+		_reactorMoveChannel(&pShard->channelPool, pReactorChannel);
 
 		if (ret == RSSL_RET_INVALID_ARGUMENT)
 		{
@@ -1869,7 +2194,7 @@ RSSL_VA_API RsslRet rsslReactorConnect(RsslReactor *pReactor, RsslReactorConnect
 			rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Unable to copy warmstandby group list.");
 		}
 
-		return (reactorUnlockInterface(pReactorImpl), RSSL_RET_FAILURE);
+		return (_reactorUnlockChannelShard(pReactorImpl, pShard), RSSL_RET_FAILURE);
 	}
 
 	if (pReactorChannel->supportSessionMgnt || supportSessionManagementForWSGroup)
@@ -1914,6 +2239,8 @@ RSSL_VA_API RsslRet rsslReactorConnect(RsslReactor *pReactor, RsslReactorConnect
 		watchlistCreateOpts.maxOutstandingPosts = pRole->ommConsumerRole.watchlistOptions.maxOutstandingPosts;
 		watchlistCreateOpts.postAckTimeout = pRole->ommConsumerRole.watchlistOptions.postAckTimeout;
 		watchlistCreateOpts.requestTimeout = pRole->ommConsumerRole.watchlistOptions.requestTimeout;
+		watchlistCreateOpts.enableViewFiltering = pRole->ommConsumerRole.watchlistOptions.enableViewFiltering;
+		watchlistCreateOpts.enableDistinctFanoutBuffers = pRole->ommConsumerRole.watchlistOptions.enableDistinctFanoutBuffers;
 		watchlistCreateOpts.ticksPerMsec = pReactorImpl->ticksPerMsec;
 		watchlistCreateOpts.enableWarmStandby = pWarmStandByHandlerImpl != NULL ? RSSL_TRUE : RSSL_FALSE;
 		watchlistCreateOpts.loginRequestCount = pReactorChannel->supportSessionMgnt ? pReactorChannel->connectionListCount : 1; /* Account from switching from WSB group to channel list. */
@@ -1972,6 +2299,7 @@ RSSL_VA_API RsslRet rsslReactorConnect(RsslReactor *pReactor, RsslReactorConnect
 
 			rsslClearReactorChannelImpl(pReactorImpl, &pWarmStandByHandlerImpl->mainReactorChannelImpl);
 			pWarmStandByHandlerImpl->mainReactorChannelImpl.pWarmStandByHandlerImpl = pWarmStandByHandlerImpl;
+			pWarmStandByHandlerImpl->mainReactorChannelImpl.pShard = pShard;
 			pWarmStandByHandlerImpl->warmStandByHandlerState = RSSL_RWSB_STATE_CONNECTING_TO_A_STARTING_SERVER;
 			pWarmStandByHandlerImpl->warmStandbyGroupList[pWarmStandByHandlerImpl->currentWSyGroupIndex].currentStartingServerIndex = RSSL_REACTOR_WSB_STARTING_SERVER_INDEX;
 
@@ -2053,7 +2381,7 @@ RSSL_VA_API RsslRet rsslReactorConnect(RsslReactor *pReactor, RsslReactorConnect
 			cret = RSSL_RC_CRET_SUCCESS;
 		_reactorSetInCallback(pReactorImpl, RSSL_FALSE);
 
-		if (cret < RSSL_RC_CRET_SUCCESS || pReactorChannel->reactorParentQueue == &pReactorImpl->closingChannels)
+		if (cret < RSSL_RC_CRET_SUCCESS || pReactorChannel->reactorParentQueue == &pReactorChannel->pShard->closingChannels)
 			goto reactorConnectFail;
 	}
 
@@ -2095,7 +2423,7 @@ RSSL_VA_API RsslRet rsslReactorConnect(RsslReactor *pReactor, RsslReactorConnect
 
 			if ((ret = _reactorSubmitWatchlistMsg(pReactorImpl, pReactorChannel, &processOpts, pError))
 				< RSSL_RET_SUCCESS)
-				return (reactorUnlockInterface(pReactorImpl), ret);
+				return (_reactorUnlockChannelShard(pReactorImpl, pShard), ret);
 		}
 
 		if (pReactorChannel->channelRole.ommConsumerRole.pDirectoryRequest)
@@ -2106,7 +2434,7 @@ RSSL_VA_API RsslRet rsslReactorConnect(RsslReactor *pReactor, RsslReactorConnect
 
 			if ((ret = _reactorSubmitWatchlistMsg(pReactorImpl, pReactorChannel, &processOpts, pError))
 				< RSSL_RET_SUCCESS)
-				return (reactorUnlockInterface(pReactorImpl), ret);
+				return (_reactorUnlockChannelShard(pReactorImpl, pShard), ret);
 		}
 
 		_reactorSetInCallback(pReactorImpl, RSSL_TRUE);
@@ -2137,7 +2465,7 @@ RSSL_VA_API RsslRet rsslReactorConnect(RsslReactor *pReactor, RsslReactorConnect
 			cret = RSSL_RC_CRET_SUCCESS;
 		_reactorSetInCallback(pReactorImpl, RSSL_FALSE);
 
-		if (cret < RSSL_RC_CRET_SUCCESS || pReactorChannel->reactorParentQueue == &pReactorImpl->closingChannels)
+		if (cret < RSSL_RC_CRET_SUCCESS || pReactorChannel->reactorParentQueue == &pReactorChannel->pShard->closingChannels)
 			goto reactorConnectFail;
 	}
 
@@ -2149,7 +2477,7 @@ RSSL_VA_API RsslRet rsslReactorConnect(RsslReactor *pReactor, RsslReactorConnect
 			{
 				_reactorShutdown(pReactorImpl, pError);
 				_reactorSendShutdownEvent(pReactorImpl, pError);
-				return (reactorUnlockInterface(pReactorImpl), RSSL_RET_FAILURE);
+				return (_reactorUnlockChannelShard(pReactorImpl, pShard), RSSL_RET_FAILURE);
 			}
 		}
 		else
@@ -2176,14 +2504,14 @@ RSSL_VA_API RsslRet rsslReactorConnect(RsslReactor *pReactor, RsslReactorConnect
 		}
 	}
 
-	++pReactorImpl->channelCount;
+	++pShard->channelCount;
 
 	if (pReactorChannel->pTokenSessionImpl)
 	{
 		pReactorChannel->pTokenSessionImpl->initialized = RSSL_TRUE;
 	}
 
-	return (reactorUnlockInterface(pReactorImpl), RSSL_RET_SUCCESS);
+	return (_reactorUnlockChannelShard(pReactorImpl, pShard), RSSL_RET_SUCCESS);
 
 reactorConnectFail:
 	if (pWatchlist)
@@ -2223,14 +2551,14 @@ reactorConnectFail:
 			{
 				_reactorShutdown(pReactorImpl, pError);
 				_reactorSendShutdownEvent(pReactorImpl, pError);
-				reactorUnlockInterface(pReactorImpl);
+				_reactorUnlockChannelShard(pReactorImpl, pShard);
 				return RSSL_RET_FAILURE;
 			}
 		}
 		else
 		{
-			_reactorMoveChannel(&pReactorImpl->channelPool, pReactorChannel);
-			--pReactorImpl->channelCount;
+			_reactorMoveChannel(&pShard->channelPool, pReactorChannel);
+			--pShard->channelCount;
 		}
 	}
 
@@ -2240,48 +2568,56 @@ reactorConnectFail:
 		_rsslFreeWarmStandbyHandler(pWarmStandByHandlerImpl, pWarmStandByHandlerImpl->warmStandbyGroupCount, RSSL_TRUE);
 	}
 		
-	reactorUnlockInterface(pReactorImpl);
+	_reactorUnlockChannelShard(pReactorImpl, pShard);
 	return pError->rsslError.rsslErrorId;
 }
 
 RSSL_VA_API RsslRet rsslReactorAccept(RsslReactor *pReactor, RsslServer *pServer, RsslReactorAcceptOptions *pOpts, RsslReactorChannelRole *pRole, RsslErrorInfo *pError )
 {
-	RsslReactorImpl *pReactorImpl = (RsslReactorImpl*)pReactor;
+	RsslReactorImpl *pReactorImpl = rsslReactorGetImpl(pReactor);
+	RsslReactorShardImpl *pShard;
 
 	RsslChannel *pChannel;
 	RsslReactorChannelImpl *pReactorChannel;
 	RsslRet ret;
 
-	if ((ret = reactorLockInterface(pReactorImpl, RSSL_TRUE, pError)) != RSSL_RET_SUCCESS)
+	if (!(pShard = _reactorSelectShard(pReactorImpl, pOpts->shardIndex, pError)))
+		return RSSL_RET_INVALID_ARGUMENT;
+
+	/* The channel's shard is locked first, then shard 0 for the state shared by all shards. */
+	if ((ret = reactorLockShard(pShard, RSSL_TRUE, pError)) != RSSL_RET_SUCCESS)
 		return ret;
 
+	if ((ret = reactorLockInterface(pReactorImpl, RSSL_TRUE, pError)) != RSSL_RET_SUCCESS)
+		return (reactorUnlockShard(pShard), ret);
+
 	if (pReactorImpl->state != RSSL_REACTOR_ST_ACTIVE)
 	{
 		rsslSetErrorInfo(pError, RSSL_EIC_SHUTDOWN, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "Reactor is shutting down.");
-		return (reactorUnlockInterface((RsslReactorImpl*)pReactor), RSSL_RET_FAILURE);
+		return (_reactorUnlockChannelShard(pReactorImpl, pShard), RSSL_RET_FAILURE);
 	}
 
 	if (!pServer)
 	{
 		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "Server not provided.");
-		return (reactorUnlockInterface((RsslReactorImpl*)pReactor), RSSL_RET_INVALID_ARGUMENT);
+		return (_reactorUnlockChannelShard(pReactorImpl, pShard), RSSL_RET_INVALID_ARGUMENT);
 	}
 
 	if (_validateRole(pRole, pError) != RSSL_RET_SUCCESS)
-		return (reactorUnlockInterface((RsslReactorImpl*)pReactor), RSSL_RET_INVALID_ARGUMENT);
+		return (_reactorUnlockChannelShard(pReactorImpl, pShard), RSSL_RET_INVALID_ARGUMENT);
 
 	if (!(pChannel = rsslAccept(pServer, &pOpts->rsslAcceptOptions, &pError->rsslError)))
 	{
 		rsslSetErrorInfoLocation(pError, __FILE__, __LINE__);
-		return (reactorUnlockInterface(pReactorImpl), RSSL_RET_FAILURE);
+		return (_reactorUnlockChannelShard(pReactorImpl, pShard), RSSL_RET_FAILURE);
 	}
 
-	pReactorChannel = _reactorTakeChannel(pReactorImpl, &pReactorImpl->channelPool);
+	pReactorChannel = _reactorTakeChannel(pShard);
 
 	if (!pReactorChannel)
 	{
 		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to create channel object.");
-		return (reactorUnlockInterface(pReactorImpl), RSSL_RET_FAILURE);
+		return (_reactorUnlockChannelShard(pReactorImpl, pShard), RSSL_RET_FAILURE);
 	}
 	
 	rsslResetReactorChannel(pReactorImpl, pReactorChannel);
@@ -2289,8 +2625,8 @@ RSSL_VA_API RsslRet rsslReactorAccept(RsslReactor *pReactor, RsslServer *pServer
 	if (_reactorChannelCopyRole(pReactorChannel, pRole, pError) != RSSL_RET_SUCCESS)
 	{
 		rsslCloseChannel(pChannel, &pError->rsslError);
-		_reactorMoveChannel(&pReactorImpl->channelPool, pReactorChannel);
-		return (reactorUnlockInterface(pReactorImpl), RSSL_RET_FAILURE);
+		_reactorMoveChannel(&pShard->channelPool, pReactorChannel);
+		return (_reactorUnlockChannelShard(pReactorImpl, pShard), RSSL_RET_FAILURE);
 	}
 
 	pReactorChannel->reactorChannel.pRsslChannel = pChannel;
@@ -2298,24 +2634,25 @@ RSSL_VA_API RsslRet rsslReactorAccept(RsslReactor *pReactor, RsslServer *pServer
 	pReactorChannel->reactorChannel.userSpecPtr = pOpts->rsslAcceptOptions.userSpecPtr;
 	pReactorChannel->initializationTimeout = pOpts->initializationTimeout;
 	pReactorChannel->connectionDebugFlags = pOpts->connectionDebugFlags;
+	pReactorChannel->directFlush = (pOpts->enableDirectFlush || pReactorImpl->directFlush) ? RSSL_TRUE : RSSL_FALSE;
 
 	if ((pReactorChannel->pTunnelManager = tunnelManagerOpen(pReactor, (RsslReactorChannel*)pReactorChannel, pError)) == NULL)
 	{
 		rsslCloseChannel(pChannel, &pError->rsslError);
-		return (reactorUnlockInterface(pReactorImpl), RSSL_RET_FAILURE);
+		return (_reactorUnlockChannelShard(pReactorImpl, pShard), RSSL_RET_FAILURE);
 	}
 
 	if (pReactorChannel->connectionDebugFlags != 0 && !RSSL_ERROR_INFO_CHECK((ret = rsslIoctl(pReactorChannel->reactorChannel.pRsslChannel, RSSL_DEBUG_FLAGS, (void*)&(pReactorChannel->connectionDebugFlags), &(pError->rsslError))) == RSSL_RET_SUCCESS, ret, pError))
 	{
 		rsslCloseChannel(pChannel, &pError->rsslError);
-		return (reactorUnlockInterface(pReactorImpl), RSSL_RET_FAILURE);
+		return (_reactorUnlockChannelShard(pReactorImpl, pShard), RSSL_RET_FAILURE);
 	}
 
 	if (!RSSL_ERROR_INFO_CHECK((ret = _reactorAddChannel(pReactorImpl, pReactorChannel, pError)) == RSSL_RET_SUCCESS, ret, pError))
 	{
 		_reactorShutdown(pReactorImpl, pError);
 		_reactorSendShutdownEvent(pReactorImpl, pError);
-		return (reactorUnlockInterface(pReactorImpl), RSSL_RET_FAILURE);
+		return (_reactorUnlockChannelShard(pReactorImpl, pShard), RSSL_RET_FAILURE);
 	}
 
 	/* Set additional accept options for WebSocket connections */
@@ -2324,48 +2661,105 @@ RSSL_VA_API RsslRet rsslReactorAccept(RsslReactor *pReactor, RsslServer *pServer
 		pReactorChannel->sendWSPingMessage = RSSL_TRUE;
 	}
 
-	++pReactorImpl->channelCount;
+	++pShard->channelCount;
 
-	return (reactorUnlockInterface(pReactorImpl), RSSL_RET_SUCCESS);
+	return (_reactorUnlockChannelShard(pReactorImpl, pShard), RSSL_RET_SUCCESS);
+}
+
+/* Adds the channels notified by the last wait on the shard's notifier to the channels to read from. */
+static void _reactorAddNotifiedChannels(RsslReactorShardImpl *pShard)
+{
+	int i;
+
+	for (i = 0; i < pShard->pNotifier->notifiedEventCount; ++i)
+	{
+		RsslNotifierEvent *pNotifierEvent = pShard->pNotifier->notifiedEvents[i];
+		RsslReactorChannelImpl *pReactorChannel;
+
+		if (pNotifierEvent == pShard->pQueueNotifierEvent)
+			continue;
+
+		pReactorChannel = (RsslReactorChannelImpl*)rsslNotifierEventGetObject(pNotifierEvent);
+		if (pReactorChannel->reactorParentQueue == &pReactorChannel->pShard->activeChannels)
+			_reactorAddReadyChannel(pShard->pReactorImpl, pReactorChannel);
+	}
+}
+
+/* Disconnects the active channels that have passed their ping timeout without sending either a ping or some data. */
+static RsslRet _reactorCheckPingTimeouts(RsslReactorShardImpl *pShard, RsslErrorInfo *pError)
+{
+	RsslReactorImpl *pReactorImpl = pShard->pReactorImpl;
+	RsslTimerWheelTimer *pTimer;
+
+	rsslTimerWheelAdvance(&pShard->pingTimeoutWheel, pShard->lastRecordedTimeMs);
+	while ((pTimer = rsslTimerWheelPopExpired(&pShard->pingTimeoutWheel)))
+	{
+		RsslReactorChannelImpl *pReactorChannel = (RsslReactorChannelImpl*)pTimer->pUserSpec;
+
+		/* Reading does not move the timer, so it may fire before the timeout is reached; it is then set
+		 * again from the last read. A channel that has something to read is read from first. */
+		if (pReactorChannel->readRet > 0 || rsslNotifierEventIsReadable(pReactorChannel->pNotifierEvent)
+				|| (pShard->lastRecordedTimeMs - pReactorChannel->lastPingReadMs) <= pReactorChannel->reactorChannel.pRsslChannel->pingTimeout * 1000)
+		{
+			_reactorSetPingTimeoutTimer(pReactorImpl, pReactorChannel);
+			continue;
+		}
+
+		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Channel ping timeout expired.");
+		if (_reactorHandleChannelDown(pReactorImpl, pReactorChannel, pError) != RSSL_RET_SUCCESS)
+			return RSSL_RET_FAILURE;
+	}
+
+	return RSSL_RET_SUCCESS;
 }
 
 RSSL_VA_API RsslRet rsslReactorDispatch(RsslReactor *pReactor, RsslReactorDispatchOptions *pDispatchOpts, RsslErrorInfo *pError)
 {
-	RsslReactorImpl *pReactorImpl = (RsslReactorImpl*)pReactor;
+	RsslReactorImpl *pReactorImpl = rsslReactorGetImpl(pReactor);
+	RsslReactorShardImpl *pShard = _reactorHandleShard(pReactor);
 	RsslRet ret;
 	RsslUInt32  channelsToCheck, channelsWithData;
 	RsslUInt32 maxMsgs = pDispatchOpts->maxMessages;
 
-	if ((ret = reactorLockInterface(pReactorImpl, RSSL_FALSE, pError)) != RSSL_RET_SUCCESS)
+	/* A channel is dispatched by its own shard, whichever handle it is given with. */
+	if (pDispatchOpts->pReactorChannel)
+		pShard = _reactorChannelShard(pReactorImpl, pDispatchOpts->pReactorChannel);
+
+	if ((ret = reactorLockShard(pShard, RSSL_FALSE, pError)) != RSSL_RET_SUCCESS)
 		return ret;
 
 	if (pReactorImpl->state != RSSL_REACTOR_ST_ACTIVE)
 	{
+		/* Another shard may have shut the reactor down, so the channels of this one are brought down as well. */
 		rsslSetErrorInfo(pError, RSSL_EIC_SHUTDOWN, RSSL_RET_FAILURE, __FILE__, __LINE__, "Reactor is shutting down.");
-		return (reactorUnlockInterface(pReactorImpl), RSSL_RET_FAILURE);
+		if (pReactorImpl->state == RSSL_REACTOR_ST_SHUT_DOWN)
+			_reactorShutdownShard(pShard, pError);
+		return (reactorUnlockShard(pShard), RSSL_RET_FAILURE);
 	}
 
 	/* Record current time. */
-	pReactorImpl->lastRecordedTimeMs = getCurrentTimeMs(pReactorImpl->ticksPerMsec);
+	pShard->lastRecordedTimeMs = getCurrentTimeMs(pReactorImpl->ticksPerMsec);
 
 	/* See which channels have something to read. */
-	if ((ret = rsslNotifierWait(pReactorImpl->pNotifier, 0)) < 0)
+	if ((ret = rsslNotifierWait(pShard->pNotifier, 0)) < 0)
 	{
 #ifdef WIN32
 		int notifierErrno = WSAGetLastError();
 		if (notifierErrno == WSAEINTR)
-			return (reactorUnlockInterface(pReactorImpl), RSSL_RET_SUCCESS);
+			return (reactorUnlockShard(pShard), RSSL_RET_SUCCESS);
 #else
 		int notifierErrno = errno;
 		if (notifierErrno == EINTR)
-			return (reactorUnlockInterface(pReactorImpl), RSSL_RET_SUCCESS);
+			return (reactorUnlockShard(pShard), RSSL_RET_SUCCESS);
 #endif
 		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "rsslNotifierWait() failed: %d", notifierErrno);
 		_reactorShutdown(pReactorImpl, pError);
 		_reactorSendShutdownEvent(pReactorImpl, pError);
-		return (reactorUnlockInterface(pReactorImpl), RSSL_RET_FAILURE);
+		return (reactorUnlockShard(pShard), RSSL_RET_FAILURE);
 	}
 
+	_reactorAddNotifiedChannels(pShard);
+
 	if (pReactorImpl->state == RSSL_REACTOR_ST_ACTIVE)
 	{
 		/* No particular channel was specified. Loop in round-robin fashion on all channels until either:
@@ -2375,34 +2769,48 @@ RSSL_VA_API RsslRet rsslReactorDispatch(RsslReactor *pReactor, RsslReactorDispat
 		{
 			RsslReactorChannelImpl *pReactorChannel;
 
-			if (rsslNotifierEventIsReadable(pReactorImpl->pQueueNotifierEvent))
+			if (rsslNotifierEventIsReadable(pShard->pQueueNotifierEvent))
 			{
 				RsslReactorEventQueue *pQueue;
 
 				/* Dispatch events from queues in a round-robin fashion until all are processed. */
-				while (maxMsgs > 0 && (pQueue = rsslReactorEventQueueGroupShift(&pReactorImpl->activeEventQueueGroup)))
+				while (maxMsgs > 0 && (pQueue = rsslReactorEventQueueGroupShift(&pShard->activeEventQueueGroup)))
 				{
 					if ((ret = _reactorDispatchEventFromQueue(pReactorImpl, pQueue, pError)) < RSSL_RET_SUCCESS)
 					{
+						/* The queue's next event is still being put by another thread; it will be dispatched on a later call. */
+						if (ret == RSSL_RET_READ_WOULD_BLOCK)
+							break;
+
 						_reactorShutdown(pReactorImpl, pError);
 						_reactorSendShutdownEvent(pReactorImpl, pError);
-						return (reactorUnlockInterface(pReactorImpl), ret);
+						return (reactorUnlockShard(pShard), ret);
 					}
 					if (maxMsgs > 0) --maxMsgs;
 				}
 			}
 
-			channelsWithData = channelsToCheck = rsslQueueGetElementCount(&pReactorImpl->activeChannels);
+			if (_reactorCheckPingTimeouts(pShard, pError) != RSSL_RET_SUCCESS)
+			{
+				_reactorShutdown(pReactorImpl, pError);
+				_reactorSendShutdownEvent(pReactorImpl, pError);
+				return (reactorUnlockShard(pShard), RSSL_RET_FAILURE);
+			}
+
+			channelsWithData = channelsToCheck = rsslQueueGetElementCount(&pShard->readyChannels);
 
+			/* Only the ready channels are visited, so idle channels add nothing to the cost of a dispatch. */
 			while(maxMsgs > 0 && channelsWithData > 0)
 			{
 				RsslQueueLink *pLink;
 				RsslBool isFdReadable;
 
-				pLink = rsslQueueRemoveFirstLink(&pReactorImpl->activeChannels);
-				rsslQueueAddLinkToBack(&pReactorImpl->activeChannels, pLink);
+				/* Channels may be closed by callbacks while dispatching. */
+				if (!(pLink = rsslQueueRemoveFirstLink(&pShard->readyChannels)))
+					break;
+				rsslQueueAddLinkToBack(&pShard->readyChannels, pLink);
 
-				pReactorChannel = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorChannelImpl, reactorQueueLink, pLink);
+				pReactorChannel = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorChannelImpl, readyLink, pLink);
 
 				isFdReadable = rsslNotifierEventIsReadable(pReactorChannel->pNotifierEvent);
 
@@ -2417,9 +2825,9 @@ RSSL_VA_API RsslRet rsslReactorDispatch(RsslReactor *pReactor, RsslReactorDispat
 						 * then it had a problem doing that and there's nothing more we can do to handle it. */
 						_reactorShutdown(pReactorImpl, pError);
 						_reactorSendShutdownEvent(pReactorImpl, pError);
-						return (reactorUnlockInterface(pReactorImpl), ret);
+						return (reactorUnlockShard(pShard), ret);
 					}
-					else if (pReactorChannel->reactorParentQueue != &pReactorImpl->activeChannels)
+					else if (pReactorChannel->reactorParentQueue != &pReactorChannel->pShard->activeChannels)
 					{
 						/* Channel is no longer active */
 						--channelsWithData;
@@ -2429,23 +2837,15 @@ RSSL_VA_API RsslRet rsslReactorDispatch(RsslReactor *pReactor, RsslReactorDispat
 						--channelsWithData;
 						if (isFdReadable)
 							rsslNotifierEventClearNotifiedFlags(pReactorChannel->pNotifierEvent);
+						rsslQueueRemoveLink(&pShard->readyChannels, &pReactorChannel->readyLink);
 					}
 					if (channelsToCheck > 0) --channelsToCheck;
 					if (maxMsgs > 0) --maxMsgs;
 				}
-				/* If not triggered to read, check if this channel has passed its ping timeout without sending either a ping or some data. */
 				else 
 				{
-					if ((pReactorImpl->lastRecordedTimeMs - pReactorChannel->lastPingReadMs) > pReactorChannel->reactorChannel.pRsslChannel->pingTimeout * 1000)
-					{
-						rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Channel ping timeout expired.");
-						if (_reactorHandleChannelDown(pReactorImpl, pReactorChannel, pError) != RSSL_RET_SUCCESS)
-						{
-							_reactorShutdown(pReactorImpl, pError);
-							_reactorSendShutdownEvent(pReactorImpl, pError);
-							return (reactorUnlockInterface(pReactorImpl), RSSL_RET_FAILURE);
-						}
-					}
+					/* Nothing more to read until the channel is notified again. */
+					rsslQueueRemoveLink(&pShard->readyChannels, &pReactorChannel->readyLink);
 					if (channelsToCheck > 0) --channelsToCheck;
 					--channelsWithData;
 				}
@@ -2454,7 +2854,7 @@ RSSL_VA_API RsslRet rsslReactorDispatch(RsslReactor *pReactor, RsslReactorDispat
 			if (channelsToCheck < channelsWithData)
 			{
 				/* Some channels had more data to read, so return positive value. */
-				return (reactorUnlockInterface(pReactorImpl), 1);
+				return (reactorUnlockShard(pShard), 1);
 			}
 			else
 			{
@@ -2464,20 +2864,23 @@ RSSL_VA_API RsslRet rsslReactorDispatch(RsslReactor *pReactor, RsslReactorDispat
 				while (channelsToCheck > 0)
 				{
 					RsslQueueLink *pLink;
-					pLink = rsslQueueRemoveFirstLink(&pReactorImpl->activeChannels);
-					rsslQueueAddLinkToBack(&pReactorImpl->activeChannels, pLink);
 
-					pReactorChannel = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorChannelImpl, reactorQueueLink, pLink);
+					if (!(pLink = rsslQueueRemoveFirstLink(&pShard->readyChannels)))
+						break;
+					rsslQueueAddLinkToBack(&pShard->readyChannels, pLink);
+
+					pReactorChannel = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorChannelImpl, readyLink, pLink);
 
 					/* A channel has something to read if either:
 					 * - The last return from rsslRead() was greater than zero, indicating there were still bytes in RSSL's queue
 					 * - The file descriptor is set because there is data from the socket */
 					if (pReactorChannel->readRet > 0 || rsslNotifierEventIsReadable(pReactorChannel->pNotifierEvent))
-						return (reactorUnlockInterface(pReactorImpl), 1);
+						return (reactorUnlockShard(pShard), 1);
 
+					rsslQueueRemoveLink(&pShard->readyChannels, &pReactorChannel->readyLink);
 					--channelsToCheck;
 				}
-				return (reactorUnlockInterface(pReactorImpl), 0);
+				return (reactorUnlockShard(pShard), 0);
 			}
 		}
 		else
@@ -2487,19 +2890,19 @@ RSSL_VA_API RsslRet rsslReactorDispatch(RsslReactor *pReactor, RsslReactorDispat
 			RsslReactorChannelImpl *pReactorChannel = (RsslReactorChannelImpl*)pDispatchOpts->pReactorChannel;
 
 			/* Since the application passed in this channel, make sure it is valid for this reactor and that it is active. */
-			if (!rsslReactorChannelIsValid(pReactorImpl, pReactorChannel, pError) || pReactorChannel->reactorParentQueue != &pReactorImpl->activeChannels)
+			if (!rsslReactorChannelIsValid(pReactorImpl, pReactorChannel, pError) || pReactorChannel->reactorParentQueue != &pReactorChannel->pShard->activeChannels)
 			{
 				rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Invalid channel was specified.");
-				return (reactorUnlockInterface(pReactorImpl), RSSL_RET_INVALID_ARGUMENT);
+				return (reactorUnlockShard(pShard), RSSL_RET_INVALID_ARGUMENT);
 			}
 
-			if (rsslNotifierEventIsReadable(pReactorImpl->pQueueNotifierEvent))
+			if (rsslNotifierEventIsReadable(pShard->pQueueNotifierEvent))
 			{
 
 				/* Dispatch from reactor queue */
 				while (maxMsgs > 0)
 				{
-					if ((ret = _reactorDispatchEventFromQueue(pReactorImpl, &pReactorImpl->reactorEventQueue, pError)) < RSSL_RET_SUCCESS)
+					if ((ret = _reactorDispatchEventFromQueue(pReactorImpl, pShard->pEventQueue, pError)) < RSSL_RET_SUCCESS)
 					{
 						if (ret == RSSL_RET_READ_WOULD_BLOCK)
 							break;
@@ -2507,7 +2910,7 @@ RSSL_VA_API RsslRet rsslReactorDispatch(RsslReactor *pReactor, RsslReactorDispat
 						{
 							_reactorShutdown(pReactorImpl, pError);
 							_reactorSendShutdownEvent(pReactorImpl, pError);
-							return (reactorUnlockInterface(pReactorImpl), ret);
+							return (reactorUnlockShard(pShard), ret);
 						}
 					}
 					else
@@ -2530,7 +2933,7 @@ RSSL_VA_API RsslRet rsslReactorDispatch(RsslReactor *pReactor, RsslReactorDispat
 						{
 							_reactorShutdown(pReactorImpl, pError);
 							_reactorSendShutdownEvent(pReactorImpl, pError);
-							return (reactorUnlockInterface(pReactorImpl), ret);
+							return (reactorUnlockShard(pShard), ret);
 						}
 					}
 					else
@@ -2549,7 +2952,7 @@ RSSL_VA_API RsslRet rsslReactorDispatch(RsslReactor *pReactor, RsslReactorDispat
 			 * - The channel is in the active state(it was not closed above)
 			 * - The last return from rsslRead() was greater than zero, indicating there were still bytes in RSSL's queue
 			 * - The file descriptor is set because there is data from the socket */
-			if (pReactorChannel->reactorParentQueue == &pReactorImpl->activeChannels)
+			if (pReactorChannel->reactorParentQueue == &pReactorChannel->pShard->activeChannels)
 			{
 				if (pReactorChannel->readRet > 0 || rsslNotifierEventIsReadable(pReactorChannel->pNotifierEvent))
 				{
@@ -2562,9 +2965,9 @@ RSSL_VA_API RsslRet rsslReactorDispatch(RsslReactor *pReactor, RsslReactorDispat
 							 * then it had a problem doing that and there's nothing more we can do to handle it. */
 							_reactorShutdown(pReactorImpl, pError);
 							_reactorSendShutdownEvent(pReactorImpl, pError);
-							return (reactorUnlockInterface(pReactorImpl), RSSL_RET_SUCCESS);
+							return (reactorUnlockShard(pShard), RSSL_RET_SUCCESS);
 						}
-						else if (pReactorChannel->reactorParentQueue != &pReactorImpl->activeChannels)
+						else if (pReactorChannel->reactorParentQueue != &pReactorChannel->pShard->activeChannels)
 						{
 							/* Channel is no longer active, so break out of the loop and don't dispatch anything more */
 							channelsToCheck = 0;
@@ -2579,14 +2982,14 @@ RSSL_VA_API RsslRet rsslReactorDispatch(RsslReactor *pReactor, RsslReactorDispat
 					}
 				}
 				/* If not triggered to read, check if this channel has passed its ping timeout without sending either a ping or some data. */
-				else if ((pReactorImpl->lastRecordedTimeMs - pReactorChannel->lastPingReadMs) > pReactorChannel->reactorChannel.pRsslChannel->pingTimeout * 1000)
+				else if ((pShard->lastRecordedTimeMs - pReactorChannel->lastPingReadMs) > pReactorChannel->reactorChannel.pRsslChannel->pingTimeout * 1000)
 				{
 					rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Channel ping timeout expired.");
 					if (_reactorHandleChannelDown(pReactorImpl, pReactorChannel, pError) != RSSL_RET_SUCCESS)
 					{
 						_reactorShutdown(pReactorImpl, pError);
 						_reactorSendShutdownEvent(pReactorImpl, pError);
-						return (reactorUnlockInterface(pReactorImpl), RSSL_RET_FAILURE);
+						return (reactorUnlockShard(pShard), RSSL_RET_FAILURE);
 					}
 					channelsToCheck = 0;
 				}
@@ -2596,21 +2999,22 @@ RSSL_VA_API RsslRet rsslReactorDispatch(RsslReactor *pReactor, RsslReactorDispat
 			else
 				channelsToCheck = 0;
 
-			return (reactorUnlockInterface(pReactorImpl), channelsToCheck);
+			return (reactorUnlockShard(pShard), channelsToCheck);
 		}
 		
 	}
 	else
 	{
 		rsslSetErrorInfo(pError, RSSL_EIC_SHUTDOWN, RSSL_RET_FAILURE, __FILE__, __LINE__, "Reactor is shutting down.");
-		return (reactorUnlockInterface(pReactorImpl), RSSL_RET_FAILURE);
+		return (reactorUnlockShard(pShard), RSSL_RET_FAILURE);
 	}
 }
 
 RSSL_VA_API RsslRet rsslReactorSubmit(RsslReactor *pReactor, RsslReactorChannel *pChannel, RsslBuffer *buffer, RsslReactorSubmitOptions *pSubmitOptions, RsslErrorInfo *pError)
 {
 	RsslRet ret;
-	RsslReactorImpl *pReactorImpl = (RsslReactorImpl*)pReactor;
+	RsslReactorImpl *pReactorImpl = rsslReactorGetImpl(pReactor);
+	RsslReactorShardImpl *pShard;
 	RsslReactorChannelImpl *pReactorChannel = (RsslReactorChannelImpl*)pChannel;
 	RsslUInt32 dummyBytesWritten, dummyUncompBytesWritten;
 	RsslBuffer *pMsgBuffer = NULL; /* The buffer to send JSON message to network only. */
@@ -2618,30 +3022,32 @@ RSSL_VA_API RsslRet rsslReactorSubmit(RsslReactor *pReactor, RsslReactorChannel
 	RsslReactorPackedBufferImpl *pPackedBufferImpl = NULL;
 	RsslHashLink *pHashLink;
 
-	if ((ret = reactorLockInterface(pReactorImpl, RSSL_TRUE, pError)) != RSSL_RET_SUCCESS)
+	pShard = _reactorChannelShard(pReactorImpl, pChannel);
+
+	if ((ret = reactorLockShard(pShard, RSSL_TRUE, pError)) != RSSL_RET_SUCCESS)
 		return ret;
 
 	/* Since the application passed in this channel, make sure it is valid for this reactor and that it is active. */
 	if (!pReactorChannel || !rsslReactorChannelIsValid(pReactorImpl, pReactorChannel, pError))
-		return (reactorUnlockInterface(pReactorImpl), RSSL_RET_INVALID_ARGUMENT);
+		return (reactorUnlockShard(pShard), RSSL_RET_INVALID_ARGUMENT);
 
 	if (pReactorImpl->state != RSSL_REACTOR_ST_ACTIVE)
 	{
 		rsslSetErrorInfo(pError, RSSL_EIC_SHUTDOWN, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "Reactor is shutting down.");
-		return (reactorUnlockInterface((RsslReactorImpl*)pReactor), RSSL_RET_FAILURE);
+		return (reactorUnlockShard(pShard), RSSL_RET_FAILURE);
 	}
 
-	if (pReactorChannel->reactorParentQueue != &pReactorImpl->activeChannels)
+	if (pReactorChannel->reactorParentQueue != &pReactorChannel->pShard->activeChannels)
 	{
 		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Channel is not active.");
-		return (reactorUnlockInterface((RsslReactorImpl*)pReactor), RSSL_RET_FAILURE);
+		return (reactorUnlockShard(pShard), RSSL_RET_FAILURE);
 	}
 
 	if (pReactorChannel->channelRole.base.roleType == RSSL_RC_RT_OMM_CONSUMER
 			&& pReactorChannel->channelRole.ommConsumerRole.watchlistOptions.enableWatchlist)
 	{
 		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "rsslReactorSubmit may not be used when watchlist is enabled.");
-		return (reactorUnlockInterface((RsslReactorImpl*)pReactor), RSSL_RET_INVALID_ARGUMENT);
+		return (reactorUnlockShard(pShard), RSSL_RET_INVALID_ARGUMENT);
 	}
 
 	/* Checks if there is a packed buffer for the JSON protocol */
@@ -2664,10 +3070,10 @@ RSSL_VA_API RsslRet rsslReactorSubmit(RsslReactor *pReactor, RsslReactorChannel
 		if (pReactorChannel->pWriteCallAgainUserBuffer == NULL)
 		{
 			/* Added checking to ensure that the JSON converter is initialized properly.*/
-			if (pReactorImpl->pJsonConverter == 0)
+			if (pShard->pJsonConverter == 0)
 			{
 				rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "The JSON converter library has not been initialized properly.");
-				return (reactorUnlockInterface((RsslReactorImpl*)pReactor), RSSL_RET_FAILURE);
+				return (reactorUnlockShard(pShard), RSSL_RET_FAILURE);
 			}
 
 			rsslClearMsg(&rsslMsg);
@@ -2688,11 +3094,11 @@ RSSL_VA_API RsslRet rsslReactorSubmit(RsslReactor *pReactor, RsslReactorChannel
 
 				rsslClearConvertRsslMsgToJsonOptions(&rjcOptions);
 				rjcOptions.jsonProtocolType = RSSL_JSON_JPT_JSON2; /* Supported only for Simplified JSON */
-				if ((rsslConvertRsslMsgToJson(pReactorImpl->pJsonConverter, &rjcOptions, &rsslMsg, &rjcError)) != RSSL_RET_SUCCESS)
+				if ((rsslConvertRsslMsgToJson(pShard->pJsonConverter, &rjcOptions, &rsslMsg, &rjcError)) != RSSL_RET_SUCCESS)
 				{
 					rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__,
 						"Failed to convert RWF to JSON protocol. Error text: %s", rjcError.text);
-					return (reactorUnlockInterface((RsslReactorImpl*)pReactor), RSSL_RET_FAILURE);
+					return (reactorUnlockShard(pShard), RSSL_RET_FAILURE);
 				}
 
 				rsslClearGetJsonMsgOptions(&getJsonMsgOptions);
@@ -2700,12 +3106,12 @@ RSSL_VA_API RsslRet rsslReactorSubmit(RsslReactor *pReactor, RsslReactorChannel
 				getJsonMsgOptions.streamId = rsslMsg.msgBase.streamId;
 				getJsonMsgOptions.isCloseMsg = (rsslMsg.msgBase.msgClass == RSSL_MC_CLOSE) ? RSSL_TRUE : RSSL_FALSE;
 
-				if ((ret = rsslGetConverterJsonMsg(pReactorImpl->pJsonConverter, &getJsonMsgOptions,
+				if ((ret = rsslGetConverterJsonMsg(pShard->pJsonConverter, &getJsonMsgOptions,
 					&jsonBuffer, &rjcError)) != RSSL_RET_SUCCESS)
 				{
 					rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__,
 						"Failed to get converted JSON message. Error text: %s", rjcError.text);
-					return (reactorUnlockInterface((RsslReactorImpl*)pReactor), RSSL_RET_FAILURE);
+					return (reactorUnlockShard(pShard), RSSL_RET_FAILURE);
 				}
 
 				/* Copies JSON data format to the buffer that belongs to RsslChannel */
@@ -2720,7 +3126,7 @@ RSSL_VA_API RsslRet rsslReactorSubmit(RsslReactor *pReactor, RsslReactorChannel
 				{
 					rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__,
 						"Failed to get a buffer for sending JSON message. Error text: %s", pError->rsslError.text);
-					return (reactorUnlockInterface((RsslReactorImpl*)pReactor), RSSL_RET_FAILURE);
+					return (reactorUnlockShard(pShard), RSSL_RET_FAILURE);
 				}
 
 				releaseUserBuffer = RSSL_TRUE; /* Release the passed in buffer when using a new buffer for the JSON message */
@@ -2737,7 +3143,7 @@ RSSL_VA_API RsslRet rsslReactorSubmit(RsslReactor *pReactor, RsslReactorChannel
 			{
 				rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, ret, __FILE__, __LINE__,
 					"rsslDecodeMsg() failed to decode the passed in buffer as RWF messages.");
-				return (reactorUnlockInterface((RsslReactorImpl*)pReactor), ret);
+				return (reactorUnlockShard(pShard), ret);
 			}
 		}
 		else
@@ -2763,7 +3169,7 @@ RSSL_VA_API RsslRet rsslReactorSubmit(RsslReactor *pReactor, RsslReactorChannel
 			{
 				rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, ret, __FILE__, __LINE__,
 					"Expected to receive the same user's buffer from the RSSL_RET_WRITE_CALL_AGAIN return value to write data again.");
-				return (reactorUnlockInterface((RsslReactorImpl*)pReactor), ret);
+				return (reactorUnlockShard(pShard), ret);
 			}
 		}
 	}
@@ -2831,7 +3237,7 @@ RSSL_VA_API RsslRet rsslReactorSubmit(RsslReactor *pReactor, RsslReactorChannel
 					rsslReleaseBuffer(pMsgBuffer, &rsslError);
 				}
 
-				return (reactorUnlockInterface(pReactorImpl), ret);
+				return (reactorUnlockShard(pShard), ret);
 			}
 		}
 	}
@@ -2857,13 +3263,14 @@ RSSL_VA_API RsslRet rsslReactorSubmit(RsslReactor *pReactor, RsslReactorChannel
 			rsslReleaseBuffer(buffer, &rsslError);
 		}
 
-		/* Returns the error when flush failed */
-		if (_reactorSendFlushRequest(pReactorImpl, pReactorChannel, pError) != RSSL_RET_SUCCESS)
+		/* Returns the error when flush failed. A write that must be called again waits for the worker to finish flushing. */
+		if ((ret == RSSL_RET_WRITE_CALL_AGAIN ? _reactorSendFlushRequest(pReactorImpl, pReactorChannel, pError) :
+				_reactorFlush(pReactorImpl, pReactorChannel, pError)) != RSSL_RET_SUCCESS)
 		{
-			return (reactorUnlockInterface(pReactorImpl), pError->rsslError.rsslErrorId);
+			return (reactorUnlockShard(pShard), pError->rsslError.rsslErrorId);
 		}
 
-		return (reactorUnlockInterface(pReactorImpl), ret);
+		return (reactorUnlockShard(pShard), ret);
 	}
 
 	if (releaseUserBuffer)
@@ -2872,7 +3279,7 @@ RSSL_VA_API RsslRet rsslReactorSubmit(RsslReactor *pReactor, RsslReactorChannel
 		rsslReleaseBuffer(buffer, &rsslError);
 	}
 
-	return (reactorUnlockInterface((RsslReactorImpl*)pReactor), ret);
+	return (reactorUnlockShard(pShard), ret);
 }
 
 RsslUInt32 _reactorMsgEncodedSize(RsslMsg *pMsg)
@@ -2896,22 +3303,25 @@ RsslUInt32 _reactorMsgEncodedSize(RsslMsg *pMsg)
 
 RSSL_VA_API RsslRet rsslReactorSubmitMsg(RsslReactor *pReactor, RsslReactorChannel *pChannel, RsslReactorSubmitMsgOptions *pOptions, RsslErrorInfo *pError)
 {
-	RsslReactorImpl *pReactorImpl = (RsslReactorImpl*)pReactor;
+	RsslReactorImpl *pReactorImpl = rsslReactorGetImpl(pReactor);
+	RsslReactorShardImpl *pShard;
 	RsslReactorChannelImpl *pReactorChannel = (RsslReactorChannelImpl*)pChannel;
 	RsslRet ret;
 	RsslBool handleWarmStandby = RSSL_FALSE;
 
-	if ((ret = reactorLockInterface(pReactorImpl, RSSL_TRUE, pError)) != RSSL_RET_SUCCESS)
+	pShard = _reactorChannelShard(pReactorImpl, pChannel);
+
+	if ((ret = reactorLockShard(pShard, RSSL_TRUE, pError)) != RSSL_RET_SUCCESS)
 		return ret;
 
 	/* Since the application passed in this channel, make sure it is valid for this reactor and that it is active. */
 	if (!pReactorChannel || !rsslReactorChannelIsValid(pReactorImpl, pReactorChannel, pError))
-		return (reactorUnlockInterface(pReactorImpl), RSSL_RET_INVALID_ARGUMENT);
+		return (reactorUnlockShard(pShard), RSSL_RET_INVALID_ARGUMENT);
 
 	if (pReactorImpl->state != RSSL_REACTOR_ST_ACTIVE)
 	{
 		rsslSetErrorInfo(pError, RSSL_EIC_SHUTDOWN, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "Reactor is shutting down.");
-		return (reactorUnlockInterface((RsslReactorImpl*)pReactor), RSSL_RET_FAILURE);
+		return (reactorUnlockShard(pShard), RSSL_RET_FAILURE);
 	}
 
 	handleWarmStandby = _reactorHandlesWarmStandby(pReactorChannel);
@@ -2940,12 +3350,12 @@ RSSL_VA_API RsslRet rsslReactorSubmitMsg(RsslReactor *pReactor, RsslReactorChann
 		if (handleWarmStandby == RSSL_FALSE)
 		{
 			ret = _reactorSubmitWatchlistMsg(pReactorImpl, pReactorChannel, &processOpts, pError);
-			return (reactorUnlockInterface((RsslReactorImpl*)pReactor), ret);
+			return (reactorUnlockShard(pShard), ret);
 		}
 		else
 		{
 			ret = _reactorWSWriteWatchlistMsg(pReactorImpl, pReactorChannel, pOptions, &processOpts, pError);
-			return (reactorUnlockInterface((RsslReactorImpl*)pReactor), ret);
+			return (reactorUnlockShard(pShard), ret);
 		}
 	}
 	else
@@ -2954,16 +3364,16 @@ RSSL_VA_API RsslRet rsslReactorSubmitMsg(RsslReactor *pReactor, RsslReactorChann
 
 		RsslUInt32 msgSize;
 
-		if (pReactorChannel->reactorParentQueue != &pReactorImpl->activeChannels)
+		if (pReactorChannel->reactorParentQueue != &pReactorChannel->pShard->activeChannels)
 		{
 			rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Channel is not active.");
-			return (reactorUnlockInterface((RsslReactorImpl*)pReactor), RSSL_RET_FAILURE);
+			return (reactorUnlockShard(pShard), RSSL_RET_FAILURE);
 		}
 
 		if (pReactorChannel->pWriteCallAgainBuffer)
 		{
 			rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_BUFFER_NO_BUFFERS, __FILE__, __LINE__, "Writing of fragmented buffer still in progress.");
-			return (reactorUnlockInterface((RsslReactorImpl*)pReactor), RSSL_RET_BUFFER_NO_BUFFERS);
+			return (reactorUnlockShard(pShard), RSSL_RET_BUFFER_NO_BUFFERS);
 		}
 
 		if (pOptions->pRsslMsg)
@@ -2980,7 +3390,7 @@ RSSL_VA_API RsslRet rsslReactorSubmitMsg(RsslReactor *pReactor, RsslReactorChann
 								&pError->rsslError)))
 				{
 					rsslSetErrorInfoLocation(pError, __FILE__, __LINE__);
-					return (reactorUnlockInterface((RsslReactorImpl*)pReactor), pError->rsslError.rsslErrorId);
+					return (reactorUnlockShard(pShard), pError->rsslError.rsslErrorId);
 				}
 
 				rsslClearEncodeIterator(&encodeIter);
@@ -3002,7 +3412,7 @@ RSSL_VA_API RsslRet rsslReactorSubmitMsg(RsslReactor *pReactor, RsslReactorChann
 					default:
 					{
 						rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, ret, __FILE__, __LINE__, "Message encoding failure.");
-						return (reactorUnlockInterface((RsslReactorImpl*)pReactor), ret);
+						return (reactorUnlockShard(pShard), ret);
 					}
 				}
 
@@ -3010,20 +3420,20 @@ RSSL_VA_API RsslRet rsslReactorSubmitMsg(RsslReactor *pReactor, RsslReactorChann
 
 			pWriteBuffer->length = rsslGetEncodedBufferLength(&encodeIter);
 
-			ret = _reactorSubmit((RsslReactorImpl*)pReactor, pReactorChannel, 
+			ret = _reactorSubmit(pReactorImpl, pReactorChannel, 
 					pWriteBuffer, pError);
-			return (reactorUnlockInterface((RsslReactorImpl*)pReactor), ret);
+			return (reactorUnlockShard(pShard), ret);
 
 		}
 		else if (pOptions->pRDMMsg)
 		{
 			ret = _reactorSendRDMMessage(pReactorImpl, pReactorChannel, pOptions->pRDMMsg, pError);
-			return (reactorUnlockInterface((RsslReactorImpl*)pReactor), ret);
+			return (reactorUnlockShard(pShard), ret);
 		}
 		else
 		{
 			rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "No message or buffer provided.");
-			return (reactorUnlockInterface((RsslReactorImpl*)pReactor), RSSL_RET_INVALID_ARGUMENT);
+			return (reactorUnlockShard(pShard), RSSL_RET_INVALID_ARGUMENT);
 		}
 	}
 
@@ -3057,10 +3467,7 @@ static RsslRet _reactorSendRDMMessage(RsslReactorImpl *pReactorImpl, RsslReactor
 			return ret;
 
 		if (pReactorChannel->pWatchlist->state & RSSLWL_STF_NEED_FLUSH) 
-		{
-			pReactorChannel->writeRet = 1;
-			return _reactorSendFlushRequest(pReactorImpl, pReactorChannel, pError);
-		}
+			return _reactorFlushWatchlist(pReactorImpl, pReactorChannel, pError);
 
 		return RSSL_RET_SUCCESS;
 	}
@@ -3125,12 +3532,12 @@ static RsslRet _reactorHandleChannelDown(RsslReactorImpl *pReactorImpl, RsslReac
 {
 	RsslReactorChannelEventImpl *pEvent;
 
-	if (pReactorChannel->reactorParentQueue == &pReactorImpl->inactiveChannels)
+	if (pReactorChannel->reactorParentQueue == &pReactorChannel->pShard->inactiveChannels)
 		return RSSL_RET_SUCCESS; /* We are already in the process of closing this channel(this may occur if the worker thread also received an error for this channel). Nothing to do. */
 
 	pEvent = (RsslReactorChannelEventImpl*)rsslReactorEventQueueGetFromPool(&pReactorImpl->reactorWorker.workerQueue);
 
-	if (rsslNotifierRemoveEvent(pReactorImpl->pNotifier, pReactorChannel->pNotifierEvent) < 0)
+	if (rsslNotifierRemoveEvent(pReactorChannel->pShard->pNotifier, pReactorChannel->pNotifierEvent) < 0)
 	{
 		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, 
 				"Failed to remove notification event for disconnected channel.");
@@ -3139,7 +3546,7 @@ static RsslRet _reactorHandleChannelDown(RsslReactorImpl *pReactorImpl, RsslReac
 
 	if(pReactorChannel->reconnectAttemptLimit != 0 && pReactorChannel->reconnectAttemptCount != pReactorChannel->reconnectAttemptLimit)
 	{
-		_reactorMoveChannel(&pReactorImpl->reconnectingChannels, pReactorChannel);
+		_reactorMoveChannel(&pReactorChannel->pShard->reconnectingChannels, pReactorChannel);
 
 		/* Notify worker that this channel is down, but recovering */
 		rsslClearReactorChannelEventImpl(pEvent);
@@ -3152,7 +3559,7 @@ static RsslRet _reactorHandleChannelDown(RsslReactorImpl *pReactorImpl, RsslReac
 	}
 	else
 	{
-		_reactorMoveChannel(&pReactorImpl->inactiveChannels, pReactorChannel);
+		_reactorMoveChannel(&pReactorChannel->pShard->inactiveChannels, pReactorChannel);
 
 		/* Notify worker that this channel is down */
 		rsslClearReactorChannelEventImpl(pEvent);
@@ -3200,13 +3607,13 @@ static RsslRet _reactorHandleChannelDown(RsslReactorImpl *pReactorImpl, RsslReac
 							if (pReactorChannel != pNextReactorChannel && pNextReactorChannel->reactorChannel.pRsslChannel &&
 								pNextReactorChannel->reactorChannel.pRsslChannel->state == RSSL_CH_STATE_ACTIVE)
 							{
-								RsslReactorWarmStanbyEvent *pReactorWarmStanbyEvent = (RsslReactorWarmStanbyEvent*)rsslReactorEventQueueGetFromPool(&pReactorImpl->reactorEventQueue);
+								RsslReactorWarmStanbyEvent *pReactorWarmStanbyEvent = (RsslReactorWarmStanbyEvent*)rsslReactorEventQueueGetFromPool(rsslReactorChannelEventQueue(pReactorChannel));
 								rsslClearReactorWarmStanbyEvent(pReactorWarmStanbyEvent);
 
 								pReactorWarmStanbyEvent->reactorWarmStandByEventType = RSSL_RCIMPL_WSBET_CHANGE_ACTIVE_TO_STANDBY_SERVER;
 								pReactorWarmStanbyEvent->pReactorChannel = (RsslReactorChannel*)pReactorChannel;
 								pWarmStandByHandlerImpl->pNextActiveReactorChannel = pNextReactorChannel;
-								if (!RSSL_ERROR_INFO_CHECK(rsslReactorEventQueuePut(&pReactorImpl->reactorEventQueue, (RsslReactorEventImpl*)pReactorWarmStanbyEvent) == RSSL_RET_SUCCESS, RSSL_RET_FAILURE, pError))
+								if (!RSSL_ERROR_INFO_CHECK(rsslReactorEventQueuePut(rsslReactorChannelEventQueue(pReactorChannel), (RsslReactorEventImpl*)pReactorWarmStanbyEvent) == RSSL_RET_SUCCESS, RSSL_RET_FAILURE, pError))
 								{
 									RSSL_MUTEX_UNLOCK(&pWarmStandByHandlerImpl->warmStandByHandlerMutex);
 									return RSSL_RET_FAILURE;
@@ -3250,13 +3657,13 @@ static RsslRet _reactorHandleChannelDown(RsslReactorImpl *pReactorImpl, RsslReac
 									if (pReactorChannel != pNextReactorChannel && pNextReactorChannel->reactorChannel.pRsslChannel &&
 										pNextReactorChannel->reactorChannel.pRsslChannel->state == RSSL_CH_STATE_ACTIVE)
 									{
-										RsslReactorWarmStanbyEvent *pReactorWarmStanbyEvent = (RsslReactorWarmStanbyEvent*)rsslReactorEventQueueGetFromPool(&pReactorImpl->reactorEventQueue);
+										RsslReactorWarmStanbyEvent *pReactorWarmStanbyEvent = (RsslReactorWarmStanbyEvent*)rsslReactorEventQueueGetFromPool(rsslReactorChannelEventQueue(pReactorChannel));
 										rsslClearReactorWarmStanbyEvent(pReactorWarmStanbyEvent);
 
 										pReactorWarmStanbyEvent->reactorWarmStandByEventType = RSSL_RCIMPL_WSBET_CHANGE_ACTIVE_TO_STANDBY_SERVER;
 										pReactorWarmStanbyEvent->pReactorChannel = (RsslReactorChannel*)pReactorChannel;
 										pWarmStandByHandlerImpl->pNextActiveReactorChannel = pNextReactorChannel;
-										if (!RSSL_ERROR_INFO_CHECK(rsslReactorEventQueuePut(&pReactorImpl->reactorEventQueue, (RsslReactorEventImpl*)pReactorWarmStanbyEvent) == RSSL_RET_SUCCESS, RSSL_RET_FAILURE, pError))
+										if (!RSSL_ERROR_INFO_CHECK(rsslReactorEventQueuePut(rsslReactorChannelEventQueue(pReactorChannel), (RsslReactorEventImpl*)pReactorWarmStanbyEvent) == RSSL_RET_SUCCESS, RSSL_RET_FAILURE, pError))
 										{
 											RSSL_MUTEX_UNLOCK(&pWarmStandByHandlerImpl->warmStandByHandlerMutex);
 											return RSSL_RET_FAILURE;
@@ -3272,14 +3679,14 @@ static RsslRet _reactorHandleChannelDown(RsslReactorImpl *pReactorImpl, RsslReac
 				}
 				else
 				{
-					RsslReactorWarmStanbyEvent *pReactorWarmStanbyEvent = (RsslReactorWarmStanbyEvent*)rsslReactorEventQueueGetFromPool(&pReactorImpl->reactorEventQueue);
+					RsslReactorWarmStanbyEvent *pReactorWarmStanbyEvent = (RsslReactorWarmStanbyEvent*)rsslReactorEventQueueGetFromPool(rsslReactorChannelEventQueue(pReactorChannel));
 					rsslClearReactorWarmStanbyEvent(pReactorWarmStanbyEvent);
 
 					/* Per service based warm standby */
 					pReactorWarmStanbyEvent->reactorWarmStandByEventType = RSSL_RCIMPL_WSBET_CHANGE_ACTIVE_TO_STANDBY_SERVICE_CHANNEL_DOWN;
 					pReactorWarmStanbyEvent->pReactorChannel = (RsslReactorChannel*)pReactorChannel;
 
-					if (!RSSL_ERROR_INFO_CHECK(rsslReactorEventQueuePut(&pReactorImpl->reactorEventQueue, (RsslReactorEventImpl*)pReactorWarmStanbyEvent) == RSSL_RET_SUCCESS, RSSL_RET_FAILURE, pError))
+					if (!RSSL_ERROR_INFO_CHECK(rsslReactorEventQueuePut(rsslReactorChannelEventQueue(pReactorChannel), (RsslReactorEventImpl*)pReactorWarmStanbyEvent) == RSSL_RET_SUCCESS, RSSL_RET_FAILURE, pError))
 					{
 						return RSSL_RET_FAILURE;
 					}
@@ -3308,7 +3715,7 @@ static RsslRet _reactorHandleChannelDown(RsslReactorImpl *pReactorImpl, RsslReac
 					{
 						pWarmStandByHandlerImpl->warmStandByHandlerState |= RSSL_RWSB_STATE_CLOSING_STANDBY_CHANNELS;
 						pEvent->channelEvent.channelEventType = RSSL_RC_CET_CHANNEL_DOWN_RECONNECTING;
-						_reactorMoveChannel(&pReactorImpl->reconnectingChannels, pReactorChannel);
+						_reactorMoveChannel(&pReactorChannel->pShard->reconnectingChannels, pReactorChannel);
 						pReactorChannel->reconnectAttemptCount = 0;
 					}
 				}
@@ -3529,7 +3936,7 @@ static RsslRet _reactorHandleChannelDown(RsslReactorImpl *pReactorImpl, RsslReac
 			return ret;
 	}
 
-	if(pReactorChannel->reactorParentQueue ==  &pReactorImpl->closingChannels)
+	if(pReactorChannel->reactorParentQueue ==  &pReactorChannel->pShard->closingChannels)
 	{
 		rsslReactorEventQueueReturnToPool((RsslReactorEventImpl*)pEvent, &pReactorImpl->reactorWorker.workerQueue, pReactorImpl->maxEventsInPool);
 		return RSSL_RET_SUCCESS;
@@ -3546,10 +3953,10 @@ static RsslRet _reactorDispatchWatchlist(RsslReactorImpl *pReactorImpl, RsslReac
 	RsslReactorChannelEventImpl *pEvent;
 	RsslRet ret;
 
-	if (pReactorChannel->reactorParentQueue == &pReactorImpl->closingChannels)
+	if (pReactorChannel->reactorParentQueue == &pReactorChannel->pShard->closingChannels)
 		return RSSL_RET_SUCCESS;
 
-	ret = rsslWatchlistDispatch(pReactorChannel->pWatchlist, pReactorImpl->lastRecordedTimeMs, pError);
+	ret = rsslWatchlistDispatch(pReactorChannel->pWatchlist, pReactorChannel->pShard->lastRecordedTimeMs, pError);
 	if (ret < RSSL_RET_SUCCESS)
 		return (_reactorHandleChannelDown(pReactorImpl, pReactorChannel, pError));
 	else 
@@ -3560,10 +3967,7 @@ static RsslRet _reactorDispatchWatchlist(RsslReactorImpl *pReactorImpl, RsslReac
 				return ret;
 
 		if (pReactorChannel->pWatchlist->state & RSSLWL_STF_NEED_FLUSH) 
-		{
-			pReactorChannel->writeRet = 1;
-			return _reactorSendFlushRequest(pReactorImpl, pReactorChannel, pError);
-		}
+			return _reactorFlushWatchlist(pReactorImpl, pReactorChannel, pError);
 		else if (ret > RSSL_RET_SUCCESS && !pReactorChannel->wlDispatchEventQueued)
 		{
 			pEvent = (RsslReactorChannelEventImpl*)rsslReactorEventQueueGetFromPool(&pReactorChannel->eventQueue);
@@ -3583,7 +3987,7 @@ static RsslRet _reactorReadWatchlistMsg(RsslReactorImpl *pReactorImpl, RsslReact
 {
 	RsslRet ret;
 
-	if ((ret = rsslWatchlistReadMsg(pReactorChannel->pWatchlist, pOptions, pWsOption, pReactorImpl->lastRecordedTimeMs, pError)) < RSSL_RET_SUCCESS)
+	if ((ret = rsslWatchlistReadMsg(pReactorChannel->pWatchlist, pOptions, pWsOption, pReactorChannel->pShard->lastRecordedTimeMs, pError)) < RSSL_RET_SUCCESS)
 		return _reactorHandleChannelDown(pReactorImpl, pReactorChannel, pError);
 
 	if (pReactorImpl->state != RSSL_REACTOR_ST_ACTIVE)
@@ -3596,8 +4000,7 @@ static RsslRet _reactorReadWatchlistMsg(RsslReactorImpl *pReactorImpl, RsslReact
 	if (pReactorChannel->pWatchlist->state & RSSLWL_STF_NEED_FLUSH) 
 	{
 		RsslRet flushRet;
-		pReactorChannel->writeRet = 1;
-		flushRet =  _reactorSendFlushRequest(pReactorImpl, pReactorChannel, pError);
+		flushRet =  _reactorFlushWatchlist(pReactorImpl, pReactorChannel, pError);
 		if (flushRet < RSSL_RET_SUCCESS)
 			return flushRet;
 	}
@@ -3641,8 +4044,7 @@ static RsslRet _reactorSubmitWatchlistMsg(RsslReactorImpl *pReactorImpl, RsslRea
 	if (pReactorChannel->pWatchlist->state & RSSLWL_STF_NEED_FLUSH) 
 	{
 		RsslRet flushRet;
-		pReactorChannel->writeRet = 1;
-		flushRet =  _reactorSendFlushRequest(pReactorImpl, pReactorChannel, pError);
+		flushRet =  _reactorFlushWatchlist(pReactorImpl, pReactorChannel, pError);
 		if (flushRet < RSSL_RET_SUCCESS)
 			return flushRet;
 	}
@@ -3672,21 +4074,21 @@ static RsslRet _processingReactorChannelShutdown(RsslReactorImpl *pReactorImpl,
 	RsslReactorChannelEventImpl *pEvent = NULL;
 
 	/* Channel is in the process of being closed. */
-	if (pReactorChannel->reactorParentQueue == &pReactorImpl->closingChannels)
+	if (pReactorChannel->reactorParentQueue == &pReactorChannel->pShard->closingChannels)
 	{
 		return RSSL_RET_SUCCESS;
 	}
 		
 	pEvent = (RsslReactorChannelEventImpl*)rsslReactorEventQueueGetFromPool(&pReactorImpl->reactorWorker.workerQueue);
 
-	if (rsslNotifierRemoveEvent(pReactorImpl->pNotifier, pReactorChannel->pNotifierEvent) < 0)
+	if (rsslNotifierRemoveEvent(pReactorChannel->pShard->pNotifier, pReactorChannel->pNotifierEvent) < 0)
 	{
 		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__,
 			"Failed to remove notification event for disconnected channel.");
 		return RSSL_RET_FAILURE;
 	}
 
-	_reactorMoveChannel(&pReactorImpl->closingChannels, pReactorChannel);
+	_reactorMoveChannel(&pReactorChannel->pShard->closingChannels, pReactorChannel);
 
 	pReactorChannel->pWriteCallAgainUserBuffer = NULL;
 	pReactorChannel->pUserBufferWriteCallAgain = NULL;
@@ -3713,11 +4115,14 @@ static RsslRet _processingReactorChannelShutdown(RsslReactorImpl *pReactorImpl,
 
 RSSL_VA_API RsslRet rsslReactorCloseChannel(RsslReactor *pReactor, RsslReactorChannel *pChannel, RsslErrorInfo *pError)
 {
-	RsslReactorImpl *pReactorImpl = (RsslReactorImpl*)pReactor;
+	RsslReactorImpl *pReactorImpl = rsslReactorGetImpl(pReactor);
+	RsslReactorShardImpl *pShard;
 	RsslReactorChannelImpl *pReactorChannel;
 	RsslRet ret;
 
-	if ((ret = reactorLockInterface(pReactorImpl, RSSL_TRUE, pError)) != RSSL_RET_SUCCESS)
+	pShard = _reactorChannelShard(pReactorImpl, pChannel);
+
+	if ((ret = reactorLockShard(pShard, RSSL_TRUE, pError)) != RSSL_RET_SUCCESS)
 		return ret;
 
 	pReactorChannel = (RsslReactorChannelImpl*)pChannel;
@@ -3725,14 +4130,14 @@ RSSL_VA_API RsslRet rsslReactorCloseChannel(RsslReactor *pReactor, RsslReactorCh
 	if (!pReactorChannel || !rsslReactorChannelIsValid(pReactorImpl, pReactorChannel, pError))
 	{
 		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "Invalid argument");
-		return (reactorUnlockInterface(pReactorImpl), RSSL_RET_INVALID_ARGUMENT );
+		return (reactorUnlockShard(pShard), RSSL_RET_INVALID_ARGUMENT );
 	}
 
-	if (pReactorChannel->reactorParentQueue == &pReactorImpl->closingChannels)
+	if (pReactorChannel->reactorParentQueue == &pReactorChannel->pShard->closingChannels)
 	{
 		/* Channel is in the process of being closed. */
 
-		return (reactorUnlockInterface(pReactorImpl), RSSL_RET_SUCCESS);
+		return (reactorUnlockShard(pShard), RSSL_RET_SUCCESS);
 	}
 	else
 	{
@@ -3746,12 +4151,12 @@ RSSL_VA_API RsslRet rsslReactorCloseChannel(RsslReactor *pReactor, RsslReactorCh
 			if (pReactorWarmStandbyHandlerImpl->warmStandByHandlerState == RSSL_RWSB_STATE_CLOSING || 
 				pReactorWarmStandbyHandlerImpl->warmStandByHandlerState == RSSL_RWSB_STATE_INACTIVE)
 			{
-				return (reactorUnlockInterface(pReactorImpl), RSSL_RET_SUCCESS);
+				return (reactorUnlockShard(pShard), RSSL_RET_SUCCESS);
 			}
 
 			pReactorWarmStandbyHandlerImpl->warmStandByHandlerState = RSSL_RWSB_STATE_CLOSING;
 
-			rsslQueueAddLinkToBack(&pReactorImpl->closingWarmstandbyChannel, &pReactorWarmStandbyHandlerImpl->reactorQueueLink);
+			rsslQueueAddLinkToBack(&pReactorChannel->pShard->closingWarmstandbyChannel, &pReactorWarmStandbyHandlerImpl->reactorQueueLink);
 
 			RSSL_MUTEX_LOCK(&pReactorChannel->pWarmStandByHandlerImpl->warmStandByHandlerMutex);
 			/* Submits to a channel that belongs to the warm standby feature and it is active */
@@ -3784,7 +4189,7 @@ RSSL_VA_API RsslRet rsslReactorCloseChannel(RsslReactor *pReactor, RsslReactorCh
 				pEvent->channelEvent.pError = pError;
 
 				if (!RSSL_ERROR_INFO_CHECK(rsslReactorEventQueuePut(&pReactorImpl->reactorWorker.workerQueue, (RsslReactorEventImpl*)pEvent) == RSSL_RET_SUCCESS, RSSL_RET_FAILURE, pError))
-					return (reactorUnlockInterface(pReactorImpl), RSSL_RET_FAILURE);
+					return (reactorUnlockShard(pShard), RSSL_RET_FAILURE);
 			}
 		}
 		else
@@ -3800,7 +4205,7 @@ RSSL_VA_API RsslRet rsslReactorCloseChannel(RsslReactor *pReactor, RsslReactorCh
 			ret = _processingReactorChannelShutdown(pReactorImpl, pReactorChannel, pError);
 		}
 
-		return (reactorUnlockInterface(pReactorImpl), ret);
+		return (reactorUnlockShard(pShard), ret);
 	}
 }
 
@@ -3834,10 +4239,7 @@ static RsslRet _reactorHandleTunnelManagerEvents(RsslReactorImpl *pReactorImpl,
 
 	/* If watchlist is on, messages may have gone through it so check if a flush is needed. */
 	if (pReactorChannel->pWatchlist && pReactorChannel->pWatchlist->state & RSSLWL_STF_NEED_FLUSH)
-	{
-		pReactorChannel->writeRet = 1;
-		return _reactorSendFlushRequest(pReactorImpl, pReactorChannel, pError);
-	}
+		return _reactorFlushWatchlist(pReactorImpl, pReactorChannel, pError);
 
 	return RSSL_RET_SUCCESS;
 }
@@ -3880,7 +4282,7 @@ static RsslRet _reactorDispatchEventFromQueue(RsslReactorImpl *pReactorImpl, Rss
 				RsslReactorFlushEvent *pFlushEvent = (RsslReactorFlushEvent*)pEvent;
 				pReactorChannel = (RsslReactorChannelImpl*)pFlushEvent->pReactorChannel;
 
-				if (pReactorChannel->reactorParentQueue == &pReactorImpl->activeChannels)
+				if (pReactorChannel->reactorParentQueue == &pReactorChannel->pShard->activeChannels)
 				{
 					switch(pFlushEvent->flushEventType)
 					{
@@ -3941,20 +4343,20 @@ static RsslRet _reactorDispatchEventFromQueue(RsslReactorImpl *pReactorImpl, Rss
 				RsslReactorChannelEventImpl *pConnEvent = (RsslReactorChannelEventImpl*)pEvent;
 				pReactorChannel = (RsslReactorChannelImpl*)pConnEvent->channelEvent.pReactorChannel;
 
-				if (pReactorChannel->reactorParentQueue != &pReactorImpl->closingChannels)
+				if (pReactorChannel->reactorParentQueue != &pReactorChannel->pShard->closingChannels)
 				{
 
 				    switch((int)pConnEvent->channelEvent.channelEventType)
 					{
 						case RSSL_RC_CET_CHANNEL_UP:
 							/* Channel has been initialized by worker thread and is ready for reading & writing. */
-							if (rsslNotifierAddEvent(pReactorImpl->pNotifier, pReactorChannel->pNotifierEvent, (int)(pReactorChannel->reactorChannel.socketId), pReactorChannel) < 0)
+							if (rsslNotifierAddEvent(pReactorChannel->pShard->pNotifier, pReactorChannel->pNotifierEvent, (int)(pReactorChannel->reactorChannel.socketId), pReactorChannel) < 0)
 							{
 								rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, 
 										"Failed to add notification event for initialized channel.");
 								return RSSL_RET_FAILURE;
 							}
-							if (rsslNotifierRegisterRead(pReactorImpl->pNotifier, pReactorChannel->pNotifierEvent) < 0)
+							if (rsslNotifierRegisterRead(pReactorChannel->pShard->pNotifier, pReactorChannel->pNotifierEvent) < 0)
 							{
 								rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, 
 										"Failed to register read notification for initialized channel.");
@@ -3973,8 +4375,9 @@ static RsslRet _reactorDispatchEventFromQueue(RsslReactorImpl *pReactorImpl, Rss
 									pReactorChannel->connectionOptList[pReactorChannel->connectionListIter].reconnectEndpointAttemptCount = 0;
 							}
 
-							_reactorMoveChannel(&pReactorImpl->activeChannels, pReactorChannel);
-							pReactorChannel->lastPingReadMs = pReactorImpl->lastRecordedTimeMs;
+							_reactorMoveChannel(&pReactorChannel->pShard->activeChannels, pReactorChannel);
+							pReactorChannel->lastPingReadMs = pReactorChannel->pShard->lastRecordedTimeMs;
+							_reactorSetPingTimeoutTimer(pReactorImpl, pReactorChannel);
 
 							{
 								RsslReactorChannel* pCallbackChannel = (RsslReactorChannel*)pReactorChannel;
@@ -4123,7 +4526,7 @@ static RsslRet _reactorDispatchEventFromQueue(RsslReactorImpl *pReactorImpl, Rss
 								}
 							}
 
-							if (cret == RSSL_RC_CRET_SUCCESS && pReactorChannel->reactorParentQueue != &pReactorImpl->closingChannels)
+							if (cret == RSSL_RC_CRET_SUCCESS && pReactorChannel->reactorParentQueue != &pReactorChannel->pShard->closingChannels)
 							{
 								switch(pReactorChannel->channelRole.base.roleType)
 								{
@@ -4226,7 +4629,7 @@ static RsslRet _reactorDispatchEventFromQueue(RsslReactorImpl *pReactorImpl, Rss
 							/* If the channel is currently down, this event may be due to the worker finding out at the same time the reactor did.
 							 * Ignore this event. Otherwise, it is redundant to provide to the application (we already know it's down), and it could
 							 * re-trigger connection recovery that is already underway. */
-							if (!pConnEvent->isConnectFailure && pReactorChannel->reactorParentQueue != &pReactorImpl->activeChannels)
+							if (!pConnEvent->isConnectFailure && pReactorChannel->reactorParentQueue != &pReactorChannel->pShard->activeChannels)
 								break;
 
 							if (_reactorHandleChannelDown(pReactorImpl, pReactorChannel, pConnEvent->channelEvent.pError) != RSSL_RET_SUCCESS)
@@ -4274,8 +4677,8 @@ static RsslRet _reactorDispatchEventFromQueue(RsslReactorImpl *pReactorImpl, Rss
 								pReactorChannel->pWatchlist = NULL;
 							}
 
-							_reactorMoveChannel(&pReactorImpl->channelPool, pReactorChannel);
-							--pReactorImpl->channelCount;
+							_reactorMoveChannel(&pReactorChannel->pShard->channelPool, pReactorChannel);
+							--pReactorChannel->pShard->channelCount;
 							return RSSL_RC_CRET_SUCCESS;
 						default:
 							rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, 
@@ -4335,7 +4738,7 @@ static RsslRet _reactorDispatchEventFromQueue(RsslReactorImpl *pReactorImpl, Rss
 				pReactorChannel = (RsslReactorChannelImpl*)pReactorTokenMgntEvent->pReactorChannel;
 
 				/* The channel is being closed by the user. The channel can be NULL when submitting OAuth credential renewal without the token session */
-				if (pReactorChannel && (pReactorChannel->reactorParentQueue == &pReactorImpl->closingChannels))
+				if (pReactorChannel && (pReactorChannel->reactorParentQueue == &pReactorChannel->pShard->closingChannels))
 				{
 					if ( (pReactorTokenMgntEvent->reactorTokenMgntEventType == RSSL_RCIMPL_TKET_RESP_FAILURE) ||
 						(pReactorTokenMgntEvent->reactorTokenMgntEventType == RSSL_RCIMPL_TKET_CHANNEL_WARNING) )
@@ -4608,8 +5011,8 @@ static RsslRet _reactorDispatchEventFromQueue(RsslReactorImpl *pReactorImpl, Rss
 				{
 					case RSSL_RCIMPL_TSET_RETURN_CHANNEL_TO_CHANNEL_POOL:
 					{
-						_reactorMoveChannel(&pReactorImpl->channelPool, pReactorChannelImpl);
-						--pReactorImpl->channelCount;
+						_reactorMoveChannel(&pReactorChannelImpl->pShard->channelPool, pReactorChannelImpl);
+						--pReactorChannelImpl->pShard->channelCount;
 						break;
 					}
 					default:
@@ -4918,7 +5321,7 @@ static RsslRet _reactorDispatchEventFromQueue(RsslReactorImpl *pReactorImpl, Rss
 						{
 							pReactorWarmStandbyServerInfo = &pWarmStandbyGroupImpl->standbyServerList[index];
 
-							pStandByReactorChannel = _reactorTakeChannel(pReactorImpl, &pReactorImpl->channelPool);
+							pStandByReactorChannel = _reactorTakeChannel(pWarmStandByHandlerImpl->mainReactorChannelImpl.pShard);
 
 							rsslResetReactorChannel(pReactorImpl, pStandByReactorChannel);
 
@@ -4930,6 +5333,7 @@ static RsslRet _reactorDispatchEventFromQueue(RsslReactorImpl *pReactorImpl, Rss
 							pStandByReactorChannel->reactorChannel.userSpecPtr = pReactorWarmStandbyServerInfo->reactorConnectInfoImpl.base.rsslConnectOptions.userSpecPtr;
 							pStandByReactorChannel->readRet = 0;
 							pStandByReactorChannel->connectionDebugFlags = pStartingReactorChannel->connectionDebugFlags;
+							pStandByReactorChannel->directFlush = pStartingReactorChannel->directFlush;
 							pStandByReactorChannel->reconnectAttemptLimit = pStartingReactorChannel->reconnectAttemptLimit;
 							pStandByReactorChannel->reconnectMinDelay = pStartingReactorChannel->reconnectMinDelay;
 							pStandByReactorChannel->reconnectMaxDelay = pStartingReactorChannel->reconnectMaxDelay;
@@ -4957,6 +5361,8 @@ static RsslRet _reactorDispatchEventFromQueue(RsslReactorImpl *pReactorImpl, Rss
 								watchlistCreateOpts.maxOutstandingPosts = pStandByReactorChannel->channelRole.ommConsumerRole.watchlistOptions.maxOutstandingPosts;
 								watchlistCreateOpts.postAckTimeout = pStandByReactorChannel->channelRole.ommConsumerRole.watchlistOptions.postAckTimeout;
 								watchlistCreateOpts.requestTimeout = pStandByReactorChannel->channelRole.ommConsumerRole.watchlistOptions.requestTimeout;
+								watchlistCreateOpts.enableViewFiltering = pStandByReactorChannel->channelRole.ommConsumerRole.watchlistOptions.enableViewFiltering;
+								watchlistCreateOpts.enableDistinctFanoutBuffers = pStandByReactorChannel->channelRole.ommConsumerRole.watchlistOptions.enableDistinctFanoutBuffers;
 								watchlistCreateOpts.ticksPerMsec = pReactorImpl->ticksPerMsec;
 								watchlistCreateOpts.enableWarmStandby = RSSL_TRUE;
 								watchlistCreateOpts.loginRequestCount = 1;
@@ -4976,7 +5382,12 @@ static RsslRet _reactorDispatchEventFromQueue(RsslReactorImpl *pReactorImpl, Rss
 
 								if (pReactorWarmStandbyServerInfo->reactorConnectInfoImpl.base.enableSessionManagement)
 								{
-									if (_reactorGetAccessToken(pStandByReactorChannel, &pReactorWarmStandbyServerInfo->reactorConnectInfoImpl, pError) != RSSL_RET_SUCCESS)
+									/* The token is requested with the REST client shared by all shards, which shard 0 guards. */
+									reactorLockInterface(pReactorImpl, RSSL_TRUE, pError);
+									ret = _reactorGetAccessToken(pStandByReactorChannel, &pReactorWarmStandbyServerInfo->reactorConnectInfoImpl, pError);
+									reactorUnlockInterface(pReactorImpl);
+
+									if (ret != RSSL_RET_SUCCESS)
 									{
 										if (_reactorHandleChannelDown(pReactorImpl, pStandByReactorChannel, pError) != RSSL_RET_SUCCESS)
 											return RSSL_RET_FAILURE;
@@ -5067,7 +5478,7 @@ static RsslRet _reactorDispatchEventFromQueue(RsslReactorImpl *pReactorImpl, Rss
 											}
 										}
 
-										++pReactorImpl->channelCount;
+										++pStandByReactorChannel->pShard->channelCount;
 									}
 									else
 									{
@@ -5087,7 +5498,7 @@ static RsslRet _reactorDispatchEventFromQueue(RsslReactorImpl *pReactorImpl, Rss
 											}
 										}
 
-										++pReactorImpl->channelCount;
+										++pStandByReactorChannel->pShard->channelCount;
 									}
 								}
 							}
@@ -5444,7 +5855,7 @@ static RsslRet _reactorDispatchEventFromQueue(RsslReactorImpl *pReactorImpl, Rss
 							pReactorWarmStandbyServerInfo = &pWarmStandbyGroupImpl->standbyServerList[pWarmStandbyGroupImpl->currentStartingServerIndex];
 						}
 
-						pNextReactorChannel = _reactorTakeChannel(pReactorImpl, &pReactorImpl->channelPool);
+						pNextReactorChannel = _reactorTakeChannel(pWarmStandByHandlerImpl->mainReactorChannelImpl.pShard);
 
 						rsslResetReactorChannel(pReactorImpl, pNextReactorChannel);
 
@@ -5456,6 +5867,7 @@ static RsslRet _reactorDispatchEventFromQueue(RsslReactorImpl *pReactorImpl, Rss
 						pNextReactorChannel->reactorChannel.userSpecPtr = pReactorWarmStandbyServerInfo->reactorConnectInfoImpl.base.rsslConnectOptions.userSpecPtr;
 						pNextReactorChannel->readRet = 0;
 						pNextReactorChannel->connectionDebugFlags = pStartingReactorChannel->connectionDebugFlags;
+						pNextReactorChannel->directFlush = pStartingReactorChannel->directFlush;
 						pNextReactorChannel->reconnectAttemptLimit = pStartingReactorChannel->reconnectAttemptLimit;
 						pNextReactorChannel->reconnectMinDelay = pStartingReactorChannel->reconnectMinDelay;
 						pNextReactorChannel->reconnectMaxDelay = pStartingReactorChannel->reconnectMaxDelay;
@@ -5482,6 +5894,8 @@ static RsslRet _reactorDispatchEventFromQueue(RsslReactorImpl *pReactorImpl, Rss
 							watchlistCreateOpts.maxOutstandingPosts = pNextReactorChannel->channelRole.ommConsumerRole.watchlistOptions.maxOutstandingPosts;
 							watchlistCreateOpts.postAckTimeout = pNextReactorChannel->channelRole.ommConsumerRole.watchlistOptions.postAckTimeout;
 							watchlistCreateOpts.requestTimeout = pNextReactorChannel->channelRole.ommConsumerRole.watchlistOptions.requestTimeout;
+							watchlistCreateOpts.enableViewFiltering = pNextReactorChannel->channelRole.ommConsumerRole.watchlistOptions.enableViewFiltering;
+							watchlistCreateOpts.enableDistinctFanoutBuffers = pNextReactorChannel->channelRole.ommConsumerRole.watchlistOptions.enableDistinctFanoutBuffers;
 							watchlistCreateOpts.ticksPerMsec = pReactorImpl->ticksPerMsec;
 							watchlistCreateOpts.enableWarmStandby = RSSL_TRUE;
 							watchlistCreateOpts.loginRequestCount = 1;
@@ -5508,7 +5922,12 @@ static RsslRet _reactorDispatchEventFromQueue(RsslReactorImpl *pReactorImpl, Rss
 
 							if (pReactorWarmStandbyServerInfo->reactorConnectInfoImpl.base.enableSessionManagement)
 							{
-								if (_reactorGetAccessToken(pNextReactorChannel, &pReactorWarmStandbyServerInfo->reactorConnectInfoImpl, pError) != RSSL_RET_SUCCESS)
+								/* The token is requested with the REST client shared by all shards, which shard 0 guards. */
+								reactorLockInterface(pReactorImpl, RSSL_TRUE, pError);
+								ret = _reactorGetAccessToken(pNextReactorChannel, &pReactorWarmStandbyServerInfo->reactorConnectInfoImpl, pError);
+								reactorUnlockInterface(pReactorImpl);
+
+								if (ret != RSSL_RET_SUCCESS)
 								{
 									if (_reactorHandleChannelDown(pReactorImpl, pNextReactorChannel, pError) != RSSL_RET_SUCCESS)
 										return RSSL_RET_FAILURE;
@@ -5583,7 +6002,7 @@ static RsslRet _reactorDispatchEventFromQueue(RsslReactorImpl *pReactorImpl, Rss
 										}
 									}
 
-									++pReactorImpl->channelCount;
+									++pNextReactorChannel->pShard->channelCount;
 								}
 								else
 								{
@@ -5604,7 +6023,7 @@ static RsslRet _reactorDispatchEventFromQueue(RsslReactorImpl *pReactorImpl, Rss
 										}
 									}
 
-									++pReactorImpl->channelCount;
+									++pNextReactorChannel->pShard->channelCount;
 								}
 							}
 						}
@@ -5619,9 +6038,9 @@ static RsslRet _reactorDispatchEventFromQueue(RsslReactorImpl *pReactorImpl, Rss
 						if(pReturnWarmStandByHandlerImpl != NULL)
 						{	
 							/* Removes from the closing queue and returns warm standby handler back to pool to reuse. */
-							rsslQueueRemoveLink(&pReactorImpl->closingWarmstandbyChannel, &pReturnWarmStandByHandlerImpl->reactorQueueLink);
+							rsslQueueRemoveLink(&pReturnWarmStandByHandlerImpl->mainReactorChannelImpl.pShard->closingWarmstandbyChannel, &pReturnWarmStandByHandlerImpl->reactorQueueLink);
 
-							rsslQueueAddLinkToBack(&pReactorImpl->warmstandbyChannelPool, &pReturnWarmStandByHandlerImpl->reactorQueueLink);
+							rsslQueueAddLinkToBack(&pReturnWarmStandByHandlerImpl->mainReactorChannelImpl.pShard->warmstandbyChannelPool, &pReturnWarmStandByHandlerImpl->reactorQueueLink);
 						}
 
 						break;
@@ -5686,10 +6105,7 @@ static RsslRet _reactorDispatchEventFromQueue(RsslReactorImpl *pReactorImpl, Rss
 					return RSSL_RET_FAILURE;
 
 				if (pReactorChannel->pWatchlist->state & RSSLWL_STF_NEED_FLUSH)
-				{
-					pReactorChannel->writeRet = 1;
-					return _reactorSendFlushRequest(pReactorImpl, pReactorChannel, pError);
-				}
+					return _reactorFlushWatchlist(pReactorImpl, pReactorChannel, pError);
 			}
 
 			if (pReactorChannel->pTunnelManager)
@@ -5719,7 +6135,7 @@ static RsslRet _reactorEncodeRDMAsRsslMsg(RsslReactorImpl *pReactorImpl, RsslRea
 	rsslSetEncodeIteratorRWFVersion(&encodeIter, pReactorChannel->reactorChannel.majorVersion,
 			pReactorChannel->reactorChannel.minorVersion);
 
-	memBuffer = pReactorImpl->memoryBuffer;
+	memBuffer = pReactorChannel->pShard->memoryBuffer;
 	rsslSetEncodeIteratorBuffer(&encodeIter, &memBuffer);
 
 	if ((ret = rsslEncodeRDMMsg(&encodeIter, pRdmMsg, &memBuffer.length, pErrorInfo))
@@ -5881,7 +6297,7 @@ static RsslRet _reactorProcessMsg(RsslReactorImpl *pReactorImpl, RsslReactorChan
 
 					if (pConsumerRole->loginMsgCallback)
 					{
-						RsslBuffer memoryBuffer = pReactorImpl->memoryBuffer;
+						RsslBuffer memoryBuffer = pReactorChannel->pShard->memoryBuffer;
 						RsslRDMLoginMsg loginResponse, *pLoginResponse;
 						RsslRDMLoginMsgEvent loginEvent;
 
@@ -5992,7 +6408,7 @@ static RsslRet _reactorProcessMsg(RsslReactorImpl *pReactorImpl, RsslReactorChan
 													/* Checks whether warm standby mode matches with the user defined mode. */
 													if ((pWarmStandByGroup->warmStandbyMode & pReactorWarmStandByHandlerImpl->rdmLoginRefresh.supportStandbyMode) == 0)
 													{
-														RsslReactorWarmStanbyEvent* pEvent = (RsslReactorWarmStanbyEvent*)rsslReactorEventQueueGetFromPool(&pReactorImpl->reactorEventQueue);
+														RsslReactorWarmStanbyEvent* pEvent = (RsslReactorWarmStanbyEvent*)rsslReactorEventQueueGetFromPool(rsslReactorChannelEventQueue(pReactorChannel));
 														rsslClearReactorWarmStanbyEvent(pEvent);
 
 														pEvent->reactorWarmStandByEventType = RSSL_RCIMPL_WSBET_REMOVE_SERVER_FROM_WSB_GROUP;
@@ -6005,7 +6421,7 @@ static RsslRet _reactorProcessMsg(RsslReactorImpl *pReactorImpl, RsslReactorChan
 															rsslSetErrorInfo(&pEvent->pReactorErrorInfoImpl->rsslErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "The warm standby mode of the login response doesn't match with the user specified in RsslReactorWarmStandbyGroup.");
 														}
 
-														if (!RSSL_ERROR_INFO_CHECK(rsslReactorEventQueuePut(&pReactorImpl->reactorEventQueue, (RsslReactorEventImpl*)pEvent) == RSSL_RET_SUCCESS, RSSL_RET_FAILURE, pError))
+														if (!RSSL_ERROR_INFO_CHECK(rsslReactorEventQueuePut(rsslReactorChannelEventQueue(pReactorChannel), (RsslReactorEventImpl*)pEvent) == RSSL_RET_SUCCESS, RSSL_RET_FAILURE, pError))
 															return RSSL_RET_FAILURE;
 
 														break;
@@ -6213,7 +6629,7 @@ static RsslRet _reactorProcessMsg(RsslReactorImpl *pReactorImpl, RsslReactorChan
 										{
 											if (validateLoginResponseFromStandbyServer(&pReactorWarmStandByHandlerImpl->rdmLoginRefresh, &pLoginResponse->refresh) == RSSL_FALSE)
 											{
-												RsslReactorWarmStanbyEvent* pEvent = (RsslReactorWarmStanbyEvent*)rsslReactorEventQueueGetFromPool(&pReactorImpl->reactorEventQueue);
+												RsslReactorWarmStanbyEvent* pEvent = (RsslReactorWarmStanbyEvent*)rsslReactorEventQueueGetFromPool(rsslReactorChannelEventQueue(pReactorChannel));
 												rsslClearReactorWarmStanbyEvent(pEvent);
 
 												pEvent->reactorWarmStandByEventType = RSSL_RCIMPL_WSBET_REMOVE_SERVER_FROM_WSB_GROUP;
@@ -6226,7 +6642,7 @@ static RsslRet _reactorProcessMsg(RsslReactorImpl *pReactorImpl, RsslReactorChan
 													rsslSetErrorInfo(&pEvent->pReactorErrorInfoImpl->rsslErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "The login response from standby server does not match with the primary server.");
 												}
 
-												if (!RSSL_ERROR_INFO_CHECK(rsslReactorEventQueuePut(&pReactorImpl->reactorEventQueue, (RsslReactorEventImpl*)pEvent) == RSSL_RET_SUCCESS, RSSL_RET_FAILURE, pError))
+												if (!RSSL_ERROR_INFO_CHECK(rsslReactorEventQueuePut(rsslReactorChannelEventQueue(pReactorChannel), (RsslReactorEventImpl*)pEvent) == RSSL_RET_SUCCESS, RSSL_RET_FAILURE, pError))
 													return RSSL_RET_FAILURE;
 											}
 											else
@@ -6300,7 +6716,7 @@ static RsslRet _reactorProcessMsg(RsslReactorImpl *pReactorImpl, RsslReactorChan
 									}
 									else
 									{
-										RsslReactorWarmStanbyEvent* pEvent = (RsslReactorWarmStanbyEvent*)rsslReactorEventQueueGetFromPool(&pReactorImpl->reactorEventQueue);
+										RsslReactorWarmStanbyEvent* pEvent = (RsslReactorWarmStanbyEvent*)rsslReactorEventQueueGetFromPool(rsslReactorChannelEventQueue(pReactorChannel));
 										rsslClearReactorWarmStanbyEvent(pEvent);
 
 										pEvent->reactorWarmStandByEventType = RSSL_RCIMPL_WSBET_REMOVE_SERVER_FROM_WSB_GROUP;
@@ -6313,7 +6729,7 @@ static RsslRet _reactorProcessMsg(RsslReactorImpl *pReactorImpl, RsslReactorChan
 											rsslSetErrorInfo(&pEvent->pReactorErrorInfoImpl->rsslErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "The login response doesn't support warm standby functionality.");
 										}
 
-										if (!RSSL_ERROR_INFO_CHECK(rsslReactorEventQueuePut(&pReactorImpl->reactorEventQueue, (RsslReactorEventImpl*)pEvent) == RSSL_RET_SUCCESS, RSSL_RET_FAILURE, pError))
+										if (!RSSL_ERROR_INFO_CHECK(rsslReactorEventQueuePut(rsslReactorChannelEventQueue(pReactorChannel), (RsslReactorEventImpl*)pEvent) == RSSL_RET_SUCCESS, RSSL_RET_FAILURE, pError))
 											return RSSL_RET_FAILURE;
 									}
 								}
@@ -6331,7 +6747,7 @@ static RsslRet _reactorProcessMsg(RsslReactorImpl *pReactorImpl, RsslReactorChan
 										if (pLoginResponse->status.state.streamState == RSSL_STREAM_CLOSED)
 										{
 											/* Closes this channel if it is closed by the server */
-											RsslReactorWarmStanbyEvent* pEvent = (RsslReactorWarmStanbyEvent*)rsslReactorEventQueueGetFromPool(&pReactorImpl->reactorEventQueue);
+											RsslReactorWarmStanbyEvent* pEvent = (RsslReactorWarmStanbyEvent*)rsslReactorEventQueueGetFromPool(rsslReactorChannelEventQueue(pReactorChannel));
 											rsslClearReactorWarmStanbyEvent(pEvent);
 
 											pEvent->reactorWarmStandByEventType = RSSL_RCIMPL_WSBET_REMOVE_SERVER_FROM_WSB_GROUP;
@@ -6344,7 +6760,7 @@ static RsslRet _reactorProcessMsg(RsslReactorImpl *pReactorImpl, RsslReactorChan
 												rsslSetErrorInfo(&pEvent->pReactorErrorInfoImpl->rsslErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "The server rejects login request.");
 											}
 
-											if (!RSSL_ERROR_INFO_CHECK(rsslReactorEventQueuePut(&pReactorImpl->reactorEventQueue, (RsslReactorEventImpl*)pEvent) == RSSL_RET_SUCCESS, RSSL_RET_FAILURE, pError))
+											if (!RSSL_ERROR_INFO_CHECK(rsslReactorEventQueuePut(rsslReactorChannelEventQueue(pReactorChannel), (RsslReactorEventImpl*)pEvent) == RSSL_RET_SUCCESS, RSSL_RET_FAILURE, pError))
 												return RSSL_RET_FAILURE;
 										}
 
@@ -6418,7 +6834,7 @@ static RsslRet _reactorProcessMsg(RsslReactorImpl *pReactorImpl, RsslReactorChan
 						ret = _reactorRaiseToDefaultCallback(pReactorImpl, pReactorChannel, pOpts);
 
 					/* Message failed to decode or callback didn't handle it */
-					if (ret != RSSL_RET_SUCCESS || *pCret != RSSL_RC_CRET_SUCCESS || pReactorChannel->reactorParentQueue == &pReactorImpl->closingChannels)
+					if (ret != RSSL_RET_SUCCESS || *pCret != RSSL_RC_CRET_SUCCESS || pReactorChannel->reactorParentQueue == &pReactorChannel->pShard->closingChannels)
 						break;
 
 					if (pReactorChannel->pWatchlist)
@@ -6500,7 +6916,7 @@ static RsslRet _reactorProcessMsg(RsslReactorImpl *pReactorImpl, RsslReactorChan
 					{
 						if (!pRdmMsg)
 						{
-							RsslBuffer memoryBuffer = pReactorImpl->memoryBuffer;
+							RsslBuffer memoryBuffer = pReactorChannel->pShard->memoryBuffer;
 							rsslClearRDMDirectoryMsg(&directoryResponse);
 
 							rsslClearDecodeIterator(&dIter);
@@ -6589,7 +7005,7 @@ static RsslRet _reactorProcessMsg(RsslReactorImpl *pReactorImpl, RsslReactorChan
 										directoryUpdate.serviceList = (RsslRDMService*)malloc(pReactorWarmStandByGroupImpl->_updateServiceList.count * sizeof(RsslRDMService));
 										if (directoryUpdate.serviceList == NULL)
 										{
-											RsslReactorWarmStanbyEvent* pEvent = (RsslReactorWarmStanbyEvent*)rsslReactorEventQueueGetFromPool(&pReactorImpl->reactorEventQueue);
+											RsslReactorWarmStanbyEvent* pEvent = (RsslReactorWarmStanbyEvent*)rsslReactorEventQueueGetFromPool(rsslReactorChannelEventQueue(pReactorChannel));
 											rsslClearReactorWarmStanbyEvent(pEvent);
 
 											pEvent->reactorWarmStandByEventType = RSSL_RCIMPL_WSBET_REMOVE_SERVER_FROM_WSB_GROUP;
@@ -6602,7 +7018,7 @@ static RsslRet _reactorProcessMsg(RsslReactorImpl *pReactorImpl, RsslReactorChan
 												rsslSetErrorInfo(&pEvent->pReactorErrorInfoImpl->rsslErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to allocate memory for source directory update message.");
 											}
 
-											if (!RSSL_ERROR_INFO_CHECK(rsslReactorEventQueuePut(&pReactorImpl->reactorEventQueue, (RsslReactorEventImpl*)pEvent) == RSSL_RET_SUCCESS, RSSL_RET_FAILURE, pError))
+											if (!RSSL_ERROR_INFO_CHECK(rsslReactorEventQueuePut(rsslReactorChannelEventQueue(pReactorChannel), (RsslReactorEventImpl*)pEvent) == RSSL_RET_SUCCESS, RSSL_RET_FAILURE, pError))
 												return RSSL_RET_FAILURE;
 										}
 										else
@@ -6703,7 +7119,7 @@ static RsslRet _reactorProcessMsg(RsslReactorImpl *pReactorImpl, RsslReactorChan
 						ret = _reactorRaiseToDefaultCallback(pReactorImpl, pReactorChannel, pOpts);
 
 					/* Message failed to decode or callback didn't handle it */
-					if (ret != RSSL_RET_SUCCESS || *pCret != RSSL_RC_CRET_SUCCESS || pReactorChannel->reactorParentQueue == &pReactorImpl->closingChannels)
+					if (ret != RSSL_RET_SUCCESS || *pCret != RSSL_RC_CRET_SUCCESS || pReactorChannel->reactorParentQueue == &pReactorChannel->pShard->closingChannels)
 						break;
 
 					if (pReactorChannel->pWatchlist)
@@ -6854,7 +7270,7 @@ static RsslRet _reactorProcessMsg(RsslReactorImpl *pReactorImpl, RsslReactorChan
 
 					if (pConsumerRole->dictionaryMsgCallback)
 					{
-						RsslBuffer memoryBuffer = pReactorImpl->memoryBuffer;
+						RsslBuffer memoryBuffer = pReactorChannel->pShard->memoryBuffer;
 						RsslRDMDictionaryMsg dictionaryResponse;
 						RsslRDMDictionaryMsgEvent dictionaryEvent;
 						RsslBool callbackToClient = _warmStandbyCallbackChecks(pReactorChannel, pOpts);
@@ -6918,7 +7334,7 @@ static RsslRet _reactorProcessMsg(RsslReactorImpl *pReactorImpl, RsslReactorChan
 
 													if (pWarmStandByHandlerImpl->rdmFieldVersion.major != dictionaryVersion.major)
 													{
-														RsslReactorWarmStanbyEvent* pEvent = (RsslReactorWarmStanbyEvent*)rsslReactorEventQueueGetFromPool(&pReactorImpl->reactorEventQueue);
+														RsslReactorWarmStanbyEvent* pEvent = (RsslReactorWarmStanbyEvent*)rsslReactorEventQueueGetFromPool(rsslReactorChannelEventQueue(pReactorChannel));
 														rsslClearReactorWarmStanbyEvent(pEvent);
 
 														pEvent->reactorWarmStandByEventType = RSSL_RCIMPL_WSBET_REMOVE_SERVER_FROM_WSB_GROUP;
@@ -6931,7 +7347,7 @@ static RsslRet _reactorProcessMsg(RsslReactorImpl *pReactorImpl, RsslReactorChan
 															rsslSetErrorInfo(&pEvent->pReactorErrorInfoImpl->rsslErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "The major version of field dicitonary response from standby server does not match with the primary server.");
 														}
 
-														if (!RSSL_ERROR_INFO_CHECK(rsslReactorEventQueuePut(&pReactorImpl->reactorEventQueue, (RsslReactorEventImpl*)pEvent) == RSSL_RET_SUCCESS, RSSL_RET_FAILURE, pError))
+														if (!RSSL_ERROR_INFO_CHECK(rsslReactorEventQueuePut(rsslReactorChannelEventQueue(pReactorChannel), (RsslReactorEventImpl*)pEvent) == RSSL_RET_SUCCESS, RSSL_RET_FAILURE, pError))
 															return RSSL_RET_FAILURE;
 													}
 												}
@@ -6960,7 +7376,7 @@ static RsslRet _reactorProcessMsg(RsslReactorImpl *pReactorImpl, RsslReactorChan
 
 													if (pWarmStandByHandlerImpl->rdmEnumTypeVersion.major != dictionaryVersion.major)
 													{
-														RsslReactorWarmStanbyEvent* pEvent = (RsslReactorWarmStanbyEvent*)rsslReactorEventQueueGetFromPool(&pReactorImpl->reactorEventQueue);
+														RsslReactorWarmStanbyEvent* pEvent = (RsslReactorWarmStanbyEvent*)rsslReactorEventQueueGetFromPool(rsslReactorChannelEventQueue(pReactorChannel));
 														rsslClearReactorWarmStanbyEvent(pEvent);
 
 														pEvent->reactorWarmStandByEventType = RSSL_RCIMPL_WSBET_REMOVE_SERVER_FROM_WSB_GROUP;
@@ -6973,7 +7389,7 @@ static RsslRet _reactorProcessMsg(RsslReactorImpl *pReactorImpl, RsslReactorChan
 															rsslSetErrorInfo(&pEvent->pReactorErrorInfoImpl->rsslErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "The major version of enumeration dictionary response from standby server does not match with the primary server.");
 														}
 
-														if (!RSSL_ERROR_INFO_CHECK(rsslReactorEventQueuePut(&pReactorImpl->reactorEventQueue, (RsslReactorEventImpl*)pEvent) == RSSL_RET_SUCCESS, RSSL_RET_FAILURE, pError))
+														if (!RSSL_ERROR_INFO_CHECK(rsslReactorEventQueuePut(rsslReactorChannelEventQueue(pReactorChannel), (RsslReactorEventImpl*)pEvent) == RSSL_RET_SUCCESS, RSSL_RET_FAILURE, pError))
 															return RSSL_RET_FAILURE;
 													}
 												}
@@ -7028,7 +7444,7 @@ static RsslRet _reactorProcessMsg(RsslReactorImpl *pReactorImpl, RsslReactorChan
 						ret = _reactorRaiseToDefaultCallback(pReactorImpl, pReactorChannel, pOpts);
 
 					/* Message failed to decode or callback didn't handle it */
-					if (ret != RSSL_RET_SUCCESS || *pCret != RSSL_RC_CRET_SUCCESS || pReactorChannel->reactorParentQueue == &pReactorImpl->closingChannels)
+					if (ret != RSSL_RET_SUCCESS || *pCret != RSSL_RC_CRET_SUCCESS || pReactorChannel->reactorParentQueue == &pReactorChannel->pShard->closingChannels)
 						break;
 
 					if (pConsumerRole->dictionaryDownloadMode == RSSL_RC_DICTIONARY_DOWNLOAD_FIRST_AVAILABLE && pReactorChannel->channelSetupState >= RSSL_RC_CHST_HAVE_DIRECTORY
@@ -7100,7 +7516,7 @@ static RsslRet _reactorProcessMsg(RsslReactorImpl *pReactorImpl, RsslReactorChan
 
 					if (pNIProviderRole->loginMsgCallback)
 					{
-						RsslBuffer memoryBuffer = pReactorImpl->memoryBuffer;
+						RsslBuffer memoryBuffer = pReactorChannel->pShard->memoryBuffer;
 						RsslRDMLoginMsg loginResponse;
 						RsslRDMLoginMsgEvent loginEvent;
 
@@ -7131,7 +7547,7 @@ static RsslRet _reactorProcessMsg(RsslReactorImpl *pReactorImpl, RsslReactorChan
 						ret = _reactorRaiseToDefaultCallback(pReactorImpl, pReactorChannel, pOpts);
 
 					/* Message failed to decode or callback didn't handle it */
-					if (ret != RSSL_RET_SUCCESS || *pCret != RSSL_RC_CRET_SUCCESS || pReactorChannel->reactorParentQueue == &pReactorImpl->closingChannels)
+					if (ret != RSSL_RET_SUCCESS || *pCret != RSSL_RC_CRET_SUCCESS || pReactorChannel->reactorParentQueue == &pReactorChannel->pShard->closingChannels)
 						break;
 
 					if (pReactorChannel->channelSetupState == RSSL_RC_CHST_INIT && *pCret == RSSL_RC_CRET_SUCCESS && pNIProviderRole->pLoginRequest)
@@ -7221,7 +7637,7 @@ static RsslRet _reactorProcessMsg(RsslReactorImpl *pReactorImpl, RsslReactorChan
 
 					if (pProviderRole->loginMsgCallback)
 					{
-						RsslBuffer memoryBuffer = pReactorImpl->memoryBuffer;
+						RsslBuffer memoryBuffer = pReactorChannel->pShard->memoryBuffer;
 						RsslRDMLoginMsg loginResponse;
 						RsslRDMLoginMsgEvent loginEvent;
 
@@ -7258,7 +7674,7 @@ static RsslRet _reactorProcessMsg(RsslReactorImpl *pReactorImpl, RsslReactorChan
 				{
 					if (pProviderRole->directoryMsgCallback)
 					{
-						RsslBuffer memoryBuffer = pReactorImpl->memoryBuffer;
+						RsslBuffer memoryBuffer = pReactorChannel->pShard->memoryBuffer;
 						RsslRDMDirectoryMsg directoryResponse;
 						RsslRDMDirectoryMsgEvent directoryEvent;
 
@@ -7295,7 +7711,7 @@ static RsslRet _reactorProcessMsg(RsslReactorImpl *pReactorImpl, RsslReactorChan
 				{
 					if (pProviderRole->dictionaryMsgCallback)
 					{
-						RsslBuffer memoryBuffer = pReactorImpl->memoryBuffer;
+						RsslBuffer memoryBuffer = pReactorChannel->pShard->memoryBuffer;
 						RsslRDMDictionaryMsg dictionaryResponse;
 						RsslRDMDictionaryMsgEvent dictionaryEvent;
 
@@ -7506,10 +7922,14 @@ static RsslRet _reactorDispatchFromChannel(RsslReactorImpl *pReactorImpl, RsslRe
 
 	pReactorChannel->readRet = ret;
 
+	/* Bytes are still queued in the channel, so read from it again on a later dispatch. */
+	if (ret > 0)
+		_reactorAddReadyChannel(pReactorImpl, pReactorChannel);
+
 	if (pMsgBuf)
 	{
 		/* Update ping time & notification logic */
-		pReactorChannel->lastPingReadMs = pReactorImpl->lastRecordedTimeMs;
+		pReactorChannel->lastPingReadMs = pReactorChannel->pShard->lastRecordedTimeMs;
 
 		if (ret == RSSL_RET_SUCCESS) 
 			rsslNotifierEventClearNotifiedFlags(pReactorChannel->pNotifierEvent); /* Done reading. */
@@ -7525,7 +7945,7 @@ static RsslRet _reactorDispatchFromChannel(RsslReactorImpl *pReactorImpl, RsslRe
 			rjcError.rsslErrorId = RSSL_RET_SUCCESS;
 
 			/* Added checking to ensure that the JSON converter is initialized properly.*/
-			if (pReactorImpl->pJsonConverter == 0)
+			if (pReactorChannel->pShard->pJsonConverter == 0)
 			{
 				rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "The JSON converter library has not been initialized.");
 				return RSSL_RET_FAILURE;
@@ -7533,13 +7953,13 @@ static RsslRet _reactorDispatchFromChannel(RsslReactorImpl *pReactorImpl, RsslRe
 
 			rsslClearParseJsonBufferOptions(&parseOptions);
 			parseOptions.jsonProtocolType = RSSL_JSON_PROTOCOL_TYPE;
-			if ( (ret = rsslParseJsonBuffer(pReactorImpl->pJsonConverter, &parseOptions, pMsgBuf, &rjcError) ) == RSSL_RET_SUCCESS) 
+			if ( (ret = rsslParseJsonBuffer(pReactorChannel->pShard->pJsonConverter, &parseOptions, pMsgBuf, &rjcError) ) == RSSL_RET_SUCCESS) 
 			{
 				RsslBuffer decodedMsg = RSSL_INIT_BUFFER;
 				rsslClearDecodeJsonMsgOptions(&decodeOptions);
 				decodeOptions.jsonProtocolType = RSSL_JSON_PROTOCOL_TYPE;
 
-				while ( (ret = rsslDecodeJsonMsg(pReactorImpl->pJsonConverter, &decodeOptions, &jsonMsg, &decodedMsg, &rjcError) ) != RSSL_RET_END_OF_CONTAINER)
+				while ( (ret = rsslDecodeJsonMsg(pReactorChannel->pShard->pJsonConverter, &decodeOptions, &jsonMsg, &decodedMsg, &rjcError) ) != RSSL_RET_END_OF_CONTAINER)
 				{
 					if (ret != RSSL_RET_SUCCESS)
 					{	/* Failed to convert a JSON message. */
@@ -7620,11 +8040,11 @@ static RsslRet _reactorDispatchFromChannel(RsslReactorImpl *pReactorImpl, RsslRe
 				RsslBuffer outputBuffer = RSSL_INIT_BUFFER;
 				if (failedToConvertJSONMsg) /* Send JSON error message back when it fails to decode JSON message */
 				{
-					if ( (ret = rsslGetJsonSimpleErrorParams(pReactorImpl->pJsonConverter, &decodeOptions,
+					if ( (ret = rsslGetJsonSimpleErrorParams(pReactorChannel->pShard->pJsonConverter, &decodeOptions,
 						&rjcError, &errorParams, pMsgBuf, jsonMsg.jsonRsslMsg.rsslMsg.msgBase.streamId)) == RSSL_RET_SUCCESS )
 					{
 						RsslBuffer *pBuffer = NULL;
-						rsslJsonGetErrorMessage(pReactorImpl->pJsonConverter, &errorParams, &outputBuffer);
+						rsslJsonGetErrorMessage(pReactorChannel->pShard->pJsonConverter, &errorParams, &outputBuffer);
 
 						pBuffer = rsslReactorGetBuffer(&pReactorChannel->reactorChannel, outputBuffer.length, RSSL_FALSE, pError);
 
@@ -7651,12 +8071,12 @@ static RsslRet _reactorDispatchFromChannel(RsslReactorImpl *pReactorImpl, RsslRe
 					rsslClearReactorJsonConversionEvent(&jsonConversionEvent);
 
 					if(failedToConvertJSONMsg)
-						rsslSetErrorInfo(pReactorImpl->pJsonErrorInfo, RSSL_EIC_FAILURE, rjcError.rsslErrorId, __FILE__, __LINE__, "Failed to convert JSON message: %s", outputBuffer.data);
+						rsslSetErrorInfo(pReactorChannel->pShard->pJsonErrorInfo, RSSL_EIC_FAILURE, rjcError.rsslErrorId, __FILE__, __LINE__, "Failed to convert JSON message: %s", outputBuffer.data);
 					else
-						rsslSetErrorInfo(pReactorImpl->pJsonErrorInfo, RSSL_EIC_FAILURE, rjcError.rsslErrorId, __FILE__, __LINE__, "Failed to convert JSON message: %s", &rjcError.text[0]);
+						rsslSetErrorInfo(pReactorChannel->pShard->pJsonErrorInfo, RSSL_EIC_FAILURE, rjcError.rsslErrorId, __FILE__, __LINE__, "Failed to convert JSON message: %s", &rjcError.text[0]);
 
 
-					jsonConversionEvent.pError = pReactorImpl->pJsonErrorInfo;
+					jsonConversionEvent.pError = pReactorChannel->pShard->pJsonErrorInfo;
 					jsonConversionEvent.pUserSpec = pReactorImpl->userSpecPtr;
 
 					_reactorSetInCallback(pReactorImpl, RSSL_TRUE);
@@ -7696,7 +8116,7 @@ static RsslRet _reactorDispatchFromChannel(RsslReactorImpl *pReactorImpl, RsslRe
 		{
 			case RSSL_RET_READ_PING:
 				/* Update ping time */
-				pReactorChannel->lastPingReadMs = pReactorImpl->lastRecordedTimeMs;
+				pReactorChannel->lastPingReadMs = pReactorChannel->pShard->lastRecordedTimeMs;
 				pReactorChannel->readRet = 0;
 
 				/* Collects ping statistics */
@@ -7709,7 +8129,7 @@ static RsslRet _reactorDispatchFromChannel(RsslReactorImpl *pReactorImpl, RsslRe
 						& RSSL_READ_OUT_FTGROUP_ID)
 				{
 					RsslInt64 nextExpireTime = rsslWatchlistProcessFTGroupPing(pReactorChannel->pWatchlist,
-							readOutArgs.FTGroupId, pReactorImpl->lastRecordedTimeMs);
+							readOutArgs.FTGroupId, pReactorChannel->pShard->lastRecordedTimeMs);
 
 					if (pReactorChannel->pWatchlist->state & RSSLWL_STF_NEED_TIMER) 
 						if (_reactorSetTimer(pReactorImpl, pReactorChannel, nextExpireTime, pError) 
@@ -7726,22 +8146,31 @@ static RsslRet _reactorDispatchFromChannel(RsslReactorImpl *pReactorImpl, RsslRe
 			case RSSL_RET_READ_FD_CHANGE:
 				{
 					RsslReactorEventImpl rsslEvent;
+					RsslReactorChannelEventImpl *pFdChangeEvent;
 					RsslReactorChannel *pCallbackChannel = (RsslReactorChannel*)pReactorChannel;
 
 					/* Descriptor changed, update notification. */
-					if (rsslNotifierUpdateEventFd(pReactorImpl->pNotifier, pReactorChannel->pNotifierEvent, (int)(pChannel->socketId)) < 0)
+					if (rsslNotifierUpdateEventFd(pReactorChannel->pShard->pNotifier, pReactorChannel->pNotifierEvent, (int)(pChannel->socketId)) < 0)
 					{
 						rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, 
 								"Failed to add notification event for initializing channel that is changing descriptor.");
 						return RSSL_RET_FAILURE;
 					}
-					if (rsslNotifierRegisterRead(pReactorImpl->pNotifier, pReactorChannel->pNotifierEvent) < 0)
+					if (rsslNotifierRegisterRead(pReactorChannel->pShard->pNotifier, pReactorChannel->pNotifierEvent) < 0)
 					{
 						rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, 
 								"Failed to register read notification for initializing channel that is changing descriptor.");
 						return RSSL_RET_FAILURE;
 					}
 
+					/* Tell the worker to update its notification too. */
+					pFdChangeEvent = (RsslReactorChannelEventImpl*)rsslReactorEventQueueGetFromPool(&pReactorImpl->reactorWorker.workerQueue);
+					rsslClearReactorChannelEventImpl(pFdChangeEvent);
+					pFdChangeEvent->channelEvent.channelEventType = (RsslReactorChannelEventType)RSSL_RCIMPL_CET_FD_CHANGE;
+					pFdChangeEvent->channelEvent.pReactorChannel = (RsslReactorChannel*)pReactorChannel;
+					if (!RSSL_ERROR_INFO_CHECK(rsslReactorEventQueuePut(&pReactorImpl->reactorWorker.workerQueue, (RsslReactorEventImpl*)pFdChangeEvent) == RSSL_RET_SUCCESS, RSSL_RET_FAILURE, pError))
+						return RSSL_RET_FAILURE;
+
 					if (_reactorHandlesWarmStandby(pReactorChannel))
 					{
 						pCallbackChannel = &pReactorChannel->pWarmStandByHandlerImpl->mainReactorChannelImpl.reactorChannel;
@@ -7847,23 +8276,42 @@ static RsslRet _reactorDispatchFromChannel(RsslReactorImpl *pReactorImpl, RsslRe
 	}
 	else
 	{
-		pReactorChannel->lastPingReadMs = pReactorImpl->lastRecordedTimeMs;
+		pReactorChannel->lastPingReadMs = pReactorChannel->pShard->lastRecordedTimeMs;
 		return ret; /* Got positive return from read, but no message -- means a partial message was received by Rssl and we have to wait for the rest of the data. */
 	}
 }
 
-RsslRet reactorLockInterface(RsslReactorImpl *pReactorImpl, RsslBool allowedInCallback, RsslErrorInfo *pError)
+RsslRet reactorLockShard(RsslReactorShardImpl *pShard, RsslBool allowedInCallback, RsslErrorInfo *pError)
 {
-	if (!allowedInCallback && pReactorImpl->inReactorFunction)
+	RsslReactorShardImpl *pHeldShard = _reactorHeldShard(pShard->pReactorImpl);
+
+	if (!allowedInCallback && (pShard->inReactorFunction || (pHeldShard && pHeldShard->inReactorFunction)))
 	{
 		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "This call cannot be called from within a callback");
 		return RSSL_RET_INVALID_ARGUMENT;
 	}
 
-	RSSL_MUTEX_LOCK(&pReactorImpl->interfaceLock);
+	/* Shard 0 may be locked while holding another shard, but other shards are only locked in turn. */
+	if (pHeldShard && pHeldShard != pShard && pShard->shardIndex != 0)
+	{
+		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, 
+			"Shard %u cannot be used while shard %u is locked by this thread.", pShard->shardIndex, pHeldShard->shardIndex);
+		return RSSL_RET_INVALID_ARGUMENT;
+	}
+
+	RSSL_MUTEX_LOCK(&pShard->interfaceLock);
+#ifdef RSSL_REACTOR_DISPATCH_SHARDS
+	pShard->pLockThread = RSSL_REACTOR_THREAD;
+	++pShard->lockCount;
+#endif
 	return RSSL_RET_SUCCESS;
 }
 
+RsslRet reactorLockInterface(RsslReactorImpl *pReactorImpl, RsslBool allowedInCallback, RsslErrorInfo *pError)
+{
+	return reactorLockShard(&pReactorImpl->pShards[0], allowedInCallback, pError);
+}
+
 RSSL_VA_API RsslRet rsslReactorOpenTunnelStream(RsslReactorChannel *pReactorChannel, RsslTunnelStreamOpenOptions *pOptions, RsslErrorInfo *pError)
 {
 	RsslReactorChannelImpl *pReactorChannelImpl;
@@ -7889,24 +8337,24 @@ RSSL_VA_API RsslRet rsslReactorOpenTunnelStream(RsslReactorChannel *pReactorChan
 	pReactorChannelImpl = (RsslReactorChannelImpl*)pReactorChannel;
 	pReactorImpl = (RsslReactorImpl*)pReactorChannelImpl->pParentReactor;
 
-	if ((ret = reactorLockInterface(pReactorImpl, RSSL_TRUE, pError)) != RSSL_RET_SUCCESS)
+	if ((ret = reactorLockShard(pReactorChannelImpl->pShard, RSSL_TRUE, pError)) != RSSL_RET_SUCCESS)
 		return ret;
 
 	if (pReactorImpl->state != RSSL_REACTOR_ST_ACTIVE)
 	{
 		rsslSetErrorInfo(pError, RSSL_EIC_SHUTDOWN, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "Reactor is shutting down.");
-		return (reactorUnlockInterface(pReactorImpl), RSSL_RET_FAILURE);
+		return (reactorUnlockShard(pReactorChannelImpl->pShard), RSSL_RET_FAILURE);
 	}
 
 	if ((pTunnelStream = tunnelManagerOpenStream(pReactorChannelImpl->pTunnelManager, pOptions, RSSL_FALSE, NULL, COS_CURRENT_STREAM_VERSION, pError)) == NULL)
-		return (reactorUnlockInterface(pReactorImpl), pError->rsslError.rsslErrorId);
+		return (reactorUnlockShard(pReactorChannelImpl->pShard), pError->rsslError.rsslErrorId);
 
 	pTunnelStream->pReactorChannel = pReactorChannel;
 
 	if (_reactorHandleTunnelManagerEvents(pReactorImpl, pReactorChannelImpl, pError) != RSSL_RET_SUCCESS)
-		return (reactorUnlockInterface(pReactorImpl), pError->rsslError.rsslErrorId);
+		return (reactorUnlockShard(pReactorChannelImpl->pShard), pError->rsslError.rsslErrorId);
 
-	return (reactorUnlockInterface(pReactorImpl), RSSL_RET_SUCCESS);
+	return (reactorUnlockShard(pReactorChannelImpl->pShard), RSSL_RET_SUCCESS);
 }
 
 RSSL_VA_API RsslRet rsslReactorCloseTunnelStream(RsslTunnelStream *pTunnelStream, RsslTunnelStreamCloseOptions *pOptions, RsslErrorInfo *pError)
@@ -7927,22 +8375,22 @@ RSSL_VA_API RsslRet rsslReactorCloseTunnelStream(RsslTunnelStream *pTunnelStream
 	pReactorChannelImpl = (RsslReactorChannelImpl*)pTunnelStream->pReactorChannel;
 	pReactorImpl = (RsslReactorImpl*)pReactorChannelImpl->pParentReactor;
 	
-	if ((ret = reactorLockInterface(pReactorImpl, RSSL_TRUE, pError)) != RSSL_RET_SUCCESS)
+	if ((ret = reactorLockShard(pReactorChannelImpl->pShard, RSSL_TRUE, pError)) != RSSL_RET_SUCCESS)
 		return ret;
 
 	if (pReactorImpl->state != RSSL_REACTOR_ST_ACTIVE)
 	{
 		rsslSetErrorInfo(pError, RSSL_EIC_SHUTDOWN, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "Reactor is shutting down.");
-		return (reactorUnlockInterface(pReactorImpl), RSSL_RET_FAILURE);
+		return (reactorUnlockShard(pReactorChannelImpl->pShard), RSSL_RET_FAILURE);
 	}
 
 	if ((ret = tunnelManagerCloseStream(pReactorChannelImpl->pTunnelManager, pTunnelStream, pOptions, pError)) != RSSL_RET_SUCCESS)
-		return (reactorUnlockInterface(pReactorImpl), ret);
+		return (reactorUnlockShard(pReactorChannelImpl->pShard), ret);
 
 	if ((ret = _reactorHandleTunnelManagerEvents(pReactorImpl, pReactorChannelImpl, pError)) != RSSL_RET_SUCCESS)
-		return (reactorUnlockInterface(pReactorImpl), ret);
+		return (reactorUnlockShard(pReactorChannelImpl->pShard), ret);
 
-	return (reactorUnlockInterface(pReactorImpl), RSSL_RET_SUCCESS);
+	return (reactorUnlockShard(pReactorChannelImpl->pShard), RSSL_RET_SUCCESS);
 }
 
 RSSL_VA_API RsslRet rsslTunnelStreamSubmit(RsslTunnelStream *pTunnelStream, RsslBuffer *pBuffer, RsslTunnelStreamSubmitOptions *pRsslTunnelStreamSubmitOptions, RsslErrorInfo *pError)
@@ -7979,23 +8427,23 @@ RSSL_VA_API RsslRet rsslTunnelStreamSubmit(RsslTunnelStream *pTunnelStream, Rssl
 	pReactorChannelImpl = (RsslReactorChannelImpl *)pTunnelManagerImpl->base._pReactorChannel;
 	pReactorImpl = (RsslReactorImpl*)pReactorChannelImpl->pParentReactor;
 
-	if ((ret = reactorLockInterface(pReactorImpl, RSSL_TRUE, pError)) != RSSL_RET_SUCCESS)
+	if ((ret = reactorLockShard(pReactorChannelImpl->pShard, RSSL_TRUE, pError)) != RSSL_RET_SUCCESS)
 		return ret;
 
 	if (pReactorImpl->state != RSSL_REACTOR_ST_ACTIVE)
 	{
 		rsslSetErrorInfo(pError, RSSL_EIC_SHUTDOWN, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "Reactor is shutting down.");
-		return (reactorUnlockInterface(pReactorImpl), RSSL_RET_FAILURE);
+		return (reactorUnlockShard(pReactorChannelImpl->pShard), RSSL_RET_FAILURE);
 	}
 
 	if ((ret = tunnelManagerSubmitBuffer((TunnelManager *)pTunnelManagerImpl, pTunnelStream, pBuffer, pRsslTunnelStreamSubmitOptions, pError))
 				!= RSSL_RET_SUCCESS)
-		return (reactorUnlockInterface(pReactorChannelImpl->pParentReactor), ret);
+		return (reactorUnlockShard(pReactorChannelImpl->pShard), ret);
 
 	if ((ret = _reactorHandleTunnelManagerEvents(pReactorImpl, pReactorChannelImpl, pError)) != RSSL_RET_SUCCESS)
-		return (reactorUnlockInterface(pReactorImpl), ret);
+		return (reactorUnlockShard(pReactorChannelImpl->pShard), ret);
 
-	return (reactorUnlockInterface(pReactorChannelImpl->pParentReactor), RSSL_RET_SUCCESS);
+	return (reactorUnlockShard(pReactorChannelImpl->pShard), RSSL_RET_SUCCESS);
 }
 
 RSSL_VA_API RsslRet rsslReactorAcceptTunnelStream(RsslTunnelStreamRequestEvent *pEvent, RsslReactorAcceptTunnelStreamOptions *pOptions, RsslErrorInfo *pError)
@@ -8022,17 +8470,17 @@ RSSL_VA_API RsslRet rsslReactorAcceptTunnelStream(RsslTunnelStreamRequestEvent *
 	pReactorChannelImpl = (RsslReactorChannelImpl*)pEvent->pReactorChannel;
 	pReactorImpl = (RsslReactorImpl*)pReactorChannelImpl->pParentReactor;
 	
-	if ((ret = reactorLockInterface(pReactorImpl, RSSL_TRUE, pError)) != RSSL_RET_SUCCESS)
+	if ((ret = reactorLockShard(pReactorChannelImpl->pShard, RSSL_TRUE, pError)) != RSSL_RET_SUCCESS)
 		return ret;
 
 	if (pReactorImpl->state != RSSL_REACTOR_ST_ACTIVE)
 	{
 		rsslSetErrorInfo(pError, RSSL_EIC_SHUTDOWN, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "Reactor is shutting down.");
-		return (reactorUnlockInterface(pReactorImpl), RSSL_RET_FAILURE);
+		return (reactorUnlockShard(pReactorChannelImpl->pShard), RSSL_RET_FAILURE);
 	}
 
 	if ((ret = tunnelManagerAcceptStream(pReactorChannelImpl->pTunnelManager, pEvent, pOptions, pError)) != RSSL_RET_SUCCESS)
-		return (reactorUnlockInterface(pReactorImpl), ret);
+		return (reactorUnlockShard(pReactorChannelImpl->pShard), ret);
 
 	// send a dispatch tunnel stream event if necessary
 	if (pReactorChannelImpl->pTunnelManager->_needsDispatchNow && !pReactorChannelImpl->tunnelDispatchEventQueued)
@@ -8044,10 +8492,10 @@ RSSL_VA_API RsslRet rsslReactorAcceptTunnelStream(RsslTunnelStreamRequestEvent *
 		pDispatchEvent->channelEvent.channelEventType = (RsslReactorChannelEventType)RSSL_RCIMPL_CET_DISPATCH_TUNNEL_STREAM;
 		pDispatchEvent->channelEvent.pReactorChannel = (RsslReactorChannel*)pReactorChannelImpl;
 		ret = rsslReactorEventQueuePut(&pReactorChannelImpl->eventQueue, (RsslReactorEventImpl*)pDispatchEvent);
-		return (reactorUnlockInterface(pReactorImpl), ret);
+		return (reactorUnlockShard(pReactorChannelImpl->pShard), ret);
 	}
 
-	return (reactorUnlockInterface(pReactorImpl), RSSL_RET_SUCCESS);
+	return (reactorUnlockShard(pReactorChannelImpl->pShard), RSSL_RET_SUCCESS);
 }
 
 RSSL_VA_API RsslRet rsslReactorRejectTunnelStream(RsslTunnelStreamRequestEvent *pEvent, RsslReactorRejectTunnelStreamOptions *pOptions, RsslErrorInfo *pError)
@@ -8074,18 +8522,18 @@ RSSL_VA_API RsslRet rsslReactorRejectTunnelStream(RsslTunnelStreamRequestEvent *
 	pReactorChannelImpl = (RsslReactorChannelImpl*)pEvent->pReactorChannel;
 	pReactorImpl = (RsslReactorImpl*)pReactorChannelImpl->pParentReactor;
 
-	if ((ret = reactorLockInterface(pReactorImpl, RSSL_TRUE, pError)) != RSSL_RET_SUCCESS)
+	if ((ret = reactorLockShard(pReactorChannelImpl->pShard, RSSL_TRUE, pError)) != RSSL_RET_SUCCESS)
 		return ret;
 
 	if (pReactorImpl->state != RSSL_REACTOR_ST_ACTIVE)
 	{
 		rsslSetErrorInfo(pError, RSSL_EIC_SHUTDOWN, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "Reactor is shutting down.");
-		return (reactorUnlockInterface(pReactorImpl), RSSL_RET_FAILURE);
+		return (reactorUnlockShard(pReactorChannelImpl->pShard), RSSL_RET_FAILURE);
 	}
 
 	ret = tunnelManagerRejectStream(pReactorChannelImpl->pTunnelManager, pEvent, pOptions, pError);
 
-	return (reactorUnlockInterface(pReactorImpl), ret);
+	return (reactorUnlockShard(pReactorChannelImpl->pShard), ret);
 }
 
 RSSL_VA_API RsslRet rsslTunnelStreamSubmitMsg(RsslTunnelStream *pTunnelStream, RsslTunnelStreamSubmitMsgOptions *pRsslTunnelStreamSubmitMsgOptions, RsslErrorInfo *pError)
@@ -8116,30 +8564,30 @@ RSSL_VA_API RsslRet rsslTunnelStreamSubmitMsg(RsslTunnelStream *pTunnelStream, R
 	pReactorChannelImpl = (RsslReactorChannelImpl *)pTunnelManagerImpl->base._pReactorChannel;
 	pReactorImpl = (RsslReactorImpl*)pReactorChannelImpl->pParentReactor;
 
-	if ((ret = reactorLockInterface(pReactorImpl, RSSL_TRUE, pError)) != RSSL_RET_SUCCESS)
+	if ((ret = reactorLockShard(pReactorChannelImpl->pShard, RSSL_TRUE, pError)) != RSSL_RET_SUCCESS)
 		return ret;
 
 	if (pReactorImpl->state != RSSL_REACTOR_ST_ACTIVE)
 	{
 		rsslSetErrorInfo(pError, RSSL_EIC_SHUTDOWN, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "Reactor is shutting down.");
-		return (reactorUnlockInterface(pReactorImpl), RSSL_RET_FAILURE);
+		return (reactorUnlockShard(pReactorChannelImpl->pShard), RSSL_RET_FAILURE);
 	}
 
 	if ((ret = tunnelManagerSubmit((TunnelManager *)pTunnelManagerImpl, pTunnelStream, pRsslTunnelStreamSubmitMsgOptions, pError)) != RSSL_RET_SUCCESS)
-		return (reactorUnlockInterface(pReactorChannelImpl->pParentReactor), RSSL_RET_FAILURE);
+		return (reactorUnlockShard(pReactorChannelImpl->pShard), RSSL_RET_FAILURE);
 
 	// send a dispatch tunnel stream event if necessary
 	if ((ret = _reactorHandleTunnelManagerEvents(pReactorImpl, pReactorChannelImpl, pError)) != RSSL_RET_SUCCESS)
-		return (reactorUnlockInterface(pReactorImpl), ret);
+		return (reactorUnlockShard(pReactorChannelImpl->pShard), ret);
 
-	return (reactorUnlockInterface(pReactorChannelImpl->pParentReactor), RSSL_RET_SUCCESS);
+	return (reactorUnlockShard(pReactorChannelImpl->pShard), RSSL_RET_SUCCESS);
 }
 
 RSSL_VA_API RsslRet rsslReactorSubmitOAuthCredentialRenewal(RsslReactor *pReactor, RsslReactorOAuthCredentialRenewalOptions *pOptions,
 	RsslReactorOAuthCredentialRenewal *pReactorOAuthCredentialRenewal, RsslErrorInfo *pError)
 {
 	RsslRet ret;
-	RsslReactorImpl *pReactorImpl = (RsslReactorImpl*)pReactor;
+	RsslReactorImpl *pReactorImpl;
 	RsslReactorOAuthCredentialRenewal *pOAuthCredentialRenewal = NULL;
 	RsslReactorTokenSessionImpl *pTokenSessionImpl = NULL;
 
@@ -8152,6 +8600,8 @@ RSSL_VA_API RsslRet rsslReactorSubmitOAuthCredentialRenewal(RsslReactor *pReacto
 		return RSSL_RET_INVALID_ARGUMENT;
 	}
 
+	pReactorImpl = rsslReactorGetImpl(pReactor);
+
 	if ((ret = reactorLockInterface(pReactorImpl, RSSL_TRUE, pError)) != RSSL_RET_SUCCESS)
 		return ret;
 
@@ -8291,7 +8741,8 @@ RSSL_VA_API RsslRet rsslReactorRetrieveChannelStatistic(RsslReactor *pReactor, R
 	RsslReactorChannelStatistic *pRsslReactorChannelStatistic, RsslErrorInfo *pError)
 {
 	RsslRet ret;
-	RsslReactorImpl *pReactorImpl = (RsslReactorImpl*)pReactor;
+	RsslReactorImpl *pReactorImpl;
+	RsslReactorShardImpl *pShard;
 	RsslReactorChannelImpl *pReactorChannelImpl = (RsslReactorChannelImpl*)pReactorChannel;
 
 	if (!pError)
@@ -8303,31 +8754,34 @@ RSSL_VA_API RsslRet rsslReactorRetrieveChannelStatistic(RsslReactor *pReactor, R
 		return RSSL_RET_INVALID_ARGUMENT;
 	}
 
-	if ((ret = reactorLockInterface(pReactorImpl, RSSL_TRUE, pError)) != RSSL_RET_SUCCESS)
+	pReactorImpl = rsslReactorGetImpl(pReactor);
+	pShard = _reactorChannelShard(pReactorImpl, pReactorChannel);
+
+	if ((ret = reactorLockShard(pShard, RSSL_TRUE, pError)) != RSSL_RET_SUCCESS)
 		return ret;
 
 	if (pReactorImpl->state != RSSL_REACTOR_ST_ACTIVE)
 	{
 		rsslSetErrorInfo(pError, RSSL_EIC_SHUTDOWN, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "Reactor is shutting down.");
-		return (reactorUnlockInterface(pReactorImpl), RSSL_RET_INVALID_ARGUMENT);
+		return (reactorUnlockShard(pShard), RSSL_RET_INVALID_ARGUMENT);
 	}
 
 	if (!pReactorChannel)
 	{
 		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "RsslReactorChannel not provided.");
-		return (reactorUnlockInterface(pReactorImpl), RSSL_RET_INVALID_ARGUMENT);
+		return (reactorUnlockShard(pShard), RSSL_RET_INVALID_ARGUMENT);
 	}
 
 	if (!pRsslReactorChannelStatistic)
 	{
 		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "RsslReactorChannelStatistic not provided.");
-		return (reactorUnlockInterface(pReactorImpl), RSSL_RET_INVALID_ARGUMENT);
+		return (reactorUnlockShard(pShard), RSSL_RET_INVALID_ARGUMENT);
 	}
 
 	if ( (pReactorChannelImpl->statisticFlags & (RSSL_RC_ST_READ | RSSL_RC_ST_WRITE | RSSL_RC_ST_PING)) == 0 )
 	{
 		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "RsslReactorChannel not interested in channel statistics.");
-		return (reactorUnlockInterface(pReactorImpl), RSSL_RET_INVALID_ARGUMENT);
+		return (reactorUnlockShard(pShard), RSSL_RET_INVALID_ARGUMENT);
 	}
 
 	rsslClearReactorChannelStatistic(pRsslReactorChannelStatistic);
@@ -8339,7 +8793,15 @@ RSSL_VA_API RsslRet rsslReactorRetrieveChannelStatistic(RsslReactor *pReactor, R
 		rsslClearReactorChannelStatistic(pReactorChannelImpl->pChannelStatistic);
 	}
 
-	return (reactorUnlockInterface(pReactorImpl), RSSL_RET_SUCCESS);
+	if (pReactorChannelImpl->pWatchlist)
+	{
+		pRsslReactorChannelStatistic->viewFilteredMsgs = pReactorChannelImpl->pWatchlist->viewFilteredMsgs;
+		pRsslReactorChannelStatistic->viewFilteredBytesSaved = pReactorChannelImpl->pWatchlist->viewFilteredBytesSaved;
+		pReactorChannelImpl->pWatchlist->viewFilteredMsgs = 0;
+		pReactorChannelImpl->pWatchlist->viewFilteredBytesSaved = 0;
+	}
+
+	return (reactorUnlockShard(pShard), RSSL_RET_SUCCESS);
 }
 
 RsslUInt32 packedBufferHashU64Sum(void* pReactorPackedBufferImpl)
@@ -8470,18 +8932,18 @@ RSSL_VA_API RsslBuffer* rsslReactorGetBuffer(RsslReactorChannel *channel, RsslUI
 		RsslReactorImpl *pReactorImpl = pReactorChannel->pParentReactor;
 		RsslReactorPackedBufferImpl *pPackedBufferImpl = NULL;
 
-		if ((ret = reactorLockInterface(pReactorImpl, RSSL_TRUE, pError)) != RSSL_RET_SUCCESS)
+		if ((ret = reactorLockShard(pReactorChannel->pShard, RSSL_TRUE, pError)) != RSSL_RET_SUCCESS)
 			return pBuffer;
 
 		if (pReactorImpl->state != RSSL_REACTOR_ST_ACTIVE)
 		{
 			rsslSetErrorInfo(pError, RSSL_EIC_SHUTDOWN, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "Reactor is shutting down.");
-			return (reactorUnlockInterface(pReactorImpl), pBuffer);
+			return (reactorUnlockShard(pReactorChannel->pShard), pBuffer);
 		}
 
 		/* Since the application passed in this channel, make sure it is valid for this reactor and that it is active. */
 		if (!pReactorChannel || !rsslReactorChannelIsValid(pReactorImpl, pReactorChannel, pError))
-			return (reactorUnlockInterface(pReactorImpl), pBuffer);
+			return (reactorUnlockShard(pReactorChannel->pShard), pBuffer);
 
 
 		if (pReactorChannel->packedBufferHashTable.queueList == NULL)
@@ -8490,7 +8952,7 @@ RSSL_VA_API RsslBuffer* rsslReactorGetBuffer(RsslReactorChannel *channel, RsslUI
 				packedBufferHashU64Compare, RSSL_TRUE, pError) != RSSL_RET_SUCCESS)
 			{
 				rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to initialize RsslHashTable for handling packed buffer.");
-				return (reactorUnlockInterface(pReactorImpl), pBuffer);
+				return (reactorUnlockShard(pReactorChannel->pShard), pBuffer);
 			}
 		}
 
@@ -8499,7 +8961,7 @@ RSSL_VA_API RsslBuffer* rsslReactorGetBuffer(RsslReactorChannel *channel, RsslUI
 		if (!pPackedBufferImpl)
 		{
 			rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to create RsslReactorPackedBufferImpl for handling packed buffer.");
-			return (reactorUnlockInterface(pReactorImpl), pBuffer);
+			return (reactorUnlockShard(pReactorChannel->pShard), pBuffer);
 		}
 
 		rsslClearReactorPackedBufferImpl(pPackedBufferImpl);
@@ -8508,7 +8970,7 @@ RSSL_VA_API RsslBuffer* rsslReactorGetBuffer(RsslReactorChannel *channel, RsslUI
 		if (!pBuffer)
 		{
 			rsslSetErrorInfoLocation(pError, __FILE__, __LINE__);
-			return (reactorUnlockInterface(pReactorImpl), pBuffer);
+			return (reactorUnlockShard(pReactorChannel->pShard), pBuffer);
 		}
 
 		pPackedBufferImpl->totalSize = size; /* Keeps the size of the packed buffer */
@@ -8516,7 +8978,7 @@ RSSL_VA_API RsslBuffer* rsslReactorGetBuffer(RsslReactorChannel *channel, RsslUI
 
 		rsslHashTableInsertLink(&pReactorChannel->packedBufferHashTable, &pPackedBufferImpl->hashLink, pBuffer, NULL);
 
-		return (reactorUnlockInterface(pReactorImpl), pBuffer);
+		return (reactorUnlockShard(pReactorChannel->pShard), pBuffer);
 
 	}
 	else
@@ -8540,13 +9002,13 @@ RSSL_VA_API RsslRet rsslReactorReleaseBuffer(RsslReactorChannel *channel, RsslBu
 		RsslReactorPackedBufferImpl *pPackedBufferImpl = NULL;
 		RsslReactorImpl *pReactorImpl = pReactorChannel->pParentReactor;
 
-		if ((ret = reactorLockInterface(pReactorImpl, RSSL_TRUE, pError)) != RSSL_RET_SUCCESS)
+		if ((ret = reactorLockShard(pReactorChannel->pShard, RSSL_TRUE, pError)) != RSSL_RET_SUCCESS)
 			return ret;
 
 		if (pReactorImpl->state != RSSL_REACTOR_ST_ACTIVE)
 		{
 			rsslSetErrorInfo(pError, RSSL_EIC_SHUTDOWN, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "Reactor is shutting down.");
-			return (reactorUnlockInterface(pReactorImpl), RSSL_RET_FAILURE);
+			return (reactorUnlockShard(pReactorChannel->pShard), RSSL_RET_FAILURE);
 		}
 
 		if( pReactorChannel->packedBufferHashTable.elementCount != 0 )
@@ -8567,7 +9029,7 @@ RSSL_VA_API RsslRet rsslReactorReleaseBuffer(RsslReactorChannel *channel, RsslBu
 		if (ret != RSSL_RET_SUCCESS)
 			rsslSetErrorInfoLocation(pError, __FILE__, __LINE__);
 
-		return (reactorUnlockInterface(pReactorImpl), ret);
+		return (reactorUnlockShard(pReactorChannel->pShard), ret);
 	}
 	else
 	{
@@ -8593,23 +9055,23 @@ RSSL_VA_API RsslBuffer* rsslReactorPackBuffer(RsslReactorChannel *pChannel, Rssl
 		RsslReactorPackedBufferImpl *pPackedBufferImpl = NULL;
 		RsslHashLink *pHashLink;
 
-		if ((ret = reactorLockInterface(pReactorImpl, RSSL_TRUE, pError)) != RSSL_RET_SUCCESS)
+		if ((ret = reactorLockShard(pReactorChannel->pShard, RSSL_TRUE, pError)) != RSSL_RET_SUCCESS)
 			return pNewBuffer;
 
 		/* Since the application passed in this channel, make sure it is valid for this reactor and that it is active. */
 		if (!pReactorChannel || !rsslReactorChannelIsValid(pReactorImpl, pReactorChannel, pError))
-			return (reactorUnlockInterface(pReactorImpl), pNewBuffer);
+			return (reactorUnlockShard(pReactorChannel->pShard), pNewBuffer);
 
 		if (pReactorImpl->state != RSSL_REACTOR_ST_ACTIVE)
 		{
 			rsslSetErrorInfo(pError, RSSL_EIC_SHUTDOWN, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "Reactor is shutting down.");
-			return (reactorUnlockInterface(pReactorImpl), pNewBuffer);
+			return (reactorUnlockShard(pReactorChannel->pShard), pNewBuffer);
 		}
 
-		if (pReactorChannel->reactorParentQueue != &pReactorImpl->activeChannels)
+		if (pReactorChannel->reactorParentQueue != &pReactorChannel->pShard->activeChannels)
 		{
 			rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Channel is not active.");
-			return (reactorUnlockInterface(pReactorImpl), pNewBuffer);
+			return (reactorUnlockShard(pReactorChannel->pShard), pNewBuffer);
 		}
 
 		pHashLink = rsslHashTableFind(&pReactorChannel->packedBufferHashTable, pBuffer, NULL);
@@ -8621,14 +9083,14 @@ RSSL_VA_API RsslBuffer* rsslReactorPackBuffer(RsslReactorChannel *pChannel, Rssl
 		else
 		{
 			rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to find the packed buffer handling for JSON protocol.");
-			return (reactorUnlockInterface(pReactorImpl), pNewBuffer);
+			return (reactorUnlockShard(pReactorChannel->pShard), pNewBuffer);
 		}
 
 		/* Added checking to ensure that the JSON converter is initialized properly.*/
-		if (pReactorImpl->pJsonConverter == 0)
+		if (pReactorChannel->pShard->pJsonConverter == 0)
 		{
 			rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "The JSON converter library has not been initialized properly.");
-			return (reactorUnlockInterface(pReactorImpl), pNewBuffer);
+			return (reactorUnlockShard(pReactorChannel->pShard), pNewBuffer);
 		}
 
 		rsslClearMsg(&rsslMsg);
@@ -8650,11 +9112,11 @@ RSSL_VA_API RsslBuffer* rsslReactorPackBuffer(RsslReactorChannel *pChannel, Rssl
 
 			rsslClearConvertRsslMsgToJsonOptions(&rjcOptions);
 			rjcOptions.jsonProtocolType = RSSL_JSON_JPT_JSON2; /* Supported only for Simplified JSON */
-			if ((rsslConvertRsslMsgToJson(pReactorImpl->pJsonConverter, &rjcOptions, &rsslMsg, &rjcError)) != RSSL_RET_SUCCESS)
+			if ((rsslConvertRsslMsgToJson(pReactorChannel->pShard->pJsonConverter, &rjcOptions, &rsslMsg, &rjcError)) != RSSL_RET_SUCCESS)
 			{
 				rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__,
 					"Failed to convert RWF to JSON protocol. Error text: %s", rjcError.text);
-				return (reactorUnlockInterface(pReactorImpl), pNewBuffer);
+				return (reactorUnlockShard(pReactorChannel->pShard), pNewBuffer);
 			}
 
 			rsslClearGetJsonMsgOptions(&getJsonMsgOptions);
@@ -8662,12 +9124,12 @@ RSSL_VA_API RsslBuffer* rsslReactorPackBuffer(RsslReactorChannel *pChannel, Rssl
 			getJsonMsgOptions.streamId = rsslMsg.msgBase.streamId;
 			getJsonMsgOptions.isCloseMsg = (rsslMsg.msgBase.msgClass == RSSL_MC_CLOSE) ? RSSL_TRUE : RSSL_FALSE;
 
-			if ((ret = rsslGetConverterJsonMsg(pReactorImpl->pJsonConverter, &getJsonMsgOptions,
+			if ((ret = rsslGetConverterJsonMsg(pReactorChannel->pShard->pJsonConverter, &getJsonMsgOptions,
 				&jsonBuffer, &rjcError)) != RSSL_RET_SUCCESS)
 			{
 				rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__,
 					"Failed to get converted JSON message. Error text: %s", rjcError.text);
-				return (reactorUnlockInterface(pReactorImpl), pNewBuffer);
+				return (reactorUnlockShard(pReactorChannel->pShard), pNewBuffer);
 			}
 
 			if (pPackedBufferImpl->totalSize == pPackedBufferImpl->remainingSize)
@@ -8692,17 +9154,17 @@ RSSL_VA_API RsslBuffer* rsslReactorPackBuffer(RsslReactorChannel *pChannel, Rssl
 			{
 				rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_BUFFER_TOO_SMALL, __FILE__, __LINE__,
 					"Failed to pack buffer as the required buffer size(%d) is larger than the remaining packed buffer size(%d).", neededSize, pPackedBufferImpl->remainingSize);
-				return (reactorUnlockInterface(pReactorImpl), pNewBuffer);
+				return (reactorUnlockShard(pReactorChannel->pShard), pNewBuffer);
 			}
 		}
 		else
 		{
 			rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, ret, __FILE__, __LINE__,
 				"rsslDecodeMsg() failed to decode the passed in buffer as RWF messages.");
-			return (reactorUnlockInterface(pReactorImpl), pNewBuffer);
+			return (reactorUnlockShard(pReactorChannel->pShard), pNewBuffer);
 		}
 
-		return (reactorUnlockInterface(pReactorImpl), pNewBuffer);
+		return (reactorUnlockShard(pReactorChannel->pShard), pNewBuffer);
 	}
 	else
 	{
@@ -8732,7 +9194,7 @@ RSSL_VA_API RsslRet rsslReactorChannelIoctl(RsslReactorChannel *pReactorChannel,
 		return RSSL_RET_INVALID_ARGUMENT;
 	}
 
-	if ((ret = reactorLockInterface(pReactorImpl, RSSL_TRUE, pError)) != RSSL_RET_SUCCESS)
+	if ((ret = reactorLockShard(pReactorChannelImpl->pShard, RSSL_TRUE, pError)) != RSSL_RET_SUCCESS)
 		return RSSL_RET_FAILURE;
 
 	if (pReactorImpl->state != RSSL_REACTOR_ST_ACTIVE)
@@ -8770,7 +9232,7 @@ RSSL_VA_API RsslRet rsslReactorChannelIoctl(RsslReactorChannel *pReactorChannel,
 						{
 							rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, ret, __FILE__, __LINE__,
 								"Failed to allocate memory for the trace message file name.");
-							return (reactorUnlockInterface(pReactorImpl), RSSL_RET_FAILURE);
+							return (reactorUnlockShard(pReactorChannelImpl->pShard), RSSL_RET_FAILURE);
 						}
 
 						pReactorWarmStandByHandlerImpl->traceFileNameLength = (RsslUInt32)(fileNameLength + 1);
@@ -8861,18 +9323,30 @@ RSSL_VA_API RsslRet rsslReactorChannelIoctl(RsslReactorChannel *pReactorChannel,
 			rsslSetErrorInfoLocation(pError, __FILE__, __LINE__);
 	}
 
-	return (reactorUnlockInterface(pReactorImpl), ret);
+	return (reactorUnlockShard(pReactorChannelImpl->pShard), ret);
 }
 
-RsslRet reactorUnlockInterface(RsslReactorImpl *pReactorImpl)
+RsslRet reactorUnlockShard(RsslReactorShardImpl *pShard)
 {
-	RSSL_MUTEX_UNLOCK(&pReactorImpl->interfaceLock);
+#ifdef RSSL_REACTOR_DISPATCH_SHARDS
+	if (--pShard->lockCount == 0)
+		pShard->pLockThread = NULL;
+#endif
+	RSSL_MUTEX_UNLOCK(&pShard->interfaceLock);
 	return RSSL_RET_SUCCESS;
 }
 
+RsslRet reactorUnlockInterface(RsslReactorImpl *pReactorImpl)
+{
+	return reactorUnlockShard(&pReactorImpl->pShards[0]);
+}
+
+/* Sets the flag on the shard whose callbacks the thread is calling. */
 static void _reactorSetInCallback(RsslReactorImpl *pReactorImpl, RsslBool inCallback)
 {
-	pReactorImpl->inReactorFunction = inCallback;
+	RsslReactorShardImpl *pShard = _reactorHeldShard(pReactorImpl);
+
+	(pShard ? pShard : &pReactorImpl->pShards[0])->inReactorFunction = inCallback;
 }
 
 static RsslReactorOAuthCredentialRenewal* _reactorCopyRsslReactorOAuthCredentialRenewal(RsslReactorImpl *pReactorImpl, RsslReactorTokenSessionImpl *pTokenSessionImpl, 
@@ -12318,8 +12792,8 @@ static RsslBool isWarmStandbyChannelClosed(RsslReactorWarmStandByHandlerImpl* pW
 		{
 			if (pReactorChannel->reactorChannel.pRsslChannel->state == RSSL_CH_STATE_ACTIVE)
 			{
-				if (pReactorChannel->reactorParentQueue == &pReactorChannel->pParentReactor->reconnectingChannels ||
-					pReactorChannel->reactorParentQueue == &pReactorChannel->pParentReactor->inactiveChannels)
+				if (pReactorChannel->reactorParentQueue == &pReactorChannel->pShard->reconnectingChannels ||
+					pReactorChannel->reactorParentQueue == &pReactorChannel->pShard->inactiveChannels)
 				{
 					continue;
 				}
@@ -12970,8 +13444,8 @@ RsslBool isRsslChannelActive(RsslReactorChannelImpl *pReactorChannelImpl)
 	{
 		if (pReactorChannelImpl->reactorChannel.pRsslChannel->state == RSSL_CH_STATE_ACTIVE)
 		{
-			if (pReactorChannelImpl->reactorParentQueue == &pReactorChannelImpl->pParentReactor->reconnectingChannels ||
-				pReactorChannelImpl->reactorParentQueue == &pReactorChannelImpl->pParentReactor->inactiveChannels)
+			if (pReactorChannelImpl->reactorParentQueue == &pReactorChannelImpl->pShard->reconnectingChannels ||
+				pReactorChannelImpl->reactorParentQueue == &pReactorChannelImpl->pShard->inactiveChannels)
 			{
 				return RSSL_FALSE;
 			}
@@ -13208,6 +13682,7 @@ static RsslRet _reactorWSNotifyStatusMsg(RsslReactorChannelImpl *pReactorChannel
 
 		streamInfo.pServiceName = &pWSRecoveryMsgInfo->serviceName;
 		streamInfo.pUserSpec = pWSRecoveryMsgInfo->pUserSpec;
+		streamInfo.streamId = pWSRecoveryMsgInfo->streamId;
 
 		msgEvent.pRsslMsg = (RsslMsg*)&statusMsg;
 		msgEvent.pStreamInfo = (RsslStreamInfo*)&streamInfo;
@@ -13413,7 +13888,7 @@ static void _reactorWSDirectoryUpdateFromChannelDown(RsslReactorWarmStandbyGroup
 
 						if (pProcessReactorChannel != pReactorChannelImpl)
 						{
-							if (pProcessReactorChannel->reactorParentQueue == &pProcessReactorChannel->pParentReactor->closingChannels)
+							if (pProcessReactorChannel->reactorParentQueue == &pProcessReactorChannel->pShard->closingChannels)
 							{
 								continue; /* Countinue if this channel is being closed. */
 							}
@@ -13449,7 +13924,7 @@ static void _reactorWSDirectoryUpdateFromChannelDown(RsslReactorWarmStandbyGroup
 
 RSSL_VA_API RsslRet rsslReactorIoctl(RsslReactor* pReactor, RsslReactorIoctlCodes code, void* value, RsslErrorInfo* pError)
 {
-	RsslReactorImpl* pReactorImpl = (RsslReactorImpl*)pReactor;
+	RsslReactorImpl* pReactorImpl;
 	RsslRet ret = RSSL_RET_SUCCESS;
 
 	if (!pError)
@@ -13461,6 +13936,8 @@ RSSL_VA_API RsslRet rsslReactorIoctl(RsslReactor* pReactor, RsslReactorIoctlCode
 		return RSSL_RET_INVALID_ARGUMENT;
 	}
 
+	pReactorImpl = rsslReactorGetImpl(pReactor);
+
 	if ((ret = reactorLockInterface(pReactorImpl, RSSL_TRUE, pError)) != RSSL_RET_SUCCESS)
 		return ret;
 
@@ -45,6 +45,7 @@ RsslRet _reactorWorkerProcessChannelUp(RsslReactorImpl *pReactorImpl, RsslReacto
 /* Recalculate the "ping interval." It is the maximum time the worker wait for notification, since it must check for pings
  * it may need to send. */
 static void _reactorWorkerCalculateNextTimeout(RsslReactorImpl *pReactorImpl, RsslUInt32 newPingTimeoutSeconds);
+static RsslInt64 _reactorWorkerPingIntervalMs(RsslReactorChannelImpl *pReactorChannel);
 
 static void _reactorWorkerMoveChannel(RsslQueue *pNewList, RsslReactorChannelImpl *pReactorChannel);
 
@@ -120,6 +121,8 @@ RsslRet _reactorWorkerStart(RsslReactorImpl *pReactorImpl, RsslCreateReactorOpti
 	rsslInitQueue(&pReactorImpl->reactorWorker.reconnectingChannels);
 	rsslInitQueue(&pReactorImpl->reactorWorker.disposableRestHandles);
 
+	rsslTimerWheelInit(&pReactorImpl->reactorWorker.timerWheel, getCurrentTimeMs(pReactorImpl->ticksPerMsec));
+
 	/* Initialize the error information pool for the session management */
 	rsslInitQueue(&pReactorImpl->reactorWorker.errorInfoPool);
 	rsslInitQueue(&pReactorImpl->reactorWorker.errorInfoInUsedPool);
@@ -232,16 +235,15 @@ RsslRet _reactorWorkerStart(RsslReactorImpl *pReactorImpl, RsslCreateReactorOpti
 	return RSSL_RET_SUCCESS;
 }
 
-void _reactorWorkerCleanupReactor(RsslReactorImpl *pReactorImpl)
+/* Frees the channels, queues and notifier of a dispatch shard. */
+static void _reactorWorkerCleanupShard(RsslReactorShardImpl *pShard)
 {
 	RsslQueueLink *pLink;
-	RsslReactorWorker *pReactorWorker = &pReactorImpl->reactorWorker;
 
-	rsslCleanupReactorEventQueue(&pReactorImpl->reactorEventQueue);
-	rsslCleanupReactorEventQueue(&pReactorImpl->reactorWorker.workerQueue);
-	rsslCleanupReactorEventQueueGroup(&pReactorImpl->reactorWorker.activeEventQueueGroup);
-	rsslCleanupReactorEventQueueGroup(&pReactorImpl->activeEventQueueGroup);
-	while ((pLink = rsslQueueRemoveFirstLink(&pReactorImpl->channelPool)))
+	if (pShard->pEventQueue != &pShard->pReactorImpl->reactorEventQueue)
+		rsslCleanupReactorEventQueue(&pShard->eventQueue);
+	rsslCleanupReactorEventQueueGroup(&pShard->activeEventQueueGroup);
+	while ((pLink = rsslQueueRemoveFirstLink(&pShard->channelPool)))
 	{
 		RsslReactorChannelImpl *pReactorChannel = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorChannelImpl, reactorQueueLink, pLink);
 		_reactorWorkerFreeChannelRDMMsgs(pReactorChannel);
@@ -254,7 +256,7 @@ void _reactorWorkerCleanupReactor(RsslReactorImpl *pReactorImpl)
 			rsslDestroyNotifierEvent(pReactorChannel->pWorkerNotifierEvent);
 		free(pReactorChannel);
 	}
-	while ((pLink = rsslQueueRemoveFirstLink(&pReactorImpl->initializingChannels)))
+	while ((pLink = rsslQueueRemoveFirstLink(&pShard->initializingChannels)))
 	{
 		RsslReactorChannelImpl *pReactorChannel = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorChannelImpl, reactorQueueLink, pLink);
 		_reactorWorkerFreeChannelRDMMsgs(pReactorChannel);
@@ -269,7 +271,7 @@ void _reactorWorkerCleanupReactor(RsslReactorImpl *pReactorImpl)
 			rsslDestroyNotifierEvent(pReactorChannel->pWorkerNotifierEvent);
 		free(pReactorChannel);
 	}
-	while ((pLink = rsslQueueRemoveFirstLink(&pReactorImpl->activeChannels)))
+	while ((pLink = rsslQueueRemoveFirstLink(&pShard->activeChannels)))
 	{
 		RsslReactorChannelImpl *pReactorChannel = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorChannelImpl, reactorQueueLink, pLink);
 		_reactorWorkerFreeChannelRDMMsgs(pReactorChannel);
@@ -284,7 +286,7 @@ void _reactorWorkerCleanupReactor(RsslReactorImpl *pReactorImpl)
 			rsslDestroyNotifierEvent(pReactorChannel->pWorkerNotifierEvent);
 		free(pReactorChannel);
 	}
-	while ((pLink = rsslQueueRemoveFirstLink(&pReactorImpl->inactiveChannels)))
+	while ((pLink = rsslQueueRemoveFirstLink(&pShard->inactiveChannels)))
 	{
 		RsslReactorChannelImpl *pReactorChannel = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorChannelImpl, reactorQueueLink, pLink);
 		_reactorWorkerFreeChannelRDMMsgs(pReactorChannel);
@@ -299,7 +301,7 @@ void _reactorWorkerCleanupReactor(RsslReactorImpl *pReactorImpl)
 			rsslDestroyNotifierEvent(pReactorChannel->pWorkerNotifierEvent);
 		free(pReactorChannel);
 	}
-	while ((pLink = rsslQueueRemoveFirstLink(&pReactorImpl->closingChannels)))
+	while ((pLink = rsslQueueRemoveFirstLink(&pShard->closingChannels)))
 	{
 		RsslReactorChannelImpl *pReactorChannel = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorChannelImpl, reactorQueueLink, pLink);
 		_reactorWorkerFreeChannelRDMMsgs(pReactorChannel);
@@ -314,7 +316,7 @@ void _reactorWorkerCleanupReactor(RsslReactorImpl *pReactorImpl)
 			rsslDestroyNotifierEvent(pReactorChannel->pWorkerNotifierEvent);
 		free(pReactorChannel);
 	}
-	while ((pLink = rsslQueueRemoveFirstLink(&pReactorImpl->reconnectingChannels)))
+	while ((pLink = rsslQueueRemoveFirstLink(&pShard->reconnectingChannels)))
 	{
 		RsslReactorChannelImpl *pReactorChannel = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorChannelImpl, reactorQueueLink, pLink);
 		_reactorWorkerFreeChannelRDMMsgs(pReactorChannel);
@@ -329,36 +331,63 @@ void _reactorWorkerCleanupReactor(RsslReactorImpl *pReactorImpl)
 			rsslDestroyNotifierEvent(pReactorChannel->pWorkerNotifierEvent);
 		free(pReactorChannel);
 	}
-	while ((pLink = rsslQueueRemoveFirstLink(&pReactorImpl->closingWarmstandbyChannel)))
+	while ((pLink = rsslQueueRemoveFirstLink(&pShard->closingWarmstandbyChannel)))
 	{
 		RsslReactorWarmStandByHandlerImpl* pReactorWarmStandByHandlerImpl = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorWarmStandByHandlerImpl, reactorQueueLink, pLink);
 		RSSL_MUTEX_DESTROY(&pReactorWarmStandByHandlerImpl->warmStandByHandlerMutex);
 		free(pReactorWarmStandByHandlerImpl);
 	}
-	while ((pLink = rsslQueueRemoveFirstLink(&pReactorImpl->warmstandbyChannelPool)))
+	while ((pLink = rsslQueueRemoveFirstLink(&pShard->warmstandbyChannelPool)))
 	{
 		RsslReactorWarmStandByHandlerImpl* pReactorWarmStandByHandlerImpl = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorWarmStandByHandlerImpl, reactorQueueLink, pLink);
 		RSSL_MUTEX_DESTROY(&pReactorWarmStandByHandlerImpl->warmStandByHandlerMutex);
 		free(pReactorWarmStandByHandlerImpl);
 	}
 
-	if (pReactorImpl->pNotifier)
-		rsslDestroyNotifier(pReactorImpl->pNotifier);
+	if (pShard->pNotifier)
+		rsslDestroyNotifier(pShard->pNotifier);
+
+	if (pShard->pQueueNotifierEvent)
+		rsslDestroyNotifierEvent(pShard->pQueueNotifierEvent);
+
+	if (pShard->memoryBuffer.data)
+		free(pShard->memoryBuffer.data);
+
+	if (pShard->pJsonConverter)
+	{
+		RsslJsonConverterError rjcError;
+		rsslDestroyRsslJsonConverter(pShard->pJsonConverter, &rjcError);
+		pShard->pJsonConverter = NULL;
+	}
+
+	if (pShard->pJsonErrorInfo)
+	{
+		free(pShard->pJsonErrorInfo);
+		pShard->pJsonErrorInfo = NULL;
+	}
+
+	RSSL_MUTEX_DESTROY(&pShard->interfaceLock);
+}
+
+void _reactorWorkerCleanupReactor(RsslReactorImpl *pReactorImpl)
+{
+	RsslQueueLink *pLink;
+	RsslReactorWorker *pReactorWorker = &pReactorImpl->reactorWorker;
+	RsslUInt32 i;
+
+	rsslCleanupReactorEventQueue(&pReactorImpl->reactorEventQueue);
+	rsslCleanupReactorEventQueue(&pReactorImpl->reactorWorker.workerQueue);
+	rsslCleanupReactorEventQueueGroup(&pReactorImpl->reactorWorker.activeEventQueueGroup);
+
+	for (i = 0; i < pReactorImpl->shardCount; ++i)
+		_reactorWorkerCleanupShard(&pReactorImpl->pShards[i]);
 
 	if (pReactorWorker->pNotifier)
 		rsslDestroyNotifier(pReactorWorker->pNotifier);
 
-	if (pReactorImpl->pQueueNotifierEvent)
-		rsslDestroyNotifierEvent(pReactorImpl->pQueueNotifierEvent);
-
 	if (pReactorWorker->pQueueNotifierEvent)
 		rsslDestroyNotifierEvent(pReactorWorker->pQueueNotifierEvent);
 
-	if (pReactorImpl->memoryBuffer.data)
-		free(pReactorImpl->memoryBuffer.data);
-
-	RSSL_MUTEX_DESTROY(&pReactorImpl->interfaceLock);
-
 	/* Ensure that the worker thread is started before cleaning up its resources */
 	if (pReactorImpl->rsslWorkerStarted)
 	{
@@ -426,24 +455,11 @@ void _reactorWorkerCleanupReactor(RsslReactorImpl *pReactorImpl)
 
 		rsslJsonUninitialize();
 
-		if (pReactorImpl->pJsonConverter)
-		{
-			RsslJsonConverterError rjcError;
-			rsslDestroyRsslJsonConverter(pReactorImpl->pJsonConverter, &rjcError);
-			pReactorImpl->pJsonConverter = NULL;
-		}
-
 		if (pReactorImpl->pDictionaryList)
 		{
 			free(pReactorImpl->pDictionaryList);
 			pReactorImpl->pDictionaryList = NULL;
 		}
-
-		if (pReactorImpl->pJsonErrorInfo)
-		{
-			free(pReactorImpl->pJsonErrorInfo);
-			pReactorImpl->pJsonErrorInfo = NULL;
-		}
 	}
 
 	/* For RDP token management and service discovery */
@@ -456,6 +472,7 @@ void _reactorWorkerCleanupReactor(RsslReactorImpl *pReactorImpl)
 	free(pReactorImpl->tokenServiceURLBufferV2.data);
 	free(pReactorImpl->serviceDiscoveryURLBuffer.data);
 
+	free(pReactorImpl->pShards);
 	free(pReactorImpl);
 
 	/* rsslInitialize/rsslUninitialize are reference counted, so decrement the reactor's call. */
@@ -508,9 +525,13 @@ RsslRet _reactorWorkerProcessChannelUp(RsslReactorImpl *pReactorImpl, RsslReacto
 	rsslNotifierUnregisterWrite(pReactorWorker->pNotifier, pReactorChannel->pWorkerNotifierEvent);
 
 	_reactorWorkerMoveChannel(&pReactorWorker->activeChannels, pReactorChannel);
-	_reactorWorkerCalculateNextTimeout(pReactorImpl, (RsslUInt32)(pReactorChannel->reactorChannel.pRsslChannel->pingTimeout * 1000 * pingIntervalFactor));
+	_reactorWorkerCalculateNextTimeout(pReactorImpl, (RsslUInt32)_reactorWorkerPingIntervalMs(pReactorChannel));
 	pReactorChannel->lastPingSentMs = pReactorWorker->lastRecordedTimeMs;
 
+	rsslTimerWheelAdd(&pReactorWorker->timerWheel, &pReactorChannel->pingTimer, pReactorChannel->lastPingSentMs + _reactorWorkerPingIntervalMs(pReactorChannel));
+	if (pReactorChannel->nextExpireTime != RCIMPL_TIMER_UNSET)
+		rsslTimerWheelAdd(&pReactorWorker->timerWheel, &pReactorChannel->expireTimer, pReactorChannel->nextExpireTime);
+
 	/* Copy RsslChannel parameters */
 	pReactorChannel->reactorChannel.socketId = pReactorChannel->reactorChannel.pRsslChannel->socketId;
 	pReactorChannel->reactorChannel.oldSocketId = pReactorChannel->reactorChannel.pRsslChannel->oldSocketId;
@@ -597,6 +618,12 @@ RsslRet _reactorWorkerSendTimerExpired(RsslReactorImpl *pReactorImpl, RsslReacto
 	return RSSL_RET_SUCCESS;
 }
 
+/* Interval at which an active channel sends pings. */
+static RsslInt64 _reactorWorkerPingIntervalMs(RsslReactorChannelImpl *pReactorChannel)
+{
+	return (RsslInt64)(pReactorChannel->reactorChannel.pRsslChannel->pingTimeout * 1000 * pingIntervalFactor);
+}
+
 static void _reactorWorkerCalculateNextTimeout(RsslReactorImpl *pReactorImpl, RsslUInt32 newTimeoutMicroSeconds)
 {
 	RsslReactorWorker *pReactorWorker = &pReactorImpl->reactorWorker;
@@ -607,6 +634,15 @@ static void _reactorWorkerCalculateNextTimeout(RsslReactorImpl *pReactorImpl, Rs
 
 void _reactorWorkerMoveChannel(RsslQueue *pNewList, RsslReactorChannelImpl *pReactorChannel)
 { 
+	RsslReactorWorker *pReactorWorker = &pReactorChannel->pParentReactor->reactorWorker;
+
+	/* Only active channels have timers. */
+	if (pNewList != &pReactorWorker->activeChannels)
+	{
+		rsslTimerWheelCancel(&pReactorWorker->timerWheel, &pReactorChannel->pingTimer);
+		rsslTimerWheelCancel(&pReactorWorker->timerWheel, &pReactorChannel->expireTimer);
+	}
+
 	if (pReactorChannel->workerParentList)
 	{
 		rsslQueueRemoveLink(pReactorChannel->workerParentList, &pReactorChannel->workerLink);
@@ -651,6 +687,8 @@ RSSL_THREAD_DECLARE(runReactorWorker, pArg)
 		RsslReactorChannelImpl *pReactorChannel;
 		RsslRestHandle *pRestHandle;
 		RsslQueueLink *pLink;
+		RsslTimerWheelTimer *pTimer;
+		RsslInt64 nextTimerExpireTime;
 
 		ret = rsslNotifierWait(pReactorWorker->pNotifier, pReactorWorker->sleepTimeMs * 1000);
 
@@ -706,6 +744,23 @@ RSSL_THREAD_DECLARE(runReactorWorker, pArg)
 												_reactorWorkerMoveChannel(&pReactorWorker->inactiveChannels, pReactorChannel);
 												pReactorChannel->lastPingSentMs = 0;
 
+												break;
+											}
+										case RSSL_RCIMPL_CET_FD_CHANGE:
+											{
+												/* The reactor thread changed this channel's descriptor (RSSL_RET_READ_FD_CHANGE). */
+												if (pReactorChannel->workerParentList == &pReactorWorker->activeChannels
+														&& pReactorChannel->reactorChannel.pRsslChannel != NULL
+														&& pReactorChannel->reactorChannel.pRsslChannel->socketId != REACTOR_INVALID_SOCKET
+														&& rsslNotifierEventGetFd(pReactorChannel->pWorkerNotifierEvent) != pReactorChannel->reactorChannel.pRsslChannel->socketId)
+												{
+													if (rsslNotifierUpdateEventFd(pReactorWorker->pNotifier, pReactorChannel->pWorkerNotifierEvent, (int)pReactorChannel->reactorChannel.pRsslChannel->socketId) < 0)
+													{
+														rsslSetErrorInfo(&pReactorWorker->workerCerr, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__,
+																"Failed to update file descriptor for channel.");
+														return (_reactorWorkerShutdown(pReactorImpl, &pReactorWorker->workerCerr), RSSL_THREAD_RETURN());
+													}
+												}
 												break;
 											}
 										case RSSL_RC_CET_CHANNEL_DOWN_RECONNECTING:
@@ -919,13 +974,13 @@ RSSL_THREAD_DECLARE(runReactorWorker, pArg)
 													_rsslFreeWarmStandbyHandler(pReactorWarmStandbyHandlerImpl, pReactorWarmStandbyHandlerImpl->warmStandbyGroupCount, RSSL_FALSE);
 													pReactorWarmStandbyHandlerImpl->warmStandByHandlerState = RSSL_RWSB_STATE_INACTIVE;
 
-													pEvent = (RsslReactorWarmStanbyEvent*)rsslReactorEventQueueGetFromPool(&pReactorImpl->reactorEventQueue);
+													pEvent = (RsslReactorWarmStanbyEvent*)rsslReactorEventQueueGetFromPool(rsslReactorChannelEventQueue(pReactorChannel));
 													rsslClearReactorWarmStanbyEvent(pEvent);
 
 													pEvent->reactorWarmStandByEventType = RSSL_RCIMPL_WSBET_MOVE_WSB_HANDLER_BACK_TO_POOL;
 													pEvent->pReactorWarmStandByHandlerImpl = (void*)pReactorWarmStandbyHandlerImpl;
 
-													if (!RSSL_ERROR_INFO_CHECK(rsslReactorEventQueuePut(&pReactorImpl->reactorEventQueue, (RsslReactorEventImpl*)pEvent) == RSSL_RET_SUCCESS, RSSL_RET_FAILURE, &pReactorWorker->workerCerr))
+													if (!RSSL_ERROR_INFO_CHECK(rsslReactorEventQueuePut(rsslReactorChannelEventQueue(pReactorChannel), (RsslReactorEventImpl*)pEvent) == RSSL_RET_SUCCESS, RSSL_RET_FAILURE, &pReactorWorker->workerCerr))
 														return (_reactorWorkerShutdown(pReactorImpl, &pReactorWorker->workerCerr), RSSL_THREAD_RETURN());
 												}
 
@@ -969,7 +1024,13 @@ RSSL_THREAD_DECLARE(runReactorWorker, pArg)
 							case RSSL_RCIMPL_ET_TIMER:
 								{
 									RsslReactorTimerEvent *pTimerEvent = &pEvent->timerEvent;
-									((RsslReactorChannelImpl*)pTimerEvent->pReactorChannel)->nextExpireTime = pTimerEvent->expireTime;
+									RsslReactorChannelImpl *pTimerChannel = (RsslReactorChannelImpl*)pTimerEvent->pReactorChannel;
+
+									pTimerChannel->nextExpireTime = pTimerEvent->expireTime;
+
+									/* Channels that are not active yet get the timer when they become active. */
+									if (pTimerChannel->workerParentList == &pReactorWorker->activeChannels)
+										rsslTimerWheelAdd(&pReactorWorker->timerWheel, &pTimerChannel->expireTimer, pTimerChannel->nextExpireTime);
 									break;
 								}
 
@@ -1360,14 +1421,14 @@ RSSL_THREAD_DECLARE(runReactorWorker, pArg)
 												rsslFreeReactorTokenSessionImpl(pTokenSessionImpl);
 											}
 
-											pEvent = (RsslReactorTokenSessionEvent*)rsslReactorEventQueueGetFromPool(&pReactorImpl->reactorEventQueue);
+											pEvent = (RsslReactorTokenSessionEvent*)rsslReactorEventQueueGetFromPool(rsslReactorChannelEventQueue(pReactorChannelImpl));
 											rsslClearReactorTokenSessionEvent(pEvent);
 
 											pEvent->reactorTokenSessionEventType = RSSL_RCIMPL_TSET_RETURN_CHANNEL_TO_CHANNEL_POOL;
 											pEvent->pReactorChannel = (RsslReactorChannel*)pReactorChannelImpl;
 											pEvent->pTokenSessionImpl = NULL;
 
-											if (!RSSL_ERROR_INFO_CHECK(rsslReactorEventQueuePut(&pReactorImpl->reactorEventQueue, (RsslReactorEventImpl*)pEvent) == RSSL_RET_SUCCESS, RSSL_RET_FAILURE, &pReactorWorker->workerCerr))
+											if (!RSSL_ERROR_INFO_CHECK(rsslReactorEventQueuePut(rsslReactorChannelEventQueue(pReactorChannelImpl), (RsslReactorEventImpl*)pEvent) == RSSL_RET_SUCCESS, RSSL_RET_FAILURE, &pReactorWorker->workerCerr))
 											{
 												return (_reactorWorkerShutdown(pReactorImpl, &pReactorWorker->workerCerr), RSSL_THREAD_RETURN());
 											}
@@ -1570,23 +1631,32 @@ RSSL_THREAD_DECLARE(runReactorWorker, pArg)
 			}
 		}
 
-		RSSL_QUEUE_FOR_EACH_LINK(&pReactorWorker->activeChannels, pLink)
+		/* Process the active channels whose ping or timer-event timers have expired. */
+		rsslTimerWheelAdvance(&pReactorWorker->timerWheel, pReactorWorker->lastRecordedTimeMs);
+		while ((pTimer = rsslTimerWheelPopExpired(&pReactorWorker->timerWheel)))
 		{
-			RsslBool sendPingMessage = RSSL_TRUE;
-			pReactorChannel = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorChannelImpl, workerLink, pLink);
+			pReactorChannel = (RsslReactorChannelImpl*)pTimer->pUserSpec;
 
-			/* Checks whether to send a ping message for the JSON protocol. */
-			if (pReactorChannel->reactorChannel.pRsslChannel->protocolType == RSSL_JSON_PROTOCOL_TYPE)
+			if (pTimer == &pReactorChannel->expireTimer)
 			{
-				sendPingMessage = pReactorChannel->sendWSPingMessage; 
+				/* Timer expired for this channel, send event back. */
+				_reactorWorkerSendTimerExpired(pReactorImpl, pReactorChannel, pReactorWorker->lastRecordedTimeMs);
 			}
-
-			if (sendPingMessage)
+			else
 			{
-				/* Check if the elapsed time is greater than our ping-send interval. */
-				if ((pReactorWorker->lastRecordedTimeMs - pReactorChannel->lastPingSentMs) > pReactorChannel->reactorChannel.pRsslChannel->pingTimeout * 1000 * pingIntervalFactor)
+				RsslBool sendPingMessage = RSSL_TRUE;
+				RsslInt64 pingIntervalMs = _reactorWorkerPingIntervalMs(pReactorChannel);
+
+				/* Checks whether to send a ping message for the JSON protocol. */
+				if (pReactorChannel->reactorChannel.pRsslChannel->protocolType == RSSL_JSON_PROTOCOL_TYPE)
 				{
+					sendPingMessage = pReactorChannel->sendWSPingMessage; 
+				}
 
+				/* Check if the elapsed time has reached our ping-send interval. Flushing also counts as a ping,
+				 * so the timer may fire before a ping is due; it is then set again for the time it is due. */
+				if (sendPingMessage && (pReactorWorker->lastRecordedTimeMs - pReactorChannel->lastPingSentMs) >= pingIntervalMs)
+				{
 					/* If so, send a ping. */
 					ret = rsslPing(pReactorChannel->reactorChannel.pRsslChannel, &pReactorChannel->channelWorkerCerr.rsslError);
 					if (ret < 0)
@@ -1594,47 +1664,37 @@ RSSL_THREAD_DECLARE(runReactorWorker, pArg)
 						rsslSetErrorInfoLocation(&pReactorChannel->channelWorkerCerr, __FILE__, __LINE__);
 						if (!RSSL_ERROR_INFO_CHECK(_reactorWorkerHandleChannelFailure(pReactorImpl, pReactorChannel, &pReactorChannel->channelWorkerCerr) == RSSL_RET_SUCCESS, RSSL_RET_FAILURE, &pReactorWorker->workerCerr))
 							return (_reactorWorkerShutdown(pReactorImpl, &pReactorWorker->workerCerr), RSSL_THREAD_RETURN());
+						continue;
 					}
-					else
+
+					if ((pReactorChannel->statisticFlags & RSSL_RC_ST_PING) && pReactorChannel->pChannelStatistic)
 					{
-						if ((pReactorChannel->statisticFlags & RSSL_RC_ST_PING) && pReactorChannel->pChannelStatistic)
-						{
-							RsslReactorChannelPingEvent *pEvent = (RsslReactorChannelPingEvent*)rsslReactorEventQueueGetFromPool(&pReactorChannel->pParentReactor->reactorEventQueue);
-							rsslClearReactorChannelPingEvent(pEvent);
+						RsslReactorChannelPingEvent *pEvent = (RsslReactorChannelPingEvent*)rsslReactorEventQueueGetFromPool(rsslReactorChannelEventQueue(pReactorChannel));
+						rsslClearReactorChannelPingEvent(pEvent);
 
-							pEvent->pReactorChannel = (RsslReactorChannel*)pReactorChannel;
+						pEvent->pReactorChannel = (RsslReactorChannel*)pReactorChannel;
 
-							if (!RSSL_ERROR_INFO_CHECK(rsslReactorEventQueuePut(&pReactorChannel->pParentReactor->reactorEventQueue, (RsslReactorEventImpl*)pEvent)
-								== RSSL_RET_SUCCESS, RSSL_RET_FAILURE, &pReactorWorker->workerCerr))
-							{
-								return (_reactorWorkerShutdown(pReactorImpl, &pReactorWorker->workerCerr), RSSL_THREAD_RETURN());
-							}
+						if (!RSSL_ERROR_INFO_CHECK(rsslReactorEventQueuePut(rsslReactorChannelEventQueue(pReactorChannel), (RsslReactorEventImpl*)pEvent)
+							== RSSL_RET_SUCCESS, RSSL_RET_FAILURE, &pReactorWorker->workerCerr))
+						{
+							return (_reactorWorkerShutdown(pReactorImpl, &pReactorWorker->workerCerr), RSSL_THREAD_RETURN());
 						}
-
-						pReactorChannel->lastPingSentMs = pReactorWorker->lastRecordedTimeMs;
-						_reactorWorkerCalculateNextTimeout(pReactorImpl, (RsslUInt32)(pReactorChannel->reactorChannel.pRsslChannel->pingTimeout * 1000 * pingIntervalFactor));
 					}
-				}
-				else
-				{
-					/* Otherwise, figure out when to wake up again. (Ping interval - (current time - time of last ping). */
-					_reactorWorkerCalculateNextTimeout(pReactorImpl, (RsslUInt32)(pReactorChannel->lastPingSentMs + (RsslInt64)(pReactorChannel->reactorChannel.pRsslChannel->pingTimeout * 1000 * pingIntervalFactor) - pReactorWorker->lastRecordedTimeMs));
-				}
-			}
 
-			/* Process any channels that are waiting for a timeout. */
-			if (pReactorChannel->nextExpireTime != RCIMPL_TIMER_UNSET)
-			{
-				if (pReactorChannel->nextExpireTime < pReactorWorker->lastRecordedTimeMs)
-				{
-					/* Timer expired for this channel, send event back. */
-					_reactorWorkerSendTimerExpired(pReactorImpl, pReactorChannel, pReactorWorker->lastRecordedTimeMs);
+					pReactorChannel->lastPingSentMs = pReactorWorker->lastRecordedTimeMs;
 				}
-				else
-					_reactorWorkerCalculateNextTimeout(pReactorImpl, (RsslUInt32)(pReactorChannel->nextExpireTime - pReactorWorker->lastRecordedTimeMs));
+
+				/* When pings are not sent, keep checking once per interval in case that changes. */
+				rsslTimerWheelAdd(&pReactorWorker->timerWheel, &pReactorChannel->pingTimer,
+						sendPingMessage ? pReactorChannel->lastPingSentMs + pingIntervalMs : pReactorWorker->lastRecordedTimeMs + pingIntervalMs);
 			}
 		}
 
+		/* Figure out when to wake up again. */
+		if ((nextTimerExpireTime = rsslTimerWheelNextExpireTime(&pReactorWorker->timerWheel)) != RSSL_TIMER_WHEEL_UNSET)
+			_reactorWorkerCalculateNextTimeout(pReactorImpl, nextTimerExpireTime > pReactorWorker->lastRecordedTimeMs ?
+					(RsslUInt32)(nextTimerExpireTime - pReactorWorker->lastRecordedTimeMs) : 0);
+
 		RSSL_QUEUE_FOR_EACH_LINK(&pReactorWorker->reconnectingChannels, pLink)
 		{
 			pReactorChannel = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorChannelImpl, workerLink, pLink);
@@ -2102,14 +2162,14 @@ RSSL_THREAD_DECLARE(runReactorWorker, pArg)
 					/* Create an event to submit the original login message when it is changed */
 					if (pReactorChannel->supportSessionMgnt && pReactorChannel->pWatchlist && submitOriginalCredential)
 					{
-						RsslReactorTokenMgntEvent *pEvent = (RsslReactorTokenMgntEvent*)rsslReactorEventQueueGetFromPool(&pReactorChannel->pParentReactor->reactorEventQueue);
+						RsslReactorTokenMgntEvent *pEvent = (RsslReactorTokenMgntEvent*)rsslReactorEventQueueGetFromPool(rsslReactorChannelEventQueue(pReactorChannel));
 
 						rsslClearReactorTokenMgntEvent(pEvent);
 						pEvent->reactorTokenMgntEventType = RSSL_RCIMPL_TKET_SUBMIT_LOGIN_MSG;
 						pEvent->pReactorChannel = &pReactorChannel->reactorChannel;
 						pEvent->pAuthTokenEventCallback = pReactorConnectInfoImpl->base.pAuthTokenEventCallback;
 
-						if (!RSSL_ERROR_INFO_CHECK(rsslReactorEventQueuePut(&pReactorChannel->pParentReactor->reactorEventQueue, (RsslReactorEventImpl*)pEvent)
+						if (!RSSL_ERROR_INFO_CHECK(rsslReactorEventQueuePut(rsslReactorChannelEventQueue(pReactorChannel), (RsslReactorEventImpl*)pEvent)
 							== RSSL_RET_SUCCESS, RSSL_RET_FAILURE, &pReactorWorker->workerCerr))
 							return (_reactorWorkerShutdown(pReactorImpl, &pReactorWorker->workerCerr), RSSL_THREAD_RETURN());
 					}
@@ -2740,7 +2800,7 @@ static void handlingAuthRequestFailure(RsslReactorTokenSessionImpl* pReactorToke
 		// Notifies users with pAuthTokenEventCallback if exists otherwise the RSSL_RC_CET_WARNING event when the channel is active
 		if (pReactorConnectInfoImpl->base.pAuthTokenEventCallback)
 		{
-			pEvent = (RsslReactorTokenMgntEvent*)rsslReactorEventQueueGetFromPool(&pReactorChannel->pParentReactor->reactorEventQueue);
+			pEvent = (RsslReactorTokenMgntEvent*)rsslReactorEventQueueGetFromPool(rsslReactorChannelEventQueue(pReactorChannel));
 			rsslClearReactorTokenMgntEvent(pEvent);
 
 			pEvent->pTokenSessionImpl = pReactorTokenSession;
@@ -2750,7 +2810,7 @@ static void handlingAuthRequestFailure(RsslReactorTokenSessionImpl* pReactorToke
 			pReactorErrorInfoImpl->referenceCount++;
 			pEvent->pReactorErrorInfoImpl = pReactorErrorInfoImpl;
 
-			if (!RSSL_ERROR_INFO_CHECK(rsslReactorEventQueuePut(&pReactorChannel->pParentReactor->reactorEventQueue, (RsslReactorEventImpl*)pEvent)
+			if (!RSSL_ERROR_INFO_CHECK(rsslReactorEventQueuePut(rsslReactorChannelEventQueue(pReactorChannel), (RsslReactorEventImpl*)pEvent)
 				== RSSL_RET_SUCCESS, RSSL_RET_FAILURE, &pReactorWorker->workerCerr))
 			{
 				_reactorWorkerShutdown(pReactorChannel->pParentReactor, &pReactorWorker->workerCerr);
@@ -2760,7 +2820,7 @@ static void handlingAuthRequestFailure(RsslReactorTokenSessionImpl* pReactorToke
 
 		if (notifyChannelWarning)
 		{
-			pEvent = (RsslReactorTokenMgntEvent*)rsslReactorEventQueueGetFromPool(&pReactorChannel->pParentReactor->reactorEventQueue);
+			pEvent = (RsslReactorTokenMgntEvent*)rsslReactorEventQueueGetFromPool(rsslReactorChannelEventQueue(pReactorChannel));
 			rsslClearReactorTokenMgntEvent(pEvent);
 
 			pEvent->pTokenSessionImpl = pReactorTokenSession;
@@ -2768,7 +2828,7 @@ static void handlingAuthRequestFailure(RsslReactorTokenSessionImpl* pReactorToke
 			pEvent->pReactorChannel = &pReactorChannel->reactorChannel;
 			pEvent->pReactorErrorInfoImpl = pReactorErrorInfoImpl;
 
-			if (!RSSL_ERROR_INFO_CHECK(rsslReactorEventQueuePut(&pReactorChannel->pParentReactor->reactorEventQueue, (RsslReactorEventImpl*)pEvent)
+			if (!RSSL_ERROR_INFO_CHECK(rsslReactorEventQueuePut(rsslReactorChannelEventQueue(pReactorChannel), (RsslReactorEventImpl*)pEvent)
 				== RSSL_RET_SUCCESS, RSSL_RET_FAILURE, &pReactorWorker->workerCerr))
 			{
 				_reactorWorkerShutdown(pReactorChannel->pParentReactor, &pReactorWorker->workerCerr);
@@ -3350,7 +3410,7 @@ static void rsslRestAuthTokenResponseCallback(RsslRestResponse* restresponse, Rs
 
 				pReactorConnectInfoImpl->lastTokenUpdatedTime = pReactorTokenSession->lastTokenUpdatedTime;
 
-				pEvent = (RsslReactorTokenMgntEvent*)rsslReactorEventQueueGetFromPool(&pReactorImpl->reactorEventQueue);
+				pEvent = (RsslReactorTokenMgntEvent*)rsslReactorEventQueueGetFromPool(rsslReactorChannelEventQueue(pReactorChannel));
 				rsslClearReactorTokenMgntEvent(pEvent);
 
 				pEvent->reactorTokenMgntEventType = pReactorTokenSession->tokenMgntEventType;
@@ -3358,7 +3418,7 @@ static void rsslRestAuthTokenResponseCallback(RsslRestResponse* restresponse, Rs
 				pEvent->pReactorChannel = &pReactorChannel->reactorChannel;
 				pEvent->pAuthTokenEventCallback = pReactorConnectInfoImpl->base.pAuthTokenEventCallback;
 
-				if (!RSSL_ERROR_INFO_CHECK(rsslReactorEventQueuePut(&pReactorImpl->reactorEventQueue, (RsslReactorEventImpl*)pEvent)
+				if (!RSSL_ERROR_INFO_CHECK(rsslReactorEventQueuePut(rsslReactorChannelEventQueue(pReactorChannel), (RsslReactorEventImpl*)pEvent)
 					== RSSL_RET_SUCCESS, RSSL_RET_FAILURE, &pReactorWorker->workerCerr))
 				{
 					_reactorWorkerShutdown(pReactorImpl, &pReactorWorker->workerCerr);
@@ -12,6 +12,7 @@
 #include "rtr/rsslRDMMsg.h"
 #include "rtr/rsslEventSignal.h"
 #include "rtr/rsslThread.h"
+#include "rtr/mpscqueue.h"
 
 #include <stdlib.h>
 
@@ -32,27 +33,35 @@ extern "C" {
 typedef struct _RsslReactorEventQueueGroup RsslReactorEventQueueGroup;
 
 /* RsslReactorEventQueue
- * Queue of RsslReactorEvents */
+ * Queue of RsslReactorEvents.
+ * Events may be put by any thread, and are taken by the one thread that dispatches the queue.
+ * Neither side takes a lock; see rtr/mpscqueue.h. */
 typedef struct
 {
-	RsslQueue eventPool;
-	RsslQueue eventQueue;
-	RsslMutex eventPoolLock;
-	RsslMutex eventQueueLock;
+	rtrMpscQueue eventQueue;
+	rtr_atomic_val eventCount;				/* Events put and not yet taken */
+	rtrLinkStack eventPool;
 	RsslReactorEventImpl *pLastEvent;
 
 	RsslReactorEventQueueGroup *pParentGroup;
 	RsslQueueLink readyEventQueueLink;
-	RsslBool isInActiveEventQueueGroup;
+	rtr_atomic_val isInActiveEventQueueGroup;	/* Set while readyEventQueueLink is in the parent's readyEventQueueGroup */
 } RsslReactorEventQueue;
 
 /* RsslReactorEventQueueGroup
  * Maintains a group of event queues that are "active" (they have an event that can be dispatched).
- * If at least one queue is in the group, the file descriptor for the group(eventSignal) will be triggered. */
+ * If at least one queue has an event, the file descriptor for the group(eventSignal) will be triggered.
+ * The descriptor is only written when the group goes from no events to having events, and is read back
+ * when it has none again. It may also trigger when there is nothing to dispatch, e.g. when a producer
+ * was delayed between deciding to write it and writing it; the consumer reads it again when it finds
+ * nothing to dispatch. */
 struct _RsslReactorEventQueueGroup
 {
-	RsslQueue readyEventQueueGroup;
-	RsslMutex lock;
+	rtrMpscQueue readyEventQueueGroup;	/* Queues that have had events since the consumer last found them empty */
+	rtr_atomic_val activeQueueCount;	/* Queues that have events */
+	rtr_atomic_val signalled;			/* Set when the descriptor is written; cleared by the consumer when the group has no events */
+	rtr_atomic_val signalsWritten;		/* Notifications written to the descriptor */
+	rtr_atomic_val signalsRead;			/* Notifications read from it. Only used by the consumer */
 	RsslEventSignal eventSignal;
 };
 
@@ -61,62 +70,96 @@ RTR_C_INLINE RsslRet rsslInitReactorEventQueueGroup(RsslReactorEventQueueGroup *
 	if (!rsslInitEventSignal(&pList->eventSignal))
 		return RSSL_RET_FAILURE;
 
-	RSSL_MUTEX_INIT(&pList->lock);
-
-	rsslInitQueue(&pList->readyEventQueueGroup);
+	rtrMpscQueueInit(&pList->readyEventQueueGroup);
+	pList->activeQueueCount = 0;
+	pList->signalled = 0;
+	pList->signalsWritten = 0;
+	pList->signalsRead = 0;
 
 	return RSSL_RET_SUCCESS;
 }
 
-/* rsslReactorEventQueueGroupShift
- * "Rotates" the queues in the group, by taking the first queue, moving it to the back, and returning it. */
-RTR_C_INLINE RsslReactorEventQueue* rsslReactorEventQueueGroupShift(RsslReactorEventQueueGroup *pQueueList)
+/* Triggers the group's descriptor, unless it was triggered since the consumer last found the group empty. */
+RTR_C_INLINE RsslRet _rsslReactorEventQueueGroupSignal(RsslReactorEventQueueGroup *pQueueList)
 {
-	RsslQueueLink *pLink;
-	RSSL_MUTEX_LOCK(&pQueueList->lock);
+	if (RTR_ATOMIC_SET_RETOLD(pQueueList->signalled, 1) != 0)
+		return RSSL_RET_SUCCESS;
 
-	pLink = rsslQueueRemoveFirstLink(&pQueueList->readyEventQueueGroup);
-	if (pLink) rsslQueueAddLinkToBack(&pQueueList->readyEventQueueGroup, pLink);
-	RSSL_MUTEX_UNLOCK(&pQueueList->lock);
-
-	return pLink ? RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorEventQueue, readyEventQueueLink, pLink) : NULL;
+	(void)rtrMpscFetchAdd(&pQueueList->signalsWritten, 1);
+	return (rsslNotifyEventSignal(&pQueueList->eventSignal) < 0) ? RSSL_RET_FAILURE : RSSL_RET_SUCCESS;
 }
 
-RTR_C_INLINE int rsslGetEventQueueGroupSignalFD(RsslReactorEventQueueGroup *pQueueList)
+/* Called by the consumer when the group has no events left. Reads the descriptor so it stops triggering. */
+RTR_C_INLINE RsslRet _rsslReactorEventQueueGroupReset(RsslReactorEventQueueGroup *pQueueList)
 {
-	return rsslGetEventSignalFD(&pQueueList->eventSignal);
-}
+	if (RTR_MPSC_VAL(pQueueList->signalsWritten) != pQueueList->signalsRead)
+	{
+		int count;
+
+		if ((count = rsslDrainEventSignal(&pQueueList->eventSignal)) < 0)
+			return RSSL_RET_FAILURE;
+
+		pQueueList->signalsRead += count;
+	}
 
+	RTR_ATOMIC_SET(pQueueList->signalled, 0);
 
-/* Removes the event queue from its parent's event queue list if appropriate.
- * Resets the event queue list's signal if appropriate. */
-/* Ownership of pQueue->eventQueueLock is assumed */
-RTR_C_INLINE RsslRet rsslReactorEventQueueSetInactive(RsslReactorEventQueue *pQueue)
+	/* A queue that got an event before the flag was cleared did not trigger the descriptor. */
+	if (RTR_MPSC_VAL(pQueueList->activeQueueCount) > 0)
+		return _rsslReactorEventQueueGroupSignal(pQueueList);
+
+	return RSSL_RET_SUCCESS;
+}
+
+/* Called by the consumer when it finds nothing to dispatch. Reads any notification that was
+ * written after the group last became empty. */
+RTR_C_INLINE RsslRet _rsslReactorEventQueueGroupCheckIdle(RsslReactorEventQueueGroup *pQueueList)
 {
-	RsslUInt32 count;
+	if (RTR_MPSC_VAL(pQueueList->activeQueueCount) <= 0
+			&& RTR_MPSC_VAL(pQueueList->signalsWritten) != pQueueList->signalsRead)
+		return _rsslReactorEventQueueGroupReset(pQueueList);
 
-	RSSL_MUTEX_LOCK(&pQueue->pParentGroup->lock);
+	return RSSL_RET_SUCCESS;
+}
 
-	if (!pQueue->isInActiveEventQueueGroup) return (RSSL_MUTEX_UNLOCK(&pQueue->pParentGroup->lock), RSSL_RET_SUCCESS);
+/* Adds the queue to its group's ready queues, if it is not already there. */
+RTR_C_INLINE void _rsslReactorEventQueueSetReady(RsslReactorEventQueue *pQueue)
+{
+	if (RTR_ATOMIC_COMPARE_AND_SWAP(pQueue->isInActiveEventQueueGroup, 0, 1) == 0)
+		rtrMpscQueuePush(&pQueue->pParentGroup->readyEventQueueGroup, &pQueue->readyEventQueueLink);
+}
 
-	/* Add to parent list of active queues */
-	rsslQueueRemoveLink(&pQueue->pParentGroup->readyEventQueueGroup, &pQueue->readyEventQueueLink);
-	pQueue->isInActiveEventQueueGroup = RSSL_FALSE;
+/* rsslReactorEventQueueGroupShift
+ * "Rotates" the queues in the group, by taking the first queue that has events, moving it to the back, and returning it.
+ * Queues found without events are dropped from the group until they get another event. */
+RTR_C_INLINE RsslReactorEventQueue* rsslReactorEventQueueGroupShift(RsslReactorEventQueueGroup *pQueueList)
+{
+	RsslQueueLink *pLink;
+	RsslReactorEventQueue *pQueue;
 
-	count = rsslQueueGetElementCount(&pQueue->pParentGroup->readyEventQueueGroup);
-	if (count == 0)
+	while ((pLink = rtrMpscQueuePop(&pQueueList->readyEventQueueGroup)))
 	{
-		/* List is now empty; need to reset queue list descriptor */
-		int ret;
-		ret = rsslResetEventSignal(&pQueue->pParentGroup->eventSignal); /* Read pointer of event */
+		pQueue = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorEventQueue, readyEventQueueLink, pLink);
 
-		if (ret < 0)
-			return (RSSL_MUTEX_UNLOCK(&pQueue->pParentGroup->lock), RSSL_RET_FAILURE);
+		if (RTR_MPSC_VAL(pQueue->eventCount) > 0)
+		{
+			rtrMpscQueuePush(&pQueueList->readyEventQueueGroup, pLink);
+			return pQueue;
+		}
+
+		/* A producer that put an event after the count was read may have seen the flag still set. */
+		RTR_ATOMIC_SET(pQueue->isInActiveEventQueueGroup, 0);
+		if (RTR_MPSC_VAL(pQueue->eventCount) > 0)
+			_rsslReactorEventQueueSetReady(pQueue);
 	}
 
-	RSSL_MUTEX_UNLOCK(&pQueue->pParentGroup->lock);
-	
-	return RSSL_RET_SUCCESS;
+	(void)_rsslReactorEventQueueGroupCheckIdle(pQueueList);
+	return NULL;
+}
+
+RTR_C_INLINE int rsslGetEventQueueGroupSignalFD(RsslReactorEventQueueGroup *pQueueList)
+{
+	return rsslGetEventSignalFD(&pQueueList->eventSignal);
 }
 
 /* rsslCleanupReactorEventQueueGroup 
@@ -126,8 +169,6 @@ RTR_C_INLINE RsslRet rsslCleanupReactorEventQueueGroup(RsslReactorEventQueueGrou
 
 	rsslCleanupEventSignal(&pList->eventSignal);
 
-	RSSL_MUTEX_DESTROY(&pList->lock);
-
 	return RSSL_RET_SUCCESS;
 }
 
@@ -142,11 +183,8 @@ RTR_C_INLINE RsslRet rsslInitReactorEventQueue(RsslReactorEventQueue *pQueue, in
 
 	memset(pQueue, 0, sizeof(RsslReactorEventQueue));
 
-	RSSL_MUTEX_INIT(&pQueue->eventPoolLock);
-	RSSL_MUTEX_INIT(&pQueue->eventQueueLock);
-
-	rsslInitQueue(&pQueue->eventPool);
-	rsslInitQueue(&pQueue->eventQueue);
+	rtrMpscQueueInit(&pQueue->eventQueue);
+	rtrLinkStackInit(&pQueue->eventPool);
 
 	pQueue->pParentGroup = pParentGroup;
 
@@ -157,7 +195,7 @@ RTR_C_INLINE RsslRet rsslInitReactorEventQueue(RsslReactorEventQueue *pQueue, in
 		{
 			rsslClearReactorEventImpl(pNewEvent);
 			rsslInitQueueLink(&pNewEvent->base.eventQueueLink);
-			rsslQueueAddLinkToBack(&pQueue->eventPool, &pNewEvent->base.eventQueueLink);
+			rtrLinkStackPush(&pQueue->eventPool, &pNewEvent->base.eventQueueLink);
 		}
 	}
 
@@ -171,13 +209,13 @@ RTR_C_INLINE RsslRet rsslCleanupReactorEventQueue(RsslReactorEventQueue *pQueue)
 	RsslQueueLink *pLink;
 	RsslReactorEventImpl *pEvent;
 
-	while ((pLink = rsslQueueRemoveFirstLink(&pQueue->eventQueue)))
+	while ((pLink = rtrMpscQueuePop(&pQueue->eventQueue)))
 	{
 		pEvent = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorEventImpl, base.eventQueueLink, pLink);
 		free(pEvent);
 	}
 
-	while ((pLink = rsslQueueRemoveFirstLink(&pQueue->eventPool)))
+	while ((pLink = rtrLinkStackTryPop(&pQueue->eventPool)))
 	{
 		pEvent = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorEventImpl, base.eventQueueLink, pLink);
 		free(pEvent);
@@ -189,9 +227,6 @@ RTR_C_INLINE RsslRet rsslCleanupReactorEventQueue(RsslReactorEventQueue *pQueue)
 		pQueue->pLastEvent = 0;
 	}
 
-	RSSL_MUTEX_DESTROY(&pQueue->eventPoolLock);
-	RSSL_MUTEX_DESTROY(&pQueue->eventQueueLock);
-
 	return RSSL_RET_SUCCESS;
 }
 
@@ -200,8 +235,8 @@ RTR_C_INLINE RsslReactorEventImpl *rsslReactorEventQueueGetFromPool(RsslReactorE
 	RsslReactorEventImpl *pEvent;
 	RsslQueueLink *pLink;
 
-	RSSL_MUTEX_LOCK(&pQueue->eventPoolLock);
-	if ( (pLink = rsslQueueRemoveFirstLink(&pQueue->eventPool)))
+	/* If another thread is taking an event from the pool, allocate one rather than wait. */
+	if ( (pLink = rtrLinkStackTryPop(&pQueue->eventPool)))
 		pEvent = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorEventImpl, base.eventQueueLink, pLink);
 	else
 	{
@@ -212,7 +247,6 @@ RTR_C_INLINE RsslReactorEventImpl *rsslReactorEventQueueGetFromPool(RsslReactorE
 			rsslInitQueueLink(&pEvent->base.eventQueueLink);
 		}
 	}
-	RSSL_MUTEX_UNLOCK(&pQueue->eventPoolLock);
 
 	return pEvent;
 }
@@ -221,64 +255,34 @@ RTR_C_INLINE RsslReactorEventImpl *rsslReactorEventQueueGetFromPool(RsslReactorE
 /* This should not be run if the event has alredy been placed into an event queue. */
 RTR_C_INLINE void rsslReactorEventQueueReturnToPool(RsslReactorEventImpl *pEvent, RsslReactorEventQueue *pQueue, RsslInt32 poolSize)
 {
-	RSSL_MUTEX_LOCK(&pQueue->eventPoolLock);
-
-	if (poolSize == -1 || (RsslInt32)pQueue->eventPool.count < poolSize)
+	if (poolSize == -1 || (RsslInt32)RTR_MPSC_VAL(pQueue->eventPool.count) < poolSize)
 	{
-		rsslQueueAddLinkToBack(&pQueue->eventPool, &pEvent->base.eventQueueLink);
+		rtrLinkStackPush(&pQueue->eventPool, &pEvent->base.eventQueueLink);
 	}
 	else 
 	{
 		free(pEvent);
 	}
-
-	RSSL_MUTEX_UNLOCK(&pQueue->eventPoolLock);
 }
 
 RTR_C_INLINE RsslRet rsslReactorEventQueuePut(RsslReactorEventQueue *pQueue, RsslReactorEventImpl *pEvent)
 {
-	RsslUInt32 count;
-
-	RSSL_MUTEX_LOCK(&pQueue->eventQueueLock);
+	RsslReactorEventQueueGroup *pParentGroup = pQueue->pParentGroup;
 
-	rsslQueueAddLinkToBack(&pQueue->eventQueue, &pEvent->base.eventQueueLink);
+	rtrMpscQueuePush(&pQueue->eventQueue, &pEvent->base.eventQueueLink);
 
-	count = rsslQueueGetElementCount(&pQueue->eventQueue);
-	if (count == 1)
+	if (rtrMpscFetchAdd(&pQueue->eventCount, 1) == 0)
 	{
-		/* May need to trigger parent EventQueueGroup */
-		RsslUInt32 count;
-
-		RSSL_MUTEX_LOCK(&pQueue->pParentGroup->lock);
-
-		if (pQueue->isInActiveEventQueueGroup) return (RSSL_MUTEX_UNLOCK(&pQueue->pParentGroup->lock), RSSL_MUTEX_UNLOCK(&pQueue->eventQueueLock), RSSL_RET_SUCCESS);
+		/* Queue was previously empty; add it to parent list of active queues */
+		_rsslReactorEventQueueSetReady(pQueue);
 
-		/* Add to parent list of active queues */
-		rsslQueueAddLinkToBack(&pQueue->pParentGroup->readyEventQueueGroup, &pQueue->readyEventQueueLink);
-		pQueue->isInActiveEventQueueGroup = RSSL_TRUE;
-
-		count = rsslQueueGetElementCount(&pQueue->pParentGroup->readyEventQueueGroup);
-		if (count == 1)
+		if (rtrMpscFetchAdd(&pParentGroup->activeQueueCount, 1) == 0)
 		{
-			/* List was previously empty; Need to trigger queue list descriptor */
-			int ret;
-
-			ret = rsslSetEventSignal(&pQueue->pParentGroup->eventSignal); /* Read pointer of event */
-
-			if (ret < 0)
-			{
-				RSSL_MUTEX_UNLOCK(&pQueue->pParentGroup->lock);
-				RSSL_MUTEX_UNLOCK(&pQueue->eventQueueLock);
-				return RSSL_RET_FAILURE;
-			}
-
+			/* Group was previously empty; Need to trigger queue list descriptor */
+			return _rsslReactorEventQueueGroupSignal(pParentGroup);
 		}
-
-		RSSL_MUTEX_UNLOCK(&pQueue->pParentGroup->lock);
 	}
 
-	RSSL_MUTEX_UNLOCK(&pQueue->eventQueueLock);
-
 	return RSSL_RET_SUCCESS;
 }
 
@@ -297,56 +301,33 @@ RTR_C_INLINE RsslReactorEventImpl* rsslReactorEventQueueGet(RsslReactorEventQueu
 		pQueue->pLastEvent = 0;
 	}
 
-	RSSL_MUTEX_LOCK(&pQueue->eventQueueLock);
-
-	count = rsslQueueGetElementCount(&pQueue->eventQueue);
-
-	if(count)
+	if (!(pLink = rtrMpscQueuePop(&pQueue->eventQueue)))
 	{
-		pLink = rsslQueueRemoveFirstLink(&pQueue->eventQueue);
-		pEvent = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorEventImpl, base.eventQueueLink, pLink);
-		if (count == 1)
+		/* Empty, or the next event is still being put. */
+		if (_rsslReactorEventQueueGroupCheckIdle(pQueue->pParentGroup) != RSSL_RET_SUCCESS)
 		{
-			/* May need to reset parent EventQueueGroup. */
-
-			RSSL_MUTEX_LOCK(&pQueue->pParentGroup->lock);
-
-			if (pQueue->isInActiveEventQueueGroup) 
-			{
-				RsslUInt32 parentQueueCount;
-
-				/* Remove from parent list of active queues */
-				rsslQueueRemoveLink(&pQueue->pParentGroup->readyEventQueueGroup, &pQueue->readyEventQueueLink);
-				pQueue->isInActiveEventQueueGroup = RSSL_FALSE;
-
-				parentQueueCount = rsslQueueGetElementCount(&pQueue->pParentGroup->readyEventQueueGroup);
-				if (parentQueueCount == 0)
-				{
-					/* List is now empty; need to reset queue list descriptor */
-					int ret;
-					ret = rsslResetEventSignal(&pQueue->pParentGroup->eventSignal); /* Read pointer of event */
-
-					if (ret < 0)
-					{
-						RSSL_MUTEX_UNLOCK(&pQueue->pParentGroup->lock);
-						RSSL_MUTEX_UNLOCK(&pQueue->eventQueueLock);
-						*pRet = RSSL_RET_FAILURE;
-						return NULL;
-					}
-				}
-			}
-
-			RSSL_MUTEX_UNLOCK(&pQueue->pParentGroup->lock);
+			*pRet = RSSL_RET_FAILURE;
+			return NULL;
 		}
-		--count;
+
+		*pRet = 0;
+		return NULL;
 	}
-	else
-		pEvent = NULL;
 
-	RSSL_MUTEX_UNLOCK(&pQueue->eventQueueLock);
+	pEvent = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorEventImpl, base.eventQueueLink, pLink);
+	pQueue->pLastEvent = pEvent;
 
+	count = (RsslRet)rtrMpscFetchAdd(&pQueue->eventCount, -1) - 1;
+	if (count == 0 && rtrMpscFetchAdd(&pQueue->pParentGroup->activeQueueCount, -1) == 1)
+	{
+		/* Group is now empty; need to reset queue list descriptor */
+		if (_rsslReactorEventQueueGroupReset(pQueue->pParentGroup) != RSSL_RET_SUCCESS)
+		{
+			*pRet = RSSL_RET_FAILURE;
+			return NULL;
+		}
+	}
 
-	pQueue->pLastEvent = pEvent;
 	*pRet = count;
 	return pEvent;
 }
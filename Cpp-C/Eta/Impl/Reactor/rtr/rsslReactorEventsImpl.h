@@ -46,6 +46,7 @@ typedef enum
 	RSSL_RCIMPL_CET_DISPATCH_WL = -4,
 	RSSL_RCIMPL_CET_DISPATCH_TUNNEL_STREAM = -5,
 	RSSL_RCIMPL_CET_CLOSE_WARMSTANDBY_CHANNEL = -6,
+	RSSL_RCIMPL_CET_FD_CHANGE = -7,
 } RsslReactorChannelEventImplType;
 
 typedef enum
@@ -26,6 +26,7 @@
 #include "rtr/rsslReactorTokenMgntImpl.h"
 #include "rtr/rsslJsonConverter.h"
 #include "rtr/rsslHashTable.h"
+#include "rtr/rsslTimerWheel.h"
 #include "rtr/wlItem.h"
 
 #ifdef WIN32
@@ -45,6 +46,8 @@ extern "C" {
 
 typedef struct _RsslReactorImpl RsslReactorImpl;
 
+typedef struct _RsslReactorShardImpl RsslReactorShardImpl;
+
 typedef struct _RsslReactorWarmStandByHandlerImpl RsslReactorWarmStandByHandlerImpl;
 
 typedef enum
@@ -370,6 +373,7 @@ typedef struct
 	RsslReactorChannel reactorChannel;
 
 	RsslReactorImpl *pParentReactor;
+	RsslReactorShardImpl *pShard;	/* Dispatch shard of the channel */
 	RsslUInt32 initializationTimeout;
 	RsslInt64 initializationStartTimeMs;
 
@@ -378,10 +382,13 @@ typedef struct
 	RsslQueue *reactorParentQueue;
 	RsslReactorEventQueue eventQueue;
 	RsslInt64 lastPingReadMs;
+	RsslTimerWheelTimer pingTimeoutTimer;	/* Fires when the channel may have passed its ping timeout; set while the channel is active. */
+	RsslQueueLink readyLink;		/* Link in the reactor's readyChannels list. */
 	RsslNotifierEvent *pNotifierEvent;
 	RsslRet readRet;				/* Last return code from rsslRead on this channel. Helps determine whether data can still be read from this channel. */
 	RsslRet writeRet;				/* Last return from rsslWrite() for this channel. Helps determine whether we should request a flush. */
 	RsslBool requestedFlush;		/* Indicates whether flushing is signaled for this channel */
+	RsslBool directFlush;			/* Indicates whether this channel is flushed by the calling thread before signaling the worker */
 	RsslWatchlist *pWatchlist;
 	RsslBool	wlDispatchEventQueued;
 	RsslBool	tunnelDispatchEventQueued;
@@ -405,6 +412,8 @@ typedef struct
 	RsslErrorInfo channelWorkerCerr;
 	RsslInt64 lastRequestedExpireTime;
 	RsslInt64 nextExpireTime;
+	RsslTimerWheelTimer pingTimer;		/* Fires when the channel may need to send a ping; set while the channel is active. */
+	RsslTimerWheelTimer expireTimer;	/* Fires at nextExpireTime; set while the channel is active. */
 	RsslNotifierEvent *pWorkerNotifierEvent;
 
 	/* Reconnection logic */
@@ -469,6 +478,9 @@ RTR_C_INLINE void rsslClearReactorChannelImpl(RsslReactorImpl *pReactorImpl, Rss
 	pInfo->pParentReactor = pReactorImpl;
 	pInfo->nextExpireTime = RCIMPL_TIMER_UNSET;
 	pInfo->lastRequestedExpireTime = RCIMPL_TIMER_UNSET;
+	rsslTimerWheelTimerInit(&pInfo->pingTimer, pInfo);
+	rsslTimerWheelTimerInit(&pInfo->expireTimer, pInfo);
+	rsslTimerWheelTimerInit(&pInfo->pingTimeoutTimer, pInfo);
 }
 
 typedef enum
@@ -1552,6 +1564,7 @@ RTR_C_INLINE void rsslResetReactorChannel(RsslReactorImpl *pReactorImpl, RsslRea
 	pReactorChannel->connectionListIter = 0;
 	pReactorChannel->connectionOptList = NULL;
 	pReactorChannel->connectionDebugFlags = 0;
+	pReactorChannel->directFlush = RSSL_FALSE;
 	pReactorChannel->reactorChannel.socketId = (RsslSocket)REACTOR_INVALID_SOCKET;
 	pReactorChannel->reactorChannel.oldSocketId = (RsslSocket)REACTOR_INVALID_SOCKET;
 
@@ -1597,12 +1610,19 @@ RTR_C_INLINE RsslBool rsslReactorChannelIsValid(RsslReactorImpl *pReactorImpl, R
 	return ret;
 }
 
-/* Checks that we are not in a callback already (or that's it's okay), and locks the reactor */
+/* Checks that we are not in a callback already (or that's it's okay), and locks the reactor-wide state, which is held by shard 0 */
 RsslRet reactorLockInterface(RsslReactorImpl *pReactorImpl, RsslBool allowedInCallback, RsslErrorInfo *pError);
 
 /* Unlocks reactor */
 RsslRet reactorUnlockInterface(RsslReactorImpl *pReactorImpl);
 
+/* Checks that we are not in a callback already (or that's it's okay), and locks a shard. A thread may lock shard 0
+ * while it holds another shard, but not the other way round, and never two shards other than shard 0. */
+RsslRet reactorLockShard(RsslReactorShardImpl *pShard, RsslBool allowedInCallback, RsslErrorInfo *pError);
+
+/* Unlocks a shard */
+RsslRet reactorUnlockShard(RsslReactorShardImpl *pShard);
+
 #define MAX_THREADNAME_STRLEN 16
 
 typedef enum
@@ -1632,6 +1652,7 @@ typedef struct
 	RsslNotifierEvent *pQueueNotifierEvent;	/* Notification for workerQueue */
 
 	RsslInt64 lastRecordedTimeMs;
+	RsslTimerWheel timerWheel;	/* Ping and timer-event timers of active channels, in milliseconds */
 
 	RsslThreadId thread;
 	RsslReactorEventQueue workerQueue;
@@ -1660,46 +1681,76 @@ typedef enum
 	RSSL_REACTOR_ST_SHUT_DOWN = 3 /* Reactor has shutdown */
 } RsslReactorState;
 
-/* RsslReactorImpl
- * The Reactor handles reading messages and commands from the application.
- * Primary responsibilities include:
- *   - Reading messages from transport
- *   - Calling back the application via callback functions, decoding messages to the RDM structs when appropriate.
- *   - Adding and removing channels in response to network events or requests from user.
- *   - Signaling the worker thread to flush when appropriate
- */
-struct _RsslReactorImpl
+/* RsslReactorShardImpl
+ * A dispatch shard of the reactor. Each shard has its own channels, notifier and event queues, and its own lock,
+ * so separate threads can dispatch the shards at the same time. The worker thread, token sessions and other
+ * reactor-wide state belong to the reactor; shard 0 holds the lock for them and dispatches the events that are
+ * not about a channel. */
+struct _RsslReactorShardImpl
 {
-	RsslReactor reactor;								/* Public-facing base reactor object */
+	RsslReactor reactor;				/* Public-facing handle of the shard. Shard 0 uses the reactor's own handle. */
+	RsslReactorImpl *pReactorImpl;		/* Reactor that owns the shard. Shares its position with RsslReactorImpl.pReactorImpl. */
+	RsslUInt32 shardIndex;
 
-	RsslReactorChannelImpl *channelPoolArray;
-	RsslQueue channelPool;				/* Pool of available channel structures */
+	RsslQueue channelPool;				/* Pool of available channel structures. A channel's event queue stays in its shard's group. */
 	RsslQueue initializingChannels;	/* Channels waiting for worker to initialize */
 	RsslQueue activeChannels;			/* Channels that are active */
+	RsslQueue readyChannels;			/* Active channels that were notified or may still have data to read */
 	RsslQueue inactiveChannels;			/* Channels that have failed in some way */
 	RsslQueue closingChannels;			/* Waiting for close from worker */
 	RsslQueue reconnectingChannels;		/* Channels that have been closed, but are currently reconnecting */
+	RsslQueue warmstandbyChannelPool;	/* Pool of available RsslReactorWarmStandByHandlerImpl structures */
+	RsslQueue closingWarmstandbyChannel;    /* Keeps a list RsslReactorWarmStandByHandlerImpl being closed. */
 
-	RsslThreadId thread;
-
-	RsslReactorEventQueue reactorEventQueue;
+	RsslReactorEventQueue eventQueue;	/* Events about the shard's channels, for shards other than shard 0 */
+	RsslReactorEventQueue *pEventQueue;	/* Queue of events about the shard's channels; shard 0 uses the reactor's queue */
 
-	RsslNotifier *pNotifier; /* Notifier for reactorEventQueue and channels */
-	RsslNotifierEvent *pQueueNotifierEvent; /* Notification for reactorEventQueue */
+	RsslNotifier *pNotifier; /* Notifier for the event queues and channels */
+	RsslNotifierEvent *pQueueNotifierEvent; /* Notification for activeEventQueueGroup */
+	RsslReactorEventQueueGroup activeEventQueueGroup;
 
 	RsslBuffer memoryBuffer;
 
 	RsslInt64 lastRecordedTimeMs;
+	RsslTimerWheel pingTimeoutWheel;	/* Ping timeout timers of active channels, in milliseconds */
 
-	RsslInt32 channelCount;			/* Total number of channels in use. */
+	RsslInt32 channelCount;			/* Number of channels in use. */
 
-	RsslInt32 maxEventsInPool; /* To control size of memory */
+	RsslJsonConverter	*pJsonConverter;	/* Set for each shard by rsslReactorInitJsonConverter() */
+	RsslErrorInfo		*pJsonErrorInfo; /* Place holder for JSON error messages */
 
 	/* Used on each interface in the reactor to ensure thread-safety and that calling interfaces in callbacks is prevented. */
 	RsslMutex interfaceLock; /* Ensures function calls are thread-safe */
 	RsslBool inReactorFunction; /* Ensures functions are not called inside callbacks */
+	void *pLockThread;			/* Identifies the thread holding interfaceLock, where thread local storage is available */
+	RsslUInt32 lockCount;		/* Number of times pLockThread has locked interfaceLock */
+};
 
-	RsslReactorEventQueueGroup activeEventQueueGroup;
+/* RsslReactorImpl
+ * The Reactor handles reading messages and commands from the application.
+ * Primary responsibilities include:
+ *   - Reading messages from transport
+ *   - Calling back the application via callback functions, decoding messages to the RDM structs when appropriate.
+ *   - Adding and removing channels in response to network events or requests from user.
+ *   - Signaling the worker thread to flush when appropriate
+ */
+struct _RsslReactorImpl
+{
+	RsslReactor reactor;								/* Public-facing base reactor object */
+	RsslReactorImpl *pReactorImpl;						/* The reactor itself, so that its handle and its shards' handles lead to it alike */
+
+	RsslReactorChannelImpl *channelPoolArray;
+
+	RsslThreadId thread;
+
+	RsslReactorEventQueue reactorEventQueue;	/* Dispatched by shard 0 */
+
+	RsslInt32 maxEventsInPool; /* To control size of memory */
+
+	RsslReactorShardImpl *pShards;			/* Dispatch shards, from shard 0 */
+	RsslUInt32 shardCount;
+	RsslReactorShardPolicy shardPolicy;
+	rtr_atomic_val nextShard;				/* Next shard for the round-robin policy */
 
 	RsslReactorWorker reactorWorker;						/* The reactor's worker */
 	RsslInt32 dispatchDecodeMemoryBufferSize;					/* The size to allocate for the temporary decoding block. This is used for decoding to the RDM structures. */
@@ -1733,27 +1784,37 @@ struct _RsslReactorImpl
 
 	
 	RsslBool			jsonConverterInitialized; 	/* This is used to indicate whether the RsslJsonConverter is initialized */
-	RsslJsonConverter	*pJsonConverter; 
 	RsslDataDictionary	**pDictionaryList; /* Creates a list of pointer to pointer with the size of 1. */
 	RsslReactorServiceNameToIdCallback	*pServiceNameToIdCallback; /* Sets a callback specified by users */
 	RsslReactorJsonConversionEventCallback	*pJsonConversionEventCallback; /* Sets a callback specified by users to receive JSON error message. */
 	void				*userSpecPtr; /* Users's closure for callback functions */
-	RsslErrorInfo		*pJsonErrorInfo; /* Place holder for JSON error messages */
 	RsslBool			closeChannelFromFailure; /* This is used to indicate whether to close the channel from dispatching */
 	RsslBool			restEnableLog;	/* Enable REST interaction debug messages */
 	FILE				*restLogOutputStream;	/* Set output stream for REST debug message (by default is stdout) */
 	RsslBool			restEnableLogCallback;	/* Enable of invoking a callback specified by user to receive Rest logging message (pRestLoggingCallback). */
 	RsslReactorRestLoggingCallback	*pRestLoggingCallback;	/* Sets a callback specified by users to receive Rest logging message. */
-	RsslQueue warmstandbyChannelPool;	/* Pool of available RsslReactorWarmStandByHandlerImpl structures */
-	RsslQueue closingWarmstandbyChannel;    /* Keeps a list RsslReactorWarmStandByHandlerImpl being closed. */
+	RsslBool			directFlush;	/* Enables direct flushing for all channels of this reactor */
 };
 
 RTR_C_INLINE void rsslClearReactorImpl(RsslReactorImpl *pReactorImpl)
 {
 	memset(pReactorImpl, 0, sizeof(RsslReactorImpl));
+	pReactorImpl->pReactorImpl = pReactorImpl;
 	pReactorImpl->closeChannelFromFailure = RSSL_TRUE;
 }
 
+/* Returns the reactor of an RsslReactor handle, which may be the handle of one of its shards. */
+RTR_C_INLINE RsslReactorImpl *rsslReactorGetImpl(RsslReactor *pReactor)
+{
+	return ((RsslReactorImpl*)pReactor)->pReactorImpl;
+}
+
+/* Returns the queue for events about a channel, which is dispatched by the channel's shard. */
+RTR_C_INLINE RsslReactorEventQueue *rsslReactorChannelEventQueue(RsslReactorChannelImpl *pReactorChannel)
+{
+	return pReactorChannel->pShard->pEventQueue;
+}
+
 void _assignConnectionArgsToRequestArgs(RsslConnectOptions *pConnOptions, RsslRestRequestArgs* pRestRequestArgs);
 
 /* Populates the request for v1 token handling */
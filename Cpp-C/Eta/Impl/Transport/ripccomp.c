@@ -8,6 +8,7 @@
 
 
 #include <stdio.h>
+#include <string.h>
 #include "rtr/rsslAlloc.h"
 #include "rtr/rsslErrors.h"
 #include "rtr/rsslSocketTransportImpl.h"
@@ -17,6 +18,7 @@
 
 #include "zlib.h"
 #include "lz4.h"
+#include "zstd.h"
 
 //
 // zlib routines start here
@@ -195,6 +197,7 @@ RsslInt32 ripcInitZlibComp()
 	funcs.decompressEnd = zlibDecompEnd;
 	funcs.compress = zlibcompress;
 	funcs.decompress = zlibdecompress;
+	funcs.compressBound = 0;
 
 	return(ipcSetCompFunc(RSSL_COMP_ZLIB,&funcs));
 }
@@ -286,8 +289,244 @@ int ripcInitLz4Comp()
 	funcs.decompressEnd = lz4DecompEnd;
 	funcs.compress = lz4Comp;
 	funcs.decompress = lz4Decomp;
+	funcs.compressBound = LZ4_compressBound;
 
 	return(ipcSetCompFunc(RSSL_COMP_LZ4,&funcs));
 }
 
+//
+//	Zstandard compression routines start here
+//
+// Like LZ4, each message is compressed on its own. A pre-shared dictionary
+// gives small updates the history that a single message lacks.
+//
+typedef struct {
+	ZSTD_CCtx	*cctx;
+	ZSTD_CDict	*cdict;		/* Digested dictionary for this channel's compression level, if a dictionary is loaded */
+	int			level;
+} zstdCompStream;
+
+static char			*zstdDictionary = 0;		/* Copy of the dictionary given to rsslInitializeEx() */
+static size_t		zstdDictionaryLength = 0;
+static ZSTD_DDict	*zstdDDict = 0;				/* Shared by all channels; ZSTD_DDict is read-only once created */
+static unsigned		zstdDictID = 0;
+
+static void *zstdCompInit(RsslInt32 compressionLevel, int notUsed, RsslError *error)
+{
+	zstdCompStream *zs;
+
+	if (compressionLevel < 0 || compressionLevel > ZSTD_maxCLevel())
+	{
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT,
+			"<%s:%d> Error: 1004 Invalid zstd compression level %d.  Level must be between 0 and %d.\n",
+			__FILE__, __LINE__, compressionLevel, ZSTD_maxCLevel());
+		return 0;
+	}
+
+	if ((zs = (zstdCompStream*)_rsslMalloc(sizeof(zstdCompStream))) == 0)
+		return 0;
+
+	zs->level = (compressionLevel == 0) ? ZSTD_CLEVEL_DEFAULT : compressionLevel;
+	zs->cdict = 0;
+
+	if ((zs->cctx = ZSTD_createCCtx()) == 0)
+	{
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> Error: 1002 ZSTD_createCCtx() failed.\n", __FILE__, __LINE__);
+		_rsslFree(zs);
+		return 0;
+	}
+
+	if (zstdDictionary)
+	{
+		/* A digested dictionary is specific to one compression level, so each channel builds its own. */
+		if ((zs->cdict = ZSTD_createCDict(zstdDictionary, zstdDictionaryLength, zs->level)) == 0)
+		{
+			_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+			snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> Error: 1002 ZSTD_createCDict() failed.\n", __FILE__, __LINE__);
+			ZSTD_freeCCtx(zs->cctx);
+			_rsslFree(zs);
+			return 0;
+		}
+	}
+
+	_DEBUG_TRACE_COMPRESSION("zstd using compression level=%d dictionary=%u\n", zs->level, zstdDictID)
+
+	return zs;
+}
+
+static void *zstdDecompInit(int notUsed, RsslError *error)
+{
+	ZSTD_DCtx *dctx;
+
+	if ((dctx = ZSTD_createDCtx()) == 0)
+	{
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> Error: 1002 ZSTD_createDCtx() failed.\n", __FILE__, __LINE__);
+	}
+	return dctx;
+}
+
+static void zstdCompEnd(void *zstream)
+{
+	zstdCompStream *zs = (zstdCompStream*)zstream;
+	if (zs)
+	{
+		ZSTD_freeCDict(zs->cdict);
+		ZSTD_freeCCtx(zs->cctx);
+		_rsslFree(zs);
+	}
+}
+
+static void zstdDecompEnd(void *zstream)
+{
+	ZSTD_freeDCtx((ZSTD_DCtx*)zstream);
+}
+
+static RsslRet zstdComp(void* stream, ripcCompBuffer *buf, int notUsed, RsslError *error)
+{
+	zstdCompStream *zs = (zstdCompStream*)stream;
+	size_t ret;
+
+	if (zs->cdict)
+		ret = ZSTD_compress_usingCDict(zs->cctx, buf->next_out, buf->avail_out, buf->next_in, buf->avail_in, zs->cdict);
+	else
+		ret = ZSTD_compressCCtx(zs->cctx, buf->next_out, buf->avail_out, buf->next_in, buf->avail_in, zs->level);
+
+	if (ZSTD_isError(ret))
+	{
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> Error: 1002 ZSTD_compress failed. zstd error: %s\n", __FILE__, __LINE__, ZSTD_getErrorName(ret));
+		return -1;
+	}
+
+	_DEBUG_TRACE_COMPRESSION("zstd Compressed %u inbytes to %d outbytes\n", buf->avail_in, (int)ret)
+
+	buf->bytes_in_used = buf->avail_in;
+	buf->bytes_out_used = (int)ret;
+
+	buf->next_in = buf->next_in + buf->bytes_in_used;
+	buf->avail_in = buf->avail_in - buf->bytes_in_used;
+	buf->next_out = buf->next_out + buf->bytes_out_used;
+	buf->avail_out = buf->avail_out - buf->bytes_out_used;
+
+	return 1;
+}
+
+static RsslRet zstdDecomp(void* stream, ripcCompBuffer *buf, int notUsed, RsslError *error)
+{
+	ZSTD_DCtx *dctx = (ZSTD_DCtx*)stream;
+	unsigned frameDictID = ZSTD_getDictID_fromFrame(buf->next_in, buf->avail_in);
+	size_t ret;
+
+	if (frameDictID == 0)
+		ret = ZSTD_decompressDCtx(dctx, buf->next_out, buf->avail_out, buf->next_in, buf->avail_in);
+	else if (frameDictID == zstdDictID)
+		ret = ZSTD_decompress_usingDDict(dctx, buf->next_out, buf->avail_out, buf->next_in, buf->avail_in, zstdDDict);
+	else
+	{
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+		if (zstdDDict)
+			snprintf(error->text, MAX_RSSL_ERROR_TEXT,
+				"<%s:%d> Error: 1002 ZSTD_decompress failed. Message was compressed with dictionary %u, but dictionary %u is loaded.\n",
+				__FILE__, __LINE__, frameDictID, zstdDictID);
+		else
+			snprintf(error->text, MAX_RSSL_ERROR_TEXT,
+				"<%s:%d> Error: 1002 ZSTD_decompress failed. Message was compressed with dictionary %u, but no dictionary is loaded.\n",
+				__FILE__, __LINE__, frameDictID);
+		return -1;
+	}
+
+	if (ZSTD_isError(ret))
+	{
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> Error: 1002 ZSTD_decompress failed. zstd error: %s\n", __FILE__, __LINE__, ZSTD_getErrorName(ret));
+		return -1;
+	}
+	_DEBUG_TRACE_COMPRESSION("zstd Decompressed %u inbytes to %d outbytes\n", buf->avail_in, (int)ret)
+
+	buf->bytes_in_used = buf->avail_in;
+	buf->bytes_out_used = (int)ret;
+
+	buf->avail_in = 0;
+	buf->next_in = buf->next_in + buf->bytes_in_used;
+	buf->next_out = buf->next_out + buf->bytes_out_used;
+	buf->avail_out = buf->avail_out - buf->bytes_out_used;
+
+	return 1;
+}
+
+static int zstdCompressBound(int length)
+{
+	return (int)ZSTD_compressBound((size_t)length);
+}
+
+void ripcCleanupZstdComp()
+{
+	ZSTD_freeDDict(zstdDDict);
+	zstdDDict = 0;
+	zstdDictID = 0;
+	if (zstdDictionary)
+	{
+		_rsslFree(zstdDictionary);
+		zstdDictionary = 0;
+		zstdDictionaryLength = 0;
+	}
+}
+
+RsslRet ripcInitZstdComp(RsslBuffer *dictionary, RsslError *error)
+{
+	ripcCompFuncs funcs;
+
+	ripcCleanupZstdComp();
+
+	if (dictionary->length > 0 && dictionary->data)
+	{
+		if ((zstdDictionary = (char*)_rsslMalloc(dictionary->length)) == 0)
+		{
+			_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+			snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> Error: 1001 Could not allocate memory for the compression dictionary.\n", __FILE__, __LINE__);
+			return RSSL_RET_FAILURE;
+		}
+		memcpy(zstdDictionary, dictionary->data, dictionary->length);
+		zstdDictionaryLength = dictionary->length;
+
+		if ((zstdDDict = ZSTD_createDDict(zstdDictionary, zstdDictionaryLength)) == 0)
+		{
+			_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+			snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> Error: 1002 ZSTD_createDDict() failed.\n", __FILE__, __LINE__);
+			ripcCleanupZstdComp();
+			return RSSL_RET_FAILURE;
+		}
+
+		/* Raw content dictionaries have no ID, so frames compressed with them cannot be told apart from frames without one. */
+		if ((zstdDictID = ZSTD_getDictID_fromDDict(zstdDDict)) == 0)
+		{
+			_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+			snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> Error: 1004 The compression dictionary is not a trained zstd dictionary.\n", __FILE__, __LINE__);
+			ripcCleanupZstdComp();
+			return RSSL_RET_FAILURE;
+		}
+	}
+
+	funcs.compressInit = zstdCompInit;
+	funcs.decompressInit = zstdDecompInit;
+	funcs.compressEnd = zstdCompEnd;
+	funcs.decompressEnd = zstdDecompEnd;
+	funcs.compress = zstdComp;
+	funcs.decompress = zstdDecomp;
+	funcs.compressBound = zstdCompressBound;
+
+	if (ipcSetCompFunc(RSSL_COMP_ZSTD,&funcs) < 0)
+	{
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> Error: 1001 Could not register the Zstandard compression functions.\n", __FILE__, __LINE__);
+		ripcCleanupZstdComp();
+		return RSSL_RET_FAILURE;
+	}
+
+	return RSSL_RET_SUCCESS;
+}
+
 #endif
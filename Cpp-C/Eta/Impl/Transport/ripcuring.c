@@ -0,0 +1,630 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2022 Refinitiv. All rights reserved.              --
+ *|-----------------------------------------------------------------------------
+ */
+
+#include "rtr/ripcplat.h"
+#include "rtr/ripcuring.h"
+
+#ifdef RIPC_HAS_IO_URING
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <linux/io_uring.h>
+
+/* The operations and the probe are enumerations, so the headers are checked through IORING_FEAT_FAST_POLL,
+ * which was added after them (Linux 5.7). Support of the running kernel is checked by ipcUringAvailable(). */
+#if defined(__NR_io_uring_setup) && defined(IORING_FEAT_FAST_POLL)
+
+/* Number of submission queue entries. Each thread has at most one operation in flight. */
+#define RIPC_URING_ENTRIES 8
+
+/* Time in milliseconds the SQPOLL kernel thread keeps polling after the last submission. */
+#define RIPC_URING_SQ_THREAD_IDLE 100
+
+/* Number of times to check the completion queue before waiting in the kernel. */
+#define RIPC_URING_SPIN_COUNT 2000
+
+typedef struct ripcUring {
+	int						ringFd;
+	unsigned				*sqHead;
+	unsigned				*sqTail;
+	unsigned				*sqMask;
+	unsigned				*sqFlags;
+	unsigned				*sqArray;
+	unsigned				*cqHead;
+	unsigned				*cqTail;
+	unsigned				*cqMask;
+	struct io_uring_sqe		*sqes;
+	struct io_uring_cqe		*cqes;
+	void					*sqRing;
+	size_t					sqRingSize;
+	void					*cqRing;
+	size_t					cqRingSize;
+	size_t					sqesSize;
+	unsigned				setupFlags;
+	struct ripcUring		*pNext;			/* Next ring in uringList */
+} ripcUring;
+
+/* The rings of one thread. A ring is created on first use; if that fails, the thread falls back to the socket functions.
+ * The rings are freed when the thread exits, or when the last io_uring channel closes. In the latter case the thread
+ * notices that the generation changed and creates new rings when it is next used. */
+typedef struct {
+	ripcUring	*rings[RIPC_URING_MAX_MODES];
+	int			failed[RIPC_URING_MAX_MODES];
+	unsigned	generation;
+} ripcUringThreadRings;
+
+static pthread_once_t uringKeyOnce = PTHREAD_ONCE_INIT;
+static pthread_key_t uringKey;
+static int uringAvailable = -1;
+
+/* Protects the ring list, the generation and the channel count. */
+static pthread_mutex_t uringLock = PTHREAD_MUTEX_INITIALIZER;
+static ripcUring *uringList = NULL;
+static unsigned uringGeneration = 0;
+static int uringChannelCount = 0;
+
+/* Error injected into io_uring_enter() calls of this thread (see ipcUringSetEnterError()). */
+static __thread int uringEnterError = 0;
+
+static int ipcUringSetup(unsigned entries, struct io_uring_params *params)
+{
+	return (int)syscall(__NR_io_uring_setup, entries, params);
+}
+
+static int ipcUringEnter(int ringFd, unsigned toSubmit, unsigned minComplete, unsigned flags)
+{
+	if (uringEnterError != 0)
+	{
+		errno = uringEnterError;
+		return -1;
+	}
+
+	return (int)syscall(__NR_io_uring_enter, ringFd, toSubmit, minComplete, flags, NULL, 0);
+}
+
+static void ipcUringDestroy(ripcUring *ring)
+{
+	if (ring->sqes != NULL && ring->sqes != MAP_FAILED)
+		munmap(ring->sqes, ring->sqesSize);
+	if (ring->cqRing != NULL && ring->cqRing != MAP_FAILED && ring->cqRing != ring->sqRing)
+		munmap(ring->cqRing, ring->cqRingSize);
+	if (ring->sqRing != NULL && ring->sqRing != MAP_FAILED)
+		munmap(ring->sqRing, ring->sqRingSize);
+	if (ring->ringFd >= 0)
+		close(ring->ringFd);
+	free(ring);
+}
+
+static ripcUring *ipcUringCreate(ripcUringMode mode)
+{
+	struct io_uring_params params;
+	ripcUring *ring;
+
+	if ((ring = (ripcUring*)calloc(1, sizeof(ripcUring))) == NULL)
+		return NULL;
+
+	memset(&params, 0, sizeof(params));
+	if (mode == RIPC_URING_SQPOLL)
+	{
+		params.flags = IORING_SETUP_SQPOLL;
+		params.sq_thread_idle = RIPC_URING_SQ_THREAD_IDLE;
+	}
+
+	if ((ring->ringFd = ipcUringSetup(RIPC_URING_ENTRIES, &params)) < 0)
+	{
+		free(ring);
+		return NULL;
+	}
+
+	ring->setupFlags = params.flags;
+	ring->sqRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+	ring->cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+
+	if (params.features & IORING_FEAT_SINGLE_MMAP)
+	{
+		if (ring->cqRingSize > ring->sqRingSize)
+			ring->sqRingSize = ring->cqRingSize;
+		ring->cqRingSize = ring->sqRingSize;
+	}
+
+	ring->sqRing = mmap(NULL, ring->sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->ringFd, IORING_OFF_SQ_RING);
+	if (ring->sqRing == MAP_FAILED)
+	{
+		ipcUringDestroy(ring);
+		return NULL;
+	}
+
+	if (params.features & IORING_FEAT_SINGLE_MMAP)
+		ring->cqRing = ring->sqRing;
+	else
+	{
+		ring->cqRing = mmap(NULL, ring->cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->ringFd, IORING_OFF_CQ_RING);
+		if (ring->cqRing == MAP_FAILED)
+		{
+			ipcUringDestroy(ring);
+			return NULL;
+		}
+	}
+
+	ring->sqesSize = params.sq_entries * sizeof(struct io_uring_sqe);
+	ring->sqes = (struct io_uring_sqe*)mmap(NULL, ring->sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->ringFd, IORING_OFF_SQES);
+	if (ring->sqes == MAP_FAILED)
+	{
+		ipcUringDestroy(ring);
+		return NULL;
+	}
+
+	ring->sqHead = (unsigned*)((char*)ring->sqRing + params.sq_off.head);
+	ring->sqTail = (unsigned*)((char*)ring->sqRing + params.sq_off.tail);
+	ring->sqMask = (unsigned*)((char*)ring->sqRing + params.sq_off.ring_mask);
+	ring->sqFlags = (unsigned*)((char*)ring->sqRing + params.sq_off.flags);
+	ring->sqArray = (unsigned*)((char*)ring->sqRing + params.sq_off.array);
+	ring->cqHead = (unsigned*)((char*)ring->cqRing + params.cq_off.head);
+	ring->cqTail = (unsigned*)((char*)ring->cqRing + params.cq_off.tail);
+	ring->cqMask = (unsigned*)((char*)ring->cqRing + params.cq_off.ring_mask);
+	ring->cqes = (struct io_uring_cqe*)((char*)ring->cqRing + params.cq_off.cqes);
+
+	return ring;
+}
+
+/* Removes the ring from uringList. Called with uringLock held. */
+static void ipcUringUnlink(ripcUring *ring)
+{
+	ripcUring **ppRing;
+
+	for (ppRing = &uringList; *ppRing != NULL; ppRing = &(*ppRing)->pNext)
+	{
+		if (*ppRing == ring)
+		{
+			*ppRing = ring->pNext;
+			break;
+		}
+	}
+}
+
+static void ipcUringThreadExit(void *pData)
+{
+	ripcUringThreadRings *pThreadRings = (ripcUringThreadRings*)pData;
+	int i;
+
+	(void)pthread_mutex_lock(&uringLock);
+
+	/* Rings of an older generation were already freed. */
+	if (pThreadRings->generation == uringGeneration)
+	{
+		for (i = 0; i < RIPC_URING_MAX_MODES; ++i)
+		{
+			if (pThreadRings->rings[i] != NULL)
+			{
+				ipcUringUnlink(pThreadRings->rings[i]);
+				ipcUringDestroy(pThreadRings->rings[i]);
+			}
+		}
+	}
+
+	(void)pthread_mutex_unlock(&uringLock);
+
+	free(pThreadRings);
+}
+
+static void ipcUringCreateKey()
+{
+	pthread_key_create(&uringKey, ipcUringThreadExit);
+}
+
+/* Returns the calling thread's rings, or NULL if there are none and create is 0 (or they could not be allocated). */
+static ripcUringThreadRings *ipcUringGetThreadRings(int create)
+{
+	ripcUringThreadRings *pThreadRings;
+
+	pthread_once(&uringKeyOnce, ipcUringCreateKey);
+
+	if ((pThreadRings = (ripcUringThreadRings*)pthread_getspecific(uringKey)) == NULL)
+	{
+		if (!create || (pThreadRings = (ripcUringThreadRings*)calloc(1, sizeof(ripcUringThreadRings))) == NULL)
+			return NULL;
+
+		pThreadRings->generation = __atomic_load_n(&uringGeneration, __ATOMIC_ACQUIRE);
+
+		if (pthread_setspecific(uringKey, pThreadRings) != 0)
+		{
+			free(pThreadRings);
+			return NULL;
+		}
+	}
+	else if (pThreadRings->generation != __atomic_load_n(&uringGeneration, __ATOMIC_ACQUIRE))
+	{
+		/* The rings were freed when the last io_uring channel closed. */
+		memset(pThreadRings, 0, sizeof(*pThreadRings));
+		pThreadRings->generation = __atomic_load_n(&uringGeneration, __ATOMIC_ACQUIRE);
+	}
+
+	return pThreadRings;
+}
+
+/* Returns the calling thread's ring for the given mode, or NULL if it could not be created. */
+static ripcUring *ipcUringGetThreadRing(ripcUringMode mode)
+{
+	ripcUringThreadRings *pThreadRings;
+
+	if ((pThreadRings = ipcUringGetThreadRings(1)) == NULL)
+		return NULL;
+
+	if (pThreadRings->rings[mode] == NULL && !pThreadRings->failed[mode])
+	{
+		if ((pThreadRings->rings[mode] = ipcUringCreate(mode)) == NULL)
+			pThreadRings->failed[mode] = 1;
+		else
+		{
+			(void)pthread_mutex_lock(&uringLock);
+			pThreadRings->rings[mode]->pNext = uringList;
+			uringList = pThreadRings->rings[mode];
+			(void)pthread_mutex_unlock(&uringLock);
+		}
+	}
+
+	return pThreadRings->rings[mode];
+}
+
+/* Submits the prepared entry and waits for its completion.
+ * Returns the result of the operation (negative errno on failure).
+ * The entry points at the caller's buffer, and for SENDMSG at a msghdr on the caller's stack. Once the kernel has
+ * taken the entry, this waits for its completion even if io_uring_enter() fails. An entry that the kernel has not
+ * taken is withdrawn before the error is returned, so that a later submission cannot pick it up. */
+static int ipcUringSubmitAndWait(ripcUring *ring)
+{
+	unsigned tail = *ring->sqTail;
+	unsigned head;
+	int spin = 0;
+
+	ring->sqes[tail & *ring->sqMask].user_data = tail;
+	ring->sqArray[tail & *ring->sqMask] = tail & *ring->sqMask;
+	__atomic_store_n(ring->sqTail, tail + 1, __ATOMIC_RELEASE);
+
+	if (ring->setupFlags & IORING_SETUP_SQPOLL)
+	{
+		/* The kernel thread picks up the entry; it only needs a wakeup if it went idle. */
+		if (__atomic_load_n(ring->sqFlags, __ATOMIC_ACQUIRE) & IORING_SQ_NEED_WAKEUP)
+			ipcUringEnter(ring->ringFd, 0, 0, IORING_ENTER_SQ_WAKEUP);
+	}
+
+	for (;;)
+	{
+		unsigned toSubmit;
+
+		head = *ring->cqHead;
+
+		if (__atomic_load_n(ring->cqTail, __ATOMIC_ACQUIRE) != head)
+		{
+			struct io_uring_cqe *cqe = &ring->cqes[head & *ring->cqMask];
+			RsslUInt64 userData = cqe->user_data;
+			int result = cqe->res;
+
+			__atomic_store_n(ring->cqHead, head + 1, __ATOMIC_RELEASE);
+
+			/* Each entry is waited for, so only this entry can complete; other completions are ignored. */
+			if (userData == (RsslUInt64)tail)
+				return result;
+			continue;
+		}
+
+		if (ring->setupFlags & IORING_SETUP_SQPOLL)
+		{
+			/* With SQPOLL, the operation usually completes without entering the kernel. */
+			if (spin < RIPC_URING_SPIN_COUNT)
+			{
+				++spin;
+				continue;
+			}
+
+			/* Waits for the completion, waking up the kernel thread if it went idle before taking the entry. */
+			ipcUringEnter(ring->ringFd, 0, 1, IORING_ENTER_GETEVENTS |
+					((__atomic_load_n(ring->sqFlags, __ATOMIC_ACQUIRE) & IORING_SQ_NEED_WAKEUP) ? IORING_ENTER_SQ_WAKEUP : 0));
+			continue;
+		}
+
+		toSubmit = (__atomic_load_n(ring->sqHead, __ATOMIC_ACQUIRE) == tail) ? 1 : 0;
+
+		if (ipcUringEnter(ring->ringFd, toSubmit, 1, IORING_ENTER_GETEVENTS) < 0 && errno != EINTR)
+		{
+			int error = errno;
+
+			/* Only this thread submits to the ring, so the kernel cannot take the entry while it is withdrawn. */
+			if (__atomic_load_n(ring->sqHead, __ATOMIC_ACQUIRE) == tail)
+			{
+				__atomic_store_n(ring->sqTail, tail, __ATOMIC_RELEASE);
+				return -error;
+			}
+
+			/* Otherwise the operation is in progress and still uses the buffers, so keep waiting for it. */
+		}
+	}
+}
+
+/* Returns the next submission entry, cleared. */
+static struct io_uring_sqe *ipcUringGetSqe(ripcUring *ring)
+{
+	struct io_uring_sqe *sqe = &ring->sqes[*ring->sqTail & *ring->sqMask];
+
+	memset(sqe, 0, sizeof(*sqe));
+	return sqe;
+}
+
+static int ipcUringRead(ripcUringMode mode, void *transport, char *buf, int max_len, ripcRWFlags flags, RsslError *error)
+{
+	ripcUring *ring;
+	struct io_uring_sqe *sqe;
+	int result;
+
+	if ((flags & RIPC_RW_BLOCKING) || (ring = ipcUringGetThreadRing(mode)) == NULL)
+		return ipcRead(transport, buf, max_len, flags, error);
+
+	sqe = ipcUringGetSqe(ring);
+	sqe->opcode = IORING_OP_RECV;
+	sqe->fd = ((ripcSocketSession*)transport)->fd;
+	sqe->addr = (unsigned long)buf;
+	sqe->len = (unsigned)max_len;
+	sqe->msg_flags = MSG_DONTWAIT;
+
+	/* Unlike ipcRead(), a short read is not followed by another read: it means the socket had no more data. */
+	result = ipcUringSubmitAndWait(ring);
+
+	if (result > 0)
+		return result;
+	else if (result == 0)
+	{
+		error->text[0] = '\0';
+		return(-2);
+	}
+	else if (result == -EAGAIN || result == -EINTR)
+		return(0);
+
+	errno = -result;
+	error->text[0] = '\0';
+	return(-1);
+}
+
+static int ipcUringWrite(ripcUringMode mode, void *transport, char *buf, int outLen, ripcRWFlags flags, RsslError *error)
+{
+	ripcUring *ring;
+	struct io_uring_sqe *sqe;
+	int result;
+
+	if ((flags & RIPC_RW_BLOCKING) || (ring = ipcUringGetThreadRing(mode)) == NULL)
+		return ipcWrite(transport, buf, outLen, flags, error);
+
+	sqe = ipcUringGetSqe(ring);
+	sqe->opcode = IORING_OP_SEND;
+	sqe->fd = ((ripcSocketSession*)transport)->fd;
+	sqe->addr = (unsigned long)buf;
+	sqe->len = (unsigned)outLen;
+	sqe->msg_flags = MSG_DONTWAIT;
+
+	result = ipcUringSubmitAndWait(ring);
+
+	if (result >= 0)
+		return result;
+	else if (result == -EAGAIN || result == -EINTR)
+		return(0);
+
+	errno = -result;
+	error->text[0] = '\0';
+	return(-1);
+}
+
+static int ipcUringWriteV(ripcUringMode mode, void *transport, ripcIovType *iov, int iovcnt, int outLen, ripcRWFlags flags, RsslError *error)
+{
+	ripcUring *ring;
+	struct io_uring_sqe *sqe;
+	struct msghdr msg;
+	int result;
+
+	if ((flags & RIPC_RW_BLOCKING) || (ring = ipcUringGetThreadRing(mode)) == NULL)
+		return ipcWriteV(transport, iov, iovcnt, outLen, flags, error);
+
+	memset(&msg, 0, sizeof(msg));
+	msg.msg_iov = iov;
+	msg.msg_iovlen = (size_t)iovcnt;
+
+	sqe = ipcUringGetSqe(ring);
+	sqe->opcode = IORING_OP_SENDMSG;
+	sqe->fd = ((ripcSocketSession*)transport)->fd;
+	sqe->addr = (unsigned long)&msg;
+	sqe->len = 1;
+	sqe->msg_flags = MSG_DONTWAIT;
+
+	result = ipcUringSubmitAndWait(ring);
+
+	if (result > 0)
+		return result;
+	else if (result == -EAGAIN || result == -EINTR)
+		return(0);
+	else if (result == 0)
+	{
+		error->text[0] = '\0';
+		return(-2);
+	}
+
+	errno = -result;
+	error->text[0] = '\0';
+	return(-1);
+}
+
+static int ipcUringInterruptRead(void *transport, char *buf, int max_len, ripcRWFlags flags, RsslError *error)
+{
+	return ipcUringRead(RIPC_URING_INTERRUPT, transport, buf, max_len, flags, error);
+}
+
+static int ipcUringInterruptWrite(void *transport, char *buf, int outLen, ripcRWFlags flags, RsslError *error)
+{
+	return ipcUringWrite(RIPC_URING_INTERRUPT, transport, buf, outLen, flags, error);
+}
+
+static int ipcUringInterruptWriteV(void *transport, ripcIovType *iov, int iovcnt, int outLen, ripcRWFlags flags, RsslError *error)
+{
+	return ipcUringWriteV(RIPC_URING_INTERRUPT, transport, iov, iovcnt, outLen, flags, error);
+}
+
+static int ipcUringSqpollRead(void *transport, char *buf, int max_len, ripcRWFlags flags, RsslError *error)
+{
+	return ipcUringRead(RIPC_URING_SQPOLL, transport, buf, max_len, flags, error);
+}
+
+static int ipcUringSqpollWrite(void *transport, char *buf, int outLen, ripcRWFlags flags, RsslError *error)
+{
+	return ipcUringWrite(RIPC_URING_SQPOLL, transport, buf, outLen, flags, error);
+}
+
+static int ipcUringSqpollWriteV(void *transport, ripcIovType *iov, int iovcnt, int outLen, ripcRWFlags flags, RsslError *error)
+{
+	return ipcUringWriteV(RIPC_URING_SQPOLL, transport, iov, iovcnt, outLen, flags, error);
+}
+
+int ipcUringAvailable()
+{
+	if (uringAvailable < 0)
+	{
+		struct io_uring_params params;
+		struct io_uring_probe *pProbe;
+		size_t probeSize = sizeof(struct io_uring_probe) + 256 * sizeof(struct io_uring_probe_op);
+		int ringFd;
+		int available = 0;
+
+		memset(&params, 0, sizeof(params));
+
+		if ((ringFd = ipcUringSetup(2, &params)) >= 0)
+		{
+			if ((pProbe = (struct io_uring_probe*)calloc(1, probeSize)) != NULL)
+			{
+				if (syscall(__NR_io_uring_register, ringFd, IORING_REGISTER_PROBE, pProbe, 256) >= 0
+						&& pProbe->last_op >= IORING_OP_RECV
+						&& (pProbe->ops[IORING_OP_RECV].flags & IO_URING_OP_SUPPORTED)
+						&& (pProbe->ops[IORING_OP_SEND].flags & IO_URING_OP_SUPPORTED)
+						&& (pProbe->ops[IORING_OP_SENDMSG].flags & IO_URING_OP_SUPPORTED))
+					available = 1;
+
+				free(pProbe);
+			}
+
+			close(ringFd);
+		}
+
+		uringAvailable = available;
+	}
+
+	return uringAvailable;
+}
+
+void ipcUringAddChannel()
+{
+	(void)pthread_mutex_lock(&uringLock);
+	++uringChannelCount;
+	(void)pthread_mutex_unlock(&uringLock);
+}
+
+void ipcUringRemoveChannel()
+{
+	(void)pthread_mutex_lock(&uringLock);
+
+	if (--uringChannelCount == 0)
+	{
+		/* No thread is reading or writing an io_uring channel, so no ring is in use. Each thread forgets its rings when
+		 * it sees the new generation. */
+		while (uringList != NULL)
+		{
+			ripcUring *ring = uringList;
+
+			uringList = ring->pNext;
+			ipcUringDestroy(ring);
+		}
+
+		__atomic_store_n(&uringGeneration, uringGeneration + 1, __ATOMIC_RELEASE);
+	}
+
+	(void)pthread_mutex_unlock(&uringLock);
+}
+
+void ipcUringSetEnterError(int error)
+{
+	uringEnterError = error;
+}
+
+int ipcUringPendingEntries(ripcUringMode mode)
+{
+	ripcUringThreadRings *pThreadRings;
+	ripcUring *ring;
+
+	if ((pThreadRings = ipcUringGetThreadRings(0)) == NULL || (ring = pThreadRings->rings[mode]) == NULL)
+		return -1;
+
+	return (int)(*ring->sqTail - __atomic_load_n(ring->sqHead, __ATOMIC_ACQUIRE));
+}
+
+int ipcSetUringFuncs()
+{
+	ripcTransportFuncs func;
+
+	if (!ipcUringAvailable())
+		return 0;
+
+	/* Only the read and write functions are set; the others are taken from the socket transport. */
+	memset(&func, 0, sizeof(func));
+
+	func.readTransport = ipcUringInterruptRead;
+	func.writeTransport = ipcUringInterruptWrite;
+	func.writeVTransport = ipcUringInterruptWriteV;
+	ipcSetUringTransFunc(RIPC_URING_INTERRUPT, &func);
+
+	func.readTransport = ipcUringSqpollRead;
+	func.writeTransport = ipcUringSqpollWrite;
+	func.writeVTransport = ipcUringSqpollWriteV;
+	ipcSetUringTransFunc(RIPC_URING_SQPOLL, &func);
+
+	return 1;
+}
+
+#define RIPC_URING_IMPLEMENTED
+#endif
+#endif
+
+#ifndef RIPC_URING_IMPLEMENTED
+
+int ipcUringAvailable()
+{
+	return 0;
+}
+
+void ipcUringAddChannel()
+{
+}
+
+void ipcUringRemoveChannel()
+{
+}
+
+void ipcUringSetEnterError(int error)
+{
+}
+
+int ipcUringPendingEntries(ripcUringMode mode)
+{
+	return -1;
+}
+
+int ipcSetUringFuncs()
+{
+	return 0;
+}
+
+#endif
@@ -0,0 +1,1367 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2022 Refinitiv. All rights reserved.              --
+ *|-----------------------------------------------------------------------------
+ */
+
+#include "rtr/rsslBidirShMemTransport.h"
+#include "rtr/rsslBidirShMemTransportImpl.h"
+#include "rtr/rsslAlloc.h"
+#include "rtr/rsslErrors.h"
+#include "rtr/rsslDataUtils.h"
+
+#ifdef LINUX
+#include <unistd.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include "rtr/shmemspscring.h"
+#endif
+
+/* global debug function pointers */
+static void(*rsslBidirShMemDumpInFunc)(const char *functionName, char *buffer, RsslUInt32 length, RsslSocket socketId) = 0;
+static void(*rsslBidirShMemDumpOutFunc)(const char *functionName, char *buffer, RsslUInt32 length, RsslSocket socketId) = 0;
+
+#ifdef LINUX
+
+#define RSSL_BIDIR_SHM_MAGIC			0x52424D53	/* "RBMS" */
+#define RSSL_BIDIR_SHM_VERSION			1
+#define RSSL_BIDIR_SHM_NAME_PREFIX		"rssl_bidir_shmem."
+#define RSSL_BIDIR_SHM_MAX_COMP_VER		256
+#define RSSL_BIDIR_SHM_HEADER_SIZE		4096
+#define RSSL_BIDIR_SHM_PACK_HDR_LEN		2
+#define RSSL_BIDIR_SHM_MAX_MSG_SIZE		0xFFFF
+
+/* closedFlags in the segment header */
+#define RSSL_BIDIR_SHM_SERVER_CLOSED	0x1
+#define RSSL_BIDIR_SHM_CLIENT_CLOSED	0x2
+
+/* Start of the shared memory segment. The server to client ring follows the first
+ * RSSL_BIDIR_SHM_HEADER_SIZE bytes, then the client to server ring. */
+typedef struct
+{
+	RsslUInt32			magic;
+	RsslUInt32			version;
+	volatile RsslUInt32	closedFlags;
+} rsslBidirShMemSegHeader;
+
+/* Sent by the client, then answered by the server along with the segment's file descriptor. */
+typedef struct
+{
+	RsslUInt32	magic;
+	RsslUInt32	version;
+	RsslUInt32	protocolType;
+	RsslUInt32	majorVersion;
+	RsslUInt32	minorVersion;
+	RsslUInt32	pingTimeout;
+	RsslUInt32	rsslFlags;					/* Ping directions; set by the server */
+	RsslUInt32	guaranteedOutputBuffers;	/* Sizes the client to server ring */
+	RsslUInt32	maxMsgSize;					/* Set by the server */
+	RsslUInt32	componentVersionLength;
+	RsslUInt64	segmentSize;				/* Set by the server */
+	RsslUInt64	serverRingSize;				/* Set by the server */
+	RsslUInt64	clientRingSize;				/* Set by the server */
+	char		componentVersion[RSSL_BIDIR_SHM_MAX_COMP_VER];
+} rsslBidirShMemHandshake;
+
+typedef enum
+{
+	RSSL_BIDIR_SHM_SEND_HELLO = 0,	/* Client has not sent its hello */
+	RSSL_BIDIR_SHM_WAIT_REPLY = 1,	/* Client is waiting for the segment */
+	RSSL_BIDIR_SHM_WAIT_HELLO = 2,	/* Server is waiting for the hello */
+	RSSL_BIDIR_SHM_ACTIVE = 3
+} rsslBidirShMemState;
+
+typedef struct
+{
+	RsslUInt32		maxMsgSize;
+	RsslUInt32		numBuffers;
+	RsslUInt32		pingTimeout;
+	RsslUInt32		minPingTimeout;
+	RsslUInt32		protocolType;
+	RsslUInt32		majorVersion;
+	RsslUInt32		minorVersion;
+	RsslUInt32		readerSpinCount;
+	int				rsslFlags;
+	RsslBool		channelsBlocking;
+} RsslBidirShMemServer;
+
+typedef struct
+{
+	RsslBool				isServer;
+	rsslBidirShMemState		state;
+	char					*segment;
+	size_t					segmentSize;
+	rsslBidirShMemSegHeader	*header;
+	RsslUInt32				peerClosedFlag;
+	rtrSpscRing				outRing;				/* Protected by chanMutex */
+	rtrSpscRing				inRing;					/* Protected by chanReadMutex */
+	rtrSpscRecord			*readRecord;			/* Returned by the last read; released by the next one. Its checked length is inRing.recordLength */
+	RsslUInt32				unpackOffset;			/* Offset of the next message in a packed readRecord */
+	RsslUInt32				idleReads;
+	RsslUInt32				readerSpinCount;
+	RsslUInt32				guaranteedOutputBuffers;
+	RsslInt32				outstandingBuffers;
+	RsslUInt32				peerComponentVersionLength;
+	char					peerComponentVersion[RSSL_BIDIR_SHM_MAX_COMP_VER];
+} RsslBidirShMemChannel;
+
+static RsslUInt32 rsslBidirShMemSegmentCount = 0;
+
+/***************************
+ * START INLINE HELPER FUNCTIONS
+ ***************************/
+
+/* Wakes the other side, which is waiting on its socketId. The socket only fills up if the
+ * other side has not read the earlier signals yet, in which case it is already awake. */
+RTR_C_ALWAYS_INLINE void _rsslBidirShMemSignal(rsslChannelImpl *rsslChnlImpl)
+{
+	(void)send(rsslChnlImpl->Channel.socketId, "s", 1, MSG_DONTWAIT | MSG_NOSIGNAL);
+}
+
+RTR_C_ALWAYS_INLINE RsslUInt64 _rsslBidirShMemRingSize(RsslUInt32 numBuffers, RsslUInt32 maxMsgSize)
+{
+	RsslUInt64 recordSize = RTR_SPSC_RECORD_SIZE(maxMsgSize + RSSL_BIDIR_SHM_PACK_HDR_LEN);
+	RsslUInt64 needed = (RsslUInt64)numBuffers * recordSize;
+	RsslUInt64 size = 4096;
+
+	/* One reserved record must never be able to stop the other side from reading and writing. */
+	if (needed < 4 * recordSize)
+		needed = 4 * recordSize;
+
+	while (size < needed)
+		size <<= 1;
+
+	return size;
+}
+
+static RsslRet _rsslBidirShMemSocketName(struct sockaddr_un *addr, socklen_t *addrLen, const char *interfaceName, const char *serviceName, const char *function, RsslError *error)
+{
+	RsslInt32 nBytes;
+
+	memset(addr, 0, sizeof(struct sockaddr_un));
+	addr->sun_family = AF_UNIX;
+
+	/* The name is in the abstract namespace, so no file is left behind. */
+	nBytes = snprintf(addr->sun_path + 1, sizeof(addr->sun_path) - 1, RSSL_BIDIR_SHM_NAME_PREFIX "%s%s",
+			interfaceName ? interfaceName : "", serviceName);
+
+	if ((nBytes >= (RsslInt32)sizeof(addr->sun_path) - 1) || nBytes < 0)
+	{
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> %s() bad interface and/or service name\n", __FILE__, __LINE__, function);
+		return RSSL_RET_FAILURE;
+	}
+
+	*addrLen = (socklen_t)(offsetof(struct sockaddr_un, sun_path) + 1 + nBytes);
+	return RSSL_RET_SUCCESS;
+}
+
+/* Ring sizes come from the server; the client only accepts the ones the server could have made. */
+RTR_C_ALWAYS_INLINE RsslBool _rsslBidirShMemValidRingSize(RsslUInt64 ringSize)
+{
+	return (ringSize >= 4096 && ringSize <= ((RsslUInt64)1 << 40) && (ringSize & (ringSize - 1)) == 0) ? RSSL_TRUE : RSSL_FALSE;
+}
+
+static void _rsslBidirShMemAttachRings(RsslBidirShMemChannel *pChannel, RsslUInt64 serverRingSize, RsslUInt64 clientRingSize)
+{
+	char *serverRing = pChannel->segment + RSSL_BIDIR_SHM_HEADER_SIZE;
+	char *clientRing = serverRing + RTR_SPSC_RING_MEM_SIZE(serverRingSize);
+
+	pChannel->header = (rsslBidirShMemSegHeader*)pChannel->segment;
+
+	if (pChannel->isServer)
+	{
+		rtrSpscRingAttach(&pChannel->outRing, serverRing, serverRingSize, RSSL_TRUE);
+		rtrSpscRingAttach(&pChannel->inRing, clientRing, clientRingSize, RSSL_FALSE);
+		pChannel->peerClosedFlag = RSSL_BIDIR_SHM_CLIENT_CLOSED;
+	}
+	else
+	{
+		rtrSpscRingAttach(&pChannel->outRing, clientRing, clientRingSize, RSSL_TRUE);
+		rtrSpscRingAttach(&pChannel->inRing, serverRing, serverRingSize, RSSL_FALSE);
+		pChannel->peerClosedFlag = RSSL_BIDIR_SHM_SERVER_CLOSED;
+	}
+}
+
+/* Creates the segment for an accepted channel. The segment is unlinked right away; the client gets
+ * it through the file descriptor, and it is freed when both sides have unmapped it. */
+static int _rsslBidirShMemCreateSegment(RsslBidirShMemChannel *pChannel, RsslUInt64 serverRingSize, RsslUInt64 clientRingSize, RsslError *error)
+{
+	char name[64];
+	int fd;
+
+	pChannel->segmentSize = RSSL_BIDIR_SHM_HEADER_SIZE + RTR_SPSC_RING_MEM_SIZE(serverRingSize) + RTR_SPSC_RING_MEM_SIZE(clientRingSize);
+
+	snprintf(name, sizeof(name), "/" RSSL_BIDIR_SHM_NAME_PREFIX "%d.%u", (int)getpid(), __atomic_add_fetch(&rsslBidirShMemSegmentCount, 1, __ATOMIC_RELAXED));
+	if ((fd = shm_open(name, O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR)) < 0)
+	{
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslInitChannel() shm_open() failed. System errno: (%d)\n", __FILE__, __LINE__, errno);
+		return -1;
+	}
+	(void)shm_unlink(name);
+
+	if (ftruncate(fd, (off_t)pChannel->segmentSize) < 0
+		|| (pChannel->segment = (char*)mmap(NULL, pChannel->segmentSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0)) == MAP_FAILED)
+	{
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslInitChannel() could not create shared memory segment of %llu bytes. System errno: (%d)\n", __FILE__, __LINE__, (unsigned long long)pChannel->segmentSize, errno);
+		pChannel->segment = NULL;
+		close(fd);
+		return -1;
+	}
+
+	rtrSpscRingCreate(pChannel->segment + RSSL_BIDIR_SHM_HEADER_SIZE);
+	rtrSpscRingCreate(pChannel->segment + RSSL_BIDIR_SHM_HEADER_SIZE + RTR_SPSC_RING_MEM_SIZE(serverRingSize));
+	((rsslBidirShMemSegHeader*)pChannel->segment)->magic = RSSL_BIDIR_SHM_MAGIC;
+	((rsslBidirShMemSegHeader*)pChannel->segment)->version = RSSL_BIDIR_SHM_VERSION;
+	_rsslBidirShMemAttachRings(pChannel, serverRingSize, clientRingSize);
+
+	return fd;
+}
+
+static void _rsslBidirShMemSetComponentVersion(rsslChannelImpl *rsslChnlImpl, rsslBidirShMemHandshake *handshake)
+{
+	handshake->componentVersionLength = rsslChnlImpl->componentVer.componentVersion.length;
+	if (handshake->componentVersionLength > RSSL_BIDIR_SHM_MAX_COMP_VER)
+		handshake->componentVersionLength = RSSL_BIDIR_SHM_MAX_COMP_VER;
+	if (handshake->componentVersionLength)
+		memcpy(handshake->componentVersion, rsslChnlImpl->componentVer.componentVersion.data, handshake->componentVersionLength);
+}
+
+static void _rsslBidirShMemGetComponentVersion(RsslBidirShMemChannel *pChannel, rsslBidirShMemHandshake *handshake)
+{
+	pChannel->peerComponentVersionLength = handshake->componentVersionLength;
+	if (pChannel->peerComponentVersionLength > RSSL_BIDIR_SHM_MAX_COMP_VER)
+		pChannel->peerComponentVersionLength = RSSL_BIDIR_SHM_MAX_COMP_VER;
+	memcpy(pChannel->peerComponentVersion, handshake->componentVersion, pChannel->peerComponentVersionLength);
+}
+
+/* Waits for the socket during a blocking connect or accept. */
+static RsslRet _rsslBidirShMemInitBlocking(rsslChannelImpl *rsslChnlImpl, RsslError *error)
+{
+	RsslInProgInfo inProg;
+	RsslRet ret;
+
+	while ((ret = rsslBidirShMemInitChannel(rsslChnlImpl, &inProg, error)) == RSSL_RET_CHAN_INIT_IN_PROGRESS)
+	{
+		struct pollfd pfd;
+
+		pfd.fd = rsslChnlImpl->Channel.socketId;
+		pfd.events = POLLIN;
+		pfd.revents = 0;
+		(void)poll(&pfd, 1, 100);
+	}
+
+	return ret;
+}
+
+/* Called when the other side wrote something that does not fit in the inbound ring or record.
+ * The ring cannot be trusted past that point, so the channel is closed. */
+static RsslBuffer *_rsslBidirShMemReadCorrupt(rsslChannelImpl *rsslChnlImpl, RsslRet *readRet, RsslError *error)
+{
+	_rsslSetError(error, &rsslChnlImpl->Channel, RSSL_RET_FAILURE, 0);
+	snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslRead() Error: 0012 The other side wrote an invalid record to the shared memory connection.\n", __FILE__, __LINE__);
+	rsslChnlImpl->Channel.state = RSSL_CH_STATE_CLOSED;
+	*readRet = RSSL_RET_FAILURE;
+	return NULL;
+}
+
+/* Called when the inbound ring is empty. Busy-polling readers are asked to call again; otherwise
+ * the writer is asked to signal the socketId when it publishes. */
+static RsslBuffer *_rsslBidirShMemReadEmpty(rsslChannelImpl *rsslChnlImpl, RsslBidirShMemChannel *pChannel, RsslRet *readRet, RsslError *error)
+{
+	char signals[64];
+	ssize_t bytes;
+
+	if (rtrUnlikely(pChannel->inRing.corrupt))
+		return _rsslBidirShMemReadCorrupt(rsslChnlImpl, readRet, error);
+
+	if (rtrUnlikely(pChannel->header->closedFlags & pChannel->peerClosedFlag))
+	{
+		_rsslSetError(error, &rsslChnlImpl->Channel, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslRead() Error: 0012 The other side closed the shared memory connection.\n", __FILE__, __LINE__);
+		rsslChnlImpl->Channel.state = RSSL_CH_STATE_CLOSED;
+		*readRet = RSSL_RET_FAILURE;
+		return NULL;
+	}
+
+	if (pChannel->idleReads < pChannel->readerSpinCount)
+	{
+		++pChannel->idleReads;
+		*readRet = 1;	/* call us again without select */
+		return NULL;
+	}
+	pChannel->idleReads = 0;
+
+	/* Drains the signals that woke us up, before asking for the next one. */
+	while ((bytes = recv(rsslChnlImpl->Channel.socketId, signals, sizeof(signals), MSG_DONTWAIT)) > 0);
+
+	if (bytes == 0 || (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR))
+	{
+		_rsslSetError(error, &rsslChnlImpl->Channel, RSSL_RET_FAILURE, errno);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslRead() Error: 0012 The shared memory connection was lost. System errno: (%d)\n", __FILE__, __LINE__, (bytes == 0 ? 0 : errno));
+		rsslChnlImpl->Channel.state = RSSL_CH_STATE_CLOSED;
+		*readRet = RSSL_RET_FAILURE;
+		return NULL;
+	}
+
+	if (rtrSpscRingPrepareWait(&pChannel->inRing))
+	{
+		*readRet = 1;
+		return NULL;
+	}
+
+	/* The ring is empty, so a writer waiting for space can go on. */
+	if (rtrSpscRingWriterWaiting(&pChannel->inRing))
+		_rsslBidirShMemSignal(rsslChnlImpl);
+
+	*readRet = RSSL_RET_READ_WOULD_BLOCK;
+	return NULL;
+}
+
+/* Returns the readRet for a read that returned a message. */
+RTR_C_ALWAYS_INLINE RsslRet _rsslBidirShMemMoreToRead(rsslChannelImpl *rsslChnlImpl, RsslBidirShMemChannel *pChannel)
+{
+	if (pChannel->unpackOffset < pChannel->inRing.recordLength || pChannel->readerSpinCount)
+		return 1;
+
+	if (rtrSpscRingHasData(&pChannel->inRing) || rtrSpscRingPrepareWait(&pChannel->inRing))
+		return 1;
+
+	if (rtrSpscRingWriterWaiting(&pChannel->inRing))
+		_rsslBidirShMemSignal(rsslChnlImpl);
+
+	return 0;
+}
+
+#endif
+
+/***************************
+ * START NON-PUBLIC ABSTRACTED FUNCTIONS
+ ***************************/
+
+/* rssl BidirShMem Bind call */
+RsslRet rsslBidirShMemBind(rsslServerImpl* rsslSrvrImpl, RsslBindOptions *opts, RsslError *error)
+{
+#ifdef LINUX
+	RsslBidirShMemServer *pServer;
+	struct sockaddr_un addr;
+	socklen_t addrLen;
+	int fd;
+
+	if (RSSL_NULL_PTR(opts->serviceName, "rsslBind", "opts->serviceName", error))
+		return RSSL_RET_FAILURE;
+
+	if (_rsslBidirShMemSocketName(&addr, &addrLen, opts->interfaceName, opts->serviceName, "rsslBidirShMemBind", error) != RSSL_RET_SUCCESS)
+		return RSSL_RET_FAILURE;
+
+	if ((pServer = (RsslBidirShMemServer*)_rsslMalloc(sizeof(RsslBidirShMemServer))) == NULL)
+	{
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslBind() Error: 0005 Could not allocate memory for new server\n", __FILE__, __LINE__);
+		return RSSL_RET_FAILURE;
+	}
+
+	if ((fd = socket(AF_UNIX, SOCK_SEQPACKET, 0)) < 0
+		|| bind(fd, (struct sockaddr*)&addr, addrLen) < 0
+		|| listen(fd, 64) < 0
+		|| (!opts->serverBlocking && fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK) < 0))
+	{
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslBind() Error: 1002 Could not bind to service %s. System errno: (%d)\n", __FILE__, __LINE__, opts->serviceName, errno);
+		if (fd >= 0)
+			close(fd);
+		_rsslFree(pServer);
+		return RSSL_RET_FAILURE;
+	}
+
+	pServer->maxMsgSize = (opts->maxFragmentSize < RSSL_BIDIR_SHM_MAX_MSG_SIZE ? opts->maxFragmentSize : RSSL_BIDIR_SHM_MAX_MSG_SIZE);
+	pServer->numBuffers = (opts->maxOutputBuffers < opts->guaranteedOutputBuffers ? opts->guaranteedOutputBuffers : opts->maxOutputBuffers);
+	pServer->pingTimeout = opts->pingTimeout;
+	pServer->minPingTimeout = opts->minPingTimeout;
+	pServer->protocolType = opts->protocolType;
+	pServer->majorVersion = opts->majorVersion;
+	pServer->minorVersion = opts->minorVersion;
+	pServer->readerSpinCount = opts->shmemOpts.readerSpinCount;
+	pServer->channelsBlocking = opts->channelsBlocking;
+	pServer->rsslFlags = (opts->serverToClientPings ? SERVER_TO_CLIENT : 0) | (opts->clientToServerPings ? CLIENT_TO_SERVER : 0);
+
+	rsslSrvrImpl->connectionType = RSSL_CONN_TYPE_BIDIR_SHMEM;
+	rsslSrvrImpl->transportInfo = pServer;
+	rsslSrvrImpl->isBlocking = opts->serverBlocking;
+	rsslSrvrImpl->Server.socketId = fd;
+	rsslSrvrImpl->Server.userSpecPtr = opts->userSpecPtr;
+	rsslSrvrImpl->Server.state = RSSL_CH_STATE_ACTIVE;
+	rsslSrvrImpl->Server.portNumber = 0;
+	return RSSL_RET_SUCCESS;
+#else
+	_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+	snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslBind() Error: 0006 Bidirectional shared memory connection type is supported on Linux only.\n", __FILE__, __LINE__);
+	return RSSL_RET_FAILURE;
+#endif
+}
+
+/* rssl BidirShMem Connect */
+RsslRet rsslBidirShMemConnect(rsslChannelImpl* rsslChnlImpl, RsslConnectOptions *opts, RsslError *error)
+{
+#ifdef LINUX
+	RsslBidirShMemChannel *pChannel;
+	struct sockaddr_un addr;
+	socklen_t addrLen;
+	int fd;
+
+	/* For all connection types we minimally need this value populated (unified.serviceName == segmented.recvPort) */
+	if (RSSL_NULL_PTR(opts->connectionInfo.unified.serviceName, "rsslConnect", "opts->connectionInfo.unified.serviceName", error))
+		return RSSL_RET_FAILURE;
+
+	if (_rsslBidirShMemSocketName(&addr, &addrLen, opts->connectionInfo.unified.interfaceName, opts->connectionInfo.unified.serviceName, "rsslBidirShMemConnect", error) != RSSL_RET_SUCCESS)
+		return RSSL_RET_FAILURE;
+
+	if ((pChannel = (RsslBidirShMemChannel*)_rsslMalloc(sizeof(RsslBidirShMemChannel))) == NULL)
+	{
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslConnect() Error: 0005 could not allocate memory for new channel\n", __FILE__, __LINE__);
+		return RSSL_RET_FAILURE;
+	}
+	memset(pChannel, 0, sizeof(RsslBidirShMemChannel));
+
+	/* Connecting a local socket completes immediately or fails. */
+	if ((fd = socket(AF_UNIX, SOCK_SEQPACKET, 0)) < 0
+		|| connect(fd, (struct sockaddr*)&addr, addrLen) < 0
+		|| fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK) < 0)
+	{
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslConnect() Error: 1002 Could not connect to service %s. System errno: (%d)\n", __FILE__, __LINE__, opts->connectionInfo.unified.serviceName, errno);
+		if (fd >= 0)
+			close(fd);
+		_rsslFree(pChannel);
+		return RSSL_RET_FAILURE;
+	}
+
+	pChannel->isServer = RSSL_FALSE;
+	pChannel->state = RSSL_BIDIR_SHM_SEND_HELLO;
+	pChannel->readerSpinCount = opts->shmemOpts.readerSpinCount;
+	pChannel->guaranteedOutputBuffers = opts->guaranteedOutputBuffers;
+
+	rsslChnlImpl->transportInfo = pChannel;
+	rsslChnlImpl->Channel.pingTimeout = opts->pingTimeout;
+	rsslChnlImpl->Channel.majorVersion = opts->majorVersion;
+	rsslChnlImpl->Channel.minorVersion = opts->minorVersion;
+	rsslChnlImpl->Channel.protocolType = opts->protocolType;
+	rsslChnlImpl->Channel.connectionType = RSSL_CONN_TYPE_BIDIR_SHMEM;
+	rsslChnlImpl->Channel.socketId = fd;
+	rsslChnlImpl->Channel.userSpecPtr = opts->userSpecPtr;
+	rsslChnlImpl->Channel.state = RSSL_CH_STATE_INITIALIZING;
+	rsslChnlImpl->isBlocking = opts->blocking;
+
+	/* if its a nonblocking connect, we are done here */
+	if (opts->blocking == 0)
+		return RSSL_RET_SUCCESS;
+
+	/* for a blocking connection, call rsslInitChannel (which will set state to active) for the user */
+	if (_rsslBidirShMemInitBlocking(rsslChnlImpl, error) != RSSL_RET_SUCCESS)
+	{
+		rsslBidirShMemCloseChannel(rsslChnlImpl, error);
+		return RSSL_RET_FAILURE;
+	}
+	return RSSL_RET_SUCCESS;
+#else
+	_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+	snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslConnect() Error: 0006 Bidirectional shared memory connection type is supported on Linux only.\n", __FILE__, __LINE__);
+	return RSSL_RET_FAILURE;
+#endif
+}
+
+/* rssl BidirShMem accept */
+rsslChannelImpl* rsslBidirShMemAccept(rsslServerImpl *rsslSrvrImpl, RsslAcceptOptions *opts, RsslError *error)
+{
+#ifdef LINUX
+	RsslBidirShMemServer *pServer = (RsslBidirShMemServer*)rsslSrvrImpl->transportInfo;
+	RsslBidirShMemChannel *pChannel;
+	rsslChannelImpl	*rsslChnlImpl;
+	int fd;
+
+	if ((fd = accept(rsslSrvrImpl->Server.socketId, NULL, NULL)) < 0)
+	{
+		_rsslSetError(error, (RsslChannel*)(&rsslSrvrImpl->Server), RSSL_RET_FAILURE, errno);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslAccept() Error: 1002 accept() failed. System errno: (%d)\n", __FILE__, __LINE__, errno);
+		return NULL;
+	}
+
+	if (fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK) < 0)
+	{
+		_rsslSetError(error, (RsslChannel*)(&rsslSrvrImpl->Server), RSSL_RET_FAILURE, errno);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslAccept() Error: 1002 fcntl() failed. System errno: (%d)\n", __FILE__, __LINE__, errno);
+		close(fd);
+		return NULL;
+	}
+
+	if ((rsslChnlImpl = _rsslNewChannel()) == 0
+		|| (pChannel = (RsslBidirShMemChannel*)_rsslMalloc(sizeof(RsslBidirShMemChannel))) == NULL)
+	{
+		_rsslSetError(error, (RsslChannel*)(&rsslSrvrImpl->Server), RSSL_RET_FAILURE,  0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslAccept() could not allocate memory for new channel\n", __FILE__, __LINE__);
+		if (rsslChnlImpl)
+			_rsslReleaseChannel(rsslChnlImpl);
+		close(fd);
+		return NULL;
+	}
+	memset(pChannel, 0, sizeof(RsslBidirShMemChannel));
+
+	pChannel->isServer = RSSL_TRUE;
+	pChannel->state = RSSL_BIDIR_SHM_WAIT_HELLO;
+	pChannel->readerSpinCount = pServer->readerSpinCount;
+
+	rsslChnlImpl->transportInfo = pChannel;
+	rsslChnlImpl->transportServerInfo = pServer;
+	rsslChnlImpl->maxMsgSize = pServer->maxMsgSize;
+	rsslChnlImpl->maxGuarMsgs = pServer->numBuffers;
+	rsslChnlImpl->rsslFlags = pServer->rsslFlags;
+	rsslChnlImpl->Channel.connectionType = rsslSrvrImpl->connectionType;
+	rsslChnlImpl->Channel.pingTimeout = pServer->pingTimeout;
+	rsslChnlImpl->Channel.majorVersion = pServer->majorVersion;
+	rsslChnlImpl->Channel.minorVersion = pServer->minorVersion;
+	rsslChnlImpl->Channel.protocolType = pServer->protocolType;
+	rsslChnlImpl->Channel.socketId = fd;
+
+	rsslChnlImpl->Channel.clientHostname = (char*)_rsslMalloc(32);
+	strncpy(rsslChnlImpl->Channel.clientHostname, "localhost", 32);
+	rsslChnlImpl->Channel.clientIP = (char*)_rsslMalloc(32);
+	strncpy(rsslChnlImpl->Channel.clientIP, "127.0.0.1", 32);
+	rsslChnlImpl->Channel.port = 0;
+
+	if (!opts->userSpecPtr)
+		rsslChnlImpl->Channel.userSpecPtr = rsslSrvrImpl->Server.userSpecPtr;
+	else
+		rsslChnlImpl->Channel.userSpecPtr = opts->userSpecPtr;
+
+	rsslChnlImpl->channelFuncs = rsslSrvrImpl->channelFuncs;
+	rsslChnlImpl->isBlocking = pServer->channelsBlocking;
+	rsslChnlImpl->Channel.state	= RSSL_CH_STATE_INITIALIZING;
+
+	/* if its a nonblocking connect, then set to initializing and exit */
+	/* the user will need to call rsslInitChannel next */
+	if (!pServer->channelsBlocking)
+		return rsslChnlImpl;
+
+	/* for a blocking connection, call rsslInitChannel for the user */
+	if (_rsslBidirShMemInitBlocking(rsslChnlImpl, error) != RSSL_RET_SUCCESS)
+	{
+		rsslBidirShMemCloseChannel(rsslChnlImpl, error);
+		_rsslReleaseChannel(rsslChnlImpl);
+		return NULL;
+	}
+
+	return rsslChnlImpl;
+#else
+	_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+	snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslAccept() Error: 0006 Bidirectional shared memory connection type is supported on Linux only.\n", __FILE__, __LINE__);
+	return NULL;
+#endif
+}
+
+/* rssl BidirShMem ReConnect (for tunneling, basically a no-op) */
+RsslRet rsslBidirShMemReconnect(rsslChannelImpl *rsslChnlImpl, RsslError *error)
+{
+	return RSSL_RET_SUCCESS;
+}
+
+/* rssl BidirShMem InitChannel */
+/* The client sends a hello with its settings. The server creates the segment and answers with the
+ * negotiated settings and the segment's file descriptor. */
+RsslRet rsslBidirShMemInitChannel(rsslChannelImpl *rsslChnlImpl, RsslInProgInfo *inProg, RsslError *error)
+{
+#ifdef LINUX
+	RsslBidirShMemChannel *pChannel = (RsslBidirShMemChannel*)rsslChnlImpl->transportInfo;
+	rsslBidirShMemHandshake handshake;
+	struct msghdr msg;
+	struct iovec iov;
+	union
+	{
+		struct cmsghdr	align;
+		char			buf[CMSG_SPACE(sizeof(int))];
+	} control;
+	struct cmsghdr *cmsg;
+	ssize_t bytes;
+	int fd = -1;
+
+	if (rsslChnlImpl->Channel.state == RSSL_CH_STATE_ACTIVE)
+		return RSSL_RET_SUCCESS;
+
+	if (!pChannel || rsslChnlImpl->Channel.state != RSSL_CH_STATE_INITIALIZING)
+	{
+		_rsslSetError(error, &rsslChnlImpl->Channel, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslBidirShMemInitChannel failed. Unexpected Channel state(%d)\n", __FILE__, __LINE__, rsslChnlImpl->Channel.state);
+		return RSSL_RET_FAILURE;
+	}
+
+	if (inProg)
+		inProg->flags = 0;
+
+	if (pChannel->state == RSSL_BIDIR_SHM_SEND_HELLO)
+	{
+		memset(&handshake, 0, sizeof(handshake));
+		handshake.magic = RSSL_BIDIR_SHM_MAGIC;
+		handshake.version = RSSL_BIDIR_SHM_VERSION;
+		handshake.protocolType = rsslChnlImpl->Channel.protocolType;
+		handshake.majorVersion = rsslChnlImpl->Channel.majorVersion;
+		handshake.minorVersion = rsslChnlImpl->Channel.minorVersion;
+		handshake.pingTimeout = rsslChnlImpl->Channel.pingTimeout;
+		handshake.guaranteedOutputBuffers = pChannel->guaranteedOutputBuffers;
+		_rsslBidirShMemSetComponentVersion(rsslChnlImpl, &handshake);
+
+		if (send(rsslChnlImpl->Channel.socketId, &handshake, sizeof(handshake), MSG_NOSIGNAL) != (ssize_t)sizeof(handshake))
+		{
+			_rsslSetError(error, &rsslChnlImpl->Channel, RSSL_RET_FAILURE, errno);
+			snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslInitChannel() Error: 1002 Could not send the connection request. System errno: (%d)\n", __FILE__, __LINE__, errno);
+			rsslChnlImpl->Channel.state = RSSL_CH_STATE_CLOSED;
+			return RSSL_RET_FAILURE;
+		}
+		pChannel->state = RSSL_BIDIR_SHM_WAIT_REPLY;
+	}
+
+	memset(&msg, 0, sizeof(msg));
+	iov.iov_base = &handshake;
+	iov.iov_len = sizeof(handshake);
+	msg.msg_iov = &iov;
+	msg.msg_iovlen = 1;
+	msg.msg_control = control.buf;
+	msg.msg_controllen = sizeof(control.buf);
+
+	if ((bytes = recvmsg(rsslChnlImpl->Channel.socketId, &msg, 0)) < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR))
+		return RSSL_RET_CHAN_INIT_IN_PROGRESS;
+
+	if (pChannel->state == RSSL_BIDIR_SHM_WAIT_REPLY && (cmsg = CMSG_FIRSTHDR(&msg)) != NULL
+		&& cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SCM_RIGHTS)
+		memcpy(&fd, CMSG_DATA(cmsg), sizeof(int));
+
+	if (bytes != (ssize_t)sizeof(handshake) || handshake.magic != RSSL_BIDIR_SHM_MAGIC || handshake.version != RSSL_BIDIR_SHM_VERSION
+		|| handshake.protocolType != rsslChnlImpl->Channel.protocolType || (pChannel->state == RSSL_BIDIR_SHM_WAIT_REPLY && fd < 0))
+	{
+		_rsslSetError(error, &rsslChnlImpl->Channel, RSSL_RET_FAILURE, (bytes < 0 ? errno : 0));
+		if (pChannel->state == RSSL_BIDIR_SHM_WAIT_REPLY)
+			snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslInitChannel() Error: 0012 The server rejected the connection (protocol type or version mismatch).\n", __FILE__, __LINE__);
+		else
+			snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslInitChannel() Error: 0012 Rejected a connection request with a different protocol type or version.\n", __FILE__, __LINE__);
+		if (fd >= 0)
+			close(fd);
+		rsslChnlImpl->Channel.state = RSSL_CH_STATE_CLOSED;
+		return RSSL_RET_FAILURE;
+	}
+
+	if (pChannel->state == RSSL_BIDIR_SHM_WAIT_HELLO)
+	{
+		RsslBidirShMemServer *pServer = (RsslBidirShMemServer*)rsslChnlImpl->transportServerInfo;
+		RsslUInt64 serverRingSize = _rsslBidirShMemRingSize(pServer->numBuffers, pServer->maxMsgSize);
+		RsslUInt64 clientRingSize = _rsslBidirShMemRingSize(handshake.guaranteedOutputBuffers, pServer->maxMsgSize);
+
+		_rsslBidirShMemGetComponentVersion(pChannel, &handshake);
+
+		/* The server's ping timeout is the most the client can ask for. */
+		if (handshake.pingTimeout < rsslChnlImpl->Channel.pingTimeout)
+			rsslChnlImpl->Channel.pingTimeout = handshake.pingTimeout;
+		if (rsslChnlImpl->Channel.pingTimeout < pServer->minPingTimeout)
+			rsslChnlImpl->Channel.pingTimeout = pServer->minPingTimeout;
+
+		if ((fd = _rsslBidirShMemCreateSegment(pChannel, serverRingSize, clientRingSize, error)) < 0)
+		{
+			rsslChnlImpl->Channel.state = RSSL_CH_STATE_CLOSED;
+			return RSSL_RET_FAILURE;
+		}
+
+		memset(&handshake, 0, sizeof(handshake));
+		handshake.magic = RSSL_BIDIR_SHM_MAGIC;
+		handshake.version = RSSL_BIDIR_SHM_VERSION;
+		handshake.protocolType = rsslChnlImpl->Channel.protocolType;
+		handshake.majorVersion = rsslChnlImpl->Channel.majorVersion;
+		handshake.minorVersion = rsslChnlImpl->Channel.minorVersion;
+		handshake.pingTimeout = rsslChnlImpl->Channel.pingTimeout;
+		handshake.rsslFlags = (RsslUInt32)rsslChnlImpl->rsslFlags;
+		handshake.maxMsgSize = rsslChnlImpl->maxMsgSize;
+		handshake.segmentSize = pChannel->segmentSize;
+		handshake.serverRingSize = serverRingSize;
+		handshake.clientRingSize = clientRingSize;
+		_rsslBidirShMemSetComponentVersion(rsslChnlImpl, &handshake);
+
+		memset(&msg, 0, sizeof(msg));
+		memset(&control, 0, sizeof(control));
+		iov.iov_base = &handshake;
+		iov.iov_len = sizeof(handshake);
+		msg.msg_iov = &iov;
+		msg.msg_iovlen = 1;
+		msg.msg_control = control.buf;
+		msg.msg_controllen = sizeof(control.buf);
+		cmsg = CMSG_FIRSTHDR(&msg);
+		cmsg->cmsg_level = SOL_SOCKET;
+		cmsg->cmsg_type = SCM_RIGHTS;
+		cmsg->cmsg_len = CMSG_LEN(sizeof(int));
+		memcpy(CMSG_DATA(cmsg), &fd, sizeof(int));
+
+		bytes = sendmsg(rsslChnlImpl->Channel.socketId, &msg, MSG_NOSIGNAL);
+		close(fd);
+
+		if (bytes != (ssize_t)sizeof(handshake))
+		{
+			_rsslSetError(error, &rsslChnlImpl->Channel, RSSL_RET_FAILURE, errno);
+			snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslInitChannel() Error: 1002 Could not send the shared memory segment. System errno: (%d)\n", __FILE__, __LINE__, errno);
+			rsslChnlImpl->Channel.state = RSSL_CH_STATE_CLOSED;
+			return RSSL_RET_FAILURE;
+		}
+	}
+	else
+	{
+		struct stat segStat;
+
+		/* The rings must fill the segment exactly, and the segment must be as large as the server says. */
+		if (!_rsslBidirShMemValidRingSize(handshake.serverRingSize) || !_rsslBidirShMemValidRingSize(handshake.clientRingSize)
+			|| handshake.segmentSize != RSSL_BIDIR_SHM_HEADER_SIZE + RTR_SPSC_RING_MEM_SIZE(handshake.serverRingSize) + RTR_SPSC_RING_MEM_SIZE(handshake.clientRingSize)
+			|| fstat(fd, &segStat) < 0 || (RsslUInt64)segStat.st_size < handshake.segmentSize)
+		{
+			close(fd);
+			_rsslSetError(error, &rsslChnlImpl->Channel, RSSL_RET_FAILURE, 0);
+			snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslInitChannel() Error: 1002 The server sent an invalid shared memory segment.\n", __FILE__, __LINE__);
+			rsslChnlImpl->Channel.state = RSSL_CH_STATE_CLOSED;
+			return RSSL_RET_FAILURE;
+		}
+
+		pChannel->segmentSize = (size_t)handshake.segmentSize;
+		pChannel->segment = (char*)mmap(NULL, pChannel->segmentSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+		close(fd);
+
+		if (pChannel->segment == MAP_FAILED)
+		{
+			pChannel->segment = NULL;
+			_rsslSetError(error, &rsslChnlImpl->Channel, RSSL_RET_FAILURE, errno);
+			snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslInitChannel() Error: 1002 Could not map the shared memory segment. System errno: (%d)\n", __FILE__, __LINE__, errno);
+			rsslChnlImpl->Channel.state = RSSL_CH_STATE_CLOSED;
+			return RSSL_RET_FAILURE;
+		}
+
+		_rsslBidirShMemAttachRings(pChannel, handshake.serverRingSize, handshake.clientRingSize);
+		_rsslBidirShMemGetComponentVersion(pChannel, &handshake);
+
+		/* the server dictates the ping timeout and message size */
+		rsslChnlImpl->maxMsgSize = handshake.maxMsgSize;
+		rsslChnlImpl->maxGuarMsgs = pChannel->guaranteedOutputBuffers;
+		rsslChnlImpl->rsslFlags = (int)handshake.rsslFlags;
+		rsslChnlImpl->Channel.pingTimeout = handshake.pingTimeout;
+		rsslChnlImpl->Channel.majorVersion = handshake.majorVersion;
+		rsslChnlImpl->Channel.minorVersion = handshake.minorVersion;
+	}
+
+	pChannel->state = RSSL_BIDIR_SHM_ACTIVE;
+	rsslChnlImpl->Channel.state = RSSL_CH_STATE_ACTIVE;
+	return RSSL_RET_SUCCESS;
+#else
+	return RSSL_RET_FAILURE;
+#endif
+}
+
+/* rssl BidirShMem CloseChannel */
+RsslRet rsslBidirShMemCloseChannel(rsslChannelImpl* rsslChnlImpl, RsslError *error)
+{
+#ifdef LINUX
+	RsslBidirShMemChannel *pChannel = (RsslBidirShMemChannel*)rsslChnlImpl->transportInfo;
+
+	if (!pChannel)
+	{
+		_rsslSetError(error, 0, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslBidirShMemCloseChannel failed due to no shared memory transport.\n", __FILE__, __LINE__);
+		return RSSL_RET_FAILURE;
+	}
+
+	rsslChnlImpl->Channel.state = RSSL_CH_STATE_INACTIVE;
+
+	if (pChannel->segment)
+	{
+		/* The other side sees the flag once it has read everything, or gets end of file on the socket while it waits. */
+		(void)__atomic_fetch_or(&pChannel->header->closedFlags, (pChannel->isServer ? RSSL_BIDIR_SHM_SERVER_CLOSED : RSSL_BIDIR_SHM_CLIENT_CLOSED), __ATOMIC_RELEASE);
+		_rsslBidirShMemSignal(rsslChnlImpl);
+		munmap(pChannel->segment, pChannel->segmentSize);
+	}
+
+	close(rsslChnlImpl->Channel.socketId);
+	rsslChnlImpl->Channel.socketId = RIPC_INVALID_SOCKET;
+
+	_rsslFree(pChannel);
+	rsslChnlImpl->transportInfo = 0;
+	rsslChnlImpl->transportServerInfo = 0;
+
+	/* Release memory allocated by rsslBidirShMemAccept */
+	if (rsslChnlImpl->Channel.clientHostname)
+	{
+		_rsslFree(rsslChnlImpl->Channel.clientHostname);
+		rsslChnlImpl->Channel.clientHostname = 0;
+	}
+
+	if (rsslChnlImpl->Channel.clientIP)
+	{
+		_rsslFree(rsslChnlImpl->Channel.clientIP);
+		rsslChnlImpl->Channel.clientIP = 0;
+	}
+
+	if (rsslChnlImpl->componentInfo)
+	{
+		_rsslFree(rsslChnlImpl->componentInfo[0]);
+		_rsslFree(rsslChnlImpl->componentInfo);
+		rsslChnlImpl->componentInfo = 0;
+	}
+#endif
+
+	return RSSL_RET_SUCCESS;
+}
+
+/* rssl BidirShMem read */
+/* Messages are returned in place. The record stays in the ring until the next read. */
+RSSL_RSSL_BIDIRECTION_SHMEM_IMPL_FAST(RsslBuffer*) rsslBidirShMemRead(rsslChannelImpl* rsslChnlImpl, RsslReadOutArgs *readOutArgs, RsslRet *readRet, RsslError *error)
+{
+#ifdef LINUX
+	RsslBidirShMemChannel *pChannel = (RsslBidirShMemChannel*)rsslChnlImpl->transportInfo;
+	rtrSpscRecord *record;
+	char *data;
+	RsslBuffer *retBuf = NULL;
+
+	if (multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL)
+	{
+	  if (RSSL_MUTEX_LOCK(&rsslChnlImpl->chanReadMutex))
+	  {
+		*readRet = RSSL_RET_READ_IN_PROGRESS;
+		return NULL;
+	  }
+	}
+
+	if ((record = pChannel->readRecord) != NULL && pChannel->unpackOffset >= pChannel->inRing.recordLength)
+	{
+		rtrSpscRingRelease(&pChannel->inRing, record);
+		pChannel->readRecord = record = NULL;
+
+		/* Cheap check; a writer that is missed here is signaled once the ring is empty. */
+		if (rtrUnlikely(pChannel->inRing.ctrl->writerWaiting) && rtrSpscRingWriterWaiting(&pChannel->inRing))
+			_rsslBidirShMemSignal(rsslChnlImpl);
+	}
+
+	if (record == NULL)
+	{
+		if ((record = rtrSpscRingPeek(&pChannel->inRing)) == NULL)
+		{
+			retBuf = _rsslBidirShMemReadEmpty(rsslChnlImpl, pChannel, readRet, error);
+			if (multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL)
+			  (void) RSSL_MUTEX_UNLOCK(&rsslChnlImpl->chanReadMutex);
+			return retBuf;
+		}
+
+		pChannel->idleReads = 0;
+
+		if (rtrUnlikely(pChannel->inRing.recordFlags & RTR_SPSC_REC_PING))
+		{
+			rtrSpscRingRelease(&pChannel->inRing, record);
+			if (multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL)
+			  (void) RSSL_MUTEX_UNLOCK(&rsslChnlImpl->chanReadMutex);
+			*readRet = RSSL_RET_READ_PING;
+			return NULL;	/* we read a ping, but we return it as a NULL buffer */
+		}
+
+		pChannel->readRecord = record;
+		pChannel->unpackOffset = 0;
+	}
+
+	data = (char*)(record + 1);
+	if (pChannel->inRing.recordFlags & RTR_SPSC_REC_PACKED)
+	{
+		RsslUInt32 remaining = pChannel->inRing.recordLength - pChannel->unpackOffset;
+		RsslUInt16 msgLength = 0;
+
+		data += pChannel->unpackOffset;
+		if (remaining >= RSSL_BIDIR_SHM_PACK_HDR_LEN)
+			rwfGet16(msgLength, data);
+
+		if (rtrUnlikely(remaining < RSSL_BIDIR_SHM_PACK_HDR_LEN || msgLength > remaining - RSSL_BIDIR_SHM_PACK_HDR_LEN))
+		{
+			pChannel->inRing.corrupt = RSSL_TRUE;
+			retBuf = _rsslBidirShMemReadCorrupt(rsslChnlImpl, readRet, error);
+			if (multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL)
+			  (void) RSSL_MUTEX_UNLOCK(&rsslChnlImpl->chanReadMutex);
+			return retBuf;
+		}
+
+		rsslChnlImpl->returnBuffer.data = data + RSSL_BIDIR_SHM_PACK_HDR_LEN;
+		rsslChnlImpl->returnBuffer.length = msgLength;
+		pChannel->unpackOffset += msgLength + RSSL_BIDIR_SHM_PACK_HDR_LEN;
+	}
+	else
+	{
+		rsslChnlImpl->returnBuffer.data = data;
+		rsslChnlImpl->returnBuffer.length = pChannel->inRing.recordLength;
+		pChannel->unpackOffset = pChannel->inRing.recordLength;
+	}
+
+	*readRet = _rsslBidirShMemMoreToRead(rsslChnlImpl, pChannel);
+
+	if (multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL)
+	  (void) RSSL_MUTEX_UNLOCK(&rsslChnlImpl->chanReadMutex);
+
+	readOutArgs->bytesRead = rsslChnlImpl->returnBuffer.length;
+	readOutArgs->uncompressedBytesRead = rsslChnlImpl->returnBuffer.length;
+
+	if (rtrUnlikely((rsslChnlImpl->debugFlags & RSSL_DEBUG_RSSL_DUMP_IN) && (rsslChnlImpl->returnBuffer.length)))
+		(*(rsslBidirShMemDumpInFunc))(__FUNCTION__, rsslChnlImpl->returnBuffer.data, rsslChnlImpl->returnBuffer.length, rsslChnlImpl->Channel.socketId);
+
+	return &(rsslChnlImpl->returnBuffer);
+#else
+	*readRet = RSSL_RET_FAILURE;
+	return NULL;
+#endif
+}
+
+/* rssl BidirShMem Write */
+RSSL_RSSL_BIDIRECTION_SHMEM_IMPL_FAST(RsslRet) rsslBidirShMemWrite(rsslChannelImpl *rsslChnlImpl, rsslBufferImpl *rsslBufImpl, RsslWriteInArgs *writeInArgs, RsslWriteOutArgs *writeOutArgs, RsslError *error)
+{
+#ifdef LINUX
+	RsslBidirShMemChannel *pChannel = (RsslBidirShMemChannel*)rsslChnlImpl->transportInfo;
+	rtrSpscRecord *record = (rtrSpscRecord*)rsslBufImpl->bufferInfo;
+	RsslUInt32 length;
+	RsslBool signal;
+
+	if (rsslBufImpl->packingOffset > 0)
+	{
+		/* the remaining space starts after the length of the last message */
+		if (rtrUnlikely(rsslBufImpl->buffer.length > rsslBufImpl->totalLength - rsslBufImpl->packingOffset))
+		{
+			_rsslSetError(error, &rsslChnlImpl->Channel, RSSL_RET_BUFFER_TOO_SMALL, 0);
+			snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslWrite() Error: 0008 Buffer too small - %d bytes written into buffer of %d bytes\n", __FILE__, __LINE__, rsslBufImpl->buffer.length, rsslBufImpl->totalLength - rsslBufImpl->packingOffset);
+			return RSSL_RET_BUFFER_TOO_SMALL;
+		}
+
+		if (rsslBufImpl->buffer.length > 0)
+		{
+			char *lengthPtr = (char*)(record + 1) + rsslBufImpl->packingOffset - RSSL_BIDIR_SHM_PACK_HDR_LEN;
+			RsslUInt16 msgLength = (RsslUInt16)rsslBufImpl->buffer.length;
+
+			rwfPut16(lengthPtr, msgLength);
+			length = rsslBufImpl->packingOffset + rsslBufImpl->buffer.length;
+		}
+		else
+			length = rsslBufImpl->packingOffset - RSSL_BIDIR_SHM_PACK_HDR_LEN;
+	}
+	else
+	{
+		if (rtrUnlikely(rsslBufImpl->buffer.length > rsslBufImpl->totalLength))
+		{
+			_rsslSetError(error, &rsslChnlImpl->Channel, RSSL_RET_BUFFER_TOO_SMALL, 0);
+			snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslWrite() Error: 0008 Buffer too small - %d bytes written into buffer of %d bytes\n", __FILE__, __LINE__, rsslBufImpl->buffer.length, rsslBufImpl->totalLength);
+			return RSSL_RET_BUFFER_TOO_SMALL;
+		}
+		length = rsslBufImpl->buffer.length;
+	}
+
+	writeOutArgs->bytesWritten = length;
+	writeOutArgs->uncompressedBytesWritten = length;
+
+	if (rtrUnlikely((rsslChnlImpl->debugFlags & RSSL_DEBUG_RSSL_DUMP_OUT) && (length)))
+		(*(rsslBidirShMemDumpOutFunc))(__FUNCTION__, (char*)(record + 1), length, rsslChnlImpl->Channel.socketId);
+
+	if (rtrUnlikely(multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL))
+	  (void) RSSL_MUTEX_LOCK(&rsslChnlImpl->chanMutex);
+
+	if (length > 0)
+	{
+		/* gives the unused end back to the ring when this is the latest buffer */
+		rtrSpscRingTrim(&pChannel->outRing, record, length);
+		signal = rtrSpscRingCommit(&pChannel->outRing, record, 0);
+	}
+	else
+		signal = rtrSpscRingDiscard(&pChannel->outRing, record);
+	--pChannel->outstandingBuffers;
+
+	/* since it was a successful write, free the RsslBuffer */
+	/* remove it from the active buffer list and then add to free buffer list */
+	_rsslCleanBuffer(rsslBufImpl);
+	if (rsslQueueLinkInAList(&(rsslBufImpl->link1)))
+		rsslQueueRemoveLink(&(rsslChnlImpl->activeBufferList), &(rsslBufImpl->link1));
+	rsslQueueAddLinkToBack(&(rsslChnlImpl->freeBufferList), &(rsslBufImpl->link1));
+
+	if (rtrUnlikely(multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL))
+	  (void) RSSL_MUTEX_UNLOCK(&rsslChnlImpl->chanMutex);
+
+	if (signal)
+		_rsslBidirShMemSignal(rsslChnlImpl);
+
+	/* always return success(0) since there would never be any bytes left to be written */
+	return RSSL_RET_SUCCESS;
+#else
+	return RSSL_RET_FAILURE;
+#endif
+}
+
+/* rssl BidirShMem GetBuffer */
+RSSL_RSSL_BIDIRECTION_SHMEM_IMPL_FAST(rsslBufferImpl*) rsslBidirShMemGetBuffer(rsslChannelImpl *rsslChnlImpl, RsslUInt32 size, RsslBool packedBuffer, RsslError *error)
+{
+#ifdef LINUX
+	RsslBidirShMemChannel *pChannel = (RsslBidirShMemChannel*)rsslChnlImpl->transportInfo;
+	rsslBufferImpl *rsslBufImpl;
+	rtrSpscRecord *record;
+	RsslUInt32 reserveSize = (packedBuffer ? size + RSSL_BIDIR_SHM_PACK_HDR_LEN : size);
+
+	if (rtrUnlikely(size > rsslChnlImpl->maxMsgSize))
+	{
+		_rsslSetError(error, &rsslChnlImpl->Channel, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslGetBuffer() requested buffer size of %d exceeds the maxMsgSize of %d. Fragmented messages are not supported for shared memory transport.\n", __FILE__, __LINE__, size, rsslChnlImpl->maxMsgSize);
+		return NULL;
+	}
+
+	if (rtrUnlikely(pChannel->header->closedFlags & pChannel->peerClosedFlag))
+	{
+		_rsslSetError(error, &rsslChnlImpl->Channel, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslGetBuffer() Error: 0012 The other side closed the shared memory connection.\n", __FILE__, __LINE__);
+		rsslChnlImpl->Channel.state = RSSL_CH_STATE_CLOSED;
+		return NULL;
+	}
+
+	/* The buffer is taken first, since it needs chanMutex too. */
+	if ((rsslBufImpl = _rsslNewBuffer(rsslChnlImpl)) == NULL)
+	{
+		_rsslSetError(error, &rsslChnlImpl->Channel, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslGetBuffer() could not allocate memory for new buffer\n", __FILE__, __LINE__);
+		return NULL;
+	}
+
+	if (rtrUnlikely(multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL))
+	  (void) RSSL_MUTEX_LOCK(&rsslChnlImpl->chanMutex);
+
+	if (rtrUnlikely((record = rtrSpscRingReserve(&pChannel->outRing, reserveSize)) == NULL)
+		&& (!rtrSpscRingWaitForSpace(&pChannel->outRing, reserveSize) || (record = rtrSpscRingReserve(&pChannel->outRing, reserveSize)) == NULL))
+	{
+		/* the reader signals the socketId once it has emptied the ring */
+		_rsslCleanBuffer(rsslBufImpl);
+		rsslQueueAddLinkToBack(&(rsslChnlImpl->freeBufferList), &(rsslBufImpl->link1));
+		if (rtrUnlikely(multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL))
+		  (void) RSSL_MUTEX_UNLOCK(&rsslChnlImpl->chanMutex);
+
+		_rsslSetError(error, &rsslChnlImpl->Channel, RSSL_RET_BUFFER_NO_BUFFERS, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslGetBuffer() Error: 0005 The shared memory ring is full.\n", __FILE__, __LINE__);
+		return NULL;
+	}
+
+	++pChannel->outstandingBuffers;
+
+	if (rtrUnlikely(multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL))
+	  (void) RSSL_MUTEX_UNLOCK(&rsslChnlImpl->chanMutex);
+
+	rsslBufImpl->bufferInfo = record;
+	rsslBufImpl->totalLength = reserveSize;
+	if (packedBuffer)
+	{
+		/* each packed message is preceded by its 2 byte length */
+		record->flags = RTR_SPSC_REC_PACKED;
+		rsslBufImpl->packingOffset = RSSL_BIDIR_SHM_PACK_HDR_LEN;
+		rsslBufImpl->buffer.data = (char*)(record + 1) + RSSL_BIDIR_SHM_PACK_HDR_LEN;
+	}
+	else
+	{
+		rsslBufImpl->packingOffset = 0;
+		rsslBufImpl->buffer.data = (char*)(record + 1);
+	}
+	rsslBufImpl->buffer.length = size;
+
+	return rsslBufImpl;
+#else
+	return NULL;
+#endif
+}
+
+/* rssl BidirShMem ReleaseBuffer */
+RSSL_RSSL_BIDIRECTION_SHMEM_IMPL_FAST(RsslRet) rsslBidirShMemReleaseBuffer(rsslChannelImpl *rsslChnlImpl, rsslBufferImpl *rsslBufImpl, RsslError *error)
+{
+#ifdef LINUX
+	RsslBidirShMemChannel *pChannel = (RsslBidirShMemChannel*)rsslChnlImpl->transportInfo;
+	RsslBool signal;
+
+	if (rtrUnlikely(!pChannel || !rsslBufImpl->bufferInfo))
+		return RSSL_RET_SUCCESS;
+
+	if (rtrUnlikely(multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL))
+	  (void) RSSL_MUTEX_LOCK(&rsslChnlImpl->chanMutex);
+
+	/* later buffers may already be written; they are published once this one is out of the way */
+	signal = rtrSpscRingDiscard(&pChannel->outRing, (rtrSpscRecord*)rsslBufImpl->bufferInfo);
+	--pChannel->outstandingBuffers;
+
+	if (rtrUnlikely(multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL))
+	  (void) RSSL_MUTEX_UNLOCK(&rsslChnlImpl->chanMutex);
+
+	if (signal)
+		_rsslBidirShMemSignal(rsslChnlImpl);
+#endif
+
+	return RSSL_RET_SUCCESS;
+}
+
+/* rssl BidirShMem PackBuffer */
+RSSL_RSSL_BIDIRECTION_SHMEM_IMPL_FAST(RsslBuffer*) rsslBidirShMemPackBuffer(rsslChannelImpl *rsslChnlImpl, rsslBufferImpl *rsslBufImpl, RsslError *error)
+{
+#ifdef LINUX
+	char *data = (char*)((rtrSpscRecord*)rsslBufImpl->bufferInfo + 1);
+	char *lengthPtr;
+	RsslUInt16 msgLength;
+
+	if (rtrUnlikely(rsslBufImpl->buffer.length > rsslBufImpl->totalLength - rsslBufImpl->packingOffset))
+	{
+		_rsslSetError(error, &rsslChnlImpl->Channel, RSSL_RET_INVALID_ARGUMENT, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslPackBuffer() Error: 0008 Indicated buffer length is longer than allocated transport buffer length.\n", __FILE__, __LINE__);
+		return NULL;
+	}
+
+	/* packing offset is set to immediately after the length, so we write the 2 byte length on the 2 previous bytes */
+	lengthPtr = data + rsslBufImpl->packingOffset - RSSL_BIDIR_SHM_PACK_HDR_LEN;
+	msgLength = (RsslUInt16)rsslBufImpl->buffer.length;
+	rwfPut16(lengthPtr, msgLength);
+	rsslBufImpl->packingOffset += rsslBufImpl->buffer.length + RSSL_BIDIR_SHM_PACK_HDR_LEN;
+
+	if (rsslBufImpl->packingOffset < rsslBufImpl->totalLength)
+	{
+		rsslBufImpl->buffer.data = data + rsslBufImpl->packingOffset;
+		rsslBufImpl->buffer.length = rsslBufImpl->totalLength - rsslBufImpl->packingOffset;
+	}
+	else
+	{
+		rsslBufImpl->buffer.data = 0;		/* tell them there is no room left */
+		rsslBufImpl->buffer.length = 0;
+	}
+
+	return &(rsslBufImpl->buffer);
+#else
+	return NULL;
+#endif
+}
+
+/* rssl BidirShMem Flush */
+/* Since we are writing directly to memory, we dont need to flush. All written messages are available to read immediately */
+RSSL_RSSL_BIDIRECTION_SHMEM_IMPL_FAST(RsslRet) rsslBidirShMemFlush(rsslChannelImpl *rsslChnlImpl, RsslError *error)
+{
+	return RSSL_RET_SUCCESS;
+}
+
+/* rssl BidirShMem Ping */
+RSSL_RSSL_BIDIRECTION_SHMEM_IMPL_FAST(RsslRet) rsslBidirShMemPing(rsslChannelImpl *rsslChnlImpl, RsslError *error)
+{
+#ifdef LINUX
+	RsslBidirShMemChannel *pChannel = (RsslBidirShMemChannel*)rsslChnlImpl->transportInfo;
+	rtrSpscRecord *record;
+	RsslBool signal = RSSL_FALSE;
+
+	if (rtrUnlikely(multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL))
+	  (void) RSSL_MUTEX_LOCK(&rsslChnlImpl->chanMutex);
+
+	/* a full ring means the reader has messages to show that we are alive */
+	if ((record = rtrSpscRingReserve(&pChannel->outRing, 0)) != NULL)
+		signal = rtrSpscRingCommit(&pChannel->outRing, record, RTR_SPSC_REC_PING);
+
+	if (rtrUnlikely(multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL))
+	  (void) RSSL_MUTEX_UNLOCK(&rsslChnlImpl->chanMutex);
+
+	if (signal)
+		_rsslBidirShMemSignal(rsslChnlImpl);
+#endif
+
+	return RSSL_RET_SUCCESS;
+}
+
+/* rssl BidirShMem GetChannelInfo */
+RSSL_RSSL_BIDIRECTION_SHMEM_IMPL_FAST(RsslRet) rsslBidirShMemGetChannelInfo(rsslChannelImpl *rsslChnlImpl, RsslChannelInfo *info, RsslError *error)
+{
+#ifdef LINUX
+	RsslBidirShMemChannel *pChannel = (RsslBidirShMemChannel*)rsslChnlImpl->transportInfo;
+	RsslUInt32 recordSize = RTR_SPSC_RECORD_SIZE(rsslChnlImpl->maxMsgSize + RSSL_BIDIR_SHM_PACK_HDR_LEN);
+
+	if (rtrUnlikely(!pChannel || !pChannel->segment))
+	{
+		_rsslSetError(error, 0, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslBidirShMemGetChannelInfo failed due to no shared memory transport.\n", __FILE__, __LINE__);
+		return RSSL_RET_FAILURE;
+	}
+
+	/* clears the fields not used by shmem connection, including the multicast stats */
+	memset(info, 0, sizeof(RsslChannelInfo));
+
+	info->maxFragmentSize = rsslChnlImpl->maxMsgSize;
+	info->guaranteedOutputBuffers = (RsslUInt32)(pChannel->outRing.capacity / recordSize);
+	info->maxOutputBuffers = info->guaranteedOutputBuffers;
+	info->numInputBuffers = (RsslUInt32)(pChannel->inRing.capacity / recordSize);
+	info->sysSendBufSize = (RsslUInt32)pChannel->outRing.capacity;
+	info->sysRecvBufSize = (RsslUInt32)pChannel->inRing.capacity;
+	info->compressionType = RSSL_COMP_NONE;	/* we dont support compression with shmem connection */
+	info->pingTimeout = rsslChnlImpl->Channel.pingTimeout;
+	info->serverToClientPings = (rsslChnlImpl->rsslFlags & SERVER_TO_CLIENT) ? RSSL_TRUE : RSSL_FALSE;
+	info->clientToServerPings = (rsslChnlImpl->rsslFlags & CLIENT_TO_SERVER) ? RSSL_TRUE : RSSL_FALSE;
+	info->encryptionProtocol = RSSL_ENC_NONE;
+
+	/* get connected component version info here */
+	/* if memory is here, it means user already called get channel info so just reuse it.  it will be cleaned up when connection is closed */
+	if (pChannel->peerComponentVersionLength)
+	{
+		if (!rsslChnlImpl->componentInfo)
+		{
+			rsslChnlImpl->componentInfo = (RsslComponentInfo **)_rsslMalloc(sizeof(void*));
+			rsslChnlImpl->componentInfo[0] = (RsslComponentInfo *)_rsslMalloc(sizeof(RsslComponentInfo));
+		}
+		rsslChnlImpl->componentInfo[0]->componentVersion.length = pChannel->peerComponentVersionLength;
+		rsslChnlImpl->componentInfo[0]->componentVersion.data = pChannel->peerComponentVersion;
+
+		info->componentInfoCount = 1;
+		info->componentInfo = rsslChnlImpl->componentInfo;
+	}
+
+	return RSSL_RET_SUCCESS;
+#else
+	return RSSL_RET_FAILURE;
+#endif
+}
+
+/* rssl BidirShMem GetServerInfo */
+/* buffers come from each channel's ring, so the server has no buffer usage of its own */
+RSSL_RSSL_BIDIRECTION_SHMEM_IMPL_FAST(RsslRet) rsslBidirShMemGetSrvrInfo(rsslServerImpl *rsslSrvrImpl, RsslServerInfo *info, RsslError *error)
+{
+	info->currentBufferUsage = 0;
+	info->peakBufferUsage = 0;
+	info->threadCacheHits = 0;
+	info->threadCacheMisses = 0;
+
+	return RSSL_RET_SUCCESS;
+}
+
+/* rssl BidirShMem Buffer Usage */
+RSSL_RSSL_BIDIRECTION_SHMEM_IMPL_FAST(RsslInt32) rsslBidirShMemBufferUsage(rsslChannelImpl *rsslChnlImpl, RsslError *error)
+{
+#ifdef LINUX
+	RsslBidirShMemChannel *pChannel = (RsslBidirShMemChannel*)rsslChnlImpl->transportInfo;
+
+	if (pChannel)
+		return pChannel->outstandingBuffers;
+#endif
+
+	_rsslSetError(error, 0, RSSL_RET_FAILURE, 0);
+	snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslBidirShMemBufferUsage failed due to no shared memory transport.\n", __FILE__, __LINE__);
+	return RSSL_RET_FAILURE;
+}
+
+/* get info about the shared buffer pool. */
+RSSL_RSSL_BIDIRECTION_SHMEM_IMPL_FAST(RsslInt32) rsslBidirShMemSrvrBufferUsage(rsslServerImpl *rsslSrvrImpl, RsslError *error)
+{
+	/* shmem doesnt used a shared buffer pool */
+	return 0;
+}
+
+RSSL_RSSL_BIDIRECTION_SHMEM_IMPL_FAST(RsslRet) rsslBidirShMemSrvrIoctl(rsslServerImpl *rsslSrvrImpl, RsslIoctlCodes code, void *value, RsslError *error)
+{
+	return RSSL_RET_SUCCESS;
+}
+
+RSSL_RSSL_BIDIRECTION_SHMEM_IMPL_FAST(RsslRet) rsslBidirShMemCloseServer(rsslServerImpl *rsslSrvrImpl, RsslError *error)
+{
+#ifdef LINUX
+	if (rsslSrvrImpl->transportInfo)
+	{
+		close(rsslSrvrImpl->Server.socketId);
+		rsslSrvrImpl->Server.socketId = RIPC_INVALID_SOCKET;
+		_rsslFree(rsslSrvrImpl->transportInfo);
+		rsslSrvrImpl->transportInfo = 0;
+	}
+#endif
+
+	return RSSL_RET_SUCCESS;
+}
+
+RSSL_RSSL_BIDIRECTION_SHMEM_IMPL_FAST(RsslRet) rsslBidirShMemIoctl(rsslChannelImpl *rsslChnlImpl, RsslIoctlCodes code, void *value, RsslError *error)
+{
+	return RSSL_RET_SUCCESS;
+}
+
+
+
+/***************************
+ * START PUBLIC ABSTRACTED FUNCTIONS
+ ***************************/
+
+RsslRet rsslBidirShMemSetChannelFunctions()
+{
+	RsslTransportChannelFuncs funcs;
+
+	funcs.channelBufferUsage = rsslBidirShMemBufferUsage;
+	funcs.channelClose = rsslBidirShMemCloseChannel;
+	funcs.channelConnect = rsslBidirShMemConnect;
+	funcs.channelFlush = rsslBidirShMemFlush;
+	funcs.channelGetBuffer = rsslBidirShMemGetBuffer;
+	funcs.channelGetInfo = rsslBidirShMemGetChannelInfo;
+	funcs.channelIoctl = rsslBidirShMemIoctl;
+	funcs.channelPackBuffer = rsslBidirShMemPackBuffer;
+	funcs.channelPing = rsslBidirShMemPing;
+	funcs.channelRead = rsslBidirShMemRead;
+	funcs.channelReconnect = rsslBidirShMemReconnect;
+	funcs.channelReleaseBuffer = rsslBidirShMemReleaseBuffer;
+	funcs.channelWrite = rsslBidirShMemWrite;
+	funcs.initChannel = rsslBidirShMemInitChannel;
+
+	return(rsslSetTransportChannelFunc(RSSL_BIDIRECTION_SHMEM_TRANSPORT,&funcs));
+}
+
+RsslRet rsslBidirShMemSetServerFunctions()
+{
+	RsslTransportServerFuncs funcs;
+
+	funcs.serverAccept = rsslBidirShMemAccept;
+	funcs.serverBind = rsslBidirShMemBind;
+	funcs.serverIoctl = rsslBidirShMemSrvrIoctl;
+	funcs.serverGetInfo = rsslBidirShMemGetSrvrInfo;
+	funcs.serverBufferUsage = rsslBidirShMemSrvrBufferUsage;
+	funcs.closeServer = rsslBidirShMemCloseServer;
+
+	return(rsslSetTransportServerFunc(RSSL_BIDIRECTION_SHMEM_TRANSPORT,&funcs));
+}
+
+/* init, uninit, set function pointers */
+RsslRet rsslBidirShMemInitialize(RsslLockingTypes lockingType, RsslError *error)
+{
+	rsslBidirShMemSetServerFunctions();
+	rsslBidirShMemSetChannelFunctions();
+	/* nothing to do for this function for now */
+	return RSSL_RET_SUCCESS;
+}
+
+RsslRet rsslBidirShMemUninitialize()
+{
+	/* nothing to do for this function for now */
+
+	return RSSL_RET_SUCCESS;
+}
+
+/* Sets BidirShMem debug dump functions */
+RsslRet rsslSetBidirShMemDebugFunctions(
+		void(*dumpRsslIn)(const char *functionName, char *buffer, RsslUInt32 length, RsslSocket socketId),
+		void(*dumpRsslOut)(const char *functionName, char *buffer, RsslUInt32 length, RsslSocket socketId),
+		RsslError *error)
+{
+	RsslRet retVal = 0;
+
+	if ((dumpRsslIn && rsslBidirShMemDumpInFunc) || (dumpRsslOut && rsslBidirShMemDumpOutFunc))
+	{
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslSetDebugFunctions() Cannot set bidirectional shared memory Rssl dump functions.\n", __FILE__, __LINE__);
+
+		retVal = RSSL_RET_FAILURE;
+	}
+	else
+	{
+		rsslBidirShMemDumpInFunc = dumpRsslIn;
+		rsslBidirShMemDumpOutFunc = dumpRsslOut;
+		retVal = RSSL_RET_SUCCESS;
+	}
+
+	return retVal;
+}
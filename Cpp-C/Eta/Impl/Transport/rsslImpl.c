@@ -11,6 +11,7 @@
 #include "rtr/intDataTypes.h"
 #include "rtr/rsslUniShMemTransport.h"
 #include "rtr/rsslSeqMcastTransport.h"
+#include "rtr/rsslBidirShMemTransport.h"
 #include "rtr/rsslQueue.h"
 
 #include "rtr/rsslMessagePackage.h"
@@ -43,7 +44,9 @@
 #include "rtr/rsslSeqMcastTransportImpl.h"
 #include "rtr/rsslSocketTransportImpl.h"
 #include "rtr/rsslUniShMemTransportImpl.h"
+#include "rtr/rsslBidirShMemTransportImpl.h"
 #include "rtr/rsslLoadInitTransport.h"
+#include "rtr/rsslTraceCapture.h"
 
 /* globals */
 static void(*rsslDumpInFunc)(const char *functionName, char *buffer, RsslUInt32 length, RsslSocket socketId) = 0;
@@ -165,6 +168,7 @@ RTR_C_ALWAYS_INLINE rsslChannelImpl *_rsslCreateChannel()
 	if (multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL)
 	{
 	  (void) RSSL_MUTEX_INIT_RTSDK( &chnl->chanMutex );
+	  (void) RSSL_MUTEX_INIT_RTSDK( &chnl->chanReadMutex );
 	}
 	(void) RSSL_MUTEX_INIT_RTSDK( &chnl->traceMutex );
 
@@ -435,7 +439,10 @@ void _rsslCleanUp()
 
 		/* destroy the mutex */
 		if (multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL)
+		{
 		  (void) RSSL_MUTEX_DESTROY(&chnl->chanMutex);
+		  (void) RSSL_MUTEX_DESTROY(&chnl->chanReadMutex);
+		}
 
 		(void) RSSL_MUTEX_DESTROY(&chnl->traceMutex);
 		/* since its on the free list, its list of buffers should be empty */
@@ -501,7 +508,35 @@ typedef enum {
 	traceWrite = 2,
 	tracePack = 3,
 	traceDump = 4
-} traceOperation;
+} traceOperation;		/* The values match RsslCaptureDirections */
+
+/* Copies a message into the channel's binary capture. */
+static void _rsslTraceCaptureMsg(rsslChannelImpl *rsslChnlImpl, RsslUInt32 protocolType, RsslBuffer *buffer, traceOperation op)
+{
+	rsslBufferImpl *pRsslBufferImpl = (rsslBufferImpl *)buffer;
+	RsslBuffer captureBuffer = *buffer;
+
+	if (protocolType == RSSL_JSON_PROTOCOL_TYPE && buffer->length == 0 && pRsslBufferImpl->packingOffset > 1) // Indicates packed buffer
+	{
+		rtr_msgb_t *ripcBuffer = (rtr_msgb_t*)(pRsslBufferImpl->bufferInfo);
+
+		if (ripcBuffer)
+		{
+			captureBuffer.data = ripcBuffer->buffer + 1;
+			captureBuffer.length = pRsslBufferImpl->packingOffset - 2;
+		}
+	}
+
+	/* Nothing was added to a packed buffer after the last message packed into it. */
+	if (captureBuffer.length == 0)
+		return;
+
+	(void) RSSL_MUTEX_LOCK(&rsslChnlImpl->traceMutex);
+	if (rsslChnlImpl->traceOptionsInfo.traceCapture != NULL)
+		rsslTraceCaptureWrite(rsslChnlImpl->traceOptionsInfo.traceCapture, (RsslUInt64)rsslChnlImpl->Channel.socketId, (RsslUInt8)op,
+				(RsslUInt8)protocolType, rsslChnlImpl->Channel.majorVersion, rsslChnlImpl->Channel.minorVersion, &captureBuffer);
+	(void) RSSL_MUTEX_UNLOCK(&rsslChnlImpl->traceMutex);
+}
 
 void _rsslTraceStartMsg(rsslChannelImpl *rsslChnlImpl, RsslUInt32 protocolType, RsslBuffer *buffer, RsslRet *retTrace, traceOperation op, RsslError *error)
 {
@@ -517,6 +552,16 @@ void _rsslTraceStartMsg(rsslChannelImpl *rsslChnlImpl, RsslUInt32 protocolType,
 
 	if (*retTrace == RSSL_RET_FAILURE)
 		return;
+
+	/* With RSSL_TRACE_BINARY, the message is captured instead of being written to the file as XML. */
+	if (rsslChnlImpl->traceOptionsInfo.traceCapture != NULL)
+	{
+		if (*retTrace >= RSSL_RET_SUCCESS || *retTrace == RSSL_RET_WRITE_CALL_AGAIN)
+			_rsslTraceCaptureMsg(rsslChnlImpl, protocolType, buffer, op);
+
+		if (!(rsslChnlImpl->traceOptionsInfo.traceOptions.traceFlags & RSSL_TRACE_TO_STDOUT))
+			return;
+	}
 	
 	(void) RSSL_MUTEX_LOCK(&rsslChnlImpl->traceMutex);
 	if(rsslChnlImpl->traceOptionsInfo.traceMsgFilePtr != NULL)
@@ -650,6 +695,10 @@ void _rsslTraceEndMsg(rsslChannelImpl *rsslChnlImpl, RsslRet *retTrace, RsslBool
 {
 	char message[128];
 
+	/* nothing is traced as XML when only a binary capture is written */
+	if (rsslChnlImpl->traceOptionsInfo.traceMsgFilePtr == NULL && !(rsslChnlImpl->traceOptionsInfo.traceOptions.traceFlags & RSSL_TRACE_TO_STDOUT))
+		return;
+
 	/* we only need to log these on rsslWrite calls because the message is dumped before the call to rsslWrite */
 	(void) RSSL_MUTEX_LOCK(&rsslChnlImpl->traceMutex);
 	if (!isRead)
@@ -795,6 +844,15 @@ RsslRet rsslInitializeEx(RsslInitializeExOpts *rsslInitOpts, RsslError *error)
 			return retVal;
 		}
 
+		/* initialize bidirectional shmem transport */
+		retVal = rsslBidirShMemInitialize(rsslInitOpts->rsslLocking, error);
+
+		if (retVal < RSSL_RET_SUCCESS)
+		{
+			mutexFuncs.staticMutexUnlock();	
+			return retVal;
+		}
+
 		/* Done initializing all transports */
 
 		/* Initialize lists */
@@ -879,6 +937,13 @@ RsslRet rsslSetDebugFunctions(
 			snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslSetSeqMcastDebugFunctions() Cannot set Rssl sequence multicast dump functions.\n", __FILE__, __LINE__);
 			retVal = RSSL_RET_FAILURE;
 		}
+
+		if (rsslSetBidirShMemDebugFunctions(dumpRsslIn, dumpRsslOut, error) < RSSL_RET_SUCCESS)
+		{
+			_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+			snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslSetBidirShMemDebugFunctions() Cannot set Rssl bidirectional shared memory dump functions.\n", __FILE__, __LINE__);
+			retVal = RSSL_RET_FAILURE;
+		}
 	}
 	
 	mutexFuncs.staticMutexUnlock();
@@ -993,6 +1058,12 @@ RsslServer* rsslBind(RsslBindOptions *opts, RsslError *error)
 			rsslSrvrImpl->channelFuncs = &(channelTransFuncs[RSSL_UNIDIRECTION_SHMEM_TRANSPORT]);
 		}
 		break;
+		case RSSL_CONN_TYPE_BIDIR_SHMEM:
+		{
+			rsslSrvrImpl->serverFuncs = &(serverTransFuncs[RSSL_BIDIRECTION_SHMEM_TRANSPORT]);
+			rsslSrvrImpl->channelFuncs = &(channelTransFuncs[RSSL_BIDIRECTION_SHMEM_TRANSPORT]);
+		}
+		break;
 		case RSSL_CONN_TYPE_RELIABLE_MCAST:
 		{
 			_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
@@ -1172,6 +1243,10 @@ RsslChannel* rsslConnect(RsslConnectOptions *opts, RsslError *error)
 			rsslChnlImpl->channelFuncs = &(channelTransFuncs[RSSL_UNIDIRECTION_SHMEM_TRANSPORT]);
 		break;
 
+		case RSSL_CONN_TYPE_BIDIR_SHMEM:
+			rsslChnlImpl->channelFuncs = &(channelTransFuncs[RSSL_BIDIRECTION_SHMEM_TRANSPORT]);
+		break;
+
 	    case RSSL_CONN_TYPE_RELIABLE_MCAST:
 		{
 			if (rsslLoadInitRsslTransportChannel(&(channelTransFuncs[RSSL_RRCP_TRANSPORT]), DEFAULT_RRCP_LIB_NAME, (void*)(&multiThread)) < 0)
@@ -1413,6 +1488,10 @@ RsslRet rsslCloseChannel(RsslChannel *chnl, RsslError *error)
 	{
 		fclose(rsslChnlImpl->traceOptionsInfo.traceMsgFilePtr);
 	}
+	if(rsslChnlImpl->traceOptionsInfo.traceCapture != NULL)
+	{
+		rsslTraceCaptureClose(rsslChnlImpl->traceOptionsInfo.traceCapture);
+	}
 	if(rsslChnlImpl->traceOptionsInfo.traceOptions.traceMsgFileName != NULL)
 	{
 		free(rsslChnlImpl->traceOptionsInfo.traceOptions.traceMsgFileName);
@@ -1454,14 +1533,27 @@ RsslRet rsslServerIoctl(RsslServer *srvr, RsslIoctlCodes code, void *value, Rssl
 	return ((*(rsslSrvrImpl->serverFuncs->serverIoctl))(rsslSrvrImpl, code, value, error));
 }
 
-static void closeTraceMsgFile(RsslTraceOptionsInfo *traceOptionsInfo)
+static void closeTraceMsgFile(rsslChannelImpl *rsslChnlImpl)
 {
+	RsslTraceOptionsInfo *traceOptionsInfo = &rsslChnlImpl->traceOptionsInfo;
+
 	/* free memory and close file descriptors associated with the trace options */
 	if (traceOptionsInfo->traceMsgFilePtr != 0)
 	{
 		fclose(traceOptionsInfo->traceMsgFilePtr);
 		traceOptionsInfo->traceMsgFilePtr = 0;
 	}
+	if (traceOptionsInfo->traceCapture != NULL)
+	{
+		rsslTraceCapture *traceCapture = traceOptionsInfo->traceCapture;
+
+		/* another thread may be capturing a message on this channel */
+		(void) RSSL_MUTEX_LOCK(&rsslChnlImpl->traceMutex);
+		traceOptionsInfo->traceCapture = NULL;
+		(void) RSSL_MUTEX_UNLOCK(&rsslChnlImpl->traceMutex);
+
+		rsslTraceCaptureClose(traceCapture);
+	}
 	if (traceOptionsInfo->traceOptions.traceMsgFileName != NULL)
 	{
 		free(traceOptionsInfo->traceOptions.traceMsgFileName);
@@ -1528,13 +1620,13 @@ RsslRet rsslIoctl(RsslChannel *chnl, RsslIoctlCodes code, void *value, RsslError
 				/* check if file tracing is being disabled */
 				if (!(traceOptions->traceFlags & RSSL_TRACE_TO_FILE_ENABLE))
 				{
-					closeTraceMsgFile(&rsslChnlImpl->traceOptionsInfo);
+					closeTraceMsgFile(rsslChnlImpl);
 					return RSSL_RET_SUCCESS;
 				}
 
 				if (traceOptions->traceMsgFileName == NULL)
 				{
-					if (rsslChnlImpl->traceOptionsInfo.traceMsgFilePtr == NULL)
+					if (rsslChnlImpl->traceOptionsInfo.traceMsgFilePtr == NULL && rsslChnlImpl->traceOptionsInfo.traceCapture == NULL)
 					{
 						/* user is attempting to enable file tracing for the first time without specifying a file name*/
 						return RSSL_RET_FAILURE;
@@ -1551,12 +1643,17 @@ RsslRet rsslIoctl(RsslChannel *chnl, RsslIoctlCodes code, void *value, RsslError
 					/* the user wants to change the output file for the XML trace. */
 					needNewFile = 1;
 				}
+				else if ((rsslChnlImpl->traceOptionsInfo.traceCapture != NULL) != ((traceOptions->traceFlags & RSSL_TRACE_BINARY) != 0))
+				{
+					/* the user wants to switch between the XML trace and the binary capture */
+					needNewFile = 1;
+				}
 
 				if (needNewFile)
 				{
 					rtrUInt32 allocated;
 
-					closeTraceMsgFile(&rsslChnlImpl->traceOptionsInfo);
+					closeTraceMsgFile(rsslChnlImpl);
 
 					/* deep copy of traceMsgFileName */
 					allocated = rsslChnlImpl->traceOptionsInfo.traceMsgOrigFileNameSize = (rtrUInt32)strlen(traceOptions->traceMsgFileName);
@@ -1584,10 +1681,27 @@ RsslRet rsslIoctl(RsslChannel *chnl, RsslIoctlCodes code, void *value, RsslError
 
 					/* add timestamp to the file's name */
 					xmlGetTimeFromEpoch(&hour, &min, &sec, &msec);
-					numChars = snprintf(timeVal, TIME_STAMP_SIZE, "%03llu.xml", msec);
+					numChars = snprintf(timeVal, TIME_STAMP_SIZE, (traceOptions->traceFlags & RSSL_TRACE_BINARY) ? "%03llu.rwfcap" : "%03llu.xml", msec);
 					memcpy(rsslChnlImpl->traceOptionsInfo.newTraceMsgFileName + rsslChnlImpl->traceOptionsInfo.traceMsgOrigFileNameSize, timeVal, numChars);
 					rsslChnlImpl->traceOptionsInfo.newTraceMsgFileName[rsslChnlImpl->traceOptionsInfo.traceMsgOrigFileNameSize + numChars * sizeof(char)] = '\0';
 
+					if (traceOptions->traceFlags & RSSL_TRACE_BINARY)
+					{
+						rsslTraceCapture *traceCapture = rsslTraceCaptureOpen(rsslChnlImpl->traceOptionsInfo.newTraceMsgFileName, rsslChnlImpl->traceOptionsInfo.traceOptions.traceMsgFileName,
+								traceOptions->traceMsgMaxFileSize, (traceOptions->traceFlags & RSSL_TRACE_TO_MULTIPLE_FILES) ? RSSL_TRUE : RSSL_FALSE, error);
+
+						if (traceCapture == NULL)
+						{
+							error->channel = chnl;
+							return RSSL_RET_FAILURE;
+						}
+
+						(void) RSSL_MUTEX_LOCK(&rsslChnlImpl->traceMutex);
+						rsslChnlImpl->traceOptionsInfo.traceCapture = traceCapture;
+						(void) RSSL_MUTEX_UNLOCK(&rsslChnlImpl->traceMutex);
+						return RSSL_RET_SUCCESS;
+					}
+
 					rsslChnlImpl->traceOptionsInfo.traceMsgFilePtr = fopen(rsslChnlImpl->traceOptionsInfo.newTraceMsgFileName, "a+");
 
 					if (rsslChnlImpl->traceOptionsInfo.traceMsgFilePtr == NULL)
@@ -2173,6 +2287,7 @@ RsslRet rsslUninitialize()
 		/* uninitialize various transports */
 		rsslSocketUninitialize();
 		rsslUniShMemUninitialize();
+		rsslBidirShMemUninitialize();
 
 		/* Unset the flag here as it is needed by rsslSocketUninitialize()*/
 		multiThread = 0;
@@ -13,6 +13,7 @@
 #include "rtr/retmacros.h"
 #include "decodeRoutines.h"
 #include "xmlDump.h"
+#include "rtr/rsslGetTime.h"
 #include <time.h>
 
 #include <sys/timeb.h>
@@ -63,6 +64,11 @@
 
 #endif
 
+/* recvmmsg() and sendmmsg() move a batch of packets with a single system call. */
+#if defined(LINUX) && defined(MSG_WAITFORONE)
+#define SEQ_MCAST_HAS_MMSG
+#endif
+
 #define SEQ_MCAST_MAX_VERSION 0x01
 
 #define SEQ_MCAST_SEQUENCE_NUM_LEN 4
@@ -84,6 +90,9 @@
 /* Ping length is the total number of bytes in the header, minus the message length. */
 #define SEQ_MCAST_PING_LEN 12
 
+/* Largest read or write batch. This is the kernel's limit for a single recvmmsg() or sendmmsg() call (UIO_MAXIOV). */
+#define SEQ_MCAST_MAX_BATCH_SIZE 1024
+
 typedef struct
 {
 	RsslMutex			lock;
@@ -107,6 +116,26 @@ typedef struct
 	struct sockaddr_in	sendAddr;
 	struct sockaddr_in	recvAddr;
 	rtrSeqMcastBuffer	writeBuffer;
+	RsslUInt32			packetMemSize;				/* Size of each packet in bufferMem and inputBufferMem */
+	RsslUInt32			readBatchSize;				/* Number of packets in inputBufferMem */
+	RsslUInt32			readCount;					/* Number of packets received by the last read batch */
+	RsslUInt32			readIndex;					/* Next packet of the read batch to process */
+	RsslUInt32			writeBatchSize;				/* Number of packets in bufferMem */
+	RsslUInt32			writeBatchTimeout;			/* Microseconds the first queued packet may wait before the batch is sent, 0 for no limit */
+	RsslUInt32			writeQueued;				/* Number of packets written into bufferMem */
+	RsslUInt32			writeSent;					/* Number of the written packets that have been sent */
+	RsslUInt32			writeQueuedBytes;			/* Bytes written but not sent yet */
+	RsslTimeValue		writeBatchStart;			/* Time the first packet of the batch was queued */
+	RsslBuffer*			writePackets;				/* Packets of the write batch, when writeBatchSize is greater than 1 */
+	RsslUInt64			recvCallCount;
+	RsslUInt64			sendCallCount;
+#ifdef SEQ_MCAST_HAS_MMSG
+	struct mmsghdr*		readMsgs;
+	struct iovec*		readIov;
+	struct sockaddr_in*	readSrcAddrs;
+	struct mmsghdr*		writeMsgs;
+	struct iovec*		writeIov;
+#endif
 } RsslSeqMcastChannel;
 
 
@@ -147,6 +176,177 @@ RTR_C_ALWAYS_INLINE int seqMcastTrylock(RsslMutex *seqMcastLock)
 	return RSSL_MUTEX_TRYLOCK(seqMcastLock);
 }
 
+/* Frees the channel structure and all of its packet memory */
+static void rsslSeqMcastFreeChannel(RsslSeqMcastChannel *pSeqMcastChannel)
+{
+#ifdef SEQ_MCAST_HAS_MMSG
+	_rsslFree(pSeqMcastChannel->readMsgs);
+	_rsslFree(pSeqMcastChannel->readIov);
+	_rsslFree(pSeqMcastChannel->readSrcAddrs);
+	_rsslFree(pSeqMcastChannel->writeMsgs);
+	_rsslFree(pSeqMcastChannel->writeIov);
+#endif
+	_rsslFree(pSeqMcastChannel->writePackets);
+	_rsslFree(pSeqMcastChannel->inputBufferMem);
+	_rsslFree(pSeqMcastChannel->bufferMem);
+	_rsslFree(pSeqMcastChannel);
+}
+
+/* Allocates the read and write batches. Returns RSSL_FALSE if out of memory. */
+static RsslBool rsslSeqMcastAllocBatches(RsslSeqMcastChannel *pSeqMcastChannel)
+{
+	/* Add 7 to avoid any full word byte swap issues at the end of the buffer, then round up so every packet starts on a word */
+	pSeqMcastChannel->packetMemSize = (pSeqMcastChannel->maxMsgSize + SEQ_MCAST_MAX_HDR_LEN + 7 + 7) & ~7;
+
+	if (!(pSeqMcastChannel->bufferMem = (char*)_rsslMalloc((size_t)pSeqMcastChannel->packetMemSize * pSeqMcastChannel->writeBatchSize)))
+		return RSSL_FALSE;
+	if (!(pSeqMcastChannel->inputBufferMem = (char*)_rsslMalloc((size_t)pSeqMcastChannel->packetMemSize * pSeqMcastChannel->readBatchSize)))
+		return RSSL_FALSE;
+
+	if (pSeqMcastChannel->writeBatchSize > 1)
+	{
+		if (!(pSeqMcastChannel->writePackets = (RsslBuffer*)_rsslMalloc(sizeof(RsslBuffer) * pSeqMcastChannel->writeBatchSize)))
+			return RSSL_FALSE;
+	}
+
+#ifdef SEQ_MCAST_HAS_MMSG
+	if (pSeqMcastChannel->readBatchSize > 1)
+	{
+		RsslUInt32 i;
+
+		pSeqMcastChannel->readMsgs = (struct mmsghdr*)_rsslMalloc(sizeof(struct mmsghdr) * pSeqMcastChannel->readBatchSize);
+		pSeqMcastChannel->readIov = (struct iovec*)_rsslMalloc(sizeof(struct iovec) * pSeqMcastChannel->readBatchSize);
+		pSeqMcastChannel->readSrcAddrs = (struct sockaddr_in*)_rsslMalloc(sizeof(struct sockaddr_in) * pSeqMcastChannel->readBatchSize);
+		if (!pSeqMcastChannel->readMsgs || !pSeqMcastChannel->readIov || !pSeqMcastChannel->readSrcAddrs)
+			return RSSL_FALSE;
+
+		memset(pSeqMcastChannel->readMsgs, 0, sizeof(struct mmsghdr) * pSeqMcastChannel->readBatchSize);
+		for (i = 0; i < pSeqMcastChannel->readBatchSize; ++i)
+		{
+			pSeqMcastChannel->readIov[i].iov_base = pSeqMcastChannel->inputBufferMem + (size_t)i * pSeqMcastChannel->packetMemSize;
+			pSeqMcastChannel->readIov[i].iov_len = pSeqMcastChannel->maxMsgSize + SEQ_MCAST_MAX_HDR_LEN;
+			pSeqMcastChannel->readMsgs[i].msg_hdr.msg_iov = &pSeqMcastChannel->readIov[i];
+			pSeqMcastChannel->readMsgs[i].msg_hdr.msg_iovlen = 1;
+			pSeqMcastChannel->readMsgs[i].msg_hdr.msg_name = &pSeqMcastChannel->readSrcAddrs[i];
+		}
+	}
+
+	if (pSeqMcastChannel->writeBatchSize > 1)
+	{
+		RsslUInt32 i;
+
+		pSeqMcastChannel->writeMsgs = (struct mmsghdr*)_rsslMalloc(sizeof(struct mmsghdr) * pSeqMcastChannel->writeBatchSize);
+		pSeqMcastChannel->writeIov = (struct iovec*)_rsslMalloc(sizeof(struct iovec) * pSeqMcastChannel->writeBatchSize);
+		if (!pSeqMcastChannel->writeMsgs || !pSeqMcastChannel->writeIov)
+			return RSSL_FALSE;
+
+		memset(pSeqMcastChannel->writeMsgs, 0, sizeof(struct mmsghdr) * pSeqMcastChannel->writeBatchSize);
+		for (i = 0; i < pSeqMcastChannel->writeBatchSize; ++i)
+		{
+			pSeqMcastChannel->writeMsgs[i].msg_hdr.msg_iov = &pSeqMcastChannel->writeIov[i];
+			pSeqMcastChannel->writeMsgs[i].msg_hdr.msg_iovlen = 1;
+			pSeqMcastChannel->writeMsgs[i].msg_hdr.msg_name = &pSeqMcastChannel->sendAddr;
+			pSeqMcastChannel->writeMsgs[i].msg_hdr.msg_namelen = sizeof(pSeqMcastChannel->sendAddr);
+		}
+	}
+#endif
+
+	return RSSL_TRUE;
+}
+
+/* Receives the next packet into pSeqMcastChannel->inputBuffer.data and its sender into srcAddr.
+ * With a read batch, packets are received with one recvmmsg() call and returned from the batch until it is empty.
+ * Returns the packet length, or -1 with errno set. */
+static RsslInt32 rsslSeqMcastRecvPacket(rsslChannelImpl *rsslChnlImpl, RsslSeqMcastChannel *pSeqMcastChannel, struct sockaddr_in *srcAddr)
+{
+	RsslInt32 cc;
+	RsslInt32 srcAddrLen = sizeof(struct sockaddr_in);
+
+#ifdef SEQ_MCAST_HAS_MMSG
+	if (pSeqMcastChannel->readBatchSize > 1)
+	{
+		RsslUInt32 i;
+
+		if (pSeqMcastChannel->readIndex == pSeqMcastChannel->readCount)
+		{
+			for (i = 0; i < pSeqMcastChannel->readBatchSize; ++i)
+				pSeqMcastChannel->readMsgs[i].msg_hdr.msg_namelen = sizeof(struct sockaddr_in);
+
+			/* MSG_WAITFORONE stops waiting once the first packet has arrived, so a blocking channel does not wait for a full batch. */
+			if ((cc = recvmmsg(rsslChnlImpl->Channel.socketId, pSeqMcastChannel->readMsgs, pSeqMcastChannel->readBatchSize, MSG_WAITFORONE, NULL)) <= 0)
+			{
+				if (cc == 0)
+					errno = EAGAIN;
+				return -1;
+			}
+
+			pSeqMcastChannel->recvCallCount++;
+			pSeqMcastChannel->readCount = (RsslUInt32)cc;
+			pSeqMcastChannel->readIndex = 0;
+		}
+
+		i = pSeqMcastChannel->readIndex++;
+		pSeqMcastChannel->inputBuffer.data = (char*)pSeqMcastChannel->readIov[i].iov_base;
+		*srcAddr = pSeqMcastChannel->readSrcAddrs[i];
+		return (RsslInt32)pSeqMcastChannel->readMsgs[i].msg_len;
+	}
+#endif
+
+	pSeqMcastChannel->inputBuffer.data = pSeqMcastChannel->inputBufferMem;
+	if ((cc = recvfrom(rsslChnlImpl->Channel.socketId, pSeqMcastChannel->inputBuffer.data, pSeqMcastChannel->maxMsgSize + SEQ_MCAST_MAX_HDR_LEN, 0, (struct sockaddr*)srcAddr, (socklen_t*)&srcAddrLen)) >= 0)
+		pSeqMcastChannel->recvCallCount++;
+	return cc;
+}
+
+/* Sends the queued packets of the write batch.
+ * Returns RSSL_RET_SUCCESS when all are sent, the number of queued bytes if the socket would block, or RSSL_RET_FAILURE. */
+static RsslRet rsslSeqMcastSendBatch(rsslChannelImpl *rsslChnlImpl, RsslSeqMcastChannel *pSeqMcastChannel, RsslError *error)
+{
+	RsslInt32 sent;
+	RsslUInt32 i;
+
+	while (pSeqMcastChannel->writeSent < pSeqMcastChannel->writeQueued)
+	{
+#ifdef SEQ_MCAST_HAS_MMSG
+		for (i = pSeqMcastChannel->writeSent; i < pSeqMcastChannel->writeQueued; ++i)
+		{
+			pSeqMcastChannel->writeIov[i].iov_base = pSeqMcastChannel->writePackets[i].data;
+			pSeqMcastChannel->writeIov[i].iov_len = pSeqMcastChannel->writePackets[i].length;
+		}
+
+		sent = sendmmsg(rsslChnlImpl->Channel.socketId, &pSeqMcastChannel->writeMsgs[pSeqMcastChannel->writeSent],
+				pSeqMcastChannel->writeQueued - pSeqMcastChannel->writeSent, 0);
+#else
+		if ((sent = sendto(rsslChnlImpl->Channel.socketId, pSeqMcastChannel->writePackets[pSeqMcastChannel->writeSent].data,
+				pSeqMcastChannel->writePackets[pSeqMcastChannel->writeSent].length, 0, (struct sockaddr*)&pSeqMcastChannel->sendAddr, sizeof(pSeqMcastChannel->sendAddr))) >= 0)
+			sent = 1;
+#endif
+		if (sent < 0)
+		{
+			if (errno == EINTR)
+				continue;
+
+			if (errno == EWOULDBLOCK || errno == EAGAIN)
+				return (RsslRet)pSeqMcastChannel->writeQueuedBytes;
+
+			_rsslSetError(error, NULL, RSSL_RET_FAILURE,  errno);
+			snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> Error: 1002 Failed to send the queued packets.  System errno: (%d).\n", __FILE__, __LINE__, errno);
+			return RSSL_RET_FAILURE;
+		}
+
+		pSeqMcastChannel->sendCallCount++;
+		pSeqMcastChannel->pktSentCount += sent;
+		for (i = 0; i < (RsslUInt32)sent; ++i)
+			pSeqMcastChannel->writeQueuedBytes -= pSeqMcastChannel->writePackets[pSeqMcastChannel->writeSent + i].length;
+		pSeqMcastChannel->writeSent += sent;
+	}
+
+	pSeqMcastChannel->writeQueued = 0;
+	pSeqMcastChannel->writeSent = 0;
+	pSeqMcastChannel->writeQueuedBytes = 0;
+	return RSSL_RET_SUCCESS;
+}
+
 
 /* Write the Sequence Multicast Header to the channel impl.  
 	Preconditions: buf's space has been pre-allocated, and everything's been range checked to ensure that no overflow is possible
@@ -253,15 +453,11 @@ RsslRet rsslSeqMcastCloseChannel(rsslChannelImpl* rsslChnlImpl, RsslError *error
 		rsslQueueAddLinkToBack(&(rsslChnlImpl->freeBufferList), pLink);
 	}
 
-	_rsslFree(pSeqMcastChannel->bufferMem);
-	pSeqMcastChannel->bufferMem = 0;
-	_rsslFree(pSeqMcastChannel->inputBufferMem);
-	pSeqMcastChannel->inputBufferMem = 0;
 	if (chnlLocking)
 		seqMcastUnlock(&pSeqMcastChannel->lock);
 	if (chnlLocking)
 		seqMcastDestroyLock(&pSeqMcastChannel->lock);
-	_rsslFree(rsslChnlImpl->transportInfo);
+	rsslSeqMcastFreeChannel(pSeqMcastChannel);
 	rsslChnlImpl->transportInfo = 0;
 
 	return RSSL_RET_SUCCESS;
@@ -289,6 +485,8 @@ RsslRet rsslSeqMcastConnect(rsslChannelImpl* rsslChnlImpl, RsslConnectOptions *o
 		return RSSL_RET_FAILURE;
 	}
 	
+	memset(pSeqMcastChannel, 0, sizeof(RsslSeqMcastChannel));
+
 	if (chnlLocking)
 		seqMcastInitLock(&pSeqMcastChannel->lock);
 
@@ -297,20 +495,26 @@ RsslRet rsslSeqMcastConnect(rsslChannelImpl* rsslChnlImpl, RsslConnectOptions *o
 	else
 		pSeqMcastChannel->maxMsgSize = opts->seqMulticastOpts.maxMsgSize;
 
-	/* Add 7 to avoid any full word byte swap issues at the end of the buffer */
-	if (!(pSeqMcastChannel->bufferMem = (char*)_rsslMalloc(opts->seqMulticastOpts.maxMsgSize + SEQ_MCAST_MAX_HDR_LEN + 7)))
-	{
-		_rsslSetError(error, NULL, RSSL_RET_FAILURE,  0);
-		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslConnect() Error: 0005 Failed to allocate the sequenced multicast output buffer.\n", __FILE__, __LINE__);
-		_rsslFree(pSeqMcastChannel);
-		return RSSL_RET_FAILURE;
-	}
-	if (!(pSeqMcastChannel->inputBufferMem = (char*)_rsslMalloc(opts->seqMulticastOpts.maxMsgSize + SEQ_MCAST_MAX_HDR_LEN + 7)))
+#ifdef SEQ_MCAST_HAS_MMSG
+	pSeqMcastChannel->readBatchSize = opts->seqMulticastOpts.readBatchSize;
+#endif
+	if (pSeqMcastChannel->readBatchSize == 0)
+		pSeqMcastChannel->readBatchSize = 1;
+	else if (pSeqMcastChannel->readBatchSize > SEQ_MCAST_MAX_BATCH_SIZE)
+		pSeqMcastChannel->readBatchSize = SEQ_MCAST_MAX_BATCH_SIZE;
+
+	pSeqMcastChannel->writeBatchSize = opts->seqMulticastOpts.writeBatchSize;
+	if (pSeqMcastChannel->writeBatchSize == 0)
+		pSeqMcastChannel->writeBatchSize = 1;
+	else if (pSeqMcastChannel->writeBatchSize > SEQ_MCAST_MAX_BATCH_SIZE)
+		pSeqMcastChannel->writeBatchSize = SEQ_MCAST_MAX_BATCH_SIZE;
+	pSeqMcastChannel->writeBatchTimeout = opts->seqMulticastOpts.writeBatchTimeout;
+
+	if (!rsslSeqMcastAllocBatches(pSeqMcastChannel))
 	{
 		_rsslSetError(error, NULL, RSSL_RET_FAILURE,  0);
-		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslConnect() Error: 0005 Failed to allocate the sequenced multicast input buffer.\n", __FILE__, __LINE__);
-		_rsslFree(pSeqMcastChannel->bufferMem);
-		_rsslFree(pSeqMcastChannel);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslConnect() Error: 0005 Failed to allocate the sequenced multicast packet buffers.\n", __FILE__, __LINE__);
+		rsslSeqMcastFreeChannel(pSeqMcastChannel);
 		return RSSL_RET_FAILURE;
 	}
 
@@ -330,9 +534,7 @@ RsslRet rsslSeqMcastConnect(rsslChannelImpl* rsslChnlImpl, RsslConnectOptions *o
 
 	if (opts->connectionInfo.unified.address == NULL)
 	{
-		_rsslFree(pSeqMcastChannel->inputBufferMem);
-		_rsslFree(pSeqMcastChannel->bufferMem);
-		_rsslFree(pSeqMcastChannel);
+		rsslSeqMcastFreeChannel(pSeqMcastChannel);
 		_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
 		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslConnect() Error: 0013 unified.address not provided.\n", __FILE__, __LINE__);
 		return RSSL_RET_FAILURE;
@@ -340,9 +542,7 @@ RsslRet rsslSeqMcastConnect(rsslChannelImpl* rsslChnlImpl, RsslConnectOptions *o
 
 	if (opts->connectionInfo.unified.serviceName == NULL)
 	{
-		_rsslFree(pSeqMcastChannel->inputBufferMem);
-		_rsslFree(pSeqMcastChannel->bufferMem);
-		_rsslFree(pSeqMcastChannel);
+		rsslSeqMcastFreeChannel(pSeqMcastChannel);
 		_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
 		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslConnect() Error: 0013 unified.serviceName not provided.\n", __FILE__, __LINE__);
 		return RSSL_RET_FAILURE;
@@ -353,9 +553,7 @@ RsslRet rsslSeqMcastConnect(rsslChannelImpl* rsslChnlImpl, RsslConnectOptions *o
 	{
 		_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
 		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslConnect() Error: 1002 Call to socket() failed. System errno: (%d).\n", __FILE__, __LINE__, errno);
-		_rsslFree(pSeqMcastChannel->inputBufferMem);
-		_rsslFree(pSeqMcastChannel->bufferMem);
-		_rsslFree(pSeqMcastChannel);
+		rsslSeqMcastFreeChannel(pSeqMcastChannel);
 		return RSSL_RET_FAILURE;
 	}
 
@@ -367,9 +565,7 @@ RsslRet rsslSeqMcastConnect(rsslChannelImpl* rsslChnlImpl, RsslConnectOptions *o
 
 			_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
 			snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslConnect() Error: 1002 setsockopt() failed. Unable to set SO_SNDBUF on socket. System errno: (%d).\n", __FILE__, __LINE__, errno);
-			_rsslFree(pSeqMcastChannel->inputBufferMem);
-			_rsslFree(pSeqMcastChannel->bufferMem);
-			_rsslFree(pSeqMcastChannel);
+			rsslSeqMcastFreeChannel(pSeqMcastChannel);
 			return RSSL_RET_FAILURE;
 		}
 	}
@@ -382,9 +578,7 @@ RsslRet rsslSeqMcastConnect(rsslChannelImpl* rsslChnlImpl, RsslConnectOptions *o
 
 			_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
 			snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslConnect() Error: 1002 setsockopt() failed. Unable to set SO_RCVBUF on socket. System errno: (%d).\n", __FILE__, __LINE__, errno);
-			_rsslFree(pSeqMcastChannel->inputBufferMem);
-			_rsslFree(pSeqMcastChannel->bufferMem);
-			_rsslFree(pSeqMcastChannel);
+			rsslSeqMcastFreeChannel(pSeqMcastChannel);
 			return RSSL_RET_FAILURE;
 		}
 	}
@@ -400,9 +594,7 @@ RsslRet rsslSeqMcastConnect(rsslChannelImpl* rsslChnlImpl, RsslConnectOptions *o
 
 		_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
 		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslConnect() Error: 1002 setsockopt() failed. Unable to set SO_REUSEADDR on socket. System errno: (%d).\n", __FILE__, __LINE__, errno);
-		_rsslFree(pSeqMcastChannel->inputBufferMem);
-		_rsslFree(pSeqMcastChannel->bufferMem);
-		_rsslFree(pSeqMcastChannel);
+		rsslSeqMcastFreeChannel(pSeqMcastChannel);
 		return RSSL_RET_FAILURE;
     }
 
@@ -420,9 +612,7 @@ RsslRet rsslSeqMcastConnect(rsslChannelImpl* rsslChnlImpl, RsslConnectOptions *o
 
 			_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
 			snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslConnect() Error 1004: getHostByName() failed.  Interface name (%s) is incorrect.  System errno: (%d)\n", __FILE__, __LINE__, opts->connectionInfo.segmented.interfaceName, errno);
-			_rsslFree(pSeqMcastChannel->inputBufferMem);
-			_rsslFree(pSeqMcastChannel->bufferMem);
-			_rsslFree(pSeqMcastChannel);
+			rsslSeqMcastFreeChannel(pSeqMcastChannel);
 			
 			return RSSL_RET_FAILURE;
 		} 
@@ -440,9 +630,7 @@ RsslRet rsslSeqMcastConnect(rsslChannelImpl* rsslChnlImpl, RsslConnectOptions *o
 
 		_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
 		snprintf(error->text, MAX_RSSL_ERROR_TEXT,"<%s:%d> rsslConnect() Error 1004: getHostByName() failed.  Receive address (%s) is incorrect. System errno: (%d)\n", __FILE__, __LINE__, opts->connectionInfo.segmented.recvAddress, errno);
-		_rsslFree(pSeqMcastChannel->inputBufferMem);
-		_rsslFree(pSeqMcastChannel->bufferMem);
-		_rsslFree(pSeqMcastChannel);
+		rsslSeqMcastFreeChannel(pSeqMcastChannel);
 		return RSSL_RET_FAILURE;
 	}
 	pSeqMcastChannel->recvAddr.sin_addr.s_addr = addr;
@@ -457,9 +645,7 @@ RsslRet rsslSeqMcastConnect(rsslChannelImpl* rsslChnlImpl, RsslConnectOptions *o
 
 		_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
 		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslConnect() Error: 1004 getServByName() failed.  Receive service (%s) is incorrect.  System errno: (%d)\n", __FILE__, __LINE__, opts->connectionInfo.segmented.recvServiceName, errno);
-		_rsslFree(pSeqMcastChannel->inputBufferMem);
-		_rsslFree(pSeqMcastChannel->bufferMem);
-		_rsslFree(pSeqMcastChannel);
+		rsslSeqMcastFreeChannel(pSeqMcastChannel);
 		return RSSL_RET_FAILURE;
 	} 
 
@@ -469,9 +655,7 @@ RsslRet rsslSeqMcastConnect(rsslChannelImpl* rsslChnlImpl, RsslConnectOptions *o
 
 		_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
 		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslConnect() Error: 1002 Call to system bind() failed. System errno: (%d).\n", __FILE__, __LINE__, errno);
-		_rsslFree(pSeqMcastChannel->inputBufferMem);
-		_rsslFree(pSeqMcastChannel->bufferMem);
-		_rsslFree(pSeqMcastChannel);
+		rsslSeqMcastFreeChannel(pSeqMcastChannel);
 		return RSSL_RET_FAILURE;
 	} 
 
@@ -483,9 +667,7 @@ RsslRet rsslSeqMcastConnect(rsslChannelImpl* rsslChnlImpl, RsslConnectOptions *o
 
 		_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
 		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslConnect() Error: 1004 getHostByName() failed.  Receive address (%s) is incorrect.  System errno: (%d).\n", __FILE__, __LINE__, opts->connectionInfo.segmented.recvAddress, errno);
-		_rsslFree(pSeqMcastChannel->inputBufferMem);
-		_rsslFree(pSeqMcastChannel->bufferMem);
-		_rsslFree(pSeqMcastChannel);
+		rsslSeqMcastFreeChannel(pSeqMcastChannel);
 		return RSSL_RET_FAILURE;
 	}
 	mreg.imr_multiaddr.s_addr = addr;
@@ -498,9 +680,7 @@ RsslRet rsslSeqMcastConnect(rsslChannelImpl* rsslChnlImpl, RsslConnectOptions *o
 
 			_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
 			snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslConnect() Error: 1004 getHostByName() failed.  Interface address (%s) is incorrect.  System errno: (%d).\n", __FILE__, __LINE__, opts->connectionInfo.segmented.interfaceName, errno);
-			_rsslFree(pSeqMcastChannel->inputBufferMem);
-			_rsslFree(pSeqMcastChannel->bufferMem);
-			_rsslFree(pSeqMcastChannel);
+			rsslSeqMcastFreeChannel(pSeqMcastChannel);
 			return RSSL_RET_FAILURE;
 		}
 		mreg.imr_interface.s_addr = addr;
@@ -526,9 +706,7 @@ RsslRet rsslSeqMcastConnect(rsslChannelImpl* rsslChnlImpl, RsslConnectOptions *o
 
 		_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
 		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslConnect() Error: 1002 setsockopt() failed.  Unable to add membership to multicast group.  System errno: (%d).\n", __FILE__, __LINE__, errno);
-		_rsslFree(pSeqMcastChannel->inputBufferMem);
-		_rsslFree(pSeqMcastChannel->bufferMem);
-		_rsslFree(pSeqMcastChannel);
+		rsslSeqMcastFreeChannel(pSeqMcastChannel);
 		return RSSL_RET_FAILURE;
 	}
 	
@@ -538,9 +716,7 @@ RsslRet rsslSeqMcastConnect(rsslChannelImpl* rsslChnlImpl, RsslConnectOptions *o
 
 		_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
 		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslConnect() Error: 1002 setsockopt() failed.  Unable to set multicast interface.  System errno: (%d).\n", __FILE__, __LINE__, errno);
-		_rsslFree(pSeqMcastChannel->inputBufferMem);
-		_rsslFree(pSeqMcastChannel->bufferMem);
-		_rsslFree(pSeqMcastChannel);
+		rsslSeqMcastFreeChannel(pSeqMcastChannel);
 		return RSSL_RET_FAILURE;
 	}
 
@@ -557,9 +733,7 @@ RsslRet rsslSeqMcastConnect(rsslChannelImpl* rsslChnlImpl, RsslConnectOptions *o
 
 			_rsslSetError(error, NULL, RSSL_RET_FAILURE,  errno);
 			snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslConnect() Error: 1002 fcntl() failed.  Unable to set blocking.  System errno: (%d).\n", __FILE__, __LINE__, errno);
-			_rsslFree(pSeqMcastChannel->inputBufferMem);
-			_rsslFree(pSeqMcastChannel->bufferMem);
-			_rsslFree(pSeqMcastChannel);
+			rsslSeqMcastFreeChannel(pSeqMcastChannel);
 			return RSSL_RET_FAILURE;
 		}
 	}
@@ -574,9 +748,7 @@ RsslRet rsslSeqMcastConnect(rsslChannelImpl* rsslChnlImpl, RsslConnectOptions *o
 
 			_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
 			snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslConnect() Error: 1004 getHostByName() failed.  Send address (%s) is incorrect.  System errno: (%d).\n", __FILE__, __LINE__, opts->connectionInfo.segmented.sendAddress, errno);
-			_rsslFree(pSeqMcastChannel->inputBufferMem);
-			_rsslFree(pSeqMcastChannel->bufferMem);
-			_rsslFree(pSeqMcastChannel);
+			rsslSeqMcastFreeChannel(pSeqMcastChannel);
 			return RSSL_RET_FAILURE;
 		}
 		pSeqMcastChannel->sendAddr.sin_addr.s_addr = addr;
@@ -590,9 +762,7 @@ RsslRet rsslSeqMcastConnect(rsslChannelImpl* rsslChnlImpl, RsslConnectOptions *o
 
 			_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
 			snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslConnect() Error: 1004 getHostByName() failed.  Receive address (%s) is incorrect.  System errno: (%d).\n", __FILE__, __LINE__, opts->connectionInfo.segmented.recvAddress, errno);
-			_rsslFree(pSeqMcastChannel->inputBufferMem);
-			_rsslFree(pSeqMcastChannel->bufferMem);
-			_rsslFree(pSeqMcastChannel);
+			rsslSeqMcastFreeChannel(pSeqMcastChannel);
 			return RSSL_RET_FAILURE;
 		}
 		pSeqMcastChannel->sendAddr.sin_addr.s_addr = addr;
@@ -612,10 +782,25 @@ RsslRet rsslSeqMcastConnect(rsslChannelImpl* rsslChnlImpl, RsslConnectOptions *o
 	return RSSL_RET_SUCCESS;
 }
 
-/* Contains code necessary to flush data to Sequence Multicast network (no-op) */
+/* Contains code necessary to flush data to Sequence Multicast network. Sends the packets queued by a write batch. */
 RSSL_RSSL_SEQ_MCAST_IMPL_FAST(RsslRet) rsslSeqMcastFlush(rsslChannelImpl *rsslChnlImpl, RsslError *error)
 {
-	return RSSL_RET_SUCCESS;
+	RsslSeqMcastChannel *pSeqMcastChannel = (RsslSeqMcastChannel*)rsslChnlImpl->transportInfo;
+	RsslRet ret = RSSL_RET_SUCCESS;
+
+	if (chnlLocking)
+		seqMcastGetLock(&pSeqMcastChannel->lock);
+
+	if (pSeqMcastChannel->writeQueued > pSeqMcastChannel->writeSent)
+	{
+		if ((ret = rsslSeqMcastSendBatch(rsslChnlImpl, pSeqMcastChannel, error)) < RSSL_RET_SUCCESS)
+			rsslChnlImpl->Channel.state = RSSL_CH_STATE_CLOSED;
+	}
+
+	if (chnlLocking)
+		seqMcastUnlock(&pSeqMcastChannel->lock);
+
+	return ret;
 }
 
 /* Contains code necessary to obtain a buffer to put data in for writing to Sequence Multicast network */
@@ -644,6 +829,26 @@ RSSL_RSSL_SEQ_MCAST_IMPL_FAST(rsslBufferImpl*) rsslSeqMcastGetBuffer(rsslChannel
 		return NULL;
 	}
 
+	/* The write batch is full if the socket would not take it when it was sent. */
+	if (pSeqMcastChannel->writeQueued == pSeqMcastChannel->writeBatchSize && pSeqMcastChannel->writeBatchSize > 1)
+	{
+		RsslRet ret;
+
+		if ((ret = rsslSeqMcastSendBatch(rsslChnlImpl, pSeqMcastChannel, error)) != RSSL_RET_SUCCESS)
+		{
+			if (ret > RSSL_RET_SUCCESS)
+			{
+				_rsslSetError(error, NULL, RSSL_RET_BUFFER_NO_BUFFERS,  0);
+				snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> RsslGetBuffer() Error: 0005 The write batch is full.  Call rsslFlush to send it.\n", __FILE__, __LINE__);
+			}
+			else
+				rsslChnlImpl->Channel.state = RSSL_CH_STATE_CLOSED;
+
+			if (chnlLocking) seqMcastUnlock(&pSeqMcastChannel->lock);
+			return NULL;
+		}
+	}
+
 	pSeqMcastChannel->bufferInUse = RSSL_TRUE;
 
 	pLink = rsslQueueRemoveFirstLink(&(rsslChnlImpl->freeBufferList));
@@ -660,7 +865,8 @@ RSSL_RSSL_SEQ_MCAST_IMPL_FAST(rsslBufferImpl*) rsslSeqMcastGetBuffer(rsslChannel
 	pBufferImpl = RSSL_QUEUE_LINK_TO_OBJECT(rsslBufferImpl, link1, pLink);
 
 	pBufferImpl->buffer.length = size;
-	pBufferImpl->buffer.data = pSeqMcastChannel->bufferMem + SEQ_MCAST_MAX_HDR_LEN;
+	/* Each queued packet of the write batch keeps its own memory until it is sent */
+	pBufferImpl->buffer.data = pSeqMcastChannel->bufferMem + (size_t)pSeqMcastChannel->writeQueued * pSeqMcastChannel->packetMemSize + SEQ_MCAST_MAX_HDR_LEN;
 	/* Since the packing header and non-packed header are identical, every buffer is packable. 
 	   The packingOffset will be initially set to after the seqNum(4 bytes in), then every subsequent pack will place the length at that point
 	   Each subsequent pack should then place the packingOffset to the end of the previous pack's data, without reserving the length in the offset */
@@ -668,7 +874,7 @@ RSSL_RSSL_SEQ_MCAST_IMPL_FAST(rsslBufferImpl*) rsslSeqMcastGetBuffer(rsslChannel
 	seqMcastBuffer = &(pSeqMcastChannel->writeBuffer);
 	pBufferImpl->packingOffset = SEQ_MCAST_MAX_HDR_LEN;
 	pBufferImpl->bufferInfo = seqMcastBuffer;
-	seqMcastBuffer->buffer = pSeqMcastChannel->bufferMem;
+	seqMcastBuffer->buffer = pBufferImpl->buffer.data - SEQ_MCAST_MAX_HDR_LEN;
 	seqMcastBuffer->maxLength = size;
 	/* This memory is owned entirely by the SeqMCast channel */
 	pBufferImpl->owner = 0;
@@ -688,14 +894,16 @@ RSSL_RSSL_SEQ_MCAST_IMPL_FAST(RsslRet) rsslSeqMcastGetChannelInfo(rsslChannelImp
 		seqMcastGetLock(&pSeqMcastChannel->lock);
 	memset(info, 0, sizeof(RsslChannelInfo));
 	info->maxFragmentSize = pSeqMcastChannel->maxMsgSize;
-	info->maxOutputBuffers = 1;
-	info->guaranteedOutputBuffers = 1;
-	info->numInputBuffers = 1;
+	info->maxOutputBuffers = pSeqMcastChannel->writeBatchSize;
+	info->guaranteedOutputBuffers = pSeqMcastChannel->writeBatchSize;
+	info->numInputBuffers = pSeqMcastChannel->readBatchSize;
 	info->pingTimeout = rsslChnlImpl->Channel.pingTimeout;
 	info->clientToServerPings = RSSL_FALSE;
 	info->serverToClientPings = RSSL_FALSE;
 	info->multicastStats.mcastRcvd = pSeqMcastChannel->pktRecvCount;
 	info->multicastStats.mcastSent = pSeqMcastChannel->pktSentCount;
+	info->multicastStats.mcastRcvdCalls = pSeqMcastChannel->recvCallCount;
+	info->multicastStats.mcastSendCalls = pSeqMcastChannel->sendCallCount;
 	
 	info->encryptionProtocol = RSSL_ENC_NONE;
 
@@ -841,6 +1049,17 @@ RSSL_RSSL_SEQ_MCAST_IMPL_FAST(RsslRet) rsslSeqMcastPing(rsslChannelImpl *rsslChn
 	if (chnlLocking)
 		seqMcastGetLock(&pSeqMcastChannel->lock);
 
+	/* The ping carries the last sequence number written, so the queued packets must go first. */
+	if (pSeqMcastChannel->writeQueued > pSeqMcastChannel->writeSent)
+	{
+		if ((ret = rsslSeqMcastSendBatch(rsslChnlImpl, pSeqMcastChannel, error)) != RSSL_RET_SUCCESS)
+		{
+			if (chnlLocking)
+				seqMcastUnlock(&pSeqMcastChannel->lock);
+			return (ret > RSSL_RET_SUCCESS ? RSSL_RET_SUCCESS : RSSL_RET_FAILURE);
+		}
+	}
+
 	rsslSeqMcastWriteHdr(rsslChnlImpl, sendBuf, 0, pSeqMcastChannel->writeSeqNum, error);
 
 	/* send packet */
@@ -872,6 +1091,7 @@ RSSL_RSSL_SEQ_MCAST_IMPL_FAST(RsslRet) rsslSeqMcastPing(rsslChannelImpl *rsslChn
 	} while (0);
 
 	pSeqMcastChannel->pktSentCount++;
+	pSeqMcastChannel->sendCallCount++;
 	pSeqMcastChannel->bufferInUse = RSSL_FALSE;
 
 	if (chnlLocking)
@@ -886,7 +1106,6 @@ RSSL_RSSL_SEQ_MCAST_IMPL_FAST(RsslBuffer*) rsslSeqMcastRead(rsslChannelImpl* rss
 	RsslSeqMcastChannel *pSeqMcastChannel = (RsslSeqMcastChannel*)rsslChnlImpl->transportInfo;
 	RsslInt32 cc, remainingLen;
 	struct sockaddr_in srcAddr;
-	RsslInt32 srcAddrLen = sizeof(struct sockaddr_in);
 	RsslUInt8 tmpChar;
 	RsslInt32 hdrLen;
 	RsslInt32 readFlags;
@@ -895,9 +1114,7 @@ RSSL_RSSL_SEQ_MCAST_IMPL_FAST(RsslBuffer*) rsslSeqMcastRead(rsslChannelImpl* rss
 	{
 		if (pSeqMcastChannel->stillProcessingPacket == RSSL_FALSE) /* process a new packet from network */
 		{
-			pSeqMcastChannel->inputBuffer.data = pSeqMcastChannel->inputBufferMem;
-
-			if ((cc = recvfrom(rsslChnlImpl->Channel.socketId, pSeqMcastChannel->inputBuffer.data, pSeqMcastChannel->maxMsgSize + SEQ_MCAST_MAX_HDR_LEN, 0, (struct sockaddr*)&srcAddr, (socklen_t*)&srcAddrLen)) < 0)
+			if ((cc = rsslSeqMcastRecvPacket(rsslChnlImpl, pSeqMcastChannel, &srcAddr)) < 0)
 			{
 				if(errno == EINTR || errno == EWOULDBLOCK || errno == EAGAIN)
 				{
@@ -1038,7 +1255,8 @@ RSSL_RSSL_SEQ_MCAST_IMPL_FAST(RsslBuffer*) rsslSeqMcastRead(rsslChannelImpl* rss
 				readOutArgs->nodeId.nodeAddr = pSeqMcastChannel->readAddr;
 				readOutArgs->nodeId.port = pSeqMcastChannel->readPort;
 				readOutArgs->instanceId = pSeqMcastChannel->readInstanceID;
-				*readRet = RSSL_RET_READ_PING;
+				/* Packets left in the read batch will not trigger the notifier, so they take priority over reporting the ping. */
+				*readRet = (pSeqMcastChannel->readIndex < pSeqMcastChannel->readCount) ? (RsslRet)(pSeqMcastChannel->readCount - pSeqMcastChannel->readIndex) : RSSL_RET_READ_PING;
 				if (chnlLocking)
 					seqMcastUnlock(&pSeqMcastChannel->lock);
 				return NULL;
@@ -1070,6 +1288,8 @@ RSSL_RSSL_SEQ_MCAST_IMPL_FAST(RsslBuffer*) rsslSeqMcastRead(rsslChannelImpl* rss
 			{
 				pSeqMcastChannel->stillProcessingPacket = RSSL_TRUE;
 			}
+			else
+				remainingLen = pSeqMcastChannel->readCount - pSeqMcastChannel->readIndex;
 			*readRet = remainingLen;
 		}
 		else /* still processing previous packet */
@@ -1112,6 +1332,7 @@ RSSL_RSSL_SEQ_MCAST_IMPL_FAST(RsslBuffer*) rsslSeqMcastRead(rsslChannelImpl* rss
 			if (remainingLen == 0)
 			{
 				pSeqMcastChannel->stillProcessingPacket = RSSL_FALSE;
+				remainingLen = pSeqMcastChannel->readCount - pSeqMcastChannel->readIndex;
 			}
 			*readRet = remainingLen;
 		}
@@ -1275,7 +1496,43 @@ RSSL_RSSL_SEQ_MCAST_IMPL_FAST(RsslRet) rsslSeqMcastWrite(rsslChannelImpl *rsslCh
 
 		pktLength = seqMcastBuffer->length - hdrOffset;
 	}
-		
+
+	if (pSeqMcastChannel->writeBatchSize > 1)
+	{
+		/* Queue the packet. The batch is sent when it is full, when the oldest packet has waited long enough, or by rsslFlush. */
+		if (pSeqMcastChannel->writeQueued == 0 && pSeqMcastChannel->writeBatchTimeout)
+			pSeqMcastChannel->writeBatchStart = rsslGetTimeMicro();
+
+		pSeqMcastChannel->writePackets[pSeqMcastChannel->writeQueued].data = seqMcastBuffer->buffer + hdrOffset;
+		pSeqMcastChannel->writePackets[pSeqMcastChannel->writeQueued].length = (RsslUInt32)pktLength;
+		pSeqMcastChannel->writeQueued++;
+		pSeqMcastChannel->writeQueuedBytes += pktLength;
+
+		ret = (RsslInt32)pSeqMcastChannel->writeQueuedBytes;
+		if (pSeqMcastChannel->writeQueued == pSeqMcastChannel->writeBatchSize
+				|| (pSeqMcastChannel->writeBatchTimeout && rsslGetTimeMicro() - pSeqMcastChannel->writeBatchStart >= pSeqMcastChannel->writeBatchTimeout))
+		{
+			if ((ret = rsslSeqMcastSendBatch(rsslChnlImpl, pSeqMcastChannel, error)) < RSSL_RET_SUCCESS)
+			{
+				/* The packet is queued, so the buffer belongs to the transport even though the channel failed */
+				rsslChnlImpl->Channel.state = RSSL_CH_STATE_CLOSED;
+			}
+		}
+
+		pSeqMcastChannel->bufferInUse = RSSL_FALSE;
+		if (rsslQueueLinkInAList(&(rsslBufImpl->link1)))
+			rsslQueueRemoveLink(&(rsslChnlImpl->activeBufferList), &(rsslBufImpl->link1));
+
+		rsslQueueAddLinkToBack(&(rsslChnlImpl->freeBufferList), &(rsslBufImpl->link1));
+
+		writeOutArgs->bytesWritten = seqMcastBuffer->length;
+		writeOutArgs->uncompressedBytesWritten = seqMcastBuffer->length;
+		if (chnlLocking)
+			seqMcastUnlock(&pSeqMcastChannel->lock);
+
+		return ret;
+	}
+
 	/* send packet */
 	do
 	{
@@ -1310,6 +1567,7 @@ RSSL_RSSL_SEQ_MCAST_IMPL_FAST(RsslRet) rsslSeqMcastWrite(rsslChannelImpl *rsslCh
 	} while (0);
 
 	pSeqMcastChannel->pktSentCount++;
+	pSeqMcastChannel->sendCallCount++;
 
 	pSeqMcastChannel->bufferInUse = RSSL_FALSE;
 	/* Move the buffer out of the activeBufferList to the freeBufferList */
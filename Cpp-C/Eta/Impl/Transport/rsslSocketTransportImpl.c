@@ -14,6 +14,7 @@
 #include "rtr/rsslErrors.h"
 #include "rtr/ripcflip.h"
 #include "rtr/ripcutils.h"
+#include "rtr/ripcuring.h"
 #include "rtr/rtratomic.h"
 #include "rtr/rsslQueue.h"
 #include "lz4.h"
@@ -107,6 +108,8 @@ static RsslRet ipcGetSocketRow(RsslSocketChannel *rsslSocketChannel, RsslError *
 
 RsslRet ripcInitZlibComp();
 RsslRet ripcInitLz4Comp();
+RsslRet ripcInitZstdComp(RsslBuffer *dictionary, RsslError *error);
+void ripcCleanupZstdComp();
 
 // used to assign global sessionID's for each session. Will need to optimize to reuse session ID
 static RsslUInt32					g_sessionID = 0;
@@ -145,6 +148,7 @@ static ripcCompFuncs	compressFuncs[RSSL_COMP_MAX_TYPE + 1];
 
 static const RsslUInt32	RSSL_COMP_DFLT_THRESHOLD_ZLIB = 30;
 static const RsslUInt32	RSSL_COMP_DFLT_THRESHOLD_LZ4 = 300;
+static const RsslUInt32	RSSL_COMP_DFLT_THRESHOLD_ZSTD = 30;
 
 static RsslInitializeExOpts  transOpts = RSSL_INIT_INITIALIZE_EX_OPTS;
 
@@ -153,15 +157,21 @@ static ripcTransportFuncs   transFuncs[RIPC_MAX_TRANSPORTS];
 
 static ripcTransportFuncs 	encryptedSSLTransFuncs[RIPC_MAX_SSL_PROTOCOLS];
 
+/* Socket transport functions with io_uring reads and writes, indexed by ripcUringMode */
+static ripcTransportFuncs	uringTransFuncs[RIPC_URING_MAX_MODES];
+
 static ripcSSLFuncs		SSLTransFuncs;
 
 static RsslUInt16		numInitCalls = 0;
 static RsslUInt8 		initialized = 0;
 static rtr_atomic_val		gblmutexinit = 0;
 
+/* Indexed by compression type.  The types are bit flags, so unused values have empty entries. */
 static u8 ripccompressions[][3]	=	{	{ 0, 0x00, RSSL_COMP_NONE  },	/* no compression	*/
 										{ 0, 0x01, RSSL_COMP_ZLIB  },	/* zlib compression	*/
-										{ 0, 0x02, RSSL_COMP_LZ4 } };	/* LZ4 compression	*/
+										{ 0, 0x02, RSSL_COMP_LZ4 },		/* LZ4 compression	*/
+										{ 0, 0x00, RSSL_COMP_NONE  },	/* unused			*/
+										{ 0, 0x04, RSSL_COMP_ZSTD } };	/* zstd compression	*/
 
 /* winInet tunneling */
 #include "rtr/ripcinetutils.h"
@@ -369,6 +379,51 @@ RsslRet ipcSetTransFunc(RsslInt32 type, ripcTransportFuncs *funcs)
 	return(1);
 }
 
+RsslRet ipcSetUringTransFunc(ripcUringMode mode, ripcTransportFuncs *funcs)
+{
+	if (mode >= RIPC_URING_MAX_MODES)
+		return(-1);
+
+	/* Only reading and writing differ from the socket transport */
+	uringTransFuncs[mode] = transFuncs[RSSL_CONN_TYPE_SOCKET];
+	uringTransFuncs[mode].readTransport = funcs->readTransport;
+	uringTransFuncs[mode].writeTransport = funcs->writeTransport;
+	uringTransFuncs[mode].writeVTransport = funcs->writeVTransport;
+
+	return(1);
+}
+
+/* Returns the transport functions for an RSSL_CONN_TYPE_SOCKET channel, based on its I/O engine.
+ * Falls back to the regular socket functions when io_uring is not available. */
+static ripcTransportFuncs *ipcGetSocketTransFuncs(RsslSocketChannel *rsslSocketChannel)
+{
+	ripcUringMode mode;
+
+	switch (rsslSocketChannel->ioEngine)
+	{
+	case RSSL_IO_ENGINE_URING:
+		mode = RIPC_URING_INTERRUPT;
+		break;
+	case RSSL_IO_ENGINE_URING_SQPOLL:
+		mode = RIPC_URING_SQPOLL;
+		break;
+	default:
+		return &(transFuncs[RSSL_CONN_TYPE_SOCKET]);
+	}
+
+	if (!uringTransFuncs[mode].readTransport)
+		return &(transFuncs[RSSL_CONN_TYPE_SOCKET]);
+
+	/* The rings are freed once no channel uses them (see ripcRelSocketChannel()). */
+	if (!rsslSocketChannel->usesUring)
+	{
+		ipcUringAddChannel();
+		rsslSocketChannel->usesUring = RSSL_TRUE;
+	}
+
+	return &(uringTransFuncs[mode]);
+}
+
 RsslRet ipcSetSSLTransFunc(RsslInt32 type, ripcTransportFuncs *funcs)
 {
 	if (type >= RIPC_MAX_SSL_PROTOCOLS)
@@ -820,14 +875,14 @@ rtr_msgb_t *ipcReadSession( RsslSocketChannel *rsslSocketChannel, RsslRet *readr
 			*/
 			if (canRead)
 			{
-				IPC_MUTEX_UNLOCK(rsslSocketChannel);
+				IPC_READ_MUTEX_UNLOCK(rsslSocketChannel);
 
 				cc = (*(rsslSocketChannel->transportFuncs->readTransport))(
 					rsslSocketChannel->transportInfo,
 					(rsslSocketChannel->inputBuffer->buffer + rsslSocketChannel->inputBuffer->length),
 					((IPC_header_size + extendedHdr) - tempLen), rwflags, error);
 
-				IPC_MUTEX_LOCK(rsslSocketChannel);
+				IPC_READ_MUTEX_LOCK(rsslSocketChannel);
 
 				if (rsslSocketChannel->workState & RIPC_INT_SHTDOWN_PEND)
 				{
@@ -980,14 +1035,14 @@ rtr_msgb_t *ipcReadSession( RsslSocketChannel *rsslSocketChannel, RsslRet *readr
 	{
 		if (canRead)
 		{
-			IPC_MUTEX_UNLOCK(rsslSocketChannel);
+			IPC_READ_MUTEX_UNLOCK(rsslSocketChannel);
 
 			cc = (*(rsslSocketChannel->transportFuncs->readTransport))(
 				rsslSocketChannel->transportInfo,
 				(rsslSocketChannel->inputBuffer->buffer + rsslSocketChannel->inputBuffer->length),
 				(ipcLen - tempLen), rwflags, error);
 
-			IPC_MUTEX_LOCK(rsslSocketChannel);
+			IPC_READ_MUTEX_LOCK(rsslSocketChannel);
 
 			if (rsslSocketChannel->workState & RIPC_INT_SHTDOWN_PEND)
 			{
@@ -1137,7 +1192,7 @@ rtr_msgb_t *ipcReadSession( RsslSocketChannel *rsslSocketChannel, RsslRet *readr
 
 		/* header has been set up, need to determine if we have to decompress or not */
 		/* if this was a compression type that was not good at decompression, we may need to copy off content and decompress when next part comes */
-		if ((rsslSocketChannel->inDecompress == RSSL_COMP_LZ4) && ((rsslSocketChannel->tempDecompressBuf->length) || (ipcOpcode & IPC_COMP_FRAG)))
+		if ((compressFuncs[rsslSocketChannel->inDecompress].compressBound != 0) && ((rsslSocketChannel->tempDecompressBuf->length) || (ipcOpcode & IPC_COMP_FRAG)))
 		{
 			/* need to come in here if this is LZ and its the first part of compression, or need to know its the second part */
 			if (ipcOpcode & IPC_COMP_FRAG)
@@ -1695,11 +1750,11 @@ RsslInt32 ipcReadTransportMsg(void * transport, char *buf, int len, ripcRWFlags
 	if (IPC_NULL_PTR(rsslSocketChannel, "", "rsslSocketChannel", error))
 		return RSSL_RET_FAILURE;
 
-	IPC_MUTEX_UNLOCK(rsslSocketChannel);
+	IPC_READ_MUTEX_UNLOCK(rsslSocketChannel);
 
 	bytesRead = ((*(rsslSocketChannel->transportFuncs->readTransport))(rsslSocketChannel->transportInfo, 
 																  buf, len, flags, error));
-	IPC_MUTEX_LOCK(rsslSocketChannel);
+	IPC_READ_MUTEX_LOCK(rsslSocketChannel);
 
 	return bytesRead;
 }
@@ -2213,7 +2268,7 @@ RsslRet ipcWriteSession(RsslSocketChannel *rsslSocketChannel, rsslBufferImpl *rs
 					}
 
 					/* if doing a compression that does not grow across buffers, and it is over the threshold that will grow, use the intermediate buffer to compress into */
-					if ((rsslSocketChannel->outCompression == RSSL_COMP_LZ4) && (tempLen >= rsslSocketChannel->upperCompressionThreshold))
+					if ((rsslSocketChannel->outCompFuncs->compressBound != 0) && (tempLen >= rsslSocketChannel->upperCompressionThreshold))
 					{
 						compBuf.next_out = rsslSocketChannel->tempCompressBuf->buffer;
 						compBuf.avail_out = (unsigned long)rsslSocketChannel->tempCompressBuf->maxLength;
@@ -2244,7 +2299,7 @@ RsslRet ipcWriteSession(RsslSocketChannel *rsslSocketChannel, rsslBufferImpl *rs
 
 
 					/* if we have to split content, now do it */
-					if ((rsslSocketChannel->outCompression == RSSL_COMP_LZ4) && (tempLen >= rsslSocketChannel->upperCompressionThreshold))
+					if ((rsslSocketChannel->outCompFuncs->compressBound != 0) && (tempLen >= rsslSocketChannel->upperCompressionThreshold))
 					{
 						/* save length of content in the buffer */
 						rsslSocketChannel->tempCompressBuf->length = compLen1;
@@ -2530,7 +2585,7 @@ RsslRet ipcWriteSession(RsslSocketChannel *rsslSocketChannel, rsslBufferImpl *rs
 						headerLength = IPC_header_size;
 
 
-						if (rsslSocketChannel->outCompression == RSSL_COMP_LZ4) /* we should not be here with LZ4 unless it was over the comp threshold && (tempLen >= sess->upperCompressionThreshold) */
+						if (rsslSocketChannel->outCompFuncs->compressBound != 0) /* we should not be here with LZ4 or zstd unless it was over the comp threshold && (tempLen >= sess->upperCompressionThreshold) */
 						{
 							/* compression was already done above, just need to continue copy */
 							/* compLen2 should be whatever is left that we didnt copy into the buffer */
@@ -4293,17 +4348,17 @@ ripcSessInit ipcProcessHdr(RsslSocketChannel *rsslSocketChannel, ripcSessInProg
 							}
 						}
 
-						/* LZ4 compression can sometimes grow data instead of shrinking it
+						/* LZ4 and zstd compression can sometimes grow data instead of shrinking it
 						* the compression routine isnt smart enough to stop at the end of a buffer (yes, this is hard to believe)
 						* so we need to make sure we do not exceed the buffer.
 						* so we wont compress buffers that are so full that they might compress past the end of the buffer
 						* so we need to calculate the largest buffer that we will compress
 						*/
-						if (rsslSocketChannel->outCompression == RSSL_COMP_LZ4)
+						if (rsslSocketChannel->outCompFuncs->compressBound != 0)
 						{
 							RsslInt32 i = rsslSocketChannel->maxUserMsgSize;
 
-							while (LZ4_compressBound(i) > rsslSocketChannel->maxUserMsgSize && i > 0)
+							while ((*(rsslSocketChannel->outCompFuncs->compressBound))(i) > rsslSocketChannel->maxUserMsgSize && i > 0)
 							{
 								i--;
 							}
@@ -4319,7 +4374,7 @@ ripcSessInit ipcProcessHdr(RsslSocketChannel *rsslSocketChannel, ripcSessInProg
 							rsslSocketChannel->upperCompressionThreshold = i;
 
 							/* Create buffer to compress into and decompress from */
-							i = LZ4_compressBound(rsslSocketChannel->maxUserMsgSize);
+							i = (*(rsslSocketChannel->outCompFuncs->compressBound))(rsslSocketChannel->maxUserMsgSize);
 							i += 5; /* add in small fudge factor to ensure these buffers are larger than needed */
 							rsslSocketChannel->tempCompressBuf = rtr_smplcAllocMsg(gblInputBufs, i);
 							if (rsslSocketChannel->tempCompressBuf == 0)
@@ -4442,16 +4497,16 @@ ripcSessInit ipcProcessHdr(RsslSocketChannel *rsslSocketChannel, ripcSessInProg
 							}
 						}
 
-						/* LZ4 compression can sometimes grow data instead of shrinking it
+						/* LZ4 and zstd compression can sometimes grow data instead of shrinking it
 						*  the compression routine isnt smart enough to stop at the end of a buffer (yes, this is hard to believe)
 						* so we need to make sure we do not exceed the buffer.
 						* so we wont compress buffers that are so full that they might compress past the end of the buffer
 						* so we need to calculate the largest buffer that we will compress
 						*/
-						if (rsslSocketChannel->outCompression == RSSL_COMP_LZ4)
+						if (rsslSocketChannel->outCompFuncs->compressBound != 0)
 						{
 							RsslInt32 i = rsslSocketChannel->maxUserMsgSize;
-							while (LZ4_compressBound(i) > rsslSocketChannel->maxUserMsgSize && i > 0)
+							while ((*(rsslSocketChannel->outCompFuncs->compressBound))(i) > rsslSocketChannel->maxUserMsgSize && i > 0)
 							{
 								i--;
 							}
@@ -4467,7 +4522,7 @@ ripcSessInit ipcProcessHdr(RsslSocketChannel *rsslSocketChannel, ripcSessInProg
 							/* this is the threshold that we will not compress directly into the output buffer, but use the intermediate */
 							rsslSocketChannel->upperCompressionThreshold = i;
 							/* Create buffer to compress into and decompress from */
-							i = LZ4_compressBound(rsslSocketChannel->maxUserMsgSize);
+							i = (*(rsslSocketChannel->outCompFuncs->compressBound))(rsslSocketChannel->maxUserMsgSize);
 							i += 5; /* add in small fudge factor to ensure these buffers are larger than needed */
 							rsslSocketChannel->tempCompressBuf = rtr_smplcAllocMsg(gblInputBufs, i);
 							if (rsslSocketChannel->tempCompressBuf == 0)
@@ -5730,6 +5785,9 @@ static ripcSessInit ipcFinishSess(RsslSocketChannel *rsslSocketChannel, ripcSess
 			case RSSL_COMP_LZ4:
 				rsslSocketChannel->lowerCompressionThreshold = RSSL_COMP_DFLT_THRESHOLD_LZ4;
 				break;
+			case RSSL_COMP_ZSTD:
+				rsslSocketChannel->lowerCompressionThreshold = RSSL_COMP_DFLT_THRESHOLD_ZSTD;
+				break;
 			default:
 				break;
 			}
@@ -6014,6 +6072,9 @@ static ripcSessInit ipcWaitClientKey(RsslSocketChannel *rsslSocketChannel, ripcS
 		case RSSL_COMP_LZ4:
 			rsslSocketChannel->lowerCompressionThreshold = RSSL_COMP_DFLT_THRESHOLD_LZ4;
 			break;
+		case RSSL_COMP_ZSTD:
+			rsslSocketChannel->lowerCompressionThreshold = RSSL_COMP_DFLT_THRESHOLD_ZSTD;
+			break;
 		default:
 			break;
 		}
@@ -7127,15 +7188,15 @@ ripcSessInit ipcWaitAck(RsslSocketChannel *rsslSocketChannel, ripcSessInProg *in
 			rsslSocketChannel->inDecompress = comp;
 			rsslSocketChannel->outCompression = comp;
 
-			/* LZ4 cannot compress and span multiple buffers when content grows as a result of compression.
+			/* LZ4 and zstd cannot compress and span multiple buffers when content grows as a result of compression.
 			* We want to know where the threshold for this is, and when it can grow we want to compress
 			* into a larger buffer and then split it across two buffers.
 			*/
-			if (comp == RSSL_COMP_LZ4)
+			if (compressFuncs[comp].compressBound != 0)
 			{
 				RsslInt32 i = maxMsgSize;
 
-				while (LZ4_compressBound(i) > maxMsgSize && i > 0)
+				while ((*(compressFuncs[comp].compressBound))(i) > maxMsgSize && i > 0)
 				{
 					i--;
 				}
@@ -7152,7 +7213,7 @@ ripcSessInit ipcWaitAck(RsslSocketChannel *rsslSocketChannel, ripcSessInProg *in
 				rsslSocketChannel->upperCompressionThreshold = i;
 
 				/* Create buffer to compress into and decompress from */
-				i = LZ4_compressBound(maxMsgSize);
+				i = (*(compressFuncs[comp].compressBound))(maxMsgSize);
 				i += 5; /* add in small fudge factor to ensure these buffers are larger than needed */
 				rsslSocketChannel->tempCompressBuf = rtr_smplcAllocMsg(gblInputBufs, i);
 				if (rsslSocketChannel->tempCompressBuf == 0)
@@ -7352,6 +7413,9 @@ ripcSessInit ipcWaitAck(RsslSocketChannel *rsslSocketChannel, ripcSessInProg *in
 			case RSSL_COMP_LZ4:
 				rsslSocketChannel->lowerCompressionThreshold = RSSL_COMP_DFLT_THRESHOLD_LZ4;
 				break;
+			case RSSL_COMP_ZSTD:
+				rsslSocketChannel->lowerCompressionThreshold = RSSL_COMP_DFLT_THRESHOLD_ZSTD;
+				break;
 			default:
 				break;
 			}
@@ -7531,6 +7595,8 @@ RsslRet rsslSocketBind(rsslServerImpl* rsslSrvrImpl, RsslBindOptions *opts, Rssl
 	else
 		rsslServerSocketChannel->tcp_nodelay = 0;
 
+	rsslServerSocketChannel->ioEngine = opts->tcpOpts.ioEngine;
+
 	if (opts->maxOutputBuffers < opts->guaranteedOutputBuffers)
 		rsslServerSocketChannel->maxNumMsgs = opts->guaranteedOutputBuffers;
 	else
@@ -7555,6 +7621,10 @@ RsslRet rsslSocketBind(rsslServerImpl* rsslSrvrImpl, RsslBindOptions *opts, Rssl
 	    (void) RSSL_MUTEX_INIT_RTSDK(&rsslSrvrImpl->sharedBufPoolMutex);
 		rsslSrvrImpl->hasSharedBufPool = RSSL_TRUE;
 		serverPool = ipcCreatePool(poolSize, &(rsslSrvrImpl->sharedBufPoolMutex));
+
+		/* The caches are only useful when several threads share the pool. */
+		if (serverPool && opts->sharedPoolThreadCacheSize > 0)
+			rtr_dfltcSetThreadCacheSize(serverPool, (int)opts->sharedPoolThreadCacheSize);
 	}
 	else
 	{
@@ -8011,6 +8081,8 @@ RsslRet rsslSocketConnect(rsslChannelImpl* rsslChnlImpl, RsslConnectOptions *opt
 	else
 		rsslSocketChannel->tcp_nodelay = 0;
 
+	rsslSocketChannel->ioEngine = opts->tcpOpts.ioEngine;
+
 	rsslSocketChannel->numInputBufs = opts->numInputBuffers;
 
 	rsslSocketChannel->encryptionProtocolFlags = opts->encryptionOpts.encryptionProtocolFlags;
@@ -8043,7 +8115,10 @@ RsslRet rsslSocketConnect(rsslChannelImpl* rsslChnlImpl, RsslConnectOptions *opt
 
 	//set rsslSocketChannel->mutex when global lock and per-channel locks enabled
 	if (multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL)
+	{
 		rsslSocketChannel->mutex = &(rsslChnlImpl->chanMutex);
+		rsslSocketChannel->readMutex = &(rsslChnlImpl->chanReadMutex);
+	}
 
 	rsslChnlImpl->transportInfo = rsslSocketChannel;
 
@@ -8103,7 +8178,7 @@ RsslRet rsslSocketConnect(rsslChannelImpl* rsslChnlImpl, RsslConnectOptions *opt
 	switch (rsslSocketChannel->connType)
 	{
 	case RSSL_CONN_TYPE_SOCKET:
-		rsslSocketChannel->transportFuncs = &(transFuncs[RSSL_CONN_TYPE_SOCKET]);
+		rsslSocketChannel->transportFuncs = ipcGetSocketTransFuncs(rsslSocketChannel);
 		rsslSocketChannel->protocolFuncs = &(protHdrFuncs[RSSL_CONN_TYPE_SOCKET]);
 		break;
 	case RSSL_CONN_TYPE_EXT_LINE_SOCKET:
@@ -8314,6 +8389,7 @@ RsslRet rsslSocketConnect(rsslChannelImpl* rsslChnlImpl, RsslConnectOptions *opt
 	/* set up the compression bitfield whicseh tells the server which compression types we would like to use */
 	/* for now we can only set one compression type */
 	/* not sure why we are indexing into compressionBitmap since its an array of only 1 byte */
+	if (rsslSocketChannel->compression <= RSSL_COMP_MAX_TYPE)
 	{
 		RsslInt16 idx = ripccompressions[rsslSocketChannel->compression][RSSL_COMP_BYTEINDEX];
 		if (idx < RSSL_COMP_BITMAP_SIZE)
@@ -8619,7 +8695,8 @@ static RsslSocketChannel *ipcClientChannel(rsslServerImpl* serverImpl, RsslError
 	case RSSL_CONN_TYPE_HTTP:
 	case RSSL_CONN_TYPE_WEBSOCKET:
 		rsslSocketChannel->connType = RSSL_CONN_TYPE_SOCKET;
-		rsslSocketChannel->transportFuncs = &(transFuncs[rsslSocketChannel->connType]);
+		rsslSocketChannel->ioEngine = rsslServerSocketChannel->ioEngine;
+		rsslSocketChannel->transportFuncs = ipcGetSocketTransFuncs(rsslSocketChannel);
 		rsslSocketChannel->protocolFuncs = &(protHdrFuncs[rsslSocketChannel->connType]);
 		break;
 	case RSSL_CONN_TYPE_EXT_LINE_SOCKET:
@@ -8875,7 +8952,10 @@ rsslChannelImpl* rsslSocketAccept(rsslServerImpl *rsslSrvrImpl, RsslAcceptOption
 	{
 		//set rsslSocketChannel->mutex when global lock and per-channel locks enabled
 		if (multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL)
+		{
 			rsslSocketChannel->mutex = &(rsslChnlImpl->chanMutex);
+			rsslSocketChannel->readMutex = &(rsslChnlImpl->chanReadMutex);
+		}
 
 		/*Add callback to the socket channel*/
 		rsslSocketChannel->httpCallback = rsslServerSocketChannel->httpCallback;
@@ -9182,12 +9262,19 @@ RSSL_RSSL_SOCKET_IMPL_FAST(RsslBuffer*) rsslSocketRead(rsslChannelImpl* rsslChnl
 	if (multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL)
 	{
 
-		_DEBUG_MUTEX_TRACE("RSSL_MUTEX_LOCK", rsslChnlImpl, rsslChnlImpl->chanMutex)
-	  if (RSSL_MUTEX_LOCK(&rsslChnlImpl->chanMutex))
+		_DEBUG_MUTEX_TRACE("RSSL_MUTEX_LOCK", rsslChnlImpl, rsslChnlImpl->chanReadMutex)
+	  if (RSSL_MUTEX_LOCK(&rsslChnlImpl->chanReadMutex))
 	  {
 		*readRet = RSSL_RET_READ_IN_PROGRESS;
 		return NULL;
 	  }
+
+		/* Writers only take chanMutex, so the read lock alone is enough once the channel is split. */
+		if (!rsslSocketChannel->separateReadLock)
+		{
+		  (void) RSSL_MUTEX_LOCK(&rsslChnlImpl->chanMutex);
+			_DEBUG_MUTEX_TRACE("RSSL_MUTEX_LOCK", rsslChnlImpl, rsslChnlImpl->chanMutex)
+		}
 	}
 
 	/* if this channel has a returnBuffer - clean it */
@@ -9240,10 +9327,7 @@ RSSL_RSSL_SOCKET_IMPL_FAST(RsslBuffer*) rsslSocketRead(rsslChannelImpl* rsslChnl
 		}
 
 		if (multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL)
-		{
-		  (void) RSSL_MUTEX_UNLOCK(&rsslChnlImpl->chanMutex);
-			_DEBUG_MUTEX_TRACE("RSSL_MUTEX_UNLOCK", rsslChnlImpl, rsslChnlImpl->chanMutex)
-		}
+			IPC_READ_MUTEX_UNLOCK(rsslSocketChannel);
 
 		*readRet = ripcMoreData;
 
@@ -9354,10 +9438,7 @@ RSSL_RSSL_SOCKET_IMPL_FAST(RsslBuffer*) rsslSocketRead(rsslChannelImpl* rsslChnl
 			{
 				/* error */
 				if (multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL)
-				{
-				  (void) RSSL_MUTEX_UNLOCK(&rsslChnlImpl->chanMutex);
-					_DEBUG_MUTEX_TRACE("RSSL_MUTEX_UNLOCK", rsslChnlImpl, rsslChnlImpl->chanMutex)
-				}
+					IPC_READ_MUTEX_UNLOCK(rsslSocketChannel);
 
 				if (rsslAssemblyBuf)
 					_rsslFree(rsslAssemblyBuf);
@@ -9447,6 +9528,10 @@ RSSL_RSSL_SOCKET_IMPL_FAST(RsslBuffer*) rsslSocketRead(rsslChannelImpl* rsslChnl
 					*readRet = ripcMoreData;
 				else
 					*readRet = RSSL_RET_READ_PING;
+
+				if (multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL)
+					IPC_READ_MUTEX_UNLOCK(rsslSocketChannel);
+
 				return NULL;
 			}
 
@@ -9461,10 +9546,7 @@ RSSL_RSSL_SOCKET_IMPL_FAST(RsslBuffer*) rsslSocketRead(rsslChannelImpl* rsslChnl
 			{
 				/* error */
 				if (multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL)
-				{
-				  (void) RSSL_MUTEX_UNLOCK(&rsslChnlImpl->chanMutex);
-					_DEBUG_MUTEX_TRACE("RSSL_MUTEX_UNLOCK", rsslChnlImpl, rsslChnlImpl->chanMutex)
-				}
+					IPC_READ_MUTEX_UNLOCK(rsslSocketChannel);
 
 				if (rsslAssemblyBuf)
 					_rsslFree(rsslAssemblyBuf);
@@ -9505,10 +9587,7 @@ RSSL_RSSL_SOCKET_IMPL_FAST(RsslBuffer*) rsslSocketRead(rsslChannelImpl* rsslChnl
 		}
 
 		if (multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL)
-		{
-			(void) RSSL_MUTEX_UNLOCK(&rsslChnlImpl->chanMutex);
-			_DEBUG_MUTEX_TRACE("RSSL_MUTEX_UNLOCK", rsslChnlImpl, rsslChnlImpl->chanMutex)
-		}
+			IPC_READ_MUTEX_UNLOCK(rsslSocketChannel);
 
 		if (ripcMoreData)
 		{
@@ -9563,10 +9642,7 @@ RSSL_RSSL_SOCKET_IMPL_FAST(RsslBuffer*) rsslSocketRead(rsslChannelImpl* rsslChnl
 				error->channel = &rsslChnlImpl->Channel;
 
 				if (multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL)
-				{
-				  (void) RSSL_MUTEX_UNLOCK(&rsslChnlImpl->chanMutex);
-					_DEBUG_MUTEX_TRACE("RSSL_MUTEX_UNLOCK", rsslChnlImpl, rsslChnlImpl->chanMutex)
-				}
+					IPC_READ_MUTEX_UNLOCK(rsslSocketChannel);
 				*readRet = ipcReadRet;
 				return NULL;
 
@@ -9575,10 +9651,7 @@ RSSL_RSSL_SOCKET_IMPL_FAST(RsslBuffer*) rsslSocketRead(rsslChannelImpl* rsslChnl
 				rsslChnlImpl->Channel.socketId = (RsslSocket)rsslSocketChannel->stream;
 
 				if (multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL)
-				{
-				  (void) RSSL_MUTEX_UNLOCK(&rsslChnlImpl->chanMutex);
-					_DEBUG_MUTEX_TRACE("RSSL_MUTEX_UNLOCK", rsslChnlImpl, rsslChnlImpl->chanMutex)
-				}
+					IPC_READ_MUTEX_UNLOCK(rsslSocketChannel);
 				*readRet = ipcReadRet;
 				return NULL;
 
@@ -9592,10 +9665,7 @@ RSSL_RSSL_SOCKET_IMPL_FAST(RsslBuffer*) rsslSocketRead(rsslChannelImpl* rsslChnl
 				}
 
 				if (multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL)
-				{
-				  (void) RSSL_MUTEX_UNLOCK(&rsslChnlImpl->chanMutex);
-					_DEBUG_MUTEX_TRACE("RSSL_MUTEX_UNLOCK", rsslChnlImpl, rsslChnlImpl->chanMutex)
-				}
+					IPC_READ_MUTEX_UNLOCK(rsslSocketChannel);
 				*readRet = 1;
 				return NULL;
 
@@ -9607,19 +9677,13 @@ RSSL_RSSL_SOCKET_IMPL_FAST(RsslBuffer*) rsslSocketRead(rsslChannelImpl* rsslChnl
 				}
 
 				if (multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL)
-				{
-				  (void) RSSL_MUTEX_UNLOCK(&rsslChnlImpl->chanMutex);
-					_DEBUG_MUTEX_TRACE("RSSL_MUTEX_UNLOCK", rsslChnlImpl, rsslChnlImpl->chanMutex)
-				}
+					IPC_READ_MUTEX_UNLOCK(rsslSocketChannel);
 				*readRet = ipcReadRet;
 				return NULL;
 
 			default: /* should never get here */
 				if (multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL)
-				{
-				  (void) RSSL_MUTEX_UNLOCK(&rsslChnlImpl->chanMutex);
-					_DEBUG_MUTEX_TRACE("RSSL_MUTEX_UNLOCK", rsslChnlImpl, rsslChnlImpl->chanMutex)
-				}
+					IPC_READ_MUTEX_UNLOCK(rsslSocketChannel);
 				*readRet = RSSL_RET_FAILURE;
 				return NULL;
 		}
@@ -10398,6 +10462,7 @@ RSSL_RSSL_SOCKET_IMPL_FAST(RsslRet) rsslSocketGetSrvrInfo(rsslServerImpl *rsslSr
 
 		info->currentBufferUsage = rtr_dfltcpool->numRegBufsUsed;
 		info->peakBufferUsage = rtr_dfltcpool->peakNumBufsUsed;
+		rtr_dfltcGetThreadCacheStats(rsslServerSocketChannel->sharedBufPool, &info->threadCacheHits, &info->threadCacheMisses);
 	}
 	else
 	{
@@ -10574,7 +10639,7 @@ RSSL_RSSL_SOCKET_FAST(RsslRet) rsslSocketIoctl(rsslChannelImpl *rsslChnlImpl, Rs
 
 	RsslSocketChannel*	rsslSocketChannel = (RsslSocketChannel*)rsslChnlImpl->transportInfo;
 
-	IPC_MUTEX_LOCK(rsslSocketChannel);
+	IPC_ALL_MUTEX_LOCK(rsslSocketChannel);
 
 	if (rsslSocketChannel->workState & RIPC_INT_SHTDOWN_PEND)
 	{
@@ -10583,7 +10648,7 @@ RSSL_RSSL_SOCKET_FAST(RsslRet) rsslSocketIoctl(rsslChannelImpl *rsslChnlImpl, Rs
 				"<%s:%d> Error: 1003 rsslSocketIoctl() failed due to channel shutting down.\n",
 				__FILE__, __LINE__);
 
-		IPC_MUTEX_UNLOCK(rsslSocketChannel);
+		IPC_ALL_MUTEX_UNLOCK(rsslSocketChannel);
 		return RSSL_RET_FAILURE;
 	}
 
@@ -10597,7 +10662,7 @@ RSSL_RSSL_SOCKET_FAST(RsslRet) rsslSocketIoctl(rsslChannelImpl *rsslChnlImpl, Rs
 					"<%s:%d> Error: 1003 rsslSocketIoctl() failed because the channel is not active.\n",
 					__FILE__, __LINE__);
 
-			IPC_MUTEX_UNLOCK(rsslSocketChannel);
+			IPC_ALL_MUTEX_UNLOCK(rsslSocketChannel);
 			return RSSL_RET_FAILURE;
 		}
 
@@ -10614,7 +10679,7 @@ RSSL_RSSL_SOCKET_FAST(RsslRet) rsslSocketIoctl(rsslChannelImpl *rsslChnlImpl, Rs
 					"<%s:%d> Error: 1001 rsslSocketIoctl() failed, could not change the number of shared output buffers from <%d> to <%d>\n.",
 					__FILE__, __LINE__, rsslSocketChannel->guarBufPool->maxPoolBufs, iValue);
 
-			IPC_MUTEX_UNLOCK(rsslSocketChannel);
+			IPC_ALL_MUTEX_UNLOCK(rsslSocketChannel);
 			return RSSL_RET_FAILURE;
 		}
 		break;
@@ -10627,7 +10692,7 @@ RSSL_RSSL_SOCKET_FAST(RsslRet) rsslSocketIoctl(rsslChannelImpl *rsslChnlImpl, Rs
 					"<%s:%d> Error: 1004 rsslSocketIoctl() failed, invalid value <%d>, value for guaranteed output buffers should be at least 1\n",
 					__FILE__, __LINE__, iValue);
 
-			IPC_MUTEX_UNLOCK(rsslSocketChannel);
+			IPC_ALL_MUTEX_UNLOCK(rsslSocketChannel);
 			return RSSL_RET_FAILURE;
 		}
 
@@ -10638,7 +10703,7 @@ RSSL_RSSL_SOCKET_FAST(RsslRet) rsslSocketIoctl(rsslChannelImpl *rsslChnlImpl, Rs
 					"<%s:%d> Error: 1001 rsslSocketIoctl() failed, could not change the number of output buffers from <%d> to <%d>.\n",
 					__FILE__, __LINE__, rsslSocketChannel->guarBufPool->bufpool.maxBufs, iValue);
 
-			IPC_MUTEX_UNLOCK(rsslSocketChannel);
+			IPC_ALL_MUTEX_UNLOCK(rsslSocketChannel);
 			return RSSL_RET_FAILURE;
 		}
 		break;
@@ -10653,7 +10718,7 @@ RSSL_RSSL_SOCKET_FAST(RsslRet) rsslSocketIoctl(rsslChannelImpl *rsslChnlImpl, Rs
 					"<%s:%d> Error: 1004 rsslSocketIoctl() failed, could not set the high water mark to <%d>, must be a postive number.\n",
 					__FILE__, __LINE__, iValue);
 
-			IPC_MUTEX_UNLOCK(rsslSocketChannel);
+			IPC_ALL_MUTEX_UNLOCK(rsslSocketChannel);
 			return RSSL_RET_FAILURE;
 		}
 		break;
@@ -10670,7 +10735,7 @@ RSSL_RSSL_SOCKET_FAST(RsslRet) rsslSocketIoctl(rsslChannelImpl *rsslChnlImpl, Rs
 					"<%s:%d> Error: 1002 Could not set number of system read buffers to (%d). System errno: (%d)\n",
 					__FILE__, __LINE__, iValue, errno);
 
-			IPC_MUTEX_UNLOCK(rsslSocketChannel);
+			IPC_ALL_MUTEX_UNLOCK(rsslSocketChannel);
 			return RSSL_RET_FAILURE;
 		}
 		break;
@@ -10687,7 +10752,7 @@ RSSL_RSSL_SOCKET_FAST(RsslRet) rsslSocketIoctl(rsslChannelImpl *rsslChnlImpl, Rs
 					"<%s:%d> Error: 1002 Could not set number of system write buffers to (%d). System errno: (%d)\n",
 					__FILE__, __LINE__, iValue, errno);
 
-			IPC_MUTEX_UNLOCK(rsslSocketChannel);
+			IPC_ALL_MUTEX_UNLOCK(rsslSocketChannel);
 			return RSSL_RET_FAILURE;
 		}
 		break;
@@ -10723,8 +10788,18 @@ RSSL_RSSL_SOCKET_FAST(RsslRet) rsslSocketIoctl(rsslChannelImpl *rsslChnlImpl, Rs
 	    if (rsslSocketChannel->outCompression == RSSL_COMP_NONE)
 		  break;
 
-		lowerThreshold = (rsslSocketChannel->outCompression == RSSL_COMP_ZLIB ?
-									RSSL_COMP_DFLT_THRESHOLD_ZLIB : RSSL_COMP_DFLT_THRESHOLD_LZ4);
+		switch (rsslSocketChannel->outCompression)
+		{
+		case RSSL_COMP_ZLIB:
+			lowerThreshold = RSSL_COMP_DFLT_THRESHOLD_ZLIB;
+			break;
+		case RSSL_COMP_ZSTD:
+			lowerThreshold = RSSL_COMP_DFLT_THRESHOLD_ZSTD;
+			break;
+		default:
+			lowerThreshold = RSSL_COMP_DFLT_THRESHOLD_LZ4;
+			break;
+		}
 		if(iValue >= lowerThreshold)
 			rsslSocketChannel->lowerCompressionThreshold = iValue;
 		else
@@ -10734,7 +10809,7 @@ RSSL_RSSL_SOCKET_FAST(RsslRet) rsslSocketIoctl(rsslChannelImpl *rsslChnlImpl, Rs
 					"<%s,%d> Error: 1004 rsslSocketIoctl() failed, could not set the compression threshold mark to <%d>, must be equal or greater than %d bytes\n",
 					__FILE__, __LINE__, iValue, lowerThreshold);
 
-			IPC_MUTEX_UNLOCK(rsslSocketChannel);
+			IPC_ALL_MUTEX_UNLOCK(rsslSocketChannel);
 			return RSSL_RET_FAILURE;
 		}
 	}
@@ -10817,7 +10892,7 @@ RSSL_RSSL_SOCKET_FAST(RsslRet) rsslSocketIoctl(rsslChannelImpl *rsslChnlImpl, Rs
 					"<%s:%d> Error: 1004 rsslSocketIoctl() failed, flush strategy <%s> minimally needs to contain both 'H' and 'M'\n",
 					__FILE__, __LINE__, tempFlushStrat);
 
-			IPC_MUTEX_UNLOCK(rsslSocketChannel);
+			IPC_ALL_MUTEX_UNLOCK(rsslSocketChannel);
 			return RSSL_RET_FAILURE;
 		}
 		break;
@@ -10832,7 +10907,7 @@ RSSL_RSSL_SOCKET_FAST(RsslRet) rsslSocketIoctl(rsslChannelImpl *rsslChnlImpl, Rs
 					"<%s:%d> Error: 1004 rsslSocketIoctl() failed, Certificate revocation applies only to Windows platform tunneling connections.\n",
 					__FILE__, __LINE__);
 
-			IPC_MUTEX_UNLOCK(rsslSocketChannel);
+			IPC_ALL_MUTEX_UNLOCK(rsslSocketChannel);
 			return RSSL_RET_FAILURE;
 		}
 		break;
@@ -10843,12 +10918,12 @@ RSSL_RSSL_SOCKET_FAST(RsslRet) rsslSocketIoctl(rsslChannelImpl *rsslChnlImpl, Rs
 				"<%s:%d> Error: 0017 rsslSocketIoctl() failed, invalid IOCtl code <%d>\n",
 				__FILE__, __LINE__, code);
 
-		IPC_MUTEX_UNLOCK(rsslSocketChannel);
+		IPC_ALL_MUTEX_UNLOCK(rsslSocketChannel);
 		return RSSL_RET_FAILURE;
 		break;
 	}
 
-	IPC_MUTEX_UNLOCK(rsslSocketChannel);
+	IPC_ALL_MUTEX_UNLOCK(rsslSocketChannel);
 
 	return RSSL_RET_SUCCESS;
 }
@@ -11056,6 +11131,7 @@ RsslInt32 ipcInitialize(RsslInt32 numServers, RsslInt32 numClients, RsslInitiali
 		}
 
 		ipcSetSockFuncs();
+		ipcSetUringFuncs();
 
 		for (i = 0; i <= RSSL_COMP_MAX_TYPE; i++)
 		{
@@ -11065,10 +11141,16 @@ RsslInt32 ipcInitialize(RsslInt32 numServers, RsslInt32 numClients, RsslInitiali
 			compressFuncs[i].decompressEnd = 0;
 			compressFuncs[i].compress = 0;
 			compressFuncs[i].decompress = 0;
+			compressFuncs[i].compressBound = 0;
 		}
 
 		ripcInitZlibComp();
 		ripcInitLz4Comp();
+		if (ripcInitZstdComp(&initOpts->compressionDictionary, error) != RSSL_RET_SUCCESS)
+		{
+			ret = RSSL_RET_FAILURE;
+			goto ripcinitend;
+		}
 
 		/* initialize open SSL library */
 		/* Copy the ssl and crypto lib name config */
@@ -11183,6 +11265,8 @@ ripcinitend:
 	{
 		transOpts.initCurlDebug = RSSL_FALSE;
 
+		ripcCleanupZstdComp();
+
 		if (transOpts.initConfig)
 		{
 			free(transOpts.initConfig);
@@ -11290,6 +11374,8 @@ RsslInt32 ipcCleanup()
 				(*(transFuncs[i].uninitialize))();
 		}
 
+		ripcCleanupZstdComp();
+
 		if (transOpts.initConfig)
 		{
 			free(transOpts.initConfig);
@@ -11700,12 +11786,12 @@ RsslInt32 ipcShutdownSockectChannel(RsslSocketChannel* rsslSocketChannel, RsslEr
 	if (IPC_NULL_PTR(rsslSocketChannel,"ipcShutdownSockectChannel","socket",error))
 		return RSSL_RET_FAILURE;
 
-	IPC_MUTEX_LOCK(rsslSocketChannel);
+	IPC_ALL_MUTEX_LOCK(rsslSocketChannel);
 
 	/* clear up the socket struct */
 	rsslSocketChannelClose(rsslSocketChannel);
 
-	IPC_MUTEX_UNLOCK(rsslSocketChannel);
+	IPC_ALL_MUTEX_UNLOCK(rsslSocketChannel);
 
 	return(1);
 }
@@ -11745,7 +11831,7 @@ ripcSessInit ipcSessionInit(RsslSocketChannel *rsslSocketChannel, ripcSessInProg
 	if (IPC_NULL_PTR(rsslSocketChannel,"ipcSessionInit","socket",error))
 		return(RIPC_CONN_ERROR);
 
-	IPC_MUTEX_LOCK(rsslSocketChannel);
+	IPC_ALL_MUTEX_LOCK(rsslSocketChannel);
 
 	if (rsslSocketChannel->workState & RIPC_INT_SHTDOWN_PEND)
 	{
@@ -11756,7 +11842,7 @@ ripcSessInit ipcSessionInit(RsslSocketChannel *rsslSocketChannel, ripcSessInProg
 				"<%s:%d> Error: 1003 ipcSessionInit failed due to channel shutting down.\n",
 				__FILE__, __LINE__);
 
-		IPC_MUTEX_UNLOCK(rsslSocketChannel);
+		IPC_ALL_MUTEX_UNLOCK(rsslSocketChannel);
 
 		return RSSL_RET_FAILURE;
 	}
@@ -11771,15 +11857,24 @@ ripcSessInit ipcSessionInit(RsslSocketChannel *rsslSocketChannel, ripcSessInProg
 
 			if((ret = ipcIntSessInit(rsslSocketChannel,inPr,error)) < 0)
 			{
-				IPC_MUTEX_UNLOCK(rsslSocketChannel);
+				IPC_ALL_MUTEX_UNLOCK(rsslSocketChannel);
 				return(ret);
 			}
 
 			rsslSocketChannel->workState &= ~RIPC_INT_READ_THR;
+
+			/* Once active, readers of a plain socket channel no longer need the write lock.
+			 * WebSocket, encrypted and HTTP channels can write from their read path(pongs, close
+			 * frames, TLS renegotiation, tunnel reconnects), so their readers keep taking it. */
+			if ((ret == RIPC_CONN_ACTIVE) && rsslSocketChannel->readMutex &&
+				(rsslSocketChannel->connType == RSSL_CONN_TYPE_SOCKET) &&
+				(rsslSocketChannel->rwsSession == 0) &&
+				(rsslSocketChannel->protocolType != RIPC_JSON_PROTOCOL_TYPE))
+				rsslSocketChannel->separateReadLock = RSSL_TRUE;
 		}
 	}
 
-	IPC_MUTEX_UNLOCK(rsslSocketChannel);
+	IPC_ALL_MUTEX_UNLOCK(rsslSocketChannel);
 
 	return(ret);
 }
@@ -11906,6 +12001,12 @@ RSSL_RSSL_SOCKET_IMPL_FAST(void) ripcRelSocketChannel(RsslSocketChannel *rsslSoc
 		rsslQueueRemoveLink(&activeSocketChannelList, &(rsslSocketChannel->link1));
 	}
 
+	if (rsslSocketChannel->usesUring)
+	{
+		ipcUringRemoveChannel();
+		rsslSocketChannel->usesUring = RSSL_FALSE;
+	}
+
     if (rsslSocketChannel->guarBufPool)
 	{
 		int i;
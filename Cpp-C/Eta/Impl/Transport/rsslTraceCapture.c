@@ -0,0 +1,641 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2022 Refinitiv. All rights reserved.              --
+ *|-----------------------------------------------------------------------------
+ */
+
+#include "rtr/rsslTraceCapture.h"
+#include "rtr/rsslThread.h"
+#include "rtr/rsslErrors.h"
+#include "rtr/rsslEventSignal.h"
+#include "rtr/rtratomic.h"
+#include "xmlDump.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+
+#if defined(_WIN32)
+#include <Windows.h>
+#else
+#include <time.h>
+#include <unistd.h>
+#include <sys/select.h>
+#endif
+
+/* 33 additional chars to hold time stamps, as for XML trace files */
+#define CAPTURE_TIME_STAMP_SIZE 33
+
+#define CAPTURE_FORMAT_VERSION 1
+
+/* Largest message accepted when reading a capture file. */
+#define CAPTURE_MAX_MSG_SIZE 0x40000000
+
+#define CAPTURE_CACHE_LINE 64
+#define CAPTURE_RING_ALIGN 8
+
+/* Header of each record in a capture's ring. The data that follows is the record as it is written to the file. */
+typedef struct
+{
+	RsslUInt32	size;		/* Bytes the record takes in the ring, including this header and the padding after the data */
+	RsslUInt32	length;		/* Bytes of data; 0 for the padding left at the end of the ring */
+} captureRingRecord;
+
+#define CAPTURE_RING_RECORD_SIZE(___length) \
+	(((RsslUInt32)sizeof(captureRingRecord) + (___length) + CAPTURE_RING_ALIGN - 1) & ~(RsslUInt32)(CAPTURE_RING_ALIGN - 1))
+
+/* Positions in the ring are byte counts that wrap around at 2^32. The ring is much smaller,
+ * so the difference between two positions is the number of bytes between them. */
+struct rsslTraceCapture {
+	rsslTraceCapture	*next;				/* Next capture in the writer thread's list */
+	char				*ring;				/* RSSL_TRACE_CAPTURE_RING_SIZE bytes of records */
+	rtr_atomic_val		head;				/* Bytes published by the tracing thread */
+	char				pad0[CAPTURE_CACHE_LINE - sizeof(rtr_atomic_val)];
+	rtr_atomic_val		tail;				/* Bytes written out by the writer thread */
+	char				pad1[CAPTURE_CACHE_LINE - sizeof(rtr_atomic_val)];
+	rtr_atomic_val		closing;			/* Set when the channel is done with the capture */
+	rtr_atomic_val		closed;				/* Set by the writer thread once the ring is written out and the file is closed */
+
+	/* Used only by the tracing thread. */
+	RsslUInt32			reservedHead;		/* head once the record reserved last is published */
+	RsslUInt32			cachedTail;			/* Last tail seen */
+	RsslUInt32			droppedCount;		/* Messages dropped since the last one that fit */
+	char				droppedHeader[RSSL_CAPTURE_RECORD_HEADER_SIZE];	/* Header of the last message dropped */
+
+	/* Used only by the writer thread, after the capture is opened. */
+	FILE				*file;
+	RsslInt64			fileSize;
+	RsslInt64			maxFileSize;
+	RsslBool			multipleFiles;
+	char				*fileBaseName;
+	char				*fileName;
+};
+
+/* Captures being written, and the thread that writes them. The thread exits when the list is empty. */
+static RSSL_STATIC_MUTEX_DECL(captureListMutex);
+static rsslTraceCapture *captureList = NULL;
+static RsslBool writerThreadRunning = RSSL_FALSE;
+
+/* Set by the writer thread before it waits for records; whoever clears it notifies captureSignal.
+ * The signal is created with the first capture and kept, so that a tracing thread can still
+ * notify it while the writer thread is exiting. */
+static rtr_atomic_val captureWriterWaiting = 0;
+static RsslEventSignal captureSignal;
+static RsslBool captureSignalInitialized = RSSL_FALSE;
+
+static void captureSleep()
+{
+#if defined(_WIN32)
+	Sleep(1);
+#else
+	usleep(1000);
+#endif
+}
+
+/* Reads a value written by the other thread. The compare and swap never changes it, and keeps
+ * the records from being read before it. */
+RTR_C_ALWAYS_INLINE RsslUInt32 captureLoad(rtr_atomic_val *pValue)
+{
+	return (RsslUInt32)RTR_ATOMIC_COMPARE_AND_SWAP(*pValue, 0, 0);
+}
+
+/* Wakes the writer thread if it is waiting. The caller has just published with an exchange,
+ * which also orders the publish before the read of captureWriterWaiting. */
+RTR_C_ALWAYS_INLINE void captureWakeWriter()
+{
+	if (captureWriterWaiting && RTR_ATOMIC_COMPARE_AND_SWAP(captureWriterWaiting, 1, 0) == 1)
+		(void)rsslNotifyEventSignal(&captureSignal);
+}
+
+/* Waits until a tracing thread notifies captureSignal. */
+static void captureWait()
+{
+	int fd = rsslGetEventSignalFD(&captureSignal);
+	fd_set readFds;
+
+	FD_ZERO(&readFds);
+	FD_SET(fd, &readFds);
+	(void)select(fd + 1, &readFds, NULL, NULL, NULL);
+	(void)rsslDrainEventSignal(&captureSignal);
+}
+
+static RsslUInt64 captureGetTimestamp()
+{
+#if defined(_WIN32)
+	FILETIME fileTime;
+	ULARGE_INTEGER time;
+
+	GetSystemTimePreciseAsFileTime(&fileTime);
+	time.LowPart = fileTime.dwLowDateTime;
+	time.HighPart = fileTime.dwHighDateTime;
+
+	/* File times are in 100ns units since January 1st, 1601. */
+	return (time.QuadPart - 116444736000000000ULL) * 100;
+#else
+	struct timespec ts;
+
+	clock_gettime(CLOCK_REALTIME, &ts);
+	return (RsslUInt64)ts.tv_sec * 1000000000ULL + (RsslUInt64)ts.tv_nsec;
+#endif
+}
+
+RTR_C_ALWAYS_INLINE void capturePut32(char *pData, RsslUInt32 value)
+{
+	pData[0] = (char)(value >> 24);
+	pData[1] = (char)(value >> 16);
+	pData[2] = (char)(value >> 8);
+	pData[3] = (char)value;
+}
+
+RTR_C_ALWAYS_INLINE void capturePut64(char *pData, RsslUInt64 value)
+{
+	capturePut32(pData, (RsslUInt32)(value >> 32));
+	capturePut32(pData + 4, (RsslUInt32)value);
+}
+
+RTR_C_ALWAYS_INLINE RsslUInt32 captureGet32(const char *pData)
+{
+	const unsigned char *pBytes = (const unsigned char*)pData;
+
+	return ((RsslUInt32)pBytes[0] << 24) | ((RsslUInt32)pBytes[1] << 16) | ((RsslUInt32)pBytes[2] << 8) | pBytes[3];
+}
+
+RTR_C_ALWAYS_INLINE RsslUInt64 captureGet64(const char *pData)
+{
+	return ((RsslUInt64)captureGet32(pData) << 32) | captureGet32(pData + 4);
+}
+
+/* Opens the file and writes the file header, unless the file already has one. */
+static FILE *captureOpenFile(const char *fileName)
+{
+	char header[RSSL_CAPTURE_FILE_HEADER_SIZE];
+	FILE *file;
+
+	if ((file = fopen(fileName, "ab")) == NULL)
+		return NULL;
+
+	if (fseek(file, 0, SEEK_END) == 0 && ftell(file) == 0)
+	{
+		memcpy(header, RSSL_CAPTURE_FILE_MAGIC, 8);
+		header[8] = 0;
+		header[9] = CAPTURE_FORMAT_VERSION;
+		header[10] = 0;
+		header[11] = RSSL_CAPTURE_RECORD_HEADER_SIZE;
+		capturePut32(header + 12, 0);
+
+		if (fwrite(header, 1, sizeof(header), file) != sizeof(header))
+		{
+			fclose(file);
+			return NULL;
+		}
+	}
+
+	return file;
+}
+
+/* Closes the full file and, if multiple files are wanted, starts the next one. */
+static void captureRotateFile(rsslTraceCapture *pCapture)
+{
+	unsigned long long hour = 0, min = 0, sec = 0, msec = 0;
+
+	fclose(pCapture->file);
+	pCapture->file = NULL;
+
+	if (!pCapture->multipleFiles)
+		return;
+
+	/* The new file name is the original file name with the time in milliseconds and the ".rwfcap" extension appended. */
+	xmlGetTimeFromEpoch(&hour, &min, &sec, &msec);
+	snprintf(pCapture->fileName, strlen(pCapture->fileBaseName) + CAPTURE_TIME_STAMP_SIZE, "%s%03llu.rwfcap", pCapture->fileBaseName, msec);
+
+	if ((pCapture->file = captureOpenFile(pCapture->fileName)) != NULL)
+		pCapture->fileSize = ftell(pCapture->file);
+}
+
+/* Writes out the records published in the capture's ring. Returns RSSL_TRUE if there were any. */
+static RsslBool captureWriteRecords(rsslTraceCapture *pCapture)
+{
+	RsslUInt32 tail = (RsslUInt32)pCapture->tail;
+	RsslUInt32 head = captureLoad(&pCapture->head);
+
+	if (head == tail)
+		return RSSL_FALSE;
+
+	while (tail != head)
+	{
+		captureRingRecord *pRecord = (captureRingRecord*)(pCapture->ring + (tail & (RSSL_TRACE_CAPTURE_RING_SIZE - 1)));
+
+		if (pRecord->length)
+		{
+			if (pCapture->file != NULL && pCapture->fileSize + pRecord->length > pCapture->maxFileSize)
+				captureRotateFile(pCapture);
+
+			if (pCapture->file != NULL)
+			{
+				if (fwrite((char*)(pRecord + 1), 1, pRecord->length, pCapture->file) == pRecord->length)
+					pCapture->fileSize += pRecord->length;
+			}
+		}
+
+		tail += pRecord->size;
+	}
+
+	RTR_ATOMIC_SET(pCapture->tail, (rtr_atomic_val)tail);
+
+	if (pCapture->file != NULL)
+		fflush(pCapture->file);
+
+	return RSSL_TRUE;
+}
+
+static void captureFree(rsslTraceCapture *pCapture)
+{
+	if (pCapture->file != NULL)
+		fclose(pCapture->file);
+	free(pCapture->fileName);
+	free(pCapture->fileBaseName);
+	free(pCapture->ring);
+	free(pCapture);
+}
+
+static RSSL_THREAD_DECLARE(captureWriterThread, pArg)
+{
+	RsslBool waiting = RSSL_FALSE;
+
+	for (;;)
+	{
+		rsslTraceCapture **ppCapture;
+		RsslBool wroteRecords = RSSL_FALSE;
+
+		RSSL_STATIC_MUTEX_LOCK(captureListMutex);
+
+		if (captureList == NULL)
+		{
+			writerThreadRunning = RSSL_FALSE;
+			RSSL_STATIC_MUTEX_UNLOCK(captureListMutex);
+			break;
+		}
+
+		ppCapture = &captureList;
+		while (*ppCapture != NULL)
+		{
+			rsslTraceCapture *pCapture = *ppCapture;
+
+			/* Reads closing before writing out the ring, so no record written before the close is missed. */
+			RsslBool closing = captureLoad(&pCapture->closing) ? RSSL_TRUE : RSSL_FALSE;
+
+			if (captureWriteRecords(pCapture))
+				wroteRecords = RSSL_TRUE;
+
+			if (closing)
+			{
+				*ppCapture = pCapture->next;
+				if (pCapture->file != NULL)
+				{
+					fclose(pCapture->file);
+					pCapture->file = NULL;
+				}
+				RTR_ATOMIC_SET(pCapture->closed, 1);
+				wroteRecords = RSSL_TRUE;
+			}
+			else
+				ppCapture = &pCapture->next;
+		}
+
+		RSSL_STATIC_MUTEX_UNLOCK(captureListMutex);
+
+		if (wroteRecords)
+		{
+			if (waiting)
+			{
+				RTR_ATOMIC_SET(captureWriterWaiting, 0);
+				waiting = RSSL_FALSE;
+			}
+		}
+		else if (!waiting)
+		{
+			/* Asks for a signal, then looks at the rings once more, so that a record published
+			 * before the request is not left waiting for the next one. */
+			RTR_ATOMIC_SET(captureWriterWaiting, 1);
+			waiting = RSSL_TRUE;
+		}
+		else
+		{
+			captureWait();
+			RTR_ATOMIC_SET(captureWriterWaiting, 0);
+			waiting = RSSL_FALSE;
+		}
+	}
+
+	RTR_ATOMIC_SET(captureWriterWaiting, 0);
+	return RSSL_THREAD_RETURN();
+}
+
+rsslTraceCapture *rsslTraceCaptureOpen(const char *fileName, const char *fileBaseName, RsslInt64 maxFileSize, RsslBool multipleFiles, RsslError *error)
+{
+	rsslTraceCapture *pCapture;
+	RsslThreadId threadId;
+
+	if ((pCapture = (rsslTraceCapture*)calloc(1, sizeof(rsslTraceCapture))) == NULL
+			|| (pCapture->ring = (char*)malloc(RSSL_TRACE_CAPTURE_RING_SIZE)) == NULL
+			|| (pCapture->fileBaseName = (char*)malloc(strlen(fileBaseName) + 1)) == NULL
+			|| (pCapture->fileName = (char*)malloc(strlen(fileBaseName) + CAPTURE_TIME_STAMP_SIZE)) == NULL)
+	{
+		if (pCapture)
+			captureFree(pCapture);
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslIoctl() Error: Unable to create memory for the binary capture\n", __FILE__, __LINE__);
+		return NULL;
+	}
+
+	strcpy(pCapture->fileBaseName, fileBaseName);
+	pCapture->maxFileSize = maxFileSize;
+	pCapture->multipleFiles = multipleFiles;
+
+	if ((pCapture->file = captureOpenFile(fileName)) == NULL)
+	{
+		captureFree(pCapture);
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslIoctl() Error: Unable to open file. fopen() failed\n", __FILE__, __LINE__);
+		return NULL;
+	}
+	pCapture->fileSize = ftell(pCapture->file);
+
+	RSSL_STATIC_MUTEX_LOCK(captureListMutex);
+
+	if (!captureSignalInitialized)
+	{
+		if (!rsslInitEventSignal(&captureSignal))
+		{
+			RSSL_STATIC_MUTEX_UNLOCK(captureListMutex);
+			captureFree(pCapture);
+			_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+			snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslIoctl() Error: Unable to create the binary capture writer thread's signal\n", __FILE__, __LINE__);
+			return NULL;
+		}
+		captureSignalInitialized = RSSL_TRUE;
+	}
+
+	pCapture->next = captureList;
+	captureList = pCapture;
+
+	if (!writerThreadRunning)
+	{
+		if (RSSL_THREAD_START(&threadId, captureWriterThread, NULL) != 0)
+		{
+			captureList = pCapture->next;
+			RSSL_STATIC_MUTEX_UNLOCK(captureListMutex);
+			captureFree(pCapture);
+			_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+			snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslIoctl() Error: Unable to start the binary capture writer thread\n", __FILE__, __LINE__);
+			return NULL;
+		}
+		RSSL_THREAD_DETACH(&threadId);
+		writerThreadRunning = RSSL_TRUE;
+	}
+	RSSL_STATIC_MUTEX_UNLOCK(captureListMutex);
+
+	return pCapture;
+}
+
+/* Reserves a record for length bytes of data, padding out the end of the ring first if the record
+ * does not fit there. Returns NULL if the ring does not have room. */
+static char *captureRingReserve(rsslTraceCapture *pCapture, RsslUInt32 length)
+{
+	RsslUInt32 head = (RsslUInt32)pCapture->head;
+	RsslUInt32 offset = head & (RSSL_TRACE_CAPTURE_RING_SIZE - 1);
+	RsslUInt32 size, padding;
+	captureRingRecord *pRecord;
+
+	if (length > RSSL_TRACE_CAPTURE_RING_SIZE / 2)
+		return NULL;
+
+	size = CAPTURE_RING_RECORD_SIZE(length);
+	padding = (offset + size > RSSL_TRACE_CAPTURE_RING_SIZE) ? RSSL_TRACE_CAPTURE_RING_SIZE - offset : 0;
+
+	if (head + padding + size - pCapture->cachedTail > RSSL_TRACE_CAPTURE_RING_SIZE)
+	{
+		pCapture->cachedTail = captureLoad(&pCapture->tail);
+		if (head + padding + size - pCapture->cachedTail > RSSL_TRACE_CAPTURE_RING_SIZE)
+			return NULL;
+	}
+
+	if (padding)
+	{
+		pRecord = (captureRingRecord*)(pCapture->ring + offset);
+		pRecord->size = padding;
+		pRecord->length = 0;
+		offset = 0;
+	}
+
+	pRecord = (captureRingRecord*)(pCapture->ring + offset);
+	pRecord->size = size;
+	pRecord->length = length;
+	pCapture->reservedHead = head + padding + size;
+	return (char*)(pRecord + 1);
+}
+
+/* Publishes the record reserved last. */
+RTR_C_ALWAYS_INLINE void captureRingCommit(rsslTraceCapture *pCapture)
+{
+	RTR_ATOMIC_SET(pCapture->head, (rtr_atomic_val)pCapture->reservedHead);
+	captureWakeWriter();
+}
+
+/* Reserves a record and fills in its header. */
+RTR_C_ALWAYS_INLINE char *captureReserve(rsslTraceCapture *pCapture, RsslUInt32 length, RsslUInt64 timestamp,
+		RsslUInt64 channelId, RsslUInt8 direction, RsslUInt8 protocolType, RsslUInt8 majorVersion, RsslUInt8 minorVersion)
+{
+	char *pHeader;
+
+	if ((pHeader = captureRingReserve(pCapture, RSSL_CAPTURE_RECORD_HEADER_SIZE + length)) == NULL)
+		return NULL;
+
+	capturePut32(pHeader, length);
+	capturePut64(pHeader + 4, timestamp);
+	capturePut64(pHeader + 12, channelId);
+	pHeader[20] = (char)direction;
+	pHeader[21] = (char)protocolType;
+	pHeader[22] = (char)majorVersion;
+	pHeader[23] = (char)minorVersion;
+	return pHeader + RSSL_CAPTURE_RECORD_HEADER_SIZE;
+}
+
+/* Records the number of messages dropped, with the header of the last one. Returns RSSL_FALSE if the ring is still full. */
+static RsslBool captureWriteDropped(rsslTraceCapture *pCapture)
+{
+	char *pRecordData;
+
+	if ((pRecordData = captureRingReserve(pCapture, RSSL_CAPTURE_RECORD_HEADER_SIZE + 4)) == NULL)
+		return RSSL_FALSE;
+
+	memcpy(pRecordData, pCapture->droppedHeader, RSSL_CAPTURE_RECORD_HEADER_SIZE);
+	capturePut32(pRecordData, 4);
+	pRecordData[20] = RSSL_CAPTURE_DROPPED;
+	capturePut32(pRecordData + RSSL_CAPTURE_RECORD_HEADER_SIZE, pCapture->droppedCount);
+	captureRingCommit(pCapture);
+
+	pCapture->droppedCount = 0;
+	return RSSL_TRUE;
+}
+
+void rsslTraceCaptureWrite(rsslTraceCapture *pCapture, RsslUInt64 channelId, RsslUInt8 direction, RsslUInt8 protocolType,
+		RsslUInt8 majorVersion, RsslUInt8 minorVersion, const RsslBuffer *pData)
+{
+	char *pRecordData;
+
+	if (pCapture->droppedCount && !captureWriteDropped(pCapture))
+		pRecordData = NULL;
+	else
+		pRecordData = captureReserve(pCapture, pData->length, captureGetTimestamp(), channelId, direction, protocolType, majorVersion, minorVersion);
+
+	if (pRecordData == NULL)
+	{
+		/* Keeps the header, in case this is the last message dropped. */
+		capturePut32(pCapture->droppedHeader, pData->length);
+		capturePut64(pCapture->droppedHeader + 4, captureGetTimestamp());
+		capturePut64(pCapture->droppedHeader + 12, channelId);
+		pCapture->droppedHeader[20] = (char)direction;
+		pCapture->droppedHeader[21] = (char)protocolType;
+		pCapture->droppedHeader[22] = (char)majorVersion;
+		pCapture->droppedHeader[23] = (char)minorVersion;
+		++pCapture->droppedCount;
+		return;
+	}
+
+	memcpy(pRecordData, pData->data, pData->length);
+	captureRingCommit(pCapture);
+}
+
+void rsslTraceCaptureClose(rsslTraceCapture *pCapture)
+{
+	/* Waits for room to record any messages dropped at the end. */
+	while (pCapture->droppedCount && !captureWriteDropped(pCapture))
+		captureSleep();
+
+	RTR_ATOMIC_SET(pCapture->closing, 1);
+	captureWakeWriter();
+
+	while (!captureLoad(&pCapture->closed))
+		captureSleep();
+
+	captureFree(pCapture);
+}
+
+/*** Reading capture files ***/
+
+struct RsslCaptureFile {
+	FILE				*file;
+	char				*data;
+	RsslUInt32			dataSize;
+	RsslCaptureRecord	record;
+};
+
+RSSL_API RsslCaptureFile* rsslOpenCaptureFile(const char *fileName, RsslError *error)
+{
+	RsslCaptureFile *pFile;
+	char header[RSSL_CAPTURE_FILE_HEADER_SIZE];
+
+	if ((pFile = (RsslCaptureFile*)calloc(1, sizeof(RsslCaptureFile))) == NULL)
+	{
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslOpenCaptureFile() Error: Unable to create memory for the capture file\n", __FILE__, __LINE__);
+		return NULL;
+	}
+
+	if ((pFile->file = fopen(fileName, "rb")) == NULL)
+	{
+		free(pFile);
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslOpenCaptureFile() Error: Unable to open file %s\n", __FILE__, __LINE__, fileName);
+		return NULL;
+	}
+
+	if (fread(header, 1, sizeof(header), pFile->file) != sizeof(header)
+			|| memcmp(header, RSSL_CAPTURE_FILE_MAGIC, 8) != 0
+			|| header[9] != CAPTURE_FORMAT_VERSION
+			|| header[11] != RSSL_CAPTURE_RECORD_HEADER_SIZE)
+	{
+		rsslCloseCaptureFile(pFile);
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslOpenCaptureFile() Error: %s is not a binary capture file of a supported version\n", __FILE__, __LINE__, fileName);
+		return NULL;
+	}
+
+	return pFile;
+}
+
+RSSL_API RsslCaptureRecord* rsslReadCaptureRecord(RsslCaptureFile *captureFile, RsslRet *readRet, RsslError *error)
+{
+	char header[RSSL_CAPTURE_RECORD_HEADER_SIZE];
+	size_t headerBytes;
+	RsslUInt32 length;
+
+	*readRet = RSSL_RET_SUCCESS;
+
+	if ((headerBytes = fread(header, 1, sizeof(header), captureFile->file)) != sizeof(header))
+	{
+		/* A file that ends between records is complete. */
+		if (headerBytes == 0 && feof(captureFile->file))
+			return NULL;
+
+		*readRet = RSSL_RET_FAILURE;
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslReadCaptureRecord() Error: The capture file ends in the middle of a record\n", __FILE__, __LINE__);
+		return NULL;
+	}
+
+	length = captureGet32(header);
+	if (length > CAPTURE_MAX_MSG_SIZE)
+	{
+		*readRet = RSSL_RET_FAILURE;
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslReadCaptureRecord() Error: Record length %u is not valid\n", __FILE__, __LINE__, length);
+		return NULL;
+	}
+
+	if (length > captureFile->dataSize)
+	{
+		char *pNewData;
+
+		if ((pNewData = (char*)realloc(captureFile->data, length)) == NULL)
+		{
+			*readRet = RSSL_RET_FAILURE;
+			_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+			snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslReadCaptureRecord() Error: Unable to create memory for a record of %u bytes\n", __FILE__, __LINE__, length);
+			return NULL;
+		}
+
+		captureFile->data = pNewData;
+		captureFile->dataSize = length;
+	}
+
+	if (fread(captureFile->data, 1, length, captureFile->file) != length)
+	{
+		*readRet = RSSL_RET_FAILURE;
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslReadCaptureRecord() Error: The capture file ends in the middle of a record\n", __FILE__, __LINE__);
+		return NULL;
+	}
+
+	captureFile->record.timestamp = captureGet64(header + 4);
+	captureFile->record.channelId = captureGet64(header + 12);
+	captureFile->record.direction = (RsslUInt8)header[20];
+	captureFile->record.protocolType = (RsslUInt8)header[21];
+	captureFile->record.majorVersion = (RsslUInt8)header[22];
+	captureFile->record.minorVersion = (RsslUInt8)header[23];
+	captureFile->record.data.data = captureFile->data;
+	captureFile->record.data.length = length;
+
+	return &captureFile->record;
+}
+
+RSSL_API void rsslCloseCaptureFile(RsslCaptureFile *captureFile)
+{
+	if (captureFile->file != NULL)
+		fclose(captureFile->file);
+	free(captureFile->data);
+	free(captureFile);
+}
@@ -914,6 +914,8 @@ RSSL_RSSL_UNIDIRECTION_SHMEM_IMPL_FAST(RsslRet) rsslUniShMemGetSrvrInfo(rsslServ
 		info->currentBufferUsage = 0;
 
 	info->peakBufferUsage = 1;		/* shmem has only one rsslBuffer, so the peak cannot be more than that */
+	info->threadCacheHits = 0;
+	info->threadCacheMisses = 0;
 
 	return RSSL_RET_SUCCESS;
 }
@@ -0,0 +1,63 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2022 Refinitiv. All rights reserved.              --
+ *|-----------------------------------------------------------------------------
+ */
+
+#ifndef __ripcuring_h
+#define __ripcuring_h
+
+#include "rtr/rsslSocketTransportImpl.h"
+#include "rtr/ripcutils.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* io_uring based read/write functions for RSSL_CONN_TYPE_SOCKET channels.
+ * Each thread submits through its own ring, so all the channels read or flushed
+ * by one thread (e.g. a reactor worker, or an rsslRead loop) share one ring.
+ * Connection setup and all other socket functions are the regular ipc* functions. */
+
+#if defined(LINUX) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#define RIPC_HAS_IO_URING
+#endif
+#endif
+
+/* Index into the io_uring transport functions */
+typedef enum {
+	RIPC_URING_INTERRUPT = 0,	/* io_uring_enter() is called for each operation */
+	RIPC_URING_SQPOLL = 1,		/* A kernel thread polls the submission queue */
+	RIPC_URING_MAX_MODES = 2
+} ripcUringMode;
+
+/* Returns 1 if the running kernel supports the io_uring operations used here, 0 otherwise. */
+extern int ipcUringAvailable();
+
+/* Registers the io_uring transport functions with ipcSetUringTransFunc(). Returns 1 on success. */
+extern int ipcSetUringFuncs();
+
+/* Called when a channel starts and stops using the io_uring functions. When the last such channel is released,
+ * the rings of all threads are freed. */
+extern void ipcUringAddChannel();
+extern void ipcUringRemoveChannel();
+
+/* Makes the calling thread's io_uring_enter() calls fail with the given errno, or succeed again when it is 0.
+ * Used for testing. */
+extern void ipcUringSetEnterError(int error);
+
+/* Returns the number of entries in the calling thread's submission queue for the given mode that the kernel has
+ * not taken, or -1 if the thread has no ring for that mode. Used for testing. */
+extern int ipcUringPendingEntries(ripcUringMode mode);
+
+/* Defined in rsslSocketTransportImpl.c. Sets the read and write functions of the given mode; the others are copied from the socket transport. */
+extern RsslRet ipcSetUringTransFunc(ripcUringMode mode, ripcTransportFuncs *funcs);
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif
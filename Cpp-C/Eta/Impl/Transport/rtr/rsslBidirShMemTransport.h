@@ -0,0 +1,36 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2022 Refinitiv. All rights reserved.              --
+ *|-----------------------------------------------------------------------------
+ */
+
+#ifndef __RTR_RSSL_BIDIRECTION_SHMEM_TRANSPORT_H
+#define __RTR_RSSL_BIDIRECTION_SHMEM_TRANSPORT_H
+
+/* Contains function declarations necessary for to hook in
+ * the bidirectional shared memory connection type.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "rtr/rsslChanManagement.h"
+#include "rtr/rsslTypes.h"
+#include <stdio.h>
+
+/* Initializes bidirectional shared memory transport and function pointers */
+RsslRet rsslBidirShMemInitialize(RsslLockingTypes lockingType, RsslError *error);
+
+/* Uninitializes transport */
+RsslRet rsslBidirShMemUninitialize();
+
+
+#ifdef __cplusplus
+};
+#endif
+
+
+#endif
@@ -0,0 +1,100 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2022 Refinitiv. All rights reserved.              --
+ *|-----------------------------------------------------------------------------
+ */
+
+#ifndef __RTR_RSSL_BIDIRECTION_SHMEM_TRANSPORT_IMPL_H
+#define __RTR_RSSL_BIDIRECTION_SHMEM_TRANSPORT_IMPL_H
+
+/* Contains function declarations necessary for the
+ * bidirectional shared memory connection type.
+ *
+ * Each channel has its own shared memory segment with one ring in each direction.
+ * The segment is created by the server when it accepts the channel, and is handed to
+ * the client over a local socket. The same socket is the channel's socketId, and
+ * carries the wakeups for a reader that has run out of messages.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "rtr/rsslTypes.h"
+#include "rtr/rsslChanManagement.h"
+#include "rtr/rwfNetwork.h"
+#include <stdio.h>
+
+#define 	RSSL_RSSL_BIDIRECTION_SHMEM_IMPL_FAST(ret)		ret RTR_FASTCALL
+
+/* Contains code necessary for creating the local socket that clients connect to */
+RsslRet rsslBidirShMemBind(rsslServerImpl* rsslSrvrImpl, RsslBindOptions *opts, RsslError *error );
+
+/* Contains code necessary for accepting inbound bidirectional shared memory connections */
+rsslChannelImpl* rsslBidirShMemAccept(rsslServerImpl *rsslSrvrImpl, RsslAcceptOptions *opts, RsslError *error);
+
+/* Contains code necessary for connecting to a bidirectional shared memory server */
+RsslRet rsslBidirShMemConnect(rsslChannelImpl* rsslChnlImpl, RsslConnectOptions *opts, RsslError *error);
+
+/* Contains code necessary to reconnect shmem connections and bridge data flow (no-op) */
+RsslRet rsslBidirShMemReconnect(rsslChannelImpl *rsslChnlImpl, RsslError *error);
+
+/* Contains code necessary for client and server to exchange the shared memory segment */
+RsslRet rsslBidirShMemInitChannel(rsslChannelImpl* rsslChnlImpl, RsslInProgInfo *inProg, RsslError *error);
+
+/* Contains code necessary to disconnect from the shared memory segment (client or server side) */
+RsslRet rsslBidirShMemCloseChannel(rsslChannelImpl* rsslChnlImpl, RsslError *error);
+
+/* Contains code necessary to read from the inbound ring */
+RSSL_RSSL_BIDIRECTION_SHMEM_IMPL_FAST(RsslBuffer*) rsslBidirShMemRead(rsslChannelImpl* rsslChnlImpl, RsslReadOutArgs *readOutArgs, RsslRet *readRet, RsslError *error);
+
+/* Contains code necessary to publish a buffer to the outbound ring */
+RSSL_RSSL_BIDIRECTION_SHMEM_IMPL_FAST(RsslRet) rsslBidirShMemWrite(rsslChannelImpl *rsslChnlImpl, rsslBufferImpl *rsslBufImpl, RsslWriteInArgs *writeInArgs, RsslWriteOutArgs *writeOutArgs, RsslError *error);
+
+/* Contains code necessary to flush data to shared memory segment (no-op) */
+RSSL_RSSL_BIDIRECTION_SHMEM_IMPL_FAST(RsslRet) rsslBidirShMemFlush(rsslChannelImpl *rsslChnlImpl, RsslError *error);
+
+/* Contains code necessary to reserve a buffer in the outbound ring */
+RSSL_RSSL_BIDIRECTION_SHMEM_IMPL_FAST(rsslBufferImpl*) rsslBidirShMemGetBuffer(rsslChannelImpl *rsslChnlImpl, RsslUInt32 size, RsslBool packedBuffer, RsslError *error);
+
+/* Contains code necessary to release an unused/unsuccessfully written buffer */
+RSSL_RSSL_BIDIRECTION_SHMEM_IMPL_FAST(RsslRet) rsslBidirShMemReleaseBuffer(rsslChannelImpl *rsslChnlImpl, rsslBufferImpl *rsslBufImpl, RsslError *error);
+
+/* Contains code necessary to query number of used output buffers */
+RSSL_RSSL_BIDIRECTION_SHMEM_IMPL_FAST(RsslInt32) rsslBidirShMemBufferUsage(rsslChannelImpl *rsslChnlImpl, RsslError *error);
+
+/* Contains code necessary to query number of used buffers by the server (no-op) */
+RSSL_RSSL_BIDIRECTION_SHMEM_IMPL_FAST(RsslInt32) rsslBidirShMemSrvrBufferUsage(rsslServerImpl *rsslSrvrImpl, RsslError *error);
+
+/* Contains code necessary for buffer packing */
+RSSL_RSSL_BIDIRECTION_SHMEM_IMPL_FAST(RsslBuffer*) rsslBidirShMemPackBuffer(rsslChannelImpl *rsslChnlImpl, rsslBufferImpl *rsslBufImpl, RsslError *error);
+
+/* Contains code necessary to send a ping message */
+RSSL_RSSL_BIDIRECTION_SHMEM_IMPL_FAST(RsslRet) rsslBidirShMemPing(rsslChannelImpl *rsslChnlImpl, RsslError *error);
+
+/* Contains code necessary to query the channel for more detailed connection info (client or server side) */
+RSSL_RSSL_BIDIRECTION_SHMEM_IMPL_FAST(RsslRet) rsslBidirShMemGetChannelInfo(rsslChannelImpl *rsslChnlImpl, RsslChannelInfo *info, RsslError *error);
+
+/* Contains code necessary to query the server for more detailed connection info (server only) */
+RSSL_RSSL_BIDIRECTION_SHMEM_IMPL_FAST(RsslRet) rsslBidirShMemGetSrvrInfo(rsslServerImpl *rsslSrvrImpl, RsslServerInfo *info, RsslError *error);
+
+/* Contains code necessary to do an ioctl on a channel (no-op) */
+RSSL_RSSL_BIDIRECTION_SHMEM_IMPL_FAST(RsslRet) rsslBidirShMemIoctl(rsslChannelImpl *rsslChnlImpl, RsslIoctlCodes code, void *value, RsslError *error);
+
+/* Contains code necessary to do an ioctl on a server (no-op) */
+RSSL_RSSL_BIDIRECTION_SHMEM_IMPL_FAST(RsslRet) rsslBidirShMemSrvrIoctl(rsslServerImpl *rsslSrvrImpl, RsslIoctlCodes code, void *value, RsslError *error);
+
+// Contains code necessary to set the debug func pointers for BidirShMem transport
+RsslRet rsslSetBidirShMemDebugFunctions(
+	void(*dumpRsslIn)(const char *functionName, char *buffer, RsslUInt32 length, RsslSocket socketId),
+	void(*dumpRsslOut)(const char *functionName, char *buffer, RsslUInt32 length, RsslSocket socketId),
+	RsslError *error);
+
+#ifdef __cplusplus
+};
+#endif
+
+
+#endif
@@ -37,7 +37,8 @@ typedef struct RsslTransServerFuncs RsslTransServerFuncs;
 #define RSSL_RRCP_TRANSPORT 2
 #define RSSL_SEQ_MCAST_TRANSPORT 3
 #define RSSL_WEBSOCKET_TRANSPORT   4
-#define RSSL_MAX_TRANSPORTS     RSSL_WEBSOCKET_TRANSPORT + 1
+#define RSSL_BIDIRECTION_SHMEM_TRANSPORT  5
+#define RSSL_MAX_TRANSPORTS     RSSL_BIDIRECTION_SHMEM_TRANSPORT + 1
 
 /* used for all connection types to control locking */
 extern RsslLockingTypes multiThread;  /* 0 == No Locking; 1 == All locking; 2 == Only global locking */
@@ -78,6 +79,7 @@ typedef struct {
 								   * This string also includes a time stamp appended to it if a new trace file needs to be created
 								   * if traceMsgMaxFileSize is reached. The ".xml" extension is appended to the end of the string*/
 	FILE* traceMsgFilePtr;		   /* Pointer to the user specified file */
+	struct rsslTraceCapture* traceCapture; /* Binary capture written instead of the XML file when RSSL_TRACE_BINARY is set */
 } RsslTraceOptionsInfo;
 
 /** @brief Monitoring information of allocates/deallocates instances and a close call.
@@ -105,7 +107,8 @@ typedef struct {
 	RsslChannel 	Channel;			/* stores actual channel structure */
 	RsslQueueLink	link1;				/* storage for the activeChannelList qtool links */
 	RsslQueueLink	link2;				/* storage for the servers activeChannels qtool links */
-	RsslMutex		chanMutex;			/* internal mutex used for reads */
+	RsslMutex		chanMutex;			/* internal mutex used for writes, and for reads on transports without a separate read mutex */
+	RsslMutex		chanReadMutex;		/* internal mutex used for socket channel reads */
 	RsslMutex		traceMutex;			/* used when tracing to prevent multiple threads logging at the same time */
 	RsslQueue		activeBufferList;	/* list of active buffers by this channel */
 	int				debugFlags;			/* set to provide outbound or inbound rssl message debugging */
@@ -217,6 +220,7 @@ RTR_C_INLINE void rsslClearTraceOptionsInfo(RsslTraceOptionsInfo *traceOptionsIn
 	traceOptionsInfo->newTraceMsgFileName = NULL;
 	traceOptionsInfo->traceMsgOrigFileNameSize = 0;
 	traceOptionsInfo->traceMsgFilePtr = NULL;
+	traceOptionsInfo->traceCapture = NULL;
 }
 
 RTR_C_INLINE RsslUInt32 UInt32_key_hash(void *element)
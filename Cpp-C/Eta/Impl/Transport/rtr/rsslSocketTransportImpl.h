@@ -84,6 +84,53 @@ typedef enum {
 		} \
 	}
 
+/* With RSSL_LOCK_GLOBAL_AND_CHANNEL, mutex guards the output side of a channel and readMutex
+ * guards the input side, so one thread can read while another writes. A reader also takes mutex
+ * until the channel is active, and always on channels whose read path can write(WebSocket,
+ * encrypted and HTTP channels); see separateReadLock. Operations that touch both sides take
+ * readMutex before mutex. */
+#define IPC_READ_MUTEX_LOCK(session) \
+	{					\
+		if ((session)->readMutex) \
+		{ \
+		  (void) RSSL_MUTEX_LOCK((session)->readMutex);	\
+		  _DEBUG_MUTEX_TRACE("IPC_READ_MUTEX_LOCK", session, (session)->readMutex)\
+		} \
+		if (!(session)->separateReadLock) \
+			IPC_MUTEX_LOCK(session) \
+	}
+
+#define IPC_READ_MUTEX_UNLOCK(session) \
+	{					\
+		if (!(session)->separateReadLock) \
+			IPC_MUTEX_UNLOCK(session) \
+		if ((session)->readMutex) \
+		{ \
+		  (void) RSSL_MUTEX_UNLOCK((session)->readMutex);	\
+		  _DEBUG_MUTEX_TRACE("IPC_READ_MUTEX_UNLOCK", session, (session)->readMutex)\
+		} \
+	}
+
+#define IPC_ALL_MUTEX_LOCK(session) \
+	{					\
+		if ((session)->readMutex) \
+		{ \
+		  (void) RSSL_MUTEX_LOCK((session)->readMutex);	\
+		  _DEBUG_MUTEX_TRACE("IPC_ALL_MUTEX_LOCK", session, (session)->readMutex)\
+		} \
+		IPC_MUTEX_LOCK(session) \
+	}
+
+#define IPC_ALL_MUTEX_UNLOCK(session) \
+	{					\
+		IPC_MUTEX_UNLOCK(session) \
+		if ((session)->readMutex) \
+		{ \
+		  (void) RSSL_MUTEX_UNLOCK((session)->readMutex);	\
+		  _DEBUG_MUTEX_TRACE("IPC_ALL_MUTEX_UNLOCK", session, (session)->readMutex)\
+		} \
+	}
+
 typedef enum {
 	RIPC_NO_TUNNELING = 0,
 	RIPC_TUNNEL_INIT = 1,
@@ -276,6 +323,7 @@ typedef struct {
 	void(*decompressEnd)(void *compressInfo);
 	int(*compress)(void *compressInfo, ripcCompBuffer *buf, int resetContext, RsslError *error);
 	int(*decompress)(void *compressInfo, ripcCompBuffer *buf, int resetContext, RsslError *error);
+	int(*compressBound)(int length);	/* Set by compressors that compress each message on its own (LZ4, zstd); the largest output for length bytes of input */
 } ripcCompFuncs;
 
 typedef struct {
@@ -294,6 +342,7 @@ typedef struct {
 	RsslBool	server_blocking;	/* Perform server blocking operations */
 	RsslBool	session_blocking;	/* Perform session blocking operations */
 	RsslBool	tcp_nodelay;		/* Disable Nagle Algorithm */
+	RsslUInt8	ioEngine;			/* RsslIOEngineTypes used for accepted channels */
 	RsslInt32	connType;			/* Controls the connection type */
 	RsslUInt32	rsslFlags;			/* this flag keeps track of client to server and server to client ping*/
 	RsslUInt8	pingTimeout; 		/* ping timeout */
@@ -410,6 +459,8 @@ typedef struct
 	char				*curlOptProxyDomain;	/* domain used for tunneling connection */
 	RsslBool			blocking : 1;			/* Perform blocking operations */
 	RsslBool			tcp_nodelay : 1;		/* Disable Nagle Algorithm */
+	RsslUInt8			ioEngine;				/* RsslIOEngineTypes used to read and write the socket */
+	RsslBool			usesUring;				/* Channel is counted by ipcUringAddChannel() */
 	RsslUInt32			compression;			/* Use compression defined by server, otherwise none */
 	RsslUInt32			numConnections;			/* Number of concurrent connections for an extended line connection */
 	RsslUInt32			numGuarOutputBufs;		/* Number of guaranteed output buffers */
@@ -426,6 +477,8 @@ typedef struct
 	rtr_bufferpool_t		*bufPool;
 	rtr_dfltcbufferpool_t	*guarBufPool;
 	RsslMutex			*mutex;
+	RsslMutex			*readMutex;				/* input side lock, see IPC_READ_MUTEX_LOCK */
+	RsslBool			separateReadLock;		/* readers do not take mutex; set once the channel is active */
 	RsslUInt32			sendBufSize;
 	RsslUInt32			recvBufSize;
 
@@ -555,7 +608,11 @@ RTR_C_INLINE void ripcClearRsslSocketChannel(RsslSocketChannel *rsslSocketChanne
 	rsslSocketChannel->workState = RIPC_INT_WORK_NONE;
 
 	rsslSocketChannel->mutex = 0;
+	rsslSocketChannel->readMutex = 0;
+	rsslSocketChannel->separateReadLock = RSSL_FALSE;
 	rsslSocketChannel->blocking = 0;
+	rsslSocketChannel->ioEngine = RSSL_IO_ENGINE_DEFAULT;
+	rsslSocketChannel->usesUring = RSSL_FALSE;
 	rsslSocketChannel->mountNak = 0;
 	rsslSocketChannel->inDecompress = 0;
 	rsslSocketChannel->outCompression = (RsslCompTypes)0;
@@ -0,0 +1,51 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2022 Refinitiv. All rights reserved.              --
+ *|-----------------------------------------------------------------------------
+ */
+
+#ifndef __RSSL_TRACE_CAPTURE_H
+#define __RSSL_TRACE_CAPTURE_H
+
+/* Binary message capture, used for tracing when RSSL_TRACE_BINARY is set.
+ *
+ * Each traced channel has its own capture: a ring of records in memory, and the file
+ * the records are written to. The thread tracing the channel copies each message into
+ * the ring and returns; a single writer thread, shared by all captures, moves the
+ * records from the rings to the files, and waits on an event signal when every ring
+ * is empty.
+ *
+ * The file format is described with RsslCaptureRecord in rsslTransport.h. */
+
+#include "rtr/rsslTransport.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Size of each capture's ring. A message that does not fit in the free space of the ring
+ * is dropped, and the number of dropped messages is recorded in the capture. */
+#define RSSL_TRACE_CAPTURE_RING_SIZE (8 * 1024 * 1024)
+
+typedef struct rsslTraceCapture rsslTraceCapture;
+
+/* Opens a capture, writing to the named file. When the file reaches maxFileSize, a new file
+ * is started if multipleFiles is set (named from fileBaseName with a time stamp, as XML trace
+ * files are); otherwise, further messages are discarded. */
+rsslTraceCapture *rsslTraceCaptureOpen(const char *fileName, const char *fileBaseName, RsslInt64 maxFileSize, RsslBool multipleFiles, RsslError *error);
+
+/* Copies a message into the capture. Must not be called by more than one thread at a time
+ * for the same capture. */
+void rsslTraceCaptureWrite(rsslTraceCapture *pCapture, RsslUInt64 channelId, RsslUInt8 direction, RsslUInt8 protocolType,
+		RsslUInt8 majorVersion, RsslUInt8 minorVersion, const RsslBuffer *pData);
+
+/* Waits for the writer thread to write out the capture's records, then closes its file and frees it. */
+void rsslTraceCaptureClose(rsslTraceCapture *pCapture);
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif
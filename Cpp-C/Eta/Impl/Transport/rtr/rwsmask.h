@@ -0,0 +1,48 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2022 Refinitiv. All rights reserved.              --
+ *|-----------------------------------------------------------------------------
+ */
+
+#ifndef __RWSMASK_H
+#define __RWSMASK_H
+
+#include "rtr/rsslTypes.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* WebSocket payload masking (RFC 6455 section 5.3).
+ * The kernel is selected on first use from what the CPU supports:
+ * AVX2, then SSE2, then 8 bytes at a time. */
+
+typedef enum {
+	RWS_MASK_KERNEL_AUTO = 0,	/* Fastest kernel supported by the CPU */
+	RWS_MASK_KERNEL_BYTE = 1,	/* One byte at a time */
+	RWS_MASK_KERNEL_WORD = 2,	/* 8 bytes at a time */
+	RWS_MASK_KERNEL_SSE2 = 3,	/* 16 bytes at a time (x86 only) */
+	RWS_MASK_KERNEL_AVX2 = 4,	/* 32 bytes at a time (x86 only, checked at runtime) */
+	RWS_MASK_KERNEL_MAX = 5
+} rwsMaskKernel_t;
+
+/* XORs length bytes of src with the 4 byte mask key and stores them in dst.
+ * dst may be equal to src to mask in place; otherwise the two must not overlap. */
+RSSL_API void rwsMaskCopy(const char *mask, char *dst, const char *src, RsslUInt64 length);
+
+/* Same as rwsMaskCopy(), using the given kernel. Used for testing and benchmarking. */
+RSSL_API void rwsMaskCopyWithKernel(rwsMaskKernel_t kernel, const char *mask, char *dst, const char *src, RsslUInt64 length);
+
+/* Returns RSSL_TRUE if the given kernel can run on this machine. */
+RSSL_API RsslBool rwsMaskKernelSupported(rwsMaskKernel_t kernel);
+
+/* Returns the kernel used by rwsMaskCopy(). */
+RSSL_API rwsMaskKernel_t rwsMaskSelectedKernel();
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif
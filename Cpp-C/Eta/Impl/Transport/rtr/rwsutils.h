@@ -301,6 +301,7 @@ typedef struct rwsFrameHdr {
 	RsslBool	fragment;
 	RsslBool	compressed;
 	RsslBool	maskSet;
+	RsslBool	maskPending;	/* The payload is still masked; it is unmasked while being copied into the reassembly buffer */
 	char		mask[RWS_MASK_KEY_LEN];
 	RsslUInt32	maskVal;
 	RsslUInt64	payloadLen;
@@ -0,0 +1,230 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2022 Refinitiv. All rights reserved.              --
+ *|-----------------------------------------------------------------------------
+ */
+
+#include <string.h>
+
+#include "rtr/rwsmask.h"
+
+/* SSE2 is part of every x86-64 CPU, so it needs no runtime check. */
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define RWS_MASK_SSE2
+#include <emmintrin.h>
+#endif
+
+/* AVX2 is compiled for a single function and used only if the CPU and OS support it.
+ * Older GCC versions do not provide the AVX2 intrinsics without -mavx2. */
+#if defined(RWS_MASK_SSE2)
+#if defined(_MSC_VER) && _MSC_VER >= 1800
+#define RWS_MASK_AVX2
+#define RWS_MASK_AVX2_TARGET
+#include <immintrin.h>
+#include <intrin.h>
+#elif defined(__clang__) || (defined(__GNUC__) && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9)))
+#define RWS_MASK_AVX2
+#define RWS_MASK_AVX2_TARGET __attribute__((target("avx2")))
+#include <immintrin.h>
+#endif
+#endif
+
+typedef void (*rwsMaskFunc_t)(const char *mask, char *dst, const char *src, RsslUInt64 length);
+
+static rwsMaskFunc_t rwsMaskFunc = 0;
+static rwsMaskKernel_t rwsMaskKernel = RWS_MASK_KERNEL_AUTO;
+
+static void _maskBytes(const char *mask, char *dst, const char *src, RsslUInt64 length)
+{
+	RsslUInt64 i;
+
+	for (i = 0; i < length; i++)
+		dst[i] = src[i] ^ mask[i & 3];
+}
+
+/* Processes the input in 8 byte chunks, then finishes byte by byte. Since every chunk
+ * is a multiple of 4 bytes long, the mask lines up with the start of each chunk. */
+static void _maskWords(const char *mask, char *dst, const char *src, RsslUInt64 length)
+{
+	char mask8[8];
+	RsslUInt64 mask64, word;
+	RsslUInt64 i = 0;
+
+	memcpy(mask8, mask, 4);
+	memcpy(mask8 + 4, mask, 4);
+	memcpy(&mask64, mask8, 8);
+
+	/* memcpy() keeps unaligned accesses well defined; compilers turn it into a single load or store. */
+	for (; i + 8 <= length; i += 8)
+	{
+		memcpy(&word, src + i, 8);
+		word ^= mask64;
+		memcpy(dst + i, &word, 8);
+	}
+
+	_maskBytes(mask, dst + i, src + i, length - i);
+}
+
+#ifdef RWS_MASK_SSE2
+static void _maskSSE2(const char *mask, char *dst, const char *src, RsslUInt64 length)
+{
+	__m128i mask128;
+	RsslUInt32 mask32;
+	RsslUInt64 i = 0;
+
+	memcpy(&mask32, mask, 4);
+	mask128 = _mm_set1_epi32((int)mask32);
+
+	for (; i + 64 <= length; i += 64)
+	{
+		__m128i a = _mm_loadu_si128((const __m128i*)(src + i));
+		__m128i b = _mm_loadu_si128((const __m128i*)(src + i + 16));
+		__m128i c = _mm_loadu_si128((const __m128i*)(src + i + 32));
+		__m128i d = _mm_loadu_si128((const __m128i*)(src + i + 48));
+		_mm_storeu_si128((__m128i*)(dst + i), _mm_xor_si128(a, mask128));
+		_mm_storeu_si128((__m128i*)(dst + i + 16), _mm_xor_si128(b, mask128));
+		_mm_storeu_si128((__m128i*)(dst + i + 32), _mm_xor_si128(c, mask128));
+		_mm_storeu_si128((__m128i*)(dst + i + 48), _mm_xor_si128(d, mask128));
+	}
+
+	for (; i + 16 <= length; i += 16)
+		_mm_storeu_si128((__m128i*)(dst + i), _mm_xor_si128(_mm_loadu_si128((const __m128i*)(src + i)), mask128));
+
+	_maskWords(mask, dst + i, src + i, length - i);
+}
+#endif
+
+#ifdef RWS_MASK_AVX2
+RWS_MASK_AVX2_TARGET static void _maskAVX2(const char *mask, char *dst, const char *src, RsslUInt64 length)
+{
+	__m256i mask256;
+	RsslUInt32 mask32;
+	RsslUInt64 i = 0;
+
+	/* Short payloads are faster with SSE2, which does not pay for the upper register state. */
+	if (length < 128)
+	{
+		_maskSSE2(mask, dst, src, length);
+		return;
+	}
+
+	memcpy(&mask32, mask, 4);
+	mask256 = _mm256_set1_epi32((int)mask32);
+
+	for (; i + 128 <= length; i += 128)
+	{
+		__m256i a = _mm256_loadu_si256((const __m256i*)(src + i));
+		__m256i b = _mm256_loadu_si256((const __m256i*)(src + i + 32));
+		__m256i c = _mm256_loadu_si256((const __m256i*)(src + i + 64));
+		__m256i d = _mm256_loadu_si256((const __m256i*)(src + i + 96));
+		_mm256_storeu_si256((__m256i*)(dst + i), _mm256_xor_si256(a, mask256));
+		_mm256_storeu_si256((__m256i*)(dst + i + 32), _mm256_xor_si256(b, mask256));
+		_mm256_storeu_si256((__m256i*)(dst + i + 64), _mm256_xor_si256(c, mask256));
+		_mm256_storeu_si256((__m256i*)(dst + i + 96), _mm256_xor_si256(d, mask256));
+	}
+
+	for (; i + 32 <= length; i += 32)
+		_mm256_storeu_si256((__m256i*)(dst + i), _mm256_xor_si256(_mm256_loadu_si256((const __m256i*)(src + i)), mask256));
+
+	/* Avoids the AVX to SSE transition penalty in the caller. */
+	_mm256_zeroupper();
+
+	_maskWords(mask, dst + i, src + i, length - i);
+}
+
+static RsslBool _cpuHasAVX2()
+{
+#if defined(_MSC_VER)
+	int info[4];
+
+	__cpuid(info, 0);
+	if (info[0] < 7)
+		return RSSL_FALSE;
+
+	/* The OS must save the YMM registers(OSXSAVE and AVX bits, then XCR0 bits 1 and 2). */
+	__cpuid(info, 1);
+	if ((info[2] & (1 << 27)) == 0 || (info[2] & (1 << 28)) == 0)
+		return RSSL_FALSE;
+	if ((_xgetbv(0) & 0x6) != 0x6)
+		return RSSL_FALSE;
+
+	__cpuidex(info, 7, 0);
+	return (info[1] & (1 << 5)) ? RSSL_TRUE : RSSL_FALSE;
+#else
+	__builtin_cpu_init();
+	return __builtin_cpu_supports("avx2") ? RSSL_TRUE : RSSL_FALSE;
+#endif
+}
+#endif
+
+static rwsMaskFunc_t _getMaskFunc(rwsMaskKernel_t kernel)
+{
+	switch (kernel)
+	{
+	case RWS_MASK_KERNEL_BYTE:
+		return _maskBytes;
+	case RWS_MASK_KERNEL_WORD:
+		return _maskWords;
+#ifdef RWS_MASK_SSE2
+	case RWS_MASK_KERNEL_SSE2:
+		return _maskSSE2;
+#endif
+#ifdef RWS_MASK_AVX2
+	case RWS_MASK_KERNEL_AVX2:
+		return (_cpuHasAVX2() ? _maskAVX2 : 0);
+#endif
+	default:
+		return 0;
+	}
+}
+
+RSSL_API rwsMaskKernel_t rwsMaskSelectedKernel()
+{
+	if (rwsMaskFunc == 0)
+	{
+		rwsMaskKernel_t kernel;
+
+		/* Picks the widest supported kernel. Concurrent first calls all pick the same one. */
+		for (kernel = (rwsMaskKernel_t)(RWS_MASK_KERNEL_MAX - 1); kernel > RWS_MASK_KERNEL_AUTO; kernel = (rwsMaskKernel_t)(kernel - 1))
+		{
+			rwsMaskFunc_t func = _getMaskFunc(kernel);
+
+			if (func)
+			{
+				rwsMaskKernel = kernel;
+				rwsMaskFunc = func;
+				break;
+			}
+		}
+	}
+
+	return rwsMaskKernel;
+}
+
+RSSL_API RsslBool rwsMaskKernelSupported(rwsMaskKernel_t kernel)
+{
+	if (kernel == RWS_MASK_KERNEL_AUTO)
+		return RSSL_TRUE;
+
+	return (_getMaskFunc(kernel) ? RSSL_TRUE : RSSL_FALSE);
+}
+
+RSSL_API void rwsMaskCopy(const char *mask, char *dst, const char *src, RsslUInt64 length)
+{
+	if (rwsMaskFunc == 0)
+		rwsMaskSelectedKernel();
+
+	(*rwsMaskFunc)(mask, dst, src, length);
+}
+
+RSSL_API void rwsMaskCopyWithKernel(rwsMaskKernel_t kernel, const char *mask, char *dst, const char *src, RsslUInt64 length)
+{
+	rwsMaskFunc_t func;
+
+	if (kernel == RWS_MASK_KERNEL_AUTO || (func = _getMaskFunc(kernel)) == 0)
+		rwsMaskCopy(mask, dst, src, length);
+	else
+		(*func)(mask, dst, src, length);
+}
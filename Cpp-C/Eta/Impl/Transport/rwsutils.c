@@ -12,6 +12,7 @@
 
 #include "rtr/ripc_int.h"
 #include "rtr/rwsutils.h"
+#include "rtr/rwsmask.h"
 
 /* Per RFC7230 & RFC6455, The WebSocket HTTP header fields and values are parsed with
  * the following definitions */
@@ -409,14 +410,37 @@ static RsslUInt32 _getMaskKey(char *mask, char *buffer)
 
 static void _maskDataBlock(char *mask, char *ptrBuf, RsslUInt64 length)
 {
-	RsslUInt64 i;
-
-	for (i = 0 ; i < length; i++, ptrBuf++)
-		*ptrBuf = *ptrBuf ^ mask[i%4];
+	rwsMaskCopy(mask, ptrBuf, ptrBuf, length);
 	
 	return;
 }
 
+/* Unmasks the payload of a received frame. Data fragments of JSON sessions are copied into the
+ * reassembly buffer by handleWebSocketMessages(), so they are left masked here and unmasked by
+ * _copyFramePayload() during that copy. */
+static void _unmaskFramePayload(rwsSession_t *wsSess, rwsFrameHdr_t *frame)
+{
+	if (wsSess->protocol != RWS_SP_RWF && (!frame->finSet || frame->opcode == RWS_OPC_CONT))
+	{
+		frame->maskPending = RSSL_TRUE;
+		return;
+	}
+
+	_maskDataBlock(frame->mask, frame->payload, frame->payloadLen);
+}
+
+/* Copies the payload of the current frame, unmasking it if it is still masked. */
+static void _copyFramePayload(rwsFrameHdr_t *frame, char *dst, const char *src)
+{
+	if (frame->maskPending)
+	{
+		rwsMaskCopy(frame->mask, dst, src, frame->payloadLen);
+		frame->maskPending = RSSL_FALSE;
+	}
+	else
+		memcpy(dst, src, frame->payloadLen);
+}
+
 static int _addNewHeaderLine(rwsHttpHdr_t *httpHdr)
 {
 	headerLine_t *hdrLn;
@@ -3215,6 +3239,7 @@ static RsslInt32 _resetWSFrame(rwsFrameHdr_t *frame, char * buffer)
 	frame->pExtHdr = 0;
 	frame->hdrLen = 0;
 	frame->maskVal = 0;
+	frame->maskPending = RSSL_FALSE;
 	frame->payload = 0;
 	frame->payloadLen = 0;
 	frame->advancedInputCursor = RSSL_FALSE;
@@ -3359,7 +3384,7 @@ RsslRet rwsProcessWsOpCodes(RsslSocketChannel	*rsslSocketChannel, RsslError *err
 					frame->cursor,
 					frame->hdrLen,
 					frame->payloadLen)
-					_maskDataBlock(frame->mask, frame->payload, frame->payloadLen);
+					_unmaskFramePayload(wsSess, frame);
 			}
 			_DEBUG_TRACE_WS_FRAME(((char*)frame->pCtlHdr))
 
@@ -3460,7 +3485,7 @@ void handleWebSocketMessages(RsslSocketChannel* rsslSocketChannel, RsslRet* read
 					return;
 				}
 
-				memcpy(wsSess->reassemblyBuffer->buffer + wsSess->reassemblyBuffer->length, rsslSocketChannel->inputBuffer->buffer + rsslSocketChannel->inputBufCursor, frame->payloadLen);
+				_copyFramePayload(frame, wsSess->reassemblyBuffer->buffer + wsSess->reassemblyBuffer->length, rsslSocketChannel->inputBuffer->buffer + rsslSocketChannel->inputBufCursor);
 				wsSess->reassemblyBuffer->length += frame->payloadLen;
 				rsslSocketChannel->curInputBuf->buffer = wsSess->reassemblyBuffer->buffer;
 				rsslSocketChannel->curInputBuf->length = wsSess->reassemblyBuffer->length;
@@ -3490,7 +3515,7 @@ void handleWebSocketMessages(RsslSocketChannel* rsslSocketChannel, RsslRet* read
 					return;
 				}
 
-				memcpy(wsSess->reassemblyBuffer->buffer, rsslSocketChannel->inputBuffer->buffer + rsslSocketChannel->inputBufCursor, frame->payloadLen);
+				_copyFramePayload(frame, wsSess->reassemblyBuffer->buffer, rsslSocketChannel->inputBuffer->buffer + rsslSocketChannel->inputBufCursor);
 				wsSess->reassemblyBuffer->length = frame->payloadLen;
 				rsslSocketChannel->curInputBuf->buffer = wsSess->reassemblyBuffer->buffer;
 				rsslSocketChannel->curInputBuf->length = wsSess->reassemblyBuffer->length;
@@ -3520,7 +3545,7 @@ void handleWebSocketMessages(RsslSocketChannel* rsslSocketChannel, RsslRet* read
 
 				if (frame->compressed)
 				{
-					memcpy(wsSess->reassemblyBuffer->buffer + wsSess->reassemblyBuffer->length, rsslSocketChannel->inputBuffer->buffer + rsslSocketChannel->inputBufCursor, frame->payloadLen);
+					_copyFramePayload(frame, wsSess->reassemblyBuffer->buffer + wsSess->reassemblyBuffer->length, rsslSocketChannel->inputBuffer->buffer + rsslSocketChannel->inputBufCursor);
 					wsSess->reassemblyBuffer->length += frame->payloadLen;
 
 					/* Checks whether the decompressed buffer has enough space */
@@ -3617,7 +3642,7 @@ void handleWebSocketMessages(RsslSocketChannel* rsslSocketChannel, RsslRet* read
 				}
 				else
 				{
-					memcpy(wsSess->reassemblyBuffer->buffer + wsSess->reassemblyBuffer->length, rsslSocketChannel->inputBuffer->buffer + rsslSocketChannel->inputBufCursor, frame->payloadLen);
+					_copyFramePayload(frame, wsSess->reassemblyBuffer->buffer + wsSess->reassemblyBuffer->length, rsslSocketChannel->inputBuffer->buffer + rsslSocketChannel->inputBufCursor);
 					wsSess->reassemblyBuffer->length += frame->payloadLen;
 					rsslSocketChannel->curInputBuf->buffer = wsSess->reassemblyBuffer->buffer;
 					rsslSocketChannel->curInputBuf->length = wsSess->reassemblyBuffer->length;
@@ -4392,7 +4417,7 @@ RsslInt32 rwsReadTransportMsg(void *transport, char * buffer, int bufferLen, rip
 																		frame->cursor,
 																		frame->hdrLen,
 																		frame->payloadLen)
-				_maskDataBlock(frame->mask, frame->payload, frame->payloadLen);
+				_unmaskFramePayload(wsSess, frame);
 			}
 			_DEBUG_TRACE_WS_FRAME(((char*)frame->pCtlHdr))
 
@@ -5625,6 +5650,7 @@ void clearFrameHeader(rwsFrameHdr_t * frame)
 	frame->fragment = 0;
 	frame->compressed = 0;
 	frame->maskSet = 0;
+	frame->maskPending = 0;
 	memset(frame->mask, 0, RWS_MASK_KEY_LEN);
 	frame->maskVal = 0;
 	frame->payloadLen = 0;
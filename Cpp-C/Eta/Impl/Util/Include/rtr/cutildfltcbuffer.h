@@ -30,6 +30,12 @@ typedef struct rtr_dfltcbufferpool {
 	int				numRegBufsUsed; /* Current number of buffers used */
 	int				peakNumBufsUsed; /* Peak number of buffers used */
 	RsslQueue	sharedPoolMblks;
+	int				threadCacheSize; /* Maximum number of buffers each thread may cache; 0 disables the caches */
+	int				threadCacheId; /* Identifies this pool in the thread local cache slots */
+	volatile int	threadCacheFlushGen; /* Incremented when the pool runs out of buffers, to make each thread return its cached buffers. Read without the lock. */
+	RsslQueue		threadCaches; /* Caches of the threads that have used this pool */
+	RsslUInt64		threadCacheMisses; /* Max buffer allocations that took the pool lock */
+	RsslUInt64		threadCacheHits; /* Allocations served from the caches of threads that have exited */
 #ifdef _DFLTC_BUFFER_DEBUG
 	unsigned int numFreeDblks;
 	unsigned int numFreeMblks;
@@ -40,7 +46,8 @@ typedef struct rtr_dfltcbufferpool {
 
 enum rtr_dfltcMsgbFlags
 {
-	rtr_dfltcMsgbPutInFreeList = 0x01
+	rtr_dfltcMsgbPutInFreeList = 0x01,
+	rtr_dfltcMsgbMaxAlloc = 0x02		/* Allocated by rtr_dfltcAllocMaxMsg(), so it can be kept in a thread cache when freed */
 };
 
 
@@ -83,6 +90,20 @@ extern int rtr_dfltcSetMaxBufs(rtr_bufferpool_t *pool, int newValue );
 extern int rtr_dfltcSetMaxSharedBufs(rtr_bufferpool_t *pool, int newValue );
 extern int rtr_dfltcResetPeakNumBufs(rtr_bufferpool_t *pool);
 
+	/* Enables per-thread caches of the buffers allocated with rtr_dfltcAllocMaxMsg(), for
+	 * pools that are locked and shared by several threads. Each thread keeps up to cacheSize
+	 * freed buffers and reuses them without taking the pool lock. Cached buffers are counted
+	 * as used by the pool. A thread's caches are returned to their pools when the thread exits,
+	 * and a thread that finds the pool empty takes back the buffers of idle threads' caches.
+	 * Must be called before the pool is used by other threads.
+	 */
+extern int rtr_dfltcSetThreadCacheSize(rtr_bufferpool_t *pool, int cacheSize);
+
+	/* Gets the number of rtr_dfltcAllocMaxMsg() calls served from a thread cache (hits),
+	 * and the number that took the pool lock (misses).
+	 */
+extern void rtr_dfltcGetThreadCacheStats(rtr_bufferpool_t *pool, RsslUInt64 *pHits, RsslUInt64 *pMisses);
+
 
 #ifdef __cplusplus
 } /* extern "C" */
@@ -0,0 +1,182 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2022 Refinitiv. All rights reserved.              --
+ *|-----------------------------------------------------------------------------
+ */
+
+#ifndef __RTR_MPSC_QUEUE
+#define __RTR_MPSC_QUEUE
+
+/* Lock-free queue and stack of intrusive links, for passing objects between threads.
+ *
+ * rtrMpscQueue is a multiple producer, single consumer FIFO. A producer exchanges the
+ * tail with its link and then links the previous tail to it, so a push never waits.
+ * Until that second step is done the consumer cannot see past the previous tail:
+ * rtrMpscQueuePop() returns NULL in that window even though the queue is not empty,
+ * and the consumer is expected to try again later.
+ *
+ * rtrLinkStack is a LIFO that any thread may push to. Only one thread pops at a time;
+ * rtrLinkStackTryPop() returns NULL to any other, which keeps a popped link from being
+ * pushed back underneath a pop in progress (the ABA problem).
+ *
+ * Both use the next pointer of an RsslQueueLink, so objects that are otherwise kept in
+ * RsslQueues can use the same link. */
+
+#include "rtr/rsslQueue.h"
+#include "rtr/rtratomic.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define RTR_MPSC_CACHE_LINE		64
+
+/* Accesses a value that other threads may change. */
+#define RTR_MPSC_VAL(___var)		(*(volatile rtr_atomic_val*)&(___var))
+#define RTR_MPSC_LINK(___var)	(*(RsslQueueLink *volatile*)&(___var))
+
+/* Adds addend to the value and returns its value from before. */
+RTR_C_ALWAYS_INLINE rtr_atomic_val rtrMpscFetchAdd(rtr_atomic_val *pVar, rtr_atomic_val addend)
+{
+	rtr_atomic_val oldVal;
+
+	do oldVal = RTR_MPSC_VAL(*pVar);
+	while (RTR_ATOMIC_COMPARE_AND_SWAP(*pVar, oldVal, oldVal + addend) != oldVal);
+
+	return oldVal;
+}
+
+/* Sets the link and returns its value from before. */
+RTR_C_ALWAYS_INLINE RsslQueueLink *rtrMpscExchangeLink(RsslQueueLink **ppLink, RsslQueueLink *pNewLink)
+{
+	RsslQueueLink *pOldLink;
+
+	do pOldLink = RTR_MPSC_LINK(*ppLink);
+	while ((RsslQueueLink*)RTR_ATOMIC_COMPARE_AND_SWAPPTR(*(void**)ppLink, pOldLink, pNewLink) != pOldLink);
+
+	return pOldLink;
+}
+
+typedef struct
+{
+	RsslQueueLink	*head;		/* Next link to pop, or the stub. Only used by the consumer */
+	char			pad0[RTR_MPSC_CACHE_LINE - sizeof(RsslQueueLink*)];
+	RsslQueueLink	*tail;		/* Last link pushed */
+	char			pad1[RTR_MPSC_CACHE_LINE - sizeof(RsslQueueLink*)];
+	RsslQueueLink	stub;		/* Keeps the queue from ever being empty of links */
+} rtrMpscQueue;
+
+/* The queue may not be moved once it is initialized. */
+RTR_C_ALWAYS_INLINE void rtrMpscQueueInit(rtrMpscQueue *pQueue)
+{
+	pQueue->stub.next = NULL;
+	pQueue->stub.prev = NULL;
+	pQueue->head = &pQueue->stub;
+	pQueue->tail = &pQueue->stub;
+}
+
+/* Called by any thread. */
+RTR_C_ALWAYS_INLINE void rtrMpscQueuePush(rtrMpscQueue *pQueue, RsslQueueLink *pLink)
+{
+	RsslQueueLink *pPrevLink;
+
+	pLink->next = NULL;
+	pPrevLink = rtrMpscExchangeLink(&pQueue->tail, pLink);
+	RTR_MPSC_LINK(pPrevLink->next) = pLink;
+}
+
+/* Called by the consumer only. Returns NULL if the queue is empty, or if the next link
+ * is still being pushed. */
+RTR_C_ALWAYS_INLINE RsslQueueLink *rtrMpscQueuePop(rtrMpscQueue *pQueue)
+{
+	RsslQueueLink *pHead = pQueue->head;
+	RsslQueueLink *pNext = RTR_MPSC_LINK(pHead->next);
+
+	if (pHead == &pQueue->stub)
+	{
+		if (!pNext)
+			return NULL;
+
+		pQueue->head = pHead = pNext;
+		pNext = RTR_MPSC_LINK(pHead->next);
+	}
+
+	if (pNext)
+	{
+		pQueue->head = pNext;
+		return pHead;
+	}
+
+	/* pHead is the last link. To take it, the stub goes behind it first. */
+	if (pHead != RTR_MPSC_LINK(pQueue->tail))
+		return NULL;
+
+	rtrMpscQueuePush(pQueue, &pQueue->stub);
+
+	if ((pNext = RTR_MPSC_LINK(pHead->next)))
+	{
+		pQueue->head = pNext;
+		return pHead;
+	}
+
+	return NULL;
+}
+
+typedef struct
+{
+	RsslQueueLink	*top;
+	rtr_atomic_val	popping;	/* Set while a thread is popping */
+	rtr_atomic_val	count;		/* Links in the stack; may lag a push or pop in progress */
+} rtrLinkStack;
+
+RTR_C_ALWAYS_INLINE void rtrLinkStackInit(rtrLinkStack *pStack)
+{
+	pStack->top = NULL;
+	pStack->popping = 0;
+	pStack->count = 0;
+}
+
+/* Called by any thread. */
+RTR_C_ALWAYS_INLINE void rtrLinkStackPush(rtrLinkStack *pStack, RsslQueueLink *pLink)
+{
+	RsslQueueLink *pTop;
+
+	do
+	{
+		pTop = RTR_MPSC_LINK(pStack->top);
+		pLink->next = pTop;
+	}
+	while ((RsslQueueLink*)RTR_ATOMIC_COMPARE_AND_SWAPPTR(*(void**)&pStack->top, pTop, pLink) != pTop);
+
+	(void)rtrMpscFetchAdd(&pStack->count, 1);
+}
+
+/* Called by any thread. Returns NULL if the stack is empty, or if another thread is popping. */
+RTR_C_ALWAYS_INLINE RsslQueueLink *rtrLinkStackTryPop(rtrLinkStack *pStack)
+{
+	RsslQueueLink *pTop;
+
+	if (RTR_MPSC_LINK(pStack->top) == NULL || RTR_ATOMIC_SET_RETOLD(pStack->popping, 1) != 0)
+		return NULL;
+
+	do
+	{
+		if (!(pTop = RTR_MPSC_LINK(pStack->top)))
+			break;
+	}
+	while ((RsslQueueLink*)RTR_ATOMIC_COMPARE_AND_SWAPPTR(*(void**)&pStack->top, pTop, pTop->next) != pTop);
+
+	if (pTop)
+		(void)rtrMpscFetchAdd(&pStack->count, -1);
+
+	RTR_ATOMIC_SET(pStack->popping, 0);
+	return pTop;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
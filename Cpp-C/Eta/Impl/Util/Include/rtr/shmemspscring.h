@@ -0,0 +1,326 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2022 Refinitiv. All rights reserved.              --
+ *|-----------------------------------------------------------------------------
+ */
+
+#ifndef __RTR_SHMEM_SPSC_RING
+#define __RTR_SHMEM_SPSC_RING
+
+/* Single producer, single consumer ring of variable length records in shared memory.
+ *
+ * The writer reserves a record, fills it in and commits it. Records are published in
+ * the order they were reserved, so several reservations may be outstanding at once.
+ * A record never wraps around the end of the ring; the space left at the end is
+ * filled with a padding record instead.
+ *
+ * head and tail are byte positions that only increase. Each is written by one side
+ * and sits on its own cache line, so the two sides only share a line when one of them
+ * has to reload the other's position.
+ *
+ * The reader does not trust the writer: the header of each record is checked against
+ * the ring before it is used, and only the checked copy is used afterwards, so a
+ * writer in another process cannot make the reader step outside of the ring.
+ *
+ * Requires the GCC/Clang __atomic builtins. */
+
+#include "rtr/os.h"
+#include "rtr/rsslTypes.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define RTR_SPSC_CACHE_LINE		64
+#define RTR_SPSC_RECORD_ALIGN	16
+
+/* The part of the ring in shared memory, followed by its data. */
+typedef struct
+{
+	volatile RsslUInt64	head;				/* Bytes published by the writer */
+	char				pad0[RTR_SPSC_CACHE_LINE - sizeof(RsslUInt64)];
+	volatile RsslUInt64	tail;				/* Bytes released by the reader */
+	char				pad1[RTR_SPSC_CACHE_LINE - sizeof(RsslUInt64)];
+	volatile RsslUInt32	readerWaiting;		/* Set by the reader before it waits for a signal; cleared by whoever sends it */
+	volatile RsslUInt32	writerWaiting;		/* Set by the writer when the ring is full; cleared by whoever sends the signal */
+	char				pad2[RTR_SPSC_CACHE_LINE - 2 * sizeof(RsslUInt32)];
+} rtrSpscRingCtrl;
+
+/* Header of each record. size includes the header and the padding after the data. */
+typedef struct
+{
+	RsslUInt32	size;
+	RsslUInt32	length;
+	RsslUInt32	flags;
+	RsslUInt32	reserved;
+} rtrSpscRecord;
+
+#define RTR_SPSC_REC_COMMITTED	0x01	/* Written by the writer and ready to publish */
+#define RTR_SPSC_REC_PADDING	0x02	/* Skipped by the reader */
+#define RTR_SPSC_REC_PING		0x04	/* Ping with no data */
+#define RTR_SPSC_REC_PACKED		0x08	/* Data holds messages packed with a 2 byte length before each */
+
+#define RTR_SPSC_RECORD_SIZE(___length) \
+	(((RsslUInt32)sizeof(rtrSpscRecord) + (___length) + RTR_SPSC_RECORD_ALIGN - 1) & ~(RsslUInt32)(RTR_SPSC_RECORD_ALIGN - 1))
+
+/* The view of one side of the ring. Each process keeps its own. */
+typedef struct
+{
+	rtrSpscRingCtrl	*ctrl;
+	char			*data;
+	RsslUInt64		capacity;		/* Size of the data; a power of two */
+	RsslUInt64		position;		/* Writer: end of the last reservation. Reader: start of the next record */
+	RsslUInt64		published;		/* Writer: copy of head */
+	RsslUInt64		cachedPeer;		/* Writer: last tail seen. Reader: last head seen */
+	RsslUInt32		recordSize;		/* Reader: checked size of the record returned by rtrSpscRingPeek() */
+	RsslUInt32		recordLength;	/* Reader: checked length of the record returned by rtrSpscRingPeek() */
+	RsslUInt32		recordFlags;	/* Reader: flags of the record returned by rtrSpscRingPeek() */
+	RsslBool		corrupt;		/* Reader: set when the writer published a record that does not fit in the ring */
+} rtrSpscRing;
+
+/* Size of the shared memory needed by a ring of the given capacity. */
+#define RTR_SPSC_RING_MEM_SIZE(___capacity) (sizeof(rtrSpscRingCtrl) + (size_t)(___capacity))
+
+/* Sets up a ring in mem, which must be aligned to a cache line. Only the side that creates the memory calls this. */
+RTR_C_ALWAYS_INLINE void rtrSpscRingCreate(void *mem)
+{
+	memset(mem, 0, sizeof(rtrSpscRingCtrl));
+}
+
+/* Sets up one side's view of the ring. */
+RTR_C_ALWAYS_INLINE void rtrSpscRingAttach(rtrSpscRing *ring, void *mem, RsslUInt64 capacity, RsslBool isWriter)
+{
+	ring->ctrl = (rtrSpscRingCtrl*)mem;
+	ring->data = (char*)mem + sizeof(rtrSpscRingCtrl);
+	ring->capacity = capacity;
+	ring->published = __atomic_load_n(&ring->ctrl->head, __ATOMIC_ACQUIRE);
+	ring->position = (isWriter ? ring->published : __atomic_load_n(&ring->ctrl->tail, __ATOMIC_ACQUIRE));
+	ring->cachedPeer = (isWriter ? __atomic_load_n(&ring->ctrl->tail, __ATOMIC_ACQUIRE) : ring->published);
+	ring->recordSize = 0;
+	ring->recordLength = 0;
+	ring->recordFlags = 0;
+	ring->corrupt = RSSL_FALSE;
+}
+
+RTR_C_ALWAYS_INLINE rtrSpscRecord *rtrSpscRingRecordAt(rtrSpscRing *ring, RsslUInt64 position)
+{
+	return (rtrSpscRecord*)(ring->data + (position & (ring->capacity - 1)));
+}
+
+/*** Writer ***/
+
+/* Returns the space needed to reserve a record of the given size, including any padding at the end of the ring. */
+RTR_C_ALWAYS_INLINE RsslUInt64 rtrSpscRingSpaceNeeded(rtrSpscRing *ring, RsslUInt32 size)
+{
+	RsslUInt64 offset = ring->position & (ring->capacity - 1);
+
+	return (offset + size > ring->capacity) ? ring->capacity - offset + size : size;
+}
+
+/* Reserves a record for length bytes of data. Returns NULL if the ring does not have room.
+ * The record must be committed or discarded later. */
+RTR_C_ALWAYS_INLINE rtrSpscRecord *rtrSpscRingReserve(rtrSpscRing *ring, RsslUInt32 length)
+{
+	RsslUInt32 size = RTR_SPSC_RECORD_SIZE(length);
+	RsslUInt64 needed = rtrSpscRingSpaceNeeded(ring, size);
+	RsslUInt64 padding = needed - size;
+	rtrSpscRecord *record;
+
+	if (ring->position + needed - ring->cachedPeer > ring->capacity)
+	{
+		ring->cachedPeer = __atomic_load_n(&ring->ctrl->tail, __ATOMIC_ACQUIRE);
+		if (ring->position + needed - ring->cachedPeer > ring->capacity)
+			return NULL;
+	}
+
+	if (padding)
+	{
+		record = rtrSpscRingRecordAt(ring, ring->position);
+		record->size = (RsslUInt32)padding;
+		record->length = 0;
+		record->flags = RTR_SPSC_REC_PADDING | RTR_SPSC_REC_COMMITTED;
+		ring->position += padding;
+	}
+
+	record = rtrSpscRingRecordAt(ring, ring->position);
+	record->size = size;
+	record->length = length;
+	record->flags = 0;
+	ring->position += size;
+	return record;
+}
+
+/* Gives back the unused end of a record, if it is the last one reserved. */
+RTR_C_ALWAYS_INLINE void rtrSpscRingTrim(rtrSpscRing *ring, rtrSpscRecord *record, RsslUInt32 length)
+{
+	RsslUInt32 size = RTR_SPSC_RECORD_SIZE(length);
+
+	if (size < record->size && (char*)record + record->size == (char*)rtrSpscRingRecordAt(ring, ring->position - 1) + 1)
+	{
+		ring->position -= record->size - size;
+		record->size = size;
+	}
+	record->length = length;
+}
+
+/* Publishes every committed record up to the first one that is still being written.
+ * Returns RSSL_TRUE if the reader is waiting and must be signaled. */
+RTR_C_ALWAYS_INLINE RsslBool rtrSpscRingPublish(rtrSpscRing *ring)
+{
+	RsslUInt64 position = ring->published;
+
+	while (position != ring->position)
+	{
+		rtrSpscRecord *record = rtrSpscRingRecordAt(ring, position);
+
+		if (!(record->flags & RTR_SPSC_REC_COMMITTED))
+			break;
+		position += record->size;
+	}
+
+	if (position == ring->published)
+		return RSSL_FALSE;
+
+	ring->published = position;
+	__atomic_store_n(&ring->ctrl->head, position, __ATOMIC_RELEASE);
+
+	/* Orders the store of head before the load of readerWaiting; the reader does the opposite. */
+	__atomic_thread_fence(__ATOMIC_SEQ_CST);
+	return (ring->ctrl->readerWaiting && __atomic_exchange_n(&ring->ctrl->readerWaiting, 0, __ATOMIC_ACQ_REL)) ? RSSL_TRUE : RSSL_FALSE;
+}
+
+RTR_C_ALWAYS_INLINE RsslBool rtrSpscRingCommit(rtrSpscRing *ring, rtrSpscRecord *record, RsslUInt32 flags)
+{
+	record->flags |= flags | RTR_SPSC_REC_COMMITTED;
+	return rtrSpscRingPublish(ring);
+}
+
+/* Turns a reservation that will not be written into padding. */
+RTR_C_ALWAYS_INLINE RsslBool rtrSpscRingDiscard(rtrSpscRing *ring, rtrSpscRecord *record)
+{
+	record->length = 0;
+	record->flags = RTR_SPSC_REC_PADDING | RTR_SPSC_REC_COMMITTED;
+	return rtrSpscRingPublish(ring);
+}
+
+/* Called after rtrSpscRingReserve() fails. Returns RSSL_TRUE if the reader freed space in the
+ * meantime; otherwise the reader signals once it has emptied the ring. */
+RTR_C_ALWAYS_INLINE RsslBool rtrSpscRingWaitForSpace(rtrSpscRing *ring, RsslUInt32 length)
+{
+	RsslUInt64 needed = rtrSpscRingSpaceNeeded(ring, RTR_SPSC_RECORD_SIZE(length));
+
+	__atomic_store_n(&ring->ctrl->writerWaiting, 1, __ATOMIC_RELAXED);
+	__atomic_thread_fence(__ATOMIC_SEQ_CST);
+
+	ring->cachedPeer = __atomic_load_n(&ring->ctrl->tail, __ATOMIC_ACQUIRE);
+	if (ring->position + needed - ring->cachedPeer <= ring->capacity)
+	{
+		(void)__atomic_exchange_n(&ring->ctrl->writerWaiting, 0, __ATOMIC_ACQ_REL);
+		return RSSL_TRUE;
+	}
+
+	return RSSL_FALSE;
+}
+
+/*** Reader ***/
+
+/* Returns the next record, or NULL if the ring is empty. Padding is skipped.
+ * The record stays valid until rtrSpscRingRelease() is called; its size, length and flags
+ * are copied to the ring and must be read from there. Also returns NULL, and sets corrupt,
+ * if the writer published a position or a record that does not fit in the ring. */
+RTR_C_ALWAYS_INLINE rtrSpscRecord *rtrSpscRingPeek(rtrSpscRing *ring)
+{
+	rtrSpscRecord *record;
+	RsslUInt64 offset;
+
+	if (rtrUnlikely(ring->corrupt))
+		return NULL;
+
+	for (;;)
+	{
+		if (ring->position == ring->cachedPeer)
+		{
+			ring->cachedPeer = __atomic_load_n(&ring->ctrl->head, __ATOMIC_ACQUIRE);
+			if (ring->position == ring->cachedPeer)
+				return NULL;
+
+			if (rtrUnlikely(ring->cachedPeer - ring->position > ring->capacity))
+			{
+				ring->corrupt = RSSL_TRUE;
+				return NULL;
+			}
+		}
+
+		offset = ring->position & (ring->capacity - 1);
+		record = (rtrSpscRecord*)(ring->data + offset);
+		ring->recordSize = *(volatile RsslUInt32*)&record->size;
+		ring->recordLength = *(volatile RsslUInt32*)&record->length;
+		ring->recordFlags = *(volatile RsslUInt32*)&record->flags;
+
+		if (rtrUnlikely(ring->recordSize < sizeof(rtrSpscRecord)
+				|| (ring->recordSize & (RTR_SPSC_RECORD_ALIGN - 1))
+				|| ring->recordSize > ring->capacity - offset
+				|| ring->recordSize > ring->cachedPeer - ring->position
+				|| ring->recordLength > ring->recordSize - sizeof(rtrSpscRecord)))
+		{
+			ring->corrupt = RSSL_TRUE;
+			return NULL;
+		}
+
+		if (!(ring->recordFlags & RTR_SPSC_REC_PADDING))
+			return record;
+
+		ring->position += ring->recordSize;
+	}
+}
+
+/* Gives the space of the record returned by rtrSpscRingPeek() back to the writer. */
+RTR_C_ALWAYS_INLINE void rtrSpscRingRelease(rtrSpscRing *ring, rtrSpscRecord *record)
+{
+	(void)record;
+	ring->position += ring->recordSize;
+	__atomic_store_n(&ring->ctrl->tail, ring->position, __ATOMIC_RELEASE);
+}
+
+/* Returns RSSL_TRUE if a record is waiting, without skipping padding. */
+RTR_C_ALWAYS_INLINE RsslBool rtrSpscRingHasData(rtrSpscRing *ring)
+{
+	if (ring->position != ring->cachedPeer)
+		return RSSL_TRUE;
+
+	ring->cachedPeer = __atomic_load_n(&ring->ctrl->head, __ATOMIC_ACQUIRE);
+	return (ring->position != ring->cachedPeer) ? RSSL_TRUE : RSSL_FALSE;
+}
+
+/* Asks the writer to signal the next time it publishes. Returns RSSL_TRUE if records were published
+ * in the meantime; the request is then withdrawn, unless the writer already took it. */
+RTR_C_ALWAYS_INLINE RsslBool rtrSpscRingPrepareWait(rtrSpscRing *ring)
+{
+	__atomic_store_n(&ring->ctrl->readerWaiting, 1, __ATOMIC_RELAXED);
+
+	/* Orders the store of readerWaiting (and of tail) before the loads of head and writerWaiting. */
+	__atomic_thread_fence(__ATOMIC_SEQ_CST);
+
+	if (rtrSpscRingHasData(ring))
+	{
+		(void)__atomic_exchange_n(&ring->ctrl->readerWaiting, 0, __ATOMIC_ACQ_REL);
+		return RSSL_TRUE;
+	}
+
+	return RSSL_FALSE;
+}
+
+/* Called by the reader after rtrSpscRingPrepareWait(). Returns RSSL_TRUE if the writer ran out of
+ * space and must be signaled. */
+RTR_C_ALWAYS_INLINE RsslBool rtrSpscRingWriterWaiting(rtrSpscRing *ring)
+{
+	return (ring->ctrl->writerWaiting && __atomic_exchange_n(&ring->ctrl->writerWaiting, 0, __ATOMIC_ACQ_REL)) ? RSSL_TRUE : RSSL_FALSE;
+}
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif
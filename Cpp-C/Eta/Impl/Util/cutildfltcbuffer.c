@@ -10,6 +10,7 @@
 #include <malloc.h>
 
 #include "rtr/cutildfltcbuffer.h"
+#include "rtr/rtratomic.h"
 
 #if !defined(WIN32) && !defined(__OS2__)
 #include <sys/param.h>
@@ -32,6 +33,64 @@
 int rtr_cbufferCppOverhead = 0;
 void *(*rtr_cbufferCppInit)(rtr_msgb_t*,void*) = 0;
 
+/* The per-thread caches need thread local storage, and a destructor that returns a thread's
+ * cached buffers when it exits. Without them, rtr_dfltcSetThreadCacheSize() has no effect. */
+#if !defined(_RDEV_NO_TLS_) && (defined(Linux) || defined(WIN32))
+#define RTR_DFLTC_THREAD_CACHE
+
+/* Number of pools a thread can cache buffers for. When a thread runs out of slots, it
+ * reuses the slot of a pool that was freed. */
+#define RTR_DFLTC_THREAD_CACHE_SLOTS 8
+
+/* Number of cache operations between rebalances. */
+#define RTR_DFLTC_THREAD_CACHE_INTERVAL 1024
+
+typedef struct {
+	RsslQueueLink	link;			/* Link in the pool's threadCaches list */
+	rtr_dfltcbufferpool_t	*pool;	/* Pool of the cache. Cleared when the pool is freed, after which only the owning thread uses the cache. */
+	rtr_atomic_val	busy;			/* Set while a thread uses the cache. Threads that drain other threads' caches only try to set it. */
+	int				count;			/* Number of buffers in the cache */
+	int				lowWater;		/* Lowest count since the last rebalance */
+	int				opCount;		/* Number of operations since the last rebalance */
+	int				flushGen;		/* Pool's threadCacheFlushGen when this cache was last flushed */
+	RsslUInt64		hits;			/* Allocations served from the cache */
+	rtr_msgb_t		*buffers[1];	/* Cached buffers, allocated to hold threadCacheSize entries */
+} rtr_dfltcThreadCache;
+
+typedef struct {
+	int						poolId;
+	rtr_dfltcThreadCache	*pCache;
+} rtr_dfltcThreadCacheSlot;
+
+static rtr_atomic_val rtr_dfltcLastThreadCacheId = 0;
+static DEV_THREAD_LOCAL rtr_dfltcThreadCacheSlot rtr_dfltcThreadCacheSlots[RTR_DFLTC_THREAD_CACHE_SLOTS];
+
+/* Thread specific key whose destructor frees the thread's caches. */
+#ifdef WIN32
+static DWORD rtr_dfltcThreadCacheKey = FLS_OUT_OF_INDEXES;
+static INIT_ONCE rtr_dfltcThreadCacheKeyOnce = INIT_ONCE_STATIC_INIT;
+#else
+static pthread_key_t rtr_dfltcThreadCacheKey;
+static pthread_once_t rtr_dfltcThreadCacheKeyOnce = PTHREAD_ONCE_INIT;
+#endif
+
+static void rtr_dfltcLockThreadCache(rtr_dfltcThreadCache *pCache)
+{
+	while (RTR_ATOMIC_COMPARE_AND_SWAP(pCache->busy, 0, 1) != 0)
+		;
+}
+
+static int rtr_dfltcTryLockThreadCache(rtr_dfltcThreadCache *pCache)
+{
+	return(RTR_ATOMIC_COMPARE_AND_SWAP(pCache->busy, 0, 1) == 0);
+}
+
+static void rtr_dfltcUnlockThreadCache(rtr_dfltcThreadCache *pCache)
+{
+	RTR_ATOMIC_SET(pCache->busy, 0);
+}
+#endif
+
 
 size_t rtr_dfltcAlignBytes( size_t bytes, size_t alignment )
 {
@@ -98,6 +157,20 @@ static int rtr_dfltcRemovePool( rtr_dfltcbufferpool_t *pool )
 
 	rsslInitQueue(&(pool->freeMsgList));
 
+#ifdef RTR_DFLTC_THREAD_CACHE
+	/* Buffers still held by thread caches were freed with the used list.
+	 * Each cache is freed by its thread. */
+	while ((pLink = rsslQueueRemoveLastLink(&(pool->threadCaches))) != 0)
+	{
+		rtr_dfltcThreadCache *pCache = RSSL_QUEUE_LINK_TO_OBJECT(rtr_dfltcThreadCache, link, pLink);
+
+		rtr_dfltcLockThreadCache(pCache);
+		pCache->pool = 0;
+		pCache->count = 0;
+		rtr_dfltcUnlockThreadCache(pCache);
+	}
+#endif
+
 	return(0);
 }
 
@@ -372,6 +445,7 @@ static rtr_msgb_t *rtr_dfltcIntAllocMsg(rtr_dfltcbufferpool_t* rtr_dfltcpool, si
 			if(!mblk)
 				mblk = RSSL_QUEUE_LINK_TO_OBJECT(rtr_msgb_t, link, pLink);
 	
+			mblk->flags &= ~rtr_dfltcMsgbMaxAlloc;
 			mblk->nextMsg = 0;
 			mblk->buffer = rtr_dfltcpool->nextChar;
 			mblk->length = 0;
@@ -530,18 +604,14 @@ rtr_msgb_t *rtr_dfltcAllocMsg(rtr_bufferpool_t *pool, size_t size)
 
 	return(mblk);
 }
-/* This function pulls messages from the shared pool.  */
-rtr_msgb_t *rtr_dfltcAllocMaxMsg(rtr_bufferpool_t *pool)
+/* Takes a message of maxBufSize from the pool. The pool must be locked. */
+static rtr_msgb_t *rtr_dfltcIntAllocMaxMsg(rtr_dfltcbufferpool_t *rtr_dfltcpool)
 {
-	rtr_dfltcbufferpool_t	*rtr_dfltcpool;
 	rtr_msgb_t			*mblk=0;
 	rtr_datab_t			*dblk=0;
 	int					attempt=0;
 	RsslQueueLink		*pLink = 0;
 
-	RTBUFFERPOOLLOCK(pool);
-	rtr_dfltcpool = (rtr_dfltcbufferpool_t*)pool->internal;
-
 	while (dblk == 0)
 	{
 		pLink = rsslQueueRemoveFirstLink(&(rtr_dfltcpool->freeList));
@@ -584,16 +654,10 @@ rtr_msgb_t *rtr_dfltcAllocMaxMsg(rtr_bufferpool_t *pool)
 				mblk = 0;
 			}
 			else
-			{
-				RTBUFFERPOOLUNLOCK(pool);
 				return(0);
-			}
 		}
 		else
-		{
-			RTBUFFERPOOLUNLOCK(pool);
 			return(0);
-		}
 	}
 
 	if ((pLink = rsslQueueRemoveLastLink(&(rtr_dfltcpool->freeMsgList))) == 0)
@@ -606,13 +670,13 @@ rtr_msgb_t *rtr_dfltcAllocMaxMsg(rtr_bufferpool_t *pool)
 			rsslQueueRemoveLink(&(rtr_dfltcpool->sharedPoolMblks),&(shmblk->link));
 			rtr_dfltcpool->numPoolBufs--;
 			rtrBufferFree(shmblk->pool,shmblk);
-			RTBUFFERPOOLUNLOCK(pool);
 			return(0);
 		}
 	}
 
 	mblk = RSSL_QUEUE_LINK_TO_OBJECT(rtr_msgb_t, link, pLink);
 
+	mblk->flags |= rtr_dfltcMsgbMaxAlloc;
 	mblk->nextMsg = 0;
 	mblk->buffer = dblk->base;
 	mblk->length = 0;
@@ -627,6 +691,304 @@ rtr_msgb_t *rtr_dfltcAllocMaxMsg(rtr_bufferpool_t *pool)
 #ifdef _DFLTC_BUFFER_DEBUG
 	rtr_dfltcpool->numFreeMblks--;
 	rtr_dfltcpool->numUsedMblks++;
+#endif
+	return(mblk);
+}
+
+#ifdef RTR_DFLTC_THREAD_CACHE
+/* Returns up to count buffers from the cache to the pool. The pool must be locked. */
+static void rtr_dfltcReleaseThreadCache(rtr_dfltcbufferpool_t *rtr_dfltcpool, rtr_dfltcThreadCache *pCache, int count)
+{
+	while (count-- > 0 && pCache->count > 0)
+		rtr_dfltcIntFreeMsg(rtr_dfltcpool, pCache->buffers[--pCache->count]);
+
+	if (pCache->lowWater > pCache->count)
+		pCache->lowWater = pCache->count;
+}
+
+/* Called when the pool runs out of buffers. Returns the buffers of the caches that are not in use,
+ * including those of idle threads, and makes the others return theirs on their next operation.
+ * The pool must be locked. */
+static void rtr_dfltcDrainThreadCaches(rtr_dfltcbufferpool_t *rtr_dfltcpool)
+{
+	RsslQueueLink			*pLink;
+	rtr_dfltcThreadCache	*pCache;
+
+	RSSL_QUEUE_FOR_EACH_LINK(&(rtr_dfltcpool->threadCaches), pLink)
+	{
+		pCache = RSSL_QUEUE_LINK_TO_OBJECT(rtr_dfltcThreadCache, link, pLink);
+
+		if (pCache->count > 0 && rtr_dfltcTryLockThreadCache(pCache))
+		{
+			rtr_dfltcReleaseThreadCache(rtr_dfltcpool, pCache, pCache->count);
+			rtr_dfltcUnlockThreadCache(pCache);
+		}
+	}
+
+	rtr_dfltcpool->threadCacheFlushGen++;
+}
+
+/* Returns the cache's buffers to its pool, removes it from the pool and frees it. */
+static void rtr_dfltcFreeThreadCache(rtr_dfltcThreadCache *pCache)
+{
+	rtr_dfltcbufferpool_t	*rtr_dfltcpool;
+
+	for (;;)
+	{
+		/* The pool cannot be freed while the cache is locked. Freeing the pool waits for the
+		 * cache with the pool locked, so the pool lock is only tried. */
+		rtr_dfltcLockThreadCache(pCache);
+		if ((rtr_dfltcpool = pCache->pool) == 0)
+			break;
+
+		if (rtr_dfltcpool->bufpool.mutex == 0 || RSSL_MUTEX_TRYLOCK(rtr_dfltcpool->bufpool.mutex))
+		{
+			rtr_dfltcReleaseThreadCache(rtr_dfltcpool, pCache, pCache->count);
+			rtr_dfltcpool->threadCacheHits += pCache->hits;
+			rsslQueueRemoveLink(&(rtr_dfltcpool->threadCaches), &(pCache->link));
+			RTBUFFERPOOLUNLOCK(&(rtr_dfltcpool->bufpool));
+			break;
+		}
+
+		rtr_dfltcUnlockThreadCache(pCache);
+	}
+
+	free(pCache);
+}
+
+/* Frees the caches of a thread that is exiting. */
+#ifdef WIN32
+static VOID WINAPI rtr_dfltcThreadExit(PVOID pArg)
+#else
+static void rtr_dfltcThreadExit(void *pArg)
+#endif
+{
+	rtr_dfltcThreadCacheSlot	*pSlots = (rtr_dfltcThreadCacheSlot*)pArg;
+	int							i;
+
+	for (i = 0; i < RTR_DFLTC_THREAD_CACHE_SLOTS; i++)
+	{
+		if (pSlots[i].pCache)
+			rtr_dfltcFreeThreadCache(pSlots[i].pCache);
+
+		pSlots[i].poolId = 0;
+		pSlots[i].pCache = 0;
+	}
+}
+
+#ifdef WIN32
+static BOOL CALLBACK rtr_dfltcCreateThreadCacheKey(PINIT_ONCE pOnce, PVOID pParam, PVOID *ppContext)
+{
+	rtr_dfltcThreadCacheKey = FlsAlloc(rtr_dfltcThreadExit);
+	return(TRUE);
+}
+#else
+static void rtr_dfltcCreateThreadCacheKey()
+{
+	(void)pthread_key_create(&rtr_dfltcThreadCacheKey, rtr_dfltcThreadExit);
+}
+#endif
+
+/* Returns the calling thread's cache for the pool, creating it if needed.
+ * Returns 0 if the thread has no free cache slot or the cache cannot be allocated;
+ * the thread then uses the pool under its lock. */
+static rtr_dfltcThreadCache *rtr_dfltcGetThreadCache(rtr_dfltcbufferpool_t *rtr_dfltcpool)
+{
+	rtr_dfltcThreadCache	*pCache;
+	int						i, freeSlot = -1;
+
+	for (i = 0; i < RTR_DFLTC_THREAD_CACHE_SLOTS; i++)
+	{
+		if (rtr_dfltcThreadCacheSlots[i].poolId == rtr_dfltcpool->threadCacheId)
+			return(rtr_dfltcThreadCacheSlots[i].pCache);
+
+		if (rtr_dfltcThreadCacheSlots[i].poolId == 0 && freeSlot == -1)
+			freeSlot = i;
+	}
+
+	/* Reuse the slot of a pool that was freed. */
+	for (i = 0; i < RTR_DFLTC_THREAD_CACHE_SLOTS && freeSlot == -1; i++)
+	{
+		pCache = rtr_dfltcThreadCacheSlots[i].pCache;
+
+		rtr_dfltcLockThreadCache(pCache);
+		if (pCache->pool == 0)
+			freeSlot = i;
+		rtr_dfltcUnlockThreadCache(pCache);
+	}
+
+	if (freeSlot == -1)
+		return(0);
+
+	if (rtr_dfltcThreadCacheSlots[freeSlot].pCache)
+	{
+		free(rtr_dfltcThreadCacheSlots[freeSlot].pCache);
+		rtr_dfltcThreadCacheSlots[freeSlot].poolId = 0;
+		rtr_dfltcThreadCacheSlots[freeSlot].pCache = 0;
+	}
+
+	/* Makes sure the caches are freed when the thread exits. */
+#ifdef WIN32
+	InitOnceExecuteOnce(&rtr_dfltcThreadCacheKeyOnce, rtr_dfltcCreateThreadCacheKey, NULL, NULL);
+	if (rtr_dfltcThreadCacheKey == FLS_OUT_OF_INDEXES || !FlsSetValue(rtr_dfltcThreadCacheKey, rtr_dfltcThreadCacheSlots))
+		return(0);
+#else
+	pthread_once(&rtr_dfltcThreadCacheKeyOnce, rtr_dfltcCreateThreadCacheKey);
+	if (pthread_setspecific(rtr_dfltcThreadCacheKey, rtr_dfltcThreadCacheSlots) != 0)
+		return(0);
+#endif
+
+	pCache = (rtr_dfltcThreadCache*)malloc(sizeof(rtr_dfltcThreadCache) + 
+			(rtr_dfltcpool->threadCacheSize - 1) * sizeof(rtr_msgb_t*));
+	if (pCache == 0)
+		return(0);
+
+	rsslInitQueueLink(&(pCache->link));
+	pCache->pool = rtr_dfltcpool;
+	pCache->busy = 0;
+	pCache->count = 0;
+	pCache->lowWater = 0;
+	pCache->opCount = 0;
+	pCache->hits = 0;
+
+	RTBUFFERPOOLLOCK(&(rtr_dfltcpool->bufpool));
+	pCache->flushGen = rtr_dfltcpool->threadCacheFlushGen;
+	rsslQueueAddLinkToBack(&(rtr_dfltcpool->threadCaches),&(pCache->link));
+	RTBUFFERPOOLUNLOCK(&(rtr_dfltcpool->bufpool));
+
+	rtr_dfltcThreadCacheSlots[freeSlot].poolId = rtr_dfltcpool->threadCacheId;
+	rtr_dfltcThreadCacheSlots[freeSlot].pCache = pCache;
+	return(pCache);
+}
+
+/* Called after each cache operation to return buffers that the thread does not need. */
+static void rtr_dfltcRebalanceThreadCache(rtr_dfltcbufferpool_t *rtr_dfltcpool, rtr_dfltcThreadCache *pCache)
+{
+	/* Another thread found the pool empty, so return everything. */
+	if (pCache->flushGen != rtr_dfltcpool->threadCacheFlushGen)
+	{
+		RTBUFFERPOOLLOCK(&(rtr_dfltcpool->bufpool));
+		pCache->flushGen = rtr_dfltcpool->threadCacheFlushGen;
+		rtr_dfltcReleaseThreadCache(rtr_dfltcpool, pCache, pCache->count);
+		RTBUFFERPOOLUNLOCK(&(rtr_dfltcpool->bufpool));
+		pCache->opCount = 0;
+		return;
+	}
+
+	if (++pCache->opCount < RTR_DFLTC_THREAD_CACHE_INTERVAL)
+		return;
+
+	/* Buffers that stayed in the cache for the whole interval were not needed.
+	 * Return half of them, so the cache shrinks gradually when the load drops. */
+	if (pCache->lowWater > 0)
+	{
+		RTBUFFERPOOLLOCK(&(rtr_dfltcpool->bufpool));
+		rtr_dfltcReleaseThreadCache(rtr_dfltcpool, pCache, (pCache->lowWater + 1) / 2);
+		RTBUFFERPOOLUNLOCK(&(rtr_dfltcpool->bufpool));
+	}
+
+	pCache->opCount = 0;
+	pCache->lowWater = pCache->count;
+}
+
+/* Takes buffers from the pool into the cache, up to count. The pool must be locked. */
+static void rtr_dfltcFillThreadCache(rtr_dfltcbufferpool_t *rtr_dfltcpool, rtr_dfltcThreadCache *pCache, int count)
+{
+	rtr_msgb_t	*mblk;
+
+	while (pCache->count < count && (mblk = rtr_dfltcIntAllocMaxMsg(rtr_dfltcpool)) != 0)
+		pCache->buffers[pCache->count++] = mblk;
+}
+
+/* The cache must be locked by the calling thread. */
+static rtr_msgb_t *rtr_dfltcThreadCacheAllocMaxMsg(rtr_dfltcbufferpool_t *rtr_dfltcpool, rtr_dfltcThreadCache *pCache)
+{
+	rtr_msgb_t	*mblk;
+
+	if (pCache->count > 0)
+		pCache->hits++;
+	else
+	{
+		/* Refill half of the cache, so the next allocations do not take the lock. */
+		int fillCount = (rtr_dfltcpool->threadCacheSize + 1) / 2;
+
+		RTBUFFERPOOLLOCK(&(rtr_dfltcpool->bufpool));
+		rtr_dfltcpool->threadCacheMisses++;
+		rtr_dfltcFillThreadCache(rtr_dfltcpool, pCache, fillCount);
+
+		/* The pool is empty, so take back the buffers cached by the other threads. */
+		if (pCache->count == 0)
+		{
+			rtr_dfltcDrainThreadCaches(rtr_dfltcpool);
+			rtr_dfltcFillThreadCache(rtr_dfltcpool, pCache, 1);
+		}
+		RTBUFFERPOOLUNLOCK(&(rtr_dfltcpool->bufpool));
+
+		if (pCache->count == 0)
+			return(0);
+	}
+
+	mblk = pCache->buffers[--pCache->count];
+	if (pCache->count < pCache->lowWater)
+		pCache->lowWater = pCache->count;
+
+	/* The buffer may have been used since rtr_dfltcIntAllocMaxMsg() set it up. */
+	mblk->nextMsg = 0;
+	mblk->buffer = mblk->datab->base;
+	mblk->length = 0;
+	mblk->maxLength = mblk->datab->length;
+	mblk->protocol = 0;
+	mblk->protocolHdr = 0;
+	mblk->protocolHdrLength = 0;
+	mblk->fragOffset = 0;
+	mblk->priority = 0;
+
+	rtr_dfltcRebalanceThreadCache(rtr_dfltcpool, pCache);
+	return(mblk);
+}
+
+/* The cache must be locked by the calling thread. */
+static void rtr_dfltcThreadCacheFreeMsg(rtr_dfltcbufferpool_t *rtr_dfltcpool, rtr_dfltcThreadCache *pCache, rtr_msgb_t *mblk)
+{
+	if (pCache->count == rtr_dfltcpool->threadCacheSize)
+	{
+		RTBUFFERPOOLLOCK(&(rtr_dfltcpool->bufpool));
+		rtr_dfltcReleaseThreadCache(rtr_dfltcpool, pCache, (rtr_dfltcpool->threadCacheSize + 1) / 2);
+		RTBUFFERPOOLUNLOCK(&(rtr_dfltcpool->bufpool));
+	}
+
+	pCache->buffers[pCache->count++] = mblk;
+	rtr_dfltcRebalanceThreadCache(rtr_dfltcpool, pCache);
+}
+#endif
+
+/* This function pulls messages from the shared pool.  */
+rtr_msgb_t *rtr_dfltcAllocMaxMsg(rtr_bufferpool_t *pool)
+{
+	rtr_dfltcbufferpool_t	*rtr_dfltcpool = (rtr_dfltcbufferpool_t*)pool->internal;
+	rtr_msgb_t			*mblk=0;
+#ifdef RTR_DFLTC_THREAD_CACHE
+	rtr_dfltcThreadCache	*pCache;
+
+	if (rtr_dfltcpool->threadCacheSize > 0 && (pCache = rtr_dfltcGetThreadCache(rtr_dfltcpool)) != 0)
+	{
+		rtr_dfltcLockThreadCache(pCache);
+		mblk = rtr_dfltcThreadCacheAllocMaxMsg(rtr_dfltcpool, pCache);
+		rtr_dfltcUnlockThreadCache(pCache);
+		return(mblk);
+	}
+#endif
+
+	RTBUFFERPOOLLOCK(pool);
+	if (rtr_dfltcpool->threadCacheSize > 0)
+		rtr_dfltcpool->threadCacheMisses++;
+	mblk = rtr_dfltcIntAllocMaxMsg(rtr_dfltcpool);
+#ifdef RTR_DFLTC_THREAD_CACHE
+	if (mblk == 0 && rtr_dfltcpool->threadCaches.count > 0)
+	{
+		rtr_dfltcDrainThreadCaches(rtr_dfltcpool);
+		mblk = rtr_dfltcIntAllocMaxMsg(rtr_dfltcpool);
+	}
 #endif
 	RTBUFFERPOOLUNLOCK(pool);
 	return(mblk);
@@ -685,6 +1047,7 @@ rtr_msgb_t *rtr_dfltcDupMsg(rtr_bufferpool_t *pool, rtr_msgb_t *curmblk)
 
 		newmblk = RSSL_QUEUE_LINK_TO_OBJECT(rtr_msgb_t, link, pLink);
 
+		newmblk->flags &= ~rtr_dfltcMsgbMaxAlloc;
 		newmblk->nextMsg = 0;
 		newmblk->buffer = curmblk->buffer;
 		newmblk->length = curmblk->length;
@@ -754,6 +1117,22 @@ int rtr_dfltcFreeMsg(rtr_msgb_t *mblk)
 {
 	rtr_dfltcbufferpool_t	*rtr_dfltcpool;
 	int					retval;
+#ifdef RTR_DFLTC_THREAD_CACHE
+	rtr_dfltcThreadCache	*pCache;
+
+	rtr_dfltcpool = (rtr_dfltcbufferpool_t*)mblk->pool->internal;
+
+	/* A buffer from rtr_dfltcAllocMaxMsg() that nothing else refers to can be kept for reuse. */
+	if (rtr_dfltcpool->threadCacheSize > 0 && (mblk->flags & rtr_dfltcMsgbMaxAlloc) &&
+		mblk->nextMsg == 0 && mblk->datab && mblk->datab->numRefs == 1 &&
+		(pCache = rtr_dfltcGetThreadCache(rtr_dfltcpool)) != 0)
+	{
+		rtr_dfltcLockThreadCache(pCache);
+		rtr_dfltcThreadCacheFreeMsg(rtr_dfltcpool, pCache, mblk);
+		rtr_dfltcUnlockThreadCache(pCache);
+		return(1);
+	}
+#endif
 
 	RTBUFFERPOOLLOCK(mblk->pool);
 	rtr_dfltcpool = (rtr_dfltcbufferpool_t*)mblk->pool->internal;
@@ -822,6 +1201,59 @@ int rtr_dfltcResetPeakNumBufs(rtr_bufferpool_t *pool)
 	return(1);
 }
 
+int rtr_dfltcSetThreadCacheSize(rtr_bufferpool_t *pool, int cacheSize)
+{
+	rtr_dfltcbufferpool_t	*rtr_dfltcpool;
+
+	if (cacheSize < 0)
+		return(-1);
+
+	RTBUFFERPOOLLOCK(pool);
+	rtr_dfltcpool = (rtr_dfltcbufferpool_t*)pool->internal;
+
+#ifdef RTR_DFLTC_THREAD_CACHE
+	if (rtr_dfltcpool->threadCacheId == 0)
+	{
+		rtr_atomic_val id;
+
+		/* Ids are never reused, so a thread cannot mistake a new pool for a freed one. */
+		do
+		{
+			id = rtr_dfltcLastThreadCacheId;
+		} while (RTR_ATOMIC_COMPARE_AND_SWAP(rtr_dfltcLastThreadCacheId, id, id + 1) != id);
+
+		rtr_dfltcpool->threadCacheId = (int)(id + 1);
+	}
+
+	rtr_dfltcpool->threadCacheSize = cacheSize;
+#endif
+
+	RTBUFFERPOOLUNLOCK(pool);
+	return(1);
+}
+
+void rtr_dfltcGetThreadCacheStats(rtr_bufferpool_t *pool, RsslUInt64 *pHits, RsslUInt64 *pMisses)
+{
+	rtr_dfltcbufferpool_t	*rtr_dfltcpool;
+	RsslQueueLink			*pLink;
+
+	RTBUFFERPOOLLOCK(pool);
+	rtr_dfltcpool = (rtr_dfltcbufferpool_t*)pool->internal;
+
+	*pHits = rtr_dfltcpool->threadCacheHits;
+	*pMisses = rtr_dfltcpool->threadCacheMisses;
+
+#ifdef RTR_DFLTC_THREAD_CACHE
+	/* The hit counts of current caches are updated by their threads without the lock, so they may be slightly behind. */
+	RSSL_QUEUE_FOR_EACH_LINK(&(rtr_dfltcpool->threadCaches), pLink)
+	{
+		*pHits += RSSL_QUEUE_LINK_TO_OBJECT(rtr_dfltcThreadCache, link, pLink)->hits;
+	}
+#endif
+
+	RTBUFFERPOOLUNLOCK(pool);
+}
+
 int rtr_countFreeList(rtr_bufferpool_t *pool)
 {
 	rtr_dfltcbufferpool_t	*rtr_dfltcpool=(rtr_dfltcbufferpool_t*)pool->internal;
@@ -938,6 +1370,12 @@ rtr_dfltcbufferpool_t *rtr_dfltcAllocPool(	int init_bufs, int max_bufs,int incre
 		rsslInitQueue(&(retpool->freeMsgList));
 		rsslInitQueue(&(retpool->allocatedMblks));
 		rsslInitQueue(&(retpool->sharedPoolMblks));
+		rsslInitQueue(&(retpool->threadCaches));
+		retpool->threadCacheSize = 0;
+		retpool->threadCacheId = 0;
+		retpool->threadCacheFlushGen = 0;
+		retpool->threadCacheMisses = 0;
+		retpool->threadCacheHits = 0;
 		retpool->nextChar = 0;
 		retpool->curDblk = 0;
 #ifdef _DFLTC_BUFFER_DEBUG
@@ -7,6 +7,20 @@
  */
 
 #include "rtr/rsslHashFuncs.h"
+#include <string.h>
+
+/* The crc32 instruction on 64-bit words is only available in 64-bit mode. It is compiled
+ * for a single function and used only if the CPU supports SSE4.2. */
+#if defined(_MSC_VER) && defined(_M_X64)
+#define RSSL_HASH_CRC32C
+#define RSSL_HASH_CRC32C_TARGET
+#include <nmmintrin.h>
+#include <intrin.h>
+#elif defined(__x86_64__) && (defined(__clang__) || (defined(__GNUC__) && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))))
+#define RSSL_HASH_CRC32C
+#define RSSL_HASH_CRC32C_TARGET __attribute__((target("sse4.2")))
+#include <nmmintrin.h>
+#endif
 
 
 /* CRC32 table for polynomial 0xF3C5F6A9 */
@@ -80,3 +94,174 @@ RSSL_API RsslUInt32 rsslHashingEntityId(const char *buf, const RsslUInt32 length
 
 	return (RsslUInt32)sum;
 }
+
+/* Primes from xxHash. */
+#define RSSL_HASH_PRIME64_1 0x9E3779B185EBCA87ULL
+#define RSSL_HASH_PRIME64_2 0xC2B2AE3D27D4EB4FULL
+#define RSSL_HASH_PRIME64_3 0x165667B19E3779F9ULL
+#define RSSL_HASH_PRIME64_4 0x85EBCA77C2B2AE63ULL
+#define RSSL_HASH_PRIME64_5 0x27D4EB2F165667C5ULL
+
+#define RSSL_HASH_ROTL64(__x, __r) (((__x) << (__r)) | ((__x) >> (64 - (__r))))
+
+typedef RsslUInt32 (*RsslFastHashFunc)(const char* buf, RsslUInt32 length, RsslUInt32 seed);
+
+static RsslFastHashFunc rsslFastHashFunc = 0;
+static RsslHashKernel rsslFastHashKernel = RSSL_HASH_KERNEL_AUTO;
+
+/* Same steps as the short input path of xxHash64. memcpy() keeps unaligned loads well defined;
+ * compilers turn it into a single load. */
+static RsslUInt32 _fastHashPortable(const char* buf, RsslUInt32 length, RsslUInt32 seed)
+{
+	RsslUInt64 hash = (RsslUInt64)seed + RSSL_HASH_PRIME64_5 + length;
+	RsslUInt64 word;
+	RsslUInt32 word32;
+
+	for (; length >= 8; buf += 8, length -= 8)
+	{
+		memcpy(&word, buf, 8);
+		word *= RSSL_HASH_PRIME64_2;
+		word = RSSL_HASH_ROTL64(word, 31);
+		word *= RSSL_HASH_PRIME64_1;
+		hash ^= word;
+		hash = RSSL_HASH_ROTL64(hash, 27) * RSSL_HASH_PRIME64_1 + RSSL_HASH_PRIME64_4;
+	}
+
+	if (length >= 4)
+	{
+		memcpy(&word32, buf, 4);
+		hash ^= (RsslUInt64)word32 * RSSL_HASH_PRIME64_1;
+		hash = RSSL_HASH_ROTL64(hash, 23) * RSSL_HASH_PRIME64_2 + RSSL_HASH_PRIME64_3;
+		buf += 4;
+		length -= 4;
+	}
+
+	for (; length > 0; ++buf, --length)
+	{
+		hash ^= (RsslUInt64)(unsigned char)*buf * RSSL_HASH_PRIME64_5;
+		hash = RSSL_HASH_ROTL64(hash, 11) * RSSL_HASH_PRIME64_1;
+	}
+
+	hash ^= hash >> 33;
+	hash *= RSSL_HASH_PRIME64_2;
+	hash ^= hash >> 29;
+	hash *= RSSL_HASH_PRIME64_3;
+	hash ^= hash >> 32;
+
+	return (RsslUInt32)hash;
+}
+
+#ifdef RSSL_HASH_CRC32C
+RSSL_HASH_CRC32C_TARGET static RsslUInt32 _fastHashCrc32c(const char* buf, RsslUInt32 length, RsslUInt32 seed)
+{
+	RsslUInt64 crc = seed ^ length;
+	RsslUInt64 word;
+	RsslUInt32 hash;
+
+	for (; length >= 8; buf += 8, length -= 8)
+	{
+		memcpy(&word, buf, 8);
+		crc = _mm_crc32_u64(crc, word);
+	}
+
+	hash = (RsslUInt32)crc;
+
+	for (; length > 0; ++buf, --length)
+		hash = _mm_crc32_u8(hash, (unsigned char)*buf);
+
+	/* A crc is linear in its input, so mix the bits before the table takes the remainder.
+	 * This is the finalizer of MurmurHash3. */
+	hash ^= hash >> 16;
+	hash *= 0x85EBCA6B;
+	hash ^= hash >> 13;
+	hash *= 0xC2B2AE35;
+	hash ^= hash >> 16;
+
+	return hash;
+}
+
+/* The check is cached, since rsslFastHashWithKernel() may be called for every key. */
+static RsslBool _cpuHasSSE42()
+{
+	static int hasSSE42 = -1;
+
+	if (hasSSE42 == -1)
+	{
+#if defined(_MSC_VER)
+		int info[4];
+
+		__cpuid(info, 1);
+		hasSSE42 = (info[2] & (1 << 20)) ? 1 : 0;
+#else
+		__builtin_cpu_init();
+		hasSSE42 = __builtin_cpu_supports("sse4.2") ? 1 : 0;
+#endif
+	}
+
+	return hasSSE42 ? RSSL_TRUE : RSSL_FALSE;
+}
+#endif
+
+static RsslFastHashFunc _getFastHashFunc(RsslHashKernel kernel)
+{
+	switch (kernel)
+	{
+	case RSSL_HASH_KERNEL_PORTABLE:
+		return _fastHashPortable;
+#ifdef RSSL_HASH_CRC32C
+	case RSSL_HASH_KERNEL_CRC32C:
+		return (_cpuHasSSE42() ? _fastHashCrc32c : 0);
+#endif
+	default:
+		return 0;
+	}
+}
+
+RSSL_API RsslHashKernel rsslFastHashSelectedKernel()
+{
+	if (rsslFastHashFunc == 0)
+	{
+		RsslHashKernel kernel;
+
+		/* Picks the last supported kernel. Concurrent first calls all pick the same one. */
+		for (kernel = (RsslHashKernel)(RSSL_HASH_KERNEL_MAX - 1); kernel > RSSL_HASH_KERNEL_AUTO; kernel = (RsslHashKernel)(kernel - 1))
+		{
+			RsslFastHashFunc func = _getFastHashFunc(kernel);
+
+			if (func)
+			{
+				rsslFastHashKernel = kernel;
+				rsslFastHashFunc = func;
+				break;
+			}
+		}
+	}
+
+	return rsslFastHashKernel;
+}
+
+RSSL_API RsslBool rsslFastHashKernelSupported(RsslHashKernel kernel)
+{
+	if (kernel == RSSL_HASH_KERNEL_AUTO)
+		return RSSL_TRUE;
+
+	return (_getFastHashFunc(kernel) ? RSSL_TRUE : RSSL_FALSE);
+}
+
+RSSL_API RsslUInt32 rsslFastHash(const char* buf, const RsslUInt32 length, const RsslUInt32 seed)
+{
+	if (rsslFastHashFunc == 0)
+		rsslFastHashSelectedKernel();
+
+	return (*rsslFastHashFunc)(buf, length, seed);
+}
+
+RSSL_API RsslUInt32 rsslFastHashWithKernel(RsslHashKernel kernel, const char* buf, const RsslUInt32 length, const RsslUInt32 seed)
+{
+	RsslFastHashFunc func;
+
+	if (kernel == RSSL_HASH_KERNEL_AUTO || (func = _getFastHashFunc(kernel)) == 0)
+		return rsslFastHash(buf, length, seed);
+
+	return (*func)(buf, length, seed);
+}
@@ -7,6 +7,7 @@
  */
 
 #include "rtr/rsslHashTable.h"
+#include "rtr/rsslHashFuncs.h"
 
 /* U16 */
 
@@ -51,3 +52,6 @@ RSSL_API RsslUInt32 rsslHashBufferSum(void *pKey)
 
 RSSL_API RsslBool rsslHashBufferCompare(void *pKey1, void *pKey2)
 { return rsslBufferIsEqual((RsslBuffer*)pKey1, (RsslBuffer*)pKey2); }
+
+RSSL_API RsslUInt32 rsslHashBufferFastSum(void *pKey)
+{ return rsslFastHash(((RsslBuffer*)pKey)->data, ((RsslBuffer*)pKey)->length, 0); }
@@ -10,12 +10,15 @@
 #include <stdlib.h>
 
 /* On windows, select is used for notification.
+ * On Linux, epoll is used unless poll is requested.
  * Otherwise poll is used. */
 #if defined(WIN32)
 #define FD_SETSIZE 6400
 #include <winsock2.h>
 #else
 #include <poll.h>
+#include <errno.h>
+#include <unistd.h>
 #endif
 
 typedef struct
@@ -26,11 +29,18 @@ typedef struct
 	void *_object;
 
 #ifndef WIN32
-	int _pollFdIndex; /* Array index of the pollfd associated with this event */
+	int _pollFdIndex; /* Array index of this event (and of its pollfd, when using poll) */
+	RsslSocket _fd;
 #else
 	SOCKET _fd;
 #endif
 
+#ifdef RSSL_NOTIFIER_EPOLL
+	RsslUInt32 _epollEvents;	/* Events currently registered with epoll. 0 if the descriptor is not in the epoll set. */
+	int _lastNotifiedIndex;		/* Index of this event in the notifier's _lastNotified array, or -1. */
+	RsslBool _fdBad;			/* Descriptor could not be registered; report it on the next wait. */
+#endif
+
 } RsslNotifierEventImpl;
 
 typedef struct
@@ -46,8 +56,261 @@ typedef struct
 	fd_set _writeFds; /* Write fd_set */
 	fd_set _exceptFds; /* Except fd_set */
 #endif
+#ifdef RSSL_NOTIFIER_EPOLL
+	RsslNotifierMode _mode; /* RSSL_NOTIFIER_MODE_EPOLL_LEVEL or RSSL_NOTIFIER_MODE_EPOLL_EDGE when _epollFd is in use. */
+	int _epollFd; /* epoll instance, or -1 when poll is used. */
+	struct epoll_event *_epollEvents; /* Output array for epoll_wait. Sized to _maxEvents. */
+	RsslNotifierEventImpl **_fdOwners; /* Event that registered each descriptor in the epoll set, indexed by descriptor. */
+	int _fdOwnersSize; /* Number of entries in _fdOwners */
+	RsslNotifierEventImpl **_lastNotified; /* Events notified by the previous wait. Their flags are reset on the next wait. */
+	int _lastNotifiedCount; /* Number of entries in _lastNotified */
+	int _fdBadCount; /* Number of events with _fdBad set */
+#endif
 } RsslNotifierImpl;
 
+#ifdef RSSL_NOTIFIER_EPOLL
+
+#define RSSL_NOTIFIER_USES_EPOLL(pNotifierImpl) ((pNotifierImpl)->_epollFd >= 0)
+
+/* Records that the event's descriptor is bad, so that the next wait reports it. */
+static void _notifierEpollSetFdBad(RsslNotifierImpl *pNotifierImpl, RsslNotifierEventImpl *pNotifierEventImpl)
+{
+	if (!pNotifierEventImpl->_fdBad)
+	{
+		pNotifierEventImpl->_fdBad = RSSL_TRUE;
+		++pNotifierImpl->_fdBadCount;
+	}
+}
+
+static void _notifierEpollClearFdBad(RsslNotifierImpl *pNotifierImpl, RsslNotifierEventImpl *pNotifierEventImpl)
+{
+	if (pNotifierEventImpl->_fdBad)
+	{
+		pNotifierEventImpl->_fdBad = RSSL_FALSE;
+		--pNotifierImpl->_fdBadCount;
+	}
+}
+
+/* Takes the event's descriptor out of the epoll set. The descriptor is only removed if this event still owns it; 
+ * if it was closed, the kernel has already dropped it and the descriptor number may now belong to another event. */
+static void _notifierEpollRemove(RsslNotifierImpl *pNotifierImpl, RsslNotifierEventImpl *pNotifierEventImpl)
+{
+	if (pNotifierEventImpl->_epollEvents != 0)
+	{
+		if (pNotifierEventImpl->_fd >= 0 && pNotifierEventImpl->_fd < pNotifierImpl->_fdOwnersSize
+				&& pNotifierImpl->_fdOwners[pNotifierEventImpl->_fd] == pNotifierEventImpl)
+		{
+			struct epoll_event epollEvent; /* Ignored, but must be non-NULL on older kernels. */
+			memset(&epollEvent, 0, sizeof(epollEvent));
+
+			/* Failure is ignored; the descriptor may already be closed. */
+			epoll_ctl(pNotifierImpl->_epollFd, EPOLL_CTL_DEL, pNotifierEventImpl->_fd, &epollEvent);
+			pNotifierImpl->_fdOwners[pNotifierEventImpl->_fd] = NULL;
+		}
+
+		pNotifierEventImpl->_epollEvents = 0;
+	}
+}
+
+/* Brings the epoll set in line with the event's registered flags. Descriptors with no registered flags are kept out of the set,
+ * so that hangups on them do not wake the notifier. */
+static int _notifierEpollUpdate(RsslNotifierImpl *pNotifierImpl, RsslNotifierEventImpl *pNotifierEventImpl)
+{
+	struct epoll_event epollEvent;
+	RsslUInt32 events = 0;
+	int op;
+
+	if (pNotifierEventImpl->_registeredFlags & RSSL_NESF_READ)
+		events |= EPOLLIN | EPOLLPRI;
+
+	if (pNotifierEventImpl->_registeredFlags & RSSL_NESF_WRITE)
+		events |= EPOLLOUT;
+
+	if (events == 0)
+	{
+		_notifierEpollRemove(pNotifierImpl, pNotifierEventImpl);
+		return 0;
+	}
+
+	if (pNotifierImpl->_mode == RSSL_NOTIFIER_MODE_EPOLL_EDGE)
+		events |= EPOLLET;
+
+	if (events == pNotifierEventImpl->_epollEvents)
+		return 0; /* Already registered. */
+
+	if (pNotifierEventImpl->_fd < 0)
+	{
+		_notifierEpollSetFdBad(pNotifierImpl, pNotifierEventImpl);
+		return 0;
+	}
+
+	if (pNotifierEventImpl->_fd >= pNotifierImpl->_fdOwnersSize)
+	{
+		/* Grow the owner table to cover this descriptor. */
+		int newSize = pNotifierImpl->_fdOwnersSize;
+		RsslNotifierEventImpl **fdOwners;
+
+		while (newSize <= pNotifierEventImpl->_fd)
+			newSize *= 2;
+
+		if ((fdOwners = (RsslNotifierEventImpl**)realloc(pNotifierImpl->_fdOwners, newSize * sizeof(RsslNotifierEventImpl*))) == NULL)
+			return -1;
+
+		memset(&fdOwners[pNotifierImpl->_fdOwnersSize], 0, (newSize - pNotifierImpl->_fdOwnersSize) * sizeof(RsslNotifierEventImpl*));
+		pNotifierImpl->_fdOwners = fdOwners;
+		pNotifierImpl->_fdOwnersSize = newSize;
+	}
+
+	/* If another event now owns this descriptor, ours was closed and dropped from the set. */
+	if (pNotifierEventImpl->_epollEvents != 0 && pNotifierImpl->_fdOwners[pNotifierEventImpl->_fd] != pNotifierEventImpl)
+	{
+		pNotifierEventImpl->_epollEvents = 0;
+		_notifierEpollSetFdBad(pNotifierImpl, pNotifierEventImpl);
+		return 0;
+	}
+
+	op = (pNotifierEventImpl->_epollEvents != 0) ? EPOLL_CTL_MOD : EPOLL_CTL_ADD;
+
+	memset(&epollEvent, 0, sizeof(epollEvent));
+	epollEvent.events = events;
+	epollEvent.data.fd = pNotifierEventImpl->_fd;
+
+	if (epoll_ctl(pNotifierImpl->_epollFd, op, pNotifierEventImpl->_fd, &epollEvent) < 0)
+	{
+		if (op == EPOLL_CTL_MOD && errno == ENOENT)
+		{
+			/* Descriptor was closed and reopened since it was added; add it again. */
+			op = EPOLL_CTL_ADD;
+			if (epoll_ctl(pNotifierImpl->_epollFd, op, pNotifierEventImpl->_fd, &epollEvent) == 0)
+				goto registered;
+		}
+
+		switch (errno)
+		{
+			case EBADF:
+			case ENOENT:
+			case EPERM:
+				/* Descriptor is closed or cannot be polled. poll() would report POLLNVAL for it. */
+				pNotifierImpl->_fdOwners[pNotifierEventImpl->_fd] = NULL;
+				pNotifierEventImpl->_epollEvents = 0;
+				_notifierEpollSetFdBad(pNotifierImpl, pNotifierEventImpl);
+				return 0;
+			default:
+				return -1;
+		}
+	}
+
+registered:
+	pNotifierEventImpl->_epollEvents = events;
+	pNotifierImpl->_fdOwners[pNotifierEventImpl->_fd] = pNotifierEventImpl;
+	_notifierEpollClearFdBad(pNotifierImpl, pNotifierEventImpl);
+	return 0;
+}
+
+static int _notifierEpollWait(RsslNotifierImpl *pNotifierImpl, long timeoutUsec)
+{
+	int i;
+	int ret;
+
+	pNotifierImpl->base.notifiedEventCount = 0;
+
+	/* In level-triggered mode, flags from the previous wait are reset as poll() would. Only those events need to be visited. 
+	 * In edge-triggered mode, the flags stay set until the application clears them. */
+	if (pNotifierImpl->_mode != RSSL_NOTIFIER_MODE_EPOLL_EDGE)
+	{
+		for (i = 0; i < pNotifierImpl->_lastNotifiedCount; ++i)
+		{
+			RsslNotifierEventImpl *pNotifierEventImpl = pNotifierImpl->_lastNotified[i];
+			if (pNotifierEventImpl != NULL)
+			{
+				pNotifierEventImpl->base.notifiedFlags = 0;
+				pNotifierEventImpl->_lastNotifiedIndex = -1;
+			}
+		}
+	}
+	else
+	{
+		for (i = 0; i < pNotifierImpl->_lastNotifiedCount; ++i)
+		{
+			if (pNotifierImpl->_lastNotified[i] != NULL)
+				pNotifierImpl->_lastNotified[i]->_lastNotifiedIndex = -1;
+		}
+	}
+	pNotifierImpl->_lastNotifiedCount = 0;
+
+	/* Report any descriptors that could not be registered. This is rare, so scanning all events is acceptable. */
+	if (pNotifierImpl->_fdBadCount > 0)
+	{
+		for (i = 0; i < pNotifierImpl->_eventCount; ++i)
+		{
+			RsslNotifierEventImpl *pNotifierEventImpl = pNotifierImpl->_events[i];
+			if (pNotifierEventImpl->_fdBad)
+			{
+				pNotifierEventImpl->base.notifiedFlags = RSSL_NESF_BAD_FD;
+				pNotifierEventImpl->_lastNotifiedIndex = pNotifierImpl->_lastNotifiedCount;
+				pNotifierImpl->_lastNotified[pNotifierImpl->_lastNotifiedCount++] = pNotifierEventImpl;
+				pNotifierImpl->base.notifiedEvents[pNotifierImpl->base.notifiedEventCount++] = &pNotifierEventImpl->base;
+				pNotifierEventImpl->_fdBad = RSSL_FALSE;
+			}
+		}
+		pNotifierImpl->_fdBadCount = 0;
+
+		/* Don't block; the bad descriptors need attention now. */
+		timeoutUsec = 0;
+	}
+
+	ret = epoll_wait(pNotifierImpl->_epollFd, pNotifierImpl->_epollEvents, pNotifierImpl->_maxEvents, (int)(timeoutUsec/1000));
+	if (ret < 0)
+		return (pNotifierImpl->base.notifiedEventCount > 0) ? pNotifierImpl->base.notifiedEventCount : ret;
+
+	for (i = 0; i < ret; ++i)
+	{
+		struct epoll_event *pEpollEvent = &pNotifierImpl->_epollEvents[i];
+		RsslNotifierEventImpl *pNotifierEventImpl;
+		int notifiedFlags = 0;
+
+		/* Look up the event by descriptor rather than storing a pointer in the epoll data, 
+		 * so that an event that was removed can never be reported. */
+		if (pEpollEvent->data.fd < 0 || pEpollEvent->data.fd >= pNotifierImpl->_fdOwnersSize
+				|| (pNotifierEventImpl = pNotifierImpl->_fdOwners[pEpollEvent->data.fd]) == NULL)
+			continue;
+
+		if (pEpollEvent->events & (EPOLLIN | EPOLLPRI))
+			notifiedFlags |= RSSL_NESF_READ;
+
+		if (pEpollEvent->events & EPOLLOUT)
+			notifiedFlags |= RSSL_NESF_WRITE;
+
+		/* Let the reader/writer discover errors and hangups, as it would after poll(). */
+		if (pEpollEvent->events & (EPOLLERR | EPOLLHUP))
+			notifiedFlags |= pNotifierEventImpl->_registeredFlags & (RSSL_NESF_READ | RSSL_NESF_WRITE);
+
+		if (!notifiedFlags)
+			continue;
+
+		if (pNotifierEventImpl->_lastNotifiedIndex >= 0)
+		{
+			/* Already reported as bad on this wait. */
+			pNotifierEventImpl->base.notifiedFlags |= notifiedFlags;
+			continue;
+		}
+
+		if (pNotifierImpl->_mode == RSSL_NOTIFIER_MODE_EPOLL_EDGE)
+			pNotifierEventImpl->base.notifiedFlags |= notifiedFlags;
+		else
+			pNotifierEventImpl->base.notifiedFlags = notifiedFlags;
+
+		pNotifierEventImpl->_lastNotifiedIndex = pNotifierImpl->_lastNotifiedCount;
+		pNotifierImpl->_lastNotified[pNotifierImpl->_lastNotifiedCount++] = pNotifierEventImpl;
+		pNotifierImpl->base.notifiedEvents[pNotifierImpl->base.notifiedEventCount++] = &pNotifierEventImpl->base;
+	}
+
+	return pNotifierImpl->base.notifiedEventCount;
+}
+
+#endif
+
+
 RSSL_API RsslNotifierEvent *rsslCreateNotifierEvent()
 {
 	return (RsslNotifierEvent*)calloc(sizeof(RsslNotifierEventImpl), 1);
@@ -64,12 +327,29 @@ RSSL_API void *rsslNotifierEventGetObject(RsslNotifierEvent *pEvent)
 	return pNotifierEventImpl->_object;
 }
 
+RSSL_API RsslSocket rsslNotifierEventGetFd(RsslNotifierEvent *pEvent)
+{
+	RsslNotifierEventImpl *pNotifierEventImpl = (RsslNotifierEventImpl*)pEvent;
+	return (RsslSocket)pNotifierEventImpl->_fd;
+}
+
 
 RSSL_API RsslNotifier *rsslCreateNotifier(int maxEventsHint)
+{
+	return rsslCreateNotifierWithMode(maxEventsHint, RSSL_NOTIFIER_MODE_DEFAULT);
+}
+
+RSSL_API RsslNotifier *rsslCreateNotifierWithMode(int maxEventsHint, RsslNotifierMode mode)
 {
 	RsslNotifierImpl *pNotifierImpl = (RsslNotifierImpl*)malloc(sizeof(RsslNotifierImpl));
+	if (pNotifierImpl == NULL)
+		return NULL;
+
 	memset(pNotifierImpl, 0, sizeof(RsslNotifierImpl));
 
+	if (maxEventsHint < 1)
+		maxEventsHint = 1;
+
 	pNotifierImpl->_maxEvents = maxEventsHint;
 	pNotifierImpl->_events = (RsslNotifierEventImpl**)malloc(maxEventsHint * sizeof(RsslNotifierEventImpl**));
 	if (pNotifierImpl->_events == NULL)
@@ -85,14 +365,38 @@ RSSL_API RsslNotifier *rsslCreateNotifier(int maxEventsHint)
 		return NULL;
 	}
 
-#ifndef WIN32
-	pNotifierImpl->_pollFds = (struct pollfd*)malloc(maxEventsHint * sizeof(struct pollfd));
-	if (pNotifierImpl->_pollFds == NULL)
+#ifdef RSSL_NOTIFIER_EPOLL
+	pNotifierImpl->_epollFd = -1;
+
+	if (mode != RSSL_NOTIFIER_MODE_POLL)
 	{
-		rsslDestroyNotifier(&pNotifierImpl->base);
-		return NULL;
+		pNotifierImpl->_mode = (mode == RSSL_NOTIFIER_MODE_EPOLL_EDGE) ? RSSL_NOTIFIER_MODE_EPOLL_EDGE : RSSL_NOTIFIER_MODE_EPOLL_LEVEL;
+
+		if ((pNotifierImpl->_epollEvents = (struct epoll_event*)malloc(maxEventsHint * sizeof(struct epoll_event))) == NULL
+				|| (pNotifierImpl->_lastNotified = (RsslNotifierEventImpl**)malloc(maxEventsHint * sizeof(RsslNotifierEventImpl*))) == NULL
+				|| (pNotifierImpl->_fdOwners = (RsslNotifierEventImpl**)calloc(1024, sizeof(RsslNotifierEventImpl*))) == NULL)
+		{
+			rsslDestroyNotifier(&pNotifierImpl->base);
+			return NULL;
+		}
+		pNotifierImpl->_fdOwnersSize = 1024;
+
+		/* If epoll is unavailable, fall back to poll. */
+		pNotifierImpl->_epollFd = epoll_create1(EPOLL_CLOEXEC);
 	}
+
+	if (!RSSL_NOTIFIER_USES_EPOLL(pNotifierImpl))
 #endif
+	{
+#ifndef WIN32
+		pNotifierImpl->_pollFds = (struct pollfd*)malloc(maxEventsHint * sizeof(struct pollfd));
+		if (pNotifierImpl->_pollFds == NULL)
+		{
+			rsslDestroyNotifier(&pNotifierImpl->base);
+			return NULL;
+		}
+#endif
+	}
 
 	return &pNotifierImpl->base;
 }
@@ -111,6 +415,15 @@ RSSL_API void rsslDestroyNotifier(RsslNotifier *pNotifier)
 	pNotifierImpl->_pollFds = NULL;
 #endif
 
+#ifdef RSSL_NOTIFIER_EPOLL
+	if (pNotifierImpl->_epollFd >= 0)
+		close(pNotifierImpl->_epollFd);
+
+	free(pNotifierImpl->_epollEvents);
+	free(pNotifierImpl->_fdOwners);
+	free(pNotifierImpl->_lastNotified);
+#endif
+
 	free(pNotifierImpl);
 }
 
@@ -131,37 +444,67 @@ RSSL_API int rsslNotifierAddEvent(RsslNotifier *pNotifier, RsslNotifierEvent *pE
 		/* Event arrays are full; double their sizes before adding the new event. */
 #ifndef WIN32
 		struct pollfd *pollFds;
+#endif
+#ifdef RSSL_NOTIFIER_EPOLL
+		struct epoll_event *epollEvents;
+		RsslNotifierEventImpl **lastNotified;
 #endif
 		RsslNotifierEvent **notifiedEvents;
 		RsslNotifierEventImpl **events = (RsslNotifierEventImpl**)realloc(pNotifierImpl->_events, pNotifierImpl->_maxEvents * 2 * sizeof(RsslNotifierEventImpl**));
 		if (events == NULL)
 			return -1;
 
+		pNotifierImpl->_events = events;
+
 		notifiedEvents = (RsslNotifierEvent**)realloc(pNotifierImpl->base.notifiedEvents, pNotifierImpl->_maxEvents * 2 * sizeof(RsslNotifierEvent**));
 		if (notifiedEvents == NULL)
 			return -1;
+		pNotifierImpl->base.notifiedEvents = notifiedEvents;
 
+#ifdef RSSL_NOTIFIER_EPOLL
+		if (RSSL_NOTIFIER_USES_EPOLL(pNotifierImpl))
+		{
+			epollEvents = (struct epoll_event*)realloc(pNotifierImpl->_epollEvents, pNotifierImpl->_maxEvents * 2 * sizeof(struct epoll_event));
+			if (epollEvents == NULL)
+				return -1;
+			pNotifierImpl->_epollEvents = epollEvents;
+
+			lastNotified = (RsslNotifierEventImpl**)realloc(pNotifierImpl->_lastNotified, pNotifierImpl->_maxEvents * 2 * sizeof(RsslNotifierEventImpl*));
+			if (lastNotified == NULL)
+				return -1;
+			pNotifierImpl->_lastNotified = lastNotified;
+		}
+		else
+#endif
+		{
 #ifndef WIN32
-		pollFds = (struct pollfd*)realloc(pNotifierImpl->_pollFds, pNotifierImpl->_maxEvents * 2 * sizeof(struct pollfd));
-		if (pollFds == NULL)
-			return -1;
+			pollFds = (struct pollfd*)realloc(pNotifierImpl->_pollFds, pNotifierImpl->_maxEvents * 2 * sizeof(struct pollfd));
+			if (pollFds == NULL)
+				return -1;
+			pNotifierImpl->_pollFds = pollFds;
 #endif
+		}
 
 		pNotifierImpl->_maxEvents *= 2;
-		pNotifierImpl->_events = events;
-		pNotifierImpl->base.notifiedEvents = notifiedEvents;
-#ifndef WIN32
-		pNotifierImpl->_pollFds = pollFds;
-#endif
 	}
 
 #ifndef WIN32
-	memset(&pNotifierImpl->_pollFds[pNotifierImpl->_eventCount], 0, sizeof(struct pollfd));
-	pNotifierImpl->_pollFds[pNotifierImpl->_eventCount].fd = fd;
+#ifdef RSSL_NOTIFIER_EPOLL
+	/* A wait only resets the flags of the events it last notified, so an event that is reused must not carry flags from before. */
+	pNotifierEventImpl->base.notifiedFlags = 0;
+	pNotifierEventImpl->_epollEvents = 0;
+	pNotifierEventImpl->_lastNotifiedIndex = -1;
+	pNotifierEventImpl->_fdBad = RSSL_FALSE;
+
+	if (!RSSL_NOTIFIER_USES_EPOLL(pNotifierImpl))
+#endif
+	{
+		memset(&pNotifierImpl->_pollFds[pNotifierImpl->_eventCount], 0, sizeof(struct pollfd));
+		pNotifierImpl->_pollFds[pNotifierImpl->_eventCount].fd = fd;
+	}
 	pNotifierEventImpl->_pollFdIndex = pNotifierImpl->_eventCount;
-#else
-	pNotifierEventImpl->_fd = fd;
 #endif
+	pNotifierEventImpl->_fd = fd;
 
 	pNotifierEventImpl->_object = object;
 
@@ -176,6 +519,22 @@ RSSL_API int rsslNotifierUpdateEventFd(RsslNotifier *pNotifier, RsslNotifierEven
 	RsslNotifierEventImpl *pNotifierEventImpl = (RsslNotifierEventImpl*)pEvent;
 	int i;
 
+#ifdef RSSL_NOTIFIER_EPOLL
+	if (RSSL_NOTIFIER_USES_EPOLL(pNotifierImpl))
+	{
+		i = pNotifierEventImpl->_pollFdIndex;
+
+		if (i < 0 || i >= pNotifierImpl->_eventCount || pNotifierImpl->_events[i] != pNotifierEventImpl)
+			return -1; /* Not found. */
+
+		/* As with poll, the existing registration carries over to the new descriptor. */
+		_notifierEpollRemove(pNotifierImpl, pNotifierEventImpl);
+		_notifierEpollClearFdBad(pNotifierImpl, pNotifierEventImpl);
+		pNotifierEventImpl->_fd = fd;
+		return _notifierEpollUpdate(pNotifierImpl, pNotifierEventImpl);
+	}
+#endif
+
 	pNotifierEventImpl->_registeredFlags = 0;
 
 	for (i = 0; i < pNotifierImpl->_eventCount; ++i)
@@ -185,9 +544,8 @@ RSSL_API int rsslNotifierUpdateEventFd(RsslNotifier *pNotifier, RsslNotifierEven
 
 #ifndef WIN32
 			pNotifierImpl->_pollFds[pNotifierEventImpl->_pollFdIndex].fd = fd;
-#else
-			pNotifierEventImpl->_fd = fd;
 #endif
+			pNotifierEventImpl->_fd = fd;
 			return 0;
 		}
 	}
@@ -204,6 +562,38 @@ RSSL_API int rsslNotifierRemoveEvent(RsslNotifier *pNotifier, RsslNotifierEvent
 
 	pNotifierEventImpl->_registeredFlags = 0;
 
+#ifdef RSSL_NOTIFIER_EPOLL
+	if (RSSL_NOTIFIER_USES_EPOLL(pNotifierImpl))
+	{
+		i = pNotifierEventImpl->_pollFdIndex;
+
+		if (i < 0 || i >= pNotifierImpl->_eventCount || pNotifierImpl->_events[i] != pNotifierEventImpl)
+			return 0; /* Not associated with this notifier. */
+
+		_notifierEpollRemove(pNotifierImpl, pNotifierEventImpl);
+		_notifierEpollClearFdBad(pNotifierImpl, pNotifierEventImpl);
+
+		/* Make sure the next wait doesn't touch this event, since it may be destroyed. */
+		if (pNotifierEventImpl->_lastNotifiedIndex >= 0)
+		{
+			pNotifierImpl->_lastNotified[pNotifierEventImpl->_lastNotifiedIndex] = NULL;
+			pNotifierEventImpl->_lastNotifiedIndex = -1;
+		}
+		pNotifierEventImpl->base.notifiedFlags = 0;
+
+		/* Swap in last event */
+		if (i != pNotifierImpl->_eventCount - 1)
+		{
+			pNotifierImpl->_events[i] = pNotifierImpl->_events[pNotifierImpl->_eventCount - 1];
+			pNotifierImpl->_events[i]->_pollFdIndex = i;
+		}
+
+		pNotifierEventImpl->_pollFdIndex = -1;
+		--pNotifierImpl->_eventCount;
+		return 0;
+	}
+#endif
+
 	for (i = 0; i < pNotifierImpl->_eventCount; ++i)
 	{
 		if (pNotifierImpl->_events[i] == pNotifierEventImpl)
@@ -233,6 +623,10 @@ RSSL_API int rsslNotifierRegisterRead(RsslNotifier *pNotifier, RsslNotifierEvent
 	RsslNotifierImpl *pNotifierImpl = (RsslNotifierImpl*)pNotifier;
 	RsslNotifierEventImpl *pNotifierEventImpl = (RsslNotifierEventImpl*)pEvent;
 	pNotifierEventImpl->_registeredFlags |= RSSL_NESF_READ;
+#ifdef RSSL_NOTIFIER_EPOLL
+	if (RSSL_NOTIFIER_USES_EPOLL(pNotifierImpl))
+		return _notifierEpollUpdate(pNotifierImpl, pNotifierEventImpl);
+#endif
 #ifndef WIN32
 	pNotifierImpl->_pollFds[pNotifierEventImpl->_pollFdIndex].events |= POLLIN | POLLPRI;
 #endif
@@ -244,6 +638,10 @@ RSSL_API int rsslNotifierUnregisterRead(RsslNotifier *pNotifier, RsslNotifierEve
 	RsslNotifierImpl *pNotifierImpl = (RsslNotifierImpl*)pNotifier;
 	RsslNotifierEventImpl *pNotifierEventImpl = (RsslNotifierEventImpl*)pEvent;
 	pNotifierEventImpl->_registeredFlags &= ~RSSL_NESF_READ;
+#ifdef RSSL_NOTIFIER_EPOLL
+	if (RSSL_NOTIFIER_USES_EPOLL(pNotifierImpl))
+		return _notifierEpollUpdate(pNotifierImpl, pNotifierEventImpl);
+#endif
 #ifndef WIN32
 	pNotifierImpl->_pollFds[pNotifierEventImpl->_pollFdIndex].events &= ~(POLLIN | POLLPRI);
 #endif
@@ -256,6 +654,10 @@ RSSL_API int rsslNotifierRegisterWrite(RsslNotifier *pNotifier, RsslNotifierEven
 	RsslNotifierImpl *pNotifierImpl = (RsslNotifierImpl*)pNotifier;
 	RsslNotifierEventImpl *pNotifierEventImpl = (RsslNotifierEventImpl*)pEvent;
 	pNotifierEventImpl->_registeredFlags |= RSSL_NESF_WRITE;
+#ifdef RSSL_NOTIFIER_EPOLL
+	if (RSSL_NOTIFIER_USES_EPOLL(pNotifierImpl))
+		return _notifierEpollUpdate(pNotifierImpl, pNotifierEventImpl);
+#endif
 #ifndef WIN32
 	pNotifierImpl->_pollFds[pNotifierEventImpl->_pollFdIndex].events |= POLLOUT;
 #endif
@@ -267,6 +669,10 @@ RSSL_API int rsslNotifierUnregisterWrite(RsslNotifier *pNotifier, RsslNotifierEv
 	RsslNotifierImpl *pNotifierImpl = (RsslNotifierImpl*)pNotifier;
 	RsslNotifierEventImpl *pNotifierEventImpl = (RsslNotifierEventImpl*)pEvent;
 	pNotifierEventImpl->_registeredFlags &= ~RSSL_NESF_WRITE;
+#ifdef RSSL_NOTIFIER_EPOLL
+	if (RSSL_NOTIFIER_USES_EPOLL(pNotifierImpl))
+		return _notifierEpollUpdate(pNotifierImpl, pNotifierEventImpl);
+#endif
 #ifndef WIN32
 	pNotifierImpl->_pollFds[pNotifierEventImpl->_pollFdIndex].events &= ~POLLOUT;
 #endif
@@ -279,6 +685,11 @@ RSSL_API int rsslNotifierWait(RsslNotifier *pNotifier, long timeoutUsec)
 	int i;
 	int ret;
 
+#ifdef RSSL_NOTIFIER_EPOLL
+	if (RSSL_NOTIFIER_USES_EPOLL(pNotifierImpl))
+		return _notifierEpollWait(pNotifierImpl, timeoutUsec);
+#endif
+
 #ifndef WIN32
 	pNotifierImpl->base.notifiedEventCount = 0;
 	ret = poll(pNotifierImpl->_pollFds, pNotifierImpl->_eventCount, timeoutUsec/1000);
@@ -240,6 +240,38 @@ RSSL_API RsslRet rsslLoadEnumTypeDictionary(	const char				*filename,
 							RsslDataDictionary	*dictionary,
 							RsslBuffer			*errorText );
 
+/**
+ * @brief Writes the fields, enumerated type tables and tags of a data dictionary to a binary snapshot file, which can be loaded with rsslLoadDataDictionarySnapshot().
+ * The snapshot uses the structure layout of this build of the library, so it can only be loaded by builds with the same layout and pointer size.
+ * @param filename Name of the snapshot file to create.
+ * @param dictionary The dictionary to write. Must contain definitions.
+ * @param baseAddress Address at which loaders should try to map the snapshot. It must be a multiple of 65536. If 0, an address is chosen from the dictionary contents(or none, on 32-bit platforms).
+ * @param errorText Buffer to hold error text if the snapshot cannot be written.
+ * @see RsslDataDictionary, rsslLoadDataDictionarySnapshot
+ */
+RSSL_API RsslRet rsslSaveDataDictionarySnapshot(	const char				*filename,
+							RsslDataDictionary	*dictionary,
+							RsslUInt64			baseAddress,
+							RsslBuffer			*errorText );
+
+/**
+ * @brief Loads a data dictionary from a snapshot file written by rsslSaveDataDictionarySnapshot().
+ * The file is mapped read-only, and the dictionary's entries, enumerated type tables and tags point into the mapping.
+ * When the snapshot can be mapped at its base address it is used as it is, so every process loading it shares the same physical pages.
+ * Otherwise a private mapping is made and its pointers are adjusted.
+ * The dictionary must not already contain definitions, and no definitions can be added to it afterwards. rsslDeleteDataDictionary() unmaps the file.
+ * @see RsslDataDictionary, rsslSaveDataDictionarySnapshot
+ */
+RSSL_API RsslRet rsslLoadDataDictionarySnapshot(	const char				*filename,
+							RsslDataDictionary	*dictionary,
+							RsslBuffer			*errorText );
+
+/**
+ * @brief Returns RSSL_TRUE if the file starts like a snapshot written by rsslSaveDataDictionarySnapshot().
+ * @see rsslLoadDataDictionarySnapshot
+ */
+RSSL_API RsslBool rsslIsDataDictionarySnapshot(const char *filename);
+
 
 /**
  * @brief Encode the enumerated types dictionary according the domain model, using the information from the tables and referencing fields present in this dictionary.
@@ -0,0 +1,164 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2022 Refinitiv. All rights reserved.              --
+ *|-----------------------------------------------------------------------------
+ */
+
+#ifndef __RSSL_ENCODE_PLAN_H
+#define __RSSL_ENCODE_PLAN_H
+
+#include "rtr/rsslTypes.h"
+#include "rtr/rsslRetCodes.h"
+#include "rtr/rsslMsg.h"
+#include "rtr/rsslFieldList.h"
+#include "rtr/rsslDataDictionary.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup MsgEncodeUtilsHelpers
+ * @{
+ */
+
+/**
+ * @brief Flags of a field in an encode plan.
+ * @see RsslEncodePlanField
+ */
+typedef enum {
+	RSSL_EPFF_NONE			= 0x00,	/*!< (0x00) No flags set. */
+	RSSL_EPFF_FIXED_WIDTH	= 0x01	/*!< (0x01) Always encode the value at the full width of its type, so that its position in the message does not depend on the values, and it can be replaced with rsslPatchEncodePlanValue().  Supported for ::RSSL_DT_INT, ::RSSL_DT_UINT, ::RSSL_DT_REAL, ::RSSL_DT_FLOAT, ::RSSL_DT_DOUBLE, ::RSSL_DT_ENUM, ::RSSL_DT_DATE, ::RSSL_DT_TIME and ::RSSL_DT_DATETIME fields.  Of these, only a ::RSSL_DT_REAL value can be blank. */
+} RsslEncodePlanFieldFlags;
+
+/**
+ * @brief A field of the field list encoded by an encode plan.
+ * @see RsslEncodePlan, rsslBuildEncodePlan
+ */
+typedef struct {
+	RsslFieldId	fieldId;	/*!< @brief Field identifier. */
+	RsslUInt8	dataType;	/*!< @brief Primitive type of the value: ::RSSL_DT_INT, ::RSSL_DT_UINT, ::RSSL_DT_REAL, ::RSSL_DT_FLOAT, ::RSSL_DT_DOUBLE, ::RSSL_DT_ENUM, ::RSSL_DT_DATE, ::RSSL_DT_TIME, ::RSSL_DT_DATETIME, ::RSSL_DT_BUFFER, ::RSSL_DT_ASCII_STRING, ::RSSL_DT_UTF8_STRING or ::RSSL_DT_RMTES_STRING. */
+	RsslUInt8	flags;		/*!< @brief Flags from ::RsslEncodePlanFieldFlags. */
+} RsslEncodePlanField;
+
+/**
+ * @brief Internal use only. A field of a built encode plan.
+ */
+typedef struct _RsslEncodePlanSlot RsslEncodePlanSlot;
+
+/**
+ * @brief A precompiled encoding of a message whose payload is a field list of the same fields each time.
+ *
+ * The message header and field list header are encoded once when the plan is built.  Encoding a message
+ * with the plan then copies them and writes the field identifiers and values directly, with an encoder chosen
+ * for each field's type when the plan was built.
+ * @see rsslBuildEncodePlan, rsslBuildEncodePlanFromSample, rsslEncodeWithPlan, rsslPatchEncodePlanValue, rsslDeleteEncodePlan
+ */
+typedef struct {
+	RsslUInt16			fieldCount;		/*!< @brief Number of fields, and of values passed to rsslEncodeWithPlan(). */
+	RsslUInt32			encodedLength;	/*!< @brief If every field is ::RSSL_EPFF_FIXED_WIDTH, the length of every message encoded with the plan.  Otherwise 0. */
+	RsslUInt8			majorVersion;	/*!< @brief Major version of RWF with which messages are encoded. */
+	RsslUInt8			minorVersion;	/*!< @brief Minor version of RWF with which messages are encoded. */
+	char				*_header;		/*!< @brief Internal use only. Encoded message header and field list header. */
+	RsslUInt32			_headerLength;	/*!< @brief Internal use only. */
+	RsslUInt32			_msgHeaderLength;	/*!< @brief Internal use only. Length of the message header, or 0 if the plan encodes only the field list. */
+	RsslUInt32			_maxLength;		/*!< @brief Internal use only. Maximum encoded length, not counting the content of buffer values. */
+	RsslUInt16			_bufferFieldCount;	/*!< @brief Internal use only. Number of fields whose values are buffers. */
+	RsslEncodePlanSlot	*_slots;		/*!< @brief Internal use only. */
+} RsslEncodePlan;
+
+/**
+ * @brief RsslEncodePlan static initializer
+ * @see RsslEncodePlan, rsslClearEncodePlan
+ */
+#define RSSL_INIT_ENCODE_PLAN { 0, 0, RSSL_RWF_MAJOR_VERSION, RSSL_RWF_MINOR_VERSION, 0, 0, 0, 0, 0, 0 }
+
+/**
+ * @brief Clears an RsslEncodePlan that has not been built, or has been deleted.
+ * @see RsslEncodePlan, RSSL_INIT_ENCODE_PLAN
+ */
+RTR_C_INLINE void rsslClearEncodePlan(RsslEncodePlan *pPlan)
+{
+	pPlan->fieldCount = 0;
+	pPlan->encodedLength = 0;
+	pPlan->majorVersion = RSSL_RWF_MAJOR_VERSION;
+	pPlan->minorVersion = RSSL_RWF_MINOR_VERSION;
+	pPlan->_header = 0;
+	pPlan->_headerLength = 0;
+	pPlan->_msgHeaderLength = 0;
+	pPlan->_maxLength = 0;
+	pPlan->_bufferFieldCount = 0;
+	pPlan->_slots = 0;
+}
+
+/**
+ * @brief Builds an encode plan from a message header and a list of fields.
+ *
+ * @param pPlan Cleared plan to build.  The plan's majorVersion and minorVersion are used to encode the header.
+ * @param pMsg Header of the messages.  Its containerType must be ::RSSL_DT_FIELD_LIST.  Any key attributes and extended header must be given as pre-encoded buffers.  The stream identifier may be replaced on each message.  NULL to encode only the field list, such as to use as the pre-encoded payload of a message or entry.
+ * @param pFieldList Field list header, which may set ::RSSL_FLF_HAS_FIELD_LIST_INFO.  NULL if the field list has only standard data.  Set-defined data is not supported.
+ * @param pFields Fields of the field list, in the order they are encoded.  They are copied into the plan.
+ * @param fieldCount Number of fields.
+ * @return ::RSSL_RET_SUCCESS, ::RSSL_RET_INVALID_ARGUMENT if the header or a field is not supported, or ::RSSL_RET_FAILURE if memory could not be allocated.
+ * @see rsslEncodeWithPlan, rsslDeleteEncodePlan
+ */
+RSSL_API RsslRet rsslBuildEncodePlan(RsslEncodePlan *pPlan, RsslMsg *pMsg, const RsslFieldList *pFieldList,
+		const RsslEncodePlanField *pFields, RsslUInt16 fieldCount);
+
+/**
+ * @brief Builds an encode plan from an encoded sample message.
+ *
+ * The plan encodes the sample's message header, and the fields of its field list, with the types the dictionary gives them.
+ * @param pPlan Cleared plan to build.  The plan's majorVersion and minorVersion are used to decode the sample.
+ * @param pSample Encoded message whose payload is a field list of standard data.
+ * @param pDictionary Dictionary that defines each of the sample's fields.
+ * @param fieldFlags Flags from ::RsslEncodePlanFieldFlags to set on each field whose type supports them.
+ * @return ::RSSL_RET_SUCCESS, ::RSSL_RET_INVALID_ARGUMENT if the sample cannot be decoded or a field is not in the dictionary or not supported, or ::RSSL_RET_FAILURE if memory could not be allocated.
+ * @see rsslEncodeWithPlan, rsslDeleteEncodePlan
+ */
+RSSL_API RsslRet rsslBuildEncodePlanFromSample(RsslEncodePlan *pPlan, const RsslBuffer *pSample,
+		const RsslDataDictionary *pDictionary, RsslUInt8 fieldFlags);
+
+/**
+ * @brief Encodes a message with an encode plan.
+ *
+ * @param pPlan Built plan.
+ * @param pBuffer Buffer to encode into.  On success its length is set to the length of the message.
+ * @param streamId Stream identifier of the message.  Ignored if the plan encodes only a field list.
+ * @param pValues One pointer per field of the plan, to a value of the field's type (such as ::RsslUInt for ::RSSL_DT_UINT, or ::RsslBuffer for ::RSSL_DT_ASCII_STRING), or NULL to encode the value as blank.
+ * @return ::RSSL_RET_SUCCESS, ::RSSL_RET_BUFFER_TOO_SMALL, or ::RSSL_RET_INVALID_DATA if a value cannot be encoded.
+ * @see rsslBuildEncodePlan, rsslPatchEncodePlanValue
+ */
+RSSL_API RsslRet rsslEncodeWithPlan(const RsslEncodePlan *pPlan, RsslBuffer *pBuffer, RsslInt32 streamId, const void **pValues);
+
+/**
+ * @brief Replaces one value of a message encoded with an encode plan.
+ *
+ * The field, and each field before it, must be ::RSSL_EPFF_FIXED_WIDTH, so that the value is at the same position
+ * in every message.
+ * @param pPlan Built plan.
+ * @param pEncodedMsg Message encoded with the plan.
+ * @param fieldIndex Index of the field in the plan.
+ * @param pValue Value of the field's type, or NULL to replace it with blank.
+ * @return ::RSSL_RET_SUCCESS, ::RSSL_RET_INVALID_ARGUMENT if the field's position is not fixed or the message is too short, or ::RSSL_RET_INVALID_DATA if the value cannot be encoded.
+ * @see rsslEncodeWithPlan
+ */
+RSSL_API RsslRet rsslPatchEncodePlanValue(const RsslEncodePlan *pPlan, RsslBuffer *pEncodedMsg, RsslUInt16 fieldIndex, const void *pValue);
+
+/**
+ * @brief Frees the memory of a built encode plan, and clears it.
+ * @param pPlan Plan to delete.
+ */
+RSSL_API void rsslDeleteEncodePlan(RsslEncodePlan *pPlan);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
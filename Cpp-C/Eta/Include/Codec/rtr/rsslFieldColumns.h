@@ -0,0 +1,129 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2022 Refinitiv. All rights reserved.              --
+ *|-----------------------------------------------------------------------------
+ */
+
+#ifndef __RSSL_FIELD_COLUMNS_H
+#define __RSSL_FIELD_COLUMNS_H
+
+#include "rtr/rsslTypes.h"
+#include "rtr/rsslRetCodes.h"
+#include "rtr/rsslDataDictionary.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ *	@addtogroup RSSLWFDataCommonHelpers
+ *	@{
+ */
+
+/**
+ * @brief Types of column that numeric fields may be extracted into.
+ * @see RsslFieldColumn
+ */
+typedef enum {
+	RSSL_FCT_DOUBLE		= 1,	/*!< Values are ::RsslDouble.  Extracts ::RSSL_DT_REAL, ::RSSL_DT_FLOAT, ::RSSL_DT_DOUBLE, ::RSSL_DT_INT and ::RSSL_DT_UINT fields. */
+	RSSL_FCT_INT64		= 2,	/*!< Values are ::RsslInt64.  Extracts ::RSSL_DT_INT, ::RSSL_DT_UINT and ::RSSL_DT_ENUM fields. */
+	RSSL_FCT_TIMESTAMP	= 3		/*!< Values are ::RsslInt64 nanoseconds.  Extracts ::RSSL_DT_DATETIME fields (since 1970-01-01T00:00:00 UTC), ::RSSL_DT_DATE fields (to midnight of the date) and ::RSSL_DT_TIME fields (since midnight). */
+} RsslFieldColumnTypes;
+
+/**
+ * @brief One column of values of a field, with one row per extracted message.
+ *
+ * A row holds the field's value in that message, if the message carried the field and its value was not blank.
+ * Otherwise the row's bit in the presence bitmap is cleared, and its value is 0 (NaN for ::RSSL_FCT_DOUBLE).
+ * If a message carries the field more than once, its first entry is used.
+ * @see RsslFieldColumnSet, rsslExtractFieldColumns
+ */
+typedef struct {
+	RsslFieldId	fieldId;		/*!< @brief Field identifier of the values. */
+	RsslUInt8	columnType;		/*!< @brief Type of the values, from ::RsslFieldColumnTypes. */
+	void		*values;		/*!< @brief Array of RsslFieldColumnSet::rowCapacity values, of the type given by columnType. */
+	RsslUInt8	*presence;		/*!< @brief Bitmap of (RsslFieldColumnSet::rowCapacity + 7) / 8 bytes.  The bit (1 << (row % 8)) of byte (row / 8) is set when the row has a value.  Optional. */
+	RsslUInt32	valueCount;		/*!< @brief Number of rows that have a value.  Set by rsslExtractFieldColumns(). */
+	RsslUInt8	_fieldType;		/*!< @brief Internal use only. The field's type in the dictionary. */
+} RsslFieldColumn;
+
+/**
+ * @brief A set of columns filled in together by rsslExtractFieldColumns().
+ * @see RSSL_INIT_FIELD_COLUMN_SET, rsslClearFieldColumnSet, rsslInitFieldColumnSet, rsslExtractFieldColumns
+ */
+typedef struct {
+	RsslFieldColumn	*columns;			/*!< @brief The columns to fill in. */
+	RsslUInt32		columnCount;		/*!< @brief Number of columns, at most 64. */
+	RsslUInt32		rowCapacity;		/*!< @brief Number of rows that each column's arrays can hold. */
+	RsslUInt32		rowCount;			/*!< @brief Number of rows filled in.  Set to 0 to start filling the columns again; the next extraction then also resets each column's valueCount. */
+	RsslInt32		*streamIds;			/*!< @brief Array of rowCapacity stream identifiers, one per row.  Optional. */
+	RsslUInt8		majorVersion;		/*!< @brief Major version of RWF with which the messages are encoded. */
+	RsslUInt8		minorVersion;		/*!< @brief Minor version of RWF with which the messages are encoded. */
+	RsslUInt64		_fieldIdMask;		/*!< @brief Internal use only. Bit (fieldId % 64) is set for each column's field. */
+	RsslBool		_initialized;		/*!< @brief Internal use only. */
+} RsslFieldColumnSet;
+
+/**
+ * @brief RsslFieldColumnSet static initializer
+ * @see RsslFieldColumnSet, rsslClearFieldColumnSet
+ */
+#define RSSL_INIT_FIELD_COLUMN_SET { 0, 0, 0, 0, 0, RSSL_RWF_MAJOR_VERSION, RSSL_RWF_MINOR_VERSION, 0, RSSL_FALSE }
+
+/**
+ * @brief Clears an RsslFieldColumnSet
+ * @see RsslFieldColumnSet, RSSL_INIT_FIELD_COLUMN_SET
+ */
+RTR_C_INLINE void rsslClearFieldColumnSet(RsslFieldColumnSet *pColumnSet)
+{
+	pColumnSet->columns = 0;
+	pColumnSet->columnCount = 0;
+	pColumnSet->rowCapacity = 0;
+	pColumnSet->rowCount = 0;
+	pColumnSet->streamIds = 0;
+	pColumnSet->majorVersion = RSSL_RWF_MAJOR_VERSION;
+	pColumnSet->minorVersion = RSSL_RWF_MINOR_VERSION;
+	pColumnSet->_fieldIdMask = 0;
+	pColumnSet->_initialized = RSSL_FALSE;
+}
+
+/**
+ * @brief Prepares a set of columns for extraction, using the dictionary to find the type of each column's field.
+ *
+ * Call this once after setting the columns, and again if they change.
+ * @param pColumnSet The columns to prepare.
+ * @param pDictionary Dictionary that defines each column's field.
+ * @return ::RSSL_RET_SUCCESS, or ::RSSL_RET_INVALID_ARGUMENT if a column's field is not in the dictionary, or its type cannot be extracted into the column's type.
+ * @see rsslExtractFieldColumns
+ */
+RSSL_API RsslRet rsslInitFieldColumnSet(RsslFieldColumnSet *pColumnSet, const RsslDataDictionary *pDictionary);
+
+/**
+ * @brief Extracts numeric fields from a batch of encoded messages into columns.
+ *
+ * Each message adds one row to every column, starting at RsslFieldColumnSet::rowCount, so that the columns can be
+ * filled by several calls, for example one per read from a channel.  Messages whose payload is not an
+ * ::RSSL_DT_FIELD_LIST, or that cannot be decoded, add a row with no values.  Only standard field list entries are
+ * extracted, as there are no set definitions for the field list payload of a message.
+ *
+ * Compared with decoding each message, field list, entry and value in turn, the columns' field identifiers and types
+ * are resolved once, entries for other fields are skipped without decoding their values, and values are decoded
+ * directly by their type.
+ * @param pColumnSet Columns prepared by rsslInitFieldColumnSet().
+ * @param pMessages Encoded messages, such as the buffers returned by rsslRead().
+ * @param messageCount Number of messages.
+ * @return ::RSSL_RET_SUCCESS, or ::RSSL_RET_BUFFER_TOO_SMALL (with no rows added) if the columns do not have room for the messages.
+ * @see rsslInitFieldColumnSet
+ */
+RSSL_API RsslRet rsslExtractFieldColumns(RsslFieldColumnSet *pColumnSet, const RsslBuffer *pMessages, RsslUInt32 messageCount);
+
+/**
+ *	@}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
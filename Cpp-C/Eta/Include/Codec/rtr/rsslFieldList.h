@@ -299,6 +299,101 @@ RSSL_API RsslRet rsslDecodeFieldList(
 RSSL_API RsslRet rsslDecodeFieldEntry(
 							RsslDecodeIterator	*pIter,
 							RsslFieldEntry		*pField );
+
+
+/**
+ * @brief Records where one field is located in an encoded RsslFieldList.
+ * @see RsslFieldListIndex
+ */
+typedef struct {
+	RsslFieldId		fieldId;		/*!< @brief The field identifier of the entry. */
+	RsslUInt16		_generation;	/*!< @brief Internal use only. Identifies the field list in which the slot was filled. */
+	RsslUInt32		position;		/*!< @brief Position of the entry's encoded content, from the start of the encoded RsslFieldList. */
+	RsslUInt16		length;			/*!< @brief Length of the entry's encoded content. */
+	RsslUInt8		dataType;		/*!< @brief The type from the set definition for set-defined entries; ::RSSL_DT_UNKNOWN otherwise. */
+} RsslFieldListIndexSlot;
+
+/**
+ * @brief An index of the entries in an encoded RsslFieldList, filled in by rsslDecodeFieldListIndexed().  Once it is filled,
+ * rsslDecodeFieldEntryById() finds any entry in constant time, without decoding the entries before it.
+ *
+ * The application supplies the slots, and may reuse the same index for every field list it decodes.  Slots need not be
+ * cleared before first use.  To give an index different slots, clear it with rsslClearFieldListIndex() first.
+ *
+ * Lookups are only valid while the field list is being decoded: the index refers into the encoded field list, and
+ * rsslDecodeFieldEntryById() must not be called once rsslDecodeFieldEntry() has returned ::RSSL_RET_END_OF_CONTAINER.
+ * @see RSSL_INIT_FIELD_LIST_INDEX, rsslClearFieldListIndex, rsslDecodeFieldListIndexed, rsslDecodeFieldEntryById
+ */
+typedef struct {
+	RsslFieldListIndexSlot	*slots;			/*!< @brief Slots in which entries are recorded. */
+	RsslUInt32				slotCount;		/*!< @brief Number of slots.  Must be a power of two, and greater than the number of entries in the field list; twice the number of entries is recommended. */
+	RsslUInt32				entryCount;		/*!< @brief Number of distinct field identifiers recorded in the index. */
+	char					*_pData;		/*!< @brief Internal use only. Start of the indexed RsslFieldList. */
+	RsslUInt16				_generation;	/*!< @brief Internal use only. Identifies the field list last indexed. */
+} RsslFieldListIndex;
+
+/**
+ * @brief RsslFieldListIndex static initializer
+ * @see RsslFieldListIndex, rsslClearFieldListIndex
+ */
+#define RSSL_INIT_FIELD_LIST_INDEX { 0, 0, 0, 0, 0 }
+
+/**
+ * @brief Clears an RsslFieldListIndex
+ * @see RsslFieldListIndex, RSSL_INIT_FIELD_LIST_INDEX
+ */
+RTR_C_INLINE void rsslClearFieldListIndex(RsslFieldListIndex *pIndex)
+{
+	pIndex->slots = 0;
+	pIndex->slotCount = 0;
+	pIndex->entryCount = 0;
+	pIndex->_pData = 0;
+	pIndex->_generation = 0;
+}
+
+/**
+ * @brief Decodes an RsslFieldList container as rsslDecodeFieldList() does, and records the position of each of its
+ * entries in an index.
+ *
+ * Entries can then be looked up by field identifier with rsslDecodeFieldEntryById(), in any order.  The iterator is
+ * left positioned at the first entry, so the entries may also be decoded in order with rsslDecodeFieldEntry().  If a
+ * field identifier appears more than once, the index refers to its first entry.
+ *
+ * Typical use:<BR>
+ *  1. Call rsslDecodeFieldListIndexed()<BR>
+ *  2. Call rsslDecodeFieldEntryById() for each field of interest, decoding its content if it is found.<BR>
+ *
+ * @param pIter Decode iterator to use for decode process
+ * @param pFieldList RsslFieldList structure to populate with decoded contents.
+ * @param pLocalSetDb Set definition database to use while decoding any set defined content.
+ * @param pIndex Index to fill in.  Its slots are overwritten.
+ * @see rsslDecodeFieldEntryById, RsslFieldListIndex
+ * @return Returns the result of rsslDecodeFieldList(), or ::RSSL_RET_BUFFER_TOO_SMALL if the index has too few slots for the entries, or ::RSSL_RET_INCOMPLETE_DATA if an entry is incomplete.
+ */
+RSSL_API RsslRet rsslDecodeFieldListIndexed(
+							RsslDecodeIterator		*pIter,
+							RsslFieldList			*pFieldList,
+							RsslLocalFieldSetDefDb	*pLocalSetDb,
+							RsslFieldListIndex		*pIndex);
+
+/**
+ * @brief Finds the entry with the given field identifier in a field list indexed by rsslDecodeFieldListIndexed().
+ *
+ * If the entry is found, the iterator is positioned so that its content can be decoded, as after rsslDecodeFieldEntry().
+ * Looking up entries does not change the position of in-order decoding with rsslDecodeFieldEntry().
+ *
+ * @param pIter Decode iterator that was passed to rsslDecodeFieldListIndexed()
+ * @param pIndex Index filled in by rsslDecodeFieldListIndexed()
+ * @param fieldId Field identifier to look up
+ * @param pField RsslFieldEntry to decode content into.
+ * @see rsslDecodeFieldListIndexed, RsslFieldListIndex
+ * @return Returns ::RSSL_RET_SUCCESS if the entry was found, or ::RSSL_RET_END_OF_CONTAINER if the field list contains no entry with this field identifier.
+ */
+RSSL_API RsslRet rsslDecodeFieldEntryById(
+							RsslDecodeIterator			*pIter,
+							const RsslFieldListIndex	*pIndex,
+							RsslFieldId					fieldId,
+							RsslFieldEntry				*pField );
 				 
 
 /**
@@ -29,6 +29,8 @@ extern "C"
 
 #include "rtr/rsslMsgEncoders.h"
 #include "rtr/rsslMsgDecoders.h"
+#include "rtr/rsslFieldColumns.h"
+#include "rtr/rsslEncodePlan.h"
 
 /** 
  *	@addtogroup MsgPkgVersion Message Package Library Version Helper
@@ -172,7 +172,8 @@ typedef enum
 	RSSL_JSON_CPC_REAL_AS_EXPONENT				= 6,	/*!< (Standard JSON) Convert RsslReals to an exponent primitive (value: RsslBool). */
 	RSSL_JSON_CPC_CATCH_UNKNOWN_JSON_KEYS		= 7,	/*!< (Simplified JSON) When converting from JSON to RWF, catch unknown JSON keys.  (value: RsslBool). */
 	RSSL_JSON_CPC_CATCH_UNKNOWN_JSON_FIDS		= 8,	/*!< (Simplified JSON) When converting from JSON to RWF, catch unknown FIDS.  (value: RsslBool). */
-	RSSL_JSON_CPC_ALLOW_ENUM_DISPLAY_STRINGS	= 9		/*!< (Simplified JSON) When fields with enum display strings are encountered in JSON, treat them as blank when converting to RWF instead of returning an error (value: RsslBool). */
+	RSSL_JSON_CPC_ALLOW_ENUM_DISPLAY_STRINGS	= 9,	/*!< (Simplified JSON) When fields with enum display strings are encountered in JSON, treat them as blank when converting to RWF instead of returning an error (value: RsslBool). */
+	RSSL_JSON_CPC_PARSE_ARRAY_ELEMENTS			= 10	/*!< When converting from JSON to RWF, parse a JSON array of messages one message at a time, as rsslDecodeJsonMsg reaches each message, instead of parsing the whole array in rsslParseJsonBuffer. Parser errors in later messages are then returned by rsslDecodeJsonMsg (value: RsslBool). */
 } RsslJsonConverterPropertyCodes;
 
 /**
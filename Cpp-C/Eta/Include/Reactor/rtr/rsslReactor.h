@@ -156,6 +156,13 @@ typedef struct
 	RsslUInt32						maxOutstandingPosts;	/*!< Sets the maximum number of post acknowledgments that may be outstanding for the channel. */
 	RsslUInt32						postAckTimeout;			/*!< Time a stream will wait for acknowledgment of a post message, in milliseconds. */
 	RsslUInt32						requestTimeout;			/*!< Time a requested stream will wait for a response from the provider, in milliseconds. */
+	RsslBool						enableViewFiltering;	/*!< When a stream's aggregated view contains more fields than a request's view, removes the extra
+															 * field list or element list entries before the message is given to that request. Messages with
+															 * set-defined data are not filtered. */
+	RsslBool						enableDistinctFanoutBuffers;	/*!< By default, all requests on an item stream receive the same decoded message, whose encoded
+																	 * buffer carries the provider's stream ID; the request's stream ID is in msgBase.streamId
+																	 * and RsslStreamInfo.streamId. When set, each request instead receives its own copy of the
+																	 * encoded message, with its stream ID written into it. */
 } RsslConsumerWatchlistOptions;
 
 /**
@@ -222,6 +229,8 @@ RTR_C_INLINE void rsslClearOMMConsumerRole(RsslReactorOMMConsumerRole *pRole)
 	pRole->watchlistOptions.maxOutstandingPosts = 100000;
 	pRole->watchlistOptions.postAckTimeout = 15000;
 	pRole->watchlistOptions.requestTimeout = 15000;
+	pRole->watchlistOptions.enableViewFiltering = RSSL_FALSE;
+	pRole->watchlistOptions.enableDistinctFanoutBuffers = RSSL_FALSE;
 }
 
 /**
@@ -294,6 +303,17 @@ RTR_C_INLINE void rsslClearReactorChannelRole(RsslReactorChannelRole *pRole)
 }
 
 
+/**
+ * @brief Enumerated types indicating how an RsslReactor with several dispatch shards assigns new channels to them.
+ * @see RsslCreateReactorOptions, rsslReactorGetShard
+ */
+typedef enum
+{
+	RSSL_REACTOR_SHARD_ROUND_ROBIN		= 0,	/*!< Channels are assigned to each shard in turn. */
+	RSSL_REACTOR_SHARD_LEAST_LOADED		= 1,	/*!< Channels are assigned to the shard with the fewest channels. */
+	RSSL_REACTOR_SHARD_EXPLICIT			= 2		/*!< Channels are assigned to the shard given by RsslReactorConnectOptions.shardIndex or RsslReactorAcceptOptions.shardIndex. */
+} RsslReactorShardPolicy;
+
 /**
  * @brief Configuration options for creating an RsslReactor.
  * @see rsslCreateReactor
@@ -320,6 +340,13 @@ typedef struct {
 												 * discovery and subscribing data from RDP. */
 	RsslBuffer	tokenServiceURL_V2;				/*!< Specifies a URL of the token service to get an access token from the Refinitiv Login V2. This is used for querying RDP service
 												 * discovery and subscribing data from RDP. */
+	RsslBool	enableDirectFlush;				/*!< If set to RSSL_TRUE, every channel of this RsslReactor flushes written data directly from the thread that calls rsslReactorSubmit()
+												 * or rsslReactorDispatch(). Flushing is only handed to the Reactor worker thread when the socket cannot accept all of the data.
+												 * See also RsslReactorConnectOptions.enableDirectFlush and RsslReactorAcceptOptions.enableDirectFlush. */
+	RsslUInt32	dispatchShardCount;				/*!< Number of dispatch shards. Each shard has its own channel lists, event queue and notifier, so separate threads can dispatch
+												 * the shards at the same time; the shards share the reactor's worker thread, token sessions and warm standby state. Channels are
+												 * assigned to shards when they are connected or accepted, according to shardPolicy. Defaults to 1. See rsslReactorGetShard(). */
+	RsslReactorShardPolicy	shardPolicy;		/*!< How channels are assigned to shards when dispatchShardCount is greater than 1. Defaults to RSSL_REACTOR_SHARD_ROUND_ROBIN. */
 } RsslCreateReactorOptions;
 
 /**
@@ -341,6 +368,8 @@ RTR_C_INLINE void rsslClearCreateReactorOptions(RsslCreateReactorOptions *pReact
 	pReactorOpts->restEnableLog = RSSL_FALSE;
 	pReactorOpts->restLogOutputStream = NULL;
 	pReactorOpts->pRestLoggingCallback = NULL;
+	pReactorOpts->dispatchShardCount = 1;
+	pReactorOpts->shardPolicy = RSSL_REACTOR_SHARD_ROUND_ROBIN;
 }
 
 /**
@@ -355,6 +384,7 @@ RSSL_VA_API RsslReactor *rsslCreateReactor(RsslCreateReactorOptions *pReactorOpt
 /**
  * @brief Cleans up an RsslReactor.  Stops the ETA Reactor if necessary and sends RsslReactorChannelEvents to all active channels indicating that they are down.
  * Once this call is made, the RsslReactor is destroyed and no further calls should be made with it.  This function is not thread-safe.
+ * The shards of an RsslReactor are destroyed with it, and no thread may be dispatching any of them. A shard cannot be destroyed by itself.
  * @param pReactorOpts Configuration options for creating the RsslReactor.
  * @param pError Error structure to be populated in the event of an error.
  * @return Pointer to the newly created RsslReactor. If the pointer is NULL, an error occurred.
@@ -362,6 +392,27 @@ RSSL_VA_API RsslReactor *rsslCreateReactor(RsslCreateReactorOptions *pReactorOpt
  */
 RSSL_VA_API RsslRet rsslDestroyReactor(RsslReactor *pReactor, RsslErrorInfo *pError);
 
+/**
+ * @brief Returns one of the dispatch shards of an RsslReactor created with RsslCreateReactorOptions.dispatchShardCount greater than 1.
+ * A shard is an RsslReactor handle. Its eventFd signals only the events of the shard's channels, and rsslReactorDispatch() on the shard dispatches
+ * only those channels, calling their callbacks on the calling thread with the RsslReactor itself. Shard 0 is the RsslReactor itself.
+ * Each shard should be dispatched by one thread, and a channel should only be used from the thread that dispatches its shard.
+ * Channels added with rsslReactorConnect() or rsslReactorAccept() are assigned to a shard by RsslCreateReactorOptions.shardPolicy, except that
+ * with the round-robin and least-loaded policies a channel added from a callback stays on the shard being dispatched. A callback cannot add
+ * a channel to another shard than its own or shard 0.
+ * All shards share one worker thread, the token sessions and the warm standby groups. rsslReactorSubmitOAuthCredentialRenewal(),
+ * rsslReactorQueryServiceDiscovery() and rsslReactorIoctl() may be given any shard and apply to the whole RsslReactor. Events that belong to
+ * the reactor rather than to a channel, such as OAuth credential renewal without a channel and REST logging, are dispatched by shard 0 for all
+ * shards, so shard 0 must be dispatched whenever another shard is.
+ * rsslDestroyReactor() does not accept a shard.
+ * @param pReactor The reactor, or any of its shards.
+ * @param shardIndex Index of the shard, from 0 to RsslCreateReactorOptions.dispatchShardCount - 1.
+ * @param pError Error structure to be populated in the event of failure.
+ * @return The shard, or NULL if shardIndex is out of range.
+ * @see RsslCreateReactorOptions, RsslReactorShardPolicy
+ */
+RSSL_VA_API RsslReactor *rsslReactorGetShard(RsslReactor *pReactor, RsslUInt32 shardIndex, RsslErrorInfo *pError);
+
 /**
  * @brief Enumerated types indicating the transport query parameter.
  * @see RsslReactorServiceDiscoveryOptions
@@ -475,7 +526,7 @@ typedef enum
 {
 	RSSL_RC_ST_NONE = 0x0000,	/*!< None */
 	RSSL_RC_ST_READ = 0x0001,	/*!< Indicates an interest for bytes read and uncompressed bytes read statistics  */
-	RSSL_RC_ST_WRITE = 0x0002,	/*!< Indicates an interest for bytes written and uncompressed bytes written statistics */
+	RSSL_RC_ST_WRITE = 0x0002,	/*!< Indicates an interest for bytes written, uncompressed bytes written, and inline and deferred flush statistics */
 	RSSL_RC_ST_PING = 0x0004,	/*!< Indicates an interest for ping received and ping sent statistics */
 } RsslReactorChannelStatisticFlags;
 
@@ -578,6 +629,11 @@ typedef struct
 
 	RsslUInt32				statisticFlags;			/* Specifies interests for the channel statistics defined in RsslReactorChannelStatisticFlags */
 
+	RsslBool				enableDirectFlush;		/*!< If set to RSSL_TRUE, this channel flushes written data directly from the thread that calls rsslReactorSubmit() or rsslReactorDispatch(),
+													 * instead of signaling the Reactor worker thread. The worker thread is only used when the socket cannot accept all of the data. */
+
+	RsslUInt32				shardIndex;				/*!< The dispatch shard of the channel, when the RsslReactor was created with the RSSL_REACTOR_SHARD_EXPLICIT shard policy. */
+
 } RsslReactorConnectOptions;
 
 /**
@@ -597,6 +653,8 @@ RTR_C_INLINE void rsslClearReactorConnectOptions(RsslReactorConnectOptions *pOpt
     pOpts->warmStandbyGroupCount = 0;
 	pOpts->connectionDebugFlags = 0;
 	pOpts->statisticFlags = RSSL_RC_ST_NONE;
+	pOpts->enableDirectFlush = RSSL_FALSE;
+	pOpts->shardIndex = 0;
 }
 
 /**
@@ -631,6 +689,11 @@ typedef struct
 
 	RsslReactorWSocketAcceptOptions   wsocketAcceptOptions; /*!< This is additional accept options for WebSocket connection. */
 
+	RsslBool			enableDirectFlush;		/*!< If set to RSSL_TRUE, this channel flushes written data directly from the thread that calls rsslReactorSubmit() or rsslReactorDispatch(),
+												 * instead of signaling the Reactor worker thread. The worker thread is only used when the socket cannot accept all of the data. */
+
+	RsslUInt32			shardIndex;				/*!< The dispatch shard of the channel, when the RsslReactor was created with the RSSL_REACTOR_SHARD_EXPLICIT shard policy. */
+
 } RsslReactorAcceptOptions;
 
 /**
@@ -643,6 +706,8 @@ RTR_C_INLINE void rsslClearReactorAcceptOptions(RsslReactorAcceptOptions *pOpts)
 	pOpts->initializationTimeout = 60;
 	pOpts->connectionDebugFlags = 0;
 	pOpts->wsocketAcceptOptions.sendPingMessage = RSSL_TRUE;
+	pOpts->enableDirectFlush = RSSL_FALSE;
+	pOpts->shardIndex = 0;
 }
 
 /**
@@ -671,7 +736,7 @@ RSSL_VA_API RsslRet rsslReactorCloseChannel(RsslReactor *pReactor, RsslReactorCh
  */
 typedef struct
 {
-	RsslReactorChannel	*pReactorChannel;	/*!< If specified, only events and messages for this channel with be processed. If not specified, messages and events for all channels will be processed. */
+	RsslReactorChannel	*pReactorChannel;	/*!< If specified, only events and messages for this channel with be processed. If not specified, messages and events for all channels will be processed (for all channels of the shard, when the RsslReactor has several dispatch shards). */
 	RsslUInt32			maxMessages;		/*!< The maximum number of events or messages to process for this call to rsslReactorDispatch(). */
 } RsslReactorDispatchOptions;
 
@@ -973,6 +1038,10 @@ typedef struct
 	RsslUInt							pingSent;					/*!< Returns the aggregated number of ping sent */
 	RsslUInt							bytesWritten;				/*!< Returns the aggregated number of bytes written */
 	RsslUInt							uncompressedBytesWritten;	/*!< Returns the aggregated number of uncompressed bytes written */
+	RsslUInt							inlineFlushes;				/*!< Returns the aggregated number of flushes completed directly by the calling thread. See enableDirectFlush. */
+	RsslUInt							deferredFlushes;			/*!< Returns the aggregated number of flushes handed to the Reactor worker thread */
+	RsslUInt							viewFilteredMsgs;			/*!< Returns the aggregated number of messages filtered to a request's view. See enableViewFiltering. */
+	RsslUInt							viewFilteredBytesSaved;		/*!< Returns the aggregated number of payload bytes removed by view filtering */
 } RsslReactorChannelStatistic;
 
 /**
@@ -65,6 +65,7 @@ typedef struct
 {
 	const RsslBuffer	*pServiceName;	/*!< Name of service associated with the stream, if any. */
 	void				*pUserSpec;		/*!< User-specified pointer given when the stream was opened. */
+	RsslInt32			streamId;		/*!< Stream ID the stream was opened with. See RsslConsumerWatchlistOptions.enableDistinctFanoutBuffers. */
 } RsslStreamInfo;
 
 /**
@@ -60,7 +60,8 @@ typedef enum {
 typedef enum {
 	RSSL_COMP_NONE	= 0x00,  /*!< (0) No compression will be negotiated. */
 	RSSL_COMP_ZLIB	= 0x01,	 /*!< (1) RSSL will attempt to use Zlib compression. */
-	RSSL_COMP_LZ4	= 0x02	 /*!< (2) RSSL will attempt to use LZ4 compression */
+	RSSL_COMP_LZ4	= 0x02,	 /*!< (2) RSSL will attempt to use LZ4 compression */
+	RSSL_COMP_ZSTD	= 0x04	 /*!< (4) RSSL will attempt to use Zstandard compression, with the dictionary set in RsslInitializeExOpts::compressionDictionary if one is set. */
 } RsslCompTypes;
 
 /**
@@ -98,7 +99,8 @@ typedef enum {
 	RSSL_CONN_TYPE_RELIABLE_MCAST	= 4,   /*!< (4) Channel is a reliable multicast based connection. This can be on a unified/mesh network where send and receive networks are the same or a segmented network where send and receive networks are different */
 	RSSL_CONN_TYPE_EXT_LINE_SOCKET  = 5,   /*!< (5) Channel is using an extended line socket transport */	
 	RSSL_CONN_TYPE_SEQ_MCAST		= 6,   /*!< (6) Channel is an unreliable, sequenced multicast connection for reading from an Refinitiv Real-Time Direct Feed system. This is a client-only, read-only transport. This transport is supported on Linux only. */
-	RSSL_CONN_TYPE_WEBSOCKET		= 7    /*!< (7) Channel is a WebSocket connection type. */
+	RSSL_CONN_TYPE_WEBSOCKET		= 7,   /*!< (7) Channel is a WebSocket connection type. */
+	RSSL_CONN_TYPE_BIDIR_SHMEM		= 8    /*!< (8) Channel is a two-way shared memory connection between processes on the same machine. The service name (prefixed with the interface name, if any) identifies the server. This transport is supported on Linux only. */
 } RsslConnectionTypes;
 
 /**
@@ -226,12 +228,13 @@ typedef struct
 	void*			 initConfig;			/*!< private config init */			
 	size_t			 initConfigSize;		/*!< private size of config init */	
 	RsslBool		 initCurlDebug;			/*!< curl debug (verbose) mode enable */
+	RsslBuffer		 compressionDictionary;	/*!< Optional pre-shared dictionary for RSSL_COMP_ZSTD compression, such as one trained from captured RWF payloads. Both sides of a connection must load the same dictionary. The contents are copied. */
 }RsslInitializeExOpts;
 
 /**
  * @brief Static initializer for RsslInitializeExOpts
  */
-#define RSSL_INIT_INITIALIZE_EX_OPTS { RSSL_LOCK_NONE, RSSL_INIT_SSL_LIB_JIT_OPTS, NULL, 0, RSSL_FALSE }
+#define RSSL_INIT_INITIALIZE_EX_OPTS { RSSL_LOCK_NONE, RSSL_INIT_SSL_LIB_JIT_OPTS, NULL, 0, RSSL_FALSE, { 0, NULL } }
 
 /**
  * @brief Initializes the RSSL API and all internal members
@@ -298,6 +301,8 @@ typedef struct {
 	RsslUInt64		retransReqRcvd;		/*!< @brief This is the number of retransmission requests received by this channel, populated only for reliable multicast connection types.  This value includes retransmit requests for both multicast and unicast data.  Positive values indicate a possible network problem, more severe as value is larger */
 	RsslUInt64		retransPktsSent;	/*!< @brief This is the number of retransmitted packets sent by this channel, populated only for reliable multicast connection types.  This value includes retransmit packets for both multicast and unicast data.  Positive values indicate a possible network problem, more severe as value is larger */
 	RsslUInt64		retransPktsRcvd;	/*!< @brief This is the number of retransmitted packets received by this channel, populated only for reliable multicast connection types.  This value includes retransmit packets for both multicast and unicast data.  Positive values indicate a possible network problem, more severe as value is larger */
+	RsslUInt64		mcastSendCalls;		/*!< @brief This is the number of system calls used to send the multicast packets, populated only for sequenced multicast connection types.  mcastSent divided by this value is the average number of packets sent per call */
+	RsslUInt64		mcastRcvdCalls;		/*!< @brief This is the number of system calls that received multicast packets, populated only for sequenced multicast connection types.  mcastRcvd divided by this value is the average number of packets received per call */
 } RsslMCastStats;
 
 
@@ -447,6 +452,16 @@ RSSL_API RsslInt32 rsslBufferUsage(RsslChannel *chnl,
  *	@{
  */
 
+/**
+ * @brief I/O engine used to read from and write to the socket (::RSSL_CONN_TYPE_SOCKET only).
+ * @see RsslTcpOpts
+ */
+typedef enum {
+	RSSL_IO_ENGINE_DEFAULT		= 0,	/*!< @brief Regular recv/send system calls. */
+	RSSL_IO_ENGINE_URING		= 1,	/*!< @brief Linux io_uring. Each thread calling rsslRead, rsslWrite or rsslFlush submits through its own ring. */
+	RSSL_IO_ENGINE_URING_SQPOLL	= 2		/*!< @brief Linux io_uring with a kernel thread polling the submission queue, so most reads and writes do not enter the kernel. Uses an extra CPU per calling thread. */
+} RsslIOEngineTypes;
+
 /**
  * @brief Options used for configuring TCP specific transport options (::RSSL_CONN_TYPE_SOCKET, ::RSSL_CONN_TYPE_ENCRYPTED, ::RSSL_CONN_TYPE_HTTP).
  * @see rsslConnect
@@ -454,9 +469,10 @@ RSSL_API RsslInt32 rsslBufferUsage(RsslChannel *chnl,
  */
 typedef struct {
 	RsslBool			tcp_nodelay;			/*!< @brief Only used with connectionType of ::RSSL_CONN_TYPE_SOCKET.  If RSSL_TRUE, disables Nagle's Algorithm. */
+	RsslUInt8			ioEngine;				/*!< @brief Only used with connectionType of ::RSSL_CONN_TYPE_SOCKET. Populated by ::RsslIOEngineTypes. If io_uring is not available, the default engine is used. */
 } RsslTcpOpts;
 
-#define RSSL_INIT_TCP_OPTS { RSSL_FALSE }
+#define RSSL_INIT_TCP_OPTS { RSSL_FALSE, RSSL_IO_ENGINE_DEFAULT }
 
 typedef enum {
 	RSSL_MCAST_NO_FLAGS				= 0x00, /*!< @brief None. */
@@ -495,15 +511,16 @@ typedef struct {
 #define RSSL_INIT_MCAST_OPTS { RSSL_MCAST_NO_FLAGS, RSSL_FALSE, 5, 7, 3, 1, 4, 3, 3, 3, 65535, 128, 190000, 180000, NULL, NULL, NULL, 0, 0, NULL, 0 }
 
 /**
- * @brief Options used for configuring shared memory specific transport options (::RSSL_CONN_TYPE_UNIDIR_SHMEM).
+ * @brief Options used for configuring shared memory specific transport options (::RSSL_CONN_TYPE_UNIDIR_SHMEM and ::RSSL_CONN_TYPE_BIDIR_SHMEM).
  * @see rsslConnect
  * @see RsslConnectOptions
  */
 typedef struct {
 	RsslUInt		maxReaderLag;			/*!<  @brief Maximum number of messages that the client can have waiting to read. If the client "lags" the server by more than this amount, ETA will disconnect the client */
+	RsslUInt32		readerSpinCount;		/*!<  @brief Used by ::RSSL_CONN_TYPE_BIDIR_SHMEM. Number of consecutive empty reads for which rsslRead returns a positive value, asking to be called again, before it waits for the writer to signal the channel's socketId. Busy-polling readers avoid a system call on the writer for every message. 0 waits as soon as there is nothing to read. */
 } RsslShmemOpts;
 
-#define RSSL_INIT_SHMEM_OPTS { 0 }
+#define RSSL_INIT_SHMEM_OPTS { 0, 0 }
 
 /**
  * @brief Options used for configuring sequenced multicast specific transport options (::RSSL_CONN_TYPE_SEQ_MCAST).
@@ -513,9 +530,12 @@ typedef struct {
 typedef struct {
 	RsslUInt32		maxMsgSize;			/*!<  @brief Maximum size of messages that the SEQ_MCAST transport will read. */
 	RsslUInt16		instanceId;			/*!<  @brief This is used, when combined with the origin IP address and port, to uniquely identify a sequenced multicast channel. */
+	RsslUInt32		readBatchSize;		/*!<  @brief Maximum number of packets received with a single system call. Received packets are returned one by one by rsslRead.  Only used on Linux; 0 or 1 receives one packet per call. */
+	RsslUInt32		writeBatchSize;		/*!<  @brief Maximum number of packets that rsslWrite queues before sending them with a single system call.  While packets are queued, rsslWrite returns a positive value and rsslFlush sends them.  0 or 1 sends every packet as it is written. */
+	RsslUInt32		writeBatchTimeout;	/*!<  @brief When writeBatchSize is greater than 1, rsslWrite sends the queued packets if the oldest one has been queued for at least this many microseconds.  0 disables the time limit. */
 } RsslSeqMCastOpts;
 
-#define RSSL_INIT_SEQ_MCAST_OPTS { 3000, 0 }
+#define RSSL_INIT_SEQ_MCAST_OPTS { 3000, 0, 32, 1, 0 }
 typedef struct {
 	char* proxyHostName;				/*!<  @brief Proxy host name. */
 	char* proxyPort;					/*!<  @brief Proxy port. */
@@ -700,7 +720,7 @@ typedef struct {
 	void				*userSpecPtr;			/*!< @brief A user specified pointer, returned as userSpecPtr of the RsslChannel. */
 	RsslTcpOpts			tcpOpts;				/*!< @brief TCP transport specific options (used by ::RSSL_CONN_TYPE_SOCKET, ::RSSL_CONN_TYPE_WEBSOCKET, ::RSSL_CONN_TYPE_ENCRYPTED, ::RSSL_CONN_TYPE_HTTP). */
 	RsslMCastOpts		multicastOpts;			/*!< @brief Multicast transport specific options (used by ::RSSL_CONN_TYPE_RELIABLE_MCAST). */
-	RsslShmemOpts		shmemOpts;				/*!< @brief shmem transport specific options (used by ::RSSL_CONN_TYPE_UNIDIR_SHMEM). */
+	RsslShmemOpts		shmemOpts;				/*!< @brief shmem transport specific options (used by ::RSSL_CONN_TYPE_UNIDIR_SHMEM and ::RSSL_CONN_TYPE_BIDIR_SHMEM). */
 	RsslSeqMCastOpts	seqMulticastOpts;		/*!< @brief Sequenced Multicast transport specific options (used by ::RSSL_CONN_TYPE_SEQ_MCAST). */
 	RsslProxyOpts		proxyOpts;
 	char*				componentVersion;		/*!< @brief User defined component version information*/
@@ -747,6 +767,7 @@ RTR_C_INLINE void rsslClearConnectOpts(RsslConnectOptions *opts)
 	opts->protocolType = 0;
 	opts->userSpecPtr = 0;
 	opts->tcpOpts.tcp_nodelay = RSSL_FALSE;
+	opts->tcpOpts.ioEngine = RSSL_IO_ENGINE_DEFAULT;
 	opts->multicastOpts.flags = RSSL_MCAST_NO_FLAGS;
 	opts->multicastOpts.disconnectOnGaps = RSSL_FALSE;
 	opts->multicastOpts.packetTTL = 5;
@@ -768,10 +789,14 @@ RTR_C_INLINE void rsslClearConnectOpts(RsslConnectOptions *opts)
 	opts->multicastOpts.tcpControlPort = NULL;
 	opts->multicastOpts.portRoamRange = 0;
 	opts->shmemOpts.maxReaderLag = 0;
+	opts->shmemOpts.readerSpinCount = 0;
 	opts->sysSendBufSize = 0;
 	opts->sysRecvBufSize = 0;
 	opts->seqMulticastOpts.maxMsgSize = 3000;
 	opts->seqMulticastOpts.instanceId = 0;
+	opts->seqMulticastOpts.readBatchSize = 32;
+	opts->seqMulticastOpts.writeBatchSize = 1;
+	opts->seqMulticastOpts.writeBatchTimeout = 0;
 	opts->proxyOpts.proxyHostName = 0;
 	opts->proxyOpts.proxyPort = 0;
 	opts->componentVersion = NULL;
@@ -865,6 +890,8 @@ typedef struct {
 typedef struct {
 	RsslUInt32 	currentBufferUsage;  /*!< @brief This is the current buffer usage for the server. */ 
 	RsslUInt32 	peakBufferUsage;	 /*!< @brief This is the peak buffer usage for the server. */ 
+	RsslUInt64	threadCacheHits;	 /*!< @brief Number of shared pool buffers taken from per-thread caches. Zero unless RsslBindOptions::sharedPoolThreadCacheSize is set. */
+	RsslUInt64	threadCacheMisses;	 /*!< @brief Number of shared pool buffers taken from the shared pool under its lock while per-thread caches are enabled. */
 } RsslServerInfo;
 
 /**
@@ -951,7 +978,7 @@ typedef struct {
 	char			*serviceName;			/*!< @brief Local port number or service name to bind to. */
 	char			*interfaceName;			/*!< @brief Network interface card to bind to.  If NULL, will use default NIC */
 	RsslUInt32		compressionType;		/*!< @brief Bitmask of RsslCompTypes compression types supported by the server */
-	RsslUInt32		compressionLevel;		/*!< @brief Level of compression to use, 1: More speed - 9: More compression. */
+	RsslUInt32		compressionLevel;		/*!< @brief Level of compression to use, 1: More speed - 9: More compression. Zstandard accepts levels up to 22; 0 selects its default level. */
 	RsslBool		forceCompression;		/*!< @brief Lets the server force the client to use compression */
 	RsslBool		serverBlocking;			/*!< @brief If RSSL_TRUE, the server will be allowed to block. */
 	RsslBool		channelsBlocking;		/*!< @brief If RSSL_TRUE, the channels will be allowed to block. */
@@ -959,7 +986,7 @@ typedef struct {
 	RsslBool		tcp_nodelay;			/*!< @deprecated DEPRECATED: Only used with connectionType of SOCKET.  If RSSL_TRUE, disables Nagle's Algorithm. Users should migrate to the RsslBindOptions::tcpOpts::tcp_nodelay configuration for the same behavior with current and future connection types */
 	RsslBool		serverToClientPings;	/*!< @brief If RSSL_TRUE, pings will be sent from server side to client side */
 	RsslBool		clientToServerPings;	/*!< @brief If RSSL_TRUE, pings will be sent from client side to server side */
-	RsslConnectionTypes	connectionType;		/*!< @brief If RSSL_CONN_TYPE_UNIDIR_SHMEM this will use server to client shared memory.  Setting to RSSL_CONN_TYPE_SOCKET or RSSL_CONN_TYPE_HTTP will allow for accepting both socket or HTTP connection types.  RSSL_CONN_TYPE_ENCRYPTED is currently not supported for servers  */
+	RsslConnectionTypes	connectionType;		/*!< @brief If RSSL_CONN_TYPE_UNIDIR_SHMEM this will use server to client shared memory; RSSL_CONN_TYPE_BIDIR_SHMEM accepts two-way shared memory connections.  Setting to RSSL_CONN_TYPE_SOCKET or RSSL_CONN_TYPE_HTTP will allow for accepting both socket or HTTP connection types.  RSSL_CONN_TYPE_ENCRYPTED is currently not supported for servers  */
 	RsslUInt32		pingTimeout;			/*!< @brief Desired amount of time to use as a timeout for a connected channel. */
 	RsslUInt32		minPingTimeout;			/*!< @brief Least amount of time to use as a timeout for a connected channel. */
 	RsslUInt32		maxFragmentSize;		/*!< @brief Sets the maximum size fragment to be sent without any fragmentation or assembly of messages. */
@@ -978,6 +1005,8 @@ typedef struct {
 	char*			componentVersion;		/*!< @brief User defined component version information */
 	RsslWSocketOpts	wsOpts;					/*!< @brief WebSocket transport options for RSSL_CONN_TYPE_WEBSOCKET */
 	RsslBindEncryptionOpts encryptionOpts;	/*!< @brief Encryption options. */
+	RsslShmemOpts	shmemOpts;				/*!< @brief Shared memory options for accepted channels (used by RSSL_CONN_TYPE_BIDIR_SHMEM; maxReaderLag is not used). */
+	RsslUInt32		sharedPoolThreadCacheSize;	/*!< @brief If sharedPoolLock is enabled, the number of shared pool buffers each thread may keep for itself. Threads that get and release buffers then take the shared pool lock only when their cache runs empty or full. 0 disables the caches. */
 } RsslBindOptions;
 
 
@@ -985,7 +1014,7 @@ typedef struct {
  * @brief RSSL Bind Options initialization
  * @see RsslBindOptions
  */
-#define RSSL_INIT_BIND_OPTS { 0, 0, RSSL_COMP_NONE, 0, RSSL_FALSE, RSSL_FALSE, RSSL_FALSE, RSSL_FALSE, RSSL_FALSE, RSSL_TRUE, RSSL_TRUE, RSSL_CONN_TYPE_SOCKET, 60, 20, 6144, 50, 50, 10, 0, RSSL_FALSE, 0, 0, 0, 0, 0, 0, RSSL_INIT_TCP_OPTS, 0, RSSL_INIT_WEBSOCKET_OPTS, RSSL_INIT_BIND_ENCRYPTION_OPTS }
+#define RSSL_INIT_BIND_OPTS { 0, 0, RSSL_COMP_NONE, 0, RSSL_FALSE, RSSL_FALSE, RSSL_FALSE, RSSL_FALSE, RSSL_FALSE, RSSL_TRUE, RSSL_TRUE, RSSL_CONN_TYPE_SOCKET, 60, 20, 6144, 50, 50, 10, 0, RSSL_FALSE, 0, 0, 0, 0, 0, 0, RSSL_INIT_TCP_OPTS, 0, RSSL_INIT_WEBSOCKET_OPTS, RSSL_INIT_BIND_ENCRYPTION_OPTS, RSSL_INIT_SHMEM_OPTS, 0 }
 
 /**
  * @brief Clears RSSL Bind Options 
@@ -1022,6 +1051,7 @@ RTR_C_INLINE void rsslClearBindOpts(RsslBindOptions *opts)
 	opts->protocolType = 0;
 	opts->userSpecPtr = 0;
 	opts->tcpOpts.tcp_nodelay = RSSL_FALSE;
+	opts->tcpOpts.ioEngine = RSSL_IO_ENGINE_DEFAULT;
 	opts->sysSendBufSize = 0;
 	opts->sysRecvBufSize = 0;
 	opts->componentVersion = NULL;
@@ -1035,6 +1065,9 @@ RTR_C_INLINE void rsslClearBindOpts(RsslBindOptions *opts)
 	opts->encryptionOpts.encryptionProtocolFlags = RSSL_ENC_TLSV1_2;
 	opts->encryptionOpts.serverCert = NULL;
 	opts->encryptionOpts.serverPrivateKey = NULL;
+	opts->shmemOpts.maxReaderLag = 0;
+	opts->shmemOpts.readerSpinCount = 0;
+	opts->sharedPoolThreadCacheSize = 0;
 }
 
 /**
@@ -1660,7 +1693,8 @@ typedef enum {
 	RSSL_TRACE_TO_FILE_ENABLE		= 0x00000010, /*< (0x00000010) Enables tracing to a file*/ 
 	RSSL_TRACE_TO_MULTIPLE_FILES    = 0x00000020, /*< (0x00000020) If set, starts writing to a new file if traceMsgMaxFileSize is reached. If disabled, file writing stops when traceMsgMaxFileSize is reached*/
 	RSSL_TRACE_TO_STDOUT			= 0x00000040, /*< (0x00000040) Writes the xml trace to stdout. If a non-null value is also provided for traceMsgFileName, writing will be done to stdout and the specified file*/
-	RSSL_TRACE_DUMP					= 0x00000080  /*< (0x00000080) Trace dump to enable the rsslDumpBuffer() method to dump RWF or JSON messages. */
+	RSSL_TRACE_DUMP					= 0x00000080, /*< (0x00000080) Trace dump to enable the rsslDumpBuffer() method to dump RWF or JSON messages. */
+	RSSL_TRACE_BINARY				= 0x00000100  /*< (0x00000100) Writes a binary capture of the messages to the file instead of XML, through a background thread. The capture can be read with rsslOpenCaptureFile(). Writing to stdout is not affected. */
 } RsslTraceCodes;
 
 /**
@@ -1689,6 +1723,50 @@ RTR_C_INLINE void rsslClearTraceOptions(RsslTraceOptions *traceOptions)
 	traceOptions->traceFlags = 0;
 }
 
+/**
+ * @brief Kinds of records in a binary capture
+ * @see RsslCaptureRecord
+ */
+typedef enum {
+	RSSL_CAPTURE_READ		= 1, /*!< (1) Message read from the channel */
+	RSSL_CAPTURE_WRITE		= 2, /*!< (2) Message written to the channel */
+	RSSL_CAPTURE_PACK		= 3, /*!< (3) Message packed into a buffer with rsslPackBuffer() */
+	RSSL_CAPTURE_DUMP		= 4, /*!< (4) Message passed to rsslDumpBuffer() */
+	RSSL_CAPTURE_DROPPED	= 5  /*!< (5) Messages were dropped because the file could not be written fast enough. The data holds their number as a 4-byte big-endian integer. */
+} RsslCaptureDirections;
+
+/** @brief The first bytes of a binary capture file */
+#define RSSL_CAPTURE_FILE_MAGIC "RSSLCAP1"
+
+/** @brief Size of the header at the start of a binary capture file */
+#define RSSL_CAPTURE_FILE_HEADER_SIZE 16
+
+/** @brief Size of the header before each message in a binary capture file */
+#define RSSL_CAPTURE_RECORD_HEADER_SIZE 24
+
+/**
+ * @brief A record of a binary capture file, written when RSSL_TRACE_BINARY is set
+ *
+ * The file starts with RSSL_CAPTURE_FILE_MAGIC, a 2-byte format version (1), the 2-byte size of
+ * each record header and 4 reserved bytes. Each record follows, made of a header and the message:
+ * a 4-byte length of the message, an 8-byte timestamp, an 8-byte channel ID, and a byte each
+ * for the direction, protocol type, and major and minor version. All integers are big-endian.
+ * @see rsslOpenCaptureFile
+ * @see rsslReadCaptureRecord
+ */
+typedef struct {
+	RsslUInt64	timestamp;		/*!< @brief Time the message was traced, in nanoseconds since January 1st, 1970 (UTC) */
+	RsslUInt64	channelId;		/*!< @brief The channel's socketId, as shown in XML traces */
+	RsslUInt8	direction;		/*!< @brief One of RsslCaptureDirections */
+	RsslUInt8	protocolType;	/*!< @brief Protocol type of the message, e.g. RSSL_RWF_PROTOCOL_TYPE */
+	RsslUInt8	majorVersion;	/*!< @brief Major version of the channel's protocol */
+	RsslUInt8	minorVersion;	/*!< @brief Minor version of the channel's protocol */
+	RsslBuffer	data;			/*!< @brief The message, as it was read or written */
+} RsslCaptureRecord;
+
+/** @brief A binary capture file opened for reading */
+typedef struct RsslCaptureFile RsslCaptureFile;
+
 /**
  * @brief Calculates necessary buffer size to encrypt content into
  *
@@ -1856,6 +1934,36 @@ RSSL_API RsslRet rsslSetDebugFunctions(
 */
 RSSL_API RsslRet rsslDumpBuffer(RsslChannel *channel, RsslUInt32 protocolType, RsslBuffer* buffer, RsslError *error);
 
+/**
+* @brief Opens a binary capture file written with the RSSL_TRACE_BINARY trace option.
+*
+* @param fileName Name of the file.
+* @param error RsslError, to be populated in event of an error
+* @return The open file, or NULL if it could not be opened or is not a capture file.
+* @see RsslCaptureRecord
+*/
+RSSL_API RsslCaptureFile* rsslOpenCaptureFile(const char *fileName, RsslError *error);
+
+/**
+* @brief Reads the next record of a binary capture file.
+*
+* The record and its data remain valid until the next call. rsslReadCaptureRecord() does not need
+* rsslInitialize() to be called first.
+*
+* @param captureFile File opened with rsslOpenCaptureFile().
+* @param readRet Set to RSSL_RET_SUCCESS, or to RSSL_RET_FAILURE if the file is truncated or corrupt.
+* @param error RsslError, to be populated in event of an error
+* @return The record, or NULL at the end of the file or on failure.
+*/
+RSSL_API RsslCaptureRecord* rsslReadCaptureRecord(RsslCaptureFile *captureFile, RsslRet *readRet, RsslError *error);
+
+/**
+* @brief Closes a binary capture file opened with rsslOpenCaptureFile().
+*
+* @param captureFile File to close.
+*/
+RSSL_API void rsslCloseCaptureFile(RsslCaptureFile *captureFile);
+
 /**
  *	@}
  */ 
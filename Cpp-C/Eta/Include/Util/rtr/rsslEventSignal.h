@@ -6,20 +6,28 @@
 */
 
 /* Contains functionality for creating a file descriptor to use for notification signals.
- * These functions are not thread-safe -- the owner of the object is expected to
+ * rsslSetEventSignal() and rsslResetEventSignal() are not thread-safe -- the owner of the object is expected to
  * have locked around these calls to correctly check whatever condition 
- * necessitates setting or resetting the descriptor. */
+ * necessitates setting or resetting the descriptor.
+ * rsslNotifyEventSignal() may be called by any thread, and rsslDrainEventSignal() by the one thread
+ * that reads the descriptor; the owner decides when a notification is needed.
+ * On Linux the descriptor is an eventfd, so both ends are the same descriptor. */
 
 #ifndef RSSL_EVENT_FD_H
 #define RSSL_EVENT_FD_H
 
 #include "rtr/os.h"
+#include "rtr/rsslTypes.h"
 
 #ifdef _WIN32
 #else
 #include  <unistd.h>
 #include  <fcntl.h>
 #include  <sys/types.h>
+#include  <errno.h>
+#endif
+#ifdef Linux
+#include  <sys/eventfd.h>
 #endif
 #ifdef __cplusplus
 extern "C" {
@@ -43,6 +51,9 @@ RTR_C_INLINE int rsslGetEventSignalFD(RsslEventSignal* pSignal) {
 
 RTR_C_INLINE void rsslCleanupEventSignal(RsslEventSignal* pSignal) 
 {
+	if(pSignal->_fds[1] == pSignal->_fds[0])
+		pSignal->_fds[1] = -1;
+
 	if(pSignal->_fds[0] != -1 ) {
 #ifdef _WIN32
 		closesocket( pSignal->_fds[0] );
@@ -165,6 +176,14 @@ RTR_C_INLINE int rsslInitEventSignal(RsslEventSignal* pSignal)
 		rsslCleanupEventSignal(pSignal);
 		return 0;
 	}
+#elif defined(Linux)
+	int eventFd;
+	eventFd = eventfd( 0, EFD_NONBLOCK | EFD_CLOEXEC );
+	if(eventFd == -1) {
+		// Cannot create the event descriptor
+		return 0;
+	}
+	pSignal->_fds[0] = pSignal->_fds[1] = eventFd;
 #else
 	int pipeRetVal;
 	pipeRetVal = pipe( pSignal->_fds );
@@ -172,18 +191,21 @@ RTR_C_INLINE int rsslInitEventSignal(RsslEventSignal* pSignal)
 		// Cannot create the communication pipe
 		return 0;
 	}
+	fcntl( pSignal->_fds[0], F_SETFL, fcntl( pSignal->_fds[0], F_GETFL ) | O_NONBLOCK );
+	fcntl( pSignal->_fds[1], F_SETFL, fcntl( pSignal->_fds[1], F_GETFL ) | O_NONBLOCK );
 #endif
 
 	pSignal->_byteWritten = 0;
 	return 1;
 }
 
-RTR_C_INLINE int rsslSetEventSignal(RsslEventSignal* pSignal) 
+/* Writes one notification. Thread-safe. Returns 0, or a negative value on failure. */
+RTR_C_INLINE int rsslNotifyEventSignal(RsslEventSignal* pSignal) 
 {
 	int retVal;
-
-	if (pSignal->_byteWritten)
-		return 0;
+#ifdef Linux
+	const RsslUInt64 one = 1;
+#endif
 
 	do
 	{
@@ -191,6 +213,10 @@ RTR_C_INLINE int rsslSetEventSignal(RsslEventSignal* pSignal)
 		retVal = send( pSignal->_fds[1], "b", 1, 0 );
 		if (retVal < 0 && WSAGetLastError() != WSAEWOULDBLOCK && WSAGetLastError() != WSAEINTR)
 			return retVal;
+#elif defined(Linux)
+		retVal = (int)write( pSignal->_fds[1], &one, sizeof(one) );
+		if (retVal < 0 && errno != EAGAIN && errno != EINTR)
+			return retVal;
 #else
 		retVal = write( pSignal->_fds[1], "b", 1 );
 		if (retVal < 0 && errno != EAGAIN && errno != EINTR)
@@ -199,6 +225,70 @@ RTR_C_INLINE int rsslSetEventSignal(RsslEventSignal* pSignal)
 	}
 	while (retVal <= 0);
 
+	return 0;
+}
+
+/* Reads every notification written so far, without waiting for more.
+ * Returns the number of notifications read, or a negative value on failure. */
+RTR_C_INLINE int rsslDrainEventSignal(RsslEventSignal* pSignal)
+{
+	int count = 0;
+#ifdef Linux
+	RsslUInt64 value;
+
+	while (read( pSignal->_fds[0], &value, sizeof(value) ) < 0)
+	{
+		if (errno == EAGAIN)
+			return 0;
+		if (errno != EINTR)
+			return -1;
+	}
+	count = (int)value;
+#else
+	int retVal;
+	char dummyBuffer[64];
+
+	while (RSSL_TRUE)
+	{
+#ifdef WIN32
+		retVal = recv( pSignal->_fds[0], dummyBuffer, sizeof(dummyBuffer), 0 );
+		if (retVal < 0)
+		{
+			if (WSAGetLastError() == WSAEWOULDBLOCK)
+				break;
+			if (WSAGetLastError() != WSAEINTR)
+				return retVal;
+		}
+#else
+		retVal = read( pSignal->_fds[0], dummyBuffer, sizeof(dummyBuffer) );
+		if (retVal < 0)
+		{
+			if (errno == EAGAIN)
+				break;
+			if (errno != EINTR)
+				return retVal;
+		}
+#endif
+		else if (retVal == 0)
+			break;
+		else
+			count += retVal;
+	}
+#endif
+
+	return count;
+}
+
+RTR_C_INLINE int rsslSetEventSignal(RsslEventSignal* pSignal) 
+{
+	int retVal;
+
+	if (pSignal->_byteWritten)
+		return 0;
+
+	if ((retVal = rsslNotifyEventSignal(pSignal)) < 0)
+		return retVal;
+
 	pSignal->_byteWritten = 1;
 
 	return 0;
@@ -208,7 +298,11 @@ RTR_C_INLINE int rsslSetEventSignal(RsslEventSignal* pSignal)
 RTR_C_INLINE int rsslResetEventSignal(RsslEventSignal* pSignal)
 {
 	int retVal;
+#ifdef Linux
+	RsslUInt64 value;
+#else
 	char dummyBuffer[1];
+#endif
 
 	if (!pSignal->_byteWritten)
 		return 0;
@@ -219,6 +313,10 @@ RTR_C_INLINE int rsslResetEventSignal(RsslEventSignal* pSignal)
 		retVal = recv( pSignal->_fds[0], dummyBuffer, 1, 0 );
 		if (retVal < 0 && WSAGetLastError() != WSAEWOULDBLOCK && WSAGetLastError() != WSAEINTR)
 			return retVal;
+#elif defined(Linux)
+		retVal = (int)read( pSignal->_fds[0], &value, sizeof(value) );
+		if (retVal < 0 && errno != EAGAIN && errno != EINTR)
+			return retVal;
 #else
 		retVal = read( pSignal->_fds[0], dummyBuffer, 1 );
 		if (retVal < 0 && errno != EAGAIN && errno != EINTR)
@@ -26,6 +26,31 @@ RSSL_API RsslUInt32 rsslPolyHash(const char* buf, const RsslUInt32 length);
  */
 RSSL_API RsslUInt32 rsslHashingEntityId(const char *buf, const RsslUInt32 length, const RsslUInt32 numberOfHashingEntities);
 
+/* Kernels used by rsslFastHash(). */
+typedef enum {
+	RSSL_HASH_KERNEL_AUTO = 0,		/* Fastest kernel supported by the CPU */
+	RSSL_HASH_KERNEL_PORTABLE = 1,	/* 64-bit multiply and rotate mixer, 8 bytes at a time */
+	RSSL_HASH_KERNEL_CRC32C = 2,	/* SSE4.2 crc32 instruction, 8 bytes at a time (x86-64 only, checked at runtime) */
+	RSSL_HASH_KERNEL_MAX = 3
+} RsslHashKernel;
+
+/* Calculates a hash value for a buffer/len, reading 8 bytes at a time.
+ * The seed allows several fields to be hashed into one value, by passing the result of
+ * one call as the seed of the next.
+ * The result depends on the CPU and may change between versions, so it is only suitable
+ * for in-process tables. Use rsslPolyHash() for values that are sent on the network or stored.
+ */
+RSSL_API RsslUInt32 rsslFastHash(const char* buf, const RsslUInt32 length, const RsslUInt32 seed);
+
+/* Same as rsslFastHash(), using the given kernel. Used for testing and benchmarking. */
+RSSL_API RsslUInt32 rsslFastHashWithKernel(RsslHashKernel kernel, const char* buf, const RsslUInt32 length, const RsslUInt32 seed);
+
+/* Returns RSSL_TRUE if the given kernel can run on this machine. */
+RSSL_API RsslBool rsslFastHashKernelSupported(RsslHashKernel kernel);
+
+/* Returns the kernel used by rsslFastHash(). */
+RSSL_API RsslHashKernel rsslFastHashSelectedKernel();
+
 #ifdef __cplusplus
 }
 #endif
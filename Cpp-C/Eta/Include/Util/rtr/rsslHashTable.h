@@ -63,6 +63,11 @@ RTR_C_INLINE RsslRet rsslHashTableInit(RsslHashTable *pTable, RsslUInt32 queueCo
 /* Cleans up a hash table. */
 RTR_C_INLINE RsslRet rsslHashTableCleanup(RsslHashTable *pTable);
 
+/* Changes the hash function of a hash table, recalculating the sums of any elements it contains.
+ * This allows a table to switch between hash families, for example when its sums must match
+ * values that are sent on the network. */
+RTR_C_INLINE void rsslHashTableSetHashFunction(RsslHashTable *pTable, RsslHashSumFunction *keyHashFunction);
+
 /* Add an element to the hash table. */
 RTR_C_INLINE void rsslHashTableInsertLink(RsslHashTable *pTable, RsslHashLink *pLink, 
 		void *pKey, RsslUInt32 *pSum);
@@ -93,6 +98,9 @@ RSSL_API RsslBool rsslHashU64Compare(void *pKey1, void *pKey2);
 RSSL_API RsslUInt32 rsslHashBufferSum(void *pKey);
 RSSL_API RsslBool rsslHashBufferCompare(void *pKey1, void *pKey2);
 
+/* RsslBuffer hash function using rsslFastHash(). Its values are only valid within the process. */
+RSSL_API RsslUInt32 rsslHashBufferFastSum(void *pKey);
+
 #define LOAD_FACTOR 0.75
 
 #define RSSL_HASH_LINK_FROM_QUEUE_LINK(__pLink) ((RsslHashLink*)__pLink)
@@ -224,6 +232,38 @@ RTR_C_INLINE void rsslHashTableInsertLink(RsslHashTable *pTable, RsslHashLink *p
 
 
 
+RTR_C_INLINE void rsslHashTableSetHashFunction(RsslHashTable *pTable, RsslHashSumFunction *keyHashFunction)
+{
+	RsslQueue links;
+	RsslQueueLink *pQueueLink;
+	RsslUInt32 i;
+
+	if (pTable->keyHashFunction == keyHashFunction)
+		return;
+
+	pTable->keyHashFunction = keyHashFunction;
+
+	if (pTable->elementCount == 0)
+		return;
+
+	/* Take every link out of the table, then add each back with its new sum. */
+	rsslInitQueue(&links);
+	for (i = 0; i < pTable->queueCount; ++i)
+	{
+		while ((pQueueLink = rsslQueueRemoveFirstLink(&pTable->queueList[i])))
+			rsslQueueAddLinkToBack(&links, pQueueLink);
+	}
+
+	while ((pQueueLink = rsslQueueRemoveFirstLink(&links)))
+	{
+		RsslHashLink *pHashLink = RSSL_HASH_LINK_FROM_QUEUE_LINK(pQueueLink);
+
+		pHashLink->hashSum = keyHashFunction(pHashLink->pKey);
+		rsslQueueAddLinkToBack(&pTable->queueList[pHashLink->hashSum % pTable->queueCount], 
+				&pHashLink->queueLink);
+	}
+}
+
 RTR_C_INLINE void rsslHashTableRemoveLink(RsslHashTable *pTable, RsslHashLink *pLink)
 {
 	RsslUInt32 queueListLocation = pLink->hashSum % pTable->queueCount;
@@ -12,6 +12,7 @@
   * 
   * Overview of usage:
   * - rsslCreateNotifier creates an RsslNotifier that can wait on file descriptors.
+  *     rsslCreateNotifierWithMode can be used instead to select the notification mechanism (see RsslNotifierMode).
   * - rsslCreateNotifierEvent creates an RsslNotifierEvent, associated with a file descriptor.
   * - rsslNotifierAddEvent adds the RsslNotifierEvent to the RsslNotifier.
   * - rsslNotifierRegisterRead/rsslNotifierRegisterWrite enable read/write notification for the RsslNotifierEvent.
@@ -67,7 +68,8 @@ RTR_C_INLINE int rsslNotifierEventIsWritable(RsslNotifierEvent *pEvent)
 
 /* Indicates whether the event's file descriptor may be invalid.  The event may need its associated FD to be updated.
  *   Note: When the notifier uses select for notification, this will be set on every descriptor when
- *   it sees the EBADF error. When the notifier uses poll, it will be set only on appropriate events. */
+ *   it sees the EBADF error. When the notifier uses poll, it will be set only on appropriate events. 
+ *   When the notifier uses epoll, it will be set on events whose descriptor could not be registered. */
 RTR_C_INLINE int rsslNotifierEventIsFdBad(RsslNotifierEvent *pEvent)
 {
 	return pEvent->notifiedFlags & RSSL_NESF_BAD_FD;
@@ -88,6 +90,20 @@ RSSL_API void rsslDestroyNotifierEvent(RsslNotifierEvent *pEvent);
 /* Returns the object associated with this event. */
 RSSL_API void *rsslNotifierEventGetObject(RsslNotifierEvent *pEvent);
 
+/* Returns the file descriptor associated with this event. */
+RSSL_API RsslSocket rsslNotifierEventGetFd(RsslNotifierEvent *pEvent);
+
+/* Notification mechanism used by an RsslNotifier. */
+typedef enum
+{
+	RSSL_NOTIFIER_MODE_DEFAULT = 0,		/* Platform default. Level-triggered epoll on Linux, select on Windows, poll elsewhere. */
+	RSSL_NOTIFIER_MODE_POLL = 1,		/* poll (select on Windows). Each wait scans every associated event. */
+	RSSL_NOTIFIER_MODE_EPOLL_LEVEL = 2,	/* Level-triggered epoll (Linux only). Each wait only visits the events that are ready. */
+	RSSL_NOTIFIER_MODE_EPOLL_EDGE = 3	/* Edge-triggered epoll (Linux only). Notified flags are not reset by rsslNotifierWait; 
+										 * the application must read/write until the operation would block and then call 
+										 * rsslNotifierEventClearNotifiedFlags. */
+} RsslNotifierMode;
+
 /* Used to wait for notification.
  * Triggers on any of the RsslNotifierEvents associated with it. */
 typedef struct
@@ -100,6 +116,11 @@ typedef struct
  * - maxEventsHint: The likely max number of associated events. Setting appropriately may improve performance. */
 RSSL_API RsslNotifier *rsslCreateNotifier(int maxEventsHint);
 
+/* Initializes an RsslNotifier that uses the specified notification mechanism. 
+ * - maxEventsHint: The likely max number of associated events. Setting appropriately may improve performance. 
+ * - mode: The notification mechanism. If an epoll mode is requested but epoll is not available, poll (select on Windows) is used. */
+RSSL_API RsslNotifier *rsslCreateNotifierWithMode(int maxEventsHint, RsslNotifierMode mode);
+
 /* Cleans up resources associated with an RsslNotifier. */
 RSSL_API void rsslDestroyNotifier(RsslNotifier *pNotifier);
 
@@ -109,7 +130,10 @@ RSSL_API int rsslNotifierAddEvent(RsslNotifier *pNotifier, RsslNotifierEvent *pE
 /* Removes an RsslNotifierEvent from the RsslNotifier. */
 RSSL_API int rsslNotifierRemoveEvent(RsslNotifier *pNotifier, RsslNotifierEvent *pEvent);
 
-/* Updates the descriptor associated with an event.  The previous descriptor must already be closed. */
+/* Updates the descriptor associated with an event.  The previous descriptor must already be closed. 
+ *   Note: When the notifier uses epoll, a closed descriptor is silently dropped by the kernel and is never reported 
+ *   through rsslNotifierEventIsFdBad, so callers that share a descriptor with another thread should compare it against
+ *   rsslNotifierEventGetFd and call this when it changes. */
 RSSL_API int rsslNotifierUpdateEventFd(RsslNotifier *pNotifier, RsslNotifierEvent *pEvent, RsslSocket fd);
 
 /* Registers the RsslNotifierEvent's file for read (and out-of-band) notfication. */
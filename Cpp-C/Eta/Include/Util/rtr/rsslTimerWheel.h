@@ -0,0 +1,294 @@
+/*
+ * This source code is provided under the Apache 2.0 license and is provided
+ * AS IS with no warranty or guarantee of fit for purpose.  See the project's
+ * LICENSE.md for details.
+ * Copyright (C) 2019 Refinitiv. All rights reserved.
+*/
+
+/* Implements a hierarchical timer wheel using the RsslQueue.
+ *
+ * Timers are embedded in the objects they time, like RsslQueueLink, and adding, canceling
+ * and expiring a timer take constant time however many timers there are. Time is counted in
+ * integer ticks of the user's choosing (e.g. milliseconds).
+ *
+ * Each level has 64 slots. A timer is placed on the level of the highest base-64 digit in
+ * which its expire time differs from the wheel's current time, in the slot given by that digit.
+ * As the wheel advances, the slots it passes are emptied and their timers are placed again,
+ * moving down a level each time until they reach level 0 and expire. Timers too far away
+ * for the top level wait in an overflow queue.
+ *
+ * The wheel is not thread-safe. */
+
+#ifndef RSSL_TIMER_WHEEL_H
+#define RSSL_TIMER_WHEEL_H
+
+#include "rtr/rsslTypes.h"
+#include "rtr/rsslQueue.h"
+
+#if defined(_WIN32) || defined(WIN32)
+#include <intrin.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define RSSL_TIMER_WHEEL_SLOT_BITS	6
+#define RSSL_TIMER_WHEEL_SLOTS		(1 << RSSL_TIMER_WHEEL_SLOT_BITS)
+#define RSSL_TIMER_WHEEL_LEVELS		6
+
+/* Returned by rsslTimerWheelNextExpireTime() when no timers are set. */
+static const RsslInt64 RSSL_TIMER_WHEEL_UNSET = 0x7fffffffffffffffLL;
+
+/* Timer structure. */
+typedef struct
+{
+	RsslQueueLink	link;
+	RsslInt64		expireTime;		/* Time at which the timer expires. */
+	RsslQueue		*pQueue;		/* Slot or queue the timer is in; NULL if the timer is not set. */
+	void			*pUserSpec;		/* Object the timer belongs to. */
+} RsslTimerWheelTimer;
+
+/* Timer Wheel structure. */
+typedef struct
+{
+	RsslInt64		currentTime;									/* Time the wheel has advanced to. */
+	RsslUInt32		timerCount;										/* Number of timers set, including expired ones not yet removed. */
+	RsslUInt64		occupiedSlots[RSSL_TIMER_WHEEL_LEVELS];			/* Bitmap of the non-empty slots of each level. */
+	RsslQueue		slots[RSSL_TIMER_WHEEL_LEVELS][RSSL_TIMER_WHEEL_SLOTS];
+	RsslQueue		overflowQueue;									/* Timers beyond the range of the top level. */
+	RsslQueue		expiredQueue;									/* Timers that have expired, in the order they were found. */
+} RsslTimerWheel;
+
+/* Initializes a timer. */
+RTR_C_INLINE void rsslTimerWheelTimerInit(RsslTimerWheelTimer *pTimer, void *pUserSpec)
+{
+	rsslInitQueueLink(&pTimer->link);
+	pTimer->expireTime = 0;
+	pTimer->pQueue = NULL;
+	pTimer->pUserSpec = pUserSpec;
+}
+
+/* Indicates whether a timer is set, i.e. added to a wheel and not yet canceled or removed as expired. */
+RTR_C_INLINE RsslBool rsslTimerWheelTimerIsSet(RsslTimerWheelTimer *pTimer)
+{
+	return pTimer->pQueue != NULL ? RSSL_TRUE : RSSL_FALSE;
+}
+
+/* Index of the lowest set bit of a non-zero value. */
+RTR_C_INLINE RsslUInt32 _rsslTimerWheelLowestBit(RsslUInt64 value)
+{
+#if defined(_WIN32) || defined(WIN32)
+	unsigned long index;
+	_BitScanForward64(&index, value);
+	return (RsslUInt32)index;
+#else
+	return (RsslUInt32)__builtin_ctzll(value);
+#endif
+}
+
+/* Index of the highest set bit of a non-zero value. */
+RTR_C_INLINE RsslUInt32 _rsslTimerWheelHighestBit(RsslUInt64 value)
+{
+#if defined(_WIN32) || defined(WIN32)
+	unsigned long index;
+	_BitScanReverse64(&index, value);
+	return (RsslUInt32)index;
+#else
+	return (RsslUInt32)(63 - __builtin_clzll(value));
+#endif
+}
+
+/* Initializes a timer wheel, starting at the given time. */
+RTR_C_INLINE void rsslTimerWheelInit(RsslTimerWheel *pWheel, RsslInt64 currentTime)
+{
+	int level, slot;
+
+	pWheel->currentTime = currentTime;
+	pWheel->timerCount = 0;
+
+	for (level = 0; level < RSSL_TIMER_WHEEL_LEVELS; ++level)
+	{
+		pWheel->occupiedSlots[level] = 0;
+		for (slot = 0; slot < RSSL_TIMER_WHEEL_SLOTS; ++slot)
+			rsslInitQueue(&pWheel->slots[level][slot]);
+	}
+
+	rsslInitQueue(&pWheel->overflowQueue);
+	rsslInitQueue(&pWheel->expiredQueue);
+}
+
+/* Places a timer in the slot or queue for its expire time. */
+RTR_C_INLINE void _rsslTimerWheelPlace(RsslTimerWheel *pWheel, RsslTimerWheelTimer *pTimer)
+{
+	RsslUInt32 level, slot;
+
+	if (pTimer->expireTime <= pWheel->currentTime)
+	{
+		pTimer->pQueue = &pWheel->expiredQueue;
+		rsslQueueAddLinkToBack(&pWheel->expiredQueue, &pTimer->link);
+		return;
+	}
+
+	level = _rsslTimerWheelHighestBit((RsslUInt64)(pTimer->expireTime ^ pWheel->currentTime)) / RSSL_TIMER_WHEEL_SLOT_BITS;
+
+	if (level >= RSSL_TIMER_WHEEL_LEVELS)
+	{
+		pTimer->pQueue = &pWheel->overflowQueue;
+		rsslQueueAddLinkToBack(&pWheel->overflowQueue, &pTimer->link);
+		return;
+	}
+
+	slot = (RsslUInt32)(pTimer->expireTime >> (level * RSSL_TIMER_WHEEL_SLOT_BITS)) & (RSSL_TIMER_WHEEL_SLOTS - 1);
+	pTimer->pQueue = &pWheel->slots[level][slot];
+	rsslQueueAddLinkToBack(pTimer->pQueue, &pTimer->link);
+	pWheel->occupiedSlots[level] |= ((RsslUInt64)1 << slot);
+}
+
+/* Removes a timer from its slot or queue. */
+RTR_C_INLINE void _rsslTimerWheelUnlink(RsslTimerWheel *pWheel, RsslTimerWheelTimer *pTimer)
+{
+	RsslQueue *pQueue = pTimer->pQueue;
+
+	rsslQueueRemoveLink(pQueue, &pTimer->link);
+	pTimer->pQueue = NULL;
+
+	if (pQueue->count == 0 && pQueue >= &pWheel->slots[0][0]
+			&& pQueue < &pWheel->slots[0][0] + RSSL_TIMER_WHEEL_LEVELS * RSSL_TIMER_WHEEL_SLOTS)
+	{
+		ptrdiff_t index = pQueue - &pWheel->slots[0][0];
+		pWheel->occupiedSlots[index / RSSL_TIMER_WHEEL_SLOTS] &= ~((RsslUInt64)1 << (index % RSSL_TIMER_WHEEL_SLOTS));
+	}
+}
+
+/* Cancels a timer. Does nothing if the timer is not set. */
+RTR_C_INLINE void rsslTimerWheelCancel(RsslTimerWheel *pWheel, RsslTimerWheelTimer *pTimer)
+{
+	if (!pTimer->pQueue)
+		return;
+
+	_rsslTimerWheelUnlink(pWheel, pTimer);
+	--pWheel->timerCount;
+}
+
+/* Sets a timer to expire at the given time, replacing its previous expire time if it was already set.
+ * A timer set to the wheel's current time or earlier expires immediately. */
+RTR_C_INLINE void rsslTimerWheelAdd(RsslTimerWheel *pWheel, RsslTimerWheelTimer *pTimer, RsslInt64 expireTime)
+{
+	rsslTimerWheelCancel(pWheel, pTimer);
+
+	pTimer->expireTime = expireTime;
+	_rsslTimerWheelPlace(pWheel, pTimer);
+	++pWheel->timerCount;
+}
+
+/* Advances the wheel to the given time. Timers that expire by then become available
+ * from rsslTimerWheelPopExpired(). Does nothing if the time is not after the wheel's current time. */
+RTR_C_INLINE void rsslTimerWheelAdvance(RsslTimerWheel *pWheel, RsslInt64 currentTime)
+{
+	RsslQueue pendingQueue;
+	RsslQueueLink *pLink;
+	RsslUInt32 level;
+
+	if (currentTime <= pWheel->currentTime)
+		return;
+
+	rsslInitQueue(&pendingQueue);
+
+	for (level = 0; level < RSSL_TIMER_WHEEL_LEVELS; ++level)
+	{
+		RsslUInt32 shift = level * RSSL_TIMER_WHEEL_SLOT_BITS;
+		RsslUInt64 passedSlots, occupied;
+		RsslBool higherDigitsChanged =
+			((currentTime >> (shift + RSSL_TIMER_WHEEL_SLOT_BITS)) != (pWheel->currentTime >> (shift + RSSL_TIMER_WHEEL_SLOT_BITS)));
+
+		if (higherDigitsChanged)
+		{
+			/* The wheel has moved past every slot on this level. */
+			passedSlots = ~(RsslUInt64)0;
+		}
+		else
+		{
+			/* Timers on a level are always in slots after the current one, so the slots passed are those
+			 * after the old digit, up to and including the new one. */
+			RsslUInt32 oldDigit = (RsslUInt32)(pWheel->currentTime >> shift) & (RSSL_TIMER_WHEEL_SLOTS - 1);
+			RsslUInt32 newDigit = (RsslUInt32)(currentTime >> shift) & (RSSL_TIMER_WHEEL_SLOTS - 1);
+
+			passedSlots = (newDigit == RSSL_TIMER_WHEEL_SLOTS - 1 ? ~(RsslUInt64)0 : (((RsslUInt64)1 << (newDigit + 1)) - 1))
+				& ~(((RsslUInt64)1 << (oldDigit + 1)) - 1);
+		}
+
+		occupied = pWheel->occupiedSlots[level] & passedSlots;
+		while (occupied)
+		{
+			RsslUInt32 slot = _rsslTimerWheelLowestBit(occupied);
+			rsslQueueAppend(&pendingQueue, &pWheel->slots[level][slot]);
+			occupied &= occupied - 1;
+		}
+		pWheel->occupiedSlots[level] &= ~passedSlots;
+
+		/* If the higher digits did not change, neither did any level above this one. */
+		if (!higherDigitsChanged)
+			break;
+	}
+
+	if (level == RSSL_TIMER_WHEEL_LEVELS)
+		rsslQueueAppend(&pendingQueue, &pWheel->overflowQueue);
+
+	pWheel->currentTime = currentTime;
+
+	/* Place the timers from the passed slots again; those that are due move to the expired queue,
+	 * and the others to a lower level. */
+	while ((pLink = rsslQueueRemoveFirstLink(&pendingQueue)))
+		_rsslTimerWheelPlace(pWheel, (RsslTimerWheelTimer*)RSSL_QUEUE_LINK_TO_OBJECT(RsslTimerWheelTimer, link, pLink));
+}
+
+/* Removes and returns the next expired timer, or NULL if there are none. */
+RTR_C_INLINE RsslTimerWheelTimer *rsslTimerWheelPopExpired(RsslTimerWheel *pWheel)
+{
+	RsslQueueLink *pLink;
+	RsslTimerWheelTimer *pTimer;
+
+	if (!(pLink = rsslQueueRemoveFirstLink(&pWheel->expiredQueue)))
+		return NULL;
+
+	pTimer = RSSL_QUEUE_LINK_TO_OBJECT(RsslTimerWheelTimer, link, pLink);
+	pTimer->pQueue = NULL;
+	--pWheel->timerCount;
+	return pTimer;
+}
+
+/* Returns the time by which the wheel should next be advanced. This is the expire time of the next timer
+ * if it is on level 0, and otherwise the earlier time at which its slot must be emptied to move it down a level.
+ * Returns the wheel's current time if timers have expired, and RSSL_TIMER_WHEEL_UNSET if no timers are set.
+ * Takes constant time. */
+RTR_C_INLINE RsslInt64 rsslTimerWheelNextExpireTime(RsslTimerWheel *pWheel)
+{
+	RsslUInt32 level;
+
+	if (pWheel->expiredQueue.count)
+		return pWheel->currentTime;
+
+	for (level = 0; level < RSSL_TIMER_WHEEL_LEVELS; ++level)
+	{
+		if (pWheel->occupiedSlots[level])
+		{
+			RsslUInt32 shift = level * RSSL_TIMER_WHEEL_SLOT_BITS;
+			RsslInt64 levelBase = (pWheel->currentTime >> (shift + RSSL_TIMER_WHEEL_SLOT_BITS)) << (shift + RSSL_TIMER_WHEEL_SLOT_BITS);
+
+			return levelBase | ((RsslInt64)_rsslTimerWheelLowestBit(pWheel->occupiedSlots[level]) << shift);
+		}
+	}
+
+	if (pWheel->overflowQueue.count)
+		return ((pWheel->currentTime >> (RSSL_TIMER_WHEEL_LEVELS * RSSL_TIMER_WHEEL_SLOT_BITS)) + 1)
+			<< (RSSL_TIMER_WHEEL_LEVELS * RSSL_TIMER_WHEEL_SLOT_BITS);
+
+	return RSSL_TIMER_WHEEL_UNSET;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -17,6 +17,14 @@
 
 rsslServerCountersInfo* rsslGetServerCountersInfo(RsslServer* pServer);
 
+/* Skips the current test. GTEST_SKIP is only available from googletest 1.10; with older versions the reason is printed
+ * and the test returns, so it is reported as passed. */
+#ifdef GTEST_SKIP
+#define TU_SKIP(reason) GTEST_SKIP() << (reason)
+#else
+#define TU_SKIP(reason) do { printf("Skipping: %s\n", (reason)); return; } while (0)
+#endif
+
 /* Provides configuration options for creating server in Transport Unit-test */
 typedef struct {
 	RsslBool			blocking;
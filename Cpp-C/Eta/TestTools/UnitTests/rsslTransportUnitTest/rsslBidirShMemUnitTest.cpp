@@ -0,0 +1,317 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2022 Refinitiv. All rights reserved.              --
+ *|-----------------------------------------------------------------------------
+ */
+
+/************************************************************************
+*	 Bidirectional Shared Memory Unit Tests
+*
+*   Connects a client and server over the bidirectional shared memory
+*   transport and exchanges messages in both directions, including
+*   enough traffic to wrap the rings, and checks that the reader
+*   rejects records that the other side corrupted.
+*
+/**********************************************************************/
+
+#include "gtest/gtest.h"
+
+#include "rtr/rsslTransport.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#ifdef LINUX
+
+#include "rtr/shmemspscring.h"
+
+class BidirShMemTest : public ::testing::Test {
+protected:
+	RsslServer *pServer;
+	RsslChannel *pClientChannel;
+	RsslChannel *pServerChannel;
+	RsslError err;
+
+	virtual void SetUp()
+	{
+		pServer = NULL;
+		pClientChannel = NULL;
+		pServerChannel = NULL;
+		ASSERT_EQ(RSSL_RET_SUCCESS, rsslInitialize(RSSL_LOCK_NONE, &err));
+	}
+
+	virtual void TearDown()
+	{
+		if (pClientChannel)
+			rsslCloseChannel(pClientChannel, &err);
+		if (pServerChannel)
+			rsslCloseChannel(pServerChannel, &err);
+		if (pServer)
+			rsslCloseServer(pServer, &err);
+		rsslUninitialize();
+	}
+
+	/* Small messages and few buffers, so that the rings wrap quickly. */
+	void connect()
+	{
+		RsslBindOptions bindOpts;
+		RsslConnectOptions connectOpts;
+		RsslAcceptOptions acceptOpts;
+		RsslInProgInfo inProg;
+
+		rsslClearBindOpts(&bindOpts);
+		bindOpts.connectionType = RSSL_CONN_TYPE_BIDIR_SHMEM;
+		bindOpts.serviceName = const_cast<char*>("bidirShMemUnitTest");
+		bindOpts.maxFragmentSize = 256;
+		bindOpts.guaranteedOutputBuffers = 4;
+		bindOpts.maxOutputBuffers = 4;
+		ASSERT_TRUE((pServer = rsslBind(&bindOpts, &err)) != NULL) << err.text;
+
+		rsslClearConnectOpts(&connectOpts);
+		connectOpts.connectionType = RSSL_CONN_TYPE_BIDIR_SHMEM;
+		connectOpts.connectionInfo.unified.serviceName = const_cast<char*>("bidirShMemUnitTest");
+		connectOpts.guaranteedOutputBuffers = 4;
+		connectOpts.blocking = RSSL_FALSE;
+		ASSERT_TRUE((pClientChannel = rsslConnect(&connectOpts, &err)) != NULL) << err.text;
+
+		rsslClearAcceptOpts(&acceptOpts);
+		ASSERT_TRUE((pServerChannel = rsslAccept(pServer, &acceptOpts, &err)) != NULL) << err.text;
+
+		ASSERT_EQ(RSSL_RET_CHAN_INIT_IN_PROGRESS, rsslInitChannel(pClientChannel, &inProg, &err));
+		ASSERT_EQ(RSSL_RET_SUCCESS, rsslInitChannel(pServerChannel, &inProg, &err)) << err.text;
+		ASSERT_EQ(RSSL_RET_SUCCESS, rsslInitChannel(pClientChannel, &inProg, &err)) << err.text;
+		ASSERT_EQ(RSSL_CH_STATE_ACTIVE, pClientChannel->state);
+		ASSERT_EQ(RSSL_CH_STATE_ACTIVE, pServerChannel->state);
+	}
+
+	void write(RsslChannel *pChannel, RsslBuffer *pBuffer)
+	{
+		RsslWriteInArgs writeInArgs;
+		RsslWriteOutArgs writeOutArgs;
+
+		rsslClearWriteInArgs(&writeInArgs);
+		rsslClearWriteOutArgs(&writeOutArgs);
+		ASSERT_EQ(RSSL_RET_SUCCESS, rsslWriteEx(pChannel, pBuffer, &writeInArgs, &writeOutArgs, &err)) << err.text;
+	}
+
+	RsslBuffer *read(RsslChannel *pChannel, RsslRet *pRet)
+	{
+		RsslReadInArgs readInArgs;
+		RsslReadOutArgs readOutArgs;
+
+		rsslClearReadInArgs(&readInArgs);
+		rsslClearReadOutArgs(&readOutArgs);
+		return rsslReadEx(pChannel, &readInArgs, &readOutArgs, pRet, &err);
+	}
+};
+
+TEST_F(BidirShMemTest, MessagesWrapInBothDirections)
+{
+	RsslChannelInfo info;
+
+	connect();
+	ASSERT_EQ(RSSL_RET_SUCCESS, rsslGetChannelInfo(pClientChannel, &info, &err)) << err.text;
+	ASSERT_EQ((RsslUInt32)256, info.maxFragmentSize);
+
+	for (int i = 0; i < 1000; ++i)
+	{
+		RsslChannel *pWriter = (i % 2) ? pServerChannel : pClientChannel;
+		RsslChannel *pReader = (i % 2) ? pClientChannel : pServerChannel;
+		RsslUInt32 length = 1 + (i * 37) % 256;
+		RsslBuffer *pBuffer;
+		RsslRet ret;
+
+		ASSERT_TRUE((pBuffer = rsslGetBuffer(pWriter, length, RSSL_FALSE, &err)) != NULL) << err.text;
+		memset(pBuffer->data, i, length);
+		pBuffer->length = length;
+		write(pWriter, pBuffer);
+
+		ASSERT_TRUE((pBuffer = read(pReader, &ret)) != NULL) << ret;
+		ASSERT_EQ(length, pBuffer->length);
+		ASSERT_EQ((char)i, pBuffer->data[0]);
+		ASSERT_EQ((char)i, pBuffer->data[length - 1]);
+	}
+}
+
+TEST_F(BidirShMemTest, FullRingReportsNoBuffers)
+{
+	RsslBuffer *pBuffer;
+	RsslRet ret;
+	int written = 0;
+
+	connect();
+
+	while ((pBuffer = rsslGetBuffer(pClientChannel, 256, RSSL_FALSE, &err)) != NULL)
+	{
+		pBuffer->length = snprintf(pBuffer->data, 256, "message %d", written++);
+		write(pClientChannel, pBuffer);
+	}
+	ASSERT_EQ(RSSL_RET_BUFFER_NO_BUFFERS, err.rsslErrorId);
+	ASSERT_GE(written, 4);
+
+	for (int i = 0; i < written; ++i)
+	{
+		char expected[32];
+
+		ASSERT_TRUE((pBuffer = read(pServerChannel, &ret)) != NULL) << ret;
+		snprintf(expected, sizeof(expected), "message %d", i);
+		ASSERT_EQ(strlen(expected), pBuffer->length);
+		ASSERT_EQ(0, memcmp(expected, pBuffer->data, pBuffer->length));
+	}
+
+	ASSERT_TRUE(read(pServerChannel, &ret) == NULL);
+	ASSERT_EQ(RSSL_RET_READ_WOULD_BLOCK, ret);
+
+	/* The reader has emptied the ring, so there is space again. */
+	ASSERT_TRUE((pBuffer = rsslGetBuffer(pClientChannel, 256, RSSL_FALSE, &err)) != NULL) << err.text;
+	ASSERT_EQ(RSSL_RET_SUCCESS, rsslReleaseBuffer(pBuffer, &err));
+}
+
+TEST_F(BidirShMemTest, PackedMessages)
+{
+	RsslBuffer *pBuffer;
+	RsslRet ret;
+
+	connect();
+
+	ASSERT_TRUE((pBuffer = rsslGetBuffer(pClientChannel, 100, RSSL_TRUE, &err)) != NULL) << err.text;
+	for (int i = 0; i < 3; ++i)
+	{
+		memset(pBuffer->data, 'a' + i, 10);
+		pBuffer->length = 10;
+		ASSERT_TRUE((pBuffer = rsslPackBuffer(pClientChannel, pBuffer, &err)) != NULL) << err.text;
+	}
+	memset(pBuffer->data, 'z', 5);
+	pBuffer->length = 5;
+	write(pClientChannel, pBuffer);
+
+	for (int i = 0; i < 3; ++i)
+	{
+		ASSERT_TRUE((pBuffer = read(pServerChannel, &ret)) != NULL) << ret;
+		ASSERT_EQ((RsslUInt32)10, pBuffer->length);
+		ASSERT_EQ('a' + i, pBuffer->data[0]);
+	}
+
+	ASSERT_TRUE((pBuffer = read(pServerChannel, &ret)) != NULL) << ret;
+	ASSERT_EQ((RsslUInt32)5, pBuffer->length);
+	ASSERT_EQ('z', pBuffer->data[0]);
+}
+
+TEST_F(BidirShMemTest, ReleasedBufferDoesNotBlockLaterWrites)
+{
+	RsslBuffer *pFirst, *pSecond, *pBuffer;
+	RsslRet ret;
+
+	connect();
+
+	ASSERT_TRUE((pFirst = rsslGetBuffer(pServerChannel, 50, RSSL_FALSE, &err)) != NULL) << err.text;
+	ASSERT_TRUE((pSecond = rsslGetBuffer(pServerChannel, 50, RSSL_FALSE, &err)) != NULL) << err.text;
+	memcpy(pSecond->data, "second", 6);
+	pSecond->length = 6;
+	write(pServerChannel, pSecond);
+
+	/* Messages are delivered in the order their buffers were taken. */
+	ASSERT_TRUE(read(pClientChannel, &ret) == NULL);
+
+	ASSERT_EQ(RSSL_RET_SUCCESS, rsslReleaseBuffer(pFirst, &err));
+	ASSERT_TRUE((pBuffer = read(pClientChannel, &ret)) != NULL) << ret;
+	ASSERT_EQ((RsslUInt32)6, pBuffer->length);
+	ASSERT_EQ(0, memcmp("second", pBuffer->data, 6));
+}
+
+/* The record header sits in shared memory just before the data, where the other side can change it after it is published. */
+static rtrSpscRecord *recordOf(char *data)
+{
+	return (rtrSpscRecord*)data - 1;
+}
+
+TEST_F(BidirShMemTest, RecordLongerThanRingClosesChannel)
+{
+	RsslBuffer *pBuffer;
+	char *data;
+	RsslRet ret;
+
+	connect();
+
+	ASSERT_TRUE((pBuffer = rsslGetBuffer(pClientChannel, 50, RSSL_FALSE, &err)) != NULL) << err.text;
+	data = pBuffer->data;
+	pBuffer->length = 10;
+	write(pClientChannel, pBuffer);
+
+	recordOf(data)->size = 0x7FFFFFF0;
+
+	ASSERT_TRUE(read(pServerChannel, &ret) == NULL);
+	ASSERT_EQ(RSSL_RET_FAILURE, ret);
+	ASSERT_EQ(RSSL_CH_STATE_CLOSED, pServerChannel->state);
+}
+
+TEST_F(BidirShMemTest, LengthLongerThanRecordClosesChannel)
+{
+	RsslBuffer *pBuffer;
+	char *data;
+	RsslRet ret;
+
+	connect();
+
+	ASSERT_TRUE((pBuffer = rsslGetBuffer(pClientChannel, 50, RSSL_FALSE, &err)) != NULL) << err.text;
+	data = pBuffer->data;
+	pBuffer->length = 10;
+	write(pClientChannel, pBuffer);
+
+	recordOf(data)->length = recordOf(data)->size;
+
+	ASSERT_TRUE(read(pServerChannel, &ret) == NULL);
+	ASSERT_EQ(RSSL_RET_FAILURE, ret);
+	ASSERT_EQ(RSSL_CH_STATE_CLOSED, pServerChannel->state);
+}
+
+TEST_F(BidirShMemTest, PackedLengthLongerThanRecordClosesChannel)
+{
+	RsslBuffer *pBuffer;
+	char *data;
+	RsslRet ret;
+
+	connect();
+
+	ASSERT_TRUE((pBuffer = rsslGetBuffer(pClientChannel, 100, RSSL_TRUE, &err)) != NULL) << err.text;
+	data = pBuffer->data;
+	memset(pBuffer->data, 'a', 10);
+	pBuffer->length = 10;
+	ASSERT_TRUE((pBuffer = rsslPackBuffer(pClientChannel, pBuffer, &err)) != NULL) << err.text;
+	memset(pBuffer->data, 'b', 10);
+	pBuffer->length = 10;
+	write(pClientChannel, pBuffer);
+
+	/* The second message claims to run past the end of the record. */
+	data[10] = (char)0xFF;
+	data[11] = (char)0xFF;
+
+	ASSERT_TRUE((pBuffer = read(pServerChannel, &ret)) != NULL) << ret;
+	ASSERT_EQ((RsslUInt32)10, pBuffer->length);
+
+	ASSERT_TRUE(read(pServerChannel, &ret) == NULL);
+	ASSERT_EQ(RSSL_RET_FAILURE, ret);
+	ASSERT_EQ(RSSL_CH_STATE_CLOSED, pServerChannel->state);
+}
+
+TEST_F(BidirShMemTest, PingAndClose)
+{
+	RsslRet ret;
+	int tries = 0;
+
+	connect();
+
+	ASSERT_EQ(RSSL_RET_SUCCESS, rsslPing(pClientChannel, &err));
+	ASSERT_TRUE(read(pServerChannel, &ret) == NULL);
+	ASSERT_EQ(RSSL_RET_READ_PING, ret);
+
+	ASSERT_EQ(RSSL_RET_SUCCESS, rsslCloseChannel(pClientChannel, &err));
+	pClientChannel = NULL;
+
+	while (read(pServerChannel, &ret) == NULL && ret != RSSL_RET_FAILURE && tries++ < 10);
+	ASSERT_EQ(RSSL_RET_FAILURE, ret);
+}
+
+#endif
@@ -0,0 +1,208 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2022 Refinitiv. All rights reserved.              --
+ *|-----------------------------------------------------------------------------
+ */
+
+/************************************************************************
+*	 RsslNotifier Unit Tests
+*
+*   Checks that each notification mechanism reports the same events.
+*
+/**********************************************************************/
+
+#include "gtest/gtest.h"
+
+#include "rtr/rsslNotifier.h"
+
+#ifndef WIN32
+
+#include <unistd.h>
+#include <sys/socket.h>
+
+class NotifierTest : public ::testing::TestWithParam<RsslNotifierMode> {
+protected:
+	static const int channelCount = 4;
+
+	RsslNotifier *pNotifier;
+	RsslNotifierEvent *pEvents[channelCount];
+	int channelFds[channelCount][2];
+
+	virtual void SetUp()
+	{
+		pNotifier = rsslCreateNotifierWithMode(2, GetParam()); /* Small hint, so the arrays must grow. */
+		ASSERT_TRUE(pNotifier != NULL);
+
+		for (int i = 0; i < channelCount; ++i)
+		{
+			ASSERT_EQ(0, socketpair(AF_UNIX, SOCK_STREAM, 0, channelFds[i]));
+			pEvents[i] = rsslCreateNotifierEvent();
+			ASSERT_EQ(0, rsslNotifierAddEvent(pNotifier, pEvents[i], channelFds[i][0], &channelFds[i]));
+			ASSERT_EQ(0, rsslNotifierRegisterRead(pNotifier, pEvents[i]));
+		}
+	}
+
+	virtual void TearDown()
+	{
+		for (int i = 0; i < channelCount; ++i)
+		{
+			if (pEvents[i] != NULL)
+			{
+				rsslNotifierRemoveEvent(pNotifier, pEvents[i]);
+				rsslDestroyNotifierEvent(pEvents[i]);
+			}
+			close(channelFds[i][0]);
+			close(channelFds[i][1]);
+		}
+
+		rsslDestroyNotifier(pNotifier);
+	}
+
+	void writeByte(int channel)
+	{
+		char byte = 0;
+		ASSERT_EQ(1, write(channelFds[channel][1], &byte, 1));
+	}
+
+	void readByte(int channel)
+	{
+		char byte;
+		ASSERT_EQ(1, read(channelFds[channel][0], &byte, 1));
+	}
+};
+
+TEST_P(NotifierTest, NotifiesOnlyReadyEvents)
+{
+	ASSERT_EQ(0, rsslNotifierWait(pNotifier, 0));
+	ASSERT_EQ(0, pNotifier->notifiedEventCount);
+
+	writeByte(2);
+
+	ASSERT_EQ(1, rsslNotifierWait(pNotifier, 1000000));
+	ASSERT_EQ(1, pNotifier->notifiedEventCount);
+	ASSERT_EQ(pEvents[2], pNotifier->notifiedEvents[0]);
+	ASSERT_EQ(&channelFds[2], rsslNotifierEventGetObject(pNotifier->notifiedEvents[0]));
+	ASSERT_TRUE(rsslNotifierEventIsReadable(pEvents[2]) != 0);
+	ASSERT_FALSE(rsslNotifierEventIsWritable(pEvents[2]) != 0);
+	ASSERT_FALSE(rsslNotifierEventIsReadable(pEvents[1]) != 0);
+
+	readByte(2);
+	rsslNotifierEventClearNotifiedFlags(pEvents[2]);
+
+	ASSERT_EQ(0, rsslNotifierWait(pNotifier, 0));
+	ASSERT_FALSE(rsslNotifierEventIsReadable(pEvents[2]) != 0);
+}
+
+TEST_P(NotifierTest, ReadinessIsReportedUntilCleared)
+{
+	writeByte(1);
+
+	ASSERT_EQ(1, rsslNotifierWait(pNotifier, 0));
+	ASSERT_TRUE(rsslNotifierEventIsReadable(pEvents[1]) != 0);
+
+	/* Nothing was read. Level-triggered mechanisms notify again; edge-triggered epoll keeps the flag set without notifying. */
+	rsslNotifierWait(pNotifier, 0);
+	ASSERT_TRUE(rsslNotifierEventIsReadable(pEvents[1]) != 0);
+	if (GetParam() == RSSL_NOTIFIER_MODE_EPOLL_EDGE)
+		ASSERT_EQ(0, pNotifier->notifiedEventCount);
+	else
+		ASSERT_EQ(1, pNotifier->notifiedEventCount);
+}
+
+TEST_P(NotifierTest, RegisterAndUnregisterWrite)
+{
+	ASSERT_EQ(0, rsslNotifierRegisterWrite(pNotifier, pEvents[3]));
+	ASSERT_EQ(1, rsslNotifierWait(pNotifier, 0));
+	ASSERT_TRUE(rsslNotifierEventIsWritable(pEvents[3]) != 0);
+
+	ASSERT_EQ(0, rsslNotifierUnregisterWrite(pNotifier, pEvents[3]));
+	rsslNotifierEventClearNotifiedFlags(pEvents[3]);
+	ASSERT_EQ(0, rsslNotifierWait(pNotifier, 0));
+
+	/* Unregistered reads are not reported. */
+	ASSERT_EQ(0, rsslNotifierUnregisterRead(pNotifier, pEvents[0]));
+	writeByte(0);
+	ASSERT_EQ(0, rsslNotifierWait(pNotifier, 0));
+}
+
+TEST_P(NotifierTest, RemovedEventIsNotNotified)
+{
+	writeByte(0);
+	writeByte(1);
+
+	ASSERT_EQ(2, rsslNotifierWait(pNotifier, 0));
+
+	ASSERT_EQ(0, rsslNotifierRemoveEvent(pNotifier, pEvents[0]));
+	rsslDestroyNotifierEvent(pEvents[0]);
+	pEvents[0] = NULL;
+
+	writeByte(0);
+	writeByte(1); /* New data, so that edge-triggered epoll notifies again. */
+	ASSERT_EQ(1, rsslNotifierWait(pNotifier, 0));
+	ASSERT_EQ(pEvents[1], pNotifier->notifiedEvents[0]);
+}
+
+TEST_P(NotifierTest, ReaddedEventIsNotNotified)
+{
+	writeByte(1);
+
+	ASSERT_EQ(1, rsslNotifierWait(pNotifier, 0));
+	ASSERT_TRUE(rsslNotifierEventIsReadable(pEvents[1]) != 0);
+
+	/* The reactor reuses notifier events for new channels; one must not come back readable from its last use. */
+	ASSERT_EQ(0, rsslNotifierRemoveEvent(pNotifier, pEvents[1]));
+	readByte(1);
+	ASSERT_EQ(0, rsslNotifierAddEvent(pNotifier, pEvents[1], channelFds[1][0], &channelFds[1]));
+	ASSERT_EQ(0, rsslNotifierRegisterRead(pNotifier, pEvents[1]));
+
+	writeByte(2);
+	ASSERT_EQ(1, rsslNotifierWait(pNotifier, 0));
+	ASSERT_EQ(pEvents[2], pNotifier->notifiedEvents[0]);
+	ASSERT_FALSE(rsslNotifierEventIsReadable(pEvents[1]) != 0);
+}
+
+TEST_P(NotifierTest, UpdateEventFd)
+{
+	int newFds[2];
+
+	ASSERT_EQ(0, socketpair(AF_UNIX, SOCK_STREAM, 0, newFds));
+
+	close(channelFds[3][0]);
+	channelFds[3][0] = newFds[0];
+	close(channelFds[3][1]);
+	channelFds[3][1] = newFds[1];
+
+	ASSERT_EQ(0, rsslNotifierUpdateEventFd(pNotifier, pEvents[3], newFds[0]));
+	ASSERT_EQ(0, rsslNotifierRegisterRead(pNotifier, pEvents[3]));
+	ASSERT_EQ(newFds[0], rsslNotifierEventGetFd(pEvents[3]));
+
+	writeByte(3);
+	ASSERT_EQ(1, rsslNotifierWait(pNotifier, 0));
+	ASSERT_EQ(pEvents[3], pNotifier->notifiedEvents[0]);
+}
+
+TEST_P(NotifierTest, BadDescriptorIsReported)
+{
+	RsslNotifierEvent *pBadEvent = rsslCreateNotifierEvent();
+	int badFd = dup(channelFds[0][0]);
+
+	close(badFd);
+
+	ASSERT_EQ(0, rsslNotifierAddEvent(pNotifier, pBadEvent, badFd, NULL));
+	ASSERT_EQ(0, rsslNotifierRegisterRead(pNotifier, pBadEvent));
+	ASSERT_EQ(1, rsslNotifierWait(pNotifier, 0));
+	ASSERT_TRUE(rsslNotifierEventIsFdBad(pBadEvent) != 0);
+
+	rsslNotifierRemoveEvent(pNotifier, pBadEvent);
+	rsslDestroyNotifierEvent(pBadEvent);
+}
+
+#ifdef RSSL_NOTIFIER_EPOLL
+INSTANTIATE_TEST_CASE_P(NotifierModes, NotifierTest, ::testing::Values(RSSL_NOTIFIER_MODE_POLL, RSSL_NOTIFIER_MODE_EPOLL_LEVEL, RSSL_NOTIFIER_MODE_EPOLL_EDGE));
+#else
+INSTANTIATE_TEST_CASE_P(NotifierModes, NotifierTest, ::testing::Values(RSSL_NOTIFIER_MODE_POLL));
+#endif
+
+#endif
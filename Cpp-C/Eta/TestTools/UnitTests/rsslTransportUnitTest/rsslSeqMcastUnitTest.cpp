@@ -0,0 +1,236 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2022 Refinitiv. All rights reserved.              --
+ *|-----------------------------------------------------------------------------
+ */
+
+/************************************************************************
+*	 Sequenced Multicast Unit Tests
+*
+*   Sends packets over loopback multicast with each combination of read
+*   and write batch sizes, and checks that they arrive in order.
+*
+/**********************************************************************/
+
+#include "gtest/gtest.h"
+
+#include "rtr/rsslTransport.h"
+#include "TransportUnitTest.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef WIN32
+
+#include <unistd.h>
+
+struct SeqMcastBatchParams
+{
+	RsslUInt32 readBatchSize;
+	RsslUInt32 writeBatchSize;
+};
+
+class SeqMcastBatchTest : public ::testing::TestWithParam<SeqMcastBatchParams> {
+protected:
+	static const int packetCount = 200;
+
+	RsslChannel *pReadChannel;
+	RsslChannel *pWriteChannel;
+	RsslError err;
+
+	/* Group and port used by this run. RSSL_SEQ_MCAST_TEST_ADDRESS and RSSL_SEQ_MCAST_TEST_PORT
+	 * override them; otherwise they are derived from the process ID so that concurrent runs
+	 * on the same host do not receive each other's packets. */
+	static char mcastAddress[32];
+	static char mcastPort[16];
+
+	static void SetUpTestCase()
+	{
+		const char *pAddress = getenv("RSSL_SEQ_MCAST_TEST_ADDRESS");
+		const char *pPort = getenv("RSSL_SEQ_MCAST_TEST_PORT");
+		unsigned int pid = (unsigned int)getpid();
+
+		if (pAddress != NULL && *pAddress != '\0')
+			snprintf(mcastAddress, sizeof(mcastAddress), "%s", pAddress);
+		else
+			snprintf(mcastAddress, sizeof(mcastAddress), "239.255.%u.%u", (pid >> 8) & 0xff, (pid & 0xff) | 1);
+
+		if (pPort != NULL && *pPort != '\0')
+			snprintf(mcastPort, sizeof(mcastPort), "%s", pPort);
+		else
+			snprintf(mcastPort, sizeof(mcastPort), "%u", 30000 + pid % 20000);
+	}
+
+	virtual void SetUp()
+	{
+		pReadChannel = NULL;
+		pWriteChannel = NULL;
+		ASSERT_EQ(RSSL_RET_SUCCESS, rsslInitialize(RSSL_LOCK_NONE, &err));
+	}
+
+	virtual void TearDown()
+	{
+		if (pWriteChannel)
+			rsslCloseChannel(pWriteChannel, &err);
+		if (pReadChannel)
+			rsslCloseChannel(pReadChannel, &err);
+		rsslUninitialize();
+	}
+
+	RsslChannel *connect(RsslUInt32 readBatchSize, RsslUInt32 writeBatchSize)
+	{
+		RsslConnectOptions opts;
+
+		rsslClearConnectOpts(&opts);
+		opts.connectionType = RSSL_CONN_TYPE_SEQ_MCAST;
+		opts.blocking = RSSL_FALSE;
+		opts.connectionInfo.segmented.recvAddress = mcastAddress;
+		opts.connectionInfo.segmented.recvServiceName = mcastPort;
+		opts.connectionInfo.segmented.interfaceName = const_cast<char*>("127.0.0.1");
+		opts.seqMulticastOpts.readBatchSize = readBatchSize;
+		opts.seqMulticastOpts.writeBatchSize = writeBatchSize;
+
+		return rsslConnect(&opts, &err);
+	}
+};
+
+const int SeqMcastBatchTest::packetCount;
+char SeqMcastBatchTest::mcastAddress[32];
+char SeqMcastBatchTest::mcastPort[16];
+
+TEST_P(SeqMcastBatchTest, PacketsArriveInOrder)
+{
+	RsslChannelInfo info;
+	RsslRet ret;
+	int received = 0;
+	int idle = 0;
+
+	pReadChannel = connect(GetParam().readBatchSize, 1);
+	if (pReadChannel == NULL)
+	{
+		/* Hosts without a multicast route cannot run this test. */
+		TU_SKIP(err.text);
+	}
+	ASSERT_TRUE((pWriteChannel = connect(1, GetParam().writeBatchSize)) != NULL) << err.text;
+
+	for (int i = 0; i < packetCount; ++i)
+	{
+		RsslWriteInArgs writeInArgs;
+		RsslWriteOutArgs writeOutArgs;
+		RsslBuffer *pBuffer;
+
+		ASSERT_TRUE((pBuffer = rsslGetBuffer(pWriteChannel, 32, RSSL_FALSE, &err)) != NULL) << err.text;
+		pBuffer->length = snprintf(pBuffer->data, 32, "packet %d", i);
+
+		rsslClearWriteInArgs(&writeInArgs);
+		rsslClearWriteOutArgs(&writeOutArgs);
+		ret = rsslWriteEx(pWriteChannel, pBuffer, &writeInArgs, &writeOutArgs, &err);
+		ASSERT_GE(ret, RSSL_RET_SUCCESS) << err.text;
+
+		/* Packets are queued until the batch is full. */
+		if (GetParam().writeBatchSize > 1 && (i + 1) % GetParam().writeBatchSize != 0)
+		{
+			ASSERT_GT(ret, RSSL_RET_SUCCESS);
+		}
+		else
+		{
+			ASSERT_EQ(RSSL_RET_SUCCESS, ret);
+		}
+
+		/* Keeps the socket receive buffer from overflowing. */
+		if (i % 50 == 49)
+			usleep(1000);
+	}
+
+	ASSERT_EQ(RSSL_RET_SUCCESS, rsslFlush(pWriteChannel, &err));
+
+	while (received < packetCount && idle < 100)
+	{
+		RsslReadInArgs readInArgs;
+		RsslReadOutArgs readOutArgs;
+		RsslBuffer *pBuffer;
+
+		rsslClearReadInArgs(&readInArgs);
+		rsslClearReadOutArgs(&readOutArgs);
+		if ((pBuffer = rsslReadEx(pReadChannel, &readInArgs, &readOutArgs, &ret, &err)) != NULL)
+		{
+			char expected[32];
+
+			snprintf(expected, sizeof(expected), "packet %d", received);
+			ASSERT_EQ(strlen(expected), pBuffer->length);
+			ASSERT_EQ(0, memcmp(expected, pBuffer->data, pBuffer->length));
+			ASSERT_EQ((RsslUInt32)received + 1, readOutArgs.seqNum);
+			++received;
+			idle = 0;
+		}
+		else if (ret == RSSL_RET_READ_WOULD_BLOCK)
+		{
+			++idle;
+			usleep(10000);
+		}
+		else
+		{
+			ASSERT_GT(ret, RSSL_RET_FAILURE) << err.text;
+		}
+	}
+
+	ASSERT_EQ(packetCount, received);
+
+	ASSERT_EQ(RSSL_RET_SUCCESS, rsslGetChannelInfo(pWriteChannel, &info, &err));
+	ASSERT_EQ((RsslUInt64)packetCount, info.multicastStats.mcastSent);
+	ASSERT_EQ((RsslUInt64)(packetCount + GetParam().writeBatchSize - 1) / GetParam().writeBatchSize, info.multicastStats.mcastSendCalls);
+
+	ASSERT_EQ(RSSL_RET_SUCCESS, rsslGetChannelInfo(pReadChannel, &info, &err));
+	ASSERT_EQ((RsslUInt64)packetCount, info.multicastStats.mcastRcvd);
+	ASSERT_GE(info.multicastStats.mcastRcvdCalls, (RsslUInt64)1);
+	ASSERT_LE(info.multicastStats.mcastRcvdCalls, info.multicastStats.mcastRcvd);
+	if (GetParam().readBatchSize <= 1)
+	{
+		ASSERT_EQ(info.multicastStats.mcastRcvd, info.multicastStats.mcastRcvdCalls);
+	}
+}
+
+TEST_P(SeqMcastBatchTest, QueuedPacketsAreSentBeforePing)
+{
+	RsslChannelInfo info;
+	RsslWriteInArgs writeInArgs;
+	RsslWriteOutArgs writeOutArgs;
+	RsslBuffer *pBuffer;
+
+	if (GetParam().writeBatchSize <= 1)
+		TU_SKIP("nothing is queued without write batching");
+
+	if ((pWriteChannel = connect(1, GetParam().writeBatchSize)) == NULL)
+		TU_SKIP(err.text);
+
+	ASSERT_TRUE((pBuffer = rsslGetBuffer(pWriteChannel, 32, RSSL_FALSE, &err)) != NULL) << err.text;
+	pBuffer->length = snprintf(pBuffer->data, 32, "queued");
+	rsslClearWriteInArgs(&writeInArgs);
+	rsslClearWriteOutArgs(&writeOutArgs);
+	ASSERT_GT(rsslWriteEx(pWriteChannel, pBuffer, &writeInArgs, &writeOutArgs, &err), RSSL_RET_SUCCESS);
+
+	ASSERT_EQ(RSSL_RET_SUCCESS, rsslGetChannelInfo(pWriteChannel, &info, &err));
+	ASSERT_EQ((RsslUInt64)0, info.multicastStats.mcastSent);
+
+	/* The ping carries the last sequence number, so the queued packet goes first. */
+	ASSERT_EQ(RSSL_RET_SUCCESS, rsslPing(pWriteChannel, &err));
+	ASSERT_EQ(RSSL_RET_SUCCESS, rsslGetChannelInfo(pWriteChannel, &info, &err));
+	ASSERT_EQ((RsslUInt64)2, info.multicastStats.mcastSent);
+	ASSERT_EQ((RsslUInt64)2, info.multicastStats.mcastSendCalls);
+}
+
+static const SeqMcastBatchParams batchParams[] =
+{
+	{ 1, 1 },
+	{ 32, 1 },
+	{ 1, 8 },
+	{ 32, 8 },
+	{ 5, 64 }
+};
+
+INSTANTIATE_TEST_CASE_P(BatchSizes, SeqMcastBatchTest, ::testing::ValuesIn(batchParams));
+
+#endif
@@ -0,0 +1,169 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2022 Refinitiv. All rights reserved.              --
+ *|-----------------------------------------------------------------------------
+ */
+
+/************************************************************************
+*	 RsslTimerWheel Unit Tests
+*
+*   Checks that timers expire exactly when their time is reached, across
+*   all levels of the wheel, and that the next expire time never lets the
+*   caller sleep past a timer.
+*
+/**********************************************************************/
+
+#include "gtest/gtest.h"
+
+#include "rtr/rsslTimerWheel.h"
+
+#include <stdlib.h>
+#include <vector>
+
+class TimerWheelTest : public ::testing::Test {
+protected:
+	RsslTimerWheel wheel;
+
+	virtual void SetUp()
+	{
+		rsslTimerWheelInit(&wheel, 1000);
+	}
+
+	/* Advances the wheel and returns the expired timers, in the order popped. */
+	std::vector<RsslTimerWheelTimer*> advance(RsslInt64 currentTime)
+	{
+		std::vector<RsslTimerWheelTimer*> expired;
+		RsslTimerWheelTimer *pTimer;
+
+		rsslTimerWheelAdvance(&wheel, currentTime);
+		while ((pTimer = rsslTimerWheelPopExpired(&wheel)))
+			expired.push_back(pTimer);
+
+		return expired;
+	}
+};
+
+TEST_F(TimerWheelTest, ExpiresOnTime)
+{
+	RsslTimerWheelTimer timer;
+
+	rsslTimerWheelTimerInit(&timer, NULL);
+	rsslTimerWheelAdd(&wheel, &timer, 1010);
+	ASSERT_TRUE(rsslTimerWheelTimerIsSet(&timer));
+	ASSERT_EQ(1010, rsslTimerWheelNextExpireTime(&wheel));
+
+	ASSERT_EQ(0u, advance(1009).size());
+	ASSERT_EQ(1u, advance(1010).size());
+	ASSERT_FALSE(rsslTimerWheelTimerIsSet(&timer));
+	ASSERT_EQ(0u, wheel.timerCount);
+	ASSERT_EQ(RSSL_TIMER_WHEEL_UNSET, rsslTimerWheelNextExpireTime(&wheel));
+}
+
+TEST_F(TimerWheelTest, PastTimerExpiresImmediately)
+{
+	RsslTimerWheelTimer timer;
+
+	rsslTimerWheelTimerInit(&timer, NULL);
+	rsslTimerWheelAdd(&wheel, &timer, 500);
+	ASSERT_EQ(1000, rsslTimerWheelNextExpireTime(&wheel));
+	ASSERT_EQ(&timer, rsslTimerWheelPopExpired(&wheel));
+	ASSERT_TRUE(rsslTimerWheelPopExpired(&wheel) == NULL);
+}
+
+TEST_F(TimerWheelTest, CancelAndReset)
+{
+	RsslTimerWheelTimer timer1, timer2;
+
+	rsslTimerWheelTimerInit(&timer1, NULL);
+	rsslTimerWheelTimerInit(&timer2, NULL);
+
+	/* Far enough to be on a higher level. */
+	rsslTimerWheelAdd(&wheel, &timer1, 1000 + 100000);
+	rsslTimerWheelAdd(&wheel, &timer2, 1000 + 100000);
+	rsslTimerWheelCancel(&wheel, &timer1);
+	rsslTimerWheelCancel(&wheel, &timer1);
+	ASSERT_FALSE(rsslTimerWheelTimerIsSet(&timer1));
+	ASSERT_EQ(1u, wheel.timerCount);
+
+	/* Setting a timer again moves it. */
+	rsslTimerWheelAdd(&wheel, &timer2, 1020);
+	ASSERT_EQ(1u, wheel.timerCount);
+	ASSERT_EQ(1020, rsslTimerWheelNextExpireTime(&wheel));
+
+	std::vector<RsslTimerWheelTimer*> expired = advance(1000 + 200000);
+	ASSERT_EQ(1u, expired.size());
+	ASSERT_EQ(&timer2, expired[0]);
+	ASSERT_EQ(RSSL_TIMER_WHEEL_UNSET, rsslTimerWheelNextExpireTime(&wheel));
+}
+
+TEST_F(TimerWheelTest, OverflowTimer)
+{
+	RsslTimerWheelTimer timer;
+	RsslInt64 expireTime = 1000 + ((RsslInt64)1 << (RSSL_TIMER_WHEEL_LEVELS * RSSL_TIMER_WHEEL_SLOT_BITS + 2));
+
+	rsslTimerWheelTimerInit(&timer, NULL);
+	rsslTimerWheelAdd(&wheel, &timer, expireTime);
+
+	ASSERT_EQ(0u, advance(expireTime - 1).size());
+	ASSERT_EQ(1u, advance(expireTime).size());
+}
+
+/* Compares the wheel with a list of expire times, advancing by random steps. */
+TEST_F(TimerWheelTest, MatchesBruteForce)
+{
+	static const int timerCount = 2000;
+	static const RsslInt64 ranges[] = { 50, 5000, 500000, 50000000 };
+	RsslTimerWheelTimer timers[timerCount];
+	RsslInt64 expireTimes[timerCount];
+	RsslInt64 currentTime = 1000;
+
+	srand(12345);
+
+	for (int i = 0; i < timerCount; ++i)
+	{
+		rsslTimerWheelTimerInit(&timers[i], NULL);
+		expireTimes[i] = -1;
+	}
+
+	for (int step = 0; step < 20000; ++step)
+	{
+		RsslInt64 nextExpireTime, earliest = RSSL_TIMER_WHEEL_UNSET;
+		int i = rand() % timerCount;
+
+		/* Set, reset or cancel a timer. */
+		if (rand() % 4 == 0)
+		{
+			rsslTimerWheelCancel(&wheel, &timers[i]);
+			expireTimes[i] = -1;
+		}
+		else
+		{
+			expireTimes[i] = currentTime + rand() % ranges[rand() % 4];
+			rsslTimerWheelAdd(&wheel, &timers[i], expireTimes[i]);
+		}
+
+		for (int j = 0; j < timerCount; ++j)
+			if (expireTimes[j] >= 0 && expireTimes[j] < earliest) earliest = expireTimes[j];
+
+		/* The next expire time may be early, but never late. */
+		nextExpireTime = rsslTimerWheelNextExpireTime(&wheel);
+		ASSERT_LE(nextExpireTime, earliest);
+
+		/* Sometimes jump straight to the next expire time, as a reactor would. */
+		currentTime = (rand() % 2 && nextExpireTime != RSSL_TIMER_WHEEL_UNSET) ? nextExpireTime : currentTime + rand() % 3000;
+
+		std::vector<RsslTimerWheelTimer*> expired = advance(currentTime);
+		for (size_t k = 0; k < expired.size(); ++k)
+		{
+			int index = (int)(expired[k] - timers);
+			ASSERT_GE(expireTimes[index], 0);
+			ASSERT_LE(expireTimes[index], currentTime);
+			expireTimes[index] = -1;
+		}
+
+		for (int j = 0; j < timerCount; ++j)
+			ASSERT_TRUE(expireTimes[j] < 0 || expireTimes[j] > currentTime);
+	}
+}
@@ -0,0 +1,284 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2022 Refinitiv. All rights reserved.              --
+ *|-----------------------------------------------------------------------------
+ */
+
+/************************************************************************
+*	 Binary Trace Capture Unit Tests
+*
+*   Writes messages through a binary capture, as RSSL_TRACE_BINARY does,
+*   and reads them back with rsslOpenCaptureFile() and
+*   rsslReadCaptureRecord(), including captures that wrap the ring and
+*   fill their file.
+*
+/**********************************************************************/
+
+#include "gtest/gtest.h"
+
+#include "rtr/rsslTransport.h"
+#include "rtr/rsslIterators.h"
+#include "rtr/rsslTraceCapture.h"
+#include "xmlDump.h"
+
+#include <stdio.h>
+#include <string.h>
+
+extern void time_sleep(int millisec);
+
+class TraceCaptureTest : public ::testing::Test {
+protected:
+	RsslError err;
+
+	/* Files started when the first one is full are named from the base name and the time in milliseconds,
+	 * so the tests look for them between the times the capture was opened and closed. */
+	unsigned long long openedMsec, closedMsec;
+
+	virtual void SetUp()
+	{
+		remove("traceCaptureTest.rwfcap");
+		openedMsec = closedMsec = 0;
+	}
+
+	virtual void TearDown()
+	{
+		char fileName[64];
+
+		remove("traceCaptureTest.rwfcap");
+		for (unsigned long long msec = openedMsec; msec <= closedMsec; ++msec)
+		{
+			rotatedFileName(fileName, msec);
+			remove(fileName);
+		}
+	}
+
+	static unsigned long long nowMsec()
+	{
+		unsigned long long hour, min, sec, msec;
+
+		xmlGetTimeFromEpoch(&hour, &min, &sec, &msec);
+		return msec;
+	}
+
+	static void rotatedFileName(char *fileName, unsigned long long msec)
+	{
+		snprintf(fileName, 64, "traceCaptureRotated%03llu.rwfcap", msec);
+	}
+
+	rsslTraceCapture *openCapture(RsslUInt32 maxFileSize, RsslBool multipleFiles)
+	{
+		openedMsec = nowMsec();
+		return rsslTraceCaptureOpen("traceCaptureTest.rwfcap", "traceCaptureRotated", maxFileSize, multipleFiles, &err);
+	}
+
+	void closeCapture(rsslTraceCapture *pCapture)
+	{
+		rsslTraceCaptureClose(pCapture);
+		closedMsec = nowMsec();
+	}
+
+	void writeMessage(rsslTraceCapture *pCapture, RsslUInt8 direction, RsslUInt32 sequence, RsslUInt32 length)
+	{
+		char data[1024];
+		RsslBuffer buffer = { length, data };
+
+		memset(data, (char)sequence, sizeof(data));
+		memcpy(data, &sequence, sizeof(sequence));
+		rsslTraceCaptureWrite(pCapture, 42, direction, RSSL_RWF_PROTOCOL_TYPE, RSSL_RWF_MAJOR_VERSION, RSSL_RWF_MINOR_VERSION, &buffer);
+	}
+
+	/* Returns the number of records in the file, or -1 if it cannot be read. */
+	int countRecords(const char *fileName)
+	{
+		RsslCaptureFile *pFile;
+		RsslRet ret;
+		int count = 0;
+
+		if ((pFile = rsslOpenCaptureFile(fileName, &err)) == NULL)
+			return -1;
+
+		while (rsslReadCaptureRecord(pFile, &ret, &err) != NULL)
+			++count;
+
+		rsslCloseCaptureFile(pFile);
+		return (ret == RSSL_RET_SUCCESS) ? count : -1;
+	}
+
+	int countRotatedRecords()
+	{
+		char fileName[64];
+		int count = 0;
+
+		for (unsigned long long msec = openedMsec; msec <= closedMsec; ++msec)
+		{
+			int fileCount;
+
+			rotatedFileName(fileName, msec);
+			if ((fileCount = countRecords(fileName)) > 0)
+				count += fileCount;
+		}
+
+		return count;
+	}
+
+	/* Waits up to five seconds for the writer thread to put the given number of records in the file. */
+	bool waitForRecords(int count)
+	{
+		for (int i = 0; i < 500; ++i)
+		{
+			if (countRecords("traceCaptureTest.rwfcap") >= count)
+				return true;
+			time_sleep(10);
+		}
+
+		return false;
+	}
+};
+
+TEST_F(TraceCaptureTest, WrittenMessagesReadBack)
+{
+	rsslTraceCapture *pCapture;
+	RsslCaptureFile *pFile;
+	RsslCaptureRecord *pRecord;
+	RsslUInt8 directions[3] = { RSSL_CAPTURE_READ, RSSL_CAPTURE_WRITE, RSSL_CAPTURE_PACK };
+	RsslRet ret;
+
+	ASSERT_TRUE((pCapture = openCapture(100000000, RSSL_FALSE)) != NULL) << err.text;
+	for (RsslUInt32 i = 0; i < 3; ++i)
+		writeMessage(pCapture, directions[i], i, 100 + i);
+	closeCapture(pCapture);
+
+	ASSERT_TRUE((pFile = rsslOpenCaptureFile("traceCaptureTest.rwfcap", &err)) != NULL) << err.text;
+
+	for (RsslUInt32 i = 0; i < 3; ++i)
+	{
+		RsslUInt32 sequence;
+
+		ASSERT_TRUE((pRecord = rsslReadCaptureRecord(pFile, &ret, &err)) != NULL) << err.text;
+		ASSERT_EQ(RSSL_RET_SUCCESS, ret);
+		EXPECT_EQ(directions[i], pRecord->direction);
+		EXPECT_EQ((RsslUInt64)42, pRecord->channelId);
+		EXPECT_EQ(RSSL_RWF_PROTOCOL_TYPE, pRecord->protocolType);
+		EXPECT_EQ(RSSL_RWF_MAJOR_VERSION, pRecord->majorVersion);
+		EXPECT_EQ(RSSL_RWF_MINOR_VERSION, pRecord->minorVersion);
+		EXPECT_NE((RsslUInt64)0, pRecord->timestamp);
+		ASSERT_EQ(100 + i, pRecord->data.length);
+		memcpy(&sequence, pRecord->data.data, sizeof(sequence));
+		EXPECT_EQ(i, sequence);
+		EXPECT_EQ((char)i, pRecord->data.data[pRecord->data.length - 1]);
+	}
+
+	/* The end of the file is not an error. */
+	ASSERT_TRUE(rsslReadCaptureRecord(pFile, &ret, &err) == NULL);
+	ASSERT_EQ(RSSL_RET_SUCCESS, ret);
+	rsslCloseCaptureFile(pFile);
+}
+
+TEST_F(TraceCaptureTest, MessagesWrapTheRing)
+{
+	/* Each pass fills half of the ring, so the third pass wraps it. */
+	const int passMessages = RSSL_TRACE_CAPTURE_RING_SIZE / 2 / 1000;
+	rsslTraceCapture *pCapture;
+	RsslCaptureFile *pFile;
+	RsslCaptureRecord *pRecord;
+	RsslUInt32 sequence = 0, lastSequence = 0;
+	RsslRet ret;
+
+	ASSERT_TRUE((pCapture = openCapture(0x7FFFFFFF, RSSL_FALSE)) != NULL) << err.text;
+	for (int pass = 1; pass <= 3; ++pass)
+	{
+		for (int i = 0; i < passMessages; ++i)
+			writeMessage(pCapture, RSSL_CAPTURE_WRITE, ++sequence, 1000 - RSSL_CAPTURE_RECORD_HEADER_SIZE);
+
+		/* The idle writer thread is woken by the first message of each pass. */
+		ASSERT_TRUE(waitForRecords(pass * passMessages));
+	}
+	closeCapture(pCapture);
+
+	ASSERT_TRUE((pFile = rsslOpenCaptureFile("traceCaptureTest.rwfcap", &err)) != NULL) << err.text;
+	while ((pRecord = rsslReadCaptureRecord(pFile, &ret, &err)) != NULL)
+	{
+		RsslUInt32 recordSequence;
+
+		ASSERT_EQ(RSSL_CAPTURE_WRITE, pRecord->direction);
+		ASSERT_EQ((RsslUInt32)(1000 - RSSL_CAPTURE_RECORD_HEADER_SIZE), pRecord->data.length);
+		memcpy(&recordSequence, pRecord->data.data, sizeof(recordSequence));
+		ASSERT_EQ(lastSequence + 1, recordSequence);
+		lastSequence = recordSequence;
+	}
+	ASSERT_EQ(RSSL_RET_SUCCESS, ret) << err.text;
+	rsslCloseCaptureFile(pFile);
+
+	ASSERT_EQ(sequence, lastSequence);
+}
+
+TEST_F(TraceCaptureTest, FullRingCountsDroppedMessages)
+{
+	const RsslUInt32 messageCount = 3 * RSSL_TRACE_CAPTURE_RING_SIZE / 1000;
+	rsslTraceCapture *pCapture;
+	RsslCaptureFile *pFile;
+	RsslCaptureRecord *pRecord;
+	RsslUInt32 messages = 0, dropped = 0, lastSequence = 0;
+	RsslRet ret;
+
+	ASSERT_TRUE((pCapture = openCapture(0x7FFFFFFF, RSSL_FALSE)) != NULL) << err.text;
+	for (RsslUInt32 i = 1; i <= messageCount; ++i)
+		writeMessage(pCapture, RSSL_CAPTURE_WRITE, i, 1000 - RSSL_CAPTURE_RECORD_HEADER_SIZE);
+	closeCapture(pCapture);
+
+	/* Messages that did not fit in the ring are counted instead. */
+	ASSERT_TRUE((pFile = rsslOpenCaptureFile("traceCaptureTest.rwfcap", &err)) != NULL) << err.text;
+	while ((pRecord = rsslReadCaptureRecord(pFile, &ret, &err)) != NULL)
+	{
+		if (pRecord->direction == RSSL_CAPTURE_DROPPED)
+		{
+			ASSERT_EQ((RsslUInt32)4, pRecord->data.length);
+			dropped += ((RsslUInt32)(unsigned char)pRecord->data.data[0] << 24) | ((RsslUInt32)(unsigned char)pRecord->data.data[1] << 16)
+				| ((RsslUInt32)(unsigned char)pRecord->data.data[2] << 8) | (RsslUInt32)(unsigned char)pRecord->data.data[3];
+		}
+		else
+		{
+			RsslUInt32 sequence;
+
+			ASSERT_EQ((RsslUInt32)(1000 - RSSL_CAPTURE_RECORD_HEADER_SIZE), pRecord->data.length);
+			memcpy(&sequence, pRecord->data.data, sizeof(sequence));
+			ASSERT_GT(sequence, lastSequence);
+			lastSequence = sequence;
+			++messages;
+		}
+	}
+	ASSERT_EQ(RSSL_RET_SUCCESS, ret) << err.text;
+	rsslCloseCaptureFile(pFile);
+
+	ASSERT_GT(messages, (RsslUInt32)0);
+	ASSERT_EQ(messageCount, messages + dropped);
+}
+
+TEST_F(TraceCaptureTest, FullFileStartsNextFile)
+{
+	rsslTraceCapture *pCapture;
+
+	/* Room for the file header and two records. */
+	ASSERT_TRUE((pCapture = openCapture(RSSL_CAPTURE_FILE_HEADER_SIZE + 2 * (RSSL_CAPTURE_RECORD_HEADER_SIZE + 100), RSSL_TRUE)) != NULL) << err.text;
+	for (RsslUInt32 i = 0; i < 5; ++i)
+		writeMessage(pCapture, RSSL_CAPTURE_WRITE, i, 100);
+	closeCapture(pCapture);
+
+	ASSERT_EQ(2, countRecords("traceCaptureTest.rwfcap"));
+	ASSERT_EQ(3, countRotatedRecords());
+}
+
+TEST_F(TraceCaptureTest, FullFileDiscardsMessages)
+{
+	rsslTraceCapture *pCapture;
+
+	ASSERT_TRUE((pCapture = openCapture(RSSL_CAPTURE_FILE_HEADER_SIZE + 2 * (RSSL_CAPTURE_RECORD_HEADER_SIZE + 100), RSSL_FALSE)) != NULL) << err.text;
+	for (RsslUInt32 i = 0; i < 5; ++i)
+		writeMessage(pCapture, RSSL_CAPTURE_WRITE, i, 100);
+	closeCapture(pCapture);
+
+	ASSERT_EQ(2, countRecords("traceCaptureTest.rwfcap"));
+	ASSERT_EQ(0, countRotatedRecords());
+}
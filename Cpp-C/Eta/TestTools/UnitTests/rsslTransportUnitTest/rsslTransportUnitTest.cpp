@@ -3084,6 +3084,226 @@ TEST_F(BindSharedServerSocketOpt, ServerSharedSocketShouldBeErrorOnRsslBindLUP)
 
 #endif
 
+class SharedPoolThreadCacheTests : public ::testing::Test {
+protected:
+	RsslChannel* serverChannel;
+	RsslChannel* clientChannel;
+	RsslServer* server;
+	RsslError err;
+
+	static const int threadCount = 4;
+	static const int buffersPerBatch = 8;
+	static const int batchCount = 2000;
+
+	/* Large enough that each buffer takes a whole pool buffer, rather than being packed with others. */
+	static const int bufferSize = 5000;
+
+	virtual void SetUp()
+	{
+		shutdownTest = false;
+		failTest = false;
+		server = NULL;
+		serverChannel = NULL;
+		clientChannel = NULL;
+		buffersCached = false;
+		releaseIdleThread = false;
+
+		rsslInitialize(RSSL_LOCK_GLOBAL_AND_CHANNEL, &err);
+	}
+
+	virtual void TearDown()
+	{
+		if (serverChannel)
+			rsslCloseChannel(serverChannel, &err);
+		if (clientChannel)
+			rsslCloseChannel(clientChannel, &err);
+		if (server)
+			rsslCloseServer(server, &err);
+		rsslUninitialize();
+		server = NULL;
+		serverChannel = NULL;
+		clientChannel = NULL;
+		resetDeadlockTimer();
+	}
+
+	/* Binds with few guaranteed buffers, so the server channel gets most of its buffers from the shared pool. */
+	void startupServerAndConnections(RsslUInt32 threadCacheSize, RsslUInt32 sharedPoolSize = 1000)
+	{
+		RsslThreadId serverThread, clientThread;
+		ClientChannel clientOpts;
+		ServerChannel serverChnl;
+		RsslBindOptions bindOpts;
+
+		rsslClearBindOpts(&bindOpts);
+		bindOpts.serviceName = (char*)"15000";
+		bindOpts.protocolType = TEST_PROTOCOL_TYPE;
+		bindOpts.channelsBlocking = RSSL_FALSE;
+		bindOpts.serverBlocking = RSSL_FALSE;
+		bindOpts.guaranteedOutputBuffers = 2;
+		bindOpts.maxOutputBuffers = sharedPoolSize + 2;
+		bindOpts.sharedPoolSize = sharedPoolSize;
+		bindOpts.sharedPoolLock = RSSL_TRUE;
+		bindOpts.sharedPoolThreadCacheSize = threadCacheSize;
+
+		server = rsslBind(&bindOpts, &err);
+		ASSERT_NE(server, (RsslServer*)NULL) << "Server creation failed! " << err.text;
+
+		serverChnl.pThreadId = &serverThread;
+		serverChnl.pServer = server;
+		clientOpts.pThreadId = &clientThread;
+
+		RSSL_THREAD_START(&serverThread, nonBlockingServerConnectThread, &serverChnl);
+		RSSL_THREAD_START(&clientThread, nonBlockingClientConnectThread, &clientOpts);
+		RSSL_THREAD_JOIN(serverThread);
+		RSSL_THREAD_JOIN(clientThread);
+
+		serverChannel = serverChnl.pChnl;
+		clientChannel = clientOpts.pChnl;
+
+		if (!serverChannel || !clientChannel || serverChannel->state != RSSL_CH_STATE_ACTIVE || clientChannel->state != RSSL_CH_STATE_ACTIVE)
+		{
+			ASSERT_TRUE(false) << "Channel creation failed!";
+		}
+	}
+
+public:
+	volatile bool buffersCached;
+	volatile bool releaseIdleThread;
+
+	/* Gets and releases batches of buffers on the server channel. */
+	void getAndReleaseBuffers(int batches = batchCount)
+	{
+		RsslBuffer* buffers[buffersPerBatch];
+		RsslError threadErr;
+		int i, j;
+
+		for (i = 0; i < batches && !failTest; ++i)
+		{
+			for (j = 0; j < buffersPerBatch; ++j)
+			{
+				buffers[j] = rsslGetBuffer(serverChannel, bufferSize, RSSL_FALSE, &threadErr);
+				if (buffers[j] == NULL)
+				{
+					failTest = true;
+					ASSERT_NE(buffers[j], (RsslBuffer*)NULL) << "rsslGetBuffer failed. Error info: " << threadErr.text;
+				}
+				buffers[j]->data[0] = (char)j;
+			}
+
+			for (j = 0; j < buffersPerBatch; ++j)
+				rsslReleaseBuffer(buffers[j], &threadErr);
+		}
+	}
+};
+
+RSSL_THREAD_DECLARE(sharedPoolBufferThread, pArg)
+{
+	((SharedPoolThreadCacheTests*)pArg)->getAndReleaseBuffers();
+	return 0;
+}
+
+/* Leaves buffers in its cache, then stays idle until the test releases it. */
+RSSL_THREAD_DECLARE(sharedPoolIdleThread, pArg)
+{
+	SharedPoolThreadCacheTests *pTest = (SharedPoolThreadCacheTests*)pArg;
+
+	pTest->getAndReleaseBuffers(1);
+	pTest->buffersCached = true;
+	while (!pTest->releaseIdleThread)
+		time_sleep(1);
+	return 0;
+}
+
+TEST_F(SharedPoolThreadCacheTests, CachesDisabledByDefault)
+{
+	RsslServerInfo serverInfo;
+
+	startupServerAndConnections(0);
+	getAndReleaseBuffers();
+	ASSERT_FALSE(failTest);
+
+	ASSERT_EQ(rsslGetServerInfo(server, &serverInfo, &err), RSSL_RET_SUCCESS) << err.text;
+	EXPECT_GT(serverInfo.peakBufferUsage, 0u);
+	EXPECT_EQ(serverInfo.threadCacheHits, 0u);
+	EXPECT_EQ(serverInfo.threadCacheMisses, 0u);
+}
+
+TEST_F(SharedPoolThreadCacheTests, ManyThreadsGetBuffersFromCaches)
+{
+	RsslThreadId threadIds[threadCount];
+	RsslServerInfo serverInfo;
+	int i;
+
+	startupServerAndConnections(32);
+
+	for (i = 0; i < threadCount; ++i)
+		RSSL_THREAD_START(&threadIds[i], sharedPoolBufferThread, (void*)this);
+	for (i = 0; i < threadCount; ++i)
+		RSSL_THREAD_JOIN(threadIds[i]);
+
+	ASSERT_FALSE(failTest) << "Test Failed!";
+
+	ASSERT_EQ(rsslGetServerInfo(server, &serverInfo, &err), RSSL_RET_SUCCESS) << err.text;
+	EXPECT_GT(serverInfo.threadCacheMisses, 0u);
+
+	/* Each thread refills its cache at most once every few batches. */
+	EXPECT_GT(serverInfo.threadCacheHits, serverInfo.threadCacheMisses);
+	EXPECT_LE(serverInfo.peakBufferUsage, 1000u);
+}
+
+TEST_F(SharedPoolThreadCacheTests, ExitingThreadReturnsCachedBuffers)
+{
+	RsslThreadId threadId;
+	RsslServerInfo serverInfo;
+
+	startupServerAndConnections(32);
+
+	RSSL_THREAD_START(&threadId, sharedPoolBufferThread, (void*)this);
+	RSSL_THREAD_JOIN(threadId);
+	ASSERT_FALSE(failTest) << "Test Failed!";
+
+	/* The thread's cache was returned to the pool when it exited, and its hits are still counted. */
+	ASSERT_EQ(rsslGetServerInfo(server, &serverInfo, &err), RSSL_RET_SUCCESS) << err.text;
+	EXPECT_EQ(serverInfo.currentBufferUsage, 0u);
+	EXPECT_GT(serverInfo.peakBufferUsage, 0u);
+	EXPECT_GT(serverInfo.threadCacheHits, 0u);
+}
+
+TEST_F(SharedPoolThreadCacheTests, EmptyPoolTakesBuffersFromIdleThreads)
+{
+	RsslThreadId threadId;
+	RsslServerInfo serverInfo;
+	RsslBuffer* buffers[buffersPerBatch];
+	int j;
+
+	/* The idle thread's first refill takes half of its cache size, which is the whole pool. */
+	startupServerAndConnections(32, 16);
+
+	RSSL_THREAD_START(&threadId, sharedPoolIdleThread, (void*)this);
+	while (!buffersCached)
+		time_sleep(1);
+	ASSERT_FALSE(failTest) << "Test Failed!";
+
+	ASSERT_EQ(rsslGetServerInfo(server, &serverInfo, &err), RSSL_RET_SUCCESS) << err.text;
+	EXPECT_EQ(serverInfo.currentBufferUsage, 16u);
+
+	/* This thread finds the pool empty, and takes the buffers back from the idle thread's cache. */
+	for (j = 0; j < buffersPerBatch; ++j)
+	{
+		buffers[j] = rsslGetBuffer(serverChannel, bufferSize, RSSL_FALSE, &err);
+		EXPECT_NE(buffers[j], (RsslBuffer*)NULL) << "rsslGetBuffer failed. Error info: " << err.text;
+	}
+
+	for (j = 0; j < buffersPerBatch; ++j)
+	{
+		if (buffers[j])
+			rsslReleaseBuffer(buffers[j], &err);
+	}
+
+	releaseIdleThread = true;
+	RSSL_THREAD_JOIN(threadId);
+}
+
 rsslServerCountersInfo* rsslGetServerCountersInfo(RsslServer* pServer)
 {
 	rsslServerImpl *srvrImpl = (rsslServerImpl *)pServer;
@@ -0,0 +1,181 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2022 Refinitiv. All rights reserved.              --
+ *|-----------------------------------------------------------------------------
+ */
+
+/************************************************************************
+*	 io_uring I/O Engine Unit Tests
+*
+*   Exchanges messages over a loopback socket connection that reads and
+*   writes through io_uring, and checks how a failed io_uring_enter() and
+*   closing the channels affect the calling thread's ring.
+*
+/**********************************************************************/
+
+#include "gtest/gtest.h"
+
+#include "rtr/rsslTransport.h"
+#include "rtr/ripcuring.h"
+#include "TransportUnitTest.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#ifdef RIPC_HAS_IO_URING
+
+#include <errno.h>
+
+class UringTest : public ::testing::Test {
+protected:
+	RsslServer *pServer;
+	RsslChannel *pClientChannel;
+	RsslChannel *pServerChannel;
+	RsslError err;
+
+	virtual void SetUp()
+	{
+		pServer = NULL;
+		pClientChannel = NULL;
+		pServerChannel = NULL;
+		ASSERT_EQ(RSSL_RET_SUCCESS, rsslInitialize(RSSL_LOCK_NONE, &err));
+	}
+
+	virtual void TearDown()
+	{
+		ipcUringSetEnterError(0);
+		closeChannels();
+		if (pServer)
+			rsslCloseServer(pServer, &err);
+		rsslUninitialize();
+	}
+
+	void closeChannels()
+	{
+		if (pClientChannel)
+			rsslCloseChannel(pClientChannel, &err);
+		if (pServerChannel)
+			rsslCloseChannel(pServerChannel, &err);
+		pClientChannel = NULL;
+		pServerChannel = NULL;
+	}
+
+	/* Connects a client that uses io_uring to a server that does not. */
+	void connect()
+	{
+		RsslBindOptions bindOpts;
+		RsslConnectOptions connectOpts;
+		RsslAcceptOptions acceptOpts;
+		RsslInProgInfo inProg;
+		int tries = 0;
+
+		if (!pServer)
+		{
+			rsslClearBindOpts(&bindOpts);
+			bindOpts.serviceName = const_cast<char*>("15012");
+			ASSERT_TRUE((pServer = rsslBind(&bindOpts, &err)) != NULL) << err.text;
+		}
+
+		rsslClearConnectOpts(&connectOpts);
+		connectOpts.connectionInfo.unified.address = const_cast<char*>("localhost");
+		connectOpts.connectionInfo.unified.serviceName = const_cast<char*>("15012");
+		connectOpts.tcpOpts.ioEngine = RSSL_IO_ENGINE_URING;
+		connectOpts.blocking = RSSL_FALSE;
+		ASSERT_TRUE((pClientChannel = rsslConnect(&connectOpts, &err)) != NULL) << err.text;
+
+		rsslClearAcceptOpts(&acceptOpts);
+		while ((pServerChannel = rsslAccept(pServer, &acceptOpts, &err)) == NULL && tries++ < 1000)
+			;
+		ASSERT_TRUE(pServerChannel != NULL) << err.text;
+
+		for (tries = 0; tries < 100000; ++tries)
+		{
+			if (pClientChannel->state != RSSL_CH_STATE_ACTIVE)
+			{
+				ASSERT_GE(rsslInitChannel(pClientChannel, &inProg, &err), RSSL_RET_SUCCESS) << err.text;
+			}
+			if (pServerChannel->state != RSSL_CH_STATE_ACTIVE)
+			{
+				ASSERT_GE(rsslInitChannel(pServerChannel, &inProg, &err), RSSL_RET_SUCCESS) << err.text;
+			}
+			if (pClientChannel->state == RSSL_CH_STATE_ACTIVE && pServerChannel->state == RSSL_CH_STATE_ACTIVE)
+				break;
+		}
+		ASSERT_EQ(RSSL_CH_STATE_ACTIVE, pClientChannel->state);
+		ASSERT_EQ(RSSL_CH_STATE_ACTIVE, pServerChannel->state);
+	}
+
+	/* Writes a message from the server and reads it on the client. Returns the last read return code. */
+	RsslRet sendToClient(const char *pText)
+	{
+		RsslBuffer *pBuffer;
+		RsslRet ret;
+		RsslUInt32 bytes, uncompBytes;
+		int tries = 0;
+
+		pBuffer = rsslGetBuffer(pServerChannel, 64, RSSL_FALSE, &err);
+		EXPECT_TRUE(pBuffer != NULL) << err.text;
+		if (!pBuffer)
+			return RSSL_RET_FAILURE;
+		pBuffer->length = snprintf(pBuffer->data, 64, "%s", pText);
+		EXPECT_GE(rsslWrite(pServerChannel, pBuffer, RSSL_HIGH_PRIORITY, 0, &bytes, &uncompBytes, &err), RSSL_RET_SUCCESS) << err.text;
+		EXPECT_EQ(RSSL_RET_SUCCESS, rsslFlush(pServerChannel, &err)) << err.text;
+
+		do
+		{
+			if ((pBuffer = rsslRead(pClientChannel, &ret, &err)) != NULL)
+			{
+				EXPECT_EQ(strlen(pText), pBuffer->length);
+				EXPECT_EQ(0, memcmp(pText, pBuffer->data, pBuffer->length));
+				return RSSL_RET_SUCCESS;
+			}
+		} while (ret >= RSSL_RET_SUCCESS || (ret == RSSL_RET_READ_WOULD_BLOCK && tries++ < 100000));
+
+		return ret;
+	}
+};
+
+TEST_F(UringTest, FailedEnterWithdrawsEntry)
+{
+	if (!ipcUringAvailable())
+		TU_SKIP("io_uring is not supported by this kernel");
+
+	ASSERT_NO_FATAL_FAILURE(connect());
+	ASSERT_EQ(RSSL_RET_SUCCESS, sendToClient("first"));
+	ASSERT_EQ(0, ipcUringPendingEntries(RIPC_URING_INTERRUPT));
+
+	/* The read fails, and its entry is not left in the ring for the next submission to pick up. */
+	ipcUringSetEnterError(ENOMEM);
+	ASSERT_LT(sendToClient("second"), RSSL_RET_SUCCESS);
+	ASSERT_EQ(0, ipcUringPendingEntries(RIPC_URING_INTERRUPT));
+	ipcUringSetEnterError(0);
+
+	/* The thread reads through io_uring again on a new channel. */
+	closeChannels();
+	ASSERT_NO_FATAL_FAILURE(connect());
+	ASSERT_EQ(RSSL_RET_SUCCESS, sendToClient("third"));
+	ASSERT_EQ(0, ipcUringPendingEntries(RIPC_URING_INTERRUPT));
+}
+
+TEST_F(UringTest, RingsFreedWhenChannelsClose)
+{
+	if (!ipcUringAvailable())
+		TU_SKIP("io_uring is not supported by this kernel");
+
+	ASSERT_NO_FATAL_FAILURE(connect());
+	ASSERT_EQ(RSSL_RET_SUCCESS, sendToClient("first"));
+	ASSERT_EQ(0, ipcUringPendingEntries(RIPC_URING_INTERRUPT));
+
+	/* Closing the last io_uring channel frees the ring. */
+	closeChannels();
+	ASSERT_EQ(-1, ipcUringPendingEntries(RIPC_URING_INTERRUPT));
+
+	/* It is created again for the next channel. */
+	ASSERT_NO_FATAL_FAILURE(connect());
+	ASSERT_EQ(RSSL_RET_SUCCESS, sendToClient("second"));
+	ASSERT_EQ(0, ipcUringPendingEntries(RIPC_URING_INTERRUPT));
+}
+
+#endif
@@ -0,0 +1,96 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2022 Refinitiv. All rights reserved.              --
+ *|-----------------------------------------------------------------------------
+ */
+
+/************************************************************************
+*	 WebSocket Masking Unit Tests
+*
+*   Checks each masking kernel against the byte-by-byte definition in
+*   RFC 6455, for all tail lengths and buffer alignments.
+*
+/**********************************************************************/
+
+#include "gtest/gtest.h"
+
+#include "rtr/rwsmask.h"
+
+#include <stdlib.h>
+#include <vector>
+
+class WebSocketMaskTest : public ::testing::TestWithParam<rwsMaskKernel_t> {
+protected:
+	static const int maxLength = 300;
+	static const int maxOffset = 32;
+
+	char mask[4];
+	char src[maxLength + maxOffset];
+	char expected[maxLength];
+	char dst[maxLength + maxOffset];
+
+	virtual void SetUp()
+	{
+		mask[0] = 0x5a;
+		mask[1] = (char)0xc3;
+		mask[2] = 0x01;
+		mask[3] = (char)0xfe;
+
+		for (int i = 0; i < maxLength + maxOffset; ++i)
+			src[i] = (char)rand();
+	}
+
+	void computeExpected(const char *pData, int length)
+	{
+		for (int i = 0; i < length; ++i)
+			expected[i] = pData[i] ^ mask[i % 4];
+	}
+};
+
+TEST_P(WebSocketMaskTest, CopyMatchesReference)
+{
+	if (!rwsMaskKernelSupported(GetParam()))
+		return;
+
+	for (int length = 0; length <= maxLength; ++length)
+	{
+		for (int offset = 0; offset < maxOffset; offset += 3)
+		{
+			computeExpected(src + offset, length);
+			rwsMaskCopyWithKernel(GetParam(), mask, dst + (offset & 7), src + offset, length);
+			ASSERT_EQ(0, memcmp(expected, dst + (offset & 7), length)) << "length " << length << ", offset " << offset;
+		}
+	}
+}
+
+TEST_P(WebSocketMaskTest, InPlaceMatchesReference)
+{
+	if (!rwsMaskKernelSupported(GetParam()))
+		return;
+
+	for (int length = 0; length <= maxLength; ++length)
+	{
+		for (int offset = 0; offset < maxOffset; offset += 5)
+		{
+			computeExpected(src + offset, length);
+			rwsMaskCopyWithKernel(GetParam(), mask, src + offset, src + offset, length);
+			ASSERT_EQ(0, memcmp(expected, src + offset, length)) << "length " << length << ", offset " << offset;
+		}
+	}
+}
+
+TEST_P(WebSocketMaskTest, MaskingTwiceRestoresData)
+{
+	std::vector<char> original(src, src + maxLength);
+
+	if (!rwsMaskKernelSupported(GetParam()))
+		return;
+
+	rwsMaskCopyWithKernel(GetParam(), mask, dst, src, maxLength);
+	rwsMaskCopyWithKernel(GetParam(), mask, dst, dst, maxLength);
+	ASSERT_EQ(0, memcmp(&original[0], dst, maxLength));
+}
+
+INSTANTIATE_TEST_CASE_P(MaskKernels, WebSocketMaskTest, ::testing::Values(RWS_MASK_KERNEL_AUTO, RWS_MASK_KERNEL_BYTE, RWS_MASK_KERNEL_WORD, RWS_MASK_KERNEL_SSE2, RWS_MASK_KERNEL_AVX2));
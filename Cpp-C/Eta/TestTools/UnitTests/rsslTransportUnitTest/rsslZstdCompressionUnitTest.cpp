@@ -0,0 +1,231 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2022 Refinitiv. All rights reserved.              --
+ *|-----------------------------------------------------------------------------
+ */
+
+/************************************************************************
+*	 Zstandard Compression Unit Tests
+*
+*   Negotiates zstd compression over a loopback socket connection, with
+*   and without a pre-shared dictionary, and checks that messages arrive
+*   intact and smaller on the wire.
+*
+/**********************************************************************/
+
+#include "gtest/gtest.h"
+
+#include "rtr/rsslTransport.h"
+#include "zdict.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+class ZstdCompressionTest : public ::testing::Test {
+protected:
+	RsslServer *pServer;
+	RsslChannel *pClientChannel;
+	RsslChannel *pServerChannel;
+	RsslError err;
+
+	virtual void SetUp()
+	{
+		pServer = NULL;
+		pClientChannel = NULL;
+		pServerChannel = NULL;
+	}
+
+	virtual void TearDown()
+	{
+		if (pClientChannel)
+			rsslCloseChannel(pClientChannel, &err);
+		if (pServerChannel)
+			rsslCloseChannel(pServerChannel, &err);
+		if (pServer)
+			rsslCloseServer(pServer, &err);
+		rsslUninitialize();
+	}
+
+	/* Builds a message that resembles a field list update: mostly the same bytes each time, with a few that vary. */
+	static void buildMessage(int index, std::vector<char> &message)
+	{
+		char field[32];
+
+		message.clear();
+		for (int fid = 1; fid < 40; ++fid)
+		{
+			int length = snprintf(field, sizeof(field), "%c%c%05d.%02d;", (char)(fid >> 8), (char)fid, (index * 7 + fid * 13) % 99999, (index + fid) % 100);
+			message.insert(message.end(), field, field + length);
+		}
+	}
+
+	void initialize(RsslBuffer *pDictionary)
+	{
+		RsslInitializeExOpts initOpts = RSSL_INIT_INITIALIZE_EX_OPTS;
+
+		if (pDictionary)
+			initOpts.compressionDictionary = *pDictionary;
+		ASSERT_EQ(RSSL_RET_SUCCESS, rsslInitializeEx(&initOpts, &err)) << err.text;
+	}
+
+	void connect(int compressionLevel)
+	{
+		RsslBindOptions bindOpts;
+		RsslConnectOptions connectOpts;
+		RsslAcceptOptions acceptOpts;
+		RsslInProgInfo inProg;
+		RsslChannelInfo info;
+		int tries = 0;
+
+		rsslClearBindOpts(&bindOpts);
+		bindOpts.serviceName = const_cast<char*>("15010");
+		bindOpts.compressionType = RSSL_COMP_ZSTD;
+		bindOpts.compressionLevel = compressionLevel;
+		ASSERT_TRUE((pServer = rsslBind(&bindOpts, &err)) != NULL) << err.text;
+
+		rsslClearConnectOpts(&connectOpts);
+		connectOpts.connectionInfo.unified.address = const_cast<char*>("localhost");
+		connectOpts.connectionInfo.unified.serviceName = const_cast<char*>("15010");
+		connectOpts.compressionType = RSSL_COMP_ZSTD;
+		connectOpts.blocking = RSSL_FALSE;
+		ASSERT_TRUE((pClientChannel = rsslConnect(&connectOpts, &err)) != NULL) << err.text;
+
+		rsslClearAcceptOpts(&acceptOpts);
+		while ((pServerChannel = rsslAccept(pServer, &acceptOpts, &err)) == NULL && tries++ < 1000)
+			;
+		ASSERT_TRUE(pServerChannel != NULL) << err.text;
+
+		for (tries = 0; tries < 100000; ++tries)
+		{
+			if (pClientChannel->state != RSSL_CH_STATE_ACTIVE)
+			{
+				ASSERT_GE(rsslInitChannel(pClientChannel, &inProg, &err), RSSL_RET_SUCCESS) << err.text;
+			}
+			if (pServerChannel->state != RSSL_CH_STATE_ACTIVE)
+			{
+				ASSERT_GE(rsslInitChannel(pServerChannel, &inProg, &err), RSSL_RET_SUCCESS) << err.text;
+			}
+			if (pClientChannel->state == RSSL_CH_STATE_ACTIVE && pServerChannel->state == RSSL_CH_STATE_ACTIVE)
+				break;
+		}
+		ASSERT_EQ(RSSL_CH_STATE_ACTIVE, pClientChannel->state);
+		ASSERT_EQ(RSSL_CH_STATE_ACTIVE, pServerChannel->state);
+
+		ASSERT_EQ(RSSL_RET_SUCCESS, rsslGetChannelInfo(pClientChannel, &info, &err)) << err.text;
+		ASSERT_EQ(RSSL_COMP_ZSTD, info.compressionType);
+	}
+
+	/* Writes the message from the server, reads it on the client, and returns the bytes sent on the wire. */
+	RsslUInt32 roundTrip(const std::vector<char> &message)
+	{
+		RsslWriteInArgs writeInArgs;
+		RsslWriteOutArgs writeOutArgs;
+		RsslReadInArgs readInArgs;
+		RsslReadOutArgs readOutArgs;
+		RsslBuffer *pBuffer;
+		RsslRet ret;
+		int tries = 0;
+
+		pBuffer = rsslGetBuffer(pServerChannel, (RsslUInt32)message.size(), RSSL_FALSE, &err);
+		EXPECT_TRUE(pBuffer != NULL) << err.text;
+		if (!pBuffer)
+			return 0;
+		memcpy(pBuffer->data, &message[0], message.size());
+		pBuffer->length = (RsslUInt32)message.size();
+
+		rsslClearWriteInArgs(&writeInArgs);
+		rsslClearWriteOutArgs(&writeOutArgs);
+		writeInArgs.writeInFlags = RSSL_WRITE_IN_DIRECT_SOCKET_WRITE;
+		EXPECT_GE(rsslWriteEx(pServerChannel, pBuffer, &writeInArgs, &writeOutArgs, &err), RSSL_RET_SUCCESS) << err.text;
+		EXPECT_EQ(RSSL_RET_SUCCESS, rsslFlush(pServerChannel, &err)) << err.text;
+
+		do
+		{
+			rsslClearReadInArgs(&readInArgs);
+			rsslClearReadOutArgs(&readOutArgs);
+			pBuffer = rsslReadEx(pClientChannel, &readInArgs, &readOutArgs, &ret, &err);
+		} while (pBuffer == NULL && ret >= RSSL_RET_READ_WOULD_BLOCK && tries++ < 100000);
+
+		EXPECT_TRUE(pBuffer != NULL) << ret << ": " << err.text;
+		if (pBuffer)
+		{
+			EXPECT_EQ(message.size(), pBuffer->length);
+			EXPECT_EQ(0, memcmp(&message[0], pBuffer->data, message.size()));
+		}
+
+		return writeOutArgs.bytesWritten;
+	}
+};
+
+TEST_F(ZstdCompressionTest, MessagesRoundTripWithoutDictionary)
+{
+	std::vector<char> message;
+	RsslUInt32 bytesWritten = 0, uncompressedBytes = 0;
+
+	initialize(NULL);
+	connect(0);
+
+	for (int i = 0; i < 50; ++i)
+	{
+		buildMessage(i, message);
+		bytesWritten += roundTrip(message);
+		uncompressedBytes += (RsslUInt32)message.size();
+	}
+
+	ASSERT_LT(bytesWritten, uncompressedBytes);
+}
+
+TEST_F(ZstdCompressionTest, MessagesRoundTripWithDictionary)
+{
+	std::vector<char> samples, message;
+	std::vector<size_t> sampleSizes;
+	char dictionaryData[4096];
+	RsslBuffer dictionary;
+	size_t dictionaryLength;
+	RsslUInt32 bytesWritten = 0, uncompressedBytes = 0;
+
+	for (int i = 1000; i < 1500; ++i)
+	{
+		buildMessage(i, message);
+		samples.insert(samples.end(), message.begin(), message.end());
+		sampleSizes.push_back(message.size());
+	}
+
+	dictionaryLength = ZDICT_trainFromBuffer(dictionaryData, sizeof(dictionaryData), &samples[0], &sampleSizes[0], (unsigned)sampleSizes.size());
+	ASSERT_FALSE(ZDICT_isError(dictionaryLength)) << ZDICT_getErrorName(dictionaryLength);
+
+	dictionary.data = dictionaryData;
+	dictionary.length = (RsslUInt32)dictionaryLength;
+	initialize(&dictionary);
+
+	/* The dictionary was copied. */
+	memset(dictionaryData, 0, sizeof(dictionaryData));
+
+	connect(19);
+
+	for (int i = 0; i < 50; ++i)
+	{
+		buildMessage(i, message);
+		bytesWritten += roundTrip(message);
+		uncompressedBytes += (RsslUInt32)message.size();
+	}
+
+	/* Each message is mostly dictionary content, so it should shrink well below half. */
+	ASSERT_LT(bytesWritten * 2, uncompressedBytes);
+}
+
+TEST_F(ZstdCompressionTest, UntrainedDictionaryIsRejected)
+{
+	RsslInitializeExOpts initOpts = RSSL_INIT_INITIALIZE_EX_OPTS;
+	char rawContent[] = "this is raw content, not a trained dictionary";
+
+	initOpts.compressionDictionary.data = rawContent;
+	initOpts.compressionDictionary.length = (RsslUInt32)strlen(rawContent);
+	ASSERT_EQ(RSSL_RET_FAILURE, rsslInitializeEx(&initOpts, &err));
+
+	/* Initialization failed, so TearDown has nothing to uninitialize; initialize normally so that it balances. */
+	initialize(NULL);
+}
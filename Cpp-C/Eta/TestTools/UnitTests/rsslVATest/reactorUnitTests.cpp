@@ -14,6 +14,8 @@
 
 #include "rtr/rsslQueue.h"
 #include "rtr/rsslEventSignal.h"
+#include "rtr/mpscqueue.h"
+#include "rtr/rsslTimerWheel.h"
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -134,20 +136,22 @@ typedef struct
 */
 typedef struct 
 {
-	RsslQueue eventPool;
-	RsslQueue eventQueue;
-	RsslMutex eventPoolLock;
-	RsslMutex eventQueueLock;
+	rtrMpscQueue eventQueue;
+	rtr_atomic_val eventCount;
+	rtrLinkStack eventPool;
 	void *pLastEvent;
 	void *pParentGroup;
 	RsslQueueLink readyEventQueueLink;
-	RsslBool isInActiveEventQueueGroup;
+	rtr_atomic_val isInActiveEventQueueGroup;
 }MyReactorEventQueue;
 
 typedef struct 
 {
-	RsslQueue readyEventQueueGroup;
-	RsslMutex lock;
+	rtrMpscQueue readyEventQueueGroup;
+	rtr_atomic_val activeQueueCount;
+	rtr_atomic_val signalled;
+	rtr_atomic_val signalsWritten;
+	rtr_atomic_val signalsRead;
 	RsslEventSignal eventSignal;
 }MyReactorEventQueueGroup;
 
@@ -161,6 +165,7 @@ typedef struct
 	RsslNotifier *pNotifier; 
 	RsslNotifierEvent *pQueueNotifierEvent;	
 	RsslInt64 lastRecordedTimeMs;
+	RsslTimerWheel timerWheel;
 	RsslThreadId thread;
 	MyReactorEventQueue workerQueue;
 }MyRsslReactorWorker;
@@ -168,24 +173,15 @@ typedef struct
 typedef struct 
 {
 	RsslReactor reactor;							
+	void *pReactorImpl;
 	void *channelPoolArray;
-	RsslQueue channelPool;				
-	RsslQueue initializingChannels;	
-	RsslQueue activeChannels;			
-	RsslQueue inactiveChannels;			
-	RsslQueue closingChannels;			
-	RsslQueue reconnectingChannels;		
 	RsslThreadId thread;
 	MyReactorEventQueue reactorEventQueue; 
-	RsslNotifier *pNotifier; 
-	RsslNotifierEvent *pQueueNotifierEvent; 
-	RsslBuffer memoryBuffer;
-	RsslInt64 lastRecordedTimeMs;
-	RsslInt32 channelCount;			
 	RsslInt32 maxEventsInPool; 
-	RsslMutex interfaceLock; 
-	RsslBool inReactorFunction;
-	MyReactorEventQueueGroup activeEventQueueGroup;
+	void *pShards;
+	RsslUInt32 shardCount;
+	RsslReactorShardPolicy shardPolicy;
+	rtr_atomic_val nextShard;
 	MyRsslReactorWorker reactorWorker;			
 }MyReactorImpl;
 
@@ -266,6 +262,8 @@ static void reactorUnitTests_AutoMsgs(RsslConnectionTypes connectionType);
 static void reactorUnitTests_Raise(RsslConnectionTypes connectionType);
 static void reactorUnitTests_InitializationAndPingTimeout(RsslConnectionTypes connectionType);
 static void reactorUnitTests_ShortPingInterval(RsslConnectionTypes connectionType);
+static void reactorUnitTests_DirectFlush(RsslConnectionTypes connectionType);
+static void reactorUnitTests_DispatchShards(RsslConnectionTypes connectionType);
 static void reactorUnitTests_InvalidArguments(RsslConnectionTypes connectionType);
 static void reactorUnitTests_BigDirectoryMsg(RsslConnectionTypes connectionType);
 
@@ -366,6 +364,16 @@ TEST_P(ReactorUtilTest, ShortPingInterval)
 		reactorUnitTests_ShortPingInterval(GetParam());
 }
 
+TEST_P(ReactorUtilTest, DirectFlush)
+{
+	reactorUnitTests_DirectFlush(GetParam());
+}
+
+TEST_P(ReactorUtilTest, DispatchShards)
+{
+	reactorUnitTests_DispatchShards(GetParam());
+}
+
 TEST_P(ReactorUtilTest, AutoMsgs)
 {
 	reactorUnitTests_AutoMsgs(GetParam());
@@ -3842,6 +3850,179 @@ void reactorUnitTests_ShortPingInterval(RsslConnectionTypes connectionType)
 	ASSERT_TRUE(rsslCloseServer(pRsslServer, &rsslErrorInfo.rsslError) == RSSL_RET_SUCCESS); 
 }
 
+void reactorUnitTests_DirectFlush(RsslConnectionTypes connectionType)
+{
+	/* Test that a channel with direct flushing enabled flushes submitted messages without the worker thread */
+	RsslReactorChannel *pProvCh, *pConsCh;
+	RsslReactorChannelStatistic channelStatistic;
+	RsslReactorSubmitOptions submitOpts;
+	RsslCloseMsg closeMsg;
+	RsslBuffer *pMsgBuf;
+	int index = (connectionType == RSSL_CONN_TYPE_WEBSOCKET) ? 1 : 0;
+
+	clearObjects();
+
+	connectOpts[index].enableDirectFlush = RSSL_TRUE;
+	connectOpts[index].statisticFlags = RSSL_RC_ST_WRITE;
+
+	ASSERT_TRUE(rsslReactorConnect(pConsMon->pReactor, &connectOpts[index], (RsslReactorChannelRole*)&ommConsumerRole, &rsslErrorInfo) == RSSL_RET_SUCCESS);
+	ASSERT_TRUE(waitForConnection(pServer[index], 100));
+	ASSERT_TRUE(rsslReactorAccept(pProvMon->pReactor, pServer[index], &acceptOpts, (RsslReactorChannelRole*)&ommProviderRole, &rsslErrorInfo) == RSSL_RET_SUCCESS);
+
+	/* Cons: Should get conn up/ready event */
+	ASSERT_TRUE(dispatchEvent(pConsMon, 100) >= RSSL_RET_SUCCESS);
+	ASSERT_TRUE(pConsMon->mutMsg.mutMsgType == MUT_MSG_CONN && pConsMon->mutMsg.channelEvent.channelEventType == RSSL_RC_CET_CHANNEL_UP);
+	pConsCh = pConsMon->mutMsg.pReactorChannel;
+	ASSERT_TRUE(dispatchEvent(pConsMon, 100) >= RSSL_RET_SUCCESS);
+	ASSERT_TRUE(pConsMon->mutMsg.mutMsgType == MUT_MSG_CONN && pConsMon->mutMsg.channelEvent.channelEventType == RSSL_RC_CET_CHANNEL_READY);
+
+	/* Prov: Should get conn up/ready event */
+	ASSERT_TRUE(dispatchEvent(pProvMon, 100) >= RSSL_RET_SUCCESS);
+	ASSERT_TRUE(pProvMon->mutMsg.mutMsgType == MUT_MSG_CONN && pProvMon->mutMsg.channelEvent.channelEventType == RSSL_RC_CET_CHANNEL_UP);
+	pProvCh = pProvMon->mutMsg.pReactorChannel;
+	ASSERT_TRUE(dispatchEvent(pProvMon, 100) >= RSSL_RET_SUCCESS);
+	ASSERT_TRUE(pProvMon->mutMsg.mutMsgType == MUT_MSG_CONN && pProvMon->mutMsg.channelEvent.channelEventType == RSSL_RC_CET_CHANNEL_READY);
+
+	/* Reset the statistics. */
+	ASSERT_TRUE(rsslReactorRetrieveChannelStatistic(pConsMon->pReactor, pConsCh, &channelStatistic, &rsslErrorInfo) == RSSL_RET_SUCCESS);
+
+	/* Cons: Send a message */
+	rsslClearCloseMsg(&closeMsg);
+	closeMsg.msgBase.streamId = 5;
+	closeMsg.msgBase.domainType = RSSL_DMT_MARKET_PRICE;
+	closeMsg.msgBase.containerType = RSSL_DT_NO_DATA;
+
+	ASSERT_TRUE((pMsgBuf = rsslReactorGetBuffer(pConsCh, 100, RSSL_FALSE, &rsslErrorInfo)) != NULL);
+	rsslClearEncodeIterator(&eIter);
+	rsslSetEncodeIteratorRWFVersion(&eIter, pConsCh->majorVersion, pConsCh->minorVersion);
+	ASSERT_TRUE(rsslSetEncodeIteratorBuffer(&eIter, pMsgBuf) == RSSL_RET_SUCCESS);
+	ASSERT_TRUE(rsslEncodeMsg(&eIter, (RsslMsg*)&closeMsg) == RSSL_RET_SUCCESS);
+	pMsgBuf->length = rsslGetEncodedBufferLength(&eIter);
+
+	rsslClearReactorSubmitOptions(&submitOpts);
+	ASSERT_TRUE(rsslReactorSubmit(pConsMon->pReactor, pConsCh, pMsgBuf, &submitOpts, &rsslErrorInfo) == RSSL_RET_SUCCESS);
+
+	/* The message was flushed by this thread. */
+	ASSERT_TRUE(rsslReactorRetrieveChannelStatistic(pConsMon->pReactor, pConsCh, &channelStatistic, &rsslErrorInfo) == RSSL_RET_SUCCESS);
+	ASSERT_EQ((RsslUInt)1, channelStatistic.inlineFlushes);
+	ASSERT_EQ((RsslUInt)0, channelStatistic.deferredFlushes);
+
+	/* Prov: Receives the message */
+	ASSERT_TRUE(dispatchEvent(pProvMon, 100) >= RSSL_RET_SUCCESS);
+	ASSERT_TRUE(pProvMon->mutMsg.mutMsgType == MUT_MSG_RSSL);
+	ASSERT_TRUE(pProvMon->mutMsg.pRsslMsg->msgBase.msgClass == RSSL_MC_CLOSE);
+
+	removeConnection(pProvMon, pProvCh);
+	removeConnection(pConsMon, pConsCh);
+	ASSERT_TRUE(dispatchEvent(pProvMon, 100) >= RSSL_RET_SUCCESS);
+	ASSERT_TRUE(pProvMon->mutMsg.mutMsgType == MUT_MSG_NONE);
+	ASSERT_TRUE(dispatchEvent(pConsMon, 100) >= RSSL_RET_SUCCESS);
+	ASSERT_TRUE(pConsMon->mutMsg.mutMsgType == MUT_MSG_NONE);
+}
+
+void reactorUnitTests_DispatchShards(RsslConnectionTypes connectionType)
+{
+	/* Test that a channel accepted on a shard is dispatched by that shard alone, and can be used through the reactor that owns it */
+	MyReactor shardMon;
+	RsslCreateReactorOptions shardReactorOpts;
+	RsslReactorDispatchOptions dispatchOpts;
+	RsslReactorJsonConverterOptions jsonConverterOptions;
+	RsslReactor *pShardedReactor, *pShard;
+	RsslReactorChannel *pProvCh, *pConsCh;
+	RsslReactorSubmitOptions submitOpts;
+	RsslCloseMsg closeMsg;
+	RsslBuffer *pMsgBuf;
+	int index = (connectionType == RSSL_CONN_TYPE_WEBSOCKET) ? 1 : 0;
+
+	clearObjects();
+	clearMyReactor(&shardMon);
+
+	rsslClearCreateReactorOptions(&shardReactorOpts);
+	shardReactorOpts.userSpecPtr = &shardMon;
+	shardReactorOpts.dispatchShardCount = 2;
+	shardReactorOpts.shardPolicy = RSSL_REACTOR_SHARD_EXPLICIT;
+	ASSERT_TRUE((pShardedReactor = rsslCreateReactor(&shardReactorOpts, &rsslErrorInfo)) != NULL);
+
+	rsslClearReactorJsonConverterOptions(&jsonConverterOptions);
+	jsonConverterOptions.pDictionary = &dataDictionary;
+	jsonConverterOptions.defaultServiceId = 1;
+	ASSERT_TRUE(rsslReactorInitJsonConverter(pShardedReactor, &jsonConverterOptions, &rsslErrorInfo) == RSSL_RET_SUCCESS);
+
+	/* Shard 0 is the reactor itself; the other shard has its own descriptor. */
+	ASSERT_TRUE(rsslReactorGetShard(pShardedReactor, 0, &rsslErrorInfo) == pShardedReactor);
+	ASSERT_TRUE((pShard = rsslReactorGetShard(pShardedReactor, 1, &rsslErrorInfo)) != NULL);
+	ASSERT_TRUE(pShard != pShardedReactor);
+	ASSERT_TRUE(pShard->eventFd != pShardedReactor->eventFd);
+	ASSERT_TRUE(pShard->userSpecPtr == &shardMon);
+	ASSERT_TRUE(rsslReactorGetShard(pShard, 0, &rsslErrorInfo) == pShardedReactor);
+	ASSERT_TRUE(rsslReactorGetShard(pShardedReactor, 2, &rsslErrorInfo) == NULL);
+	ASSERT_TRUE(rsslDestroyReactor(pShard, &rsslErrorInfo) == RSSL_RET_INVALID_ARGUMENT);
+
+	shardMon.pReactor = pShard;
+	FD_ZERO(&shardMon.readFds);
+	FD_ZERO(&shardMon.writeFds);
+	FD_ZERO(&shardMon.exceptFds);
+	FD_SET(pShard->eventFd, &shardMon.readFds);
+	FD_SET(pShard->eventFd, &shardMon.exceptFds);
+
+	ASSERT_TRUE(rsslReactorConnect(pConsMon->pReactor, &connectOpts[index], (RsslReactorChannelRole*)&ommConsumerRole, &rsslErrorInfo) == RSSL_RET_SUCCESS);
+	ASSERT_TRUE(waitForConnection(pServer[index], 100));
+
+	/* A shard that does not exist is rejected. */
+	acceptOpts.shardIndex = 2;
+	ASSERT_TRUE(rsslReactorAccept(pShardedReactor, pServer[index], &acceptOpts, (RsslReactorChannelRole*)&ommProviderRole, &rsslErrorInfo) == RSSL_RET_INVALID_ARGUMENT);
+
+	acceptOpts.shardIndex = 1;
+	ASSERT_TRUE(rsslReactorAccept(pShardedReactor, pServer[index], &acceptOpts, (RsslReactorChannelRole*)&ommProviderRole, &rsslErrorInfo) == RSSL_RET_SUCCESS);
+
+	/* Shard 0 has nothing to dispatch for the channel. */
+	rsslClearReactorDispatchOptions(&dispatchOpts);
+	ASSERT_TRUE(rsslReactorDispatch(pShardedReactor, &dispatchOpts, &rsslErrorInfo) == RSSL_RET_SUCCESS);
+
+	/* Cons: Should get conn up/ready event */
+	ASSERT_TRUE(dispatchEvent(pConsMon, 100) >= RSSL_RET_SUCCESS);
+	ASSERT_TRUE(pConsMon->mutMsg.mutMsgType == MUT_MSG_CONN && pConsMon->mutMsg.channelEvent.channelEventType == RSSL_RC_CET_CHANNEL_UP);
+	pConsCh = pConsMon->mutMsg.pReactorChannel;
+	ASSERT_TRUE(dispatchEvent(pConsMon, 100) >= RSSL_RET_SUCCESS);
+	ASSERT_TRUE(pConsMon->mutMsg.mutMsgType == MUT_MSG_CONN && pConsMon->mutMsg.channelEvent.channelEventType == RSSL_RC_CET_CHANNEL_READY);
+
+	/* Prov: Should get conn up/ready event from the shard */
+	ASSERT_TRUE(dispatchEvent(&shardMon, 100) >= RSSL_RET_SUCCESS);
+	ASSERT_TRUE(shardMon.mutMsg.mutMsgType == MUT_MSG_CONN && shardMon.mutMsg.channelEvent.channelEventType == RSSL_RC_CET_CHANNEL_UP);
+	pProvCh = shardMon.mutMsg.pReactorChannel;
+	ASSERT_TRUE(dispatchEvent(&shardMon, 100) >= RSSL_RET_SUCCESS);
+	ASSERT_TRUE(shardMon.mutMsg.mutMsgType == MUT_MSG_CONN && shardMon.mutMsg.channelEvent.channelEventType == RSSL_RC_CET_CHANNEL_READY);
+
+	/* Prov: Send a message through the reactor that owns the shard */
+	rsslClearCloseMsg(&closeMsg);
+	closeMsg.msgBase.streamId = 5;
+	closeMsg.msgBase.domainType = RSSL_DMT_MARKET_PRICE;
+	closeMsg.msgBase.containerType = RSSL_DT_NO_DATA;
+
+	ASSERT_TRUE((pMsgBuf = rsslReactorGetBuffer(pProvCh, 100, RSSL_FALSE, &rsslErrorInfo)) != NULL);
+	rsslClearEncodeIterator(&eIter);
+	rsslSetEncodeIteratorRWFVersion(&eIter, pProvCh->majorVersion, pProvCh->minorVersion);
+	ASSERT_TRUE(rsslSetEncodeIteratorBuffer(&eIter, pMsgBuf) == RSSL_RET_SUCCESS);
+	ASSERT_TRUE(rsslEncodeMsg(&eIter, (RsslMsg*)&closeMsg) == RSSL_RET_SUCCESS);
+	pMsgBuf->length = rsslGetEncodedBufferLength(&eIter);
+
+	rsslClearReactorSubmitOptions(&submitOpts);
+	ASSERT_TRUE(rsslReactorSubmit(pShardedReactor, pProvCh, pMsgBuf, &submitOpts, &rsslErrorInfo) == RSSL_RET_SUCCESS);
+	ASSERT_TRUE(dispatchEvent(&shardMon, 100) >= RSSL_RET_SUCCESS);
+
+	/* Cons: Receives the message */
+	ASSERT_TRUE(dispatchEvent(pConsMon, 100) >= RSSL_RET_SUCCESS);
+	ASSERT_TRUE(pConsMon->mutMsg.mutMsgType == MUT_MSG_RSSL);
+	ASSERT_TRUE(pConsMon->mutMsg.pRsslMsg->msgBase.msgClass == RSSL_MC_CLOSE);
+
+	removeConnection(&shardMon, pProvCh);
+	removeConnection(pConsMon, pConsCh);
+	ASSERT_TRUE(dispatchEvent(pConsMon, 100) >= RSSL_RET_SUCCESS);
+	ASSERT_TRUE(pConsMon->mutMsg.mutMsgType == MUT_MSG_NONE);
+
+	ASSERT_TRUE(rsslDestroyReactor(pShardedReactor, &rsslErrorInfo) == RSSL_RET_SUCCESS);
+}
+
 static void reactorUnitTests_DisconnectFromCallbacksInt_Cons(bool channelDispatch, RsslConnectionTypes connectionType)
 {
 	RsslReactorChannel *pProvCh;
@@ -5092,7 +5273,7 @@ void reactorUnitTests_EventPoolSize(RsslConnectionTypes connectionType)
 
 	MyReactorImpl *pMyConsReactorImpl = (MyReactorImpl*)pConsMon->pReactor;
 	MyRsslReactorWorker *myConsReacotrWorker = &(pMyConsReactorImpl->reactorWorker);
-	RsslQueue *evtPoolCons = &(myConsReacotrWorker->workerQueue.eventPool);
+	rtrLinkStack *evtPoolCons = &(myConsReacotrWorker->workerQueue.eventPool);
 
 	/*Check pool size before connection*/
 	ASSERT_TRUE((RsslInt32)evtPoolCons->count > mOpts.maxEventsInPool);
@@ -18,6 +18,7 @@ void watchlistMiscTest_BigPostMsg(RsslConnectionTypes connectionType);
 void watchlistMiscTest_MsgKeyInUpdates(RsslConnectionTypes connectionType);
 void watchlistMiscTest_SeqNumCompare(RsslConnectionTypes connectionType);
 void watchlistMiscTest_AdminRsslMsgs(RsslConnectionTypes connectionType);
+void watchlistMiscTest_DirectFlush(RsslConnectionTypes connectionType);
 
 class WatchlistMiscUnitTest : public ::testing::TestWithParam<RsslConnectionTypes> {
 public:
@@ -68,6 +69,11 @@ TEST_P(WatchlistMiscUnitTest, AdminRsslMsgs)
 	watchlistMiscTest_AdminRsslMsgs(GetParam());
 }
 
+TEST_P(WatchlistMiscUnitTest, DirectFlush)
+{
+	watchlistMiscTest_DirectFlush(GetParam());
+}
+
 INSTANTIATE_TEST_CASE_P(
 	TestingWatchlistMiscUnitTests,
 	WatchlistMiscUnitTest,
@@ -687,3 +693,98 @@ void watchlistMiscTest_AdminRsslMsgs(RsslConnectionTypes connectionType)
 
 	wtfFinishTest();
 }
+
+void watchlistMiscTest_DirectFlush(RsslConnectionTypes connectionType)
+{
+	/* Test that messages written by the watchlist are flushed directly when the channel enables it. */
+	RsslReactorSubmitMsgOptions opts;
+	WtfSetupConnectionOpts csOpts;
+	RsslReactorChannelStatistic channelStatistic;
+	WtfEvent		*pEvent;
+	RsslRequestMsg	requestMsg, *pRequestMsg;
+	RsslInt32		providerItemStream;
+	RsslRefreshMsg	refreshMsg, *pRefreshMsg;
+	RsslPostMsg		postMsg, *pPostMsg;
+
+	ASSERT_TRUE(wtfStartTest());
+
+	wtfClearSetupConnectionOpts(&csOpts);
+	csOpts.directFlush = RSSL_TRUE;
+	wtfSetupConnection(&csOpts, connectionType);
+
+	/* The login and directory requests were flushed by the dispatching thread. */
+	ASSERT_TRUE(wtfGetChannelStatistic(WTF_TC_CONSUMER, &channelStatistic) == RSSL_RET_SUCCESS);
+	ASSERT_TRUE(channelStatistic.inlineFlushes > 0);
+	ASSERT_EQ((RsslUInt)0, channelStatistic.deferredFlushes);
+
+	/* Request an item. */
+	rsslClearRequestMsg(&requestMsg);
+	requestMsg.msgBase.streamId = 2;
+	requestMsg.msgBase.domainType = RSSL_DMT_MARKET_PRICE;
+	requestMsg.msgBase.containerType = RSSL_DT_NO_DATA;
+	requestMsg.flags = RSSL_RQMF_STREAMING | RSSL_RQMF_HAS_QOS;
+	requestMsg.qos.timeliness = RSSL_QOS_TIME_REALTIME;
+	requestMsg.qos.rate = RSSL_QOS_RATE_TICK_BY_TICK;
+
+	rsslClearReactorSubmitMsgOptions(&opts);
+	opts.pRsslMsg = (RsslMsg*)&requestMsg;
+	opts.pServiceName = &service1Name;
+	wtfSubmitMsg(&opts, WTF_TC_CONSUMER, NULL, RSSL_TRUE);
+
+	ASSERT_TRUE(wtfGetChannelStatistic(WTF_TC_CONSUMER, &channelStatistic) == RSSL_RET_SUCCESS);
+	ASSERT_EQ((RsslUInt)1, channelStatistic.inlineFlushes);
+	ASSERT_EQ((RsslUInt)0, channelStatistic.deferredFlushes);
+
+	/* Provider receives request. */
+	wtfDispatch(WTF_TC_PROVIDER, 100);
+	ASSERT_TRUE(pEvent = wtfGetEvent());
+	ASSERT_TRUE(pRequestMsg = (RsslRequestMsg*)wtfGetRsslMsg(pEvent));
+	ASSERT_TRUE(pRequestMsg->msgBase.msgClass == RSSL_MC_REQUEST);
+	providerItemStream = pRequestMsg->msgBase.streamId;
+
+	/* Provider sends refresh. */
+	rsslClearRefreshMsg(&refreshMsg);
+	refreshMsg.msgBase.streamId = providerItemStream;
+	refreshMsg.msgBase.domainType = RSSL_DMT_MARKET_PRICE;
+	refreshMsg.msgBase.containerType = RSSL_DT_NO_DATA;
+	refreshMsg.flags = RSSL_RFMF_SOLICITED | RSSL_RFMF_REFRESH_COMPLETE | RSSL_RFMF_CLEAR_CACHE;
+	refreshMsg.state.streamState = RSSL_STREAM_OPEN;
+	refreshMsg.state.dataState = RSSL_DATA_OK;
+
+	rsslClearReactorSubmitMsgOptions(&opts);
+	opts.pRsslMsg = (RsslMsg*)&refreshMsg;
+	wtfSubmitMsg(&opts, WTF_TC_PROVIDER, NULL, RSSL_TRUE);
+
+	/* Consumer receives refresh. */
+	wtfDispatch(WTF_TC_CONSUMER, 100);
+	ASSERT_TRUE(pEvent = wtfGetEvent());
+	ASSERT_TRUE(pRefreshMsg = (RsslRefreshMsg*)wtfGetRsslMsg(pEvent));
+	ASSERT_TRUE(pRefreshMsg->msgBase.msgClass == RSSL_MC_REFRESH);
+	ASSERT_TRUE(pRefreshMsg->msgBase.streamId == 2);
+
+	/* Consumer posts on the item stream; the post is also flushed directly. */
+	rsslClearPostMsg(&postMsg);
+	postMsg.flags = RSSL_PSMF_POST_COMPLETE;
+	postMsg.msgBase.streamId = 2;
+	postMsg.msgBase.domainType = RSSL_DMT_MARKET_PRICE;
+	postMsg.msgBase.containerType = RSSL_DT_NO_DATA;
+
+	ASSERT_TRUE(wtfGetChannelStatistic(WTF_TC_CONSUMER, &channelStatistic) == RSSL_RET_SUCCESS);
+
+	rsslClearReactorSubmitMsgOptions(&opts);
+	opts.pRsslMsg = (RsslMsg*)&postMsg;
+	wtfSubmitMsg(&opts, WTF_TC_CONSUMER, NULL, RSSL_TRUE);
+
+	ASSERT_TRUE(wtfGetChannelStatistic(WTF_TC_CONSUMER, &channelStatistic) == RSSL_RET_SUCCESS);
+	ASSERT_EQ((RsslUInt)1, channelStatistic.inlineFlushes);
+	ASSERT_EQ((RsslUInt)0, channelStatistic.deferredFlushes);
+
+	/* Provider receives post. */
+	wtfDispatch(WTF_TC_PROVIDER, 100);
+	ASSERT_TRUE(pEvent = wtfGetEvent());
+	ASSERT_TRUE(pPostMsg = (RsslPostMsg*)wtfGetRsslMsg(pEvent));
+	ASSERT_TRUE(pPostMsg->msgBase.msgClass == RSSL_MC_POST);
+	ASSERT_TRUE(pPostMsg->msgBase.streamId == providerItemStream);
+
+	wtfFinishTest();
+}
@@ -675,6 +675,11 @@ void wtfConnect(WtfSetupConnectionOpts *pOpts)
 	connectOpts.reconnectMinDelay = pOpts->reconnectMinDelay;
 	connectOpts.reconnectMaxDelay = pOpts->reconnectMaxDelay;
 
+	if (pOpts->directFlush)
+	{
+		connectOpts.enableDirectFlush = RSSL_TRUE;
+		connectOpts.statisticFlags = RSSL_RC_ST_WRITE;
+	}
 
 	connectOpts.rsslConnectOptions.connectionInfo.unified.address = const_cast<char*>("localhost");
 	connectOpts.rsslConnectOptions.connectionInfo.unified.serviceName = pOpts->pServerPort;
@@ -2518,6 +2523,14 @@ RsslRet wtfGetChannelInfo(WtfComponent component, RsslReactorChannelInfo *pChann
 	return rsslReactorGetChannelInfo(pReactorChannel, pChannelInfo, &rsslErrorInfo);
 }
 
+RsslRet wtfGetChannelStatistic(WtfComponent component, RsslReactorChannelStatistic *pChannelStatistic, RsslUInt16 serverIndex)
+{
+	RsslErrorInfo rsslErrorInfo;
+
+	return rsslReactorRetrieveChannelStatistic(component == WTF_TC_CONSUMER ? wtf.pConsReactor : wtf.pProvReactor,
+			wtfGetChannel(component, serverIndex), pChannelStatistic, &rsslErrorInfo);
+}
+
 static void wtfConsumerEncodeSLBehaviorsElement(RsslEncodeIterator *pIter, RsslUInt slDataStreamFlags)
 {
 	RsslElementList behaviorsEList;
@@ -339,6 +339,8 @@ typedef struct
 	RsslBool    provideDefaultServiceLoad;		/* Provide a default service's load for directory refresh. */
 	RsslBool    provideDictionaryUsedAndProvided; /* Provides dictionary used and provided list */
 	char		*pServerPort;					/* A server port to establish a connection. */
+	RsslBool	directFlush;					/* Consumer channel flushes directly and collects
+												 * write statistics. */
 } WtfSetupConnectionOpts;
 
 /* Initializes commonly used settings of WtfSetupConnectionOpts. */
@@ -363,6 +365,7 @@ static void wtfClearSetupConnectionOpts(WtfSetupConnectionOpts *pOpts)
 	pOpts->provideDefaultServiceLoad = RSSL_FALSE;
 	pOpts->provideDictionaryUsedAndProvided = RSSL_FALSE;
 	pOpts->pServerPort = const_cast<char*>("14011");
+	pOpts->directFlush = RSSL_FALSE;
 }
 
 /* Options for wtfSetupWarmStandbyConnection. */
@@ -453,6 +456,9 @@ void wtfAcceptWithTime(time_t timeoutMsec, RsslUInt64 serverIndex = 0);
 /* Gets channel information (wraps around rsslReactorGetChannelInfo). */
 RsslRet wtfGetChannelInfo(WtfComponent component, RsslReactorChannelInfo *pChannelInfo, RsslUInt16 serverIndex = 0);
 
+/* Retrieves and resets channel statistics (wraps around rsslReactorRetrieveChannelStatistic). */
+RsslRet wtfGetChannelStatistic(WtfComponent component, RsslReactorChannelStatistic *pChannelStatistic, RsslUInt16 serverIndex = 0);
+
 /* Returns the currently-used connection type for the test. */
 RsslConnectionTypes wtfGetConnectionType();
 